@@ -40,6 +40,7 @@
 #include "Basics/FirstInstancing/FirstInstancing.h"
 #include "Basics/FirstGeometryShader/FirstGeometryShader.h"
 #include "Basics/FirstTessellation/FirstTessellation.h"
+#include "Basics/FirstComputeShader/FirstComputeShader.h"
 // Advanced
 #include "Advanced/FirstGpgpu/FirstGpgpu.h"
 #include "Advanced/IcosahedronTessellation/IcosahedronTessellation.h"
@@ -124,6 +125,7 @@ ExampleRunner::ExampleRunner()
 	std::array<std::string, 7> doesNotSupportOpenGLES3 = {{"Null", "OpenGL", "Vulkan", "Direct3D9", "Direct3D10", "Direct3D11", "Direct3D12"}};
 	std::array<std::string, 6> onlyShaderModel4Plus = {{"Null", "OpenGL", "Vulkan", "Direct3D10", "Direct3D11", "Direct3D12"}};
 	std::array<std::string, 5> onlyShaderModel5Plus = {{"Null", "OpenGL", "Vulkan", "Direct3D11", "Direct3D12"}};
+	std::array<std::string, 3> onlyComputeShader = {{"Null", "OpenGL", "Vulkan"}};
 
 	// Basics
 	addExample("FirstTriangle",					&RunRenderExample<FirstTriangle>,				supportsAllRenderer);
@@ -138,6 +140,7 @@ ExampleRunner::ExampleRunner()
 	addExample("FirstInstancing",				&RunRenderExample<FirstInstancing>,				supportsAllRenderer);
 	addExample("FirstGeometryShader",			&RunRenderExample<FirstGeometryShader>,			onlyShaderModel4Plus);
 	addExample("FirstTessellation",				&RunRenderExample<FirstTessellation>,			onlyShaderModel5Plus);
+	addExample("FirstComputeShader",			&RunRenderExample<FirstComputeShader>,			onlyComputeShader);
 
 	// Advanced
 	addExample("FirstGpgpu",					&RunExample<FirstGpgpu>,						supportsAllRenderer);
@@ -115,7 +115,7 @@ void FirstGpgpu::onInitialization()
 
 	{ // Create the root signature
 		Renderer::DescriptorRangeBuilder ranges[2];
-		ranges[0].initialize(Renderer::DescriptorRangeType::SRV, 1, 0, "AlbedoMap", Renderer::ShaderVisibility::FRAGMENT);
+		ranges[0].initialize(Renderer::ResourceType::TEXTURE_2D, Renderer::DescriptorRangeType::SRV, 1, 0, "AlbedoMap", Renderer::ShaderVisibility::FRAGMENT);
 		ranges[1].initializeSampler(1, 0, Renderer::ShaderVisibility::FRAGMENT);
 
 		Renderer::RootParameterBuilder rootParameters[2];
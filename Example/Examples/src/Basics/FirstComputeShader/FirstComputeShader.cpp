@@ -0,0 +1,330 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PrecompiledHeader.h"
+#include "Basics/FirstComputeShader/FirstComputeShader.h"
+#include "Framework/Color4.h"
+
+#include <string.h>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t NUMBER_OF_ELEMENTS = 256;	///< Number of texture buffer elements to calculate the prefix sum for, must match the compute shader work group size
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+FirstComputeShader::FirstComputeShader()
+{
+	// Nothing here
+}
+
+FirstComputeShader::~FirstComputeShader()
+{
+	// The resources are released within "onDeinitialization()"
+	// Nothing here
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual IApplication methods                   ]
+//[-------------------------------------------------------]
+void FirstComputeShader::onInitialization()
+{
+	// Call the base implementation
+	ExampleBase::onInitialization();
+
+	// Get and check the renderer instance
+	// -> Texture buffer object (TBO) supported?
+	// -> Compute shaders supported?
+	Renderer::IRendererPtr renderer(getRenderer());
+	if (nullptr != renderer && renderer->getCapabilities().maximumTextureBufferSize >= ::detail::NUMBER_OF_ELEMENTS && renderer->getCapabilities().computeShader)
+	{
+		// Create the buffer and texture manager
+		mBufferManager = renderer->createBufferManager();
+		mTextureManager = renderer->createTextureManager();
+
+		{ // Create the compute root signature
+			Renderer::DescriptorRangeBuilder ranges[2];
+			ranges[0].initialize(Renderer::ResourceType::TEXTURE_BUFFER, Renderer::DescriptorRangeType::UAV, 1, 0, "InputTextureBuffer", Renderer::ShaderVisibility::COMPUTE);
+			ranges[1].initialize(Renderer::ResourceType::TEXTURE_2D, Renderer::DescriptorRangeType::UAV, 1, 1, "OutputTexture2D", Renderer::ShaderVisibility::COMPUTE);
+
+			Renderer::RootParameterBuilder rootParameters[1];
+			rootParameters[0].initializeAsDescriptorTable(static_cast<uint32_t>(glm::countof(ranges)), ranges);
+
+			// Setup
+			Renderer::RootSignatureBuilder rootSignature;
+			rootSignature.initialize(static_cast<uint32_t>(glm::countof(rootParameters)), rootParameters, 0, nullptr, Renderer::RootSignatureFlags::NONE);
+
+			// Create the instance
+			mComputeRootSignature = renderer->createRootSignature(rootSignature);
+		}
+
+		{ // Create the graphics root signature
+			Renderer::DescriptorRangeBuilder ranges[2];
+			ranges[0].initialize(Renderer::ResourceType::TEXTURE_2D, Renderer::DescriptorRangeType::SRV, 1, 0, "PrefixSumMap", Renderer::ShaderVisibility::FRAGMENT);
+			ranges[1].initializeSampler(1, 0, Renderer::ShaderVisibility::FRAGMENT);
+
+			Renderer::RootParameterBuilder rootParameters[2];
+			rootParameters[0].initializeAsDescriptorTable(1, &ranges[0]);
+			rootParameters[1].initializeAsDescriptorTable(1, &ranges[1]);
+
+			// Setup
+			Renderer::RootSignatureBuilder rootSignature;
+			rootSignature.initialize(static_cast<uint32_t>(glm::countof(rootParameters)), rootParameters, 0, nullptr, Renderer::RootSignatureFlags::ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
+
+			// Create the instance
+			mRootSignature = renderer->createRootSignature(rootSignature);
+		}
+
+		// Create sampler state and wrap it into a resource group instance
+		// -> The prefix sum is fetched per texel, so point filtering without mipmapping is all we need
+		Renderer::ISamplerState* samplerStateResource = nullptr;
+		{
+			Renderer::SamplerState samplerState = Renderer::ISamplerState::getDefaultSamplerState();
+			samplerState.filter = Renderer::FilterMode::MIN_MAG_MIP_POINT;
+			samplerState.maxLOD = 0.0f;
+			samplerStateResource = renderer->createSamplerState(samplerState);
+			Renderer::IResource* resources[1] = { samplerStateResource };
+			mSamplerStateGroup = mRootSignature->createResourceGroup(1, static_cast<uint32_t>(glm::countof(resources)), resources);
+		}
+
+		{ // Create the texture buffer, the texture and the resource groups
+			// Input texture buffer filled with ones, the inclusive prefix sum at index i is i + 1
+			float data[::detail::NUMBER_OF_ELEMENTS];
+			for (uint32_t i = 0; i < ::detail::NUMBER_OF_ELEMENTS; ++i)
+			{
+				data[i] = 1.0f;
+			}
+			Renderer::IResource* inputTextureBuffer = mBufferManager->createTextureBuffer(sizeof(data), Renderer::TextureFormat::R32_FLOAT, data, Renderer::BufferUsage::STATIC_DRAW);
+
+			// Output 2D texture written by the compute shader as unordered access view and read by the fragment shader as shader resource view
+			Renderer::IResource* outputTexture2D = mTextureManager->createTexture2D(::detail::NUMBER_OF_ELEMENTS, 1, Renderer::TextureFormat::R32_FLOAT, nullptr, Renderer::TextureFlag::UNORDERED_ACCESS);
+
+			// Create the resource groups
+			// -> The resource groups keep a reference to the used texture buffer and texture
+			{
+				Renderer::IResource* resources[2] = { inputTextureBuffer, outputTexture2D };
+				mComputeResourceGroup = mComputeRootSignature->createResourceGroup(0, static_cast<uint32_t>(glm::countof(resources)), resources);
+			}
+			{
+				Renderer::IResource* resources[1] = { outputTexture2D };
+				Renderer::ISamplerState* samplerStates[1] = { samplerStateResource };
+				mResourceGroup = mRootSignature->createResourceGroup(0, static_cast<uint32_t>(glm::countof(resources)), resources, samplerStates);
+			}
+		}
+
+		// Vertex input layout
+		const Renderer::VertexAttribute vertexAttributesLayout[] =
+		{
+			{ // Attribute 0
+				// Data destination
+				Renderer::VertexAttributeFormat::FLOAT_2,	// vertexAttributeFormat (Renderer::VertexAttributeFormat)
+				"Position",									// name[32] (char)
+				"POSITION",									// semanticName[32] (char)
+				0,											// semanticIndex (uint32_t)
+				// Data source
+				0,											// inputSlot (uint32_t)
+				0,											// alignedByteOffset (uint32_t)
+				sizeof(float) * 2,							// strideInBytes (uint32_t)
+				0											// instancesPerElement (uint32_t)
+			}
+		};
+		const Renderer::VertexAttributes vertexAttributes(static_cast<uint32_t>(glm::countof(vertexAttributesLayout)), vertexAttributesLayout);
+
+		{ // Create vertex array object (VAO)
+			// Create the vertex buffer object (VBO)
+			// -> Clip space vertex positions, left/bottom is (-1,-1) and right/top is (1,1)
+			static const float VERTEX_POSITION[] =
+			{					// Vertex ID	Triangle on screen
+				 0.0f, 1.0f,	// 0				0
+				 1.0f, 0.0f,	// 1			   .   .
+				-0.5f, 0.0f		// 2			  2.......1
+			};
+			Renderer::IVertexBufferPtr vertexBuffer(mBufferManager->createVertexBuffer(sizeof(VERTEX_POSITION), VERTEX_POSITION, Renderer::BufferUsage::STATIC_DRAW));
+
+			// Create vertex array object (VAO)
+			// -> The vertex array object (VAO) keeps a reference to the used vertex buffer object (VBO)
+			// -> This means that there's no need to keep an own vertex buffer object (VBO) reference
+			// -> When the vertex array object (VAO) is destroyed, it automatically decreases the
+			//    reference of the used vertex buffer objects (VBO). If the reference counter of a
+			//    vertex buffer object (VBO) reaches zero, it's automatically destroyed.
+			const Renderer::VertexArrayVertexBuffer vertexArrayVertexBuffers[] = { vertexBuffer };
+			mVertexArray = mBufferManager->createVertexArray(vertexAttributes, static_cast<uint32_t>(glm::countof(vertexArrayVertexBuffers)), vertexArrayVertexBuffers);
+		}
+
+		// Decide which shader language should be used (for example "GLSL" or "HLSL")
+		Renderer::IShaderLanguagePtr shaderLanguage(renderer->getShaderLanguage());
+		if (nullptr != shaderLanguage)
+		{
+			// Get the shader source code (outsourced to keep an overview)
+			const char* computeShaderSourceCode = nullptr;
+			const char* vertexShaderSourceCode = nullptr;
+			const char* fragmentShaderSourceCode = nullptr;
+			#include "FirstComputeShader_GLSL_450.h"	// For Vulkan
+			#include "FirstComputeShader_GLSL_430.h"	// OpenGL 4.3 is the first OpenGL version with compute shaders
+			#include "FirstComputeShader_Null.h"
+
+			{ // Create the compute pipeline state object
+				Renderer::IComputeShaderPtr computeShader(shaderLanguage->createComputeShaderFromSourceCode(computeShaderSourceCode));
+				if (nullptr != computeShader)
+				{
+					mComputePipelineState = renderer->createComputePipelineState(*mComputeRootSignature, *computeShader);
+				}
+			}
+
+			{ // Create the graphics pipeline state object (PSO)
+				// Create the program
+				Renderer::IProgramPtr program;
+				program = shaderLanguage->createProgram(
+					*mRootSignature,
+					vertexAttributes,
+					shaderLanguage->createVertexShaderFromSourceCode(vertexAttributes, vertexShaderSourceCode),
+					shaderLanguage->createFragmentShaderFromSourceCode(fragmentShaderSourceCode));
+
+				// Create the pipeline state object (PSO)
+				if (nullptr != program)
+				{
+					mPipelineState = renderer->createPipelineState(Renderer::PipelineStateBuilder(mRootSignature, program, vertexAttributes, getMainRenderTarget()->getRenderPass()));
+				}
+			}
+		}
+
+		// Since we're always submitting the same commands to the renderer, we can fill the command buffer once during initialization and then reuse it multiple times during runtime
+		fillCommandBuffer();
+	}
+}
+
+void FirstComputeShader::onDeinitialization()
+{
+	// Release the used resources
+	mVertexArray = nullptr;
+	mSamplerStateGroup = nullptr;
+	mResourceGroup = nullptr;
+	mPipelineState = nullptr;
+	mRootSignature = nullptr;
+	mComputeResourceGroup = nullptr;
+	mComputePipelineState = nullptr;
+	mComputeRootSignature = nullptr;
+	mCommandBuffer.clear();
+	mTextureManager = nullptr;
+	mBufferManager = nullptr;
+
+	// Call the base implementation
+	ExampleBase::onDeinitialization();
+}
+
+void FirstComputeShader::onDraw()
+{
+	// Get and check the renderer instance
+	Renderer::IRendererPtr renderer(getRenderer());
+	if (nullptr != renderer)
+	{
+		// Submit command buffer to the renderer backend
+		mCommandBuffer.submitToRenderer(*renderer);
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void FirstComputeShader::fillCommandBuffer()
+{
+	// Sanity checks
+	assert(mCommandBuffer.isEmpty());
+	assert(nullptr != mComputeRootSignature);
+	assert(nullptr != mComputePipelineState);
+	assert(nullptr != mComputeResourceGroup);
+	assert(nullptr != mRootSignature);
+	assert(nullptr != mPipelineState);
+	assert(nullptr != mResourceGroup);
+	assert(nullptr != mSamplerStateGroup);
+	assert(nullptr != mVertexArray);
+
+	// Begin debug event
+	COMMAND_BEGIN_DEBUG_EVENT_FUNCTION(mCommandBuffer)
+
+	{ // Calculate the prefix sum
+		// -> Done before clearing and drawing since e.g. Vulkan doesn't allow dispatching compute work inside a render pass
+		COMMAND_BEGIN_DEBUG_EVENT(mCommandBuffer, "Prefix sum")
+
+		// Set the used compute root signature
+		Renderer::Command::SetComputeRootSignature::create(mCommandBuffer, mComputeRootSignature);
+
+		// Set the used compute pipeline state object
+		Renderer::Command::SetComputePipelineState::create(mCommandBuffer, mComputePipelineState);
+
+		// Set compute resource groups
+		Renderer::Command::SetComputeResourceGroup::create(mCommandBuffer, 0, mComputeResourceGroup);
+
+		// Dispatch a single compute work group, all texture buffer elements are processed by one work group
+		// -> The renderer backend makes the compute shader writes visible to the following draw call
+		Renderer::Command::DispatchCompute::create(mCommandBuffer, 1);
+
+		// End debug event
+		COMMAND_END_DEBUG_EVENT(mCommandBuffer)
+	}
+
+	// Clear the color buffer of the current render target with gray, do also clear the depth buffer
+	Renderer::Command::Clear::create(mCommandBuffer, Renderer::ClearFlag::COLOR_DEPTH, Color4::GRAY);
+
+	// Set the used graphics root signature
+	Renderer::Command::SetGraphicsRootSignature::create(mCommandBuffer, mRootSignature);
+
+	// Set the used pipeline state object (PSO)
+	Renderer::Command::SetPipelineState::create(mCommandBuffer, mPipelineState);
+
+	// Set graphics resource groups
+	Renderer::Command::SetGraphicsResourceGroup::create(mCommandBuffer, 0, mResourceGroup);
+	Renderer::Command::SetGraphicsResourceGroup::create(mCommandBuffer, 1, mSamplerStateGroup);
+
+	// Input assembly (IA): Set the used vertex array
+	Renderer::Command::SetVertexArray::create(mCommandBuffer, mVertexArray);
+
+	// Render the specified geometric primitive, based on an array of vertices
+	Renderer::Command::Draw::create(mCommandBuffer, 3);
+
+	// End debug event
+	COMMAND_END_DEBUG_EVENT(mCommandBuffer)
+}
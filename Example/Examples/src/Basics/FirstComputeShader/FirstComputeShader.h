@@ -0,0 +1,110 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Framework/ExampleBase.h"
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    First compute shader example
+*
+*  @remarks
+*    Demonstrates:
+*    - Vertex buffer object (VBO)
+*    - Vertex array object (VAO)
+*    - Texture buffer object (TBO) used as unordered access view (UAV)
+*    - 2D texture used as unordered access view (UAV) and as shader resource view (SRV)
+*    - Sampler state object (SO)
+*    - Root signature
+*    - Pipeline state object (PSO)
+*    - Compute pipeline state object
+*    - Compute shader (CS), vertex shader (VS) and fragment shader (FS)
+*
+*    The compute shader calculates the inclusive prefix sum of a texture buffer filled with ones using a single work group and writes it
+*    into a 2D texture, the fragment shader is visualizing the result. A green gradient means the prefix sum is correct, red means something went wrong.
+*/
+class FirstComputeShader final : public ExampleBase
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	FirstComputeShader();
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	virtual ~FirstComputeShader() override;
+
+
+//[-------------------------------------------------------]
+//[ Public virtual IApplication methods                   ]
+//[-------------------------------------------------------]
+public:
+	virtual void onInitialization() override;
+	virtual void onDeinitialization() override;
+	virtual void onDraw() override;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	void fillCommandBuffer();
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	Renderer::IBufferManagerPtr			mBufferManager;			///< Buffer manager, can be a null pointer
+	Renderer::ITextureManagerPtr		mTextureManager;		///< Texture manager, can be a null pointer
+	Renderer::CommandBuffer				mCommandBuffer;			///< Command buffer
+	Renderer::IRootSignaturePtr			mComputeRootSignature;	///< Compute root signature, can be a null pointer
+	Renderer::IComputePipelineStatePtr	mComputePipelineState;	///< Compute pipeline state object, can be a null pointer
+	Renderer::IResourceGroupPtr			mComputeResourceGroup;	///< Compute resource group with the input texture buffer and the output 2D texture, can be a null pointer
+	Renderer::IRootSignaturePtr			mRootSignature;			///< Graphics root signature, can be a null pointer
+	Renderer::IPipelineStatePtr			mPipelineState;			///< Graphics pipeline state object (PSO), can be a null pointer
+	Renderer::IResourceGroupPtr			mResourceGroup;			///< Graphics resource group with the output 2D texture, can be a null pointer
+	Renderer::IResourceGroupPtr			mSamplerStateGroup;		///< Graphics sampler state resource group, can be a null pointer
+	Renderer::IVertexArrayPtr			mVertexArray;			///< Vertex array object (VAO), can be a null pointer
+
+
+};
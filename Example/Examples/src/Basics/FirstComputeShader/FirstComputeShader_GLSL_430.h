@@ -0,0 +1,121 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Shader start                                          ]
+//[-------------------------------------------------------]
+#ifndef RENDERER_NO_OPENGL
+if (0 == strcmp(renderer->getName(), "OpenGL"))
+{
+
+
+//[-------------------------------------------------------]
+//[ Compute shader source code                            ]
+//[-------------------------------------------------------]
+// One compute shader invocation per texture buffer element, a single work group is processing all elements and writes the result into a 2D texture
+computeShaderSourceCode = R"(#version 430 core	// OpenGL 4.3
+
+// Input
+layout(local_size_x = 256) in;
+
+// Uniforms
+layout(r32f) uniform readonly  imageBuffer InputTextureBuffer;
+layout(r32f) uniform writeonly image2D OutputTexture2D;
+
+// Shared data
+shared float SharedValues[256];
+
+// Programs
+void main()
+{
+	// Load the input value of this invocation into shared memory
+	uint index = gl_LocalInvocationID.x;
+	SharedValues[index] = imageLoad(InputTextureBuffer, int(index)).x;
+	barrier();
+
+	// Inclusive Hillis-Steele prefix sum: Each step adds the value "offset" elements to the left
+	for (uint offset = 1u; offset < 256u; offset <<= 1u)
+	{
+		float value = (index >= offset) ? SharedValues[index - offset] : 0.0;
+		barrier();
+		SharedValues[index] += value;
+		barrier();
+	}
+
+	// Write the prefix sum of this invocation
+	imageStore(OutputTexture2D, ivec2(int(index), 0), vec4(SharedValues[index]));
+}
+)";
+
+
+//[-------------------------------------------------------]
+//[ Vertex shader source code                             ]
+//[-------------------------------------------------------]
+// One vertex shader invocation per vertex
+vertexShaderSourceCode = R"(#version 430 core	// OpenGL 4.3
+
+// Attribute input/output
+in  vec2 Position;	// Clip space vertex position as input, left/bottom is (-1,-1) and right/top is (1,1)
+out gl_PerVertex
+{
+	vec4 gl_Position;
+};
+
+// Programs
+void main()
+{
+	// Pass through the clip space vertex position, left/bottom is (-1,-1) and right/top is (1,1)
+	gl_Position = vec4(Position, 0.5, 1.0);
+}
+)";
+
+
+//[-------------------------------------------------------]
+//[ Fragment shader source code                           ]
+//[-------------------------------------------------------]
+// One fragment shader invocation per fragment
+fragmentShaderSourceCode = R"(#version 430 core	// OpenGL 4.3
+
+// Attribute input/output
+out vec4 OutputColor;	// Output variable for fragment color
+
+// Uniforms
+uniform sampler2D PrefixSumMap;
+
+// Programs
+void main()
+{
+	// The input values are all one, so the inclusive prefix sum at index i must be i + 1
+	int index = int(gl_FragCoord.x) % 256;
+	float prefixSum = texelFetch(PrefixSumMap, ivec2(index, 0), 0).x;
+
+	// Return a green gradient if the prefix sum is correct, else red
+	OutputColor = (prefixSum == float(index + 1)) ? vec4(0.0, prefixSum / 256.0, 0.0, 1.0) : vec4(1.0, 0.0, 0.0, 1.0);
+}
+)";
+
+
+//[-------------------------------------------------------]
+//[ Shader end                                            ]
+//[-------------------------------------------------------]
+}
+else
+#endif
@@ -48,6 +48,7 @@
 #include <RendererRuntime/Resource/CompositorNode/Pass/DebugGui/CompositorResourcePassDebugGui.h>
 #include <RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateCompiler.h>
 #include <RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h>
+#include <RendererRuntime/Resource/MaterialBlueprint/BufferManager/GpuCullingManager.h>
 #include <RendererRuntime/Resource/Material/MaterialResourceManager.h>
 #include <RendererRuntime/Resource/Material/MaterialResource.h>
 #include <RendererRuntime/Resource/Texture/TextureResourceManager.h>
@@ -627,7 +628,17 @@ void FirstScene::createDebugGui(Renderer::IRenderTarget& mainRenderTarget)
 							ImGui::Text("Resource Streamer: %s", idle ? "Idle" : "Busy");
 						ImGui::PopStyleColor();
 					}
-					ImGui::Text("Pipeline State Compiler: %s", (0 == rendererRuntime->getPipelineStateCompiler().getNumberOfInFlightCompilerRequests()) ? "Idle" : "Busy");
+					{ // Pipeline state compiler
+						const RendererRuntime::PipelineStateCompiler& pipelineStateCompiler = rendererRuntime->getPipelineStateCompiler();
+						ImGui::Text("Pipeline State Compiler: %s", (0 == pipelineStateCompiler.getNumberOfInFlightCompilerRequests()) ? "Idle" : "Busy");
+						if (ImGui::IsItemHovered())
+						{
+							const RendererRuntime::PipelineStateCompiler::Statistics statistics = pipelineStateCompiler.getStatistics();
+							ImGui::SetTooltip("Built shaders: %u (%u reused, %u deferred) in %.1f ms\nCompiled shaders: %u, pipeline states: %u in %.1f ms",
+								statistics.numberOfBuiltShaders, statistics.numberOfReusedShaderSourceCodes, statistics.numberOfDeferredBuilderRequests, static_cast<double>(statistics.builderTimeInMicroseconds) / 1000.0,
+								statistics.numberOfCompiledShaders, statistics.numberOfCompiledPipelineStates, static_cast<double>(statistics.compilerTimeInMicroseconds) / 1000.0);
+						}
+					}
 				ImGui::PopStyleColor();
 				if (ImGui::Button("Log"))
 				{
@@ -666,6 +677,15 @@ void FirstScene::createDebugGui(Renderer::IRenderTarget& mainRenderTarget)
 					}
 					ImGui::Checkbox("High Quality Lighting", &mHighQualityLighting);
 					ImGui::Checkbox("Soft-Particles", &mSoftParticles);
+					{ // GPU culling is optional and only available if supported by the renderer
+						RendererRuntime::GpuCullingManager& gpuCullingManager = rendererRuntime->getMaterialBlueprintResourceManager().getGpuCullingManager();
+						if (gpuCullingManager.isSupported())
+						{
+							bool gpuCulling = gpuCullingManager.isEnabled();
+							ImGui::Checkbox("GPU Culling", &gpuCulling);
+							gpuCullingManager.setEnabled(gpuCulling);
+						}
+					}
 					{
 						const char* items[] = { "Point", "Bilinear", "Trilinear", "2x Anisotropic", "4x Anisotropic", "8x Anisotropic", "16x Anisotropic" };
 						ImGui::Combo("Texture filtering", &mCurrentTextureFiltering, items, static_cast<int>(glm::countof(items)));
@@ -80,4 +80,10 @@ namespace FW
 		mImpl->update();
 	}
 
+	//--------
+	void FileWatcher::update(unsigned int timeoutInMilliseconds)
+	{
+		mImpl->update(timeoutInMilliseconds);
+	}
+
 };//namespace FW
@@ -115,6 +115,9 @@ namespace FW
 		/// Updates the watcher. Must be called often.
 		void update();
 
+		/// Updates the watcher, blocks until there are file actions or the timeout has been reached.
+		void update(unsigned int timeoutInMilliseconds);
+
 	private:
 		/// The implementation
 		FileWatcherImpl* mImpl;
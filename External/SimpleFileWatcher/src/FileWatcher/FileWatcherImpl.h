@@ -68,6 +68,10 @@ namespace FW
 		/// Updates the watcher. Must be called often.
 		virtual void update() = 0;
 
+		/// Updates the watcher, blocks until there are file actions or the timeout has been reached.
+		/// The default implementation doesn't block.
+		virtual void update(unsigned int timeoutInMilliseconds) { (void)timeoutInMilliseconds; update(); }
+
 		/// Handles the action
 		virtual void handleAction(WatchStruct* watch, const String& filename, unsigned long action) = 0;
 
@@ -131,10 +131,20 @@ namespace FW
 
 	//--------
 	void FileWatcherLinux::update()
+	{
+		update(0);
+	}
+
+	//--------
+	void FileWatcherLinux::update(unsigned int timeoutInMilliseconds)
 	{
 		FD_SET(mFD, &mDescriptorSet);
 
-		int ret = select(mFD + 1, &mDescriptorSet, NULL, NULL, &mTimeOut);
+		// "select()" might modify the given timeout, so don't pass the member
+		mTimeOut.tv_sec = timeoutInMilliseconds / 1000;
+		mTimeOut.tv_usec = (timeoutInMilliseconds % 1000) * 1000;
+		struct timeval timeOut = mTimeOut;
+		int ret = select(mFD + 1, &mDescriptorSet, NULL, NULL, &timeOut);
 		if(ret < 0)
 		{
 			perror("select");
@@ -244,6 +244,13 @@ namespace FW
 		MsgWaitForMultipleObjectsEx(0, NULL, 0, QS_ALLINPUT, MWMO_ALERTABLE);
 	}
 
+	//--------
+	void FileWatcherWin32::update(unsigned int timeoutInMilliseconds)
+	{
+		// The completion routines are called as soon as the alertable wait is entered
+		MsgWaitForMultipleObjectsEx(0, NULL, timeoutInMilliseconds, QS_ALLINPUT, MWMO_ALERTABLE);
+	}
+
 	//--------
 	void FileWatcherWin32::handleAction(WatchStruct* watch, const String& filename, unsigned long action)
 	{
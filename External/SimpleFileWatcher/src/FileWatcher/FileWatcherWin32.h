@@ -65,6 +65,9 @@ namespace FW
 		/// Updates the watcher. Must be called often.
 		void update();
 
+		/// Updates the watcher, blocks until there are file actions or the timeout has been reached.
+		void update(unsigned int timeoutInMilliseconds);
+
 		/// Handles the action
 		void handleAction(WatchStruct* watch, const String& filename, unsigned long action);
 
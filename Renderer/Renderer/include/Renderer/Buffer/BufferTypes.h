@@ -57,6 +57,18 @@ namespace Renderer
 		DYNAMIC_COPY = 0x88EA	///< The data store contents will be respecified repeatedly by reading data from the OpenGL, and used many times as the source for OpenGL (drawing) commands.
 	};
 
+	/**
+	*  @brief
+	*    Indirect buffer flags
+	*/
+	struct IndirectBufferFlag final
+	{
+		enum Enum
+		{
+			UNORDERED_ACCESS = 1 << 0	///< The indirect buffer can be written by compute shaders, use it as compute shader unordered access view (UAV) which is seen as "Renderer::TextureFormat::R32_UINT" texture buffer, only supported if "Renderer::Capabilities::drawIndirectCount" is true
+		};
+	};
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
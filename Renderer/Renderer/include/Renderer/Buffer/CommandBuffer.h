@@ -48,6 +48,8 @@ namespace Renderer
 	class IRootSignature;
 	class IPipelineState;
 	class IIndirectBuffer;
+	class IComputePipelineState;
+	class IQueryPool;
 }
 
 
@@ -68,8 +70,12 @@ namespace Renderer
 		// Graphics root
 		SetGraphicsRootSignature,
 		SetGraphicsResourceGroup,
+		// Compute root
+		SetComputeRootSignature,
+		SetComputeResourceGroup,
 		// States
 		SetPipelineState,
+		SetComputePipelineState,
 		// Input-assembler (IA) stage
 		SetVertexArray,
 		// Rasterizer (RS) stage
@@ -84,6 +90,14 @@ namespace Renderer
 		// Draw call
 		Draw,
 		DrawIndexed,
+		DrawIndexedIndirectCount,
+		// Compute
+		DispatchCompute,
+		// Query
+		ResetQueryPool,
+		BeginQuery,
+		EndQuery,
+		WriteTimestampQuery,
 		// Debug
 		SetDebugMarker,
 		BeginDebugEvent,
@@ -575,6 +589,67 @@ namespace Renderer
 			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::SetGraphicsResourceGroup;
 		};
 
+		//[-------------------------------------------------------]
+		//[ Compute root                                          ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Set the used compute root signature
+		*
+		*  @param[in] rootSignature
+		*    Compute root signature to use, can be an null pointer (default: "nullptr")
+		*
+		*  @note
+		*    - The compute root signature is independent of the graphics root signature
+		*/
+		struct SetComputeRootSignature final
+		{
+			// Static methods
+			inline static void create(CommandBuffer& commandBuffer, IRootSignature* rootSignature)
+			{
+				*commandBuffer.addCommand<SetComputeRootSignature>() = SetComputeRootSignature(rootSignature);
+			}
+			// Constructor
+			inline SetComputeRootSignature(IRootSignature* _rootSignature) :
+				rootSignature(_rootSignature)
+			{}
+			// Data
+			IRootSignature* rootSignature;
+			// Static data
+			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::SetComputeRootSignature;
+		};
+
+		/**
+		*  @brief
+		*    Set a compute resource group
+		*
+		*  @param[in] rootParameterIndex
+		*    The root parameter index number for binding
+		*  @param[in] resourceGroup
+		*    Resource group to set
+		*
+		*  @note
+		*    - Unordered access view (UAV) descriptor ranges bind textures and texture buffers for read and write access inside the compute shader
+		*/
+		struct SetComputeResourceGroup final
+		{
+			// Static methods
+			inline static void create(CommandBuffer& commandBuffer, uint32_t rootParameterIndex, IResourceGroup* resourceGroup)
+			{
+				*commandBuffer.addCommand<SetComputeResourceGroup>() = SetComputeResourceGroup(rootParameterIndex, resourceGroup);
+			}
+			// Constructor
+			inline SetComputeResourceGroup(uint32_t _rootParameterIndex, IResourceGroup* _resourceGroup) :
+				rootParameterIndex(_rootParameterIndex),
+				resourceGroup(_resourceGroup)
+			{}
+			// Data
+			uint32_t		rootParameterIndex;
+			IResourceGroup*	resourceGroup;
+			// Static data
+			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::SetComputeResourceGroup;
+		};
+
 		//[-------------------------------------------------------]
 		//[ States                                                ]
 		//[-------------------------------------------------------]
@@ -602,6 +677,30 @@ namespace Renderer
 			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::SetPipelineState;
 		};
 
+		/**
+		*  @brief
+		*    Set the used compute pipeline state
+		*
+		*  @param[in] computePipelineState
+		*    Compute pipeline state to use, can be an null pointer (default: "nullptr")
+		*/
+		struct SetComputePipelineState final
+		{
+			// Static methods
+			inline static void create(CommandBuffer& commandBuffer, IComputePipelineState* computePipelineState)
+			{
+				*commandBuffer.addCommand<SetComputePipelineState>() = SetComputePipelineState(computePipelineState);
+			}
+			// Constructor
+			inline SetComputePipelineState(IComputePipelineState* _computePipelineState) :
+				computePipelineState(_computePipelineState)
+			{}
+			// Data
+			IComputePipelineState* computePipelineState;
+			// Static data
+			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::SetComputePipelineState;
+		};
+
 		//[-------------------------------------------------------]
 		//[ Input-assembler (IA) stage                            ]
 		//[-------------------------------------------------------]
@@ -1007,6 +1106,215 @@ namespace Renderer
 			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::DrawIndexed;
 		};
 
+		/**
+		*  @brief
+		*    Render the specified geometric primitive, based on indexing into an array of vertices, instancing and indirect draw with a GPU provided number of draws
+		*
+		*  @param[in] indirectBuffer
+		*    Indirect buffer to use, the indirect buffer must contain at least "maximumNumberOfDraws" instances of "Renderer::DrawIndexedInstancedArguments" starting at "indirectBufferOffset"
+		*  @param[in] indirectBufferOffset
+		*    Indirect buffer offset
+		*  @param[in] countBuffer
+		*    Indirect buffer containing the "uint32_t" number of draws at "countBufferOffset", usually written by a compute shader
+		*  @param[in] countBufferOffset
+		*    Count buffer offset, must be a multiple of four
+		*  @param[in] maximumNumberOfDraws
+		*    Maximum number of draws, the number of draws read from the count buffer is clamped against this value, can be 0
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::drawIndirectCount" is true, there's no emulation since the number of draws is only known by the GPU
+		*    - Fails if no index and/or vertex array is set
+		*/
+		struct DrawIndexedIndirectCount final
+		{
+			// Static methods
+			inline static void create(CommandBuffer& commandBuffer, const IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, const IIndirectBuffer& countBuffer, uint32_t countBufferOffset, uint32_t maximumNumberOfDraws)
+			{
+				*commandBuffer.addCommand<DrawIndexedIndirectCount>() = DrawIndexedIndirectCount(indirectBuffer, indirectBufferOffset, countBuffer, countBufferOffset, maximumNumberOfDraws);
+			}
+			// Constructor
+			inline DrawIndexedIndirectCount(const IIndirectBuffer& _indirectBuffer, uint32_t _indirectBufferOffset, const IIndirectBuffer& _countBuffer, uint32_t _countBufferOffset, uint32_t _maximumNumberOfDraws) :
+				indirectBuffer(&_indirectBuffer),
+				indirectBufferOffset(_indirectBufferOffset),
+				countBuffer(&_countBuffer),
+				countBufferOffset(_countBufferOffset),
+				maximumNumberOfDraws(_maximumNumberOfDraws)
+			{}
+			// Data
+			const IIndirectBuffer* indirectBuffer;
+			uint32_t			   indirectBufferOffset;
+			const IIndirectBuffer* countBuffer;
+			uint32_t			   countBufferOffset;
+			uint32_t			   maximumNumberOfDraws;
+			// Static data
+			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::DrawIndexedIndirectCount;
+		};
+
+		//[-------------------------------------------------------]
+		//[ Compute                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Dispatch compute work using the currently set compute pipeline state
+		*
+		*  @param[in] groupCountX
+		*    Number of thread groups dispatched in x direction
+		*  @param[in] groupCountY
+		*    Number of thread groups dispatched in y direction
+		*  @param[in] groupCountZ
+		*    Number of thread groups dispatched in z direction
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::computeShader" is true
+		*    - Fails if no compute pipeline state is set
+		*    - Writes done by the compute shader are visible to all following commands, the renderer backend inserts the required memory barrier
+		*/
+		struct DispatchCompute final
+		{
+			// Static methods
+			inline static void create(CommandBuffer& commandBuffer, uint32_t groupCountX, uint32_t groupCountY = 1, uint32_t groupCountZ = 1)
+			{
+				*commandBuffer.addCommand<DispatchCompute>() = DispatchCompute(groupCountX, groupCountY, groupCountZ);
+			}
+			// Constructor
+			inline DispatchCompute(uint32_t _groupCountX, uint32_t _groupCountY, uint32_t _groupCountZ) :
+				groupCountX(_groupCountX),
+				groupCountY(_groupCountY),
+				groupCountZ(_groupCountZ)
+			{}
+			// Data
+			uint32_t groupCountX;
+			uint32_t groupCountY;
+			uint32_t groupCountZ;
+			// Static data
+			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::DispatchCompute;
+		};
+
+		//[-------------------------------------------------------]
+		//[ Query                                                 ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Reset asynchronous queries
+		*
+		*  @param[in] queryPool
+		*    Query pool
+		*  @param[in] firstQueryIndex
+		*    First query index (e.g. 0)
+		*  @param[in] numberOfQueries
+		*    Number of queries (e.g. 1)
+		*
+		*  @note
+		*    - Must be called outside of a render pass, meaning before "Renderer::Command::SetGraphicsRenderTarget" or at the start of a command buffer
+		*/
+		struct ResetQueryPool final
+		{
+			// Static methods
+			inline static void create(CommandBuffer& commandBuffer, IQueryPool& queryPool, uint32_t firstQueryIndex = 0, uint32_t numberOfQueries = 1)
+			{
+				*commandBuffer.addCommand<ResetQueryPool>() = ResetQueryPool(queryPool, firstQueryIndex, numberOfQueries);
+			}
+			// Constructor
+			inline ResetQueryPool(IQueryPool& _queryPool, uint32_t _firstQueryIndex, uint32_t _numberOfQueries) :
+				queryPool(&_queryPool),
+				firstQueryIndex(_firstQueryIndex),
+				numberOfQueries(_numberOfQueries)
+			{}
+			// Data
+			IQueryPool* queryPool;
+			uint32_t	firstQueryIndex;
+			uint32_t	numberOfQueries;
+			// Static data
+			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::ResetQueryPool;
+		};
+
+		/**
+		*  @brief
+		*    Begin asynchronous query
+		*
+		*  @param[in] queryPool
+		*    Query pool, must be of the type "Renderer::QueryType::OCCLUSION" or "Renderer::QueryType::PIPELINE_STATISTICS"
+		*  @param[in] queryIndex
+		*    Query index (e.g. 0)
+		*/
+		struct BeginQuery final
+		{
+			// Static methods
+			inline static void create(CommandBuffer& commandBuffer, IQueryPool& queryPool, uint32_t queryIndex = 0)
+			{
+				*commandBuffer.addCommand<BeginQuery>() = BeginQuery(queryPool, queryIndex);
+			}
+			// Constructor
+			inline BeginQuery(IQueryPool& _queryPool, uint32_t _queryIndex) :
+				queryPool(&_queryPool),
+				queryIndex(_queryIndex)
+			{}
+			// Data
+			IQueryPool* queryPool;
+			uint32_t	queryIndex;
+			// Static data
+			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::BeginQuery;
+		};
+
+		/**
+		*  @brief
+		*    End asynchronous query
+		*
+		*  @param[in] queryPool
+		*    Query pool, must be of the type "Renderer::QueryType::OCCLUSION" or "Renderer::QueryType::PIPELINE_STATISTICS"
+		*  @param[in] queryIndex
+		*    Query index (e.g. 0), must match the query index of the previous "Renderer::Command::BeginQuery"
+		*/
+		struct EndQuery final
+		{
+			// Static methods
+			inline static void create(CommandBuffer& commandBuffer, IQueryPool& queryPool, uint32_t queryIndex = 0)
+			{
+				*commandBuffer.addCommand<EndQuery>() = EndQuery(queryPool, queryIndex);
+			}
+			// Constructor
+			inline EndQuery(IQueryPool& _queryPool, uint32_t _queryIndex) :
+				queryPool(&_queryPool),
+				queryIndex(_queryIndex)
+			{}
+			// Data
+			IQueryPool* queryPool;
+			uint32_t	queryIndex;
+			// Static data
+			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::EndQuery;
+		};
+
+		/**
+		*  @brief
+		*    Write asynchronous timestamp query
+		*
+		*  @param[in] queryPool
+		*    Query pool, must be of the type "Renderer::QueryType::TIMESTAMP"
+		*  @param[in] queryIndex
+		*    Query index (e.g. 0)
+		*
+		*  @note
+		*    - The timestamp is written after all previous commands have been completely executed by the GPU
+		*/
+		struct WriteTimestampQuery final
+		{
+			// Static methods
+			inline static void create(CommandBuffer& commandBuffer, IQueryPool& queryPool, uint32_t queryIndex = 0)
+			{
+				*commandBuffer.addCommand<WriteTimestampQuery>() = WriteTimestampQuery(queryPool, queryIndex);
+			}
+			// Constructor
+			inline WriteTimestampQuery(IQueryPool& _queryPool, uint32_t _queryIndex) :
+				queryPool(&_queryPool),
+				queryIndex(_queryIndex)
+			{}
+			// Data
+			IQueryPool* queryPool;
+			uint32_t	queryIndex;
+			// Static data
+			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::WriteTimestampQuery;
+		};
+
 		//[-------------------------------------------------------]
 		//[ Debug                                                 ]
 		//[-------------------------------------------------------]
@@ -216,6 +216,8 @@ namespace Renderer
 		*    Indirect buffer data, can be a null pointer (empty buffer), the data is internally copied and you have to free your memory if you no longer need it
 		*  @param[in] bufferUsage
 		*    Indication of the buffer usage
+		*  @param[in] indirectBufferFlags
+		*    Indirect buffer flags, see "Renderer::IndirectBufferFlag"
 		*
 		*  @return
 		*    The created UBO instance, null pointer on error. Release the returned instance if you no longer need it.
@@ -223,7 +225,7 @@ namespace Renderer
 		*  @note
 		*    - Only supported if "Renderer::Capabilities::maximumIndirectBufferSize" is >0
 		*/
-		virtual IIndirectBuffer* createIndirectBuffer(uint32_t numberOfBytes, const void* data = nullptr, BufferUsage bufferUsage = BufferUsage::DYNAMIC_DRAW) = 0;
+		virtual IIndirectBuffer* createIndirectBuffer(uint32_t numberOfBytes, const void* data = nullptr, BufferUsage bufferUsage = BufferUsage::DYNAMIC_DRAW, uint32_t indirectBufferFlags = 0) = 0;
 
 
 	//[-------------------------------------------------------]
@@ -74,6 +74,10 @@ namespace Renderer
 		bool				instancedArrays;								///< Instanced arrays supported? (shader model 3 feature, vertex array element advancing per-instance instead of per-vertex)
 		bool				drawInstanced;									///< Draw instanced supported? (shader model 4 feature, build in shader variable holding the current instance ID)
 		bool				baseVertex;										///< Base vertex supported for draw calls?
+		bool				drawIndirectCount;								///< Draw indirect count supported? (number of draws read from a GPU buffer, see "Renderer::Command::DrawIndexedIndirectCount", also required for "Renderer::IndirectBufferFlag::UNORDERED_ACCESS")
+		bool				occlusionQuery;									///< Occlusion queries supported? (see "Renderer::QueryType::OCCLUSION", "Renderer::IRenderer::createQueryPool()" fails for unsupported query types)
+		bool				timestampQuery;									///< Timestamp queries supported? (see "Renderer::QueryType::TIMESTAMP")
+		bool				pipelineStatisticsQuery;						///< Pipeline statistics queries supported? (see "Renderer::QueryType::PIPELINE_STATISTICS")
 		bool				nativeMultiThreading;							///< Does the renderer support native multi-threading? For example Direct3D 11 does meaning we can also create renderer resources asynchronous while for OpenGL we have to create an separate OpenGL context (less efficient, more complex to implement).
 		bool				shaderBytecode;									///< Shader bytecode supported?
 		// Vertex-shader (VS) stage
@@ -84,6 +88,8 @@ namespace Renderer
 		uint32_t			maximumNumberOfGsOutputVertices;				///< Maximum number of vertices a geometry shader (GS) can emit (usually 0 for no geometry shader support or 1024)
 		// Fragment-shader (FS) stage
 		bool				fragmentShader;									///< Is there support for fragment shaders (FS)?
+		// Compute-shader (CS) stage
+		bool				computeShader;									///< Is there support for compute shaders (CS)?
 
 
 	//[-------------------------------------------------------]
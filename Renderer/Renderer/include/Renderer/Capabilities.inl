@@ -47,12 +47,17 @@ namespace Renderer
 		instancedArrays(false),
 		drawInstanced(false),
 		baseVertex(false),
+		drawIndirectCount(false),
+		occlusionQuery(false),
+		timestampQuery(false),
+		pipelineStatisticsQuery(false),
 		nativeMultiThreading(false),
 		shaderBytecode(false),
 		vertexShader(false),
 		maximumNumberOfPatchVertices(0),
 		maximumNumberOfGsOutputVertices(0),
-		fragmentShader(false)
+		fragmentShader(false),
+		computeShader(false)
 	{
 		// Nothing here
 	}
@@ -46,6 +46,7 @@ namespace Renderer
 {
 	class ITexture;
 	class IResource;
+	class IQueryPool;
 	class ISwapChain;
 	class IRenderPass;
 	class IFramebuffer;
@@ -57,9 +58,11 @@ namespace Renderer
 	struct RootSignature;
 	class IPipelineState;
 	struct PipelineState;
+	class IComputeShader;
 	class ITextureManager;
 	class IShaderLanguage;
 	struct FramebufferAttachment;
+	class IComputePipelineState;
 }
 
 
@@ -90,6 +93,7 @@ namespace Renderer
 		friend class IProgram;
 		friend class IVertexArray;
 		friend class IRenderPass;
+		friend class IQueryPool;
 		friend class ISwapChain;
 		friend class IFramebuffer;
 		friend class IIndexBuffer;
@@ -103,12 +107,14 @@ namespace Renderer
 		friend class ITexture3D;
 		friend class ITextureCube;
 		friend class IPipelineState;
+		friend class IComputePipelineState;
 		friend class ISamplerState;
 		friend class IVertexShader;
 		friend class ITessellationControlShader;
 		friend class ITessellationEvaluationShader;
 		friend class IGeometryShader;
 		friend class IFragmentShader;
+		friend class IComputeShader;
 
 
 	//[-------------------------------------------------------]
@@ -275,6 +281,23 @@ namespace Renderer
 		*/
 		virtual IRenderPass* createRenderPass(uint32_t numberOfColorAttachments, const TextureFormat::Enum* colorAttachmentTextureFormats, TextureFormat::Enum depthStencilAttachmentTextureFormat = TextureFormat::UNKNOWN, uint8_t numberOfMultisamples = 1) = 0;
 
+		/**
+		*  @brief
+		*    Create an asynchronous query pool instance
+		*
+		*  @param[in] queryType
+		*    Type of the queries inside the query pool
+		*  @param[in] numberOfQueries
+		*    Number of queries inside the query pool, must be at least one
+		*
+		*  @return
+		*    The created query pool instance, null pointer on error. Release the returned instance if you no longer need it.
+		*
+		*  @note
+		*    - The query type must be supported, see "Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery"
+		*/
+		virtual IQueryPool* createQueryPool(QueryType queryType, uint32_t numberOfQueries = 1) = 0;
+
 		/**
 		*  @brief
 		*    Create a swap chain instance
@@ -357,6 +380,23 @@ namespace Renderer
 		*/
 		virtual IPipelineState* createPipelineState(const PipelineState& pipelineState) = 0;
 
+		/**
+		*  @brief
+		*    Create a compute pipeline state instance
+		*
+		*  @param[in] rootSignature
+		*    Root signature to use
+		*  @param[in] computeShader
+		*    Compute shader to use, compute shader and renderer must match
+		*
+		*  @return
+		*    The compute pipeline state instance, null pointer on error. Release the returned instance if you no longer need it.
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::computeShader" is "true"
+		*/
+		virtual IComputePipelineState* createComputePipelineState(IRootSignature& rootSignature, IComputeShader& computeShader) = 0;
+
 		/**
 		*  @brief
 		*    Create a sampler state instance
@@ -369,6 +409,43 @@ namespace Renderer
 		*/
 		virtual ISamplerState* createSamplerState(const SamplerState& samplerState) = 0;
 
+		//[-------------------------------------------------------]
+		//[ Pipeline cache                                        ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Return the renderer implementation specific opaque pipeline cache data
+		*
+		*  @param[out] data
+		*    Receives the pipeline cache data, can be a null pointer to just ask for the number of bytes
+		*  @param[in] numberOfBytes
+		*    Number of bytes the given data buffer can hold, ignored if "data" is a null pointer
+		*
+		*  @return
+		*    The number of bytes of the pipeline cache data, zero if not supported by the renderer implementation
+		*
+		*  @note
+		*    - Persist the data and hand it to "Renderer::IRenderer::setPipelineCacheData()" during the next run to speed up pipeline state creation
+		*/
+		virtual uint32_t getPipelineCacheData(uint8_t* data, uint32_t numberOfBytes) = 0;
+
+		/**
+		*  @brief
+		*    Set renderer implementation specific opaque pipeline cache data previously received by "Renderer::IRenderer::getPipelineCacheData()"
+		*
+		*  @param[in] data
+		*    Pipeline cache data, must be valid
+		*  @param[in] numberOfBytes
+		*    Number of bytes of the pipeline cache data
+		*
+		*  @return
+		*    "true" if the pipeline cache data was accepted, else "false" (not supported by the renderer implementation, or e.g. created by a different device or driver version)
+		*
+		*  @note
+		*    - Do only call this method while no pipeline states are created, usually directly after the renderer instance has been created
+		*/
+		virtual bool setPipelineCacheData(const uint8_t* data, uint32_t numberOfBytes) = 0;
+
 		//[-------------------------------------------------------]
 		//[ Resource handling                                     ]
 		//[-------------------------------------------------------]
@@ -403,6 +480,33 @@ namespace Renderer
 		*/
 		virtual void unmap(IResource& resource, uint32_t subresource) = 0;
 
+		/**
+		*  @brief
+		*    Get asynchronous query pool results
+		*
+		*  @param[in]  queryPool
+		*    Query pool to read the results from
+		*  @param[in]  numberOfDataBytes
+		*    Number of bytes the given data buffer can hold, must be large enough to hold all requested query results
+		*  @param[out] data
+		*    Receives one 64-bit unsigned integer per occlusion or timestamp query respectively one "Renderer::PipelineStatisticsQueryResult" per pipeline statistics query, must be valid
+		*  @param[in]  firstQueryIndex
+		*    Index of the first query to read the result from
+		*  @param[in]  numberOfQueries
+		*    Number of queries to read the results from
+		*  @param[in]  strideInBytes
+		*    Stride in bytes between two query results inside the given data buffer, "0" for tightly packed results
+		*  @param[in]  queryResultFlags
+		*    Query result flags, see "Renderer::QueryResultFlags"
+		*
+		*  @return
+		*    "true" if all requested results are available and have been written into the given data buffer, else "false"
+		*
+		*  @note
+		*    - Without "Renderer::QueryResultFlags::WAIT" this method never stalls, poll the results a few frames after the queries were recorded
+		*/
+		virtual bool getQueryPoolResults(IQueryPool& queryPool, uint32_t numberOfDataBytes, uint8_t* data, uint32_t firstQueryIndex = 0, uint32_t numberOfQueries = 1, uint32_t strideInBytes = 0, uint32_t queryResultFlags = 0) = 0;
+
 		//[-------------------------------------------------------]
 		//[ Operations                                            ]
 		//[-------------------------------------------------------]
@@ -135,6 +135,7 @@ namespace Renderer
 		class IProgram;
 		class IVertexArray;
 		class IRenderPass;
+		class IQueryPool;
 		class IRenderTarget;
 			class IRenderWindow;
 			class ISwapChain;
@@ -157,6 +158,7 @@ namespace Renderer
 			class ITextureCube;
 		class IState;
 			class IPipelineState;
+			class IComputePipelineState;
 			class ISamplerState;
 		class IShader;
 			class IVertexShader;
@@ -164,6 +166,7 @@ namespace Renderer
 			class ITessellationEvaluationShader;
 			class IGeometryShader;
 			class IFragmentShader;
+			class IComputeShader;
 }
 
 
@@ -474,6 +477,33 @@ namespace Renderer
 				COLOR_DEPTH = COLOR | DEPTH
 			};
 		};
+		enum class QueryType
+		{
+			OCCLUSION			= 0,
+			TIMESTAMP			= 1,
+			PIPELINE_STATISTICS	= 2
+		};
+		struct PipelineStatisticsQueryResult final
+		{
+			uint64_t numberOfInputAssemblerVertices;
+			uint64_t numberOfInputAssemblerPrimitives;
+			uint64_t numberOfVertexShaderInvocations;
+			uint64_t numberOfGeometryShaderInvocations;
+			uint64_t numberOfGeometryShaderOutputPrimitives;
+			uint64_t numberOfClippingInputPrimitives;
+			uint64_t numberOfClippingOutputPrimitives;
+			uint64_t numberOfFragmentShaderInvocations;
+			uint64_t numberOfTessellationControlShaderPatches;
+			uint64_t numberOfTessellationEvaluationShaderInvocations;
+			uint64_t numberOfComputeShaderInvocations;
+		};
+		struct QueryResultFlags final
+		{
+			enum Enum
+			{
+				WAIT = 1 << 0
+			};
+		};
 		enum class ComparisonFunc
 		{
 			NEVER		  = 1,
@@ -530,25 +560,28 @@ namespace Renderer
 			PROGRAM						   = 2,
 			VERTEX_ARRAY				   = 3,
 			RENDER_PASS					   = 4,
-			SWAP_CHAIN					   = 5,
-			FRAMEBUFFER					   = 6,
-			INDEX_BUFFER				   = 7,
-			VERTEX_BUFFER				   = 8,
-			UNIFORM_BUFFER				   = 9,
-			TEXTURE_BUFFER				   = 10,
-			INDIRECT_BUFFER				   = 11,
-			TEXTURE_1D					   = 12,
-			TEXTURE_2D					   = 13,
-			TEXTURE_2D_ARRAY			   = 14,
-			TEXTURE_3D					   = 15,
-			TEXTURE_CUBE				   = 16,
-			PIPELINE_STATE				   = 17,
-			SAMPLER_STATE				   = 18,
-			VERTEX_SHADER				   = 19,
-			TESSELLATION_CONTROL_SHADER	   = 20,
-			TESSELLATION_EVALUATION_SHADER = 21,
-			GEOMETRY_SHADER				   = 22,
-			FRAGMENT_SHADER				   = 23
+			QUERY_POOL					   = 5,
+			SWAP_CHAIN					   = 6,
+			FRAMEBUFFER					   = 7,
+			INDEX_BUFFER				   = 8,
+			VERTEX_BUFFER				   = 9,
+			UNIFORM_BUFFER				   = 10,
+			TEXTURE_BUFFER				   = 11,
+			INDIRECT_BUFFER				   = 12,
+			TEXTURE_1D					   = 13,
+			TEXTURE_2D					   = 14,
+			TEXTURE_2D_ARRAY			   = 15,
+			TEXTURE_3D					   = 16,
+			TEXTURE_CUBE				   = 17,
+			PIPELINE_STATE				   = 18,
+			COMPUTE_PIPELINE_STATE		   = 19,
+			SAMPLER_STATE				   = 20,
+			VERTEX_SHADER				   = 21,
+			TESSELLATION_CONTROL_SHADER	   = 22,
+			TESSELLATION_EVALUATION_SHADER = 23,
+			GEOMETRY_SHADER				   = 24,
+			FRAGMENT_SHADER				   = 25,
+			COMPUTE_SHADER				   = 26
 		};
 	#endif
 
@@ -618,7 +651,8 @@ namespace Renderer
 			TESSELLATION_CONTROL    = 2,
 			TESSELLATION_EVALUATION = 3,
 			GEOMETRY                = 4,
-			FRAGMENT                = 5
+			FRAGMENT                = 5,
+			COMPUTE                 = 6
 		};
 		struct DescriptorRange
 		{
@@ -630,6 +664,7 @@ namespace Renderer
 			uint32_t			  offsetInDescriptorsFromTableStart;
 			char				  baseShaderRegisterName[NAME_LENGTH];
 			ShaderVisibility	  shaderVisibility;
+			ResourceType		  resourceType;
 		};
 		struct DescriptorRangeBuilder final : public DescriptorRange
 		{
@@ -639,6 +674,7 @@ namespace Renderer
 			explicit DescriptorRangeBuilder(const DescriptorRangeBuilder&)
 			{}
 			DescriptorRangeBuilder(
+				ResourceType _resourceType,
 				DescriptorRangeType _rangeType,
 				uint32_t _numberOfDescriptors,
 				uint32_t _baseShaderRegister,
@@ -647,7 +683,7 @@ namespace Renderer
 				uint32_t _registerSpace = 0,
 				uint32_t _offsetInDescriptorsFromTableStart = OFFSET_APPEND)
 			{
-				initialize(_rangeType, _numberOfDescriptors, _baseShaderRegister, _baseShaderRegisterName, _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
+				initialize(_resourceType, _rangeType, _numberOfDescriptors, _baseShaderRegister, _baseShaderRegisterName, _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
 			}
 			inline void initializeSampler(
 				uint32_t _numberOfDescriptors,
@@ -656,9 +692,10 @@ namespace Renderer
 				uint32_t _registerSpace = 0,
 				uint32_t _offsetInDescriptorsFromTableStart = OFFSET_APPEND)
 			{
-				initialize(*this, DescriptorRangeType::SAMPLER, _numberOfDescriptors, _baseShaderRegister, "", _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
+				initialize(*this, ResourceType::SAMPLER_STATE, DescriptorRangeType::SAMPLER, _numberOfDescriptors, _baseShaderRegister, "", _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
 			}
 			inline void initialize(
+				ResourceType _resourceType,
 				DescriptorRangeType _rangeType,
 				uint32_t _numberOfDescriptors,
 				uint32_t _baseShaderRegister,
@@ -667,10 +704,11 @@ namespace Renderer
 				uint32_t _registerSpace = 0,
 				uint32_t _offsetInDescriptorsFromTableStart = OFFSET_APPEND)
 			{
-				initialize(*this, _rangeType, _numberOfDescriptors, _baseShaderRegister, _baseShaderRegisterName, _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
+				initialize(*this, _resourceType, _rangeType, _numberOfDescriptors, _baseShaderRegister, _baseShaderRegisterName, _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
 			}
 			static inline void initialize(
 				DescriptorRange& range,
+				ResourceType _resourceType,
 				DescriptorRangeType _rangeType,
 				uint32_t _numberOfDescriptors,
 				uint32_t _baseShaderRegister,
@@ -686,6 +724,7 @@ namespace Renderer
 				range.offsetInDescriptorsFromTableStart = _offsetInDescriptorsFromTableStart;
 				strcpy(range.baseShaderRegisterName, _baseShaderRegisterName);
 				range.shaderVisibility = _shaderVisibility;
+				range.resourceType = _resourceType;
 			}
 		};
 		struct RootDescriptorTable
@@ -1212,7 +1251,8 @@ namespace Renderer
 			{
 				DATA_CONTAINS_MIPMAPS = 1 << 0,
 				GENERATE_MIPMAPS      = 1 << 1,
-				RENDER_TARGET         = 1 << 2
+				RENDER_TARGET         = 1 << 2,
+				UNORDERED_ACCESS      = 1 << 3
 			};
 		};
 		enum class TextureUsage
@@ -1395,6 +1435,13 @@ namespace Renderer
 			DYNAMIC_READ = 0x88E9,
 			DYNAMIC_COPY = 0x88EA
 		};
+		struct IndirectBufferFlag final
+		{
+			enum Enum
+			{
+				UNORDERED_ACCESS = 1 << 0
+			};
+		};
 	#endif
 
 	// Renderer/Buffer/VertexArrayTypes.h
@@ -1769,11 +1816,15 @@ namespace Renderer
 		public:
 			inline ShaderBytecode() :
 				mNumberOfBytes(0),
-				mBytecode(nullptr)
+				mBytecode(nullptr),
+				mOwnsBytecode(true)
 			{}
 			inline ~ShaderBytecode()
 			{
-				delete [] mBytecode;
+				if (mOwnsBytecode)
+				{
+					delete [] mBytecode;
+				}
 			}
 			inline uint32_t getNumberOfBytes() const
 			{
@@ -1785,14 +1836,30 @@ namespace Renderer
 			}
 			inline void setBytecodeCopy(uint32_t numberOfBytes, uint8_t* bytecode)
 			{
-				delete [] mBytecode;
+				if (mOwnsBytecode)
+				{
+					delete [] mBytecode;
+				}
+				uint8_t* bytecodeCopy = new uint8_t[numberOfBytes];
+				memcpy(bytecodeCopy, bytecode, numberOfBytes);
+				mNumberOfBytes = numberOfBytes;
+				mBytecode = bytecodeCopy;
+				mOwnsBytecode = true;
+			}
+			inline void setBytecodeReference(uint32_t numberOfBytes, const uint8_t* bytecode)
+			{
+				if (mOwnsBytecode)
+				{
+					delete [] mBytecode;
+				}
 				mNumberOfBytes = numberOfBytes;
-				mBytecode = new uint8_t[mNumberOfBytes];
-				memcpy(mBytecode, bytecode, mNumberOfBytes);
+				mBytecode = bytecode;
+				mOwnsBytecode = false;
 			}
 		private:
-			uint32_t mNumberOfBytes;
-			uint8_t* mBytecode;
+			uint32_t	   mNumberOfBytes;
+			const uint8_t* mBytecode;
+			bool		   mOwnsBytecode;
 		};
 		struct ShaderSourceCode final
 		{
@@ -1977,12 +2044,17 @@ namespace Renderer
 			bool				instancedArrays;
 			bool				drawInstanced;
 			bool				baseVertex;
+			bool				drawIndirectCount;
+			bool				occlusionQuery;
+			bool				timestampQuery;
+			bool				pipelineStatisticsQuery;
 			bool				nativeMultiThreading;
 			bool				shaderBytecode;
 			bool				vertexShader;
 			uint32_t			maximumNumberOfPatchVertices;
 			uint32_t			maximumNumberOfGsOutputVertices;
 			bool				fragmentShader;
+			bool				computeShader;
 		public:
 			inline Capabilities() :
 				deviceName{},
@@ -2003,12 +2075,17 @@ namespace Renderer
 				instancedArrays(false),
 				drawInstanced(false),
 				baseVertex(false),
+				drawIndirectCount(false),
+				occlusionQuery(false),
+				timestampQuery(false),
+				pipelineStatisticsQuery(false),
 				nativeMultiThreading(false),
 				shaderBytecode(false),
 				vertexShader(false),
 				maximumNumberOfPatchVertices(0),
 				maximumNumberOfGsOutputVertices(0),
-				fragmentShader(false)
+				fragmentShader(false),
+				computeShader(false)
 			{}
 			inline ~Capabilities()
 			{}
@@ -2035,6 +2112,8 @@ namespace Renderer
 			std::atomic<uint32_t> numberOfCreatedVertexArrays;
 			std::atomic<uint32_t> currentNumberOfRenderPasses;
 			std::atomic<uint32_t> numberOfCreatedRenderPasses;
+			std::atomic<uint32_t> currentNumberOfQueryPools;
+			std::atomic<uint32_t> numberOfCreatedQueryPools;
 			std::atomic<uint32_t> currentNumberOfSwapChains;
 			std::atomic<uint32_t> numberOfCreatedSwapChains;
 			std::atomic<uint32_t> currentNumberOfFramebuffers;
@@ -2061,6 +2140,8 @@ namespace Renderer
 			std::atomic<uint32_t> numberOfCreatedTextureCubes;
 			std::atomic<uint32_t> currentNumberOfPipelineStates;
 			std::atomic<uint32_t> numberOfCreatedPipelineStates;
+			std::atomic<uint32_t> currentNumberOfComputePipelineStates;
+			std::atomic<uint32_t> numberOfCreatedComputePipelineStates;
 			std::atomic<uint32_t> currentNumberOfSamplerStates;
 			std::atomic<uint32_t> numberOfCreatedSamplerStates;
 			std::atomic<uint32_t> currentNumberOfVertexShaders;
@@ -2073,6 +2154,8 @@ namespace Renderer
 			std::atomic<uint32_t> numberOfCreatedGeometryShaders;
 			std::atomic<uint32_t> currentNumberOfFragmentShaders;
 			std::atomic<uint32_t> numberOfCreatedFragmentShaders;
+			std::atomic<uint32_t> currentNumberOfComputeShaders;
+			std::atomic<uint32_t> numberOfCreatedComputeShaders;
 		public:
 			inline Statistics() :
 				currentNumberOfRootSignatures(0),
@@ -2085,6 +2168,8 @@ namespace Renderer
 				numberOfCreatedVertexArrays(0),
 				currentNumberOfRenderPasses(0),
 				numberOfCreatedRenderPasses(0),
+				currentNumberOfQueryPools(0),
+				numberOfCreatedQueryPools(0),
 				currentNumberOfSwapChains(0),
 				numberOfCreatedSwapChains(0),
 				currentNumberOfFramebuffers(0),
@@ -2111,6 +2196,8 @@ namespace Renderer
 				numberOfCreatedTextureCubes(0),
 				currentNumberOfPipelineStates(0),
 				numberOfCreatedPipelineStates(0),
+				currentNumberOfComputePipelineStates(0),
+				numberOfCreatedComputePipelineStates(0),
 				currentNumberOfSamplerStates(0),
 				numberOfCreatedSamplerStates(0),
 				currentNumberOfVertexShaders(0),
@@ -2122,7 +2209,9 @@ namespace Renderer
 				currentNumberOfGeometryShaders(0),
 				numberOfCreatedGeometryShaders(0),
 				currentNumberOfFragmentShaders(0),
-				numberOfCreatedFragmentShaders(0)
+				numberOfCreatedFragmentShaders(0),
+				currentNumberOfComputeShaders(0),
+				numberOfCreatedComputeShaders(0)
 			{}
 			inline ~Statistics()
 			{}
@@ -2133,6 +2222,7 @@ namespace Renderer
 						currentNumberOfPrograms +
 						currentNumberOfVertexArrays +
 						currentNumberOfRenderPasses +
+						currentNumberOfQueryPools +
 						currentNumberOfSwapChains +
 						currentNumberOfFramebuffers +
 						currentNumberOfIndexBuffers +
@@ -2146,12 +2236,14 @@ namespace Renderer
 						currentNumberOfTexture3Ds +
 						currentNumberOfTextureCubes +
 						currentNumberOfPipelineStates +
+						currentNumberOfComputePipelineStates +
 						currentNumberOfSamplerStates +
 						currentNumberOfVertexShaders +
 						currentNumberOfTessellationControlShaders +
 						currentNumberOfTessellationEvaluationShaders +
 						currentNumberOfGeometryShaders +
-						currentNumberOfFragmentShaders;
+						currentNumberOfFragmentShaders +
+						currentNumberOfComputeShaders;
 			}
 		private:
 			explicit Statistics(const Statistics&) = delete;
@@ -2193,15 +2285,20 @@ namespace Renderer
 			virtual const char* getShaderLanguageName(uint32_t index) const = 0;
 			virtual IShaderLanguage* getShaderLanguage(const char* shaderLanguageName = nullptr) = 0;
 			virtual IRenderPass* createRenderPass(uint32_t numberOfColorAttachments, const TextureFormat::Enum* colorAttachmentTextureFormats, TextureFormat::Enum depthStencilAttachmentTextureFormat = TextureFormat::UNKNOWN, uint8_t numberOfMultisamples = 1) = 0;
+			virtual IQueryPool* createQueryPool(QueryType queryType, uint32_t numberOfQueries = 1) = 0;
 			virtual ISwapChain* createSwapChain(IRenderPass& renderPass, WindowHandle windowHandle, bool useExternalContext = false) = 0;
 			virtual IFramebuffer* createFramebuffer(IRenderPass& renderPass, const FramebufferAttachment* colorFramebufferAttachments, const FramebufferAttachment* depthStencilFramebufferAttachment = nullptr) = 0;
 			virtual IBufferManager *createBufferManager() = 0;
 			virtual ITextureManager *createTextureManager() = 0;
 			virtual IRootSignature* createRootSignature(const RootSignature& rootSignature) = 0;
 			virtual IPipelineState* createPipelineState(const PipelineState& pipelineState) = 0;
+			virtual IComputePipelineState* createComputePipelineState(IRootSignature& rootSignature, IComputeShader& computeShader) = 0;
 			virtual ISamplerState* createSamplerState(const SamplerState& samplerState) = 0;
+			virtual uint32_t getPipelineCacheData(uint8_t* data, uint32_t numberOfBytes) = 0;
+			virtual bool setPipelineCacheData(const uint8_t* data, uint32_t numberOfBytes) = 0;
 			virtual bool map(IResource& resource, uint32_t subresource, MapType mapType, uint32_t mapFlags, MappedSubresource& mappedSubresource) = 0;
 			virtual void unmap(IResource& resource, uint32_t subresource) = 0;
+			virtual bool getQueryPoolResults(IQueryPool& queryPool, uint32_t numberOfDataBytes, uint8_t* data, uint32_t firstQueryIndex = 0, uint32_t numberOfQueries = 1, uint32_t strideInBytes = 0, uint32_t queryResultFlags = 0) = 0;
 			virtual bool beginScene() = 0;
 			virtual void submitCommandBuffer(const CommandBuffer& commandBuffer) = 0;
 			virtual void endScene() = 0;
@@ -2277,6 +2374,8 @@ namespace Renderer
 			virtual IGeometryShader* createGeometryShaderFromSourceCode(const ShaderSourceCode& shaderSourceCode, GsInputPrimitiveTopology gsInputPrimitiveTopology, GsOutputPrimitiveTopology gsOutputPrimitiveTopology, uint32_t numberOfOutputVertices, ShaderBytecode* shaderBytecode = nullptr) = 0;
 			virtual IFragmentShader* createFragmentShaderFromBytecode(const ShaderBytecode& shaderBytecode) = 0;
 			virtual IFragmentShader* createFragmentShaderFromSourceCode(const ShaderSourceCode& shaderSourceCode, ShaderBytecode* shaderBytecode = nullptr) = 0;
+			virtual IComputeShader* createComputeShaderFromBytecode(const ShaderBytecode& shaderBytecode) = 0;
+			virtual IComputeShader* createComputeShaderFromSourceCode(const ShaderSourceCode& shaderSourceCode, ShaderBytecode* shaderBytecode = nullptr) = 0;
 			virtual IProgram* createProgram(const IRootSignature& rootSignature, const VertexAttributes& vertexAttributes, IVertexShader* vertexShader, ITessellationControlShader* tessellationControlShader, ITessellationEvaluationShader* tessellationEvaluationShader, IGeometryShader* geometryShader, IFragmentShader* fragmentShader) = 0;
 		protected:
 			explicit IShaderLanguage(IRenderer& renderer);
@@ -2362,6 +2461,21 @@ namespace Renderer
 		typedef SmartRefCount<IResourceGroup> IResourceGroupPtr;
 	#endif
 
+	// Renderer/IQueryPool.h
+	#ifndef __RENDERER_IQUERYPOOL_H__
+	#define __RENDERER_IQUERYPOOL_H__
+		class IQueryPool : public IResource
+		{
+		public:
+			virtual ~IQueryPool() override;
+		protected:
+			explicit IQueryPool(IRenderer& renderer);
+			explicit IQueryPool(const IQueryPool& source) = delete;
+			IQueryPool& operator =(const IQueryPool& source) = delete;
+		};
+		typedef SmartRefCount<IQueryPool> IQueryPoolPtr;
+	#endif
+
 	// Renderer/Shader/IProgram.h
 	#ifndef __RENDERER_IPROGRAM_H__
 	#define __RENDERER_IPROGRAM_H__
@@ -2510,7 +2624,7 @@ namespace Renderer
 			virtual IVertexArray* createVertexArray(const VertexAttributes& vertexAttributes, uint32_t numberOfVertexBuffers, const VertexArrayVertexBuffer* vertexBuffers, IIndexBuffer* indexBuffer = nullptr) = 0;
 			virtual IUniformBuffer* createUniformBuffer(uint32_t numberOfBytes, const void* data = nullptr, BufferUsage bufferUsage = BufferUsage::DYNAMIC_DRAW) = 0;
 			virtual ITextureBuffer* createTextureBuffer(uint32_t numberOfBytes, TextureFormat::Enum textureFormat, const void* data = nullptr, BufferUsage bufferUsage = BufferUsage::DYNAMIC_DRAW) = 0;
-			virtual IIndirectBuffer* createIndirectBuffer(uint32_t numberOfBytes, const void* data = nullptr, BufferUsage bufferUsage = BufferUsage::DYNAMIC_DRAW) = 0;
+			virtual IIndirectBuffer* createIndirectBuffer(uint32_t numberOfBytes, const void* data = nullptr, BufferUsage bufferUsage = BufferUsage::DYNAMIC_DRAW, uint32_t indirectBufferFlags = 0) = 0;
 		protected:
 			inline explicit IBufferManager(IRenderer& renderer);
 			explicit IBufferManager(const IBufferManager& source) = delete;
@@ -2847,6 +2961,21 @@ namespace Renderer
 		typedef SmartRefCount<IPipelineState> IPipelineStatePtr;
 	#endif
 
+	// Renderer/State/IComputePipelineState.h
+	#ifndef __RENDERER_ICOMPUTEPIPELINESTATE_H__
+	#define __RENDERER_ICOMPUTEPIPELINESTATE_H__
+		class IComputePipelineState : public IState
+		{
+		public:
+			virtual ~IComputePipelineState() override;
+		protected:
+			explicit IComputePipelineState(IRenderer& renderer);
+			explicit IComputePipelineState(const IComputePipelineState& source) = delete;
+			IComputePipelineState& operator =(const IComputePipelineState& source) = delete;
+		};
+		typedef SmartRefCount<IComputePipelineState> IComputePipelineStatePtr;
+	#endif
+
 	// Renderer/State/ISamplerState.h
 	#ifndef __RENDERER_ISAMPLERSTATE_H__
 	#define __RENDERER_ISAMPLERSTATE_H__
@@ -2977,6 +3106,21 @@ namespace Renderer
 		typedef SmartRefCount<IFragmentShader> IFragmentShaderPtr;
 	#endif
 
+	// Renderer/Shader/IComputeShader.h
+	#ifndef __RENDERER_ICOMPUTESHADER_H__
+	#define __RENDERER_ICOMPUTESHADER_H__
+		class IComputeShader : public IShader
+		{
+		public:
+			virtual ~IComputeShader() override;
+		protected:
+			explicit IComputeShader(IRenderer& renderer);
+			explicit IComputeShader(const IComputeShader& source) = delete;
+			IComputeShader& operator =(const IComputeShader& source) = delete;
+		};
+		typedef SmartRefCount<IComputeShader> IComputeShaderPtr;
+	#endif
+
 	// Renderer/Buffer/CommandBuffer.h
 	#ifndef __RENDERER_COMMANDBUFFER_H__
 	#define __RENDERER_COMMANDBUFFER_H__
@@ -2985,7 +3129,10 @@ namespace Renderer
 			ExecuteCommandBuffer = 0,
 			SetGraphicsRootSignature,
 			SetGraphicsResourceGroup,
+			SetComputeRootSignature,
+			SetComputeResourceGroup,
 			SetPipelineState,
+			SetComputePipelineState,
 			SetVertexArray,
 			SetViewports,
 			SetScissorRectangles,
@@ -2995,6 +3142,12 @@ namespace Renderer
 			CopyResource,
 			Draw,
 			DrawIndexed,
+			DrawIndexedIndirectCount,
+			DispatchCompute,
+			ResetQueryPool,
+			BeginQuery,
+			EndQuery,
+			WriteTimestampQuery,
 			SetDebugMarker,
 			BeginDebugEvent,
 			EndDebugEvent,
@@ -3250,6 +3403,32 @@ namespace Renderer
 				IResourceGroup* resourceGroup;
 				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::SetGraphicsResourceGroup;
 			};
+			struct SetComputeRootSignature final
+			{
+				inline static void create(CommandBuffer& commandBuffer, IRootSignature* rootSignature)
+				{
+					*commandBuffer.addCommand<SetComputeRootSignature>() = SetComputeRootSignature(rootSignature);
+				}
+				inline SetComputeRootSignature(IRootSignature* _rootSignature) :
+					rootSignature(_rootSignature)
+				{}
+				IRootSignature* rootSignature;
+				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::SetComputeRootSignature;
+			};
+			struct SetComputeResourceGroup final
+			{
+				inline static void create(CommandBuffer& commandBuffer, uint32_t rootParameterIndex, IResourceGroup* resourceGroup)
+				{
+					*commandBuffer.addCommand<SetComputeResourceGroup>() = SetComputeResourceGroup(rootParameterIndex, resourceGroup);
+				}
+				inline SetComputeResourceGroup(uint32_t _rootParameterIndex, IResourceGroup* _resourceGroup) :
+					rootParameterIndex(_rootParameterIndex),
+					resourceGroup(_resourceGroup)
+				{}
+				uint32_t		rootParameterIndex;
+				IResourceGroup*	resourceGroup;
+				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::SetComputeResourceGroup;
+			};
 			struct SetPipelineState final
 			{
 				inline static void create(CommandBuffer& commandBuffer, IPipelineState* pipelineState)
@@ -3262,6 +3441,18 @@ namespace Renderer
 				IPipelineState* pipelineState;
 				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::SetPipelineState;
 			};
+			struct SetComputePipelineState final
+			{
+				inline static void create(CommandBuffer& commandBuffer, IComputePipelineState* computePipelineState)
+				{
+					*commandBuffer.addCommand<SetComputePipelineState>() = SetComputePipelineState(computePipelineState);
+				}
+				inline SetComputePipelineState(IComputePipelineState* _computePipelineState) :
+					computePipelineState(_computePipelineState)
+				{}
+				IComputePipelineState* computePipelineState;
+				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::SetComputePipelineState;
+			};
 			struct SetVertexArray final
 			{
 				inline static void create(CommandBuffer& commandBuffer, IVertexArray* vertexArray)
@@ -3442,6 +3633,100 @@ namespace Renderer
 				uint32_t			   numberOfDraws;
 				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::DrawIndexed;
 			};
+			struct DrawIndexedIndirectCount final
+			{
+				inline static void create(CommandBuffer& commandBuffer, const IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, const IIndirectBuffer& countBuffer, uint32_t countBufferOffset, uint32_t maximumNumberOfDraws)
+				{
+					*commandBuffer.addCommand<DrawIndexedIndirectCount>() = DrawIndexedIndirectCount(indirectBuffer, indirectBufferOffset, countBuffer, countBufferOffset, maximumNumberOfDraws);
+				}
+				inline DrawIndexedIndirectCount(const IIndirectBuffer& _indirectBuffer, uint32_t _indirectBufferOffset, const IIndirectBuffer& _countBuffer, uint32_t _countBufferOffset, uint32_t _maximumNumberOfDraws) :
+					indirectBuffer(&_indirectBuffer),
+					indirectBufferOffset(_indirectBufferOffset),
+					countBuffer(&_countBuffer),
+					countBufferOffset(_countBufferOffset),
+					maximumNumberOfDraws(_maximumNumberOfDraws)
+				{}
+				const IIndirectBuffer* indirectBuffer;
+				uint32_t			   indirectBufferOffset;
+				const IIndirectBuffer* countBuffer;
+				uint32_t			   countBufferOffset;
+				uint32_t			   maximumNumberOfDraws;
+				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::DrawIndexedIndirectCount;
+			};
+			struct DispatchCompute final
+			{
+				inline static void create(CommandBuffer& commandBuffer, uint32_t groupCountX, uint32_t groupCountY = 1, uint32_t groupCountZ = 1)
+				{
+					*commandBuffer.addCommand<DispatchCompute>() = DispatchCompute(groupCountX, groupCountY, groupCountZ);
+				}
+				inline DispatchCompute(uint32_t _groupCountX, uint32_t _groupCountY, uint32_t _groupCountZ) :
+					groupCountX(_groupCountX),
+					groupCountY(_groupCountY),
+					groupCountZ(_groupCountZ)
+				{}
+				uint32_t groupCountX;
+				uint32_t groupCountY;
+				uint32_t groupCountZ;
+				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::DispatchCompute;
+			};
+			struct ResetQueryPool final
+			{
+				inline static void create(CommandBuffer& commandBuffer, IQueryPool& queryPool, uint32_t firstQueryIndex = 0, uint32_t numberOfQueries = 1)
+				{
+					*commandBuffer.addCommand<ResetQueryPool>() = ResetQueryPool(queryPool, firstQueryIndex, numberOfQueries);
+				}
+				inline ResetQueryPool(IQueryPool& _queryPool, uint32_t _firstQueryIndex, uint32_t _numberOfQueries) :
+					queryPool(&_queryPool),
+					firstQueryIndex(_firstQueryIndex),
+					numberOfQueries(_numberOfQueries)
+				{}
+				IQueryPool* queryPool;
+				uint32_t	firstQueryIndex;
+				uint32_t	numberOfQueries;
+				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::ResetQueryPool;
+			};
+			struct BeginQuery final
+			{
+				inline static void create(CommandBuffer& commandBuffer, IQueryPool& queryPool, uint32_t queryIndex = 0)
+				{
+					*commandBuffer.addCommand<BeginQuery>() = BeginQuery(queryPool, queryIndex);
+				}
+				inline BeginQuery(IQueryPool& _queryPool, uint32_t _queryIndex) :
+					queryPool(&_queryPool),
+					queryIndex(_queryIndex)
+				{}
+				IQueryPool* queryPool;
+				uint32_t	queryIndex;
+				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::BeginQuery;
+			};
+			struct EndQuery final
+			{
+				inline static void create(CommandBuffer& commandBuffer, IQueryPool& queryPool, uint32_t queryIndex = 0)
+				{
+					*commandBuffer.addCommand<EndQuery>() = EndQuery(queryPool, queryIndex);
+				}
+				inline EndQuery(IQueryPool& _queryPool, uint32_t _queryIndex) :
+					queryPool(&_queryPool),
+					queryIndex(_queryIndex)
+				{}
+				IQueryPool* queryPool;
+				uint32_t	queryIndex;
+				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::EndQuery;
+			};
+			struct WriteTimestampQuery final
+			{
+				inline static void create(CommandBuffer& commandBuffer, IQueryPool& queryPool, uint32_t queryIndex = 0)
+				{
+					*commandBuffer.addCommand<WriteTimestampQuery>() = WriteTimestampQuery(queryPool, queryIndex);
+				}
+				inline WriteTimestampQuery(IQueryPool& _queryPool, uint32_t _queryIndex) :
+					queryPool(&_queryPool),
+					queryIndex(_queryIndex)
+				{}
+				IQueryPool* queryPool;
+				uint32_t	queryIndex;
+				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::WriteTimestampQuery;
+			};
 			struct SetDebugMarker final
 			{
 				inline static void create(CommandBuffer& commandBuffer, const char* name)
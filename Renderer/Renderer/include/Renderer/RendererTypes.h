@@ -119,6 +119,55 @@ namespace Renderer
 		};
 	};
 
+	/**
+	*  @brief
+	*    Asynchronous query type
+	*
+	*  @note
+	*    - The result of each occlusion and timestamp query is a 64-bit unsigned integer, the result of each pipeline statistics query is a "Renderer::PipelineStatisticsQueryResult"
+	*    - Check "Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" before creating a query pool
+	*/
+	enum class QueryType
+	{
+		OCCLUSION			= 0,	///< Occlusion query, result is zero if no sample passed the depth and stencil tests, else non-zero (the exact number of passed samples is not guaranteed)
+		TIMESTAMP			= 1,	///< Timestamp query, result is the GPU timestamp in nanoseconds, only the difference between two timestamps of the same query pool is meaningful
+		PIPELINE_STATISTICS	= 2		///< Pipeline statistics query, result is a "Renderer::PipelineStatisticsQueryResult" with the counters of all commands recorded between begin and end query
+	};
+
+	/**
+	*  @brief
+	*    Pipeline statistics query result
+	*
+	*  @note
+	*    - This structure directly maps to Direct3D 11 "D3D11_QUERY_DATA_PIPELINE_STATISTICS" as well as Vulkan with all "VkQueryPipelineStatisticFlagBits" set, do not change it
+	*/
+	struct PipelineStatisticsQueryResult final
+	{
+		uint64_t numberOfInputAssemblerVertices;					///< Number of vertices read by the input assembler
+		uint64_t numberOfInputAssemblerPrimitives;					///< Number of primitives read by the input assembler
+		uint64_t numberOfVertexShaderInvocations;					///< Number of vertex shader (VS) invocations
+		uint64_t numberOfGeometryShaderInvocations;					///< Number of geometry shader (GS) invocations
+		uint64_t numberOfGeometryShaderOutputPrimitives;			///< Number of primitives emitted by geometry shaders (GS)
+		uint64_t numberOfClippingInputPrimitives;					///< Number of primitives which reached the clipping stage
+		uint64_t numberOfClippingOutputPrimitives;					///< Number of primitives which were output by the clipping stage
+		uint64_t numberOfFragmentShaderInvocations;					///< Number of fragment shader (FS) invocations
+		uint64_t numberOfTessellationControlShaderPatches;			///< Number of patches processed by tessellation control shaders (TCS)
+		uint64_t numberOfTessellationEvaluationShaderInvocations;	///< Number of tessellation evaluation shader (TES) invocations
+		uint64_t numberOfComputeShaderInvocations;					///< Number of compute shader (CS) invocations
+	};
+
+	/**
+	*  @brief
+	*    Query result flags
+	*/
+	struct QueryResultFlags final
+	{
+		enum Enum
+		{
+			WAIT = 1 << 0	///< Wait until the query results are available, without this flag "Renderer::IRenderer::getQueryPoolResults()" immediately returns "false" if any of the requested results is not available yet
+		};
+	};
+
 	/**
 	*  @brief
 	*    Comparison function
@@ -45,30 +45,33 @@ namespace Renderer
 		PROGRAM						   = 2,		///< Program, "Renderer::IShader"-related
 		VERTEX_ARRAY				   = 3,		///< Vertex array object (VAO, input-assembler (IA) stage), "Renderer::IBuffer"-related
 		RENDER_PASS					   = 4,		///< Render pass
+		QUERY_POOL					   = 5,		///< Asynchronous query pool
 		// IRenderTarget
-		SWAP_CHAIN					   = 5,		///< Swap chain
-		FRAMEBUFFER					   = 6,		///< Framebuffer object (FBO)
+		SWAP_CHAIN					   = 6,		///< Swap chain
+		FRAMEBUFFER					   = 7,		///< Framebuffer object (FBO)
 		// IBuffer
-		INDEX_BUFFER				   = 7,		///< Index buffer object (IBO, input-assembler (IA) stage)
-		VERTEX_BUFFER				   = 8,		///< Vertex buffer object (VBO, input-assembler (IA) stage)
-		UNIFORM_BUFFER				   = 9,		///< Uniform buffer object (UBO, "constant buffer" in Direct3D terminology)
-		TEXTURE_BUFFER				   = 10,	///< Texture buffer object (TBO)
-		INDIRECT_BUFFER				   = 11,	///< Indirect buffer object
+		INDEX_BUFFER				   = 8,		///< Index buffer object (IBO, input-assembler (IA) stage)
+		VERTEX_BUFFER				   = 9,		///< Vertex buffer object (VBO, input-assembler (IA) stage)
+		UNIFORM_BUFFER				   = 10,	///< Uniform buffer object (UBO, "constant buffer" in Direct3D terminology)
+		TEXTURE_BUFFER				   = 11,	///< Texture buffer object (TBO)
+		INDIRECT_BUFFER				   = 12,	///< Indirect buffer object
 		// ITexture
-		TEXTURE_1D					   = 12,	///< Texture 1D
-		TEXTURE_2D					   = 13,	///< Texture 2D
-		TEXTURE_2D_ARRAY			   = 14,	///< Texture 2D array
-		TEXTURE_3D					   = 15,	///< Texture 3D
-		TEXTURE_CUBE				   = 16,	///< Texture cube
+		TEXTURE_1D					   = 13,	///< Texture 1D
+		TEXTURE_2D					   = 14,	///< Texture 2D
+		TEXTURE_2D_ARRAY			   = 15,	///< Texture 2D array
+		TEXTURE_3D					   = 16,	///< Texture 3D
+		TEXTURE_CUBE				   = 17,	///< Texture cube
 		// IState
-		PIPELINE_STATE				   = 17,	///< Pipeline state (PSO)
-		SAMPLER_STATE				   = 18,	///< Sampler state
+		PIPELINE_STATE				   = 18,	///< Pipeline state (PSO)
+		COMPUTE_PIPELINE_STATE		   = 19,	///< Compute pipeline state
+		SAMPLER_STATE				   = 20,	///< Sampler state
 		// IShader
-		VERTEX_SHADER				   = 19,	///< Vertex shader (VS)
-		TESSELLATION_CONTROL_SHADER	   = 20,	///< Tessellation control shader (TCS, "hull shader" in Direct3D terminology)
-		TESSELLATION_EVALUATION_SHADER = 21,	///< Tessellation evaluation shader (TES, "domain shader" in Direct3D terminology)
-		GEOMETRY_SHADER				   = 22,	///< Geometry shader (GS)
-		FRAGMENT_SHADER				   = 23		///< Fragment shader (FS, "pixel shader" in Direct3D terminology)
+		VERTEX_SHADER				   = 21,	///< Vertex shader (VS)
+		TESSELLATION_CONTROL_SHADER	   = 22,	///< Tessellation control shader (TCS, "hull shader" in Direct3D terminology)
+		TESSELLATION_EVALUATION_SHADER = 23,	///< Tessellation evaluation shader (TES, "domain shader" in Direct3D terminology)
+		GEOMETRY_SHADER				   = 24,	///< Geometry shader (GS)
+		FRAGMENT_SHADER				   = 25,	///< Fragment shader (FS, "pixel shader" in Direct3D terminology)
+		COMPUTE_SHADER				   = 26		///< Compute shader (CS)
 	};
 
 
@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "Renderer/ResourceTypes.h"
 #include "Renderer/State/SamplerStateTypes.h"
 
 #include <string.h>	// For "strcpy()"
@@ -79,7 +80,8 @@ namespace Renderer
 		TESSELLATION_CONTROL    = 2,
 		TESSELLATION_EVALUATION = 3,
 		GEOMETRY                = 4,
-		FRAGMENT                = 5
+		FRAGMENT                = 5,
+		COMPUTE                 = 6
 	};
 
 	/**
@@ -104,6 +106,7 @@ namespace Renderer
 		static const uint32_t NAME_LENGTH = 32;
 		char				  baseShaderRegisterName[NAME_LENGTH];	///< When not using explicit binding locations (OpenGL ES 3, legacy GLSL profiles)
 		ShaderVisibility	  shaderVisibility;
+		ResourceType		  resourceType;							///< Type of the referenced resource, Vulkan needs to know whether a shader resource view or unordered access view is an image or a texel buffer when creating the descriptor set layout
 	};
 	struct DescriptorRangeBuilder final : public DescriptorRange
 	{
@@ -117,6 +120,7 @@ namespace Renderer
 			// Nothing here
 		}
 		DescriptorRangeBuilder(
+			ResourceType _resourceType,
 			DescriptorRangeType _rangeType,
 			uint32_t _numberOfDescriptors,
 			uint32_t _baseShaderRegister,
@@ -125,7 +129,7 @@ namespace Renderer
 			uint32_t _registerSpace = 0,
 			uint32_t _offsetInDescriptorsFromTableStart = OFFSET_APPEND)
 		{
-			initialize(_rangeType, _numberOfDescriptors, _baseShaderRegister, _baseShaderRegisterName, _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
+			initialize(_resourceType, _rangeType, _numberOfDescriptors, _baseShaderRegister, _baseShaderRegisterName, _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
 		}
 		inline void initializeSampler(
 			uint32_t _numberOfDescriptors,
@@ -134,9 +138,10 @@ namespace Renderer
 			uint32_t _registerSpace = 0,
 			uint32_t _offsetInDescriptorsFromTableStart = OFFSET_APPEND)
 		{
-			initialize(*this, DescriptorRangeType::SAMPLER, _numberOfDescriptors, _baseShaderRegister, "", _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
+			initialize(*this, ResourceType::SAMPLER_STATE, DescriptorRangeType::SAMPLER, _numberOfDescriptors, _baseShaderRegister, "", _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
 		}
 		inline void initialize(
+			ResourceType _resourceType,
 			DescriptorRangeType _rangeType,
 			uint32_t _numberOfDescriptors,
 			uint32_t _baseShaderRegister,
@@ -145,10 +150,11 @@ namespace Renderer
 			uint32_t _registerSpace = 0,
 			uint32_t _offsetInDescriptorsFromTableStart = OFFSET_APPEND)
 		{
-			initialize(*this, _rangeType, _numberOfDescriptors, _baseShaderRegister, _baseShaderRegisterName, _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
+			initialize(*this, _resourceType, _rangeType, _numberOfDescriptors, _baseShaderRegister, _baseShaderRegisterName, _shaderVisibility, _registerSpace, _offsetInDescriptorsFromTableStart);
 		}
 		static inline void initialize(
 			DescriptorRange& range,
+			ResourceType _resourceType,
 			DescriptorRangeType _rangeType,
 			uint32_t _numberOfDescriptors,
 			uint32_t _baseShaderRegister,
@@ -164,6 +170,7 @@ namespace Renderer
 			range.offsetInDescriptorsFromTableStart = _offsetInDescriptorsFromTableStart;
 			strcpy(range.baseShaderRegisterName, _baseShaderRegisterName);
 			range.shaderVisibility = _shaderVisibility;
+			range.resourceType = _resourceType;
 		}
 	};
 
@@ -43,6 +43,7 @@ namespace Renderer
 	class IVertexShader;
 	class IUniformBuffer;
 	class IRootSignature;
+	class IComputeShader;
 	class IGeometryShader;
 	class IFragmentShader;
 	struct VertexAttributes;
@@ -466,6 +467,43 @@ namespace Renderer
 		*/
 		virtual IFragmentShader* createFragmentShaderFromSourceCode(const ShaderSourceCode& shaderSourceCode, ShaderBytecode* shaderBytecode = nullptr) = 0;
 
+		/**
+		*  @brief
+		*    Create a compute shader from shader bytecode
+		*
+		*  @param[in] shaderBytecode
+		*    Shader bytecode
+		*
+		*  @return
+		*    The created compute shader, a null pointer on error. Release the returned instance if you no longer need it.
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::computeShader" is "true"
+		*    - The data the given pointers are pointing to is internally copied and you have to free your memory if you no longer need it
+		*/
+		virtual IComputeShader* createComputeShaderFromBytecode(const ShaderBytecode& shaderBytecode) = 0;
+
+		/**
+		*  @brief
+		*    Create a compute shader from shader source code
+		*
+		*  @param[in] shaderSourceCode
+		*    Shader source code
+		*  @param[out] shaderBytecode
+		*    If not a null pointer, receives the shader bytecode in case the used renderer API supports this feature
+		*
+		*  @return
+		*    The created compute shader, a null pointer on error. Release the returned instance if you no longer need it.
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::computeShader" is "true"
+		*    - The data the given pointers are pointing to is internally copied and you have to free your memory if you no longer need it
+		*
+		*  @see
+		*    - "Renderer::IShaderLanguage::createVertexShader()" for more information
+		*/
+		virtual IComputeShader* createComputeShaderFromSourceCode(const ShaderSourceCode& shaderSourceCode, ShaderBytecode* shaderBytecode = nullptr) = 0;
+
 		/**
 		*  @brief
 		*    Create a program and assigns a vertex, tessellation control, tessellation evaluation, geometry and fragment shader to it
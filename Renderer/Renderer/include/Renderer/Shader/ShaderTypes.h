@@ -86,14 +86,18 @@ namespace Renderer
 	public:
 		inline ShaderBytecode() :
 			mNumberOfBytes(0),
-			mBytecode(nullptr)
+			mBytecode(nullptr),
+			mOwnsBytecode(true)
 		{
 			// Nothing here
 		}
 
 		inline ~ShaderBytecode()
 		{
-			delete [] mBytecode;
+			if (mOwnsBytecode)
+			{
+				delete [] mBytecode;
+			}
 		}
 
 		inline uint32_t getNumberOfBytes() const
@@ -108,10 +112,35 @@ namespace Renderer
 
 		inline void setBytecodeCopy(uint32_t numberOfBytes, uint8_t* bytecode)
 		{
-			delete [] mBytecode;
+			if (mOwnsBytecode)
+			{
+				delete [] mBytecode;
+			}
+			uint8_t* bytecodeCopy = new uint8_t[numberOfBytes];
+			memcpy(bytecodeCopy, bytecode, numberOfBytes);
 			mNumberOfBytes = numberOfBytes;
-			mBytecode = new uint8_t[mNumberOfBytes];
-			memcpy(mBytecode, bytecode, mNumberOfBytes);
+			mBytecode = bytecodeCopy;
+			mOwnsBytecode = true;
+		}
+
+		/**
+		*  @brief
+		*    Reference shader bytecode owned by someone else (e.g. a shader cache blob), no copy is made
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes in the bytecode
+		*  @param[in] bytecode
+		*    Shader bytecode, must stay valid as long as it's referenced by this instance
+		*/
+		inline void setBytecodeReference(uint32_t numberOfBytes, const uint8_t* bytecode)
+		{
+			if (mOwnsBytecode)
+			{
+				delete [] mBytecode;
+			}
+			mNumberOfBytes = numberOfBytes;
+			mBytecode = bytecode;
+			mOwnsBytecode = false;
 		}
 
 
@@ -119,8 +148,9 @@ namespace Renderer
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		uint32_t mNumberOfBytes;	///< Number of bytes in the bytecode
-		uint8_t* mBytecode;			///< Shader bytecode, can be a null pointer
+		uint32_t	   mNumberOfBytes;	///< Number of bytes in the bytecode
+		const uint8_t* mBytecode;		///< Shader bytecode, can be a null pointer
+		bool		   mOwnsBytecode;	///< "true" if the shader bytecode memory is owned by this instance, else "false" (memory is just referenced)
 
 
 	};
@@ -88,6 +88,8 @@ namespace Renderer
 		std::atomic<uint32_t> numberOfCreatedVertexArrays;					///< Number of created vertex array object (VAO, input-assembler (IA) stage) instances
 		std::atomic<uint32_t> currentNumberOfRenderPasses;					///< Current number of render pass instances
 		std::atomic<uint32_t> numberOfCreatedRenderPasses;					///< Number of created render pass instances
+		std::atomic<uint32_t> currentNumberOfQueryPools;					///< Current number of asynchronous query pool instances
+		std::atomic<uint32_t> numberOfCreatedQueryPools;					///< Number of created asynchronous query pool instances
 		// IRenderTarget
 		std::atomic<uint32_t> currentNumberOfSwapChains;					///< Current number of swap chain instances
 		std::atomic<uint32_t> numberOfCreatedSwapChains;					///< Number of created swap chain instances
@@ -118,6 +120,8 @@ namespace Renderer
 		// IState
 		std::atomic<uint32_t> currentNumberOfPipelineStates;				///< Current number of pipeline state (PSO) instances
 		std::atomic<uint32_t> numberOfCreatedPipelineStates;				///< Number of created pipeline state (PSO) instances
+		std::atomic<uint32_t> currentNumberOfComputePipelineStates;			///< Current number of compute pipeline state instances
+		std::atomic<uint32_t> numberOfCreatedComputePipelineStates;			///< Number of created compute pipeline state instances
 		std::atomic<uint32_t> currentNumberOfSamplerStates;					///< Current number of sampler state instances
 		std::atomic<uint32_t> numberOfCreatedSamplerStates;					///< Number of created sampler state instances
 		// IShader
@@ -131,6 +135,8 @@ namespace Renderer
 		std::atomic<uint32_t> numberOfCreatedGeometryShaders;				///< Number of created geometry shader (GS) instances
 		std::atomic<uint32_t> currentNumberOfFragmentShaders;				///< Current number of fragment shader (FS, "pixel shader" in Direct3D terminology) instances
 		std::atomic<uint32_t> numberOfCreatedFragmentShaders;				///< Number of created fragment shader (FS, "pixel shader" in Direct3D terminology) instances
+		std::atomic<uint32_t> currentNumberOfComputeShaders;				///< Current number of compute shader (CS) instances
+		std::atomic<uint32_t> numberOfCreatedComputeShaders;				///< Number of created compute shader (CS) instances
 
 
 	//[-------------------------------------------------------]
@@ -46,6 +46,8 @@ namespace Renderer
 		numberOfCreatedVertexArrays(0),
 		currentNumberOfRenderPasses(0),
 		numberOfCreatedRenderPasses(0),
+		currentNumberOfQueryPools(0),
+		numberOfCreatedQueryPools(0),
 		// IRenderTarget
 		currentNumberOfSwapChains(0),
 		numberOfCreatedSwapChains(0),
@@ -76,6 +78,8 @@ namespace Renderer
 		// IState
 		currentNumberOfPipelineStates(0),
 		numberOfCreatedPipelineStates(0),
+		currentNumberOfComputePipelineStates(0),
+		numberOfCreatedComputePipelineStates(0),
 		currentNumberOfSamplerStates(0),
 		numberOfCreatedSamplerStates(0),
 		// IShader
@@ -88,7 +92,9 @@ namespace Renderer
 		currentNumberOfGeometryShaders(0),
 		numberOfCreatedGeometryShaders(0),
 		currentNumberOfFragmentShaders(0),
-		numberOfCreatedFragmentShaders(0)
+		numberOfCreatedFragmentShaders(0),
+		currentNumberOfComputeShaders(0),
+		numberOfCreatedComputeShaders(0)
 	{
 		// Nothing here
 	}
@@ -106,6 +112,7 @@ namespace Renderer
 				currentNumberOfPrograms +
 				currentNumberOfVertexArrays +
 				currentNumberOfRenderPasses +
+				currentNumberOfQueryPools +
 				// IRenderTarget
 				currentNumberOfSwapChains +
 				currentNumberOfFramebuffers +
@@ -123,13 +130,15 @@ namespace Renderer
 				currentNumberOfTextureCubes +
 				// IState
 				currentNumberOfPipelineStates +
+				currentNumberOfComputePipelineStates +
 				currentNumberOfSamplerStates +
 				// IShader
 				currentNumberOfVertexShaders +
 				currentNumberOfTessellationControlShaders +
 				currentNumberOfTessellationEvaluationShaders +
 				currentNumberOfGeometryShaders +
-				currentNumberOfFragmentShaders;
+				currentNumberOfFragmentShaders +
+				currentNumberOfComputeShaders;
 	}
 
 	inline void Statistics::debugOutputCurrentResouces(const Context& context) const
@@ -143,6 +152,7 @@ namespace Renderer
 		RENDERER_LOG(context, INFORMATION, "Programs: %d", currentNumberOfPrograms.load())
 		RENDERER_LOG(context, INFORMATION, "Vertex arrays: %d", currentNumberOfVertexArrays.load())
 		RENDERER_LOG(context, INFORMATION, "Render passes: %d", currentNumberOfRenderPasses.load())
+		RENDERER_LOG(context, INFORMATION, "Query pools: %d", currentNumberOfQueryPools.load())
 
 		// IRenderTarget
 		RENDERER_LOG(context, INFORMATION, "Swap chains: %d", currentNumberOfSwapChains.load())
@@ -164,6 +174,7 @@ namespace Renderer
 
 		// IState
 		RENDERER_LOG(context, INFORMATION, "Pipeline states: %d", currentNumberOfPipelineStates.load())
+		RENDERER_LOG(context, INFORMATION, "Compute pipeline states: %d", currentNumberOfComputePipelineStates.load())
 		RENDERER_LOG(context, INFORMATION, "Sampler states: %d", currentNumberOfSamplerStates.load())
 
 		// IShader
@@ -172,6 +183,7 @@ namespace Renderer
 		RENDERER_LOG(context, INFORMATION, "Tessellation evaluation shaders: %d", currentNumberOfTessellationEvaluationShaders.load())
 		RENDERER_LOG(context, INFORMATION, "Geometry shaders: %d", currentNumberOfGeometryShaders.load())
 		RENDERER_LOG(context, INFORMATION, "Fragment shaders: %d", currentNumberOfFragmentShaders.load())
+		RENDERER_LOG(context, INFORMATION, "Compute shaders: %d", currentNumberOfComputeShaders.load())
 
 		// End
 		RENDERER_LOG(context, INFORMATION, "***************************************************")
@@ -79,7 +79,7 @@ namespace Direct3D10Renderer
 		return RENDERER_NEW(getRenderer().getContext(), TextureBuffer)(static_cast<Direct3D10Renderer&>(getRenderer()), numberOfBytes, textureFormat, data, bufferUsage);
 	}
 
-	Renderer::IIndirectBuffer* BufferManager::createIndirectBuffer(uint32_t numberOfBytes, const void* data, Renderer::BufferUsage)
+	Renderer::IIndirectBuffer* BufferManager::createIndirectBuffer(uint32_t numberOfBytes, const void* data, Renderer::BufferUsage, uint32_t)
 	{
 		return RENDERER_NEW(getRenderer().getContext(), IndirectBuffer)(static_cast<Direct3D10Renderer&>(getRenderer()), numberOfBytes, data);
 	}
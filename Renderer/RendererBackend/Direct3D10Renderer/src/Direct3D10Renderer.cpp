@@ -143,6 +143,19 @@ namespace
 				static_cast<Direct3D10Renderer::Direct3D10Renderer&>(renderer).setGraphicsResourceGroup(realData->rootParameterIndex, realData->resourceGroup);
 			}
 
+			//[-------------------------------------------------------]
+			//[ Compute root                                          ]
+			//[-------------------------------------------------------]
+			void SetComputeRootSignature(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, Direct3D 10 has no compute shader support
+			}
+
+			void SetComputeResourceGroup(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, Direct3D 10 has no compute shader support
+			}
+
 			//[-------------------------------------------------------]
 			//[ States                                                ]
 			//[-------------------------------------------------------]
@@ -152,6 +165,11 @@ namespace
 				static_cast<Direct3D10Renderer::Direct3D10Renderer&>(renderer).setPipelineState(realData->pipelineState);
 			}
 
+			void SetComputePipelineState(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, Direct3D 10 has no compute shader support
+			}
+
 			//[-------------------------------------------------------]
 			//[ Input-assembler (IA) stage                            ]
 			//[-------------------------------------------------------]
@@ -237,6 +255,42 @@ namespace
 				}
 			}
 
+			void DrawIndexedIndirectCount(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, Direct3D 10 has no draw indirect count support ("Renderer::Capabilities::drawIndirectCount" is false)
+			}
+
+			//[-------------------------------------------------------]
+			//[ Compute                                               ]
+			//[-------------------------------------------------------]
+			void DispatchCompute(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, Direct3D 10 has no compute shader support
+			}
+
+			//[-------------------------------------------------------]
+			//[ Query                                                 ]
+			//[-------------------------------------------------------]
+			void ResetQueryPool(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 10 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void BeginQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 10 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void EndQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 10 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void WriteTimestampQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 10 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
 			//[-------------------------------------------------------]
 			//[ Debug                                                 ]
 			//[-------------------------------------------------------]
@@ -288,8 +342,12 @@ namespace
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsResourceGroup,
+			// Compute root
+			&BackendDispatch::SetComputeRootSignature,
+			&BackendDispatch::SetComputeResourceGroup,
 			// States
 			&BackendDispatch::SetPipelineState,
+			&BackendDispatch::SetComputePipelineState,
 			// Input-assembler (IA) stage
 			&BackendDispatch::SetVertexArray,
 			// Rasterizer (RS) stage
@@ -304,6 +362,14 @@ namespace
 			// Draw call
 			&BackendDispatch::Draw,
 			&BackendDispatch::DrawIndexed,
+			&BackendDispatch::DrawIndexedIndirectCount,
+			// Compute
+			&BackendDispatch::DispatchCompute,
+			// Query
+			&BackendDispatch::ResetQueryPool,
+			&BackendDispatch::BeginQuery,
+			&BackendDispatch::EndQuery,
+			&BackendDispatch::WriteTimestampQuery,
 			// Debug
 			&BackendDispatch::SetDebugMarker,
 			&BackendDispatch::BeginDebugEvent,
@@ -608,6 +674,10 @@ namespace Direct3D10Renderer
 								// "pixel shader" in Direct3D terminology
 								mD3D10Device->PSSetConstantBuffers(startSlot, 1, &d3d10Buffers);
 								break;
+
+							case Renderer::ShaderVisibility::COMPUTE:
+								RENDERER_LOG(mContext, CRITICAL, "Direct3D 10 has no compute shader support")
+								break;
 						}
 						break;
 					}
@@ -651,6 +721,7 @@ namespace Direct3D10Renderer
 							case Renderer::ResourceType::PROGRAM:
 							case Renderer::ResourceType::VERTEX_ARRAY:
 							case Renderer::ResourceType::RENDER_PASS:
+							case Renderer::ResourceType::QUERY_POOL:
 							case Renderer::ResourceType::SWAP_CHAIN:
 							case Renderer::ResourceType::FRAMEBUFFER:
 							case Renderer::ResourceType::INDEX_BUFFER:
@@ -658,12 +729,14 @@ namespace Direct3D10Renderer
 							case Renderer::ResourceType::UNIFORM_BUFFER:
 							case Renderer::ResourceType::INDIRECT_BUFFER:
 							case Renderer::ResourceType::PIPELINE_STATE:
+							case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 							case Renderer::ResourceType::SAMPLER_STATE:
 							case Renderer::ResourceType::VERTEX_SHADER:
 							case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 							case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 							case Renderer::ResourceType::GEOMETRY_SHADER:
 							case Renderer::ResourceType::FRAGMENT_SHADER:
+							case Renderer::ResourceType::COMPUTE_SHADER:
 								RENDERER_LOG(mContext, CRITICAL, "Invalid Direct3D 10 renderer backend resource type")
 								break;
 						}
@@ -696,6 +769,10 @@ namespace Direct3D10Renderer
 								// "pixel shader" in Direct3D terminology
 								mD3D10Device->PSSetShaderResources(startSlot, 1, &d3d10ShaderResourceView);
 								break;
+
+							case Renderer::ShaderVisibility::COMPUTE:
+								RENDERER_LOG(mContext, CRITICAL, "Direct3D 10 has no compute shader support")
+								break;
 						}
 						break;
 					}
@@ -732,6 +809,10 @@ namespace Direct3D10Renderer
 								// "pixel shader" in Direct3D terminology
 								mD3D10Device->PSSetSamplers(startSlot, 1, &d3d10SamplerState);
 								break;
+
+							case Renderer::ShaderVisibility::COMPUTE:
+								RENDERER_LOG(mContext, CRITICAL, "Direct3D 10 has no compute shader support")
+								break;
 						}
 						break;
 					}
@@ -741,17 +822,20 @@ namespace Direct3D10Renderer
 					case Renderer::ResourceType::PROGRAM:
 					case Renderer::ResourceType::VERTEX_ARRAY:
 					case Renderer::ResourceType::RENDER_PASS:
+					case Renderer::ResourceType::QUERY_POOL:
 					case Renderer::ResourceType::SWAP_CHAIN:
 					case Renderer::ResourceType::FRAMEBUFFER:
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::INDIRECT_BUFFER:
 					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 					case Renderer::ResourceType::VERTEX_SHADER:
 					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 						RENDERER_LOG(mContext, CRITICAL, "Invalid Direct3D 10 renderer backend resource type")
 						break;
 				}
@@ -921,6 +1005,7 @@ namespace Direct3D10Renderer
 					case Renderer::ResourceType::PROGRAM:
 					case Renderer::ResourceType::VERTEX_ARRAY:
 					case Renderer::ResourceType::RENDER_PASS:
+					case Renderer::ResourceType::QUERY_POOL:
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -932,12 +1017,14 @@ namespace Direct3D10Renderer
 					case Renderer::ResourceType::TEXTURE_3D:
 					case Renderer::ResourceType::TEXTURE_CUBE:
 					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 					case Renderer::ResourceType::SAMPLER_STATE:
 					case Renderer::ResourceType::VERTEX_SHADER:
 					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					default:
 						// Not handled in here
 						break;
@@ -1054,6 +1141,7 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::PROGRAM:
 				case Renderer::ResourceType::VERTEX_ARRAY:
 				case Renderer::ResourceType::RENDER_PASS:
+				case Renderer::ResourceType::QUERY_POOL:
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -1065,12 +1153,14 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::TEXTURE_3D:
 				case Renderer::ResourceType::TEXTURE_CUBE:
 				case Renderer::ResourceType::PIPELINE_STATE:
+				case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 				case Renderer::ResourceType::SAMPLER_STATE:
 				case Renderer::ResourceType::VERTEX_SHADER:
 				case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				default:
 					// Not handled in here
 					break;
@@ -1142,6 +1232,7 @@ namespace Direct3D10Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::INDEX_BUFFER:
 			case Renderer::ResourceType::VERTEX_BUFFER:
 			case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -1153,12 +1244,14 @@ namespace Direct3D10Renderer
 			case Renderer::ResourceType::TEXTURE_3D:
 			case Renderer::ResourceType::TEXTURE_CUBE:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Not handled in here
 				break;
@@ -1196,6 +1289,7 @@ namespace Direct3D10Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::INDEX_BUFFER:
@@ -1208,12 +1302,14 @@ namespace Direct3D10Renderer
 			case Renderer::ResourceType::TEXTURE_3D:
 			case Renderer::ResourceType::TEXTURE_CUBE:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Not handled in here
 				break;
@@ -1461,6 +1557,13 @@ namespace Direct3D10Renderer
 		return RENDERER_NEW(mContext, RenderPass)(*this, numberOfColorAttachments, colorAttachmentTextureFormats, depthStencilAttachmentTextureFormat, numberOfMultisamples);
 	}
 
+	Renderer::IQueryPool* Direct3D10Renderer::createQueryPool(Renderer::QueryType, uint32_t)
+	{
+		// Error! The Direct3D 10 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+		RENDERER_LOG(mContext, CRITICAL, "The Direct3D 10 renderer backend has no asynchronous query support")
+		return nullptr;
+	}
+
 	Renderer::ISwapChain* Direct3D10Renderer::createSwapChain(Renderer::IRenderPass& renderPass, Renderer::WindowHandle windowHandle, bool)
 	{
 		// Sanity checks
@@ -1500,12 +1603,35 @@ namespace Direct3D10Renderer
 		return RENDERER_NEW(mContext, PipelineState)(*this, pipelineState);
 	}
 
+	Renderer::IComputePipelineState* Direct3D10Renderer::createComputePipelineState(Renderer::IRootSignature&, Renderer::IComputeShader&)
+	{
+		// Error! Direct3D 10 has no compute shader support.
+		RENDERER_LOG(mContext, CRITICAL, "Direct3D 10 has no compute shader support")
+		return nullptr;
+	}
+
 	Renderer::ISamplerState* Direct3D10Renderer::createSamplerState(const Renderer::SamplerState& samplerState)
 	{
 		return RENDERER_NEW(mContext, SamplerState)(*this, samplerState);
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Pipeline cache                                        ]
+	//[-------------------------------------------------------]
+	uint32_t Direct3D10Renderer::getPipelineCacheData(uint8_t*, uint32_t)
+	{
+		// Not supported by the Direct3D 10 renderer
+		return 0;
+	}
+
+	bool Direct3D10Renderer::setPipelineCacheData(const uint8_t*, uint32_t)
+	{
+		// Not supported by the Direct3D 10 renderer
+		return false;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
@@ -1594,15 +1720,18 @@ namespace Direct3D10Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can map, set known return values
 				mappedSubresource.data		 = nullptr;
@@ -1675,15 +1804,18 @@ namespace Direct3D10Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can unmap
 				break;
@@ -1693,6 +1825,13 @@ namespace Direct3D10Renderer
 		#undef TEXTURE_RESOURCE
 	}
 
+	bool Direct3D10Renderer::getQueryPoolResults(Renderer::IQueryPool&, uint32_t, uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t)
+	{
+		// Error! The Direct3D 10 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+		RENDERER_LOG(mContext, CRITICAL, "The Direct3D 10 renderer backend has no asynchronous query support")
+		return false;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
@@ -1866,6 +2005,14 @@ namespace Direct3D10Renderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = true;
 
+		// Draw indirect count supported?
+		mCapabilities.drawIndirectCount = false;
+
+		// Asynchronous queries supported?
+		mCapabilities.occlusionQuery = false;
+		mCapabilities.timestampQuery = false;
+		mCapabilities.pipelineStatisticsQuery = false;
+
 		// Direct3D 10 has native multi-threading
 		// -> https://msdn.microsoft.com/de-de/library/windows/desktop/bb205068(v=vs.85).aspx - "Unlike Direct3D 9, the Direct3D 10 API defaults to fully thread-safe"
 		mCapabilities.nativeMultiThreading = true;
@@ -1884,6 +2031,9 @@ namespace Direct3D10Renderer
 
 		// Is there support for fragment shaders (FS)?
 		mCapabilities.fragmentShader = true;
+
+		// Is there support for compute shaders (CS)?
+		mCapabilities.computeShader = false;
 	}
 
 	void Direct3D10Renderer::setProgram(Renderer::IProgram* program)
@@ -200,6 +200,18 @@ namespace Direct3D10Renderer
 		return RENDERER_NEW(getRenderer().getContext(), FragmentShaderHlsl)(static_cast<Direct3D10Renderer&>(getRenderer()), shaderSourceCode.sourceCode, shaderBytecode);
 	}
 
+	Renderer::IComputeShader* ShaderLanguageHlsl::createComputeShaderFromBytecode(const Renderer::ShaderBytecode&)
+	{
+		// Error! Direct3D 10 has no compute shader support.
+		return nullptr;
+	}
+
+	Renderer::IComputeShader* ShaderLanguageHlsl::createComputeShaderFromSourceCode(const Renderer::ShaderSourceCode&, Renderer::ShaderBytecode*)
+	{
+		// Error! Direct3D 10 has no compute shader support.
+		return nullptr;
+	}
+
 	Renderer::IProgram* ShaderLanguageHlsl::createProgram(const Renderer::IRootSignature&, const Renderer::VertexAttributes&, Renderer::IVertexShader* vertexShader, Renderer::ITessellationControlShader* tessellationControlShader, Renderer::ITessellationEvaluationShader* tessellationEvaluationShader, Renderer::IGeometryShader* geometryShader, Renderer::IFragmentShader* fragmentShader)
 	{
 		// A shader can be a null pointer, but if it's not the shader and program language must match!
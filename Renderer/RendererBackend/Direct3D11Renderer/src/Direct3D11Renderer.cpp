@@ -197,6 +197,19 @@ namespace
 				static_cast<Direct3D11Renderer::Direct3D11Renderer&>(renderer).setGraphicsResourceGroup(realData->rootParameterIndex, realData->resourceGroup);
 			}
 
+			//[-------------------------------------------------------]
+			//[ Compute root                                          ]
+			//[-------------------------------------------------------]
+			void SetComputeRootSignature(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 11 renderer backend has no compute shader support ("Renderer::Capabilities::computeShader" is false)
+			}
+
+			void SetComputeResourceGroup(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 11 renderer backend has no compute shader support ("Renderer::Capabilities::computeShader" is false)
+			}
+
 			//[-------------------------------------------------------]
 			//[ States                                                ]
 			//[-------------------------------------------------------]
@@ -206,6 +219,11 @@ namespace
 				static_cast<Direct3D11Renderer::Direct3D11Renderer&>(renderer).setPipelineState(realData->pipelineState);
 			}
 
+			void SetComputePipelineState(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 11 renderer backend has no compute shader support ("Renderer::Capabilities::computeShader" is false)
+			}
+
 			//[-------------------------------------------------------]
 			//[ Input-assembler (IA) stage                            ]
 			//[-------------------------------------------------------]
@@ -341,6 +359,42 @@ namespace
 				}
 			}
 
+			void DrawIndexedIndirectCount(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, Direct3D 11 has no draw indirect count support ("Renderer::Capabilities::drawIndirectCount" is false)
+			}
+
+			//[-------------------------------------------------------]
+			//[ Compute                                               ]
+			//[-------------------------------------------------------]
+			void DispatchCompute(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 11 renderer backend has no compute shader support ("Renderer::Capabilities::computeShader" is false)
+			}
+
+			//[-------------------------------------------------------]
+			//[ Query                                                 ]
+			//[-------------------------------------------------------]
+			void ResetQueryPool(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 11 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void BeginQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 11 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void EndQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 11 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void WriteTimestampQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 11 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
 			//[-------------------------------------------------------]
 			//[ Debug                                                 ]
 			//[-------------------------------------------------------]
@@ -392,8 +446,12 @@ namespace
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsResourceGroup,
+			// Compute root
+			&BackendDispatch::SetComputeRootSignature,
+			&BackendDispatch::SetComputeResourceGroup,
 			// States
 			&BackendDispatch::SetPipelineState,
+			&BackendDispatch::SetComputePipelineState,
 			// Input-assembler (IA) stage
 			&BackendDispatch::SetVertexArray,
 			// Rasterizer (RS) stage
@@ -408,6 +466,14 @@ namespace
 			// Draw call
 			&BackendDispatch::Draw,
 			&BackendDispatch::DrawIndexed,
+			&BackendDispatch::DrawIndexedIndirectCount,
+			// Compute
+			&BackendDispatch::DispatchCompute,
+			// Query
+			&BackendDispatch::ResetQueryPool,
+			&BackendDispatch::BeginQuery,
+			&BackendDispatch::EndQuery,
+			&BackendDispatch::WriteTimestampQuery,
 			// Debug
 			&BackendDispatch::SetDebugMarker,
 			&BackendDispatch::BeginDebugEvent,
@@ -745,6 +811,11 @@ namespace Direct3D11Renderer
 								// "pixel shader" in Direct3D terminology
 								mD3D11DeviceContext->PSSetConstantBuffers(startSlot, 1, &d3d11Buffers);
 								break;
+
+							case Renderer::ShaderVisibility::COMPUTE:
+								// Nothing here, the Direct3D 11 renderer backend has no compute shader support ("Renderer::Capabilities::computeShader" is false)
+								RENDERER_LOG(mContext, CRITICAL, "The Direct3D 11 renderer backend has no compute shader support")
+								break;
 						}
 						break;
 					}
@@ -788,6 +859,7 @@ namespace Direct3D11Renderer
 							case Renderer::ResourceType::PROGRAM:
 							case Renderer::ResourceType::VERTEX_ARRAY:
 							case Renderer::ResourceType::RENDER_PASS:
+							case Renderer::ResourceType::QUERY_POOL:
 							case Renderer::ResourceType::SWAP_CHAIN:
 							case Renderer::ResourceType::FRAMEBUFFER:
 							case Renderer::ResourceType::INDEX_BUFFER:
@@ -795,12 +867,14 @@ namespace Direct3D11Renderer
 							case Renderer::ResourceType::UNIFORM_BUFFER:
 							case Renderer::ResourceType::INDIRECT_BUFFER:
 							case Renderer::ResourceType::PIPELINE_STATE:
+							case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 							case Renderer::ResourceType::SAMPLER_STATE:
 							case Renderer::ResourceType::VERTEX_SHADER:
 							case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 							case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 							case Renderer::ResourceType::GEOMETRY_SHADER:
 							case Renderer::ResourceType::FRAGMENT_SHADER:
+							case Renderer::ResourceType::COMPUTE_SHADER:
 								RENDERER_LOG(mContext, CRITICAL, "Invalid Direct3D 11 renderer backend resource type")
 								break;
 						}
@@ -837,6 +911,11 @@ namespace Direct3D11Renderer
 								// "pixel shader" in Direct3D terminology
 								mD3D11DeviceContext->PSSetShaderResources(startSlot, 1, &d3d11ShaderResourceView);
 								break;
+
+							case Renderer::ShaderVisibility::COMPUTE:
+								// Nothing here, the Direct3D 11 renderer backend has no compute shader support ("Renderer::Capabilities::computeShader" is false)
+								RENDERER_LOG(mContext, CRITICAL, "The Direct3D 11 renderer backend has no compute shader support")
+								break;
 						}
 						break;
 					}
@@ -877,6 +956,11 @@ namespace Direct3D11Renderer
 								// "pixel shader" in Direct3D terminology
 								mD3D11DeviceContext->PSSetSamplers(startSlot, 1, &d3d11SamplerState);
 								break;
+
+							case Renderer::ShaderVisibility::COMPUTE:
+								// Nothing here, the Direct3D 11 renderer backend has no compute shader support ("Renderer::Capabilities::computeShader" is false)
+								RENDERER_LOG(mContext, CRITICAL, "The Direct3D 11 renderer backend has no compute shader support")
+								break;
 						}
 						break;
 					}
@@ -886,17 +970,20 @@ namespace Direct3D11Renderer
 					case Renderer::ResourceType::PROGRAM:
 					case Renderer::ResourceType::VERTEX_ARRAY:
 					case Renderer::ResourceType::RENDER_PASS:
+					case Renderer::ResourceType::QUERY_POOL:
 					case Renderer::ResourceType::SWAP_CHAIN:
 					case Renderer::ResourceType::FRAMEBUFFER:
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::INDIRECT_BUFFER:
 					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 					case Renderer::ResourceType::VERTEX_SHADER:
 					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 						RENDERER_LOG(mContext, CRITICAL, "Invalid Direct3D 11 renderer backend resource type")
 						break;
 				}
@@ -1049,6 +1136,7 @@ namespace Direct3D11Renderer
 					case Renderer::ResourceType::PROGRAM:
 					case Renderer::ResourceType::VERTEX_ARRAY:
 					case Renderer::ResourceType::RENDER_PASS:
+					case Renderer::ResourceType::QUERY_POOL:
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -1060,12 +1148,14 @@ namespace Direct3D11Renderer
 					case Renderer::ResourceType::TEXTURE_3D:
 					case Renderer::ResourceType::TEXTURE_CUBE:
 					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 					case Renderer::ResourceType::SAMPLER_STATE:
 					case Renderer::ResourceType::VERTEX_SHADER:
 					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					default:
 						// Not handled in here
 						break;
@@ -1182,6 +1272,7 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::PROGRAM:
 				case Renderer::ResourceType::VERTEX_ARRAY:
 				case Renderer::ResourceType::RENDER_PASS:
+				case Renderer::ResourceType::QUERY_POOL:
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -1193,12 +1284,14 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::TEXTURE_3D:
 				case Renderer::ResourceType::TEXTURE_CUBE:
 				case Renderer::ResourceType::PIPELINE_STATE:
+				case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 				case Renderer::ResourceType::SAMPLER_STATE:
 				case Renderer::ResourceType::VERTEX_SHADER:
 				case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				default:
 					// Not handled in here
 					break;
@@ -1270,6 +1363,7 @@ namespace Direct3D11Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::INDEX_BUFFER:
 			case Renderer::ResourceType::VERTEX_BUFFER:
 			case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -1281,12 +1375,14 @@ namespace Direct3D11Renderer
 			case Renderer::ResourceType::TEXTURE_3D:
 			case Renderer::ResourceType::TEXTURE_CUBE:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Not handled in here
 				break;
@@ -1324,6 +1420,7 @@ namespace Direct3D11Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::INDEX_BUFFER:
@@ -1336,12 +1433,14 @@ namespace Direct3D11Renderer
 			case Renderer::ResourceType::TEXTURE_3D:
 			case Renderer::ResourceType::TEXTURE_CUBE:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Not handled in here
 				break;
@@ -1730,6 +1829,13 @@ namespace Direct3D11Renderer
 		return RENDERER_NEW(mContext, RenderPass)(*this, numberOfColorAttachments, colorAttachmentTextureFormats, depthStencilAttachmentTextureFormat, numberOfMultisamples);
 	}
 
+	Renderer::IQueryPool* Direct3D11Renderer::createQueryPool(Renderer::QueryType, uint32_t)
+	{
+		// Error! The Direct3D 11 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+		RENDERER_LOG(mContext, CRITICAL, "The Direct3D 11 renderer backend has no asynchronous query support")
+		return nullptr;
+	}
+
 	Renderer::ISwapChain* Direct3D11Renderer::createSwapChain(Renderer::IRenderPass& renderPass, Renderer::WindowHandle windowHandle, bool)
 	{
 		// Sanity checks
@@ -1769,12 +1875,35 @@ namespace Direct3D11Renderer
 		return RENDERER_NEW(mContext, PipelineState)(*this, pipelineState);
 	}
 
+	Renderer::IComputePipelineState* Direct3D11Renderer::createComputePipelineState(Renderer::IRootSignature&, Renderer::IComputeShader&)
+	{
+		// Error! The Direct3D 11 renderer backend has no compute shader support.
+		RENDERER_LOG(mContext, CRITICAL, "The Direct3D 11 renderer backend has no compute shader support")
+		return nullptr;
+	}
+
 	Renderer::ISamplerState* Direct3D11Renderer::createSamplerState(const Renderer::SamplerState& samplerState)
 	{
 		return RENDERER_NEW(mContext, SamplerState)(*this, samplerState);
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Pipeline cache                                        ]
+	//[-------------------------------------------------------]
+	uint32_t Direct3D11Renderer::getPipelineCacheData(uint8_t*, uint32_t)
+	{
+		// Not supported by the Direct3D 11 renderer
+		return 0;
+	}
+
+	bool Direct3D11Renderer::setPipelineCacheData(const uint8_t*, uint32_t)
+	{
+		// Not supported by the Direct3D 11 renderer
+		return false;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
@@ -1829,15 +1958,18 @@ namespace Direct3D11Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can map, set known return values
 				mappedSubresource.data		 = nullptr;
@@ -1907,15 +2039,18 @@ namespace Direct3D11Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can unmap
 				break;
@@ -1925,6 +2060,13 @@ namespace Direct3D11Renderer
 		#undef TEXTURE_RESOURCE
 	}
 
+	bool Direct3D11Renderer::getQueryPoolResults(Renderer::IQueryPool&, uint32_t, uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t)
+	{
+		// Error! The Direct3D 11 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+		RENDERER_LOG(mContext, CRITICAL, "The Direct3D 11 renderer backend has no asynchronous query support")
+		return false;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
@@ -2298,6 +2440,14 @@ namespace Direct3D11Renderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = true;
 
+		// Draw indirect count supported?
+		mCapabilities.drawIndirectCount = false;
+
+		// Asynchronous queries supported?
+		mCapabilities.occlusionQuery = false;
+		mCapabilities.timestampQuery = false;
+		mCapabilities.pipelineStatisticsQuery = false;
+
 		// Direct3D 11 has native multi-threading
 		// -> When using user defined annotation for enhanced graphics debugging, disable native multi-threading or we'll get synchronization problems like
 		//    "
@@ -2315,6 +2465,9 @@ namespace Direct3D11Renderer
 
 		// Is there support for fragment shaders (FS)?
 		mCapabilities.fragmentShader = true;
+
+		// Is there support for compute shaders (CS)?
+		mCapabilities.computeShader = false;
 	}
 
 	void Direct3D11Renderer::setProgram(Renderer::IProgram* program)
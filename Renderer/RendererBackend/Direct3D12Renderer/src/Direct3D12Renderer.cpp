@@ -117,6 +117,19 @@ namespace
 				static_cast<Direct3D12Renderer::Direct3D12Renderer&>(renderer).setGraphicsResourceGroup(realData->rootParameterIndex, realData->resourceGroup);
 			}
 
+			//[-------------------------------------------------------]
+			//[ Compute root                                          ]
+			//[-------------------------------------------------------]
+			void SetComputeRootSignature(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 12 renderer backend has no compute shader support ("Renderer::Capabilities::computeShader" is false)
+			}
+
+			void SetComputeResourceGroup(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 12 renderer backend has no compute shader support ("Renderer::Capabilities::computeShader" is false)
+			}
+
 			//[-------------------------------------------------------]
 			//[ States                                                ]
 			//[-------------------------------------------------------]
@@ -126,6 +139,11 @@ namespace
 				static_cast<Direct3D12Renderer::Direct3D12Renderer&>(renderer).setPipelineState(realData->pipelineState);
 			}
 
+			void SetComputePipelineState(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 12 renderer backend has no compute shader support ("Renderer::Capabilities::computeShader" is false)
+			}
+
 			//[-------------------------------------------------------]
 			//[ Input-assembler (IA) stage                            ]
 			//[-------------------------------------------------------]
@@ -213,6 +231,42 @@ namespace
 				}
 			}
 
+			void DrawIndexedIndirectCount(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 12 renderer backend has no draw indirect count support since indirect buffers are emulated ("Renderer::Capabilities::drawIndirectCount" is false)
+			}
+
+			//[-------------------------------------------------------]
+			//[ Compute                                               ]
+			//[-------------------------------------------------------]
+			void DispatchCompute(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 12 renderer backend has no compute shader support ("Renderer::Capabilities::computeShader" is false)
+			}
+
+			//[-------------------------------------------------------]
+			//[ Query                                                 ]
+			//[-------------------------------------------------------]
+			void ResetQueryPool(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 12 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void BeginQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 12 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void EndQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 12 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void WriteTimestampQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 12 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
 			//[-------------------------------------------------------]
 			//[ Debug                                                 ]
 			//[-------------------------------------------------------]
@@ -264,8 +318,12 @@ namespace
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsResourceGroup,
+			// Compute root
+			&BackendDispatch::SetComputeRootSignature,
+			&BackendDispatch::SetComputeResourceGroup,
 			// States
 			&BackendDispatch::SetPipelineState,
+			&BackendDispatch::SetComputePipelineState,
 			// Input-assembler (IA) stage
 			&BackendDispatch::SetVertexArray,
 			// Rasterizer (RS) stage
@@ -280,6 +338,14 @@ namespace
 			// Draw call
 			&BackendDispatch::Draw,
 			&BackendDispatch::DrawIndexed,
+			&BackendDispatch::DrawIndexedIndirectCount,
+			// Compute
+			&BackendDispatch::DispatchCompute,
+			// Query
+			&BackendDispatch::ResetQueryPool,
+			&BackendDispatch::BeginQuery,
+			&BackendDispatch::EndQuery,
+			&BackendDispatch::WriteTimestampQuery,
 			// Debug
 			&BackendDispatch::SetDebugMarker,
 			&BackendDispatch::BeginDebugEvent,
@@ -642,6 +708,7 @@ namespace Direct3D12Renderer
 				case Renderer::ResourceType::PROGRAM:
 				case Renderer::ResourceType::VERTEX_ARRAY:
 				case Renderer::ResourceType::RENDER_PASS:
+				case Renderer::ResourceType::QUERY_POOL:
 				case Renderer::ResourceType::SWAP_CHAIN:
 				case Renderer::ResourceType::FRAMEBUFFER:
 				case Renderer::ResourceType::INDEX_BUFFER:
@@ -649,11 +716,13 @@ namespace Direct3D12Renderer
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::PIPELINE_STATE:
+				case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 				case Renderer::ResourceType::VERTEX_SHADER:
 				case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 					RENDERER_LOG(mContext, CRITICAL, "Invalid Direct3D 12 renderer backend resource type")
 					break;
 			}
@@ -798,6 +867,7 @@ namespace Direct3D12Renderer
 					case Renderer::ResourceType::PROGRAM:
 					case Renderer::ResourceType::VERTEX_ARRAY:
 					case Renderer::ResourceType::RENDER_PASS:
+					case Renderer::ResourceType::QUERY_POOL:
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -809,12 +879,14 @@ namespace Direct3D12Renderer
 					case Renderer::ResourceType::TEXTURE_3D:
 					case Renderer::ResourceType::TEXTURE_CUBE:
 					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 					case Renderer::ResourceType::SAMPLER_STATE:
 					case Renderer::ResourceType::VERTEX_SHADER:
 					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					default:
 						// Not handled in here
 						break;
@@ -904,6 +976,7 @@ namespace Direct3D12Renderer
 					case Renderer::ResourceType::PROGRAM:
 					case Renderer::ResourceType::VERTEX_ARRAY:
 					case Renderer::ResourceType::RENDER_PASS:
+					case Renderer::ResourceType::QUERY_POOL:
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -915,12 +988,14 @@ namespace Direct3D12Renderer
 					case Renderer::ResourceType::TEXTURE_3D:
 					case Renderer::ResourceType::TEXTURE_CUBE:
 					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 					case Renderer::ResourceType::SAMPLER_STATE:
 					case Renderer::ResourceType::VERTEX_SHADER:
 					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					default:
 						// Not handled in here
 						break;
@@ -1026,6 +1101,7 @@ namespace Direct3D12Renderer
 				case Renderer::ResourceType::PROGRAM:
 				case Renderer::ResourceType::VERTEX_ARRAY:
 				case Renderer::ResourceType::RENDER_PASS:
+				case Renderer::ResourceType::QUERY_POOL:
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -1037,12 +1113,14 @@ namespace Direct3D12Renderer
 				case Renderer::ResourceType::TEXTURE_3D:
 				case Renderer::ResourceType::TEXTURE_CUBE:
 				case Renderer::ResourceType::PIPELINE_STATE:
+				case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 				case Renderer::ResourceType::SAMPLER_STATE:
 				case Renderer::ResourceType::VERTEX_SHADER:
 				case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				default:
 					// Not handled in here
 					break;
@@ -1259,6 +1337,13 @@ namespace Direct3D12Renderer
 		return RENDERER_NEW(mContext, RenderPass)(*this, numberOfColorAttachments, colorAttachmentTextureFormats, depthStencilAttachmentTextureFormat, numberOfMultisamples);
 	}
 
+	Renderer::IQueryPool* Direct3D12Renderer::createQueryPool(Renderer::QueryType, uint32_t)
+	{
+		// Error! The Direct3D 12 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+		RENDERER_LOG(mContext, CRITICAL, "The Direct3D 12 renderer backend has no asynchronous query support")
+		return nullptr;
+	}
+
 	Renderer::ISwapChain* Direct3D12Renderer::createSwapChain(Renderer::IRenderPass& renderPass, Renderer::WindowHandle windowHandle, bool)
 	{
 		// Sanity checks
@@ -1298,12 +1383,35 @@ namespace Direct3D12Renderer
 		return RENDERER_NEW(mContext, PipelineState)(*this, pipelineState);
 	}
 
+	Renderer::IComputePipelineState* Direct3D12Renderer::createComputePipelineState(Renderer::IRootSignature&, Renderer::IComputeShader&)
+	{
+		// Error! The Direct3D 12 renderer backend has no compute shader support.
+		RENDERER_LOG(mContext, CRITICAL, "The Direct3D 12 renderer backend has no compute shader support")
+		return nullptr;
+	}
+
 	Renderer::ISamplerState* Direct3D12Renderer::createSamplerState(const Renderer::SamplerState& samplerState)
 	{
 		return RENDERER_NEW(mContext, SamplerState)(*this, samplerState);
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Pipeline cache                                        ]
+	//[-------------------------------------------------------]
+	uint32_t Direct3D12Renderer::getPipelineCacheData(uint8_t*, uint32_t)
+	{
+		// Not supported by the Direct3D 12 renderer
+		return 0;
+	}
+
+	bool Direct3D12Renderer::setPipelineCacheData(const uint8_t*, uint32_t)
+	{
+		// Not supported by the Direct3D 12 renderer
+		return false;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
@@ -1384,6 +1492,7 @@ namespace Direct3D12Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::SAMPLER_STATE:
@@ -1392,6 +1501,7 @@ namespace Direct3D12Renderer
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can map, set known return values
 				mappedSubresource.data		 = nullptr;
@@ -1463,6 +1573,7 @@ namespace Direct3D12Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::SAMPLER_STATE:
@@ -1471,6 +1582,7 @@ namespace Direct3D12Renderer
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can unmap
 				break;
@@ -1478,6 +1590,13 @@ namespace Direct3D12Renderer
 		*/
 	}
 
+	bool Direct3D12Renderer::getQueryPoolResults(Renderer::IQueryPool&, uint32_t, uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t)
+	{
+		// Error! The Direct3D 12 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+		RENDERER_LOG(mContext, CRITICAL, "The Direct3D 12 renderer backend has no asynchronous query support")
+		return false;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
@@ -1903,6 +2022,14 @@ namespace Direct3D12Renderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = true;
 
+		// Draw indirect count supported?
+		mCapabilities.drawIndirectCount = false;
+
+		// Asynchronous queries supported?
+		mCapabilities.occlusionQuery = false;
+		mCapabilities.timestampQuery = false;
+		mCapabilities.pipelineStatisticsQuery = false;
+
 		// Direct3D 12 has native multi-threading // TODO(co) But do only set this to true if it has been tested
 		mCapabilities.nativeMultiThreading = false;
 
@@ -1915,6 +2042,9 @@ namespace Direct3D12Renderer
 
 		// Is there support for fragment shaders (FS)?
 		mCapabilities.fragmentShader = true;
+
+		// Is there support for compute shaders (CS)?
+		mCapabilities.computeShader = false;
 	}
 
 	#ifdef RENDERER_DEBUG
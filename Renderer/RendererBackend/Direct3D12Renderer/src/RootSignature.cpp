@@ -87,8 +87,9 @@ namespace Direct3D12Renderer
 								}
 							}
 						}
-						if (~0u == shaderVisibility)
+						if (~0u == shaderVisibility || static_cast<uint32_t>(Renderer::ShaderVisibility::COMPUTE) == shaderVisibility)
 						{
+							// There's no Direct3D 12 compute shader visibility, compute shaders always see all root parameters
 							shaderVisibility = static_cast<uint32_t>(Renderer::ShaderVisibility::ALL);
 						}
 
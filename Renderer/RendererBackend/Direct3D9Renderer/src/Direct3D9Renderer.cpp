@@ -114,6 +114,19 @@ namespace
 				static_cast<Direct3D9Renderer::Direct3D9Renderer&>(renderer).setGraphicsResourceGroup(realData->rootParameterIndex, realData->resourceGroup);
 			}
 
+			//[-------------------------------------------------------]
+			//[ Compute root                                          ]
+			//[-------------------------------------------------------]
+			void SetComputeRootSignature(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, Direct3D 9 has no compute shader support
+			}
+
+			void SetComputeResourceGroup(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, Direct3D 9 has no compute shader support
+			}
+
 			//[-------------------------------------------------------]
 			//[ States                                                ]
 			//[-------------------------------------------------------]
@@ -123,6 +136,11 @@ namespace
 				static_cast<Direct3D9Renderer::Direct3D9Renderer&>(renderer).setPipelineState(realData->pipelineState);
 			}
 
+			void SetComputePipelineState(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, Direct3D 9 has no compute shader support
+			}
+
 			//[-------------------------------------------------------]
 			//[ Input-assembler (IA) stage                            ]
 			//[-------------------------------------------------------]
@@ -208,6 +226,42 @@ namespace
 				}
 			}
 
+			void DrawIndexedIndirectCount(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, Direct3D 9 has no draw indirect count support ("Renderer::Capabilities::drawIndirectCount" is false)
+			}
+
+			//[-------------------------------------------------------]
+			//[ Compute                                               ]
+			//[-------------------------------------------------------]
+			void DispatchCompute(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, Direct3D 9 has no compute shader support
+			}
+
+			//[-------------------------------------------------------]
+			//[ Query                                                 ]
+			//[-------------------------------------------------------]
+			void ResetQueryPool(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 9 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void BeginQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 9 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void EndQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 9 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void WriteTimestampQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the Direct3D 9 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
 			//[-------------------------------------------------------]
 			//[ Debug                                                 ]
 			//[-------------------------------------------------------]
@@ -259,8 +313,12 @@ namespace
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsResourceGroup,
+			// Compute root
+			&BackendDispatch::SetComputeRootSignature,
+			&BackendDispatch::SetComputeResourceGroup,
 			// States
 			&BackendDispatch::SetPipelineState,
+			&BackendDispatch::SetComputePipelineState,
 			// Input-assembler (IA) stage
 			&BackendDispatch::SetVertexArray,
 			// Rasterizer (RS) stage
@@ -275,6 +333,14 @@ namespace
 			// Draw call
 			&BackendDispatch::Draw,
 			&BackendDispatch::DrawIndexed,
+			&BackendDispatch::DrawIndexedIndirectCount,
+			// Compute
+			&BackendDispatch::DispatchCompute,
+			// Query
+			&BackendDispatch::ResetQueryPool,
+			&BackendDispatch::BeginQuery,
+			&BackendDispatch::EndQuery,
+			&BackendDispatch::WriteTimestampQuery,
 			// Debug
 			&BackendDispatch::SetDebugMarker,
 			&BackendDispatch::BeginDebugEvent,
@@ -580,6 +646,7 @@ namespace Direct3D9Renderer
 							case Renderer::ResourceType::PROGRAM:
 							case Renderer::ResourceType::VERTEX_ARRAY:
 							case Renderer::ResourceType::RENDER_PASS:
+							case Renderer::ResourceType::QUERY_POOL:
 							case Renderer::ResourceType::SWAP_CHAIN:
 							case Renderer::ResourceType::FRAMEBUFFER:
 							case Renderer::ResourceType::INDEX_BUFFER:
@@ -587,11 +654,13 @@ namespace Direct3D9Renderer
 							case Renderer::ResourceType::UNIFORM_BUFFER:
 							case Renderer::ResourceType::INDIRECT_BUFFER:
 							case Renderer::ResourceType::PIPELINE_STATE:
+							case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 							case Renderer::ResourceType::VERTEX_SHADER:
 							case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 							case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 							case Renderer::ResourceType::GEOMETRY_SHADER:
 							case Renderer::ResourceType::FRAGMENT_SHADER:
+							case Renderer::ResourceType::COMPUTE_SHADER:
 								// Nothing here
 								break;
 						}
@@ -693,6 +762,10 @@ namespace Direct3D9Renderer
 								// End debug event
 								RENDERER_END_DEBUG_EVENT(this)
 								break;
+
+							case Renderer::ShaderVisibility::COMPUTE:
+								RENDERER_LOG(mContext, CRITICAL, "Direct3D 9 has no compute shader support")
+								break;
 						}
 						break;
 					}
@@ -706,17 +779,20 @@ namespace Direct3D9Renderer
 					case Renderer::ResourceType::PROGRAM:
 					case Renderer::ResourceType::VERTEX_ARRAY:
 					case Renderer::ResourceType::RENDER_PASS:
+					case Renderer::ResourceType::QUERY_POOL:
 					case Renderer::ResourceType::SWAP_CHAIN:
 					case Renderer::ResourceType::FRAMEBUFFER:
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::INDIRECT_BUFFER:
 					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 					case Renderer::ResourceType::VERTEX_SHADER:
 					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 						RENDERER_LOG(mContext, CRITICAL, "Invalid Direct3D 9 renderer backend resource type")
 						break;
 				}
@@ -893,6 +969,7 @@ namespace Direct3D9Renderer
 					case Renderer::ResourceType::PROGRAM:
 					case Renderer::ResourceType::VERTEX_ARRAY:
 					case Renderer::ResourceType::RENDER_PASS:
+					case Renderer::ResourceType::QUERY_POOL:
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -904,12 +981,14 @@ namespace Direct3D9Renderer
 					case Renderer::ResourceType::TEXTURE_3D:
 					case Renderer::ResourceType::TEXTURE_CUBE:
 					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 					case Renderer::ResourceType::SAMPLER_STATE:
 					case Renderer::ResourceType::VERTEX_SHADER:
 					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					default:
 						// Not handled in here
 						break;
@@ -1379,6 +1458,13 @@ namespace Direct3D9Renderer
 		return RENDERER_NEW(mContext, RenderPass)(*this, numberOfColorAttachments, colorAttachmentTextureFormats, depthStencilAttachmentTextureFormat, numberOfMultisamples);
 	}
 
+	Renderer::IQueryPool* Direct3D9Renderer::createQueryPool(Renderer::QueryType, uint32_t)
+	{
+		// Error! The Direct3D 9 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+		RENDERER_LOG(mContext, CRITICAL, "The Direct3D 9 renderer backend has no asynchronous query support")
+		return nullptr;
+	}
+
 	Renderer::ISwapChain* Direct3D9Renderer::createSwapChain(Renderer::IRenderPass& renderPass, Renderer::WindowHandle windowHandle, bool)
 	{
 		// Sanity checks
@@ -1418,12 +1504,35 @@ namespace Direct3D9Renderer
 		return RENDERER_NEW(mContext, PipelineState)(*this, pipelineState);
 	}
 
+	Renderer::IComputePipelineState* Direct3D9Renderer::createComputePipelineState(Renderer::IRootSignature&, Renderer::IComputeShader&)
+	{
+		// Error! Direct3D 9 has no compute shader support.
+		RENDERER_LOG(mContext, CRITICAL, "Direct3D 9 has no compute shader support")
+		return nullptr;
+	}
+
 	Renderer::ISamplerState* Direct3D9Renderer::createSamplerState(const Renderer::SamplerState& samplerState)
 	{
 		return RENDERER_NEW(mContext, SamplerState)(*this, samplerState);
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Pipeline cache                                        ]
+	//[-------------------------------------------------------]
+	uint32_t Direct3D9Renderer::getPipelineCacheData(uint8_t*, uint32_t)
+	{
+		// Not supported by the Direct3D 9 renderer
+		return 0;
+	}
+
+	bool Direct3D9Renderer::setPipelineCacheData(const uint8_t*, uint32_t)
+	{
+		// Not supported by the Direct3D 9 renderer
+		return false;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
@@ -1576,18 +1685,21 @@ namespace Direct3D9Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::UNIFORM_BUFFER:
 			case Renderer::ResourceType::TEXTURE_BUFFER:
 			case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can map, set known return values
 				mappedSubresource.data		 = nullptr;
@@ -1640,24 +1752,34 @@ namespace Direct3D9Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::UNIFORM_BUFFER:
 			case Renderer::ResourceType::TEXTURE_BUFFER:
 			case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can unmap
 				break;
 		}
 	}
 
+	bool Direct3D9Renderer::getQueryPoolResults(Renderer::IQueryPool&, uint32_t, uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t)
+	{
+		// Error! The Direct3D 9 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+		RENDERER_LOG(mContext, CRITICAL, "The Direct3D 9 renderer backend has no asynchronous query support")
+		return false;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
@@ -1811,6 +1933,14 @@ namespace Direct3D9Renderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = true;
 
+		// Draw indirect count supported?
+		mCapabilities.drawIndirectCount = false;
+
+		// Asynchronous queries supported?
+		mCapabilities.occlusionQuery = false;
+		mCapabilities.timestampQuery = false;
+		mCapabilities.pipelineStatisticsQuery = false;
+
 		// Direct3D 9 has no native multi-threading
 		mCapabilities.nativeMultiThreading = false;
 
@@ -1830,6 +1960,9 @@ namespace Direct3D9Renderer
 		// Is there support for fragment shaders (FS)?
 		mCapabilities.fragmentShader = true;
 
+		// Is there support for compute shaders (CS)?
+		mCapabilities.computeShader = false;
+
 		// We only target graphics hardware which also supports ATI1N and ATI2N, so no need to add this inside the capabilities
 		// -> The following is for debugging only, don't delete it
 		#if 0
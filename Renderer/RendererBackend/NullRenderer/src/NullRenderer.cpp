@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "NullRenderer/NullRenderer.h"
 #include "NullRenderer/NullDebug.h"	// For "NULLRENDERER_RENDERERMATCHCHECK_ASSERT()"
+#include "NullRenderer/QueryPool.h"
 #include "NullRenderer/RootSignature.h"
 #include "NullRenderer/ResourceGroup.h"
 #include "NullRenderer/RenderTarget/SwapChain.h"
@@ -38,6 +39,8 @@
 #include "NullRenderer/Texture/TextureManager.h"
 #include "NullRenderer/State/SamplerState.h"
 #include "NullRenderer/State/PipelineState.h"
+#include "NullRenderer/State/ComputePipelineState.h"
+#include "NullRenderer/Shader/ComputeShader.h"
 #include "NullRenderer/Shader/Program.h"
 #include "NullRenderer/Shader/ShaderLanguage.h"
 
@@ -48,6 +51,8 @@
 #include <Renderer/Buffer/CommandBuffer.h>
 #include <Renderer/Buffer/IndirectBufferTypes.h>
 
+#include <cstring>	// For "memset()"
+
 
 //[-------------------------------------------------------]
 //[ Global functions                                      ]
@@ -106,6 +111,21 @@ namespace
 				static_cast<NullRenderer::NullRenderer&>(renderer).setGraphicsResourceGroup(realData->rootParameterIndex, realData->resourceGroup);
 			}
 
+			//[-------------------------------------------------------]
+			//[ Compute root                                          ]
+			//[-------------------------------------------------------]
+			void SetComputeRootSignature(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::SetComputeRootSignature* realData = static_cast<const Renderer::Command::SetComputeRootSignature*>(data);
+				static_cast<NullRenderer::NullRenderer&>(renderer).setComputeRootSignature(realData->rootSignature);
+			}
+
+			void SetComputeResourceGroup(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::SetComputeResourceGroup* realData = static_cast<const Renderer::Command::SetComputeResourceGroup*>(data);
+				static_cast<NullRenderer::NullRenderer&>(renderer).setComputeResourceGroup(realData->rootParameterIndex, realData->resourceGroup);
+			}
+
 			//[-------------------------------------------------------]
 			//[ States                                                ]
 			//[-------------------------------------------------------]
@@ -115,6 +135,12 @@ namespace
 				static_cast<NullRenderer::NullRenderer&>(renderer).setPipelineState(realData->pipelineState);
 			}
 
+			void SetComputePipelineState(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::SetComputePipelineState* realData = static_cast<const Renderer::Command::SetComputePipelineState*>(data);
+				static_cast<NullRenderer::NullRenderer&>(renderer).setComputePipelineState(realData->computePipelineState);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Input-assembler (IA) stage                            ]
 			//[-------------------------------------------------------]
@@ -200,6 +226,48 @@ namespace
 				}
 			}
 
+			void DrawIndexedIndirectCount(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::DrawIndexedIndirectCount* realData = static_cast<const Renderer::Command::DrawIndexedIndirectCount*>(data);
+				static_cast<NullRenderer::NullRenderer&>(renderer).drawIndexedIndirectCount(*realData->indirectBuffer, realData->indirectBufferOffset, *realData->countBuffer, realData->countBufferOffset, realData->maximumNumberOfDraws);
+			}
+
+			//[-------------------------------------------------------]
+			//[ Compute                                               ]
+			//[-------------------------------------------------------]
+			void DispatchCompute(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::DispatchCompute* realData = static_cast<const Renderer::Command::DispatchCompute*>(data);
+				static_cast<NullRenderer::NullRenderer&>(renderer).dispatchCompute(realData->groupCountX, realData->groupCountY, realData->groupCountZ);
+			}
+
+			//[-------------------------------------------------------]
+			//[ Query                                                 ]
+			//[-------------------------------------------------------]
+			void ResetQueryPool(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::ResetQueryPool* realData = static_cast<const Renderer::Command::ResetQueryPool*>(data);
+				static_cast<NullRenderer::NullRenderer&>(renderer).resetQueryPool(*realData->queryPool, realData->firstQueryIndex, realData->numberOfQueries);
+			}
+
+			void BeginQuery(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::BeginQuery* realData = static_cast<const Renderer::Command::BeginQuery*>(data);
+				static_cast<NullRenderer::NullRenderer&>(renderer).beginQuery(*realData->queryPool, realData->queryIndex);
+			}
+
+			void EndQuery(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::EndQuery* realData = static_cast<const Renderer::Command::EndQuery*>(data);
+				static_cast<NullRenderer::NullRenderer&>(renderer).endQuery(*realData->queryPool, realData->queryIndex);
+			}
+
+			void WriteTimestampQuery(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::WriteTimestampQuery* realData = static_cast<const Renderer::Command::WriteTimestampQuery*>(data);
+				static_cast<NullRenderer::NullRenderer&>(renderer).writeTimestampQuery(*realData->queryPool, realData->queryIndex);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Debug                                                 ]
 			//[-------------------------------------------------------]
@@ -251,8 +319,12 @@ namespace
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsResourceGroup,
+			// Compute root
+			&BackendDispatch::SetComputeRootSignature,
+			&BackendDispatch::SetComputeResourceGroup,
 			// States
 			&BackendDispatch::SetPipelineState,
+			&BackendDispatch::SetComputePipelineState,
 			// Input-assembler (IA) stage
 			&BackendDispatch::SetVertexArray,
 			// Rasterizer (RS) stage
@@ -267,6 +339,14 @@ namespace
 			// Draw call
 			&BackendDispatch::Draw,
 			&BackendDispatch::DrawIndexed,
+			&BackendDispatch::DrawIndexedIndirectCount,
+			// Compute
+			&BackendDispatch::DispatchCompute,
+			// Query
+			&BackendDispatch::ResetQueryPool,
+			&BackendDispatch::BeginQuery,
+			&BackendDispatch::EndQuery,
+			&BackendDispatch::WriteTimestampQuery,
 			// Debug
 			&BackendDispatch::SetDebugMarker,
 			&BackendDispatch::BeginDebugEvent,
@@ -295,7 +375,8 @@ namespace NullRenderer
 		IRenderer(context),
 		mShaderLanguage(nullptr),
 		mRenderTarget(nullptr),
-		mGraphicsRootSignature(nullptr)
+		mGraphicsRootSignature(nullptr),
+		mComputeRootSignature(nullptr)
 	{
 		// Initialize the capabilities
 		initializeCapabilities();
@@ -314,6 +395,11 @@ namespace NullRenderer
 			mGraphicsRootSignature->releaseReference();
 			mGraphicsRootSignature = nullptr;
 		}
+		if (nullptr != mComputeRootSignature)
+		{
+			mComputeRootSignature->releaseReference();
+			mComputeRootSignature = nullptr;
+		}
 
 		#ifndef RENDERER_NO_STATISTICS
 		{ // For debugging: At this point there should be no resource instances left, validate this!
@@ -409,6 +495,56 @@ namespace NullRenderer
 		}
 	}
 
+	void NullRenderer::setComputeRootSignature(Renderer::IRootSignature* rootSignature)
+	{
+		if (nullptr != mComputeRootSignature)
+		{
+			mComputeRootSignature->releaseReference();
+		}
+		mComputeRootSignature = static_cast<RootSignature*>(rootSignature);
+		if (nullptr != mComputeRootSignature)
+		{
+			mComputeRootSignature->addReference();
+
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *rootSignature)
+		}
+	}
+
+	void NullRenderer::setComputeResourceGroup(uint32_t rootParameterIndex, Renderer::IResourceGroup* resourceGroup)
+	{
+		// Security checks
+		#ifdef RENDERER_DEBUG
+		{
+			if (nullptr == mComputeRootSignature)
+			{
+				RENDERER_LOG(mContext, CRITICAL, "No null renderer backend compute root signature set")
+				return;
+			}
+			const Renderer::RootSignature& rootSignature = mComputeRootSignature->getRootSignature();
+			if (rootParameterIndex >= rootSignature.numberOfParameters)
+			{
+				RENDERER_LOG(mContext, CRITICAL, "The null renderer backend root parameter index is out of bounds")
+				return;
+			}
+			const Renderer::RootParameter& rootParameter = rootSignature.parameters[rootParameterIndex];
+			if (Renderer::RootParameterType::DESCRIPTOR_TABLE != rootParameter.parameterType)
+			{
+				RENDERER_LOG(mContext, CRITICAL, "The null renderer backend root parameter index doesn't reference a descriptor table")
+				return;
+			}
+		}
+		#else
+			std::ignore = rootParameterIndex;
+		#endif
+
+		if (nullptr != resourceGroup)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *resourceGroup)
+		}
+	}
+
 	void NullRenderer::setPipelineState(Renderer::IPipelineState* pipelineState)
 	{
 		if (nullptr != pipelineState)
@@ -423,6 +559,16 @@ namespace NullRenderer
 	}
 
 
+	void NullRenderer::setComputePipelineState(Renderer::IComputePipelineState* computePipelineState)
+	{
+		if (nullptr != computePipelineState)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *computePipelineState)
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Input-assembler (IA) stage                            ]
 	//[-------------------------------------------------------]
@@ -538,6 +684,76 @@ namespace NullRenderer
 		std::ignore = numberOfDraws;
 	}
 
+	void NullRenderer::drawIndexedIndirectCount(const Renderer::IIndirectBuffer& indirectBuffer, uint32_t, const Renderer::IIndirectBuffer& countBuffer, uint32_t countBufferOffset, uint32_t)
+	{
+		// Security checks: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+		NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, indirectBuffer)
+		NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, countBuffer)
+
+		// Sanity check
+		RENDERER_ASSERT(mContext, 0 == (countBufferOffset % sizeof(uint32_t)), "The null count buffer offset must be a multiple of four")
+		std::ignore = indirectBuffer;
+		std::ignore = countBuffer;
+		std::ignore = countBufferOffset;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Compute                                               ]
+	//[-------------------------------------------------------]
+	void NullRenderer::dispatchCompute(uint32_t, uint32_t, uint32_t)
+	{
+		// Nothing here
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Query                                                 ]
+	//[-------------------------------------------------------]
+	void NullRenderer::resetQueryPool(Renderer::IQueryPool& queryPool, uint32_t firstQueryIndex, uint32_t numberOfQueries)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity check
+		RENDERER_ASSERT(mContext, firstQueryIndex + numberOfQueries <= static_cast<const QueryPool&>(queryPool).getNumberOfQueries(), "Null out-of-bounds query index")
+		std::ignore = firstQueryIndex;
+		std::ignore = numberOfQueries;
+	}
+
+	void NullRenderer::beginQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		RENDERER_ASSERT(mContext, Renderer::QueryType::TIMESTAMP != static_cast<const QueryPool&>(queryPool).getQueryType(), "Null begin query needs an occlusion or pipeline statistics query pool")
+		RENDERER_ASSERT(mContext, queryIndex < static_cast<const QueryPool&>(queryPool).getNumberOfQueries(), "Null out-of-bounds query index")
+		std::ignore = queryIndex;
+	}
+
+	void NullRenderer::endQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		RENDERER_ASSERT(mContext, Renderer::QueryType::TIMESTAMP != static_cast<const QueryPool&>(queryPool).getQueryType(), "Null end query needs an occlusion or pipeline statistics query pool")
+		RENDERER_ASSERT(mContext, queryIndex < static_cast<const QueryPool&>(queryPool).getNumberOfQueries(), "Null out-of-bounds query index")
+		std::ignore = queryIndex;
+	}
+
+	void NullRenderer::writeTimestampQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		RENDERER_ASSERT(mContext, Renderer::QueryType::TIMESTAMP == static_cast<const QueryPool&>(queryPool).getQueryType(), "Null write timestamp query needs a timestamp query pool")
+		RENDERER_ASSERT(mContext, queryIndex < static_cast<const QueryPool&>(queryPool).getNumberOfQueries(), "Null out-of-bounds query index")
+		std::ignore = queryIndex;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Debug                                                 ]
@@ -642,6 +858,12 @@ namespace NullRenderer
 		return RENDERER_NEW(mContext, RenderPass)(*this, numberOfColorAttachments, colorAttachmentTextureFormats, depthStencilAttachmentTextureFormat, numberOfMultisamples);
 	}
 
+	Renderer::IQueryPool* NullRenderer::createQueryPool(Renderer::QueryType queryType, uint32_t numberOfQueries)
+	{
+		RENDERER_ASSERT(mContext, numberOfQueries > 0, "Null: Number of queries mustn't be zero")
+		return RENDERER_NEW(mContext, QueryPool)(*this, queryType, numberOfQueries);
+	}
+
 	Renderer::ISwapChain* NullRenderer::createSwapChain(Renderer::IRenderPass& renderPass, Renderer::WindowHandle windowHandle, bool)
 	{
 		// Sanity checks
@@ -709,12 +931,38 @@ namespace NullRenderer
 		return RENDERER_NEW(mContext, PipelineState)(*this, pipelineState);
 	}
 
+	Renderer::IComputePipelineState* NullRenderer::createComputePipelineState(Renderer::IRootSignature& rootSignature, Renderer::IComputeShader& computeShader)
+	{
+		// Security checks: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+		NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, rootSignature)
+		NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, computeShader)
+
+		// Create the compute pipeline state
+		return RENDERER_NEW(mContext, ComputePipelineState)(*this, rootSignature, computeShader);
+	}
+
 	Renderer::ISamplerState* NullRenderer::createSamplerState(const Renderer::SamplerState &)
 	{
 		return RENDERER_NEW(mContext, SamplerState)(*this);
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Pipeline cache                                        ]
+	//[-------------------------------------------------------]
+	uint32_t NullRenderer::getPipelineCacheData(uint8_t*, uint32_t)
+	{
+		// Not supported by the null renderer
+		return 0;
+	}
+
+	bool NullRenderer::setPipelineCacheData(const uint8_t*, uint32_t)
+	{
+		// Not supported by the null renderer
+		return false;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
@@ -729,6 +977,33 @@ namespace NullRenderer
 		// Nothing here
 	}
 
+	bool NullRenderer::getQueryPoolResults(Renderer::IQueryPool& queryPool, uint32_t numberOfDataBytes, uint8_t* data, uint32_t firstQueryIndex, uint32_t numberOfQueries, uint32_t strideInBytes, uint32_t)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		NULLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		const QueryPool& nullQueryPool = static_cast<const QueryPool&>(queryPool);
+		RENDERER_ASSERT(mContext, firstQueryIndex + numberOfQueries <= nullQueryPool.getNumberOfQueries(), "Null out-of-bounds query index")
+		const uint32_t numberOfResultBytes = (Renderer::QueryType::PIPELINE_STATISTICS == nullQueryPool.getQueryType()) ? sizeof(Renderer::PipelineStatisticsQueryResult) : sizeof(uint64_t);
+		if (0 == strideInBytes)
+		{
+			strideInBytes = numberOfResultBytes;
+		}
+		RENDERER_ASSERT(mContext, numberOfQueries > 0 && strideInBytes * (numberOfQueries - 1) + numberOfResultBytes <= numberOfDataBytes, "Null query pool results data buffer is too small")
+		std::ignore = firstQueryIndex;
+		std::ignore = numberOfDataBytes;
+
+		// The null renderer has no GPU, so all results are immediately available and zero
+		for (uint32_t i = 0; i < numberOfQueries; ++i)
+		{
+			memset(data + i * strideInBytes, 0, numberOfResultBytes);
+		}
+
+		// Done
+		return true;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
@@ -846,6 +1121,14 @@ namespace NullRenderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = true;
 
+		// Draw indirect count supported?
+		mCapabilities.drawIndirectCount = true;
+
+		// Asynchronous queries supported? The null renderer accepts all query types and returns zero results
+		mCapabilities.occlusionQuery = true;
+		mCapabilities.timestampQuery = true;
+		mCapabilities.pipelineStatisticsQuery = true;
+
 		// The null renderer has native multi-threading
 		mCapabilities.nativeMultiThreading = true;
 
@@ -863,6 +1146,9 @@ namespace NullRenderer
 
 		// Is there support for fragment shaders (FS)?
 		mCapabilities.fragmentShader = true;
+
+		// Is there support for compute shaders (CS)?
+		mCapabilities.computeShader = true;
 	}
 
 
@@ -26,6 +26,7 @@
 #include "NullRenderer/Shader/VertexShader.h"
 #include "NullRenderer/Shader/GeometryShader.h"
 #include "NullRenderer/Shader/FragmentShader.h"
+#include "NullRenderer/Shader/ComputeShader.h"
 #include "NullRenderer/Shader/TessellationControlShader.h"
 #include "NullRenderer/Shader/TessellationEvaluationShader.h"
 
@@ -129,6 +130,18 @@ namespace NullRenderer
 		return RENDERER_NEW(getRenderer().getContext(), FragmentShader)(reinterpret_cast<NullRenderer&>(getRenderer()));
 	}
 
+	Renderer::IComputeShader* ShaderLanguage::createComputeShaderFromBytecode(const Renderer::ShaderBytecode&)
+	{
+		// There's no need to check for "Renderer::Capabilities::computeShader", we know there's compute shader support
+		return RENDERER_NEW(getRenderer().getContext(), ComputeShader)(reinterpret_cast<NullRenderer&>(getRenderer()));
+	}
+
+	Renderer::IComputeShader* ShaderLanguage::createComputeShaderFromSourceCode(const Renderer::ShaderSourceCode&, Renderer::ShaderBytecode*)
+	{
+		// There's no need to check for "Renderer::Capabilities::computeShader", we know there's compute shader support
+		return RENDERER_NEW(getRenderer().getContext(), ComputeShader)(reinterpret_cast<NullRenderer&>(getRenderer()));
+	}
+
 	Renderer::IProgram* ShaderLanguage::createProgram(const Renderer::IRootSignature&, const Renderer::VertexAttributes&, Renderer::IVertexShader* vertexShader, Renderer::ITessellationControlShader* tessellationControlShader, Renderer::ITessellationEvaluationShader* tessellationEvaluationShader, Renderer::IGeometryShader* geometryShader, Renderer::IFragmentShader* fragmentShader)
 	{
 		// A shader can be a null pointer, but if it's not the shader and program language must match!
@@ -171,6 +171,19 @@ namespace
 				static_cast<OpenGLES3Renderer::OpenGLES3Renderer&>(renderer).setGraphicsResourceGroup(realData->rootParameterIndex, realData->resourceGroup);
 			}
 
+			//[-------------------------------------------------------]
+			//[ Compute root                                          ]
+			//[-------------------------------------------------------]
+			void SetComputeRootSignature(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, OpenGL ES 3 has no compute shader support
+			}
+
+			void SetComputeResourceGroup(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, OpenGL ES 3 has no compute shader support
+			}
+
 			//[-------------------------------------------------------]
 			//[ States                                                ]
 			//[-------------------------------------------------------]
@@ -180,6 +193,11 @@ namespace
 				static_cast<OpenGLES3Renderer::OpenGLES3Renderer&>(renderer).setPipelineState(realData->pipelineState);
 			}
 
+			void SetComputePipelineState(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, OpenGL ES 3 has no compute shader support
+			}
+
 			//[-------------------------------------------------------]
 			//[ Input-assembler (IA) stage                            ]
 			//[-------------------------------------------------------]
@@ -265,6 +283,42 @@ namespace
 				}
 			}
 
+			void DrawIndexedIndirectCount(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the OpenGL ES 3 renderer backend has no draw indirect count support since it has no compute shaders which could write the count ("Renderer::Capabilities::drawIndirectCount" is false)
+			}
+
+			//[-------------------------------------------------------]
+			//[ Compute                                               ]
+			//[-------------------------------------------------------]
+			void DispatchCompute(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, OpenGL ES 3 has no compute shader support
+			}
+
+			//[-------------------------------------------------------]
+			//[ Query                                                 ]
+			//[-------------------------------------------------------]
+			void ResetQueryPool(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the OpenGL ES 3 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void BeginQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the OpenGL ES 3 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void EndQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the OpenGL ES 3 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
+			void WriteTimestampQuery(const void*, Renderer::IRenderer&)
+			{
+				// Nothing here, the OpenGL ES 3 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+			}
+
 			//[-------------------------------------------------------]
 			//[ Debug                                                 ]
 			//[-------------------------------------------------------]
@@ -316,8 +370,12 @@ namespace
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsResourceGroup,
+			// Compute root
+			&BackendDispatch::SetComputeRootSignature,
+			&BackendDispatch::SetComputeResourceGroup,
 			// States
 			&BackendDispatch::SetPipelineState,
+			&BackendDispatch::SetComputePipelineState,
 			// Input-assembler (IA) stage
 			&BackendDispatch::SetVertexArray,
 			// Rasterizer (RS) stage
@@ -332,6 +390,14 @@ namespace
 			// Draw call
 			&BackendDispatch::Draw,
 			&BackendDispatch::DrawIndexed,
+			&BackendDispatch::DrawIndexedIndirectCount,
+			// Compute
+			&BackendDispatch::DispatchCompute,
+			// Query
+			&BackendDispatch::ResetQueryPool,
+			&BackendDispatch::BeginQuery,
+			&BackendDispatch::EndQuery,
+			&BackendDispatch::WriteTimestampQuery,
 			// Debug
 			&BackendDispatch::SetDebugMarker,
 			&BackendDispatch::BeginDebugEvent,
@@ -671,6 +737,10 @@ namespace OpenGLES3Renderer
 							case Renderer::ShaderVisibility::GEOMETRY:
 								RENDERER_LOG(mContext, CRITICAL, "OpenGL ES 3 has no geometry shader support")
 								break;
+
+							case Renderer::ShaderVisibility::COMPUTE:
+								RENDERER_LOG(mContext, CRITICAL, "OpenGL ES 3 has no compute shader support")
+								break;
 						}
 						break;
 					}
@@ -684,17 +754,20 @@ namespace OpenGLES3Renderer
 					case Renderer::ResourceType::PROGRAM:
 					case Renderer::ResourceType::VERTEX_ARRAY:
 					case Renderer::ResourceType::RENDER_PASS:
+					case Renderer::ResourceType::QUERY_POOL:
 					case Renderer::ResourceType::SWAP_CHAIN:
 					case Renderer::ResourceType::FRAMEBUFFER:
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::INDIRECT_BUFFER:
 					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 					case Renderer::ResourceType::VERTEX_SHADER:
 					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 						RENDERER_LOG(mContext, CRITICAL, "Invalid Direct3D 11 renderer backend resource type")
 						break;
 				}
@@ -917,6 +990,7 @@ namespace OpenGLES3Renderer
 					case Renderer::ResourceType::PROGRAM:
 					case Renderer::ResourceType::VERTEX_ARRAY:
 					case Renderer::ResourceType::RENDER_PASS:
+					case Renderer::ResourceType::QUERY_POOL:
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -928,12 +1002,14 @@ namespace OpenGLES3Renderer
 					case Renderer::ResourceType::TEXTURE_3D:
 					case Renderer::ResourceType::TEXTURE_CUBE:
 					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 					case Renderer::ResourceType::SAMPLER_STATE:
 					case Renderer::ResourceType::VERTEX_SHADER:
 					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					default:
 						// Not handled in here
 						break;
@@ -1101,6 +1177,7 @@ namespace OpenGLES3Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::INDEX_BUFFER:
@@ -1113,12 +1190,14 @@ namespace OpenGLES3Renderer
 			case Renderer::ResourceType::TEXTURE_3D:
 			case Renderer::ResourceType::TEXTURE_CUBE:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Not handled in here
 				break;
@@ -1391,6 +1470,13 @@ namespace OpenGLES3Renderer
 		return RENDERER_NEW(mContext, RenderPass)(*this, numberOfColorAttachments, colorAttachmentTextureFormats, depthStencilAttachmentTextureFormat, numberOfMultisamples);
 	}
 
+	Renderer::IQueryPool* OpenGLES3Renderer::createQueryPool(Renderer::QueryType, uint32_t)
+	{
+		// Error! The OpenGL ES 3 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+		RENDERER_LOG(mContext, CRITICAL, "The OpenGL ES 3 renderer backend has no asynchronous query support")
+		return nullptr;
+	}
+
 	Renderer::ISwapChain* OpenGLES3Renderer::createSwapChain(Renderer::IRenderPass& renderPass, Renderer::WindowHandle windowHandle, bool)
 	{
 		// Sanity checks
@@ -1430,12 +1516,35 @@ namespace OpenGLES3Renderer
 		return RENDERER_NEW(mContext, PipelineState)(*this, pipelineState);
 	}
 
+	Renderer::IComputePipelineState* OpenGLES3Renderer::createComputePipelineState(Renderer::IRootSignature&, Renderer::IComputeShader&)
+	{
+		// Error! OpenGL ES 3 has no compute shader support.
+		RENDERER_LOG(mContext, CRITICAL, "OpenGL ES 3 has no compute shader support")
+		return nullptr;
+	}
+
 	Renderer::ISamplerState* OpenGLES3Renderer::createSamplerState(const Renderer::SamplerState& samplerState)
 	{
 		return RENDERER_NEW(mContext, SamplerState)(*this, samplerState);
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Pipeline cache                                        ]
+	//[-------------------------------------------------------]
+	uint32_t OpenGLES3Renderer::getPipelineCacheData(uint8_t*, uint32_t)
+	{
+		// Not supported by the OpenGL ES 3 renderer
+		return 0;
+	}
+
+	bool OpenGLES3Renderer::setPipelineCacheData(const uint8_t*, uint32_t)
+	{
+		// Not supported by the OpenGL ES 3 renderer
+		return false;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
@@ -1555,15 +1664,18 @@ namespace OpenGLES3Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can map, set known return values
 				mappedSubresource.data		 = nullptr;
@@ -1661,21 +1773,31 @@ namespace OpenGLES3Renderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can unmap
 				break;
 		}
 	}
 
+	bool OpenGLES3Renderer::getQueryPoolResults(Renderer::IQueryPool&, uint32_t, uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t)
+	{
+		// Error! The OpenGL ES 3 renderer backend has no asynchronous query support ("Renderer::Capabilities::occlusionQuery", "Renderer::Capabilities::timestampQuery" and "Renderer::Capabilities::pipelineStatisticsQuery" are false)
+		RENDERER_LOG(mContext, CRITICAL, "The OpenGL ES 3 renderer backend has no asynchronous query support")
+		return false;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
@@ -1964,6 +2086,14 @@ namespace OpenGLES3Renderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = mOpenGLES3Context->getExtensions().isGL_EXT_draw_elements_base_vertex();
 
+		// Draw indirect count supported?
+		mCapabilities.drawIndirectCount = false;
+
+		// Asynchronous queries supported?
+		mCapabilities.occlusionQuery = false;
+		mCapabilities.timestampQuery = false;
+		mCapabilities.pipelineStatisticsQuery = false;
+
 		// OpenGL ES 3 has no native multi-threading
 		mCapabilities.nativeMultiThreading = false;
 
@@ -1981,6 +2111,9 @@ namespace OpenGLES3Renderer
 
 		// Is there support for fragment shaders (FS)?
 		mCapabilities.fragmentShader = true;
+
+		// Is there support for compute shaders (CS)?
+		mCapabilities.computeShader = false;
 	}
 
 	void OpenGLES3Renderer::setProgram(Renderer::IProgram* program)
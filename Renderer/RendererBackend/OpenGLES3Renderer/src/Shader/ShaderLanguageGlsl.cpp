@@ -195,6 +195,18 @@ namespace OpenGLES3Renderer
 		return RENDERER_NEW(getRenderer().getContext(), FragmentShaderGlsl)(static_cast<OpenGLES3Renderer&>(getRenderer()), shaderSourceCode.sourceCode);
 	}
 
+	Renderer::IComputeShader* ShaderLanguageGlsl::createComputeShaderFromBytecode(const Renderer::ShaderBytecode&)
+	{
+		// Error! OpenGL ES 3 has no compute shader support.
+		return nullptr;
+	}
+
+	Renderer::IComputeShader* ShaderLanguageGlsl::createComputeShaderFromSourceCode(const Renderer::ShaderSourceCode&, Renderer::ShaderBytecode*)
+	{
+		// Error! OpenGL ES 3 has no compute shader support.
+		return nullptr;
+	}
+
 	Renderer::IProgram* ShaderLanguageGlsl::createProgram(const Renderer::IRootSignature& rootSignature, const Renderer::VertexAttributes& vertexAttributes, Renderer::IVertexShader* vertexShader, Renderer::ITessellationControlShader* tessellationControlShader, Renderer::ITessellationEvaluationShader* tessellationEvaluationShader, Renderer::IGeometryShader* geometryShader, Renderer::IFragmentShader* fragmentShader)
 	{
 		// A shader can be a null pointer, but if it's not the shader and program language must match!
@@ -76,6 +76,15 @@ namespace OpenGLRenderer
 		*/
 		inline uint32_t getOpenGLIndirectBuffer() const;
 
+		/**
+		*  @brief
+		*    Return the OpenGL texture buffer used as compute shader unordered access view
+		*
+		*  @return
+		*    The OpenGL texture buffer, zero if the indirect buffer wasn't created with "Renderer::IndirectBufferFlag::UNORDERED_ACCESS", do not destroy the returned resource (type "GLuint" not used in here in order to keep the header slim)
+		*/
+		inline uint32_t getOpenGLTexture() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IIndirectBuffer methods      ]
@@ -117,6 +126,7 @@ namespace OpenGLRenderer
 	//[-------------------------------------------------------]
 	protected:
 		uint32_t mOpenGLIndirectBuffer;	///< OpenGL indirect buffer, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim)
+		uint32_t mOpenGLTexture;		///< OpenGL texture buffer using the indirect buffer storage as "GL_R32UI", only created for "Renderer::IndirectBufferFlag::UNORDERED_ACCESS", can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim)
 
 
 	//[-------------------------------------------------------]
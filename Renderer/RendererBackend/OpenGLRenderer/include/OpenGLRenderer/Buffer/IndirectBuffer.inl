@@ -33,6 +33,11 @@ namespace OpenGLRenderer
 		return mOpenGLIndirectBuffer;
 	}
 
+	inline uint32_t IndirectBuffer::getOpenGLTexture() const
+	{
+		return mOpenGLTexture;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IIndirectBuffer methods      ]
@@ -66,8 +66,10 @@ namespace OpenGLRenderer
 		*    Indirect buffer data, can be a null pointer (empty buffer), the data is internally copied and you have to free your memory if you no longer need it
 		*  @param[in] bufferUsage
 		*    Indication of the buffer usage
+		*  @param[in] indirectBufferFlags
+		*    Indirect buffer flags, see "Renderer::IndirectBufferFlag"
 		*/
-		IndirectBufferBind(OpenGLRenderer& openGLRenderer, uint32_t numberOfBytes, const void* data = nullptr, Renderer::BufferUsage bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW);
+		IndirectBufferBind(OpenGLRenderer& openGLRenderer, uint32_t numberOfBytes, const void* data = nullptr, Renderer::BufferUsage bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW, uint32_t indirectBufferFlags = 0);
 
 		/**
 		*  @brief
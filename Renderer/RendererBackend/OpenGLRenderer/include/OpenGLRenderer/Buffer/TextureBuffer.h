@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/Buffer/ITextureBuffer.h>
+#include <Renderer/Texture/TextureTypes.h>
 
 
 //[-------------------------------------------------------]
@@ -85,6 +86,15 @@ namespace OpenGLRenderer
 		*/
 		inline uint32_t getOpenGLTexture() const;
 
+		/**
+		*  @brief
+		*    Return the OpenGL internal format
+		*
+		*  @return
+		*    The OpenGL internal format, e.g. required when binding the texture buffer as image for unordered access (type "GLenum" not used in here in order to keep the header slim)
+		*/
+		inline uint32_t getOpenGLInternalFormat() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResource methods            ]
@@ -110,8 +120,10 @@ namespace OpenGLRenderer
 		*
 		*  @param[in] openGLRenderer
 		*    Owner OpenGL renderer instance
+		*  @param[in] textureFormat
+		*    Texture buffer data format
 		*/
-		explicit TextureBuffer(OpenGLRenderer& openGLRenderer);
+		TextureBuffer(OpenGLRenderer& openGLRenderer, Renderer::TextureFormat::Enum textureFormat);
 
 
 	//[-------------------------------------------------------]
@@ -120,6 +132,7 @@ namespace OpenGLRenderer
 	protected:
 		uint32_t mOpenGLTextureBuffer;	///< OpenGL texture buffer, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim)
 		uint32_t mOpenGLTexture;		///< OpenGL texture, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim)
+		uint32_t mOpenGLInternalFormat;	///< OpenGL internal format (type "GLenum" not used in here in order to keep the header slim)
 
 
 	//[-------------------------------------------------------]
@@ -38,6 +38,11 @@ namespace OpenGLRenderer
 		return mOpenGLTexture;
 	}
 
+	inline uint32_t TextureBuffer::getOpenGLInternalFormat() const
+	{
+		return mOpenGLInternalFormat;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -169,6 +169,12 @@ namespace OpenGLRenderer
 		bool isGL_ARB_copy_image() const;
 		bool isGL_ARB_gl_spirv() const;
 		bool isGL_ARB_clip_control() const;
+		bool isGL_ARB_compute_shader() const;
+		bool isGL_ARB_shader_image_load_store() const;
+		bool isGL_ARB_occlusion_query() const;
+		bool isGL_ARB_timer_query() const;
+		bool isGL_ARB_pipeline_statistics_query() const;
+		bool isGL_ARB_indirect_parameters() const;
 
 
 	//[-------------------------------------------------------]
@@ -289,6 +295,12 @@ namespace OpenGLRenderer
 		bool mGL_ARB_copy_image;
 		bool mGL_ARB_gl_spirv;
 		bool mGL_ARB_clip_control;
+		bool mGL_ARB_compute_shader;
+		bool mGL_ARB_shader_image_load_store;
+		bool mGL_ARB_occlusion_query;
+		bool mGL_ARB_timer_query;
+		bool mGL_ARB_pipeline_statistics_query;
+		bool mGL_ARB_indirect_parameters;
 
 
 	};
@@ -561,6 +573,27 @@ namespace OpenGLRenderer
 	// GL_ARB_clip_control
 	FNDEF_EX(glClipControl,	PFNGLCLIPCONTROLPROC);
 
+	// GL_ARB_compute_shader
+	FNDEF_EX(glDispatchCompute,	PFNGLDISPATCHCOMPUTEPROC);
+
+	// GL_ARB_shader_image_load_store
+	FNDEF_EX(glBindImageTexture,	PFNGLBINDIMAGETEXTUREPROC);
+	FNDEF_EX(glMemoryBarrier,		PFNGLMEMORYBARRIERPROC);
+
+	// GL_ARB_occlusion_query
+	FNDEF_EX(glGenQueriesARB,			PFNGLGENQUERIESARBPROC);
+	FNDEF_EX(glDeleteQueriesARB,		PFNGLDELETEQUERIESARBPROC);
+	FNDEF_EX(glBeginQueryARB,			PFNGLBEGINQUERYARBPROC);
+	FNDEF_EX(glEndQueryARB,			PFNGLENDQUERYARBPROC);
+	FNDEF_EX(glGetQueryObjectuivARB,	PFNGLGETQUERYOBJECTUIVARBPROC);
+
+	// GL_ARB_timer_query
+	FNDEF_EX(glQueryCounter,			PFNGLQUERYCOUNTERPROC);
+	FNDEF_EX(glGetQueryObjectui64v,	PFNGLGETQUERYOBJECTUI64VPROC);
+
+	// GL_ARB_indirect_parameters
+	FNDEF_EX(glMultiDrawElementsIndirectCountARB,	PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC);
+
 
 	//[-------------------------------------------------------]
 	//[ Core (OpenGL version dependent)                       ]
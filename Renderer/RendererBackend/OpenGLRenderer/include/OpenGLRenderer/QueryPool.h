@@ -0,0 +1,164 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/RendererTypes.h>
+#include <Renderer/IQueryPool.h>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+	class OpenGLRenderer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    OpenGL asynchronous query pool class
+	*
+	*  @remarks
+	*    OpenGL has no query pool concept, so this class holds one OpenGL query object per query. Resetting queries is not required by OpenGL.
+	*    OpenGL has one query target per pipeline statistics counter, so there are "NUMBER_OF_PIPELINE_STATISTICS" OpenGL query objects per
+	*    pipeline statistics query, ordered like the members of "Renderer::PipelineStatisticsQueryResult".
+	*/
+	class QueryPool final : public Renderer::IQueryPool
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const uint32_t NUMBER_OF_PIPELINE_STATISTICS = sizeof(Renderer::PipelineStatisticsQueryResult) / sizeof(uint64_t);	///< Number of OpenGL queries per pipeline statistics query
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance
+		*  @param[in] queryType
+		*    Query type
+		*  @param[in] numberOfQueries
+		*    Number of queries
+		*
+		*  @note
+		*    - "GL_ARB_occlusion_query" and depending on the query type "GL_ARB_timer_query" or "GL_ARB_pipeline_statistics_query" must be supported
+		*/
+		QueryPool(OpenGLRenderer& openGLRenderer, Renderer::QueryType queryType, uint32_t numberOfQueries);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~QueryPool() override;
+
+		/**
+		*  @brief
+		*    Return the query type
+		*
+		*  @return
+		*    The query type
+		*/
+		inline Renderer::QueryType getQueryType() const;
+
+		/**
+		*  @brief
+		*    Return the number of queries
+		*
+		*  @return
+		*    The number of queries
+		*/
+		inline uint32_t getNumberOfQueries() const;
+
+		/**
+		*  @brief
+		*    Return the OpenGL queries
+		*
+		*  @return
+		*    The OpenGL queries, there are "getNumberOfQueries()" OpenGL queries respectively "getNumberOfQueries() * NUMBER_OF_PIPELINE_STATISTICS" for pipeline statistics, do not destroy the returned resources (type "GLuint" not used in here in order to keep the header slim)
+		*/
+		inline const uint32_t* getOpenGLQueries() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::RefCount methods          ]
+	//[-------------------------------------------------------]
+	protected:
+		virtual void selfDestruct() override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit QueryPool(const QueryPool& source) = delete;
+		QueryPool& operator =(const QueryPool& source) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Renderer::QueryType mQueryType;
+		uint32_t			mNumberOfQueries;
+		uint32_t			mNumberOfOpenGLQueries;	///< Number of OpenGL queries, "mNumberOfQueries" respectively "mNumberOfQueries * NUMBER_OF_PIPELINE_STATISTICS" for pipeline statistics
+		uint32_t*			mOpenGLQueries;			///< OpenGL queries, there are "mNumberOfOpenGLQueries" OpenGL queries (type "GLuint" not used in here in order to keep the header slim)
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "OpenGLRenderer/QueryPool.inl"
@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/Texture/ITexture2D.h>
+#include <Renderer/Texture/TextureTypes.h>
 
 
 //[-------------------------------------------------------]
@@ -85,6 +86,15 @@ namespace OpenGLRenderer
 		*/
 		inline uint32_t getOpenGLTexture() const;
 
+		/**
+		*  @brief
+		*    Return the OpenGL internal format
+		*
+		*  @return
+		*    The OpenGL internal format, e.g. required when binding the texture as image for unordered access (type "GLenum" not used in here in order to keep the header slim)
+		*/
+		inline uint32_t getOpenGLInternalFormat() const;
+
 		/**
 		*  @brief
 		*    Return whether or not mipmaps should be generated automatically
@@ -124,10 +134,12 @@ namespace OpenGLRenderer
 		*    The width of the texture
 		*  @param[in] height
 		*    The height of the texture
+		*  @param[in] textureFormat
+		*    Texture format
 		*  @param[in] numberOfMultisamples
 		*    The number of multisamples per pixel (valid values: 1, 2, 4, 8)
 		*/
-		Texture2D(OpenGLRenderer& openGLRenderer, uint32_t width, uint32_t height, uint8_t numberOfMultisamples);
+		Texture2D(OpenGLRenderer& openGLRenderer, uint32_t width, uint32_t height, Renderer::TextureFormat::Enum textureFormat, uint8_t numberOfMultisamples);
 
 
 	//[-------------------------------------------------------]
@@ -136,6 +148,7 @@ namespace OpenGLRenderer
 	protected:
 		uint8_t  mNumberOfMultisamples;	///< The number of multisamples per pixel (valid values: 1, 2, 4, 8)
 		uint32_t mOpenGLTexture;		///< OpenGL texture, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim)
+		uint32_t mOpenGLInternalFormat;	///< OpenGL internal format (type "GLenum" not used in here in order to keep the header slim)
 		bool	 mGenerateMipmaps;
 
 
@@ -38,6 +38,11 @@ namespace OpenGLRenderer
 		return mOpenGLTexture;
 	}
 
+	inline uint32_t Texture2D::getOpenGLInternalFormat() const
+	{
+		return mOpenGLInternalFormat;
+	}
+
 	inline bool Texture2D::getGenerateMipmaps() const
 	{
 		return mGenerateMipmaps;
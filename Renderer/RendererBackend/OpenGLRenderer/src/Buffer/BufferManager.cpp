@@ -187,7 +187,7 @@ namespace OpenGLRenderer
 		}
 	}
 
-	Renderer::IIndirectBuffer* BufferManager::createIndirectBuffer(uint32_t numberOfBytes, const void* data, Renderer::BufferUsage bufferUsage)
+	Renderer::IIndirectBuffer* BufferManager::createIndirectBuffer(uint32_t numberOfBytes, const void* data, Renderer::BufferUsage bufferUsage, uint32_t indirectBufferFlags)
 	{
 		// "GL_ARB_draw_indirect" required
 		if (mExtensions->isGL_ARB_draw_indirect())
@@ -196,12 +196,12 @@ namespace OpenGLRenderer
 			if (mExtensions->isGL_EXT_direct_state_access() || mExtensions->isGL_ARB_direct_state_access())
 			{
 				// Effective direct state access (DSA)
-				return RENDERER_NEW(getRenderer().getContext(), IndirectBufferDsa)(static_cast<OpenGLRenderer&>(getRenderer()), numberOfBytes, data, bufferUsage);
+				return RENDERER_NEW(getRenderer().getContext(), IndirectBufferDsa)(static_cast<OpenGLRenderer&>(getRenderer()), numberOfBytes, data, bufferUsage, indirectBufferFlags);
 			}
 			else
 			{
 				// Traditional bind version
-				return RENDERER_NEW(getRenderer().getContext(), IndirectBufferBind)(static_cast<OpenGLRenderer&>(getRenderer()), numberOfBytes, data, bufferUsage);
+				return RENDERER_NEW(getRenderer().getContext(), IndirectBufferBind)(static_cast<OpenGLRenderer&>(getRenderer()), numberOfBytes, data, bufferUsage, indirectBufferFlags);
 			}
 		}
 		else
@@ -41,6 +41,10 @@ namespace OpenGLRenderer
 	//[-------------------------------------------------------]
 	IndirectBuffer::~IndirectBuffer()
 	{
+		// Destroy the OpenGL texture buffer instance
+		// -> Silently ignores 0's and names that do not correspond to existing textures
+		glDeleteTextures(1, &mOpenGLTexture);
+
 		// Destroy the OpenGL indirect buffer
 		// -> Silently ignores 0's and names that do not correspond to existing buffer objects
 		glDeleteBuffersARB(1, &mOpenGLIndirectBuffer);
@@ -81,7 +85,8 @@ namespace OpenGLRenderer
 	//[-------------------------------------------------------]
 	IndirectBuffer::IndirectBuffer(OpenGLRenderer& openGLRenderer) :
 		IIndirectBuffer(static_cast<Renderer::IRenderer&>(openGLRenderer)),
-		mOpenGLIndirectBuffer(0)
+		mOpenGLIndirectBuffer(0),
+		mOpenGLTexture(0)
 	{
 		// Nothing here
 	}
@@ -22,6 +22,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "OpenGLRenderer/Buffer/IndirectBufferBind.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
 #include "OpenGLRenderer/Extensions.h"
 #include "OpenGLRenderer/OpenGLRuntimeLinking.h"
 
@@ -39,7 +40,7 @@ namespace OpenGLRenderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	IndirectBufferBind::IndirectBufferBind(OpenGLRenderer& openGLRenderer, uint32_t numberOfBytes, const void* data, Renderer::BufferUsage bufferUsage) :
+	IndirectBufferBind::IndirectBufferBind(OpenGLRenderer& openGLRenderer, uint32_t numberOfBytes, const void* data, Renderer::BufferUsage bufferUsage, uint32_t indirectBufferFlags) :
 		IndirectBuffer(openGLRenderer)
 	{
 		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
@@ -60,6 +61,28 @@ namespace OpenGLRenderer
 			// Be polite and restore the previous bound OpenGL indirect buffer
 			glBindBufferARB(GL_DRAW_INDIRECT_BUFFER, static_cast<GLuint>(openGLIndirectBufferBackup));
 		#endif
+
+		// Create the OpenGL texture buffer which is used as compute shader unordered access view
+		if (indirectBufferFlags & Renderer::IndirectBufferFlag::UNORDERED_ACCESS)
+		{
+			RENDERER_ASSERT(openGLRenderer.getContext(), openGLRenderer.getCapabilities().drawIndirectCount, "OpenGL unordered access indirect buffers need draw indirect count support")
+
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Backup the currently bound OpenGL texture
+				GLint openGLTextureBackup = 0;
+				glGetIntegerv(GL_TEXTURE_BINDING_BUFFER_ARB, &openGLTextureBackup);
+			#endif
+
+			// Create the OpenGL texture instance and attach the storage of the indirect buffer to it
+			glGenTextures(1, &mOpenGLTexture);
+			glBindTexture(GL_TEXTURE_BUFFER_ARB, mOpenGLTexture);
+			glTexBufferARB(GL_TEXTURE_BUFFER_ARB, GL_R32UI, mOpenGLIndirectBuffer);
+
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Be polite and restore the previous bound OpenGL texture
+				glBindTexture(GL_TEXTURE_BUFFER_ARB, static_cast<GLuint>(openGLTextureBackup));
+			#endif
+		}
 	}
 
 	IndirectBufferBind::~IndirectBufferBind()
@@ -39,7 +39,7 @@ namespace OpenGLRenderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	IndirectBufferDsa::IndirectBufferDsa(OpenGLRenderer& openGLRenderer, uint32_t numberOfBytes, const void* data, Renderer::BufferUsage bufferUsage) :
+	IndirectBufferDsa::IndirectBufferDsa(OpenGLRenderer& openGLRenderer, uint32_t numberOfBytes, const void* data, Renderer::BufferUsage bufferUsage, uint32_t indirectBufferFlags) :
 		IndirectBuffer(openGLRenderer)
 	{
 		if (openGLRenderer.getExtensions().isGL_ARB_direct_state_access())
@@ -60,6 +60,37 @@ namespace OpenGLRenderer
 			// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
 			glNamedBufferDataEXT(mOpenGLIndirectBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
 		}
+
+		// Create the OpenGL texture buffer which is used as compute shader unordered access view
+		if (indirectBufferFlags & Renderer::IndirectBufferFlag::UNORDERED_ACCESS)
+		{
+			RENDERER_ASSERT(openGLRenderer.getContext(), openGLRenderer.getCapabilities().drawIndirectCount, "OpenGL unordered access indirect buffers need draw indirect count support")
+			if (openGLRenderer.getExtensions().isGL_ARB_direct_state_access())
+			{
+				// Create the OpenGL texture instance and attach the storage of the indirect buffer to it
+				glCreateTextures(GL_TEXTURE_BUFFER_ARB, 1, &mOpenGLTexture);
+				glTextureBuffer(mOpenGLTexture, GL_R32UI, mOpenGLIndirectBuffer);
+			}
+			else
+			{
+				#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+					// Backup the currently bound OpenGL texture
+					GLint openGLTextureBackup = 0;
+					glGetIntegerv(GL_TEXTURE_BINDING_BUFFER_ARB, &openGLTextureBackup);
+				#endif
+
+				// Create the OpenGL texture instance and attach the storage of the indirect buffer to it
+				// -> Sadly, there's no direct state access (DSA) function defined for this in "GL_EXT_direct_state_access"
+				glGenTextures(1, &mOpenGLTexture);
+				glBindTexture(GL_TEXTURE_BUFFER_ARB, mOpenGLTexture);
+				glTexBufferARB(GL_TEXTURE_BUFFER_ARB, GL_R32UI, mOpenGLIndirectBuffer);
+
+				#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+					// Be polite and restore the previous bound OpenGL texture
+					glBindTexture(GL_TEXTURE_BUFFER_ARB, static_cast<GLuint>(openGLTextureBackup));
+				#endif
+			}
+		}
 	}
 
 	IndirectBufferDsa::~IndirectBufferDsa()
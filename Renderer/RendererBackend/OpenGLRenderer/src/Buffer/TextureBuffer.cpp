@@ -25,6 +25,7 @@
 #include "OpenGLRenderer/OpenGLRuntimeLinking.h"
 #include "OpenGLRenderer/OpenGLRenderer.h"
 #include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/Mapping.h"
 
 #include <Renderer/IRenderer.h>
 #include <Renderer/IAllocator.h>
@@ -91,10 +92,11 @@ namespace OpenGLRenderer
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
-	TextureBuffer::TextureBuffer(OpenGLRenderer& openGLRenderer) :
+	TextureBuffer::TextureBuffer(OpenGLRenderer& openGLRenderer, Renderer::TextureFormat::Enum textureFormat) :
 		ITextureBuffer(static_cast<Renderer::IRenderer&>(openGLRenderer)),
 		mOpenGLTextureBuffer(0),
-		mOpenGLTexture(0)
+		mOpenGLTexture(0),
+		mOpenGLInternalFormat(Mapping::getOpenGLInternalFormat(textureFormat))
 	{
 		// Nothing here
 	}
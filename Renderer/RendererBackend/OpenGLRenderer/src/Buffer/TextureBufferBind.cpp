@@ -41,7 +41,7 @@ namespace OpenGLRenderer
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	TextureBufferBind::TextureBufferBind(OpenGLRenderer& openGLRenderer, uint32_t numberOfBytes, Renderer::TextureFormat::Enum textureFormat, const void* data, Renderer::BufferUsage bufferUsage) :
-		TextureBuffer(openGLRenderer)
+		TextureBuffer(openGLRenderer, textureFormat)
 	{
 		{ // Buffer part
 			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
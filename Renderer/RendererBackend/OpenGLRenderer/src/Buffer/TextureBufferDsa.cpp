@@ -41,7 +41,7 @@ namespace OpenGLRenderer
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	TextureBufferDsa::TextureBufferDsa(OpenGLRenderer& openGLRenderer, uint32_t numberOfBytes, Renderer::TextureFormat::Enum textureFormat, const void* data, Renderer::BufferUsage bufferUsage) :
-		TextureBuffer(openGLRenderer)
+		TextureBuffer(openGLRenderer, textureFormat)
 	{
 		if (openGLRenderer.getExtensions().isGL_ARB_direct_state_access())
 		{
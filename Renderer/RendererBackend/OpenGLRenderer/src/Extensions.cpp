@@ -112,6 +112,12 @@ namespace OpenGLRenderer
 	bool Extensions::isGL_ARB_copy_image()					const { return mGL_ARB_copy_image;					}
 	bool Extensions::isGL_ARB_gl_spirv()					const { return mGL_ARB_gl_spirv;					}
 	bool Extensions::isGL_ARB_clip_control()				const { return mGL_ARB_clip_control;				}
+	bool Extensions::isGL_ARB_compute_shader()				const { return mGL_ARB_compute_shader;				}
+	bool Extensions::isGL_ARB_shader_image_load_store()		const { return mGL_ARB_shader_image_load_store;		}
+	bool Extensions::isGL_ARB_occlusion_query()				const { return mGL_ARB_occlusion_query;				}
+	bool Extensions::isGL_ARB_timer_query()					const { return mGL_ARB_timer_query;					}
+	bool Extensions::isGL_ARB_pipeline_statistics_query()	const { return mGL_ARB_pipeline_statistics_query;	}
+	bool Extensions::isGL_ARB_indirect_parameters()			const { return mGL_ARB_indirect_parameters;			}
 
 
 	//[-------------------------------------------------------]
@@ -286,6 +292,12 @@ namespace OpenGLRenderer
 		mGL_ARB_copy_image					= false;
 		mGL_ARB_gl_spirv					= false;
 		mGL_ARB_clip_control				= false;
+		mGL_ARB_compute_shader				= false;
+		mGL_ARB_shader_image_load_store		= false;
+		mGL_ARB_occlusion_query				= false;
+		mGL_ARB_timer_query					= false;
+		mGL_ARB_pipeline_statistics_query	= false;
+		mGL_ARB_indirect_parameters			= false;
 	}
 
 	bool Extensions::initializeUniversal()
@@ -846,6 +858,65 @@ namespace OpenGLRenderer
 			mGL_ARB_clip_control = result;
 		}
 
+		// GL_ARB_compute_shader - Is core since OpenGL 4.3
+		mGL_ARB_compute_shader = isSupported("GL_ARB_compute_shader");
+		if (mGL_ARB_compute_shader)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glDispatchCompute)
+			mGL_ARB_compute_shader = result;
+		}
+
+		// GL_ARB_shader_image_load_store - Is core since OpenGL 4.2
+		mGL_ARB_shader_image_load_store = isSupported("GL_ARB_shader_image_load_store");
+		if (mGL_ARB_shader_image_load_store)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glBindImageTexture)
+			IMPORT_FUNC(glMemoryBarrier)
+			mGL_ARB_shader_image_load_store = result;
+		}
+
+		// GL_ARB_occlusion_query
+		mGL_ARB_occlusion_query = isCoreProfile ? true : isSupported("GL_ARB_occlusion_query");	// Is core feature since OpenGL 1.5
+		if (mGL_ARB_occlusion_query)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glGenQueriesARB)
+			IMPORT_FUNC(glDeleteQueriesARB)
+			IMPORT_FUNC(glBeginQueryARB)
+			IMPORT_FUNC(glEndQueryARB)
+			IMPORT_FUNC(glGetQueryObjectuivARB)
+			mGL_ARB_occlusion_query = result;
+		}
+
+		// GL_ARB_timer_query - Is core since OpenGL 3.3
+		mGL_ARB_timer_query = isSupported("GL_ARB_timer_query");
+		if (mGL_ARB_timer_query)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glQueryCounter)
+			IMPORT_FUNC(glGetQueryObjectui64v)
+			mGL_ARB_timer_query = result;
+		}
+
+		// GL_ARB_pipeline_statistics_query - Is core since OpenGL 4.6, uses the "GL_ARB_occlusion_query" entry points
+		mGL_ARB_pipeline_statistics_query = isSupported("GL_ARB_pipeline_statistics_query");
+
+		// GL_ARB_indirect_parameters - Is core since OpenGL 4.6
+		mGL_ARB_indirect_parameters = isSupported("GL_ARB_indirect_parameters");
+		if (mGL_ARB_indirect_parameters)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glMultiDrawElementsIndirectCountARB)
+			mGL_ARB_indirect_parameters = result;
+		}
+
 
 		//[-------------------------------------------------------]
 		//[ Core (OpenGL version dependent)                       ]
@@ -27,6 +27,7 @@
 #include "OpenGLRenderer/Extensions.h"
 #include "OpenGLRenderer/RootSignature.h"
 #include "OpenGLRenderer/ResourceGroup.h"
+#include "OpenGLRenderer/QueryPool.h"
 #include "OpenGLRenderer/OpenGLRuntimeLinking.h"
 #include "OpenGLRenderer/RenderTarget/SwapChain.h"
 #include "OpenGLRenderer/RenderTarget/RenderPass.h"
@@ -54,11 +55,13 @@
 #include "OpenGLRenderer/State/SamplerStateDsa.h"
 #include "OpenGLRenderer/State/SamplerStateBind.h"
 #include "OpenGLRenderer/State/PipelineState.h"
+#include "OpenGLRenderer/State/ComputePipelineState.h"
 #include "OpenGLRenderer/Shader/Monolithic/ShaderLanguageMonolithic.h"
 #include "OpenGLRenderer/Shader/Monolithic/ProgramMonolithic.h"
 #include "OpenGLRenderer/Shader/Separate/ShaderLanguageSeparate.h"
 #include "OpenGLRenderer/Shader/Separate/ProgramSeparate.h"
 #include "OpenGLRenderer/Shader/Separate/VertexShaderSeparate.h"
+#include "OpenGLRenderer/Shader/Separate/ComputeShaderSeparate.h"
 
 #ifdef WIN32
 	#include "OpenGLRenderer/Windows/OpenGLContextWindows.h"
@@ -227,6 +230,21 @@ namespace
 				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).setGraphicsResourceGroup(realData->rootParameterIndex, realData->resourceGroup);
 			}
 
+			//[-------------------------------------------------------]
+			//[ Compute root                                          ]
+			//[-------------------------------------------------------]
+			void SetComputeRootSignature(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::SetComputeRootSignature* realData = static_cast<const Renderer::Command::SetComputeRootSignature*>(data);
+				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).setComputeRootSignature(realData->rootSignature);
+			}
+
+			void SetComputeResourceGroup(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::SetComputeResourceGroup* realData = static_cast<const Renderer::Command::SetComputeResourceGroup*>(data);
+				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).setComputeResourceGroup(realData->rootParameterIndex, realData->resourceGroup);
+			}
+
 			//[-------------------------------------------------------]
 			//[ States                                                ]
 			//[-------------------------------------------------------]
@@ -236,6 +254,12 @@ namespace
 				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).setPipelineState(realData->pipelineState);
 			}
 
+			void SetComputePipelineState(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::SetComputePipelineState* realData = static_cast<const Renderer::Command::SetComputePipelineState*>(data);
+				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).setComputePipelineState(realData->computePipelineState);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Input-assembler (IA) stage                            ]
 			//[-------------------------------------------------------]
@@ -319,6 +343,48 @@ namespace
 				}
 			}
 
+			void DrawIndexedIndirectCount(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::DrawIndexedIndirectCount* realData = static_cast<const Renderer::Command::DrawIndexedIndirectCount*>(data);
+				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).drawIndexedIndirectCount(*realData->indirectBuffer, realData->indirectBufferOffset, *realData->countBuffer, realData->countBufferOffset, realData->maximumNumberOfDraws);
+			}
+
+			//[-------------------------------------------------------]
+			//[ Compute                                               ]
+			//[-------------------------------------------------------]
+			void DispatchCompute(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::DispatchCompute* realData = static_cast<const Renderer::Command::DispatchCompute*>(data);
+				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).dispatchCompute(realData->groupCountX, realData->groupCountY, realData->groupCountZ);
+			}
+
+			//[-------------------------------------------------------]
+			//[ Query                                                 ]
+			//[-------------------------------------------------------]
+			void ResetQueryPool(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::ResetQueryPool* realData = static_cast<const Renderer::Command::ResetQueryPool*>(data);
+				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).resetQueryPool(*realData->queryPool, realData->firstQueryIndex, realData->numberOfQueries);
+			}
+
+			void BeginQuery(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::BeginQuery* realData = static_cast<const Renderer::Command::BeginQuery*>(data);
+				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).beginQuery(*realData->queryPool, realData->queryIndex);
+			}
+
+			void EndQuery(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::EndQuery* realData = static_cast<const Renderer::Command::EndQuery*>(data);
+				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).endQuery(*realData->queryPool, realData->queryIndex);
+			}
+
+			void WriteTimestampQuery(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::WriteTimestampQuery* realData = static_cast<const Renderer::Command::WriteTimestampQuery*>(data);
+				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).writeTimestampQuery(*realData->queryPool, realData->queryIndex);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Debug                                                 ]
 			//[-------------------------------------------------------]
@@ -370,8 +436,12 @@ namespace
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsResourceGroup,
+			// Compute root
+			&BackendDispatch::SetComputeRootSignature,
+			&BackendDispatch::SetComputeResourceGroup,
 			// States
 			&BackendDispatch::SetPipelineState,
+			&BackendDispatch::SetComputePipelineState,
 			// Input-assembler (IA) stage
 			&BackendDispatch::SetVertexArray,
 			// Rasterizer (RS) stage
@@ -386,12 +456,36 @@ namespace
 			// Draw call
 			&BackendDispatch::Draw,
 			&BackendDispatch::DrawIndexed,
+			&BackendDispatch::DrawIndexedIndirectCount,
+			// Compute
+			&BackendDispatch::DispatchCompute,
+			// Query
+			&BackendDispatch::ResetQueryPool,
+			&BackendDispatch::BeginQuery,
+			&BackendDispatch::EndQuery,
+			&BackendDispatch::WriteTimestampQuery,
 			// Debug
 			&BackendDispatch::SetDebugMarker,
 			&BackendDispatch::BeginDebugEvent,
 			&BackendDispatch::EndDebugEvent
 		};
 
+		// OpenGL query targets of the pipeline statistics counters, "GL_ARB_pipeline_statistics_query" required, same order as the members of "Renderer::PipelineStatisticsQueryResult"
+		static const GLenum PIPELINE_STATISTICS_OPENGL_QUERY_TARGETS[OpenGLRenderer::QueryPool::NUMBER_OF_PIPELINE_STATISTICS] =
+		{
+			GL_VERTICES_SUBMITTED_ARB,
+			GL_PRIMITIVES_SUBMITTED_ARB,
+			GL_VERTEX_SHADER_INVOCATIONS_ARB,
+			GL_GEOMETRY_SHADER_INVOCATIONS,
+			GL_GEOMETRY_SHADER_PRIMITIVES_EMITTED_ARB,
+			GL_CLIPPING_INPUT_PRIMITIVES_ARB,
+			GL_CLIPPING_OUTPUT_PRIMITIVES_ARB,
+			GL_FRAGMENT_SHADER_INVOCATIONS_ARB,
+			GL_TESS_CONTROL_SHADER_PATCHES_ARB,
+			GL_TESS_EVALUATION_SHADER_INVOCATIONS_ARB,
+			GL_COMPUTE_SHADER_INVOCATIONS_ARB
+		};
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -417,11 +511,13 @@ namespace OpenGLRenderer
 		mExtensions(nullptr),
 		mShaderLanguage(nullptr),
 		mGraphicsRootSignature(nullptr),
+		mComputeRootSignature(nullptr),
 		mDefaultSamplerState(nullptr),
 		mOpenGLCopyResourceFramebuffer(0),
 		mDefaultOpenGLVertexArray(0),
 		// States
 		mPipelineState(nullptr),
+		mComputePipelineState(nullptr),
 		// Input-assembler (IA) stage
 		mVertexArray(nullptr),
 		mOpenGLPrimitiveTopology(0xFFFF),	// Unknown default setting
@@ -512,6 +608,12 @@ namespace OpenGLRenderer
 			setPipelineState(nullptr);
 		}
 
+		// Set no compute pipeline state reference, in case we have one
+		if (nullptr != mComputePipelineState)
+		{
+			setComputePipelineState(nullptr);
+		}
+
 		// Set no vertex array reference, in case we have one
 		if (nullptr != mVertexArray)
 		{
@@ -544,6 +646,12 @@ namespace OpenGLRenderer
 			mGraphicsRootSignature->releaseReference();
 		}
 
+		// Release the compute root signature instance, in case we have one
+		if (nullptr != mComputeRootSignature)
+		{
+			mComputeRootSignature->releaseReference();
+		}
+
 		#ifndef RENDERER_NO_STATISTICS
 		{ // For debugging: At this point there should be no resource instances left, validate this!
 			// -> Are the currently any resource instances?
@@ -606,741 +714,448 @@ namespace OpenGLRenderer
 	{
 		// Security checks
 		#ifdef RENDERER_DEBUG
-		{
 			if (nullptr == mGraphicsRootSignature)
 			{
 				RENDERER_LOG(mContext, CRITICAL, "No OpenGL renderer backend graphics root signature set")
 				return;
 			}
-			const Renderer::RootSignature& rootSignature = mGraphicsRootSignature->getRootSignature();
-			if (rootParameterIndex >= rootSignature.numberOfParameters)
+		#endif
+
+		// Set graphics resource group
+		setResourceGroup(*mGraphicsRootSignature, rootParameterIndex, resourceGroup);
+	}
+
+	void OpenGLRenderer::setComputeRootSignature(Renderer::IRootSignature* rootSignature)
+	{
+		if (nullptr != mComputeRootSignature)
+		{
+			mComputeRootSignature->releaseReference();
+		}
+		mComputeRootSignature = static_cast<RootSignature*>(rootSignature);
+		if (nullptr != mComputeRootSignature)
+		{
+			mComputeRootSignature->addReference();
+
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *rootSignature)
+		}
+	}
+
+	void OpenGLRenderer::setComputeResourceGroup(uint32_t rootParameterIndex, Renderer::IResourceGroup* resourceGroup)
+	{
+		// Security checks
+		#ifdef RENDERER_DEBUG
+			if (nullptr == mComputeRootSignature)
 			{
-				RENDERER_LOG(mContext, CRITICAL, "The OpenGL renderer backend root parameter index is out of bounds")
+				RENDERER_LOG(mContext, CRITICAL, "No OpenGL renderer backend compute root signature set")
 				return;
 			}
-			const Renderer::RootParameter& rootParameter = rootSignature.parameters[rootParameterIndex];
-			if (Renderer::RootParameterType::DESCRIPTOR_TABLE != rootParameter.parameterType)
+		#endif
+
+		// Set compute resource group
+		// -> In OpenGL, graphics and compute share the same binding points
+		setResourceGroup(*mComputeRootSignature, rootParameterIndex, resourceGroup);
+	}
+
+	void OpenGLRenderer::setPipelineState(Renderer::IPipelineState* pipelineState)
+	{
+		if (mPipelineState != pipelineState)
+		{
+			if (nullptr != pipelineState)
 			{
-				RENDERER_LOG(mContext, CRITICAL, "The OpenGL renderer backend root parameter index doesn't reference a descriptor table")
-				return;
+				// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+				OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *pipelineState)
+
+				// Set new pipeline state and add a reference to it
+				if (nullptr != mPipelineState)
+				{
+					mPipelineState->releaseReference();
+				}
+				mPipelineState = static_cast<PipelineState*>(pipelineState);
+				mPipelineState->addReference();
+
+				// Set OpenGL primitive topology
+				mOpenGLPrimitiveTopology = mPipelineState->getOpenGLPrimitiveTopology();
+				const int newNumberOfVerticesPerPatch = mPipelineState->getNumberOfVerticesPerPatch();
+				if (0 != newNumberOfVerticesPerPatch && mNumberOfVerticesPerPatch != newNumberOfVerticesPerPatch)
+				{
+					mNumberOfVerticesPerPatch = newNumberOfVerticesPerPatch;
+					glPatchParameteri(GL_PATCH_VERTICES, mNumberOfVerticesPerPatch);
+				}
+
+				// Set pipeline state
+				mPipelineState->bindPipelineState();
 			}
-			if (nullptr == reinterpret_cast<const Renderer::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges))
+			else if (nullptr != mPipelineState)
 			{
-				RENDERER_LOG(mContext, CRITICAL, "The OpenGL renderer backend descriptor ranges is a null pointer")
-				return;
+				// TODO(co) Handle this situation by resetting OpenGL states?
+				mPipelineState->releaseReference();
+				mPipelineState = nullptr;
 			}
 		}
-		#endif
+	}
 
-		if (nullptr != resourceGroup)
+	void OpenGLRenderer::setComputePipelineState(Renderer::IComputePipelineState* computePipelineState)
+	{
+		if (mComputePipelineState != computePipelineState)
 		{
-			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
-			OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *resourceGroup)
+			if (nullptr != computePipelineState)
+			{
+				// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+				OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *computePipelineState)
 
-			// Set graphics resource group
-			const ResourceGroup* openGLResourceGroup = static_cast<ResourceGroup*>(resourceGroup);
-			const uint32_t numberOfResources = openGLResourceGroup->getNumberOfResources();
-			Renderer::IResource** resources = openGLResourceGroup->getResources();
-			const Renderer::RootParameter& rootParameter = mGraphicsRootSignature->getRootSignature().parameters[rootParameterIndex];
-			for (uint32_t resourceIndex = 0; resourceIndex < numberOfResources; ++resourceIndex, ++resources)
+				// Set new compute pipeline state and add a reference to it
+				if (nullptr != mComputePipelineState)
+				{
+					mComputePipelineState->releaseReference();
+				}
+				mComputePipelineState = static_cast<ComputePipelineState*>(computePipelineState);
+				mComputePipelineState->addReference();
+			}
+			else if (nullptr != mComputePipelineState)
 			{
-				Renderer::IResource* resource = *resources;
-				RENDERER_ASSERT(mContext, nullptr != reinterpret_cast<const Renderer::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges), "Invalid OpenGL descriptor ranges")
-				const Renderer::DescriptorRange& descriptorRange = reinterpret_cast<const Renderer::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges)[resourceIndex];
+				mComputePipelineState->releaseReference();
+				mComputePipelineState = nullptr;
+			}
+		}
+	}
 
-				// Check the type of resource to set
-				// TODO(co) Some additional resource type root signature security checks in debug build?
-				const Renderer::ResourceType resourceType = resource->getResourceType();
-				switch (resourceType)
+
+	//[-------------------------------------------------------]
+	//[ Input-assembler (IA) stage                            ]
+	//[-------------------------------------------------------]
+	void OpenGLRenderer::iaSetVertexArray(Renderer::IVertexArray* vertexArray)
+	{
+		// New vertex array?
+		if (mVertexArray != vertexArray)
+		{
+			// Set a vertex array?
+			if (nullptr != vertexArray)
+			{
+				// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+				OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *vertexArray)
+
+				// Unset the currently used vertex array
+				iaUnsetVertexArray();
+
+				// Set new vertex array and add a reference to it
+				mVertexArray = static_cast<VertexArray*>(vertexArray);
+				mVertexArray->addReference();
+
+				// Evaluate the internal array type of the new vertex array to set
+				switch (static_cast<VertexArray*>(mVertexArray)->getInternalResourceType())
 				{
-					case Renderer::ResourceType::UNIFORM_BUFFER:
-						// "GL_ARB_uniform_buffer_object" required
-						if (mExtensions->isGL_ARB_uniform_buffer_object())
-						{
-							// Attach the buffer to the given UBO binding point
-							// -> Explicit binding points ("layout(binding = 0)" in GLSL shader) requires OpenGL 4.2 or the "GL_ARB_explicit_uniform_location"-extension
-							// -> Direct3D 10 and Direct3D 11 have explicit binding points
-							RENDERER_ASSERT(mContext, nullptr != openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex(), "Invalid OpenGL resource index to uniform block binding index")
-							glBindBufferBase(GL_UNIFORM_BUFFER, openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex()[resourceIndex], static_cast<UniformBuffer*>(resource)->getOpenGLUniformBuffer());
-						}
+					case VertexArray::InternalResourceType::NO_VAO:
+						// Enable OpenGL vertex attribute arrays
+						static_cast<VertexArrayNoVao*>(mVertexArray)->enableOpenGLVertexAttribArrays();
 						break;
 
-					case Renderer::ResourceType::TEXTURE_BUFFER:
-					case Renderer::ResourceType::TEXTURE_1D:
-					case Renderer::ResourceType::TEXTURE_2D:
-					case Renderer::ResourceType::TEXTURE_2D_ARRAY:
-					case Renderer::ResourceType::TEXTURE_3D:
-					case Renderer::ResourceType::TEXTURE_CUBE:
-					{
-						// In OpenGL, all shaders share the same texture units (= "Renderer::RootParameter::shaderVisibility" stays unused)
+					case VertexArray::InternalResourceType::VAO:
+						// Bind OpenGL vertex array
+						glBindVertexArray(static_cast<VertexArrayVao*>(mVertexArray)->getOpenGLVertexArray());
+						break;
+				}
+			}
+			else
+			{
+				// Unset the currently used vertex array
+				iaUnsetVertexArray();
+			}
+		}
+	}
 
-						// Is "GL_ARB_direct_state_access" or "GL_EXT_direct_state_access" there?
-						if (mExtensions->isGL_ARB_direct_state_access() || mExtensions->isGL_EXT_direct_state_access())
-						{
-							// Effective direct state access (DSA)
-							const bool isArbDsa = mExtensions->isGL_ARB_direct_state_access();
 
-							// "glBindTextureUnit()" unit parameter is zero based so we can simply use the value we received
-							const GLuint unit = descriptorRange.baseShaderRegister;
+	//[-------------------------------------------------------]
+	//[ Rasterizer (RS) stage                                 ]
+	//[-------------------------------------------------------]
+	void OpenGLRenderer::rsSetViewports(uint32_t numberOfViewports, const Renderer::Viewport* viewports)
+	{
+		// Sanity check
+		RENDERER_ASSERT(mContext, numberOfViewports > 0 && nullptr != viewports, "Invalid OpenGL rasterizer state viewports")
+		std::ignore = numberOfViewports;
 
-							// TODO(co) Some security checks might be wise *maximum number of texture units*
-							// Evaluate the texture type
-							switch (resourceType)
-							{
-								case Renderer::ResourceType::TEXTURE_BUFFER:
-									if (isArbDsa)
-									{
-										glBindTextureUnit(unit, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
-									}
-									else
-									{
-										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_BUFFER_ARB, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
-									}
-									break;
+		// In OpenGL, the origin of the viewport is left bottom while Direct3D is using a left top origin. To make the
+		// Direct3D 11 implementation as efficient as possible the Direct3D convention is used and we have to convert in here.
+		// -> This isn't influenced by the "GL_ARB_clip_control"-extension
 
-								case Renderer::ResourceType::TEXTURE_1D:
-									if (isArbDsa)
-									{
-										glBindTextureUnit(unit, static_cast<Texture1D*>(resource)->getOpenGLTexture());
-									}
-									else
-									{
-										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-										const Texture1D* texture1D = static_cast<Texture1D*>(resource);
-										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_1D, texture1D->getOpenGLTexture());
-									}
-									break;
+		// Get the width and height of the current render target
+		uint32_t renderTargetHeight = 1;
+		if (nullptr != mRenderTarget)
+		{
+			uint32_t renderTargetWidth = 1;
+			mRenderTarget->getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+		}
 
-								case Renderer::ResourceType::TEXTURE_2D:
-									if (isArbDsa)
-									{
-										glBindTextureUnit(unit, static_cast<Texture2D*>(resource)->getOpenGLTexture());
-									}
-									else
-									{
-										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-										const Texture2D* texture2D = static_cast<Texture2D*>(resource);
-										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, static_cast<GLenum>((texture2D->getNumberOfMultisamples() > 1) ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D), texture2D->getOpenGLTexture());
-									}
-									break;
+		// Set the OpenGL viewport
+		// TODO(co) "GL_ARB_viewport_array" support ("OpenGLRenderer::rsSetViewports()")
+		// TODO(co) Check for "numberOfViewports" out of range or are the debug events good enough?
+		RENDERER_ASSERT(mContext, numberOfViewports <= 1, "OpenGL supports only one viewport")
+		glViewport(static_cast<GLint>(viewports->topLeftX), static_cast<GLint>(renderTargetHeight - viewports->topLeftY - viewports->height), static_cast<GLsizei>(viewports->width), static_cast<GLsizei>(viewports->height));
+		glDepthRange(static_cast<GLclampf>(viewports->minDepth), static_cast<GLclampf>(viewports->maxDepth));
+	}
 
-								case Renderer::ResourceType::TEXTURE_2D_ARRAY:
-									// No texture 2D array extension check required, if we in here we already know it must exist
-									if (isArbDsa)
-									{
-										glBindTextureUnit(unit, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
-									}
-									else
-									{
-										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_2D_ARRAY_EXT, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
-									}
-									break;
-
-								case Renderer::ResourceType::TEXTURE_3D:
-									if (isArbDsa)
-									{
-										glBindTextureUnit(unit, static_cast<Texture3D*>(resource)->getOpenGLTexture());
-									}
-									else
-									{
-										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-										const Texture3D* texture3D = static_cast<Texture3D*>(resource);
-										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_3D, texture3D->getOpenGLTexture());
-									}
-									break;
+	void OpenGLRenderer::rsSetScissorRectangles(uint32_t numberOfScissorRectangles, const Renderer::ScissorRectangle* scissorRectangles)
+	{
+		// Sanity check
+		RENDERER_ASSERT(mContext, numberOfScissorRectangles > 0 && nullptr != scissorRectangles, "Invalid OpenGL rasterizer state scissor rectangles")
+		std::ignore = numberOfScissorRectangles;
 
-								case Renderer::ResourceType::TEXTURE_CUBE:
-									if (isArbDsa)
-									{
-										glBindTextureUnit(unit, static_cast<TextureCube*>(resource)->getOpenGLTexture());
-									}
-									else
-									{
-										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-										const TextureCube* textureCube = static_cast<TextureCube*>(resource);
-										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_CUBE_MAP, textureCube->getOpenGLTexture());
-									}
-									break;
+		// In OpenGL, the origin of the scissor rectangle is left bottom while Direct3D is using a left top origin. To make the
+		// Direct3D 9 & 10 & 11 implementation as efficient as possible the Direct3D convention is used and we have to convert in here.
+		// -> This isn't influenced by the "GL_ARB_clip_control"-extension
 
-								case Renderer::ResourceType::ROOT_SIGNATURE:
-								case Renderer::ResourceType::RESOURCE_GROUP:
-								case Renderer::ResourceType::PROGRAM:
-								case Renderer::ResourceType::VERTEX_ARRAY:
-								case Renderer::ResourceType::RENDER_PASS:
-								case Renderer::ResourceType::SWAP_CHAIN:
-								case Renderer::ResourceType::FRAMEBUFFER:
-								case Renderer::ResourceType::INDEX_BUFFER:
-								case Renderer::ResourceType::VERTEX_BUFFER:
-								case Renderer::ResourceType::UNIFORM_BUFFER:
-								case Renderer::ResourceType::INDIRECT_BUFFER:
-								case Renderer::ResourceType::PIPELINE_STATE:
-								case Renderer::ResourceType::SAMPLER_STATE:
-								case Renderer::ResourceType::VERTEX_SHADER:
-								case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
-								case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
-								case Renderer::ResourceType::GEOMETRY_SHADER:
-								case Renderer::ResourceType::FRAGMENT_SHADER:
-									RENDERER_LOG(mContext, CRITICAL, "Invalid OpenGL renderer backend resource type")
-									break;
-							}
+		// Get the width and height of the current render target
+		uint32_t renderTargetHeight = 1;
+		if (nullptr != mRenderTarget)
+		{
+			uint32_t renderTargetWidth = 1;
+			mRenderTarget->getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+		}
 
-							// Set the OpenGL sampler states, if required (texture buffer has no sampler state), it's valid that there's no sampler state (e.g. texel fetch instead of sampling might be used)
-							if (Renderer::ResourceType::TEXTURE_BUFFER != resourceType)
-							{
-								RENDERER_ASSERT(mContext, nullptr != openGLResourceGroup->getSamplerState(), "Invalid OpenGL sampler state")
-								const SamplerState* samplerState = static_cast<const SamplerState*>(openGLResourceGroup->getSamplerState()[resourceIndex]);
-								if (nullptr != samplerState)
-								{
-									// Is "GL_ARB_sampler_objects" there?
-									if (mExtensions->isGL_ARB_sampler_objects())
-									{
-										// Effective sampler object (SO)
-										glBindSampler(descriptorRange.baseShaderRegister, static_cast<const SamplerStateSo*>(samplerState)->getOpenGLSampler());
-									}
-									else
-									{
-										#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
-											// Backup the currently active OpenGL texture
-											GLint openGLActiveTextureBackup = 0;
-											glGetIntegerv(GL_ACTIVE_TEXTURE, &openGLActiveTextureBackup);
-										#endif
+		// Set the OpenGL scissor rectangle
+		// TODO(co) "GL_ARB_viewport_array" support ("OpenGLRenderer::rsSetViewports()")
+		// TODO(co) Check for "numberOfViewports" out of range or are the debug events good enough?
+		RENDERER_ASSERT(mContext, numberOfScissorRectangles <= 1, "OpenGL supports only one scissor rectangle")
+		const GLsizei width  = scissorRectangles->bottomRightX - scissorRectangles->topLeftX;
+		const GLsizei height = scissorRectangles->bottomRightY - scissorRectangles->topLeftY;
+		glScissor(static_cast<GLint>(scissorRectangles->topLeftX), static_cast<GLint>(renderTargetHeight - scissorRectangles->topLeftY - height), width, height);
+	}
 
-										// TODO(co) Some security checks might be wise *maximum number of texture units*
-										// Activate the texture unit we want to manipulate
-										// -> "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-										glActiveTextureARB(GL_TEXTURE0_ARB + unit);
 
-										// Is "GL_EXT_direct_state_access" there?
-										if (mExtensions->isGL_EXT_direct_state_access())
-										{
-											// Direct state access (DSA) version to emulate a sampler object
-											static_cast<const SamplerStateDsa*>(samplerState)->setOpenGLSamplerStates();
-										}
-										else
-										{
-											// Traditional bind version to emulate a sampler object
-											static_cast<const SamplerStateBind*>(samplerState)->setOpenGLSamplerStates();
-										}
+	//[-------------------------------------------------------]
+	//[ Output-merger (OM) stage                              ]
+	//[-------------------------------------------------------]
+	void OpenGLRenderer::omSetRenderTarget(Renderer::IRenderTarget* renderTarget)
+	{
+		// New render target?
+		if (mRenderTarget != renderTarget)
+		{
+			// Set a render target?
+			if (nullptr != renderTarget)
+			{
+				// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+				OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *renderTarget)
 
-										#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
-											// Be polite and restore the previous active OpenGL texture
-											glActiveTextureARB(static_cast<GLenum>(openGLActiveTextureBackup));
-										#endif
-									}
-								}
-							}
-						}
-						else
+				// Release the render target reference, in case we have one
+				Framebuffer* framebufferToGenerateMipmapsFor = nullptr;
+				if (nullptr != mRenderTarget)
+				{
+					// Unbind OpenGL framebuffer?
+					if (Renderer::ResourceType::FRAMEBUFFER == mRenderTarget->getResourceType() && Renderer::ResourceType::FRAMEBUFFER != renderTarget->getResourceType())
+					{
+						// Do we need to disable multisample?
+						if (static_cast<Framebuffer*>(mRenderTarget)->isMultisampleRenderTarget())
 						{
-							// Traditional bind version
+							glDisable(GL_MULTISAMPLE);
+						}
 
-							// "GL_ARB_multitexture" required
-							if (mExtensions->isGL_ARB_multitexture())
-							{
-								#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
-									// Backup the currently active OpenGL texture
-									GLint openGLActiveTextureBackup = 0;
-									glGetIntegerv(GL_ACTIVE_TEXTURE, &openGLActiveTextureBackup);
-								#endif
+						// We do not render into a OpenGL framebuffer
+						glBindFramebuffer(GL_FRAMEBUFFER, 0);
+					}
 
-								// TODO(co) Some security checks might be wise *maximum number of texture units*
-								// Activate the texture unit we want to manipulate
-								// -> "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-								glActiveTextureARB(GL_TEXTURE0_ARB + descriptorRange.baseShaderRegister);
+					// Generate mipmaps?
+					if (Renderer::ResourceType::FRAMEBUFFER == mRenderTarget->getResourceType() && static_cast<Framebuffer*>(mRenderTarget)->getGenerateMipmaps())
+					{
+						framebufferToGenerateMipmapsFor = static_cast<Framebuffer*>(mRenderTarget);
+					}
+					else
+					{
+						// Release
+						mRenderTarget->releaseReference();
+					}
+				}
 
-								// Evaluate the resource type
-								switch (resourceType)
-								{
-									case Renderer::ResourceType::TEXTURE_BUFFER:
-										glBindTexture(GL_TEXTURE_BUFFER_ARB, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
-										break;
+				// Set new render target and add a reference to it
+				mRenderTarget = renderTarget;
+				mRenderTarget->addReference();
 
-									case Renderer::ResourceType::TEXTURE_1D:
-										glBindTexture(GL_TEXTURE_1D, static_cast<Texture1D*>(resource)->getOpenGLTexture());
-										break;
+				// Evaluate the render target type
+				GLenum clipControlOrigin = GL_UPPER_LEFT;
+				switch (mRenderTarget->getResourceType())
+				{
+					case Renderer::ResourceType::SWAP_CHAIN:
+					{
+						static_cast<SwapChain*>(mRenderTarget)->getOpenGLContext().makeCurrent();
+						clipControlOrigin = GL_LOWER_LEFT;	// Compensate OS window coordinate system y-flip
+						break;
+					}
 
-									case Renderer::ResourceType::TEXTURE_2D:
-									{
-										const Texture2D* texture2D = static_cast<Texture2D*>(resource);
-										glBindTexture(static_cast<GLenum>((texture2D->getNumberOfMultisamples() > 1) ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D), texture2D->getOpenGLTexture());
-										break;
-									}
+					case Renderer::ResourceType::FRAMEBUFFER:
+					{
+						// Get the OpenGL framebuffer instance
+						Framebuffer* framebuffer = static_cast<Framebuffer*>(mRenderTarget);
 
-									case Renderer::ResourceType::TEXTURE_2D_ARRAY:
-										// No extension check required, if we in here we already know it must exist
-										glBindTexture(GL_TEXTURE_2D_ARRAY_EXT, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
-										break;
+						// Bind the OpenGL framebuffer
+						glBindFramebuffer(GL_FRAMEBUFFER, framebuffer->getOpenGLFramebuffer());
 
-									case Renderer::ResourceType::TEXTURE_3D:
-										glBindTexture(GL_TEXTURE_3D, static_cast<Texture3D*>(resource)->getOpenGLTexture());
-										break;
+						// Define the OpenGL buffers to draw into, "GL_ARB_draw_buffers"-extension required
+						if (mExtensions->isGL_ARB_draw_buffers())
+						{
+							// https://www.opengl.org/registry/specs/ARB/draw_buffers.txt - "The draw buffer for output colors beyond <n> is set to NONE."
+							// -> Meaning depth only rendering which has no color textures at all will work as well, no need for "glDrawBuffer(GL_NONE)"
+							static const GLenum OPENGL_DRAW_BUFFER[16] =
+							{
+								GL_COLOR_ATTACHMENT0,  GL_COLOR_ATTACHMENT1,  GL_COLOR_ATTACHMENT2,  GL_COLOR_ATTACHMENT3,
+								GL_COLOR_ATTACHMENT4,  GL_COLOR_ATTACHMENT5,  GL_COLOR_ATTACHMENT6,  GL_COLOR_ATTACHMENT7,
+								GL_COLOR_ATTACHMENT8,  GL_COLOR_ATTACHMENT9,  GL_COLOR_ATTACHMENT10, GL_COLOR_ATTACHMENT11,
+								GL_COLOR_ATTACHMENT12, GL_COLOR_ATTACHMENT13, GL_COLOR_ATTACHMENT14, GL_COLOR_ATTACHMENT15
+							};
+							glDrawBuffersARB(static_cast<GLsizei>(framebuffer->getNumberOfColorTextures()), OPENGL_DRAW_BUFFER);
+						}
 
-									case Renderer::ResourceType::TEXTURE_CUBE:
-										glBindTexture(GL_TEXTURE_CUBE_MAP, static_cast<TextureCube*>(resource)->getOpenGLTexture());
-										break;
-
-									case Renderer::ResourceType::ROOT_SIGNATURE:
-									case Renderer::ResourceType::RESOURCE_GROUP:
-									case Renderer::ResourceType::PROGRAM:
-									case Renderer::ResourceType::VERTEX_ARRAY:
-									case Renderer::ResourceType::RENDER_PASS:
-									case Renderer::ResourceType::SWAP_CHAIN:
-									case Renderer::ResourceType::FRAMEBUFFER:
-									case Renderer::ResourceType::INDEX_BUFFER:
-									case Renderer::ResourceType::VERTEX_BUFFER:
-									case Renderer::ResourceType::UNIFORM_BUFFER:
-									case Renderer::ResourceType::INDIRECT_BUFFER:
-									case Renderer::ResourceType::PIPELINE_STATE:
-									case Renderer::ResourceType::SAMPLER_STATE:
-									case Renderer::ResourceType::VERTEX_SHADER:
-									case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
-									case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
-									case Renderer::ResourceType::GEOMETRY_SHADER:
-									case Renderer::ResourceType::FRAGMENT_SHADER:
-										RENDERER_LOG(mContext, CRITICAL, "Invalid OpenGL renderer backend resource type")
-										break;
-								}
-
-								// Set the OpenGL sampler states, if required (texture buffer has no sampler state), it's valid that there's no sampler state (e.g. texel fetch instead of sampling might be used)
-								if (Renderer::ResourceType::TEXTURE_BUFFER != resourceType)
-								{
-									RENDERER_ASSERT(mContext, nullptr != openGLResourceGroup->getSamplerState(), "Invalid OpenGL sampler state")
-									const SamplerState* samplerState = static_cast<const SamplerState*>(openGLResourceGroup->getSamplerState()[resourceIndex]);
-									if (nullptr != samplerState)
-									{
-										// Is "GL_ARB_sampler_objects" there?
-										if (mExtensions->isGL_ARB_sampler_objects())
-										{
-											// Effective sampler object (SO)
-											glBindSampler(descriptorRange.baseShaderRegister, static_cast<const SamplerStateSo*>(samplerState)->getOpenGLSampler());
-										}
-										// Is "GL_EXT_direct_state_access" there?
-										else if (mExtensions->isGL_EXT_direct_state_access() || mExtensions->isGL_ARB_direct_state_access())
-										{
-											// Direct state access (DSA) version to emulate a sampler object
-											static_cast<const SamplerStateDsa*>(samplerState)->setOpenGLSamplerStates();
-										}
-										else
-										{
-											// Traditional bind version to emulate a sampler object
-											static_cast<const SamplerStateBind*>(samplerState)->setOpenGLSamplerStates();
-										}
-									}
-								}
-
-								#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
-									// Be polite and restore the previous active OpenGL texture
-									glActiveTextureARB(static_cast<GLenum>(openGLActiveTextureBackup));
-								#endif
-							}
-						}
-						break;
-					}
-
-					case Renderer::ResourceType::SAMPLER_STATE:
-						// Unlike Direct3D >=10, OpenGL directly attaches the sampler settings to the texture (unless the sampler object extension is used)
-						break;
+						// Do we need to enable multisample?
+						if (framebuffer->isMultisampleRenderTarget())
+						{
+							glEnable(GL_MULTISAMPLE);
+						}
+						break;
+					}
 
 					case Renderer::ResourceType::ROOT_SIGNATURE:
 					case Renderer::ResourceType::RESOURCE_GROUP:
 					case Renderer::ResourceType::PROGRAM:
 					case Renderer::ResourceType::VERTEX_ARRAY:
 					case Renderer::ResourceType::RENDER_PASS:
-					case Renderer::ResourceType::SWAP_CHAIN:
-					case Renderer::ResourceType::FRAMEBUFFER:
+					case Renderer::ResourceType::QUERY_POOL:
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
+					case Renderer::ResourceType::UNIFORM_BUFFER:
+					case Renderer::ResourceType::TEXTURE_BUFFER:
 					case Renderer::ResourceType::INDIRECT_BUFFER:
+					case Renderer::ResourceType::TEXTURE_1D:
+					case Renderer::ResourceType::TEXTURE_2D:
+					case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+					case Renderer::ResourceType::TEXTURE_3D:
+					case Renderer::ResourceType::TEXTURE_CUBE:
 					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
+					case Renderer::ResourceType::SAMPLER_STATE:
 					case Renderer::ResourceType::VERTEX_SHADER:
 					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
-						RENDERER_LOG(mContext, CRITICAL, "Invalid Direct3D 11 renderer backend resource type")
+					case Renderer::ResourceType::COMPUTE_SHADER:
+					default:
+						// Not handled in here
 						break;
 				}
-			}
-		}
-		else
-		{
-			// TODO(co) Handle this situation?
-		}
-	}
 
-	void OpenGLRenderer::setPipelineState(Renderer::IPipelineState* pipelineState)
-	{
-		if (mPipelineState != pipelineState)
-		{
-			if (nullptr != pipelineState)
-			{
-				// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
-				OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *pipelineState)
-
-				// Set new pipeline state and add a reference to it
-				if (nullptr != mPipelineState)
+				// Generate mipmaps
+				if (nullptr != framebufferToGenerateMipmapsFor)
 				{
-					mPipelineState->releaseReference();
+					framebufferToGenerateMipmapsFor->generateMipmaps();
+					framebufferToGenerateMipmapsFor->releaseReference();
 				}
-				mPipelineState = static_cast<PipelineState*>(pipelineState);
-				mPipelineState->addReference();
 
-				// Set OpenGL primitive topology
-				mOpenGLPrimitiveTopology = mPipelineState->getOpenGLPrimitiveTopology();
-				const int newNumberOfVerticesPerPatch = mPipelineState->getNumberOfVerticesPerPatch();
-				if (0 != newNumberOfVerticesPerPatch && mNumberOfVerticesPerPatch != newNumberOfVerticesPerPatch)
+				// Setup clip control
+				if (mOpenGLClipControlOrigin != clipControlOrigin && mExtensions->isGL_ARB_clip_control())
 				{
-					mNumberOfVerticesPerPatch = newNumberOfVerticesPerPatch;
-					glPatchParameteri(GL_PATCH_VERTICES, mNumberOfVerticesPerPatch);
+					// OpenGL default is "GL_LOWER_LEFT" and "GL_NEGATIVE_ONE_TO_ONE", change it to match Vulkan and Direct3D
+					mOpenGLClipControlOrigin = clipControlOrigin;
+					glClipControl(mOpenGLClipControlOrigin, GL_ZERO_TO_ONE);
 				}
-
-				// Set pipeline state
-				mPipelineState->bindPipelineState();
 			}
-			else if (nullptr != mPipelineState)
+			else if (nullptr != mRenderTarget)
 			{
-				// TODO(co) Handle this situation by resetting OpenGL states?
-				mPipelineState->releaseReference();
-				mPipelineState = nullptr;
+				// Evaluate the render target type
+				if (Renderer::ResourceType::FRAMEBUFFER == mRenderTarget->getResourceType())
+				{
+					// We do not render into a OpenGL framebuffer
+					glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				}
+
+				// TODO(co) Set no active render target
+
+				// Release the render target reference, in case we have one
+				mRenderTarget->releaseReference();
+				mRenderTarget = nullptr;
 			}
 		}
 	}
 
 
 	//[-------------------------------------------------------]
-	//[ Input-assembler (IA) stage                            ]
+	//[ Operations                                            ]
 	//[-------------------------------------------------------]
-	void OpenGLRenderer::iaSetVertexArray(Renderer::IVertexArray* vertexArray)
+	void OpenGLRenderer::clear(uint32_t flags, const float color[4], float z, uint32_t stencil)
 	{
-		// New vertex array?
-		if (mVertexArray != vertexArray)
+		// Get API flags
+		uint32_t flagsApi = 0;
+		if (flags & Renderer::ClearFlag::COLOR)
 		{
-			// Set a vertex array?
-			if (nullptr != vertexArray)
-			{
-				// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
-				OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *vertexArray)
-
-				// Unset the currently used vertex array
-				iaUnsetVertexArray();
-
-				// Set new vertex array and add a reference to it
-				mVertexArray = static_cast<VertexArray*>(vertexArray);
-				mVertexArray->addReference();
+			flagsApi |= GL_COLOR_BUFFER_BIT;
+		}
+		if (flags & Renderer::ClearFlag::DEPTH)
+		{
+			flagsApi |= GL_DEPTH_BUFFER_BIT;
+		}
+		if (flags & Renderer::ClearFlag::STENCIL)
+		{
+			flagsApi |= GL_STENCIL_BUFFER_BIT;
+		}
 
-				// Evaluate the internal array type of the new vertex array to set
-				switch (static_cast<VertexArray*>(mVertexArray)->getInternalResourceType())
+		// Are API flags set?
+		if (0 != flagsApi)
+		{
+			// Set clear settings
+			if (flags & Renderer::ClearFlag::COLOR)
+			{
+				glClearColor(color[0], color[1], color[2], color[3]);
+			}
+			if (flags & Renderer::ClearFlag::DEPTH)
+			{
+				glClearDepth(z);
+				if (nullptr != mPipelineState && Renderer::DepthWriteMask::ALL != mPipelineState->getDepthStencilState().depthWriteMask)
 				{
-					case VertexArray::InternalResourceType::NO_VAO:
-						// Enable OpenGL vertex attribute arrays
-						static_cast<VertexArrayNoVao*>(mVertexArray)->enableOpenGLVertexAttribArrays();
-						break;
-
-					case VertexArray::InternalResourceType::VAO:
-						// Bind OpenGL vertex array
-						glBindVertexArray(static_cast<VertexArrayVao*>(mVertexArray)->getOpenGLVertexArray());
-						break;
+					glDepthMask(GL_TRUE);
 				}
 			}
-			else
+			if (flags & Renderer::ClearFlag::STENCIL)
 			{
-				// Unset the currently used vertex array
-				iaUnsetVertexArray();
+				glClearStencil(static_cast<GLint>(stencil));
 			}
-		}
-	}
 
+			// Unlike OpenGL, when using Direct3D 10 & 11 the scissor rectangle(s) do not affect the clear operation
+			// -> We have to compensate the OpenGL behaviour in here
 
-	//[-------------------------------------------------------]
-	//[ Rasterizer (RS) stage                                 ]
-	//[-------------------------------------------------------]
-	void OpenGLRenderer::rsSetViewports(uint32_t numberOfViewports, const Renderer::Viewport* viewports)
-	{
-		// Sanity check
-		RENDERER_ASSERT(mContext, numberOfViewports > 0 && nullptr != viewports, "Invalid OpenGL rasterizer state viewports")
-		std::ignore = numberOfViewports;
+			// Disable OpenGL scissor test, in case it's not disabled, yet
+			if (nullptr != mPipelineState && mPipelineState->getRasterizerState().scissorEnable)
+			{
+				glDisable(GL_SCISSOR_TEST);
+			}
 
-		// In OpenGL, the origin of the viewport is left bottom while Direct3D is using a left top origin. To make the
-		// Direct3D 11 implementation as efficient as possible the Direct3D convention is used and we have to convert in here.
-		// -> This isn't influenced by the "GL_ARB_clip_control"-extension
+			// Clear
+			glClear(flagsApi);
 
-		// Get the width and height of the current render target
-		uint32_t renderTargetHeight = 1;
-		if (nullptr != mRenderTarget)
-		{
-			uint32_t renderTargetWidth = 1;
-			mRenderTarget->getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+			// Restore the previously set OpenGL states
+			if (nullptr != mPipelineState && mPipelineState->getRasterizerState().scissorEnable)
+			{
+				glEnable(GL_SCISSOR_TEST);
+			}
+			if ((flags & Renderer::ClearFlag::DEPTH) && nullptr != mPipelineState && Renderer::DepthWriteMask::ALL != mPipelineState->getDepthStencilState().depthWriteMask)
+			{
+				glDepthMask(GL_FALSE);
+			}
 		}
-
-		// Set the OpenGL viewport
-		// TODO(co) "GL_ARB_viewport_array" support ("OpenGLRenderer::rsSetViewports()")
-		// TODO(co) Check for "numberOfViewports" out of range or are the debug events good enough?
-		RENDERER_ASSERT(mContext, numberOfViewports <= 1, "OpenGL supports only one viewport")
-		glViewport(static_cast<GLint>(viewports->topLeftX), static_cast<GLint>(renderTargetHeight - viewports->topLeftY - viewports->height), static_cast<GLsizei>(viewports->width), static_cast<GLsizei>(viewports->height));
-		glDepthRange(static_cast<GLclampf>(viewports->minDepth), static_cast<GLclampf>(viewports->maxDepth));
 	}
 
-	void OpenGLRenderer::rsSetScissorRectangles(uint32_t numberOfScissorRectangles, const Renderer::ScissorRectangle* scissorRectangles)
+	void OpenGLRenderer::resolveMultisampleFramebuffer(Renderer::IRenderTarget& destinationRenderTarget, Renderer::IFramebuffer& sourceMultisampleFramebuffer)
 	{
-		// Sanity check
-		RENDERER_ASSERT(mContext, numberOfScissorRectangles > 0 && nullptr != scissorRectangles, "Invalid OpenGL rasterizer state scissor rectangles")
-		std::ignore = numberOfScissorRectangles;
-
-		// In OpenGL, the origin of the scissor rectangle is left bottom while Direct3D is using a left top origin. To make the
-		// Direct3D 9 & 10 & 11 implementation as efficient as possible the Direct3D convention is used and we have to convert in here.
-		// -> This isn't influenced by the "GL_ARB_clip_control"-extension
+		// Security check: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+		OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, destinationRenderTarget)
+		OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, sourceMultisampleFramebuffer)
 
-		// Get the width and height of the current render target
-		uint32_t renderTargetHeight = 1;
-		if (nullptr != mRenderTarget)
+		// Evaluate the render target type
+		switch (destinationRenderTarget.getResourceType())
 		{
-			uint32_t renderTargetWidth = 1;
-			mRenderTarget->getWidthAndHeight(renderTargetWidth, renderTargetHeight);
-		}
-
-		// Set the OpenGL scissor rectangle
-		// TODO(co) "GL_ARB_viewport_array" support ("OpenGLRenderer::rsSetViewports()")
-		// TODO(co) Check for "numberOfViewports" out of range or are the debug events good enough?
-		RENDERER_ASSERT(mContext, numberOfScissorRectangles <= 1, "OpenGL supports only one scissor rectangle")
-		const GLsizei width  = scissorRectangles->bottomRightX - scissorRectangles->topLeftX;
-		const GLsizei height = scissorRectangles->bottomRightY - scissorRectangles->topLeftY;
-		glScissor(static_cast<GLint>(scissorRectangles->topLeftX), static_cast<GLint>(renderTargetHeight - scissorRectangles->topLeftY - height), width, height);
-	}
-
-
-	//[-------------------------------------------------------]
-	//[ Output-merger (OM) stage                              ]
-	//[-------------------------------------------------------]
-	void OpenGLRenderer::omSetRenderTarget(Renderer::IRenderTarget* renderTarget)
-	{
-		// New render target?
-		if (mRenderTarget != renderTarget)
-		{
-			// Set a render target?
-			if (nullptr != renderTarget)
-			{
-				// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
-				OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *renderTarget)
-
-				// Release the render target reference, in case we have one
-				Framebuffer* framebufferToGenerateMipmapsFor = nullptr;
-				if (nullptr != mRenderTarget)
-				{
-					// Unbind OpenGL framebuffer?
-					if (Renderer::ResourceType::FRAMEBUFFER == mRenderTarget->getResourceType() && Renderer::ResourceType::FRAMEBUFFER != renderTarget->getResourceType())
-					{
-						// Do we need to disable multisample?
-						if (static_cast<Framebuffer*>(mRenderTarget)->isMultisampleRenderTarget())
-						{
-							glDisable(GL_MULTISAMPLE);
-						}
-
-						// We do not render into a OpenGL framebuffer
-						glBindFramebuffer(GL_FRAMEBUFFER, 0);
-					}
-
-					// Generate mipmaps?
-					if (Renderer::ResourceType::FRAMEBUFFER == mRenderTarget->getResourceType() && static_cast<Framebuffer*>(mRenderTarget)->getGenerateMipmaps())
-					{
-						framebufferToGenerateMipmapsFor = static_cast<Framebuffer*>(mRenderTarget);
-					}
-					else
-					{
-						// Release
-						mRenderTarget->releaseReference();
-					}
-				}
-
-				// Set new render target and add a reference to it
-				mRenderTarget = renderTarget;
-				mRenderTarget->addReference();
-
-				// Evaluate the render target type
-				GLenum clipControlOrigin = GL_UPPER_LEFT;
-				switch (mRenderTarget->getResourceType())
-				{
-					case Renderer::ResourceType::SWAP_CHAIN:
-					{
-						static_cast<SwapChain*>(mRenderTarget)->getOpenGLContext().makeCurrent();
-						clipControlOrigin = GL_LOWER_LEFT;	// Compensate OS window coordinate system y-flip
-						break;
-					}
-
-					case Renderer::ResourceType::FRAMEBUFFER:
-					{
-						// Get the OpenGL framebuffer instance
-						Framebuffer* framebuffer = static_cast<Framebuffer*>(mRenderTarget);
-
-						// Bind the OpenGL framebuffer
-						glBindFramebuffer(GL_FRAMEBUFFER, framebuffer->getOpenGLFramebuffer());
-
-						// Define the OpenGL buffers to draw into, "GL_ARB_draw_buffers"-extension required
-						if (mExtensions->isGL_ARB_draw_buffers())
-						{
-							// https://www.opengl.org/registry/specs/ARB/draw_buffers.txt - "The draw buffer for output colors beyond <n> is set to NONE."
-							// -> Meaning depth only rendering which has no color textures at all will work as well, no need for "glDrawBuffer(GL_NONE)"
-							static const GLenum OPENGL_DRAW_BUFFER[16] =
-							{
-								GL_COLOR_ATTACHMENT0,  GL_COLOR_ATTACHMENT1,  GL_COLOR_ATTACHMENT2,  GL_COLOR_ATTACHMENT3,
-								GL_COLOR_ATTACHMENT4,  GL_COLOR_ATTACHMENT5,  GL_COLOR_ATTACHMENT6,  GL_COLOR_ATTACHMENT7,
-								GL_COLOR_ATTACHMENT8,  GL_COLOR_ATTACHMENT9,  GL_COLOR_ATTACHMENT10, GL_COLOR_ATTACHMENT11,
-								GL_COLOR_ATTACHMENT12, GL_COLOR_ATTACHMENT13, GL_COLOR_ATTACHMENT14, GL_COLOR_ATTACHMENT15
-							};
-							glDrawBuffersARB(static_cast<GLsizei>(framebuffer->getNumberOfColorTextures()), OPENGL_DRAW_BUFFER);
-						}
-
-						// Do we need to enable multisample?
-						if (framebuffer->isMultisampleRenderTarget())
-						{
-							glEnable(GL_MULTISAMPLE);
-						}
-						break;
-					}
-
-					case Renderer::ResourceType::ROOT_SIGNATURE:
-					case Renderer::ResourceType::RESOURCE_GROUP:
-					case Renderer::ResourceType::PROGRAM:
-					case Renderer::ResourceType::VERTEX_ARRAY:
-					case Renderer::ResourceType::RENDER_PASS:
-					case Renderer::ResourceType::INDEX_BUFFER:
-					case Renderer::ResourceType::VERTEX_BUFFER:
-					case Renderer::ResourceType::UNIFORM_BUFFER:
-					case Renderer::ResourceType::TEXTURE_BUFFER:
-					case Renderer::ResourceType::INDIRECT_BUFFER:
-					case Renderer::ResourceType::TEXTURE_1D:
-					case Renderer::ResourceType::TEXTURE_2D:
-					case Renderer::ResourceType::TEXTURE_2D_ARRAY:
-					case Renderer::ResourceType::TEXTURE_3D:
-					case Renderer::ResourceType::TEXTURE_CUBE:
-					case Renderer::ResourceType::PIPELINE_STATE:
-					case Renderer::ResourceType::SAMPLER_STATE:
-					case Renderer::ResourceType::VERTEX_SHADER:
-					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
-					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
-					case Renderer::ResourceType::GEOMETRY_SHADER:
-					case Renderer::ResourceType::FRAGMENT_SHADER:
-					default:
-						// Not handled in here
-						break;
-				}
-
-				// Generate mipmaps
-				if (nullptr != framebufferToGenerateMipmapsFor)
-				{
-					framebufferToGenerateMipmapsFor->generateMipmaps();
-					framebufferToGenerateMipmapsFor->releaseReference();
-				}
-
-				// Setup clip control
-				if (mOpenGLClipControlOrigin != clipControlOrigin && mExtensions->isGL_ARB_clip_control())
-				{
-					// OpenGL default is "GL_LOWER_LEFT" and "GL_NEGATIVE_ONE_TO_ONE", change it to match Vulkan and Direct3D
-					mOpenGLClipControlOrigin = clipControlOrigin;
-					glClipControl(mOpenGLClipControlOrigin, GL_ZERO_TO_ONE);
-				}
-			}
-			else if (nullptr != mRenderTarget)
-			{
-				// Evaluate the render target type
-				if (Renderer::ResourceType::FRAMEBUFFER == mRenderTarget->getResourceType())
-				{
-					// We do not render into a OpenGL framebuffer
-					glBindFramebuffer(GL_FRAMEBUFFER, 0);
-				}
-
-				// TODO(co) Set no active render target
-
-				// Release the render target reference, in case we have one
-				mRenderTarget->releaseReference();
-				mRenderTarget = nullptr;
-			}
-		}
-	}
-
-
-	//[-------------------------------------------------------]
-	//[ Operations                                            ]
-	//[-------------------------------------------------------]
-	void OpenGLRenderer::clear(uint32_t flags, const float color[4], float z, uint32_t stencil)
-	{
-		// Get API flags
-		uint32_t flagsApi = 0;
-		if (flags & Renderer::ClearFlag::COLOR)
-		{
-			flagsApi |= GL_COLOR_BUFFER_BIT;
-		}
-		if (flags & Renderer::ClearFlag::DEPTH)
-		{
-			flagsApi |= GL_DEPTH_BUFFER_BIT;
-		}
-		if (flags & Renderer::ClearFlag::STENCIL)
-		{
-			flagsApi |= GL_STENCIL_BUFFER_BIT;
-		}
-
-		// Are API flags set?
-		if (0 != flagsApi)
-		{
-			// Set clear settings
-			if (flags & Renderer::ClearFlag::COLOR)
-			{
-				glClearColor(color[0], color[1], color[2], color[3]);
-			}
-			if (flags & Renderer::ClearFlag::DEPTH)
-			{
-				glClearDepth(z);
-				if (nullptr != mPipelineState && Renderer::DepthWriteMask::ALL != mPipelineState->getDepthStencilState().depthWriteMask)
-				{
-					glDepthMask(GL_TRUE);
-				}
-			}
-			if (flags & Renderer::ClearFlag::STENCIL)
-			{
-				glClearStencil(static_cast<GLint>(stencil));
-			}
-
-			// Unlike OpenGL, when using Direct3D 10 & 11 the scissor rectangle(s) do not affect the clear operation
-			// -> We have to compensate the OpenGL behaviour in here
-
-			// Disable OpenGL scissor test, in case it's not disabled, yet
-			if (nullptr != mPipelineState && mPipelineState->getRasterizerState().scissorEnable)
-			{
-				glDisable(GL_SCISSOR_TEST);
-			}
-
-			// Clear
-			glClear(flagsApi);
-
-			// Restore the previously set OpenGL states
-			if (nullptr != mPipelineState && mPipelineState->getRasterizerState().scissorEnable)
-			{
-				glEnable(GL_SCISSOR_TEST);
-			}
-			if ((flags & Renderer::ClearFlag::DEPTH) && nullptr != mPipelineState && Renderer::DepthWriteMask::ALL != mPipelineState->getDepthStencilState().depthWriteMask)
-			{
-				glDepthMask(GL_FALSE);
-			}
-		}
-	}
-
-	void OpenGLRenderer::resolveMultisampleFramebuffer(Renderer::IRenderTarget& destinationRenderTarget, Renderer::IFramebuffer& sourceMultisampleFramebuffer)
-	{
-		// Security check: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
-		OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, destinationRenderTarget)
-		OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, sourceMultisampleFramebuffer)
-
-		// Evaluate the render target type
-		switch (destinationRenderTarget.getResourceType())
-		{
-			case Renderer::ResourceType::SWAP_CHAIN:
-			{
-				// Get the OpenGL swap chain instance
-				// TODO(co) Implement me, not that important in practice so not directly implemented
-				// SwapChain& swapChain = static_cast<SwapChain&>(destinationRenderTarget);
-				break;
-			}
+			case Renderer::ResourceType::SWAP_CHAIN:
+			{
+				// Get the OpenGL swap chain instance
+				// TODO(co) Implement me, not that important in practice so not directly implemented
+				// SwapChain& swapChain = static_cast<SwapChain&>(destinationRenderTarget);
+				break;
+			}
 
 			case Renderer::ResourceType::FRAMEBUFFER:
 			{
@@ -1371,6 +1186,7 @@ namespace OpenGLRenderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::INDEX_BUFFER:
 			case Renderer::ResourceType::VERTEX_BUFFER:
 			case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -1382,12 +1198,14 @@ namespace OpenGLRenderer
 			case Renderer::ResourceType::TEXTURE_3D:
 			case Renderer::ResourceType::TEXTURE_CUBE:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Not handled in here
 				break;
@@ -1462,6 +1280,7 @@ namespace OpenGLRenderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::INDEX_BUFFER:
@@ -1474,12 +1293,14 @@ namespace OpenGLRenderer
 			case Renderer::ResourceType::TEXTURE_3D:
 			case Renderer::ResourceType::TEXTURE_CUBE:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Not handled in here
 				break;
@@ -1740,23 +1561,164 @@ namespace OpenGLRenderer
 	}
 
 
-	//[-------------------------------------------------------]
-	//[ Debug                                                 ]
-	//[-------------------------------------------------------]
-	#ifdef RENDERER_DEBUG
-		void OpenGLRenderer::setDebugMarker(const char* name)
+	void OpenGLRenderer::drawIndexedIndirectCount(const Renderer::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, const Renderer::IIndirectBuffer& countBuffer, uint32_t countBufferOffset, uint32_t maximumNumberOfDraws)
+	{
+		// Sanity checks
+		RENDERER_ASSERT(mContext, nullptr != mVertexArray, "OpenGL draw indexed needs a set vertex array")
+		RENDERER_ASSERT(mContext, nullptr != mVertexArray->getIndexBuffer(), "OpenGL draw indexed needs a set vertex array which contains an index buffer")
+		RENDERER_ASSERT(mContext, mExtensions->isGL_ARB_indirect_parameters(), "The GL_ARB_indirect_parameters OpenGL extension isn't supported")
+		RENDERER_ASSERT(mContext, 0 == (countBufferOffset % sizeof(uint32_t)), "The OpenGL count buffer offset must be a multiple of four")
+
+		// Security checks: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+		OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, indirectBuffer)
+		OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, countBuffer)
+
+		// Nothing to do?
+		if (0 == maximumNumberOfDraws)
 		{
-			// "GL_KHR_debug"-extension required
-			if (mExtensions->isGL_KHR_debug())
+			return;
+		}
+
+		{ // Bind indirect buffer
+			const GLuint openGLIndirectBuffer = static_cast<const IndirectBuffer&>(indirectBuffer).getOpenGLIndirectBuffer();
+			if (openGLIndirectBuffer != mOpenGLIndirectBuffer)
 			{
-				RENDERER_ASSERT(mContext, nullptr != name, "OpenGL debug marker names must not be a null pointer")
-				glDebugMessageInsert(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_MARKER, 1, GL_DEBUG_SEVERITY_NOTIFICATION, -1, name);
+				mOpenGLIndirectBuffer = openGLIndirectBuffer;
+				glBindBufferARB(GL_DRAW_INDIRECT_BUFFER, mOpenGLIndirectBuffer);
 			}
 		}
 
-		void OpenGLRenderer::beginDebugEvent(const char* name)
-		{
-			// "GL_KHR_debug"-extension required
+		// Bind count buffer, the parameter buffer binding point isn't used by anything else so there's no need to track it
+		glBindBufferARB(GL_PARAMETER_BUFFER_ARB, static_cast<const IndirectBuffer&>(countBuffer).getOpenGLIndirectBuffer());
+
+		// Draw indirect count, the graphics driver clamps the number of draws read from the count buffer against the given maximum
+		glMultiDrawElementsIndirectCountARB(mOpenGLPrimitiveTopology, mVertexArray->getIndexBuffer()->getOpenGLType(), reinterpret_cast<void*>(static_cast<uintptr_t>(indirectBufferOffset)), static_cast<GLintptr>(countBufferOffset), static_cast<GLsizei>(maximumNumberOfDraws), 0);	// 0 = tightly packed
+	}
+
+	//[-------------------------------------------------------]
+	//[ Compute                                               ]
+	//[-------------------------------------------------------]
+	void OpenGLRenderer::dispatchCompute(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+	{
+		// Security check: Is there a compute pipeline state? (if there's one we already know that "GL_ARB_compute_shader" is there)
+		RENDERER_ASSERT(mContext, nullptr != mComputePipelineState, "No OpenGL compute pipeline state set")
+
+		// Use the compute program
+		// -> A program in use has precedence over a bound program pipeline, so this works with separate shader objects as well
+		// TODO(co) There's room for binding API call related optimization in here, we could only restore the graphics program when drawing
+		glUseProgramObjectARB(mComputePipelineState->getOpenGLProgram());
+
+		// Dispatch the compute work groups
+		glDispatchCompute(groupCountX, groupCountY, groupCountZ);
+
+		// Make the compute shader writes visible to all following commands
+		// TODO(co) Let the user specify more fine granular barrier bits
+		glMemoryBarrier(GL_ALL_BARRIER_BITS);
+
+		// Restore the graphics program, a bound program pipeline is only used if there's no program in use
+		glUseProgramObjectARB(mExtensions->isGL_ARB_separate_shader_objects() ? 0 : mOpenGLProgram);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Query                                                 ]
+	//[-------------------------------------------------------]
+	void OpenGLRenderer::resetQueryPool(Renderer::IQueryPool& queryPool, uint32_t firstQueryIndex, uint32_t numberOfQueries)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity check
+		RENDERER_ASSERT(mContext, firstQueryIndex + numberOfQueries <= static_cast<const QueryPool&>(queryPool).getNumberOfQueries(), "OpenGL out-of-bounds query index")
+		std::ignore = firstQueryIndex;
+		std::ignore = numberOfQueries;
+
+		// Nothing to do in here, OpenGL queries don't need to be reset before they're reused
+	}
+
+	void OpenGLRenderer::beginQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		const QueryPool& openGLQueryPool = static_cast<const QueryPool&>(queryPool);
+		RENDERER_ASSERT(mContext, Renderer::QueryType::TIMESTAMP != openGLQueryPool.getQueryType(), "OpenGL begin query needs an occlusion or pipeline statistics query pool")
+		RENDERER_ASSERT(mContext, queryIndex < openGLQueryPool.getNumberOfQueries(), "OpenGL out-of-bounds query index")
+
+		// Begin the OpenGL query
+		if (Renderer::QueryType::PIPELINE_STATISTICS == openGLQueryPool.getQueryType())
+		{
+			// One OpenGL query per pipeline statistics counter, the query pool creation ensured that "GL_ARB_pipeline_statistics_query" is there
+			const uint32_t* openGLQueries = openGLQueryPool.getOpenGLQueries() + queryIndex * QueryPool::NUMBER_OF_PIPELINE_STATISTICS;
+			for (uint32_t i = 0; i < QueryPool::NUMBER_OF_PIPELINE_STATISTICS; ++i)
+			{
+				glBeginQueryARB(::detail::PIPELINE_STATISTICS_OPENGL_QUERY_TARGETS[i], openGLQueries[i]);
+			}
+		}
+		else
+		{
+			glBeginQueryARB(GL_SAMPLES_PASSED_ARB, openGLQueryPool.getOpenGLQueries()[queryIndex]);
+		}
+	}
+
+	void OpenGLRenderer::endQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		const QueryPool& openGLQueryPool = static_cast<const QueryPool&>(queryPool);
+		RENDERER_ASSERT(mContext, Renderer::QueryType::TIMESTAMP != openGLQueryPool.getQueryType(), "OpenGL end query needs an occlusion or pipeline statistics query pool")
+		RENDERER_ASSERT(mContext, queryIndex < openGLQueryPool.getNumberOfQueries(), "OpenGL out-of-bounds query index")
+		std::ignore = queryIndex;
+
+		// End the OpenGL query, OpenGL only has a single active query per target
+		if (Renderer::QueryType::PIPELINE_STATISTICS == openGLQueryPool.getQueryType())
+		{
+			for (uint32_t i = 0; i < QueryPool::NUMBER_OF_PIPELINE_STATISTICS; ++i)
+			{
+				glEndQueryARB(::detail::PIPELINE_STATISTICS_OPENGL_QUERY_TARGETS[i]);
+			}
+		}
+		else
+		{
+			glEndQueryARB(GL_SAMPLES_PASSED_ARB);
+		}
+	}
+
+	void OpenGLRenderer::writeTimestampQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		const QueryPool& openGLQueryPool = static_cast<const QueryPool&>(queryPool);
+		RENDERER_ASSERT(mContext, Renderer::QueryType::TIMESTAMP == openGLQueryPool.getQueryType(), "OpenGL write timestamp query needs a timestamp query pool")
+		RENDERER_ASSERT(mContext, queryIndex < openGLQueryPool.getNumberOfQueries(), "OpenGL out-of-bounds query index")
+
+		// Record the OpenGL timestamp, the query pool creation ensured that "GL_ARB_timer_query" is there
+		glQueryCounter(openGLQueryPool.getOpenGLQueries()[queryIndex], GL_TIMESTAMP);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Debug                                                 ]
+	//[-------------------------------------------------------]
+	#ifdef RENDERER_DEBUG
+		void OpenGLRenderer::setDebugMarker(const char* name)
+		{
+			// "GL_KHR_debug"-extension required
+			if (mExtensions->isGL_KHR_debug())
+			{
+				RENDERER_ASSERT(mContext, nullptr != name, "OpenGL debug marker names must not be a null pointer")
+				glDebugMessageInsert(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_MARKER, 1, GL_DEBUG_SEVERITY_NOTIFICATION, -1, name);
+			}
+		}
+
+		void OpenGLRenderer::beginDebugEvent(const char* name)
+		{
+			// "GL_KHR_debug"-extension required
 			if (mExtensions->isGL_KHR_debug())
 			{
 				RENDERER_ASSERT(mContext, nullptr != name, "OpenGL debug event names must not be a null pointer")
@@ -1891,6 +1853,24 @@ namespace OpenGLRenderer
 		return RENDERER_NEW(mContext, RenderPass)(*this, numberOfColorAttachments, colorAttachmentTextureFormats, depthStencilAttachmentTextureFormat, numberOfMultisamples);
 	}
 
+	Renderer::IQueryPool* OpenGLRenderer::createQueryPool(Renderer::QueryType queryType, uint32_t numberOfQueries)
+	{
+		// Sanity check
+		RENDERER_ASSERT(mContext, numberOfQueries > 0, "OpenGL: Number of queries mustn't be zero")
+
+		// The query type must be supported by the OpenGL context, see "initializeCapabilities()"
+		const bool supported = (Renderer::QueryType::OCCLUSION == queryType) ? mCapabilities.occlusionQuery : ((Renderer::QueryType::TIMESTAMP == queryType) ? mCapabilities.timestampQuery : mCapabilities.pipelineStatisticsQuery);
+		if (supported)
+		{
+			return RENDERER_NEW(mContext, QueryPool)(*this, queryType, numberOfQueries);
+		}
+		else
+		{
+			RENDERER_LOG(mContext, CRITICAL, "OpenGL: The asynchronous query type isn't supported by the OpenGL context")
+			return nullptr;
+		}
+	}
+
 	Renderer::ISwapChain* OpenGLRenderer::createSwapChain(Renderer::IRenderPass& renderPass, Renderer::WindowHandle windowHandle, bool useExternalContext)
 	{
 		// Sanity checks
@@ -1950,6 +1930,26 @@ namespace OpenGLRenderer
 		return RENDERER_NEW(mContext, PipelineState)(*this, pipelineState);
 	}
 
+	Renderer::IComputePipelineState* OpenGLRenderer::createComputePipelineState(Renderer::IRootSignature& rootSignature, Renderer::IComputeShader& computeShader)
+	{
+		// "GL_ARB_compute_shader" and "GL_ARB_shader_image_load_store" required
+		if (mCapabilities.computeShader)
+		{
+			// Security checks: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, rootSignature)
+			OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, computeShader)
+
+			// Create the compute pipeline state
+			return RENDERER_NEW(mContext, ComputePipelineState)(*this, rootSignature, computeShader);
+		}
+		else
+		{
+			// Error!
+			RENDERER_LOG(mContext, CRITICAL, "The OpenGL renderer backend has no compute shader support")
+			return nullptr;
+		}
+	}
+
 	Renderer::ISamplerState* OpenGLRenderer::createSamplerState(const Renderer::SamplerState& samplerState)
 	{
 		// Is "GL_ARB_sampler_objects" there?
@@ -1973,6 +1973,22 @@ namespace OpenGLRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Pipeline cache                                        ]
+	//[-------------------------------------------------------]
+	uint32_t OpenGLRenderer::getPipelineCacheData(uint8_t*, uint32_t)
+	{
+		// Not supported by the OpenGL renderer
+		return 0;
+	}
+
+	bool OpenGLRenderer::setPipelineCacheData(const uint8_t*, uint32_t)
+	{
+		// Not supported by the OpenGL renderer
+		return false;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
@@ -2074,15 +2090,18 @@ namespace OpenGLRenderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can map, set known return values
 				mappedSubresource.data		 = nullptr;
@@ -2235,21 +2254,84 @@ namespace OpenGLRenderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can unmap
 				break;
 		}
 	}
 
+	bool OpenGLRenderer::getQueryPoolResults(Renderer::IQueryPool& queryPool, uint32_t numberOfDataBytes, uint8_t* data, uint32_t firstQueryIndex, uint32_t numberOfQueries, uint32_t strideInBytes, uint32_t queryResultFlags)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		const QueryPool& openGLQueryPool = static_cast<const QueryPool&>(queryPool);
+		RENDERER_ASSERT(mContext, firstQueryIndex + numberOfQueries <= openGLQueryPool.getNumberOfQueries(), "OpenGL out-of-bounds query index")
+		const uint32_t numberOfOpenGLQueriesPerQuery = (Renderer::QueryType::PIPELINE_STATISTICS == openGLQueryPool.getQueryType()) ? QueryPool::NUMBER_OF_PIPELINE_STATISTICS : 1;
+		const uint32_t numberOfResultBytes = static_cast<uint32_t>(sizeof(uint64_t)) * numberOfOpenGLQueriesPerQuery;
+		if (0 == strideInBytes)
+		{
+			strideInBytes = numberOfResultBytes;
+		}
+		RENDERER_ASSERT(mContext, numberOfQueries > 0 && strideInBytes * (numberOfQueries - 1) + numberOfResultBytes <= numberOfDataBytes, "OpenGL query pool results data buffer is too small")
+		std::ignore = numberOfDataBytes;
+
+		// When not waiting, check whether or not all requested query results are available without stalling
+		const uint32_t* openGLQueries = openGLQueryPool.getOpenGLQueries() + firstQueryIndex * numberOfOpenGLQueriesPerQuery;
+		const uint32_t numberOfOpenGLQueries = numberOfQueries * numberOfOpenGLQueriesPerQuery;
+		if (0 == (queryResultFlags & Renderer::QueryResultFlags::WAIT))
+		{
+			for (uint32_t i = 0; i < numberOfOpenGLQueries; ++i)
+			{
+				GLuint openGLQueryResultAvailable = GL_FALSE;
+				glGetQueryObjectuivARB(openGLQueries[i], GL_QUERY_RESULT_AVAILABLE_ARB, &openGLQueryResultAvailable);
+				if (GL_FALSE == openGLQueryResultAvailable)
+				{
+					// Not ready, yet
+					return false;
+				}
+			}
+		}
+
+		// Get the query results, OpenGL timestamps are already in nanoseconds
+		// -> Without "GL_ARB_timer_query" there are only 32-bit results, which are fine for occlusion queries
+		// -> Pipeline statistics query results are written counter by counter, the OpenGL queries have the same order as the members of "Renderer::PipelineStatisticsQueryResult"
+		for (uint32_t i = 0; i < numberOfQueries; ++i)
+		{
+			uint64_t* results = reinterpret_cast<uint64_t*>(data + i * strideInBytes);
+			for (uint32_t k = 0; k < numberOfOpenGLQueriesPerQuery; ++k)
+			{
+				const GLuint openGLQuery = openGLQueries[i * numberOfOpenGLQueriesPerQuery + k];
+				if (mExtensions->isGL_ARB_timer_query())
+				{
+					glGetQueryObjectui64v(openGLQuery, GL_QUERY_RESULT_ARB, reinterpret_cast<GLuint64*>(&results[k]));
+				}
+				else
+				{
+					GLuint openGLQueryResult = 0;
+					glGetQueryObjectuivARB(openGLQuery, GL_QUERY_RESULT_ARB, &openGLQueryResult);
+					results[k] = openGLQueryResult;
+				}
+			}
+		}
+
+		// Done
+		return true;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
@@ -2557,147 +2639,606 @@ namespace OpenGLRenderer
 		// Individual uniforms ("constants" in Direct3D terminology) supported? If not, only uniform buffer objects are supported.
 		mCapabilities.individualUniforms = true;
 
-		// Instanced arrays supported? (shader model 3 feature, vertex array element advancing per-instance instead of per-vertex, "GL_ARB_instanced_arrays" required)
-		mCapabilities.instancedArrays = mExtensions->isGL_ARB_instanced_arrays();
+		// Instanced arrays supported? (shader model 3 feature, vertex array element advancing per-instance instead of per-vertex, "GL_ARB_instanced_arrays" required)
+		mCapabilities.instancedArrays = mExtensions->isGL_ARB_instanced_arrays();
+
+		// Draw instanced supported? (shader model 4 feature, build in shader variable holding the current instance ID, "GL_ARB_draw_instanced" required)
+		mCapabilities.drawInstanced = mExtensions->isGL_ARB_draw_instanced();
+
+		// Base vertex supported for draw calls?
+		mCapabilities.baseVertex = mExtensions->isGL_ARB_draw_elements_base_vertex();
+
+		// Draw indirect count supported? ("GL_ARB_indirect_parameters" required, unordered access indirect buffers require compute shaders and texture buffers)
+		mCapabilities.drawIndirectCount = (mExtensions->isGL_ARB_indirect_parameters() && mExtensions->isGL_ARB_multi_draw_indirect() && mExtensions->isGL_ARB_texture_buffer_object() && mExtensions->isGL_ARB_compute_shader() && mExtensions->isGL_ARB_shader_image_load_store());
+
+		// Asynchronous queries supported? "GL_ARB_occlusion_query" is used by all query types, timestamp queries additionally need "GL_ARB_timer_query" and pipeline statistics queries "GL_ARB_pipeline_statistics_query"
+		mCapabilities.occlusionQuery = mExtensions->isGL_ARB_occlusion_query();
+		mCapabilities.timestampQuery = (mExtensions->isGL_ARB_occlusion_query() && mExtensions->isGL_ARB_timer_query());
+		mCapabilities.pipelineStatisticsQuery = (mExtensions->isGL_ARB_occlusion_query() && mExtensions->isGL_ARB_pipeline_statistics_query());
+
+		// OpenGL has no native multi-threading
+		mCapabilities.nativeMultiThreading = false;
+
+		// We don't support the OpenGL program binaries since those are operation system and graphics driver version dependent, which renders them useless for pre-compiled shaders shipping
+		mCapabilities.shaderBytecode = mExtensions->isGL_ARB_gl_spirv();
+
+		// Is there support for vertex shaders (VS)?
+		mCapabilities.vertexShader = mExtensions->isGL_ARB_vertex_shader();
+
+		// Maximum number of vertices per patch (usually 0 for no tessellation support or 32 which is the maximum number of supported vertices per patch)
+		if (mExtensions->isGL_ARB_tessellation_shader())
+		{
+			glGetIntegerv(GL_MAX_PATCH_VERTICES, &openGLValue);
+			mCapabilities.maximumNumberOfPatchVertices = static_cast<uint32_t>(openGLValue);
+		}
+		else
+		{
+			mCapabilities.maximumNumberOfPatchVertices = 0;
+		}
+
+		// Maximum number of vertices a geometry shader can emit (usually 0 for no geometry shader support or 1024)
+		if (mExtensions->isGL_ARB_geometry_shader4())
+		{
+			glGetIntegerv(GL_MAX_GEOMETRY_OUTPUT_VERTICES_ARB, &openGLValue);
+			mCapabilities.maximumNumberOfGsOutputVertices = static_cast<uint32_t>(openGLValue);
+		}
+		else
+		{
+			mCapabilities.maximumNumberOfGsOutputVertices = 0;
+		}
+
+		// Is there support for fragment shaders (FS)?
+		mCapabilities.fragmentShader = mExtensions->isGL_ARB_fragment_shader();
+
+		// Is there support for compute shaders (CS)? "GL_ARB_shader_image_load_store" is required for unordered access views and memory barriers.
+		mCapabilities.computeShader = (mExtensions->isGL_ARB_compute_shader() && mExtensions->isGL_ARB_shader_image_load_store());
+	}
+
+	void OpenGLRenderer::iaUnsetVertexArray()
+	{
+		// Release the currently used vertex array reference, in case we have one
+		if (nullptr != mVertexArray)
+		{
+			// Evaluate the internal array type of the currently set vertex array
+			switch (static_cast<VertexArray*>(mVertexArray)->getInternalResourceType())
+			{
+				case VertexArray::InternalResourceType::NO_VAO:
+					// Disable OpenGL vertex attribute arrays
+					static_cast<VertexArrayNoVao*>(mVertexArray)->disableOpenGLVertexAttribArrays();
+					break;
+
+				case VertexArray::InternalResourceType::VAO:
+					// Unbind OpenGL vertex array
+					// -> No need to check for "GL_ARB_vertex_array_object", in case were in here we know it must exist
+					glBindVertexArray(mDefaultOpenGLVertexArray);
+					break;
+			}
+
+			// Release reference
+			mVertexArray->releaseReference();
+			mVertexArray = nullptr;
+		}
+	}
+
+	void OpenGLRenderer::setProgram(Renderer::IProgram* program)
+	{
+		if (nullptr != program)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *program)
+
+			// Prefer "GL_ARB_separate_shader_objects" over "GL_ARB_shader_objects"
+			if (mExtensions->isGL_ARB_separate_shader_objects())
+			{
+				// Bind the program pipeline, if required
+				ProgramSeparate* programSeparate = static_cast<ProgramSeparate*>(program);
+				const uint32_t openGLProgramPipeline = programSeparate->getOpenGLProgramPipeline();
+				if (openGLProgramPipeline != mOpenGLProgramPipeline)
+				{
+					mOpenGLProgramPipeline = openGLProgramPipeline;
+					{ // Draw ID uniform location for "GL_ARB_base_instance"-emulation (see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html)
+						const VertexShaderSeparate* vertexShaderSeparate = programSeparate->getVertexShaderSeparate();
+						if (nullptr != vertexShaderSeparate)
+						{
+							mOpenGLVertexProgram = vertexShaderSeparate->getOpenGLShaderProgram();
+							mDrawIdUniformLocation = vertexShaderSeparate->getDrawIdUniformLocation();
+						}
+						else
+						{
+							mOpenGLVertexProgram = 0;
+							mDrawIdUniformLocation = -1;
+						}
+						mCurrentStartInstanceLocation = ~0u;
+					}
+					glBindProgramPipeline(mOpenGLProgramPipeline);
+				}
+			}
+			else if (mExtensions->isGL_ARB_shader_objects())
+			{
+				// Bind the program, if required
+				const ProgramMonolithic* programMonolithic = static_cast<ProgramMonolithic*>(program);
+				const uint32_t openGLProgram = programMonolithic->getOpenGLProgram();
+				if (openGLProgram != mOpenGLProgram)
+				{
+					mOpenGLProgram = mOpenGLVertexProgram = openGLProgram;
+					mDrawIdUniformLocation = programMonolithic->getDrawIdUniformLocation();
+					mCurrentStartInstanceLocation = ~0u;
+					glUseProgramObjectARB(mOpenGLProgram);
+				}
+			}
+		}
+		else
+		{
+			// Prefer "GL_ARB_separate_shader_objects" over "GL_ARB_shader_objects"
+			if (mExtensions->isGL_ARB_separate_shader_objects())
+			{
+				// Unbind the program pipeline, if required
+				if (0 != mOpenGLProgramPipeline)
+				{
+					glBindProgramPipeline(0);
+					mOpenGLProgramPipeline = 0;
+				}
+			}
+			else if (mExtensions->isGL_ARB_shader_objects())
+			{
+				// Unbind the program, if required
+				if (0 != mOpenGLProgram)
+				{
+					glUseProgramObjectARB(0);
+					mOpenGLProgram = 0;
+				}
+			}
+			mOpenGLVertexProgram = 0;
+			mDrawIdUniformLocation = -1;
+			mCurrentStartInstanceLocation = ~0u;
+		}
+	}
+
+	void OpenGLRenderer::setResourceGroup(const RootSignature& rootSignature, uint32_t rootParameterIndex, Renderer::IResourceGroup* resourceGroup)
+	{
+		// Security checks
+		#ifdef RENDERER_DEBUG
+		{
+			const Renderer::RootSignature& rootSignatureData = rootSignature.getRootSignature();
+			if (rootParameterIndex >= rootSignatureData.numberOfParameters)
+			{
+				RENDERER_LOG(mContext, CRITICAL, "The OpenGL renderer backend root parameter index is out of bounds")
+				return;
+			}
+			const Renderer::RootParameter& rootParameter = rootSignatureData.parameters[rootParameterIndex];
+			if (Renderer::RootParameterType::DESCRIPTOR_TABLE != rootParameter.parameterType)
+			{
+				RENDERER_LOG(mContext, CRITICAL, "The OpenGL renderer backend root parameter index doesn't reference a descriptor table")
+				return;
+			}
+			if (nullptr == reinterpret_cast<const Renderer::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges))
+			{
+				RENDERER_LOG(mContext, CRITICAL, "The OpenGL renderer backend descriptor ranges is a null pointer")
+				return;
+			}
+		}
+		#endif
+
+		if (nullptr != resourceGroup)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *resourceGroup)
+
+			// Set resource group
+			const ResourceGroup* openGLResourceGroup = static_cast<ResourceGroup*>(resourceGroup);
+			const uint32_t numberOfResources = openGLResourceGroup->getNumberOfResources();
+			Renderer::IResource** resources = openGLResourceGroup->getResources();
+			const Renderer::RootParameter& rootParameter = rootSignature.getRootSignature().parameters[rootParameterIndex];
+			for (uint32_t resourceIndex = 0; resourceIndex < numberOfResources; ++resourceIndex, ++resources)
+			{
+				Renderer::IResource* resource = *resources;
+				RENDERER_ASSERT(mContext, nullptr != reinterpret_cast<const Renderer::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges), "Invalid OpenGL descriptor ranges")
+				const Renderer::DescriptorRange& descriptorRange = reinterpret_cast<const Renderer::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges)[resourceIndex];
+
+				// Check the type of resource to set
+				// TODO(co) Some additional resource type root signature security checks in debug build?
+				const Renderer::ResourceType resourceType = resource->getResourceType();
+				switch (resourceType)
+				{
+					case Renderer::ResourceType::UNIFORM_BUFFER:
+						// "GL_ARB_uniform_buffer_object" required
+						if (mExtensions->isGL_ARB_uniform_buffer_object())
+						{
+							// Attach the buffer to the given UBO binding point
+							// -> Explicit binding points ("layout(binding = 0)" in GLSL shader) requires OpenGL 4.2 or the "GL_ARB_explicit_uniform_location"-extension
+							// -> Direct3D 10 and Direct3D 11 have explicit binding points
+							RENDERER_ASSERT(mContext, nullptr != openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex(), "Invalid OpenGL resource index to uniform block binding index")
+							glBindBufferBase(GL_UNIFORM_BUFFER, openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex()[resourceIndex], static_cast<UniformBuffer*>(resource)->getOpenGLUniformBuffer());
+						}
+						break;
+
+					case Renderer::ResourceType::TEXTURE_BUFFER:
+					case Renderer::ResourceType::TEXTURE_1D:
+					case Renderer::ResourceType::TEXTURE_2D:
+					case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+					case Renderer::ResourceType::TEXTURE_3D:
+					case Renderer::ResourceType::TEXTURE_CUBE:
+					{
+						// In OpenGL, all shaders share the same texture units (= "Renderer::RootParameter::shaderVisibility" stays unused)
+
+						// Compute shader unordered access view: Bind the texture to an image unit instead of a texture unit
+						// -> Unordered access views visible to other shader stages are still bound as read-only texture, see "CubeRendererDrawInstanced" texture buffer usage
+						if (Renderer::DescriptorRangeType::UAV == descriptorRange.rangeType && Renderer::ShaderVisibility::COMPUTE == descriptorRange.shaderVisibility)
+						{
+							// "GL_ARB_shader_image_load_store" required
+							if (mExtensions->isGL_ARB_shader_image_load_store())
+							{
+								// -> Only texture buffers and texture 2D are supported as unordered access views, the remaining texture types would need layered image bindings
+								switch (resourceType)
+								{
+									case Renderer::ResourceType::TEXTURE_BUFFER:
+									{
+										const TextureBuffer* textureBuffer = static_cast<TextureBuffer*>(resource);
+										glBindImageTexture(descriptorRange.baseShaderRegister, textureBuffer->getOpenGLTexture(), 0, GL_FALSE, 0, GL_READ_WRITE, textureBuffer->getOpenGLInternalFormat());
+										break;
+									}
+
+									case Renderer::ResourceType::TEXTURE_2D:
+									{
+										const Texture2D* texture2D = static_cast<Texture2D*>(resource);
+										glBindImageTexture(descriptorRange.baseShaderRegister, texture2D->getOpenGLTexture(), 0, GL_FALSE, 0, GL_READ_WRITE, texture2D->getOpenGLInternalFormat());
+										break;
+									}
+
+									case Renderer::ResourceType::TEXTURE_1D:
+									case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+									case Renderer::ResourceType::TEXTURE_3D:
+									case Renderer::ResourceType::TEXTURE_CUBE:
+										RENDERER_LOG(mContext, CRITICAL, "The OpenGL renderer backend only supports texture buffer and texture 2D unordered access views")
+										break;
+
+									case Renderer::ResourceType::ROOT_SIGNATURE:
+									case Renderer::ResourceType::RESOURCE_GROUP:
+									case Renderer::ResourceType::PROGRAM:
+									case Renderer::ResourceType::VERTEX_ARRAY:
+									case Renderer::ResourceType::RENDER_PASS:
+									case Renderer::ResourceType::QUERY_POOL:
+									case Renderer::ResourceType::SWAP_CHAIN:
+									case Renderer::ResourceType::FRAMEBUFFER:
+									case Renderer::ResourceType::INDEX_BUFFER:
+									case Renderer::ResourceType::VERTEX_BUFFER:
+									case Renderer::ResourceType::UNIFORM_BUFFER:
+									case Renderer::ResourceType::INDIRECT_BUFFER:
+									case Renderer::ResourceType::PIPELINE_STATE:
+									case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
+									case Renderer::ResourceType::SAMPLER_STATE:
+									case Renderer::ResourceType::VERTEX_SHADER:
+									case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+									case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+									case Renderer::ResourceType::GEOMETRY_SHADER:
+									case Renderer::ResourceType::FRAGMENT_SHADER:
+									case Renderer::ResourceType::COMPUTE_SHADER:
+										RENDERER_LOG(mContext, CRITICAL, "Invalid OpenGL renderer backend resource type")
+										break;
+								}
+							}
+							else
+							{
+								RENDERER_LOG(mContext, CRITICAL, "The OpenGL renderer backend requires the \"GL_ARB_shader_image_load_store\"-extension for unordered access views")
+							}
+						}
+
+						// Is "GL_ARB_direct_state_access" or "GL_EXT_direct_state_access" there?
+						else if (mExtensions->isGL_ARB_direct_state_access() || mExtensions->isGL_EXT_direct_state_access())
+						{
+							// Effective direct state access (DSA)
+							const bool isArbDsa = mExtensions->isGL_ARB_direct_state_access();
+
+							// "glBindTextureUnit()" unit parameter is zero based so we can simply use the value we received
+							const GLuint unit = descriptorRange.baseShaderRegister;
+
+							// TODO(co) Some security checks might be wise *maximum number of texture units*
+							// Evaluate the texture type
+							switch (resourceType)
+							{
+								case Renderer::ResourceType::TEXTURE_BUFFER:
+									if (isArbDsa)
+									{
+										glBindTextureUnit(unit, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
+									}
+									else
+									{
+										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
+										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_BUFFER_ARB, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
+									}
+									break;
+
+								case Renderer::ResourceType::TEXTURE_1D:
+									if (isArbDsa)
+									{
+										glBindTextureUnit(unit, static_cast<Texture1D*>(resource)->getOpenGLTexture());
+									}
+									else
+									{
+										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
+										const Texture1D* texture1D = static_cast<Texture1D*>(resource);
+										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_1D, texture1D->getOpenGLTexture());
+									}
+									break;
+
+								case Renderer::ResourceType::TEXTURE_2D:
+									if (isArbDsa)
+									{
+										glBindTextureUnit(unit, static_cast<Texture2D*>(resource)->getOpenGLTexture());
+									}
+									else
+									{
+										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
+										const Texture2D* texture2D = static_cast<Texture2D*>(resource);
+										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, static_cast<GLenum>((texture2D->getNumberOfMultisamples() > 1) ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D), texture2D->getOpenGLTexture());
+									}
+									break;
+
+								case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+									// No texture 2D array extension check required, if we in here we already know it must exist
+									if (isArbDsa)
+									{
+										glBindTextureUnit(unit, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
+									}
+									else
+									{
+										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
+										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_2D_ARRAY_EXT, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
+									}
+									break;
+
+								case Renderer::ResourceType::TEXTURE_3D:
+									if (isArbDsa)
+									{
+										glBindTextureUnit(unit, static_cast<Texture3D*>(resource)->getOpenGLTexture());
+									}
+									else
+									{
+										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
+										const Texture3D* texture3D = static_cast<Texture3D*>(resource);
+										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_3D, texture3D->getOpenGLTexture());
+									}
+									break;
+
+								case Renderer::ResourceType::TEXTURE_CUBE:
+									if (isArbDsa)
+									{
+										glBindTextureUnit(unit, static_cast<TextureCube*>(resource)->getOpenGLTexture());
+									}
+									else
+									{
+										// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
+										const TextureCube* textureCube = static_cast<TextureCube*>(resource);
+										glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_CUBE_MAP, textureCube->getOpenGLTexture());
+									}
+									break;
+
+								case Renderer::ResourceType::ROOT_SIGNATURE:
+								case Renderer::ResourceType::RESOURCE_GROUP:
+								case Renderer::ResourceType::PROGRAM:
+								case Renderer::ResourceType::VERTEX_ARRAY:
+								case Renderer::ResourceType::RENDER_PASS:
+								case Renderer::ResourceType::QUERY_POOL:
+								case Renderer::ResourceType::SWAP_CHAIN:
+								case Renderer::ResourceType::FRAMEBUFFER:
+								case Renderer::ResourceType::INDEX_BUFFER:
+								case Renderer::ResourceType::VERTEX_BUFFER:
+								case Renderer::ResourceType::UNIFORM_BUFFER:
+								case Renderer::ResourceType::INDIRECT_BUFFER:
+								case Renderer::ResourceType::PIPELINE_STATE:
+								case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
+								case Renderer::ResourceType::SAMPLER_STATE:
+								case Renderer::ResourceType::VERTEX_SHADER:
+								case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+								case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+								case Renderer::ResourceType::GEOMETRY_SHADER:
+								case Renderer::ResourceType::FRAGMENT_SHADER:
+								case Renderer::ResourceType::COMPUTE_SHADER:
+									RENDERER_LOG(mContext, CRITICAL, "Invalid OpenGL renderer backend resource type")
+									break;
+							}
+
+							// Set the OpenGL sampler states, if required (texture buffer has no sampler state), it's valid that there's no sampler state (e.g. texel fetch instead of sampling might be used)
+							if (Renderer::ResourceType::TEXTURE_BUFFER != resourceType)
+							{
+								RENDERER_ASSERT(mContext, nullptr != openGLResourceGroup->getSamplerState(), "Invalid OpenGL sampler state")
+								const SamplerState* samplerState = static_cast<const SamplerState*>(openGLResourceGroup->getSamplerState()[resourceIndex]);
+								if (nullptr != samplerState)
+								{
+									// Is "GL_ARB_sampler_objects" there?
+									if (mExtensions->isGL_ARB_sampler_objects())
+									{
+										// Effective sampler object (SO)
+										glBindSampler(descriptorRange.baseShaderRegister, static_cast<const SamplerStateSo*>(samplerState)->getOpenGLSampler());
+									}
+									else
+									{
+										#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+											// Backup the currently active OpenGL texture
+											GLint openGLActiveTextureBackup = 0;
+											glGetIntegerv(GL_ACTIVE_TEXTURE, &openGLActiveTextureBackup);
+										#endif
+
+										// TODO(co) Some security checks might be wise *maximum number of texture units*
+										// Activate the texture unit we want to manipulate
+										// -> "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
+										glActiveTextureARB(GL_TEXTURE0_ARB + unit);
+
+										// Is "GL_EXT_direct_state_access" there?
+										if (mExtensions->isGL_EXT_direct_state_access())
+										{
+											// Direct state access (DSA) version to emulate a sampler object
+											static_cast<const SamplerStateDsa*>(samplerState)->setOpenGLSamplerStates();
+										}
+										else
+										{
+											// Traditional bind version to emulate a sampler object
+											static_cast<const SamplerStateBind*>(samplerState)->setOpenGLSamplerStates();
+										}
 
-		// Draw instanced supported? (shader model 4 feature, build in shader variable holding the current instance ID, "GL_ARB_draw_instanced" required)
-		mCapabilities.drawInstanced = mExtensions->isGL_ARB_draw_instanced();
+										#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+											// Be polite and restore the previous active OpenGL texture
+											glActiveTextureARB(static_cast<GLenum>(openGLActiveTextureBackup));
+										#endif
+									}
+								}
+							}
+						}
+						else
+						{
+							// Traditional bind version
 
-		// Base vertex supported for draw calls?
-		mCapabilities.baseVertex = mExtensions->isGL_ARB_draw_elements_base_vertex();
+							// "GL_ARB_multitexture" required
+							if (mExtensions->isGL_ARB_multitexture())
+							{
+								#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+									// Backup the currently active OpenGL texture
+									GLint openGLActiveTextureBackup = 0;
+									glGetIntegerv(GL_ACTIVE_TEXTURE, &openGLActiveTextureBackup);
+								#endif
 
-		// OpenGL has no native multi-threading
-		mCapabilities.nativeMultiThreading = false;
+								// TODO(co) Some security checks might be wise *maximum number of texture units*
+								// Activate the texture unit we want to manipulate
+								// -> "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
+								glActiveTextureARB(GL_TEXTURE0_ARB + descriptorRange.baseShaderRegister);
 
-		// We don't support the OpenGL program binaries since those are operation system and graphics driver version dependent, which renders them useless for pre-compiled shaders shipping
-		mCapabilities.shaderBytecode = mExtensions->isGL_ARB_gl_spirv();
+								// Evaluate the resource type
+								switch (resourceType)
+								{
+									case Renderer::ResourceType::TEXTURE_BUFFER:
+										glBindTexture(GL_TEXTURE_BUFFER_ARB, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
+										break;
 
-		// Is there support for vertex shaders (VS)?
-		mCapabilities.vertexShader = mExtensions->isGL_ARB_vertex_shader();
+									case Renderer::ResourceType::TEXTURE_1D:
+										glBindTexture(GL_TEXTURE_1D, static_cast<Texture1D*>(resource)->getOpenGLTexture());
+										break;
 
-		// Maximum number of vertices per patch (usually 0 for no tessellation support or 32 which is the maximum number of supported vertices per patch)
-		if (mExtensions->isGL_ARB_tessellation_shader())
-		{
-			glGetIntegerv(GL_MAX_PATCH_VERTICES, &openGLValue);
-			mCapabilities.maximumNumberOfPatchVertices = static_cast<uint32_t>(openGLValue);
-		}
-		else
-		{
-			mCapabilities.maximumNumberOfPatchVertices = 0;
-		}
+									case Renderer::ResourceType::TEXTURE_2D:
+									{
+										const Texture2D* texture2D = static_cast<Texture2D*>(resource);
+										glBindTexture(static_cast<GLenum>((texture2D->getNumberOfMultisamples() > 1) ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D), texture2D->getOpenGLTexture());
+										break;
+									}
 
-		// Maximum number of vertices a geometry shader can emit (usually 0 for no geometry shader support or 1024)
-		if (mExtensions->isGL_ARB_geometry_shader4())
-		{
-			glGetIntegerv(GL_MAX_GEOMETRY_OUTPUT_VERTICES_ARB, &openGLValue);
-			mCapabilities.maximumNumberOfGsOutputVertices = static_cast<uint32_t>(openGLValue);
-		}
-		else
-		{
-			mCapabilities.maximumNumberOfGsOutputVertices = 0;
-		}
+									case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+										// No extension check required, if we in here we already know it must exist
+										glBindTexture(GL_TEXTURE_2D_ARRAY_EXT, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
+										break;
 
-		// Is there support for fragment shaders (FS)?
-		mCapabilities.fragmentShader = mExtensions->isGL_ARB_fragment_shader();
-	}
+									case Renderer::ResourceType::TEXTURE_3D:
+										glBindTexture(GL_TEXTURE_3D, static_cast<Texture3D*>(resource)->getOpenGLTexture());
+										break;
 
-	void OpenGLRenderer::iaUnsetVertexArray()
-	{
-		// Release the currently used vertex array reference, in case we have one
-		if (nullptr != mVertexArray)
-		{
-			// Evaluate the internal array type of the currently set vertex array
-			switch (static_cast<VertexArray*>(mVertexArray)->getInternalResourceType())
-			{
-				case VertexArray::InternalResourceType::NO_VAO:
-					// Disable OpenGL vertex attribute arrays
-					static_cast<VertexArrayNoVao*>(mVertexArray)->disableOpenGLVertexAttribArrays();
-					break;
+									case Renderer::ResourceType::TEXTURE_CUBE:
+										glBindTexture(GL_TEXTURE_CUBE_MAP, static_cast<TextureCube*>(resource)->getOpenGLTexture());
+										break;
 
-				case VertexArray::InternalResourceType::VAO:
-					// Unbind OpenGL vertex array
-					// -> No need to check for "GL_ARB_vertex_array_object", in case were in here we know it must exist
-					glBindVertexArray(mDefaultOpenGLVertexArray);
-					break;
-			}
+									case Renderer::ResourceType::ROOT_SIGNATURE:
+									case Renderer::ResourceType::RESOURCE_GROUP:
+									case Renderer::ResourceType::PROGRAM:
+									case Renderer::ResourceType::VERTEX_ARRAY:
+									case Renderer::ResourceType::RENDER_PASS:
+									case Renderer::ResourceType::QUERY_POOL:
+									case Renderer::ResourceType::SWAP_CHAIN:
+									case Renderer::ResourceType::FRAMEBUFFER:
+									case Renderer::ResourceType::INDEX_BUFFER:
+									case Renderer::ResourceType::VERTEX_BUFFER:
+									case Renderer::ResourceType::UNIFORM_BUFFER:
+									case Renderer::ResourceType::INDIRECT_BUFFER:
+									case Renderer::ResourceType::PIPELINE_STATE:
+									case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
+									case Renderer::ResourceType::SAMPLER_STATE:
+									case Renderer::ResourceType::VERTEX_SHADER:
+									case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+									case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+									case Renderer::ResourceType::GEOMETRY_SHADER:
+									case Renderer::ResourceType::FRAGMENT_SHADER:
+									case Renderer::ResourceType::COMPUTE_SHADER:
+										RENDERER_LOG(mContext, CRITICAL, "Invalid OpenGL renderer backend resource type")
+										break;
+								}
 
-			// Release reference
-			mVertexArray->releaseReference();
-			mVertexArray = nullptr;
-		}
-	}
+								// Set the OpenGL sampler states, if required (texture buffer has no sampler state), it's valid that there's no sampler state (e.g. texel fetch instead of sampling might be used)
+								if (Renderer::ResourceType::TEXTURE_BUFFER != resourceType)
+								{
+									RENDERER_ASSERT(mContext, nullptr != openGLResourceGroup->getSamplerState(), "Invalid OpenGL sampler state")
+									const SamplerState* samplerState = static_cast<const SamplerState*>(openGLResourceGroup->getSamplerState()[resourceIndex]);
+									if (nullptr != samplerState)
+									{
+										// Is "GL_ARB_sampler_objects" there?
+										if (mExtensions->isGL_ARB_sampler_objects())
+										{
+											// Effective sampler object (SO)
+											glBindSampler(descriptorRange.baseShaderRegister, static_cast<const SamplerStateSo*>(samplerState)->getOpenGLSampler());
+										}
+										// Is "GL_EXT_direct_state_access" there?
+										else if (mExtensions->isGL_EXT_direct_state_access() || mExtensions->isGL_ARB_direct_state_access())
+										{
+											// Direct state access (DSA) version to emulate a sampler object
+											static_cast<const SamplerStateDsa*>(samplerState)->setOpenGLSamplerStates();
+										}
+										else
+										{
+											// Traditional bind version to emulate a sampler object
+											static_cast<const SamplerStateBind*>(samplerState)->setOpenGLSamplerStates();
+										}
+									}
+								}
 
-	void OpenGLRenderer::setProgram(Renderer::IProgram* program)
-	{
-		if (nullptr != program)
-		{
-			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
-			OPENGLRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *program)
+								#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+									// Be polite and restore the previous active OpenGL texture
+									glActiveTextureARB(static_cast<GLenum>(openGLActiveTextureBackup));
+								#endif
+							}
+						}
+						break;
+					}
 
-			// Prefer "GL_ARB_separate_shader_objects" over "GL_ARB_shader_objects"
-			if (mExtensions->isGL_ARB_separate_shader_objects())
-			{
-				// Bind the program pipeline, if required
-				ProgramSeparate* programSeparate = static_cast<ProgramSeparate*>(program);
-				const uint32_t openGLProgramPipeline = programSeparate->getOpenGLProgramPipeline();
-				if (openGLProgramPipeline != mOpenGLProgramPipeline)
-				{
-					mOpenGLProgramPipeline = openGLProgramPipeline;
-					{ // Draw ID uniform location for "GL_ARB_base_instance"-emulation (see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html)
-						const VertexShaderSeparate* vertexShaderSeparate = programSeparate->getVertexShaderSeparate();
-						if (nullptr != vertexShaderSeparate)
+					case Renderer::ResourceType::INDIRECT_BUFFER:
+					{
+						// Indirect buffers can only be used as compute shader unordered access view, the image unit is seen as "GL_R32UI" texture buffer
+						const IndirectBuffer* indirectBuffer = static_cast<IndirectBuffer*>(resource);
+						if (Renderer::DescriptorRangeType::UAV == descriptorRange.rangeType && Renderer::ShaderVisibility::COMPUTE == descriptorRange.shaderVisibility && 0 != indirectBuffer->getOpenGLTexture())
 						{
-							mOpenGLVertexProgram = vertexShaderSeparate->getOpenGLShaderProgram();
-							mDrawIdUniformLocation = vertexShaderSeparate->getDrawIdUniformLocation();
+							glBindImageTexture(descriptorRange.baseShaderRegister, indirectBuffer->getOpenGLTexture(), 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32UI);
 						}
 						else
 						{
-							mOpenGLVertexProgram = 0;
-							mDrawIdUniformLocation = -1;
+							RENDERER_LOG(mContext, CRITICAL, "The OpenGL renderer backend only supports indirect buffers created with \"Renderer::IndirectBufferFlag::UNORDERED_ACCESS\" as compute shader unordered access views")
 						}
-						mCurrentStartInstanceLocation = ~0u;
+						break;
 					}
-					glBindProgramPipeline(mOpenGLProgramPipeline);
-				}
-			}
-			else if (mExtensions->isGL_ARB_shader_objects())
-			{
-				// Bind the program, if required
-				const ProgramMonolithic* programMonolithic = static_cast<ProgramMonolithic*>(program);
-				const uint32_t openGLProgram = programMonolithic->getOpenGLProgram();
-				if (openGLProgram != mOpenGLProgram)
-				{
-					mOpenGLProgram = mOpenGLVertexProgram = openGLProgram;
-					mDrawIdUniformLocation = programMonolithic->getDrawIdUniformLocation();
-					mCurrentStartInstanceLocation = ~0u;
-					glUseProgramObjectARB(mOpenGLProgram);
+
+					case Renderer::ResourceType::SAMPLER_STATE:
+						// Unlike Direct3D >=10, OpenGL directly attaches the sampler settings to the texture (unless the sampler object extension is used)
+						break;
+
+					case Renderer::ResourceType::ROOT_SIGNATURE:
+					case Renderer::ResourceType::RESOURCE_GROUP:
+					case Renderer::ResourceType::PROGRAM:
+					case Renderer::ResourceType::VERTEX_ARRAY:
+					case Renderer::ResourceType::RENDER_PASS:
+					case Renderer::ResourceType::QUERY_POOL:
+					case Renderer::ResourceType::SWAP_CHAIN:
+					case Renderer::ResourceType::FRAMEBUFFER:
+					case Renderer::ResourceType::INDEX_BUFFER:
+					case Renderer::ResourceType::VERTEX_BUFFER:
+					case Renderer::ResourceType::PIPELINE_STATE:
+					case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
+					case Renderer::ResourceType::VERTEX_SHADER:
+					case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+					case Renderer::ResourceType::GEOMETRY_SHADER:
+					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
+						RENDERER_LOG(mContext, CRITICAL, "Invalid OpenGL renderer backend resource type")
+						break;
 				}
 			}
 		}
 		else
 		{
-			// Prefer "GL_ARB_separate_shader_objects" over "GL_ARB_shader_objects"
-			if (mExtensions->isGL_ARB_separate_shader_objects())
-			{
-				// Unbind the program pipeline, if required
-				if (0 != mOpenGLProgramPipeline)
-				{
-					glBindProgramPipeline(0);
-					mOpenGLProgramPipeline = 0;
-				}
-			}
-			else if (mExtensions->isGL_ARB_shader_objects())
-			{
-				// Unbind the program, if required
-				if (0 != mOpenGLProgram)
-				{
-					glUseProgramObjectARB(0);
-					mOpenGLProgram = 0;
-				}
-			}
-			mOpenGLVertexProgram = 0;
-			mDrawIdUniformLocation = -1;
-			mCurrentStartInstanceLocation = ~0u;
+			// TODO(co) Handle this situation?
 		}
 	}
 
@@ -0,0 +1,78 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "OpenGLRenderer/QueryPool.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
+#include "OpenGLRenderer/Extensions.h"
+
+#include <Renderer/IAssert.h>
+#include <Renderer/IAllocator.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	QueryPool::QueryPool(OpenGLRenderer& openGLRenderer, Renderer::QueryType queryType, uint32_t numberOfQueries) :
+		IQueryPool(openGLRenderer),
+		mQueryType(queryType),
+		mNumberOfQueries(numberOfQueries),
+		mNumberOfOpenGLQueries((Renderer::QueryType::PIPELINE_STATISTICS == queryType) ? numberOfQueries * NUMBER_OF_PIPELINE_STATISTICS : numberOfQueries),
+		mOpenGLQueries(RENDERER_MALLOC_TYPED(openGLRenderer.getContext(), uint32_t, mNumberOfOpenGLQueries))
+	{
+		// Sanity check
+		RENDERER_ASSERT(openGLRenderer.getContext(), numberOfQueries > 0, "OpenGL: Number of queries mustn't be zero")
+
+		// Create the OpenGL queries
+		// -> "GL_ARB_occlusion_query" is also used for timestamp and pipeline statistics queries since "GL_ARB_timer_query" and "GL_ARB_pipeline_statistics_query" only add query targets, "glQueryCounter()" and 64-bit results
+		glGenQueriesARB(static_cast<GLsizei>(mNumberOfOpenGLQueries), mOpenGLQueries);
+	}
+
+	QueryPool::~QueryPool()
+	{
+		// Destroy the OpenGL queries
+		// -> Silently ignores 0's and names that do not correspond to existing queries
+		glDeleteQueriesARB(static_cast<GLsizei>(mNumberOfOpenGLQueries), mOpenGLQueries);
+		RENDERER_FREE(getRenderer().getContext(), mOpenGLQueries);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::RefCount methods          ]
+	//[-------------------------------------------------------]
+	void QueryPool::selfDestruct()
+	{
+		RENDERER_DELETE(getRenderer().getContext(), QueryPool, this);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
@@ -27,6 +27,7 @@
 #include "OpenGLRenderer/Shader/Monolithic/VertexShaderMonolithic.h"
 #include "OpenGLRenderer/Shader/Monolithic/GeometryShaderMonolithic.h"
 #include "OpenGLRenderer/Shader/Monolithic/FragmentShaderMonolithic.h"
+#include "OpenGLRenderer/Shader/Monolithic/ComputeShaderMonolithic.h"
 #include "OpenGLRenderer/Shader/Monolithic/TessellationControlShaderMonolithic.h"
 #include "OpenGLRenderer/Shader/Monolithic/TessellationEvaluationShaderMonolithic.h"
 #include "OpenGLRenderer/Extensions.h"
@@ -251,6 +252,29 @@ namespace OpenGLRenderer
 		}
 	}
 
+	Renderer::IComputeShader* ShaderLanguageMonolithic::createComputeShaderFromBytecode(const Renderer::ShaderBytecode&)
+	{
+		// Error!
+		RENDERER_ASSERT(getRenderer().getContext(), false, "Monolithic shaders have no shader bytecode, only a monolithic program bytecode")
+		return nullptr;
+	}
+
+	Renderer::IComputeShader* ShaderLanguageMonolithic::createComputeShaderFromSourceCode(const Renderer::ShaderSourceCode& shaderSourceCode, Renderer::ShaderBytecode*)
+	{
+		// Check whether or not there's compute shader support
+		// -> Monolithic shaders have no shader bytecode, only a monolithic program bytecode
+		OpenGLRenderer& openGLRenderer = static_cast<OpenGLRenderer&>(getRenderer());
+		if (openGLRenderer.getExtensions().isGL_ARB_compute_shader())
+		{
+			return RENDERER_NEW(getRenderer().getContext(), ComputeShaderMonolithic)(openGLRenderer, shaderSourceCode.sourceCode);
+		}
+		else
+		{
+			// Error! There's no compute shader support!
+			return nullptr;
+		}
+	}
+
 	Renderer::IProgram* ShaderLanguageMonolithic::createProgram(const Renderer::IRootSignature& rootSignature, const Renderer::VertexAttributes& vertexAttributes, Renderer::IVertexShader* vertexShader, Renderer::ITessellationControlShader* tessellationControlShader, Renderer::ITessellationEvaluationShader* tessellationEvaluationShader, Renderer::IGeometryShader* geometryShader, Renderer::IFragmentShader* fragmentShader)
 	{
 		OpenGLRenderer& openGLRenderer = static_cast<OpenGLRenderer&>(getRenderer());
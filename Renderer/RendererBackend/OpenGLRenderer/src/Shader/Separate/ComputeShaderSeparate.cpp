@@ -0,0 +1,110 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "OpenGLRenderer/Shader/Separate/ComputeShaderSeparate.h"
+#include "OpenGLRenderer/Shader/Separate/ShaderLanguageSeparate.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
+#include "OpenGLRenderer/Extensions.h"
+
+#include <Renderer/IRenderer.h>
+#include <Renderer/IAllocator.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	ComputeShaderSeparate::ComputeShaderSeparate(OpenGLRenderer& openGLRenderer, const Renderer::ShaderBytecode& shaderBytecode) :
+		IComputeShader(static_cast<Renderer::IRenderer&>(openGLRenderer)),
+		mOpenGLShaderProgram(ShaderLanguageSeparate::loadShaderProgramFromBytecode(openGLRenderer, GL_COMPUTE_SHADER, shaderBytecode))
+	{
+		// Nothing here
+	}
+
+	ComputeShaderSeparate::ComputeShaderSeparate(OpenGLRenderer& openGLRenderer, const char* sourceCode, Renderer::ShaderBytecode* shaderBytecode) :
+		IComputeShader(static_cast<Renderer::IRenderer&>(openGLRenderer)),
+		mOpenGLShaderProgram(ShaderLanguageSeparate::loadShaderProgramFromSourceCode(openGLRenderer, GL_COMPUTE_SHADER, sourceCode))
+	{
+		// Return shader bytecode, if requested do to so
+		if (nullptr != shaderBytecode)
+		{
+			ShaderLanguageSeparate::shaderSourceCodeToShaderBytecode(openGLRenderer, GL_COMPUTE_SHADER, sourceCode, *shaderBytecode);
+		}
+	}
+
+	ComputeShaderSeparate::~ComputeShaderSeparate()
+	{
+		// Destroy the OpenGL shader program
+		// -> Silently ignores 0's and names that do not correspond to existing buffer objects
+		glDeleteProgram(mOpenGLShaderProgram);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IResource methods            ]
+	//[-------------------------------------------------------]
+	#ifdef RENDERER_DEBUG
+		void ComputeShaderSeparate::setDebugName(const char* name)
+		{
+			// Valid OpenGL shader program and "GL_KHR_debug"-extension available?
+			if (0 != mOpenGLShaderProgram && static_cast<OpenGLRenderer&>(getRenderer()).getExtensions().isGL_KHR_debug())
+			{
+				glObjectLabel(GL_PROGRAM, mOpenGLShaderProgram, -1, name);
+			}
+		}
+	#else
+		void ComputeShaderSeparate::setDebugName(const char*)
+		{
+			// Nothing here
+		}
+	#endif
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IShader methods              ]
+	//[-------------------------------------------------------]
+	const char* ComputeShaderSeparate::getShaderLanguageName() const
+	{
+		return ShaderLanguageSeparate::NAME;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::RefCount methods          ]
+	//[-------------------------------------------------------]
+	void ComputeShaderSeparate::selfDestruct()
+	{
+		RENDERER_DELETE(getRenderer().getContext(), ComputeShaderSeparate, this);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
@@ -225,6 +225,10 @@ namespace OpenGLRenderer
 								case Renderer::ShaderVisibility::FRAGMENT:
 									BIND_UNIFORM_BLOCK(mFragmentShaderSeparate)
 									break;
+
+								case Renderer::ShaderVisibility::COMPUTE:
+									// Nothing here, compute shaders are never part of a graphics program
+									break;
 							}
 							#undef BIND_UNIFORM_BLOCK
 							++uniformBlockBindingIndex;
@@ -261,6 +265,10 @@ namespace OpenGLRenderer
 								case Renderer::ShaderVisibility::FRAGMENT:
 									BIND_UNIFORM_LOCATION(mFragmentShaderSeparate)
 									break;
+
+								case Renderer::ShaderVisibility::COMPUTE:
+									// Nothing here, compute shaders are never part of a graphics program
+									break;
 							}
 							#undef BIND_UNIFORM_LOCATION
 						}
@@ -30,6 +30,7 @@
 #include "OpenGLRenderer/Shader/Separate/VertexShaderSeparate.h"
 #include "OpenGLRenderer/Shader/Separate/GeometryShaderSeparate.h"
 #include "OpenGLRenderer/Shader/Separate/FragmentShaderSeparate.h"
+#include "OpenGLRenderer/Shader/Separate/ComputeShaderSeparate.h"
 #include "OpenGLRenderer/Shader/Separate/TessellationControlShaderSeparate.h"
 #include "OpenGLRenderer/Shader/Separate/TessellationEvaluationShaderSeparate.h"
 #include "OpenGLRenderer/Extensions.h"
@@ -360,14 +361,15 @@ namespace OpenGLRenderer
 				case GL_FRAGMENT_SHADER_ARB:
 					shLanguage = EShLangFragment;
 					break;
+
+				case GL_COMPUTE_SHADER:
+					shLanguage = EShLangCompute;
+					break;
 			}
 			glslang::TShader shader(shLanguage);
 			shader.setEnvInput(glslang::EShSourceGlsl, shLanguage, glslang::EShClientOpenGL, glslVersion);
 			shader.setEntryPoint("main");
-			{
-				const char* sourcePointers[] = { sourceCode };
-				shader.setStrings(sourcePointers, 1);
-			}
+			shader.setStrings(&sourceCode, 1);	// "glslang::TShader::setStrings()" only stores the given pointer, it must remain valid until the shader has been parsed
 			const EShMessages shMessages = static_cast<EShMessages>(EShMsgDefault);
 			if (shader.parse(&::detail::DefaultTBuiltInResource, glslVersion, false, shMessages))
 			{
@@ -619,6 +621,38 @@ namespace OpenGLRenderer
 		}
 	}
 
+	Renderer::IComputeShader* ShaderLanguageSeparate::createComputeShaderFromBytecode(const Renderer::ShaderBytecode& shaderBytecode)
+	{
+		// Check whether or not there's compute shader support
+		OpenGLRenderer& openGLRenderer = static_cast<OpenGLRenderer&>(getRenderer());
+		const Extensions& extensions = openGLRenderer.getExtensions();
+		if (extensions.isGL_ARB_compute_shader() && extensions.isGL_ARB_gl_spirv())
+		{
+			return RENDERER_NEW(getRenderer().getContext(), ComputeShaderSeparate)(openGLRenderer, shaderBytecode);
+		}
+		else
+		{
+			// Error! There's no compute shader support or no decent shader bytecode support!
+			return nullptr;
+		}
+	}
+
+	Renderer::IComputeShader* ShaderLanguageSeparate::createComputeShaderFromSourceCode(const Renderer::ShaderSourceCode& shaderSourceCode, Renderer::ShaderBytecode* shaderBytecode)
+	{
+		// Check whether or not there's compute shader support
+		OpenGLRenderer& openGLRenderer = static_cast<OpenGLRenderer&>(getRenderer());
+		const Extensions& extensions = openGLRenderer.getExtensions();
+		if (extensions.isGL_ARB_compute_shader())
+		{
+			return RENDERER_NEW(getRenderer().getContext(), ComputeShaderSeparate)(openGLRenderer, shaderSourceCode.sourceCode, extensions.isGL_ARB_gl_spirv() ? shaderBytecode : nullptr);
+		}
+		else
+		{
+			// Error! There's no compute shader support!
+			return nullptr;
+		}
+	}
+
 	Renderer::IProgram* ShaderLanguageSeparate::createProgram(const Renderer::IRootSignature& rootSignature, const Renderer::VertexAttributes&, Renderer::IVertexShader* vertexShader, Renderer::ITessellationControlShader* tessellationControlShader, Renderer::ITessellationEvaluationShader* tessellationEvaluationShader, Renderer::IGeometryShader* geometryShader, Renderer::IFragmentShader* fragmentShader)
 	{
 		OpenGLRenderer& openGLRenderer = static_cast<OpenGLRenderer&>(getRenderer());
@@ -0,0 +1,180 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "OpenGLRenderer/State/ComputePipelineState.h"
+#include "OpenGLRenderer/Shader/Monolithic/ComputeShaderMonolithic.h"
+#include "OpenGLRenderer/Shader/Monolithic/ShaderLanguageMonolithic.h"
+#include "OpenGLRenderer/Shader/Separate/ComputeShaderSeparate.h"
+#include "OpenGLRenderer/Shader/Separate/ShaderLanguageSeparate.h"
+#include "OpenGLRenderer/OpenGLRuntimeLinking.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
+#include "OpenGLRenderer/RootSignature.h"
+#include "OpenGLRenderer/Extensions.h"
+
+#include <Renderer/ILog.h>
+#include <Renderer/IAssert.h>
+#include <Renderer/IAllocator.h>
+
+#include <cstring>	// For "strcmp()"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	ComputePipelineState::ComputePipelineState(OpenGLRenderer& openGLRenderer, const Renderer::IRootSignature& rootSignature, Renderer::IComputeShader& computeShader) :
+		IComputePipelineState(openGLRenderer),
+		mComputeShader(computeShader),
+		mOpenGLProgram(0),
+		mOwnsOpenGLProgram(false)
+	{
+		// Add a reference to the given compute shader
+		mComputeShader.addReference();
+
+		// Get the OpenGL program
+		if (0 == strcmp(computeShader.getShaderLanguageName(), ShaderLanguageSeparate::NAME))
+		{
+			// The separable OpenGL shader program of the compute shader can be used as it is
+			mOpenGLProgram = static_cast<ComputeShaderSeparate&>(computeShader).getOpenGLShaderProgram();
+		}
+		else
+		{
+			RENDERER_ASSERT(openGLRenderer.getContext(), 0 == strcmp(computeShader.getShaderLanguageName(), ShaderLanguageMonolithic::NAME), "Invalid OpenGL compute shader language")
+
+			// Link a program which only consists of the monolithic compute shader
+			mOpenGLProgram = glCreateProgramObjectARB();
+			mOwnsOpenGLProgram = true;
+			glAttachObjectARB(mOpenGLProgram, static_cast<ComputeShaderMonolithic&>(computeShader).getOpenGLShader());
+			glLinkProgramARB(mOpenGLProgram);
+
+			// Check the link status
+			GLint linked = GL_FALSE;
+			glGetObjectParameterivARB(mOpenGLProgram, GL_OBJECT_LINK_STATUS_ARB, &linked);
+			if (GL_TRUE != linked)
+			{
+				// Error, program link failed!
+
+				// Get the length of the information (including a null termination)
+				GLint informationLength = 0;
+				glGetObjectParameterivARB(mOpenGLProgram, GL_OBJECT_INFO_LOG_LENGTH_ARB, &informationLength);
+				if (informationLength > 1)
+				{
+					// Allocate memory for the information
+					const Renderer::Context& context = openGLRenderer.getContext();
+					char* informationLog = RENDERER_MALLOC_TYPED(context, char, informationLength);
+
+					// Get the information
+					glGetInfoLogARB(mOpenGLProgram, informationLength, nullptr, informationLog);
+
+					// Output the debug string
+					RENDERER_LOG(context, CRITICAL, informationLog)
+
+					// Cleanup information memory
+					RENDERER_FREE(context, informationLog);
+				}
+
+				// Destroy the OpenGL program
+				glDeleteObjectARB(mOpenGLProgram);
+				mOpenGLProgram = 0;
+				mOwnsOpenGLProgram = false;
+			}
+		}
+
+		// The actual locations assigned to uniform variables are not known until the program object is linked successfully
+		// -> So we have to build a root signature parameter index -> uniform location mapping here
+		// -> Compute shaders require OpenGL 4.3 so "glProgramUniform1i()" is always available
+		if (0 != mOpenGLProgram)
+		{
+			const Renderer::RootSignature& rootSignatureData = static_cast<const RootSignature&>(rootSignature).getRootSignature();
+			const uint32_t numberOfRootParameters = rootSignatureData.numberOfParameters;
+			uint32_t uniformBlockBindingIndex = 0;
+			for (uint32_t rootParameterIndex = 0; rootParameterIndex < numberOfRootParameters; ++rootParameterIndex)
+			{
+				const Renderer::RootParameter& rootParameter = rootSignatureData.parameters[rootParameterIndex];
+				if (Renderer::RootParameterType::DESCRIPTOR_TABLE == rootParameter.parameterType)
+				{
+					RENDERER_ASSERT(openGLRenderer.getContext(), nullptr != reinterpret_cast<const Renderer::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges), "Invalid OpenGL descriptor ranges")
+					const uint32_t numberOfDescriptorRanges = rootParameter.descriptorTable.numberOfDescriptorRanges;
+					for (uint32_t descriptorRangeIndex = 0; descriptorRangeIndex < numberOfDescriptorRanges; ++descriptorRangeIndex)
+					{
+						const Renderer::DescriptorRange& descriptorRange = reinterpret_cast<const Renderer::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges)[descriptorRangeIndex];
+
+						// Ignore sampler range types in here (OpenGL handles samplers in a different way then Direct3D 10>=)
+						if (Renderer::DescriptorRangeType::UBV == descriptorRange.rangeType)
+						{
+							const GLuint uniformBlockIndex = glGetUniformBlockIndex(mOpenGLProgram, descriptorRange.baseShaderRegisterName);
+							if (GL_INVALID_INDEX != uniformBlockIndex)
+							{
+								// Associate the uniform block with the given binding point
+								glUniformBlockBinding(mOpenGLProgram, uniformBlockIndex, uniformBlockBindingIndex);
+								++uniformBlockBindingIndex;
+							}
+						}
+						else if (Renderer::DescriptorRangeType::SAMPLER != descriptorRange.rangeType)
+						{
+							// Texture unit for shader resource views, image unit for unordered access views
+							const GLint uniformLocation = glGetUniformLocationARB(mOpenGLProgram, descriptorRange.baseShaderRegisterName);
+							if (uniformLocation >= 0)
+							{
+								glProgramUniform1i(mOpenGLProgram, uniformLocation, static_cast<GLint>(descriptorRange.baseShaderRegister));
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	ComputePipelineState::~ComputePipelineState()
+	{
+		// Destroy the OpenGL program, if it's owned by this compute pipeline state
+		// -> A value of 0 for program will be silently ignored
+		if (mOwnsOpenGLProgram)
+		{
+			glDeleteObjectARB(mOpenGLProgram);
+		}
+
+		// Release the compute shader reference
+		mComputeShader.releaseReference();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::RefCount methods          ]
+	//[-------------------------------------------------------]
+	void ComputePipelineState::selfDestruct()
+	{
+		RENDERER_DELETE(getRenderer().getContext(), ComputePipelineState, this);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
@@ -25,6 +25,7 @@
 #include "OpenGLRenderer/OpenGLRuntimeLinking.h"
 #include "OpenGLRenderer/OpenGLRenderer.h"
 #include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/Mapping.h"
 
 #include <Renderer/IRenderer.h>
 #include <Renderer/IAllocator.h>
@@ -80,10 +81,11 @@ namespace OpenGLRenderer
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
-	Texture2D::Texture2D(OpenGLRenderer& openGLRenderer, uint32_t width, uint32_t height, uint8_t numberOfMultisamples) :
+	Texture2D::Texture2D(OpenGLRenderer& openGLRenderer, uint32_t width, uint32_t height, Renderer::TextureFormat::Enum textureFormat, uint8_t numberOfMultisamples) :
 		ITexture2D(static_cast<Renderer::IRenderer&>(openGLRenderer), width, height),
 		mNumberOfMultisamples(numberOfMultisamples),
 		mOpenGLTexture(0),
+		mOpenGLInternalFormat(Mapping::getOpenGLInternalFormat(textureFormat)),
 		mGenerateMipmaps(false)
 	{
 		// Nothing here
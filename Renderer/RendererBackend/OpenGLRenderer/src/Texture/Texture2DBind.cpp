@@ -41,7 +41,7 @@ namespace OpenGLRenderer
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	Texture2DBind::Texture2DBind(OpenGLRenderer& openGLRenderer, uint32_t width, uint32_t height, Renderer::TextureFormat::Enum textureFormat, const void* data, uint32_t flags, uint8_t numberOfMultisamples) :
-		Texture2D(openGLRenderer, width, height, numberOfMultisamples)
+		Texture2D(openGLRenderer, width, height, textureFormat, numberOfMultisamples)
 	{
 		// Sanity checks
 		RENDERER_ASSERT(openGLRenderer.getContext(), numberOfMultisamples == 1 || numberOfMultisamples == 2 || numberOfMultisamples == 4 || numberOfMultisamples == 8, "Invalid OpenGL texture parameters")
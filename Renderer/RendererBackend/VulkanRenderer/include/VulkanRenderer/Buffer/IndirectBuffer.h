@@ -77,8 +77,10 @@ namespace VulkanRenderer
 		*    Indirect buffer data, can be a null pointer (empty buffer)
 		*  @param[in] bufferUsage
 		*    Indication of the buffer usage
+		*  @param[in] indirectBufferFlags
+		*    Indirect buffer flags, see "Renderer::IndirectBufferFlag"
 		*/
-		IndirectBuffer(VulkanRenderer& vulkanRenderer, uint32_t numberOfBytes, const void* data = nullptr, Renderer::BufferUsage bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW);
+		IndirectBuffer(VulkanRenderer& vulkanRenderer, uint32_t numberOfBytes, const void* data = nullptr, Renderer::BufferUsage bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW, uint32_t indirectBufferFlags = 0);
 
 		/**
 		*  @brief
@@ -104,6 +106,15 @@ namespace VulkanRenderer
 		*/
 		inline VkDeviceMemory getVkDeviceMemory() const;
 
+		/**
+		*  @brief
+		*    Return the Vulkan buffer view used as compute shader unordered access view
+		*
+		*  @return
+		*    The "VK_FORMAT_R32_UINT" Vulkan buffer view, "VK_NULL_HANDLE" if the indirect buffer wasn't created with "Renderer::IndirectBufferFlag::UNORDERED_ACCESS"
+		*/
+		inline VkBufferView getVkBufferView() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IIndirectBuffer methods      ]
@@ -140,6 +151,7 @@ namespace VulkanRenderer
 	private:
 		VkBuffer	   mVkBuffer;		///< Vulkan indirect buffer
 		VkDeviceMemory mVkDeviceMemory;	///< Vulkan indirect memory
+		VkBufferView   mVkBufferView;	///< Vulkan buffer view, only created for "Renderer::IndirectBufferFlag::UNORDERED_ACCESS", can be "VK_NULL_HANDLE"
 
 
 	};
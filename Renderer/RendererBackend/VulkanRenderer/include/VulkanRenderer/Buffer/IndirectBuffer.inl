@@ -38,6 +38,11 @@ namespace VulkanRenderer
 		return mVkDeviceMemory;
 	}
 
+	inline VkBufferView IndirectBuffer::getVkBufferView() const
+	{
+		return mVkBufferView;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IIndirectBuffer methods      ]
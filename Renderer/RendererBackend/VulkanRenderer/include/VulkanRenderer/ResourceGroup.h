@@ -74,6 +74,8 @@ namespace VulkanRenderer
 		*
 		*  @param[in] rootSignature
 		*    Root signature
+		*  @param[in] rootParameterIndex
+		*    The root parameter index number for binding
 		*  @param[in] vkDescriptorSet
 		*    Wrapped Vulkan descriptor set
 		*  @param[in] numberOfResources
@@ -83,7 +85,7 @@ namespace VulkanRenderer
 		*  @param[in] samplerStates
 		*    If not a null pointer at least "numberOfResources" sampler state pointers, must be valid if there's at least one texture resource, the resource group will keep a reference to the sampler states
 		*/
-		ResourceGroup(RootSignature& rootSignature, VkDescriptorSet vkDescriptorSet, uint32_t numberOfResources, Renderer::IResource** resources, Renderer::ISamplerState** samplerStates);
+		ResourceGroup(RootSignature& rootSignature, uint32_t rootParameterIndex, VkDescriptorSet vkDescriptorSet, uint32_t numberOfResources, Renderer::IResource** resources, Renderer::ISamplerState** samplerStates);
 
 		/**
 		*  @brief
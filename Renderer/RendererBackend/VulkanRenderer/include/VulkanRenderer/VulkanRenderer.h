@@ -159,12 +159,27 @@ namespace VulkanRenderer
 		*/
 		inline const VulkanContext& getVulkanContext() const;
 
+		/**
+		*  @brief
+		*    Return the Vulkan pipeline cache used for all pipeline creations
+		*
+		*  @return
+		*    The Vulkan pipeline cache, can be "VK_NULL_HANDLE", do not destroy the returned instance
+		*
+		*  @note
+		*    - The Vulkan pipeline cache is internally synchronized, so pipeline states can be created from multiple threads
+		*/
+		inline VkPipelineCache getVkPipelineCache() const;
+
 		//[-------------------------------------------------------]
 		//[ States                                                ]
 		//[-------------------------------------------------------]
 		void setGraphicsRootSignature(Renderer::IRootSignature* rootSignature);
 		void setGraphicsResourceGroup(uint32_t rootParameterIndex, Renderer::IResourceGroup* resourceGroup);
+		void setComputeRootSignature(Renderer::IRootSignature* rootSignature);
+		void setComputeResourceGroup(uint32_t rootParameterIndex, Renderer::IResourceGroup* resourceGroup);
 		void setPipelineState(Renderer::IPipelineState* pipelineState);
+		void setComputePipelineState(Renderer::IComputePipelineState* computePipelineState);
 		//[-------------------------------------------------------]
 		//[ Input-assembler (IA) stage                            ]
 		//[-------------------------------------------------------]
@@ -191,6 +206,18 @@ namespace VulkanRenderer
 		void drawEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		void drawIndexed(const Renderer::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		void drawIndexedEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
+		void drawIndexedIndirectCount(const Renderer::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, const Renderer::IIndirectBuffer& countBuffer, uint32_t countBufferOffset, uint32_t maximumNumberOfDraws);
+		//[-------------------------------------------------------]
+		//[ Compute                                               ]
+		//[-------------------------------------------------------]
+		void dispatchCompute(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ);
+		//[-------------------------------------------------------]
+		//[ Query                                                 ]
+		//[-------------------------------------------------------]
+		void resetQueryPool(Renderer::IQueryPool& queryPool, uint32_t firstQueryIndex, uint32_t numberOfQueries);
+		void beginQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex);
+		void endQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex);
+		void writeTimestampQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex);
 		//[-------------------------------------------------------]
 		//[ Debug                                                 ]
 		//[-------------------------------------------------------]
@@ -218,18 +245,26 @@ namespace VulkanRenderer
 		//[ Resource creation                                     ]
 		//[-------------------------------------------------------]
 		virtual Renderer::IRenderPass* createRenderPass(uint32_t numberOfColorAttachments, const Renderer::TextureFormat::Enum* colorAttachmentTextureFormats, Renderer::TextureFormat::Enum depthStencilAttachmentTextureFormat = Renderer::TextureFormat::UNKNOWN, uint8_t numberOfMultisamples = 1) override;
+		virtual Renderer::IQueryPool* createQueryPool(Renderer::QueryType queryType, uint32_t numberOfQueries = 1) override;
 		virtual Renderer::ISwapChain* createSwapChain(Renderer::IRenderPass& renderPass, Renderer::WindowHandle windowHandle, bool useExternalContext = false) override;
 		virtual Renderer::IFramebuffer* createFramebuffer(Renderer::IRenderPass& renderPass, const Renderer::FramebufferAttachment* colorFramebufferAttachments, const Renderer::FramebufferAttachment* depthStencilFramebufferAttachment = nullptr) override;
 		virtual Renderer::IBufferManager* createBufferManager() override;
 		virtual Renderer::ITextureManager* createTextureManager() override;
 		virtual Renderer::IRootSignature* createRootSignature(const Renderer::RootSignature& rootSignature) override;
 		virtual Renderer::IPipelineState* createPipelineState(const Renderer::PipelineState& pipelineState) override;
+		virtual Renderer::IComputePipelineState* createComputePipelineState(Renderer::IRootSignature& rootSignature, Renderer::IComputeShader& computeShader) override;
 		virtual Renderer::ISamplerState* createSamplerState(const Renderer::SamplerState& samplerState) override;
 		//[-------------------------------------------------------]
+		//[ Pipeline cache                                        ]
+		//[-------------------------------------------------------]
+		virtual uint32_t getPipelineCacheData(uint8_t* data, uint32_t numberOfBytes) override;
+		virtual bool setPipelineCacheData(const uint8_t* data, uint32_t numberOfBytes) override;
+		//[-------------------------------------------------------]
 		//[ Resource handling                                     ]
 		//[-------------------------------------------------------]
 		virtual bool map(Renderer::IResource& resource, uint32_t subresource, Renderer::MapType mapType, uint32_t mapFlags, Renderer::MappedSubresource& mappedSubresource) override;
 		virtual void unmap(Renderer::IResource& resource, uint32_t subresource) override;
+		virtual bool getQueryPoolResults(Renderer::IQueryPool& queryPool, uint32_t numberOfDataBytes, uint8_t* data, uint32_t firstQueryIndex = 0, uint32_t numberOfQueries = 1, uint32_t strideInBytes = 0, uint32_t queryResultFlags = 0) override;
 		//[-------------------------------------------------------]
 		//[ Operations                                            ]
 		//[-------------------------------------------------------]
@@ -275,6 +310,35 @@ namespace VulkanRenderer
 		*/
 		void beginVulkanRenderPass();
 
+		/**
+		*  @brief
+		*    Set resource group, used for both graphics and compute
+		*
+		*  @param[in] rootSignature
+		*    Root signature the resource group is used with
+		*  @param[in] vkPipelineBindPoint
+		*    Vulkan pipeline bind point to bind the descriptor set to
+		*  @param[in] rootParameterIndex
+		*    Root parameter index
+		*  @param[in] resourceGroup
+		*    Resource group to set, can be a null pointer
+		*/
+		void setResourceGroup(const RootSignature& rootSignature, VkPipelineBindPoint vkPipelineBindPoint, uint32_t rootParameterIndex, Renderer::IResourceGroup* resourceGroup);
+
+		/**
+		*  @brief
+		*    Create the Vulkan pipeline cache and replace the current one, if there's one
+		*
+		*  @param[in] data
+		*    Initial pipeline cache data, can be a null pointer
+		*  @param[in] numberOfBytes
+		*    Number of bytes of the initial pipeline cache data
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (the current Vulkan pipeline cache is left untouched)
+		*/
+		bool createVkPipelineCache(const uint8_t* data, uint32_t numberOfBytes);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -283,8 +347,10 @@ namespace VulkanRenderer
 		VkAllocationCallbacks		mVkAllocationCallbacks;		///< Vulkan allocation callbacks
 		VulkanRuntimeLinking*		mVulkanRuntimeLinking;		///< Vulkan runtime linking instance, always valid
 		VulkanContext*				mVulkanContext;				///< Vulkan context instance, always valid
+		VkPipelineCache				mVkPipelineCache;			///< Vulkan pipeline cache used for all pipeline creations, can be "VK_NULL_HANDLE"
 		Renderer::IShaderLanguage*	mShaderLanguageGlsl;		///< GLSL shader language instance (we keep a reference to it), can be a null pointer
 		RootSignature*				mGraphicsRootSignature;		///< Currently set graphics root signature (we keep a reference to it), can be a null pointer
+		RootSignature*				mComputeRootSignature;		///< Currently set compute root signature (we keep a reference to it), can be a null pointer
 		Renderer::ISamplerState*	mDefaultSamplerState;		///< Default rasterizer state (we keep a reference to it), can be a null pointer
 		bool						mInsideVulkanRenderPass;	///< Some Vulkan commands like "vkCmdClearColorImage()" can only be executed outside a Vulkan render pass, so need to delay starting a Vulkan render pass
 		VkClearValues				mVkClearValues;
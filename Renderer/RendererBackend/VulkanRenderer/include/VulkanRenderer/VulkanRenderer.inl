@@ -48,6 +48,11 @@ namespace VulkanRenderer
 		return *mVulkanContext;
 	}
 
+	inline VkPipelineCache VulkanRenderer::getVkPipelineCache() const
+	{
+		return mVkPipelineCache;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
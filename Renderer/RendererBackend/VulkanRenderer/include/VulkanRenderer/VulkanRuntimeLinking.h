@@ -310,6 +310,7 @@ FNPTR(vkCreateFramebuffer)
 FNPTR(vkDestroyFramebuffer)
 FNPTR(vkCreatePipelineCache)
 FNPTR(vkDestroyPipelineCache)
+FNPTR(vkGetPipelineCacheData)
 FNPTR(vkCreatePipelineLayout)
 FNPTR(vkDestroyPipelineLayout)
 FNPTR(vkCreateGraphicsPipelines)
@@ -329,6 +330,7 @@ FNPTR(vkCmdBeginQuery)
 FNPTR(vkCmdEndQuery)
 FNPTR(vkCmdResetQueryPool)
 FNPTR(vkCmdCopyQueryPoolResults)
+FNPTR(vkCmdWriteTimestamp)
 FNPTR(vkCmdPipelineBarrier)
 FNPTR(vkCmdBeginRenderPass)
 FNPTR(vkCmdEndRenderPass)
@@ -360,6 +362,8 @@ FNPTR(vkDebugMarkerSetObjectNameEXT)
 FNPTR(vkCmdDebugMarkerBeginEXT)
 FNPTR(vkCmdDebugMarkerEndEXT)
 FNPTR(vkCmdDebugMarkerInsertEXT)
+// "VK_KHR_draw_indirect_count"-extension or "VK_AMD_draw_indirect_count"-extension
+FNPTR(vkCmdDrawIndexedIndirectCountAMD)
 // "VK_KHR_swapchain"-extension
 FNPTR(vkCreateSwapchainKHR)
 FNPTR(vkDestroySwapchainKHR)
@@ -43,18 +43,46 @@ namespace VulkanRenderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	IndirectBuffer::IndirectBuffer(VulkanRenderer& vulkanRenderer, uint32_t numberOfBytes, const void* data, Renderer::BufferUsage) :
+	IndirectBuffer::IndirectBuffer(VulkanRenderer& vulkanRenderer, uint32_t numberOfBytes, const void* data, Renderer::BufferUsage, uint32_t indirectBufferFlags) :
 		IIndirectBuffer(vulkanRenderer),
 		mVkBuffer(VK_NULL_HANDLE),
-		mVkDeviceMemory(VK_NULL_HANDLE)
+		mVkDeviceMemory(VK_NULL_HANDLE),
+		mVkBufferView(VK_NULL_HANDLE)
 	{
-		Helper::createAndAllocateVkBuffer(vulkanRenderer, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+		// Indirect buffers which can be written by compute shaders are additionally storage texel buffers, "VK_FORMAT_R32_UINT" storage texel buffers are always supported
+		const bool unorderedAccess = (0 != (indirectBufferFlags & Renderer::IndirectBufferFlag::UNORDERED_ACCESS));
+		const VkBufferUsageFlags vkBufferUsageFlags = unorderedAccess ? (VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT) : VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+		Helper::createAndAllocateVkBuffer(vulkanRenderer, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlags), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+
+		// Create Vulkan buffer view
+		if (unorderedAccess)
+		{
+			const VkBufferViewCreateInfo vkBufferViewCreateInfo =
+			{
+				VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO,	// sType (VkStructureType)
+				nullptr,									// pNext (const void*)
+				0,											// flags (VkBufferViewCreateFlags)
+				mVkBuffer,									// buffer (VkBuffer)
+				VK_FORMAT_R32_UINT,							// format (VkFormat)
+				0,											// offset (VkDeviceSize)
+				VK_WHOLE_SIZE								// range (VkDeviceSize)
+			};
+			if (vkCreateBufferView(vulkanRenderer.getVulkanContext().getVkDevice(), &vkBufferViewCreateInfo, vulkanRenderer.getVkAllocationCallbacks(), &mVkBufferView) != VK_SUCCESS)
+			{
+				RENDERER_LOG(vulkanRenderer.getContext(), CRITICAL, "Failed to create the Vulkan buffer view")
+			}
+		}
 		SET_DEFAULT_DEBUG_NAME	// setDebugName("");
 	}
 
 	IndirectBuffer::~IndirectBuffer()
 	{
-		Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRenderer&>(getRenderer()), mVkBuffer, mVkDeviceMemory);
+		const VulkanRenderer& vulkanRenderer = static_cast<const VulkanRenderer&>(getRenderer());
+		if (VK_NULL_HANDLE != mVkBufferView)
+		{
+			vkDestroyBufferView(vulkanRenderer.getVulkanContext().getVkDevice(), mVkBufferView, vulkanRenderer.getVkAllocationCallbacks());
+		}
+		Helper::destroyAndFreeVkBuffer(vulkanRenderer, mVkBuffer, mVkDeviceMemory);
 	}
 
 
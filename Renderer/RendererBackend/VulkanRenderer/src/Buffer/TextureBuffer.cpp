@@ -50,7 +50,18 @@ namespace VulkanRenderer
 		mVkDeviceMemory(VK_NULL_HANDLE),
 		mVkBufferView(VK_NULL_HANDLE)
 	{
-		Helper::createAndAllocateVkBuffer(vulkanRenderer, VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+		// Texture buffers can be used as compute shader unordered access view if the texture format supports it
+		const VkFormat vkFormat = Mapping::getVulkanFormat(textureFormat);
+		VkBufferUsageFlags vkBufferUsageFlags = VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT;
+		{
+			VkFormatProperties vkFormatProperties;
+			vkGetPhysicalDeviceFormatProperties(vulkanRenderer.getVulkanContext().getVkPhysicalDevice(), vkFormat, &vkFormatProperties);
+			if (vkFormatProperties.bufferFeatures & VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_BIT)
+			{
+				vkBufferUsageFlags |= VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+			}
+		}
+		Helper::createAndAllocateVkBuffer(vulkanRenderer, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlags), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
 
 		// Create Vulkan buffer view
 		const VkBufferViewCreateInfo vkBufferViewCreateInfo =
@@ -59,7 +70,7 @@ namespace VulkanRenderer
 			nullptr,									// pNext (const void*)
 			0,											// flags (VkBufferViewCreateFlags)
 			mVkBuffer,									// buffer (VkBuffer)
-			Mapping::getVulkanFormat(textureFormat),	// format (VkFormat)
+			vkFormat,									// format (VkFormat)
 			0,											// offset (VkDeviceSize)
 			VK_WHOLE_SIZE								// range (VkDeviceSize)
 		};
@@ -181,6 +181,16 @@ namespace VulkanRenderer
 			vkImageMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 			vkImageMemoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 		}
+		else if (VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL == oldVkImageLayout && VK_IMAGE_LAYOUT_GENERAL == newVkImageLayout)
+		{
+			vkImageMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			vkImageMemoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		}
+		else if (VK_IMAGE_LAYOUT_PREINITIALIZED == oldVkImageLayout && VK_IMAGE_LAYOUT_GENERAL == newVkImageLayout)
+		{
+			vkImageMemoryBarrier.srcAccessMask = 0;
+			vkImageMemoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		}
 		else if (VK_IMAGE_LAYOUT_UNDEFINED == oldVkImageLayout && VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL == newVkImageLayout)
 		{
 			vkImageMemoryBarrier.srcAccessMask = 0;
@@ -431,6 +441,12 @@ namespace VulkanRenderer
 		{
 			vkImageUsageFlags |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
 		}
+		const bool unorderedAccess = (0 != (flags & Renderer::TextureFlag::UNORDERED_ACCESS));
+		RENDERER_ASSERT(vulkanRenderer.getContext(), !unorderedAccess || !generateMipmaps, "Vulkan unordered access textures can't automatically generate mipmaps")
+		if (unorderedAccess)
+		{
+			vkImageUsageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
+		}
 
 		// Get Vulkan format
 		const VkFormat vkFormat   = Mapping::getVulkanFormat(textureFormat);
@@ -523,7 +539,8 @@ namespace VulkanRenderer
 				vkCmdCopyBufferToImage(vkCommandBuffer, stagingVkBuffer, vkImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(vkBufferImageCopyList.size()), vkBufferImageCopyList.data());
 
 				// End and destroy Vulkan command buffer
-				transitionVkImageLayout(vulkanRenderer, vkCommandBuffer, vkImage, vkImageAspectFlags, numberOfMipmaps, layerCount, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+				// -> Unordered access textures stay in general image layout so they can be used as storage image as well as sampled image
+				transitionVkImageLayout(vulkanRenderer, vkCommandBuffer, vkImage, vkImageAspectFlags, numberOfMipmaps, layerCount, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, unorderedAccess ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 				endSingleTimeCommands(vulkanRenderer, vkCommandBuffer);
 			}
 
@@ -612,6 +629,13 @@ namespace VulkanRenderer
 				endSingleTimeCommands(vulkanRenderer, vkCommandBuffer);
 			}
 		}
+		else if (unorderedAccess)
+		{
+			// Unordered access textures without data are directly transitioned into general image layout
+			VkCommandBuffer vkCommandBuffer = beginSingleTimeCommands(vulkanRenderer);
+			transitionVkImageLayout(vulkanRenderer, vkCommandBuffer, vkImage, vkImageAspectFlags, numberOfMipmaps, layerCount, VK_IMAGE_LAYOUT_PREINITIALIZED, VK_IMAGE_LAYOUT_GENERAL);
+			endSingleTimeCommands(vulkanRenderer, vkCommandBuffer);
+		}
 
 		// Done
 		return vkFormat;
@@ -0,0 +1,145 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "VulkanRenderer/QueryPool.h"
+#include "VulkanRenderer/VulkanRuntimeLinking.h"
+#include "VulkanRenderer/VulkanRenderer.h"
+#include "VulkanRenderer/VulkanContext.h"
+
+#include <Renderer/ILog.h>
+#include <Renderer/IAssert.h>
+#include <Renderer/IAllocator.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace VulkanRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	QueryPool::QueryPool(VulkanRenderer& vulkanRenderer, Renderer::QueryType queryType, uint32_t numberOfQueries) :
+		IQueryPool(vulkanRenderer),
+		mQueryType(queryType),
+		mNumberOfQueries(numberOfQueries),
+		mTimestampPeriod(1.0f),
+		mVkQueryPool(VK_NULL_HANDLE)
+	{
+		// Sanity check
+		RENDERER_ASSERT(vulkanRenderer.getContext(), numberOfQueries > 0, "Vulkan: Number of queries mustn't be zero")
+
+		// Timestamp query values are in device specific ticks, get the number of nanoseconds per tick so we're able to return nanoseconds
+		const VulkanContext& vulkanContext = vulkanRenderer.getVulkanContext();
+		if (Renderer::QueryType::TIMESTAMP == queryType)
+		{
+			VkPhysicalDeviceProperties vkPhysicalDeviceProperties;
+			vkGetPhysicalDeviceProperties(vulkanContext.getVkPhysicalDevice(), &vkPhysicalDeviceProperties);
+			mTimestampPeriod = vkPhysicalDeviceProperties.limits.timestampPeriod;
+		}
+
+		// Create the Vulkan query pool
+		// -> Pipeline statistics queries use all counters, this way the results directly map to "Renderer::PipelineStatisticsQueryResult"
+		VkQueryType vkQueryType = VK_QUERY_TYPE_OCCLUSION;
+		VkQueryPipelineStatisticFlags vkQueryPipelineStatisticFlags = 0;
+		switch (queryType)
+		{
+			case Renderer::QueryType::OCCLUSION:
+				vkQueryType = VK_QUERY_TYPE_OCCLUSION;
+				break;
+
+			case Renderer::QueryType::TIMESTAMP:
+				vkQueryType = VK_QUERY_TYPE_TIMESTAMP;
+				break;
+
+			case Renderer::QueryType::PIPELINE_STATISTICS:
+				vkQueryType = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+				vkQueryPipelineStatisticFlags =
+					VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT |
+					VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT |
+					VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+					VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_INVOCATIONS_BIT |
+					VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_PRIMITIVES_BIT |
+					VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT |
+					VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+					VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT |
+					VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_CONTROL_SHADER_PATCHES_BIT |
+					VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_EVALUATION_SHADER_INVOCATIONS_BIT |
+					VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
+				break;
+		}
+		const VkQueryPoolCreateInfo vkQueryPoolCreateInfo =
+		{
+			VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,	// sType (VkStructureType)
+			nullptr,									// pNext (const void*)
+			0,											// flags (VkQueryPoolCreateFlags)
+			vkQueryType,								// queryType (VkQueryType)
+			numberOfQueries,							// queryCount (uint32_t)
+			vkQueryPipelineStatisticFlags				// pipelineStatistics (VkQueryPipelineStatisticFlags)
+		};
+		if (vkCreateQueryPool(vulkanContext.getVkDevice(), &vkQueryPoolCreateInfo, vulkanRenderer.getVkAllocationCallbacks(), &mVkQueryPool) != VK_SUCCESS)
+		{
+			RENDERER_LOG(vulkanRenderer.getContext(), CRITICAL, "Failed to create Vulkan query pool")
+		}
+	}
+
+	QueryPool::~QueryPool()
+	{
+		// Destroy Vulkan query pool instance
+		if (VK_NULL_HANDLE != mVkQueryPool)
+		{
+			const VulkanRenderer& vulkanRenderer = static_cast<VulkanRenderer&>(getRenderer());
+			vkDestroyQueryPool(vulkanRenderer.getVulkanContext().getVkDevice(), mVkQueryPool, vulkanRenderer.getVkAllocationCallbacks());
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IResource methods            ]
+	//[-------------------------------------------------------]
+	#ifdef RENDERER_DEBUG
+		void QueryPool::setDebugName(const char* name)
+		{
+			if (nullptr != vkDebugMarkerSetObjectNameEXT)
+			{
+				Helper::setDebugObjectName(static_cast<const VulkanRenderer&>(getRenderer()).getVulkanContext().getVkDevice(), VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT, (uint64_t)mVkQueryPool, name);
+			}
+		}
+	#endif
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::RefCount methods          ]
+	//[-------------------------------------------------------]
+	void QueryPool::selfDestruct()
+	{
+		RENDERER_DELETE(getRenderer().getContext(), QueryPool, this);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // VulkanRenderer
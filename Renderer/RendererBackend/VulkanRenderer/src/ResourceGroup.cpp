@@ -33,6 +33,7 @@
 #include "VulkanRenderer/State/SamplerState.h"
 #include "VulkanRenderer/Buffer/UniformBuffer.h"
 #include "VulkanRenderer/Buffer/TextureBuffer.h"
+#include "VulkanRenderer/Buffer/IndirectBuffer.h"
 
 #include <Renderer/ILog.h>
 #include <Renderer/IAssert.h>
@@ -49,7 +50,7 @@ namespace VulkanRenderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	ResourceGroup::ResourceGroup(RootSignature& rootSignature, VkDescriptorSet vkDescriptorSet, uint32_t numberOfResources, Renderer::IResource** resources, Renderer::ISamplerState** samplerStates) :
+	ResourceGroup::ResourceGroup(RootSignature& rootSignature, uint32_t rootParameterIndex, VkDescriptorSet vkDescriptorSet, uint32_t numberOfResources, Renderer::IResource** resources, Renderer::ISamplerState** samplerStates) :
 		IResourceGroup(static_cast<VulkanRenderer&>(rootSignature.getRenderer())),
 		mRootSignature(rootSignature),
 		mVkDescriptorSet(vkDescriptorSet),
@@ -60,6 +61,7 @@ namespace VulkanRenderer
 		// Process all resources and add our reference to the renderer resource
 		const VulkanRenderer& vulkanRenderer = static_cast<VulkanRenderer&>(getRenderer());
 		const VkDevice vkDevice = vulkanRenderer.getVulkanContext().getVkDevice();
+		const Renderer::DescriptorRange* descriptorRanges = reinterpret_cast<const Renderer::DescriptorRange*>(rootSignature.getRootSignature().parameters[rootParameterIndex].descriptorTable.descriptorRanges);
 		if (nullptr != samplerStates)
 		{
 			mSamplerStates = RENDERER_MALLOC_TYPED(vulkanRenderer.getContext(), Renderer::ISamplerState*, mNumberOfResources);
@@ -111,6 +113,7 @@ namespace VulkanRenderer
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				{
 					const VkBufferView vkBufferView = static_cast<TextureBuffer*>(resource)->getVkBufferView();
+					const VkDescriptorType vkDescriptorType = (Renderer::DescriptorRangeType::UAV == descriptorRanges[resourceIndex].rangeType && Renderer::ShaderVisibility::COMPUTE == descriptorRanges[resourceIndex].shaderVisibility) ? VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
 					const VkWriteDescriptorSet vkWriteDescriptorSet =
 					{
 						VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,		// sType (VkStructureType)
@@ -119,7 +122,7 @@ namespace VulkanRenderer
 						resourceIndex,								// dstBinding (uint32_t)
 						0,											// dstArrayElement (uint32_t)
 						1,											// descriptorCount (uint32_t)
-						VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER,	// descriptorType (VkDescriptorType)
+						vkDescriptorType,							// descriptorType (VkDescriptorType)
 						nullptr,									// pImageInfo (const VkDescriptorImageInfo*)
 						nullptr,									// pBufferInfo (const VkDescriptorBufferInfo*)
 						&vkBufferView								// pTexelBufferView (const VkBufferView*)
@@ -184,6 +187,7 @@ namespace VulkanRenderer
 						case Renderer::ResourceType::PROGRAM:
 						case Renderer::ResourceType::VERTEX_ARRAY:
 						case Renderer::ResourceType::RENDER_PASS:
+						case Renderer::ResourceType::QUERY_POOL:
 						case Renderer::ResourceType::SWAP_CHAIN:
 						case Renderer::ResourceType::FRAMEBUFFER:
 						case Renderer::ResourceType::INDEX_BUFFER:
@@ -192,16 +196,49 @@ namespace VulkanRenderer
 						case Renderer::ResourceType::INDIRECT_BUFFER:
 						case Renderer::ResourceType::TEXTURE_BUFFER:
 						case Renderer::ResourceType::PIPELINE_STATE:
+						case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 						case Renderer::ResourceType::SAMPLER_STATE:
 						case Renderer::ResourceType::VERTEX_SHADER:
 						case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 						case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 						case Renderer::ResourceType::GEOMETRY_SHADER:
 						case Renderer::ResourceType::FRAGMENT_SHADER:
+						case Renderer::ResourceType::COMPUTE_SHADER:
 							RENDERER_LOG(vulkanRenderer.getContext(), CRITICAL, "Invalid Vulkan renderer backend resource type")
 							break;
 					}
 
+					// Unordered access view: Storage image without sampler, the texture must have been created with "Renderer::TextureFlag::UNORDERED_ACCESS" so it's in general image layout
+					if (Renderer::DescriptorRangeType::UAV == descriptorRanges[resourceIndex].rangeType)
+					{
+						if (VK_IMAGE_LAYOUT_GENERAL != vkImageLayout)
+						{
+							RENDERER_LOG(vulkanRenderer.getContext(), CRITICAL, "The Vulkan renderer backend only supports textures created with \"Renderer::TextureFlag::UNORDERED_ACCESS\" as unordered access views")
+							break;
+						}
+						const VkDescriptorImageInfo vkDescriptorImageInfo =
+						{
+							VK_NULL_HANDLE,			// sampler (VkSampler)
+							vkImageView,			// imageView (VkImageView)
+							VK_IMAGE_LAYOUT_GENERAL	// imageLayout (VkImageLayout)
+						};
+						const VkWriteDescriptorSet vkWriteDescriptorSet =
+						{
+							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,	// sType (VkStructureType)
+							nullptr,								// pNext (const void*)
+							mVkDescriptorSet,						// dstSet (VkDescriptorSet)
+							resourceIndex,							// dstBinding (uint32_t)
+							0,										// dstArrayElement (uint32_t)
+							1,										// descriptorCount (uint32_t)
+							VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,		// descriptorType (VkDescriptorType)
+							&vkDescriptorImageInfo,					// pImageInfo (const VkDescriptorImageInfo*)
+							nullptr,								// pBufferInfo (const VkDescriptorBufferInfo*)
+							nullptr									// pTexelBufferView (const VkBufferView*)
+						};
+						vkUpdateDescriptorSets(vkDevice, 1, &vkWriteDescriptorSet, 0, nullptr);
+						break;
+					}
+
 					// Get the sampler state
 					RENDERER_ASSERT(vulkanRenderer.getContext(), nullptr != mSamplerStates, "Invalid Vulkan sampler states")
 					const SamplerState* samplerState = static_cast<const SamplerState*>(mSamplerStates[resourceIndex]);
@@ -231,6 +268,32 @@ namespace VulkanRenderer
 					break;
 				}
 
+				case Renderer::ResourceType::INDIRECT_BUFFER:
+				{
+					// Indirect buffers can only be used as compute shader unordered access view
+					const VkBufferView vkBufferView = static_cast<IndirectBuffer*>(resource)->getVkBufferView();
+					if (VK_NULL_HANDLE == vkBufferView || Renderer::DescriptorRangeType::UAV != descriptorRanges[resourceIndex].rangeType || Renderer::ShaderVisibility::COMPUTE != descriptorRanges[resourceIndex].shaderVisibility)
+					{
+						RENDERER_LOG(vulkanRenderer.getContext(), CRITICAL, "The Vulkan renderer backend only supports indirect buffers created with \"Renderer::IndirectBufferFlag::UNORDERED_ACCESS\" as compute shader unordered access views")
+						break;
+					}
+					const VkWriteDescriptorSet vkWriteDescriptorSet =
+					{
+						VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,		// sType (VkStructureType)
+						nullptr,									// pNext (const void*)
+						mVkDescriptorSet,							// dstSet (VkDescriptorSet)
+						resourceIndex,								// dstBinding (uint32_t)
+						0,											// dstArrayElement (uint32_t)
+						1,											// descriptorCount (uint32_t)
+						VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER,	// descriptorType (VkDescriptorType)
+						nullptr,									// pImageInfo (const VkDescriptorImageInfo*)
+						nullptr,									// pBufferInfo (const VkDescriptorBufferInfo*)
+						&vkBufferView								// pTexelBufferView (const VkBufferView*)
+					};
+					vkUpdateDescriptorSets(vkDevice, 1, &vkWriteDescriptorSet, 0, nullptr);
+					break;
+				}
+
 				case Renderer::ResourceType::SAMPLER_STATE:
 					// Nothing to do in here, Vulkan is using combined image samplers
 					break;
@@ -240,17 +303,19 @@ namespace VulkanRenderer
 				case Renderer::ResourceType::PROGRAM:
 				case Renderer::ResourceType::VERTEX_ARRAY:
 				case Renderer::ResourceType::RENDER_PASS:
+				case Renderer::ResourceType::QUERY_POOL:
 				case Renderer::ResourceType::SWAP_CHAIN:
 				case Renderer::ResourceType::FRAMEBUFFER:
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
-				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::PIPELINE_STATE:
+				case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 				case Renderer::ResourceType::VERTEX_SHADER:
 				case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 					RENDERER_LOG(vulkanRenderer.getContext(), CRITICAL, "Invalid Vulkan renderer backend resource type")
 					break;
 			}
@@ -102,6 +102,8 @@ namespace VulkanRenderer
 		uint32_t numberOfCombinedImageSamplers = 0;	// "VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER"
 		uint32_t numberOfUniformBuffers = 0;		// "VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER"
 		uint32_t numberOfUniformTexelBuffers = 0;	// "VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER"
+		uint32_t numberOfStorageTexelBuffers = 0;	// "VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER"
+		uint32_t numberOfStorageImages = 0;			// "VK_DESCRIPTOR_TYPE_STORAGE_IMAGE"
 		if (numberOfRootParameters > 0)
 		{
 			// Fill the Vulkan descriptor set layout bindings
@@ -128,15 +130,39 @@ namespace VulkanRenderer
 						switch (descriptorRange->rangeType)
 						{
 							case Renderer::DescriptorRangeType::SRV:
-								vkDescriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-								++numberOfCombinedImageSamplers;
+								if (Renderer::ResourceType::TEXTURE_BUFFER == descriptorRange->resourceType)
+								{
+									vkDescriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+									++numberOfUniformTexelBuffers;
+								}
+								else
+								{
+									vkDescriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+									++numberOfCombinedImageSamplers;
+								}
 								break;
 
 							case Renderer::DescriptorRangeType::UAV:
-								// TODO(co) Usage of "UAV" is just a temporary hack
-								// RENDERER_LOG(vulkanRenderer.getContext(), CRITICAL, "Vulkan renderer backend: \"Renderer::DescriptorRangeType::UAV\" is currently no supported descriptor range type")
-								vkDescriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
-								++numberOfUniformTexelBuffers;
+								if (Renderer::ResourceType::TEXTURE_BUFFER == descriptorRange->resourceType || Renderer::ResourceType::INDIRECT_BUFFER == descriptorRange->resourceType)
+								{
+									if (Renderer::ShaderVisibility::COMPUTE == descriptorRange->shaderVisibility)
+									{
+										vkDescriptorType = VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+										++numberOfStorageTexelBuffers;
+									}
+									else
+									{
+										// TODO(co) Usage of "UAV" is just a temporary hack
+										// RENDERER_LOG(vulkanRenderer.getContext(), CRITICAL, "Vulkan renderer backend: \"Renderer::DescriptorRangeType::UAV\" is currently no supported descriptor range type")
+										vkDescriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+										++numberOfUniformTexelBuffers;
+									}
+								}
+								else
+								{
+									vkDescriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+									++numberOfStorageImages;
+								}
 								break;
 
 							case Renderer::DescriptorRangeType::UBV:
@@ -180,6 +206,10 @@ namespace VulkanRenderer
 							case Renderer::ShaderVisibility::FRAGMENT:
 								vkShaderStageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
 								break;
+
+							case Renderer::ShaderVisibility::COMPUTE:
+								vkShaderStageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+								break;
 						}
 
 						// Add the Vulkan descriptor set layout binding
@@ -236,7 +266,7 @@ namespace VulkanRenderer
 		}
 
 		{ // Create the Vulkan descriptor pool
-			typedef std::array<VkDescriptorPoolSize, 3> VkDescriptorPoolSizes;
+			typedef std::array<VkDescriptorPoolSize, 5> VkDescriptorPoolSizes;
 			VkDescriptorPoolSizes vkDescriptorPoolSizes;
 			uint32_t numberOfVkDescriptorPoolSizes = 0;
 
@@ -267,6 +297,24 @@ namespace VulkanRenderer
 				++numberOfVkDescriptorPoolSizes;
 			}
 
+			// "VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER"
+			if (numberOfStorageTexelBuffers > 0)
+			{
+				VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
+				vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;	// type (VkDescriptorType)
+				vkDescriptorPoolSize.descriptorCount = maxSets * numberOfStorageTexelBuffers;	// descriptorCount (uint32_t)
+				++numberOfVkDescriptorPoolSizes;
+			}
+
+			// "VK_DESCRIPTOR_TYPE_STORAGE_IMAGE"
+			if (numberOfStorageImages > 0)
+			{
+				VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
+				vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;	// type (VkDescriptorType)
+				vkDescriptorPoolSize.descriptorCount = maxSets * numberOfStorageImages;	// descriptorCount (uint32_t)
+				++numberOfVkDescriptorPoolSizes;
+			}
+
 			// Create the Vulkan descriptor pool
 			if (numberOfVkDescriptorPoolSizes > 0)
 			{
@@ -386,7 +434,7 @@ namespace VulkanRenderer
 		}
 
 		// Create resource group
-		return RENDERER_NEW(context, ResourceGroup)(*this, vkDescriptorSet, numberOfResources, resources, samplerStates);
+		return RENDERER_NEW(context, ResourceGroup)(*this, rootParameterIndex, vkDescriptorSet, numberOfResources, resources, samplerStates);
 	}
 
 
@@ -29,6 +29,7 @@
 #include "VulkanRenderer/Shader/VertexShaderGlsl.h"
 #include "VulkanRenderer/Shader/GeometryShaderGlsl.h"
 #include "VulkanRenderer/Shader/FragmentShaderGlsl.h"
+#include "VulkanRenderer/Shader/ComputeShaderGlsl.h"
 #include "VulkanRenderer/Shader/TessellationControlShaderGlsl.h"
 #include "VulkanRenderer/Shader/TessellationEvaluationShaderGlsl.h"
 #include "VulkanRenderer/VulkanRenderer.h"
@@ -262,6 +263,10 @@ namespace VulkanRenderer
 			{
 				shLanguage = EShLangFragment;
 			}
+			else if ((vkShaderStageFlagBits & VK_SHADER_STAGE_COMPUTE_BIT) != 0)
+			{
+				shLanguage = EShLangCompute;
+			}
 			else
 			{
 				RENDERER_ASSERT(vulkanRenderer.getContext(), false, "Invalid Vulkan shader stage flag bits")
@@ -269,10 +274,7 @@ namespace VulkanRenderer
 			glslang::TShader shader(shLanguage);
 			shader.setEnvInput(glslang::EShSourceGlsl, shLanguage, glslang::EShClientVulkan, glslVersion);
 			shader.setEntryPoint("main");
-			{
-				const char* sourcePointers[] = { sourceCode };
-				shader.setStrings(sourcePointers, 1);
-			}
+			shader.setStrings(&sourceCode, 1);	// "glslang::TShader::setStrings()" only stores the given pointer, it must remain valid until the shader has been parsed
 			const EShMessages shMessages = static_cast<EShMessages>(EShMsgDefault | EShMsgSpvRules | EShMsgVulkanRules);
 			if (shader.parse(&::detail::DefaultTBuiltInResource, glslVersion, false, shMessages))
 			{
@@ -429,6 +431,16 @@ namespace VulkanRenderer
 		return RENDERER_NEW(getRenderer().getContext(), FragmentShaderGlsl)(static_cast<VulkanRenderer&>(getRenderer()), shaderSourceCode.sourceCode, shaderBytecode);
 	}
 
+	Renderer::IComputeShader* ShaderLanguageGlsl::createComputeShaderFromBytecode(const Renderer::ShaderBytecode& shaderBytecode)
+	{
+		return RENDERER_NEW(getRenderer().getContext(), ComputeShaderGlsl)(static_cast<VulkanRenderer&>(getRenderer()), shaderBytecode);
+	}
+
+	Renderer::IComputeShader* ShaderLanguageGlsl::createComputeShaderFromSourceCode(const Renderer::ShaderSourceCode& shaderSourceCode, Renderer::ShaderBytecode* shaderBytecode)
+	{
+		return RENDERER_NEW(getRenderer().getContext(), ComputeShaderGlsl)(static_cast<VulkanRenderer&>(getRenderer()), shaderSourceCode.sourceCode, shaderBytecode);
+	}
+
 	Renderer::IProgram* ShaderLanguageGlsl::createProgram(const Renderer::IRootSignature& rootSignature, const Renderer::VertexAttributes& vertexAttributes, Renderer::IVertexShader* vertexShader, Renderer::ITessellationControlShader* tessellationControlShader, Renderer::ITessellationEvaluationShader* tessellationEvaluationShader, Renderer::IGeometryShader* geometryShader, Renderer::IFragmentShader* fragmentShader)
 	{
 		VulkanRenderer& vulkanRenderer = static_cast<VulkanRenderer&>(getRenderer());
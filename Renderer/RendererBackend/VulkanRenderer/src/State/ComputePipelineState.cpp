@@ -0,0 +1,125 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "VulkanRenderer/State/ComputePipelineState.h"
+#include "VulkanRenderer/Shader/ComputeShaderGlsl.h"
+#include "VulkanRenderer/RootSignature.h"
+#include "VulkanRenderer/VulkanRenderer.h"
+#include "VulkanRenderer/VulkanContext.h"
+
+#include <Renderer/ILog.h>
+#include <Renderer/IAllocator.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace VulkanRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	ComputePipelineState::ComputePipelineState(VulkanRenderer& vulkanRenderer, Renderer::IRootSignature& rootSignature, Renderer::IComputeShader& computeShader) :
+		IComputePipelineState(vulkanRenderer),
+		mRootSignature(rootSignature),
+		mComputeShader(computeShader),
+		mVkPipeline(VK_NULL_HANDLE)
+	{
+		// Add a reference to the given root signature and compute shader
+		mRootSignature.addReference();
+		mComputeShader.addReference();
+
+		// Create the Vulkan compute pipeline
+		const VkComputePipelineCreateInfo vkComputePipelineCreateInfo =
+		{
+			VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,	// sType (VkStructureType)
+			nullptr,										// pNext (const void*)
+			0,												// flags (VkPipelineCreateFlags)
+			{ // stage (VkPipelineShaderStageCreateInfo)
+				VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,						// sType (VkStructureType)
+				nullptr,																	// pNext (const void*)
+				0,																			// flags (VkPipelineShaderStageCreateFlags)
+				VK_SHADER_STAGE_COMPUTE_BIT,												// stage (VkShaderStageFlagBits)
+				static_cast<ComputeShaderGlsl&>(computeShader).getVkShaderModule(),		// module (VkShaderModule)
+				"main",																		// pName (const char*)
+				nullptr																		// pSpecializationInfo (const VkSpecializationInfo*)
+			},
+			static_cast<RootSignature&>(rootSignature).getVkPipelineLayout(),	// layout (VkPipelineLayout)
+			VK_NULL_HANDLE,														// basePipelineHandle (VkPipeline)
+			0																	// basePipelineIndex (int32_t)
+		};
+		if (vkCreateComputePipelines(vulkanRenderer.getVulkanContext().getVkDevice(), vulkanRenderer.getVkPipelineCache(), 1, &vkComputePipelineCreateInfo, vulkanRenderer.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS)
+		{
+			SET_DEFAULT_DEBUG_NAME	// setDebugName("");
+		}
+		else
+		{
+			RENDERER_LOG(vulkanRenderer.getContext(), CRITICAL, "Failed to create the Vulkan compute pipeline")
+		}
+	}
+
+	ComputePipelineState::~ComputePipelineState()
+	{
+		// Destroy the Vulkan compute pipeline
+		if (VK_NULL_HANDLE != mVkPipeline)
+		{
+			const VulkanRenderer& vulkanRenderer = static_cast<VulkanRenderer&>(getRenderer());
+			vkDestroyPipeline(vulkanRenderer.getVulkanContext().getVkDevice(), mVkPipeline, vulkanRenderer.getVkAllocationCallbacks());
+		}
+
+		// Release the root signature and compute shader reference
+		mRootSignature.releaseReference();
+		mComputeShader.releaseReference();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IResource methods            ]
+	//[-------------------------------------------------------]
+	#ifdef RENDERER_DEBUG
+		void ComputePipelineState::setDebugName(const char* name)
+		{
+			if (nullptr != vkDebugMarkerSetObjectNameEXT)
+			{
+				Helper::setDebugObjectName(static_cast<const VulkanRenderer&>(getRenderer()).getVulkanContext().getVkDevice(), VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT, (uint64_t)mVkPipeline, name);
+			}
+		}
+	#endif
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::RefCount methods          ]
+	//[-------------------------------------------------------]
+	void ComputePipelineState::selfDestruct()
+	{
+		RENDERER_DELETE(getRenderer().getContext(), ComputePipelineState, this);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // VulkanRenderer
@@ -354,7 +354,7 @@ namespace VulkanRenderer
 			VK_NULL_HANDLE,																			// basePipelineHandle (VkPipeline)
 			0																						// basePipelineIndex (int32_t)
 		};
-		if (vkCreateGraphicsPipelines(vulkanRenderer.getVulkanContext().getVkDevice(), VK_NULL_HANDLE, 1, &vkGraphicsPipelineCreateInfo, vulkanRenderer.getVkAllocationCallbacks(), &mVkPipeline) != VK_SUCCESS)
+		if (vkCreateGraphicsPipelines(vulkanRenderer.getVulkanContext().getVkDevice(), vulkanRenderer.getVkPipelineCache(), 1, &vkGraphicsPipelineCreateInfo, vulkanRenderer.getVkAllocationCallbacks(), &mVkPipeline) != VK_SUCCESS)
 		{
 			RENDERER_LOG(vulkanRenderer.getContext(), CRITICAL, "Failed to create the Vulkan graphics pipeline")
 		}
@@ -42,7 +42,7 @@ namespace VulkanRenderer
 	Texture2DArray::Texture2DArray(VulkanRenderer& vulkanRenderer, uint32_t width, uint32_t height, uint32_t numberOfSlices, Renderer::TextureFormat::Enum textureFormat, const void* data, uint32_t flags) :
 		ITexture2DArray(vulkanRenderer, width, height, numberOfSlices),
 		mVkImage(VK_NULL_HANDLE),
-		mVkImageLayout((flags & Renderer::TextureFlag::RENDER_TARGET) ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_PREINITIALIZED),
+		mVkImageLayout((flags & Renderer::TextureFlag::UNORDERED_ACCESS) ? VK_IMAGE_LAYOUT_GENERAL : ((flags & Renderer::TextureFlag::RENDER_TARGET) ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_PREINITIALIZED)),
 		mVkDeviceMemory(VK_NULL_HANDLE),
 		mVkImageView(VK_NULL_HANDLE),
 		mVkFormat(Helper::createAndFillVkImage(vulkanRenderer, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D_ARRAY, { width, height, numberOfSlices }, textureFormat, data, flags, 1, mVkImage, mVkDeviceMemory, mVkImageView))
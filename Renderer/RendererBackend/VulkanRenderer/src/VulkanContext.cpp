@@ -57,6 +57,9 @@ namespace
 		typedef std::vector<VkPhysicalDevice> VkPhysicalDevices;
 		typedef std::vector<VkExtensionProperties> VkExtensionPropertiesVector;
 
+		// The "VK_KHR_draw_indirect_count"-extension is newer than the Vulkan header we're using, it's the promoted "VK_AMD_draw_indirect_count"-extension with identical function signatures
+		static const char* DRAW_INDIRECT_COUNT_KHR_EXTENSION_NAME = "VK_KHR_draw_indirect_count";
+
 
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
@@ -107,7 +110,7 @@ namespace
 			return false;
 		}
 
-		VkPhysicalDevice selectPhysicalDevice(VulkanRenderer::VulkanRenderer& vulkanRenderer, const VkPhysicalDevices& vkPhysicalDevices, bool& enableDebugMarker)
+		VkPhysicalDevice selectPhysicalDevice(VulkanRenderer::VulkanRenderer& vulkanRenderer, const VkPhysicalDevices& vkPhysicalDevices, bool& enableDebugMarker, const char*& drawIndirectCountExtensionName)
 		{
 			// TODO(co) I'am sure this selection can be improved (rating etc.)
 			for (const VkPhysicalDevice& vkPhysicalDevice : vkPhysicalDevices)
@@ -201,6 +204,16 @@ namespace
 							}
 						}
 
+						// Check whether or not draw indirect count is available, prefer the "VK_KHR_draw_indirect_count"-extension over the "VK_AMD_draw_indirect_count"-extension
+						if (isExtensionAvailable(DRAW_INDIRECT_COUNT_KHR_EXTENSION_NAME, vkExtensionPropertiesVector))
+						{
+							drawIndirectCountExtensionName = DRAW_INDIRECT_COUNT_KHR_EXTENSION_NAME;
+						}
+						else if (isExtensionAvailable(VK_AMD_DRAW_INDIRECT_COUNT_EXTENSION_NAME, vkExtensionPropertiesVector))
+						{
+							drawIndirectCountExtensionName = VK_AMD_DRAW_INDIRECT_COUNT_EXTENSION_NAME;
+						}
+
 						// Select physical Vulkan device
 						return vkPhysicalDevice;
 					}
@@ -212,15 +225,24 @@ namespace
 			return VK_NULL_HANDLE;
 		}
 
-		VkResult createVkDevice(VulkanRenderer::VulkanRenderer& vulkanRenderer, VkPhysicalDevice vkPhysicalDevice, const VkDeviceQueueCreateInfo& vkDeviceQueueCreateInfo, bool enableValidation, bool enableDebugMarker, VkDevice& vkDevice)
+		VkResult createVkDevice(VulkanRenderer::VulkanRenderer& vulkanRenderer, VkPhysicalDevice vkPhysicalDevice, const VkDeviceQueueCreateInfo& vkDeviceQueueCreateInfo, bool enableValidation, bool enableDebugMarker, const char* drawIndirectCountExtensionName, VkDevice& vkDevice)
 		{
 			// See http://vulkan.gpuinfo.org/listfeatures.php to check out GPU hardware capabilities
-			const std::array<const char*, 3> enabledExtensions =
+			std::vector<const char*> enabledExtensions =
 			{
 				VK_KHR_SWAPCHAIN_EXTENSION_NAME,
-				VK_KHR_MAINTENANCE1_EXTENSION_NAME,	// We want to be able to specify a negative viewport height, this way we don't have to apply "<output position>.y = -<output position>.y" inside vertex shaders to compensate for the Vulkan coordinate system
-				VK_EXT_DEBUG_MARKER_EXTENSION_NAME
+				VK_KHR_MAINTENANCE1_EXTENSION_NAME	// We want to be able to specify a negative viewport height, this way we don't have to apply "<output position>.y = -<output position>.y" inside vertex shaders to compensate for the Vulkan coordinate system
 			};
+			if (enableDebugMarker)
+			{
+				enabledExtensions.push_back(VK_EXT_DEBUG_MARKER_EXTENSION_NAME);
+			}
+			if (nullptr != drawIndirectCountExtensionName)
+			{
+				enabledExtensions.push_back(drawIndirectCountExtensionName);
+			}
+			VkPhysicalDeviceFeatures supportedVkPhysicalDeviceFeatures;
+			vkGetPhysicalDeviceFeatures(vkPhysicalDevice, &supportedVkPhysicalDeviceFeatures);
 			const VkPhysicalDeviceFeatures vkPhysicalDeviceFeatures =
 			{
 				VK_FALSE,	// robustBufferAccess (VkBool32)
@@ -247,7 +269,7 @@ namespace
 				VK_FALSE,	// textureCompressionASTC_LDR (VkBool32)
 				VK_TRUE,	// textureCompressionBC (VkBool32)
 				VK_FALSE,	// occlusionQueryPrecise (VkBool32)
-				VK_FALSE,	// pipelineStatisticsQuery (VkBool32)
+				supportedVkPhysicalDeviceFeatures.pipelineStatisticsQuery,	// pipelineStatisticsQuery (VkBool32), optional, see "Renderer::Capabilities::pipelineStatisticsQuery"
 				VK_FALSE,	// vertexPipelineStoresAndAtomics (VkBool32)
 				VK_FALSE,	// fragmentStoresAndAtomics (VkBool32)
 				VK_FALSE,	// shaderTessellationAndGeometryPointSize (VkBool32)
@@ -288,8 +310,8 @@ namespace
 				&vkDeviceQueueCreateInfo,																	// pQueueCreateInfos (const VkDeviceQueueCreateInfo*)
 				enableValidation ? VulkanRenderer::VulkanRuntimeLinking::NUMBER_OF_VALIDATION_LAYERS : 0,	// enabledLayerCount (uint32_t)
 				enableValidation ? VulkanRenderer::VulkanRuntimeLinking::VALIDATION_LAYER_NAMES : nullptr,	// ppEnabledLayerNames (const char* const*)
-				enableDebugMarker ? 3u : 2u,																// enabledExtensionCount (uint32_t)
-				enabledExtensions.empty() ? nullptr : enabledExtensions.data(),								// ppEnabledExtensionNames (const char* const*)
+				static_cast<uint32_t>(enabledExtensions.size()),											// enabledExtensionCount (uint32_t)
+				enabledExtensions.data(),																	// ppEnabledExtensionNames (const char* const*)
 				&vkPhysicalDeviceFeatures																	// pEnabledFeatures (const VkPhysicalDeviceFeatures*)
 			};
 			const VkResult vkResult = vkCreateDevice(vkPhysicalDevice, &vkDeviceCreateInfo, vulkanRenderer.getVkAllocationCallbacks(), &vkDevice);
@@ -318,12 +340,25 @@ namespace
 				#undef IMPORT_FUNC
 				PRAGMA_WARNING_POP
 			}
+			if (VK_SUCCESS == vkResult && nullptr != drawIndirectCountExtensionName)
+			{
+				// Get "VK_KHR_draw_indirect_count"-extension or "VK_AMD_draw_indirect_count"-extension function pointer, both share the same function signature
+				const char* functionName = (0 == strcmp(drawIndirectCountExtensionName, DRAW_INDIRECT_COUNT_KHR_EXTENSION_NAME)) ? "vkCmdDrawIndexedIndirectCountKHR" : "vkCmdDrawIndexedIndirectCountAMD";
+				PRAGMA_WARNING_PUSH
+				PRAGMA_WARNING_DISABLE_MSVC(4191)	// 'reinterpret_cast': unsafe conversion from 'PFN_vkVoidFunction' to '<x>'
+				vkCmdDrawIndexedIndirectCountAMD = reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCountAMD>(vkGetDeviceProcAddr(vkDevice, functionName));
+				PRAGMA_WARNING_POP
+				if (nullptr == vkCmdDrawIndexedIndirectCountAMD)
+				{
+					RENDERER_LOG(vulkanRenderer.getContext(), CRITICAL, "Failed to load instance based Vulkan function pointer \"%s\"", functionName)
+				}
+			}
 
 			// Done
 			return vkResult;
 		}
 
-		VkDevice createVkDevice(VulkanRenderer::VulkanRenderer& vulkanRenderer, VkPhysicalDevice vkPhysicalDevice, bool enableValidation, bool enableDebugMarker, uint32_t& graphicsQueueFamilyIndex, uint32_t& presentQueueFamilyIndex)
+		VkDevice createVkDevice(VulkanRenderer::VulkanRenderer& vulkanRenderer, VkPhysicalDevice vkPhysicalDevice, bool enableValidation, bool enableDebugMarker, const char* drawIndirectCountExtensionName, uint32_t& graphicsQueueFamilyIndex, uint32_t& presentQueueFamilyIndex)
 		{
 			VkDevice vkDevice = VK_NULL_HANDLE;
 
@@ -353,12 +388,12 @@ namespace
 							1,											// queueCount (uint32_t)
 							queuePriorities.data()						// pQueuePriorities (const float*)
 						};
-						VkResult vkResult = createVkDevice(vulkanRenderer, vkPhysicalDevice, vkDeviceQueueCreateInfo, enableValidation, enableDebugMarker, vkDevice);
+						VkResult vkResult = createVkDevice(vulkanRenderer, vkPhysicalDevice, vkDeviceQueueCreateInfo, enableValidation, enableDebugMarker, drawIndirectCountExtensionName, vkDevice);
 						if (VK_ERROR_LAYER_NOT_PRESENT == vkResult && enableValidation)
 						{
 							// Error! Since the show must go on, try creating a Vulkan device instance without validation enabled...
 							RENDERER_LOG(vulkanRenderer.getContext(), WARNING, "Failed to create the Vulkan device instance with validation enabled, layer is not present")
-							vkResult = createVkDevice(vulkanRenderer, vkPhysicalDevice, vkDeviceQueueCreateInfo, false, enableDebugMarker, vkDevice);
+							vkResult = createVkDevice(vulkanRenderer, vkPhysicalDevice, vkDeviceQueueCreateInfo, false, enableDebugMarker, drawIndirectCountExtensionName, vkDevice);
 						}
 						// TODO(co) Error handling: Evaluate "vkResult"?
 						graphicsQueueFamilyIndex = graphicsQueueIndex;
@@ -459,19 +494,20 @@ namespace VulkanRenderer
 
 		// Get the physical Vulkan device this context should use
 		bool enableDebugMarker = true;	// TODO(co) Make it possible to setup from the outside whether or not the "VK_EXT_debug_marker"-extension should be used (e.g. retail shipped games might not want to have this enabled)
+		const char* drawIndirectCountExtensionName = nullptr;
 		{
 			detail::VkPhysicalDevices vkPhysicalDevices;
 			::detail::enumeratePhysicalDevices(mVulkanRenderer, vulkanRuntimeLinking.getVkInstance(), vkPhysicalDevices);
 			if (!vkPhysicalDevices.empty())
 			{
-				mVkPhysicalDevice = ::detail::selectPhysicalDevice(mVulkanRenderer, vkPhysicalDevices, enableDebugMarker);
+				mVkPhysicalDevice = ::detail::selectPhysicalDevice(mVulkanRenderer, vkPhysicalDevices, enableDebugMarker, drawIndirectCountExtensionName);
 			}
 		}
 
 		// Create the logical Vulkan device instance
 		if (VK_NULL_HANDLE != mVkPhysicalDevice)
 		{
-			mVkDevice = ::detail::createVkDevice(mVulkanRenderer, mVkPhysicalDevice, vulkanRuntimeLinking.isValidationEnabled(), enableDebugMarker, mGraphicsQueueFamilyIndex, mPresentQueueFamilyIndex);
+			mVkDevice = ::detail::createVkDevice(mVulkanRenderer, mVkPhysicalDevice, vulkanRuntimeLinking.isValidationEnabled(), enableDebugMarker, drawIndirectCountExtensionName, mGraphicsQueueFamilyIndex, mPresentQueueFamilyIndex);
 			if (VK_NULL_HANDLE != mVkDevice)
 			{
 				// Load device based instance level Vulkan function pointers
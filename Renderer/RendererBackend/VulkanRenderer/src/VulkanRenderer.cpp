@@ -26,6 +26,7 @@
 #include "VulkanRenderer/Mapping.h"
 #include "VulkanRenderer/RootSignature.h"
 #include "VulkanRenderer/ResourceGroup.h"
+#include "VulkanRenderer/QueryPool.h"
 #include "VulkanRenderer/VulkanContext.h"
 #include "VulkanRenderer/VulkanRuntimeLinking.h"
 #include "VulkanRenderer/RenderTarget/SwapChain.h"
@@ -46,14 +47,18 @@
 #include "VulkanRenderer/Texture/Texture2DArray.h"
 #include "VulkanRenderer/State/SamplerState.h"
 #include "VulkanRenderer/State/PipelineState.h"
+#include "VulkanRenderer/State/ComputePipelineState.h"
 #include "VulkanRenderer/Shader/ShaderLanguageGlsl.h"
 #include "VulkanRenderer/Shader/ProgramGlsl.h"
+#include "VulkanRenderer/Shader/ComputeShaderGlsl.h"
 
 #include <Renderer/ILog.h>
 #include <Renderer/IAssert.h>
 #include <Renderer/IAllocator.h>
 #include <Renderer/Buffer/CommandBuffer.h>
 
+#include <vector>
+
 
 //[-------------------------------------------------------]
 //[ Global functions                                      ]
@@ -134,6 +139,21 @@ namespace
 				static_cast<VulkanRenderer::VulkanRenderer&>(renderer).setGraphicsResourceGroup(realData->rootParameterIndex, realData->resourceGroup);
 			}
 
+			//[-------------------------------------------------------]
+			//[ Compute root                                          ]
+			//[-------------------------------------------------------]
+			void SetComputeRootSignature(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::SetComputeRootSignature* realData = static_cast<const Renderer::Command::SetComputeRootSignature*>(data);
+				static_cast<VulkanRenderer::VulkanRenderer&>(renderer).setComputeRootSignature(realData->rootSignature);
+			}
+
+			void SetComputeResourceGroup(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::SetComputeResourceGroup* realData = static_cast<const Renderer::Command::SetComputeResourceGroup*>(data);
+				static_cast<VulkanRenderer::VulkanRenderer&>(renderer).setComputeResourceGroup(realData->rootParameterIndex, realData->resourceGroup);
+			}
+
 			//[-------------------------------------------------------]
 			//[ States                                                ]
 			//[-------------------------------------------------------]
@@ -143,6 +163,12 @@ namespace
 				static_cast<VulkanRenderer::VulkanRenderer&>(renderer).setPipelineState(realData->pipelineState);
 			}
 
+			void SetComputePipelineState(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::SetComputePipelineState* realData = static_cast<const Renderer::Command::SetComputePipelineState*>(data);
+				static_cast<VulkanRenderer::VulkanRenderer&>(renderer).setComputePipelineState(realData->computePipelineState);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Input-assembler (IA) stage                            ]
 			//[-------------------------------------------------------]
@@ -226,6 +252,48 @@ namespace
 				}
 			}
 
+			void DrawIndexedIndirectCount(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::DrawIndexedIndirectCount* realData = static_cast<const Renderer::Command::DrawIndexedIndirectCount*>(data);
+				static_cast<VulkanRenderer::VulkanRenderer&>(renderer).drawIndexedIndirectCount(*realData->indirectBuffer, realData->indirectBufferOffset, *realData->countBuffer, realData->countBufferOffset, realData->maximumNumberOfDraws);
+			}
+
+			//[-------------------------------------------------------]
+			//[ Compute                                               ]
+			//[-------------------------------------------------------]
+			void DispatchCompute(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::DispatchCompute* realData = static_cast<const Renderer::Command::DispatchCompute*>(data);
+				static_cast<VulkanRenderer::VulkanRenderer&>(renderer).dispatchCompute(realData->groupCountX, realData->groupCountY, realData->groupCountZ);
+			}
+
+			//[-------------------------------------------------------]
+			//[ Query                                                 ]
+			//[-------------------------------------------------------]
+			void ResetQueryPool(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::ResetQueryPool* realData = static_cast<const Renderer::Command::ResetQueryPool*>(data);
+				static_cast<VulkanRenderer::VulkanRenderer&>(renderer).resetQueryPool(*realData->queryPool, realData->firstQueryIndex, realData->numberOfQueries);
+			}
+
+			void BeginQuery(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::BeginQuery* realData = static_cast<const Renderer::Command::BeginQuery*>(data);
+				static_cast<VulkanRenderer::VulkanRenderer&>(renderer).beginQuery(*realData->queryPool, realData->queryIndex);
+			}
+
+			void EndQuery(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::EndQuery* realData = static_cast<const Renderer::Command::EndQuery*>(data);
+				static_cast<VulkanRenderer::VulkanRenderer&>(renderer).endQuery(*realData->queryPool, realData->queryIndex);
+			}
+
+			void WriteTimestampQuery(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::WriteTimestampQuery* realData = static_cast<const Renderer::Command::WriteTimestampQuery*>(data);
+				static_cast<VulkanRenderer::VulkanRenderer&>(renderer).writeTimestampQuery(*realData->queryPool, realData->queryIndex);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Debug                                                 ]
 			//[-------------------------------------------------------]
@@ -301,8 +369,12 @@ namespace
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsResourceGroup,
+			// Compute root
+			&BackendDispatch::SetComputeRootSignature,
+			&BackendDispatch::SetComputeResourceGroup,
 			// States
 			&BackendDispatch::SetPipelineState,
+			&BackendDispatch::SetComputePipelineState,
 			// Input-assembler (IA) stage
 			&BackendDispatch::SetVertexArray,
 			// Rasterizer (RS) stage
@@ -317,6 +389,14 @@ namespace
 			// Draw call
 			&BackendDispatch::Draw,
 			&BackendDispatch::DrawIndexed,
+			&BackendDispatch::DrawIndexedIndirectCount,
+			// Compute
+			&BackendDispatch::DispatchCompute,
+			// Query
+			&BackendDispatch::ResetQueryPool,
+			&BackendDispatch::BeginQuery,
+			&BackendDispatch::EndQuery,
+			&BackendDispatch::WriteTimestampQuery,
 			// Debug
 			&BackendDispatch::SetDebugMarker,
 			&BackendDispatch::BeginDebugEvent,
@@ -346,8 +426,10 @@ namespace VulkanRenderer
 		mVkAllocationCallbacks{&context.getAllocator(), &::detail::vkAllocationFunction, &::detail::vkReallocationFunction, &::detail::vkFreeFunction, nullptr, nullptr},
 		mVulkanRuntimeLinking(nullptr),
 		mVulkanContext(nullptr),
+		mVkPipelineCache(VK_NULL_HANDLE),
 		mShaderLanguageGlsl(nullptr),
 		mGraphicsRootSignature(nullptr),
+		mComputeRootSignature(nullptr),
 		mDefaultSamplerState(nullptr),
 		mInsideVulkanRenderPass(false),
 		mVkClearValues{},
@@ -374,6 +456,9 @@ namespace VulkanRenderer
 				// Initialize the capabilities
 				initializeCapabilities();
 
+				// Create the empty Vulkan pipeline cache, the user might provide data from a previous run via "Renderer::IRenderer::setPipelineCacheData()"
+				createVkPipelineCache(nullptr, 0);
+
 				// Create the default sampler state
 				mDefaultSamplerState = createSamplerState(Renderer::ISamplerState::getDefaultSamplerState());
 
@@ -407,11 +492,15 @@ namespace VulkanRenderer
 			mDefaultSamplerState = nullptr;
 		}
 
-		// Release the graphics root signature instance, in case we have one
+		// Release the graphics and compute root signature instance, in case we have one
 		if (nullptr != mGraphicsRootSignature)
 		{
 			mGraphicsRootSignature->releaseReference();
 		}
+		if (nullptr != mComputeRootSignature)
+		{
+			mComputeRootSignature->releaseReference();
+		}
 
 		#ifndef RENDERER_NO_STATISTICS
 		{ // For debugging: At this point there should be no resource instances left, validate this!
@@ -441,6 +530,12 @@ namespace VulkanRenderer
 			mShaderLanguageGlsl->releaseReference();
 		}
 
+		// Destroy the Vulkan pipeline cache
+		if (VK_NULL_HANDLE != mVkPipelineCache)
+		{
+			vkDestroyPipelineCache(mVulkanContext->getVkDevice(), mVkPipelineCache, getVkAllocationCallbacks());
+		}
+
 		// Destroy the Vulkan context instance
 		RENDERER_DELETE(mContext, VulkanContext, mVulkanContext);
 
@@ -472,43 +567,57 @@ namespace VulkanRenderer
 	{
 		// Security checks
 		#ifdef RENDERER_DEBUG
-		{
 			if (nullptr == mGraphicsRootSignature)
 			{
 				RENDERER_LOG(mContext, CRITICAL, "No Vulkan renderer backend graphics root signature set")
 				return;
 			}
-			const Renderer::RootSignature& rootSignature = mGraphicsRootSignature->getRootSignature();
-			if (rootParameterIndex >= rootSignature.numberOfParameters)
-			{
-				RENDERER_LOG(mContext, CRITICAL, "The Vulkan renderer backend root parameter index is out of bounds")
-				return;
-			}
-			const Renderer::RootParameter& rootParameter = rootSignature.parameters[rootParameterIndex];
-			if (Renderer::RootParameterType::DESCRIPTOR_TABLE != rootParameter.parameterType)
-			{
-				RENDERER_LOG(mContext, CRITICAL, "The Vulkan renderer backend root parameter index doesn't reference a descriptor table")
-				return;
-			}
-			if (nullptr == reinterpret_cast<const Renderer::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges))
+		#endif
+
+		// Set graphics resource group
+		setResourceGroup(*mGraphicsRootSignature, VK_PIPELINE_BIND_POINT_GRAPHICS, rootParameterIndex, resourceGroup);
+	}
+
+	void VulkanRenderer::setComputeRootSignature(Renderer::IRootSignature* rootSignature)
+	{
+		if (nullptr != mComputeRootSignature)
+		{
+			mComputeRootSignature->releaseReference();
+		}
+		mComputeRootSignature = static_cast<RootSignature*>(rootSignature);
+		if (nullptr != mComputeRootSignature)
+		{
+			mComputeRootSignature->addReference();
+
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *rootSignature)
+		}
+	}
+
+	void VulkanRenderer::setComputeResourceGroup(uint32_t rootParameterIndex, Renderer::IResourceGroup* resourceGroup)
+	{
+		// Security checks
+		#ifdef RENDERER_DEBUG
+			if (nullptr == mComputeRootSignature)
 			{
-				RENDERER_LOG(mContext, CRITICAL, "The Vulkan renderer backend descriptor ranges is a null pointer")
+				RENDERER_LOG(mContext, CRITICAL, "No Vulkan renderer backend compute root signature set")
 				return;
 			}
-		}
 		#endif
 
-		if (nullptr != resourceGroup)
+		// Set compute resource group
+		setResourceGroup(*mComputeRootSignature, VK_PIPELINE_BIND_POINT_COMPUTE, rootParameterIndex, resourceGroup);
+	}
+
+	void VulkanRenderer::setPipelineState(Renderer::IPipelineState* pipelineState)
+	{
+		if (nullptr != pipelineState)
 		{
 			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
-			VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *resourceGroup)
+			VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *pipelineState)
 
-			// Bind Vulkan descriptor set
-			const VkDescriptorSet vkDescriptorSet = static_cast<ResourceGroup*>(resourceGroup)->getVkDescriptorSet();
-			if (VK_NULL_HANDLE != vkDescriptorSet)
-			{
-				vkCmdBindDescriptorSets(getVulkanContext().getVkCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS, mGraphicsRootSignature->getVkPipelineLayout(), rootParameterIndex, 1, &vkDescriptorSet, 0, nullptr);
-			}
+			// Bind Vulkan pipeline
+			vkCmdBindPipeline(getVulkanContext().getVkCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS, static_cast<PipelineState*>(pipelineState)->getVkPipeline());
 		}
 		else
 		{
@@ -516,15 +625,15 @@ namespace VulkanRenderer
 		}
 	}
 
-	void VulkanRenderer::setPipelineState(Renderer::IPipelineState* pipelineState)
+	void VulkanRenderer::setComputePipelineState(Renderer::IComputePipelineState* computePipelineState)
 	{
-		if (nullptr != pipelineState)
+		if (nullptr != computePipelineState)
 		{
 			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
-			VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *pipelineState)
+			VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *computePipelineState)
 
-			// Bind Vulkan pipeline
-			vkCmdBindPipeline(getVulkanContext().getVkCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS, static_cast<PipelineState*>(pipelineState)->getVkPipeline());
+			// Bind Vulkan compute pipeline
+			vkCmdBindPipeline(getVulkanContext().getVkCommandBuffer(), VK_PIPELINE_BIND_POINT_COMPUTE, static_cast<ComputePipelineState*>(computePipelineState)->getVkPipeline());
 		}
 		else
 		{
@@ -815,6 +924,127 @@ namespace VulkanRenderer
 	}
 
 
+	void VulkanRenderer::drawIndexedIndirectCount(const Renderer::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, const Renderer::IIndirectBuffer& countBuffer, uint32_t countBufferOffset, uint32_t maximumNumberOfDraws)
+	{
+		// Sanity checks
+		RENDERER_ASSERT(mContext, nullptr != mVertexArray, "Vulkan draw indexed needs a set vertex array")
+		RENDERER_ASSERT(mContext, nullptr != mVertexArray->getIndexBuffer(), "Vulkan draw indexed needs a set vertex array which contains an index buffer")
+		RENDERER_ASSERT(mContext, nullptr != vkCmdDrawIndexedIndirectCountAMD, "The Vulkan draw indirect count extension isn't supported")
+		RENDERER_ASSERT(mContext, 0 == (countBufferOffset % sizeof(uint32_t)), "The Vulkan count buffer offset must be a multiple of four")
+
+		// Security checks: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+		VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, indirectBuffer)
+		VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, countBuffer)
+
+		// Nothing to do?
+		if (0 == maximumNumberOfDraws)
+		{
+			return;
+		}
+
+		// Start Vulkan render pass, if necessary
+		if (!mInsideVulkanRenderPass)
+		{
+			beginVulkanRenderPass();
+		}
+
+		// Vulkan draw indexed indirect count command, the number of draws read from the count buffer is clamped against the given maximum
+		vkCmdDrawIndexedIndirectCountAMD(getVulkanContext().getVkCommandBuffer(), static_cast<const IndirectBuffer&>(indirectBuffer).getVkBuffer(), indirectBufferOffset, static_cast<const IndirectBuffer&>(countBuffer).getVkBuffer(), countBufferOffset, maximumNumberOfDraws, sizeof(VkDrawIndexedIndirectCommand));
+	}
+
+	//[-------------------------------------------------------]
+	//[ Compute                                               ]
+	//[-------------------------------------------------------]
+	void VulkanRenderer::dispatchCompute(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+	{
+		// Sanity check
+		// -> Vulkan dispatch commands can only be executed outside a Vulkan render pass, so dispatch before starting to draw into a render target
+		RENDERER_ASSERT(mContext, !mInsideVulkanRenderPass, "Can't execute Vulkan dispatch compute command inside a Vulkan render pass")
+
+		// Dispatch the compute work groups
+		const VkCommandBuffer vkCommandBuffer = getVulkanContext().getVkCommandBuffer();
+		vkCmdDispatch(vkCommandBuffer, groupCountX, groupCountY, groupCountZ);
+
+		// Make the compute shader writes visible to all following commands
+		// TODO(co) Let the user specify more fine granular barriers
+		const VkMemoryBarrier vkMemoryBarrier =
+		{
+			VK_STRUCTURE_TYPE_MEMORY_BARRIER,	// sType (VkStructureType)
+			nullptr,							// pNext (const void*)
+			VK_ACCESS_SHADER_WRITE_BIT,			// srcAccessMask (VkAccessFlags)
+			VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_HOST_READ_BIT	// dstAccessMask (VkAccessFlags)
+		};
+		vkCmdPipelineBarrier(vkCommandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &vkMemoryBarrier, 0, nullptr, 0, nullptr);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Query                                                 ]
+	//[-------------------------------------------------------]
+	void VulkanRenderer::resetQueryPool(Renderer::IQueryPool& queryPool, uint32_t firstQueryIndex, uint32_t numberOfQueries)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		// -> Vulkan query pool reset commands can only be executed outside a Vulkan render pass, so reset before starting to draw into a render target
+		RENDERER_ASSERT(mContext, !mInsideVulkanRenderPass, "Can't execute Vulkan reset query pool command inside a Vulkan render pass")
+		RENDERER_ASSERT(mContext, firstQueryIndex + numberOfQueries <= static_cast<const QueryPool&>(queryPool).getNumberOfQueries(), "Vulkan out-of-bounds query index")
+
+		// Reset the Vulkan queries
+		vkCmdResetQueryPool(getVulkanContext().getVkCommandBuffer(), static_cast<const QueryPool&>(queryPool).getVkQueryPool(), firstQueryIndex, numberOfQueries);
+	}
+
+	void VulkanRenderer::beginQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		const QueryPool& vulkanQueryPool = static_cast<const QueryPool&>(queryPool);
+		RENDERER_ASSERT(mContext, Renderer::QueryType::TIMESTAMP != vulkanQueryPool.getQueryType(), "Vulkan begin query needs an occlusion or pipeline statistics query pool")
+		RENDERER_ASSERT(mContext, queryIndex < vulkanQueryPool.getNumberOfQueries(), "Vulkan out-of-bounds query index")
+
+		// Start Vulkan render pass, if necessary
+		// -> A Vulkan query which is begun inside a Vulkan render pass must end inside the same subpass, the draw calls between begin and end query would otherwise start the render pass
+		if (!mInsideVulkanRenderPass && nullptr != mRenderTarget)
+		{
+			beginVulkanRenderPass();
+		}
+
+		// Begin the Vulkan query
+		vkCmdBeginQuery(getVulkanContext().getVkCommandBuffer(), vulkanQueryPool.getVkQueryPool(), queryIndex, 0);
+	}
+
+	void VulkanRenderer::endQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		const QueryPool& vulkanQueryPool = static_cast<const QueryPool&>(queryPool);
+		RENDERER_ASSERT(mContext, Renderer::QueryType::TIMESTAMP != vulkanQueryPool.getQueryType(), "Vulkan end query needs an occlusion or pipeline statistics query pool")
+		RENDERER_ASSERT(mContext, queryIndex < vulkanQueryPool.getNumberOfQueries(), "Vulkan out-of-bounds query index")
+
+		// End the Vulkan query
+		vkCmdEndQuery(getVulkanContext().getVkCommandBuffer(), vulkanQueryPool.getVkQueryPool(), queryIndex);
+	}
+
+	void VulkanRenderer::writeTimestampQuery(Renderer::IQueryPool& queryPool, uint32_t queryIndex)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		const QueryPool& vulkanQueryPool = static_cast<const QueryPool&>(queryPool);
+		RENDERER_ASSERT(mContext, Renderer::QueryType::TIMESTAMP == vulkanQueryPool.getQueryType(), "Vulkan write timestamp query needs a timestamp query pool")
+		RENDERER_ASSERT(mContext, queryIndex < vulkanQueryPool.getNumberOfQueries(), "Vulkan out-of-bounds query index")
+
+		// Write the Vulkan timestamp as soon as all previous commands completed execution
+		vkCmdWriteTimestamp(getVulkanContext().getVkCommandBuffer(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, vulkanQueryPool.getVkQueryPool(), queryIndex);
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Debug                                                 ]
 	//[-------------------------------------------------------]
@@ -943,6 +1173,24 @@ namespace VulkanRenderer
 		return RENDERER_NEW(mContext, RenderPass)(*this, numberOfColorAttachments, colorAttachmentTextureFormats, depthStencilAttachmentTextureFormat, numberOfMultisamples);
 	}
 
+	Renderer::IQueryPool* VulkanRenderer::createQueryPool(Renderer::QueryType queryType, uint32_t numberOfQueries)
+	{
+		// Sanity check
+		RENDERER_ASSERT(mContext, numberOfQueries > 0, "Vulkan: Number of queries mustn't be zero")
+
+		// The query type must be supported by the Vulkan device, see "initializeCapabilities()"
+		const bool supported = (Renderer::QueryType::OCCLUSION == queryType) ? mCapabilities.occlusionQuery : ((Renderer::QueryType::TIMESTAMP == queryType) ? mCapabilities.timestampQuery : mCapabilities.pipelineStatisticsQuery);
+		if (supported)
+		{
+			return RENDERER_NEW(mContext, QueryPool)(*this, queryType, numberOfQueries);
+		}
+		else
+		{
+			RENDERER_LOG(mContext, CRITICAL, "Vulkan: The asynchronous query type isn't supported by the Vulkan device")
+			return nullptr;
+		}
+	}
+
 	Renderer::ISwapChain* VulkanRenderer::createSwapChain(Renderer::IRenderPass& renderPass, Renderer::WindowHandle windowHandle, bool)
 	{
 		// Sanity checks
@@ -982,12 +1230,70 @@ namespace VulkanRenderer
 		return RENDERER_NEW(mContext, PipelineState)(*this, pipelineState);
 	}
 
+	Renderer::IComputePipelineState* VulkanRenderer::createComputePipelineState(Renderer::IRootSignature& rootSignature, Renderer::IComputeShader& computeShader)
+	{
+		// Security checks: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+		VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, rootSignature)
+		VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, computeShader)
+
+		// Create the compute pipeline state
+		return RENDERER_NEW(mContext, ComputePipelineState)(*this, rootSignature, computeShader);
+	}
+
 	Renderer::ISamplerState* VulkanRenderer::createSamplerState(const Renderer::SamplerState& samplerState)
 	{
 		return RENDERER_NEW(mContext, SamplerState)(*this, samplerState);
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Pipeline cache                                        ]
+	//[-------------------------------------------------------]
+	uint32_t VulkanRenderer::getPipelineCacheData(uint8_t* data, uint32_t numberOfBytes)
+	{
+		if (VK_NULL_HANDLE != mVkPipelineCache)
+		{
+			size_t dataSize = (nullptr != data) ? numberOfBytes : 0;
+			if (vkGetPipelineCacheData(mVulkanContext->getVkDevice(), mVkPipelineCache, &dataSize, data) >= VK_SUCCESS)	// "VK_INCOMPLETE" is fine as well
+			{
+				return static_cast<uint32_t>(dataSize);
+			}
+			RENDERER_LOG(mContext, CRITICAL, "Failed to get the Vulkan pipeline cache data")
+		}
+
+		// Error!
+		return 0;
+	}
+
+	bool VulkanRenderer::setPipelineCacheData(const uint8_t* data, uint32_t numberOfBytes)
+	{
+		// Sanity check
+		RENDERER_ASSERT(mContext, nullptr != data, "Invalid Vulkan pipeline cache data")
+
+		// Validate the Vulkan pipeline cache header ourself to be on the safe side, not all drivers are robust when it comes to pipeline cache data of other devices or driver versions
+		// -> Layout as defined by the Vulkan specification: Header length (uint32_t), header version (uint32_t), vendor ID (uint32_t), device ID (uint32_t), pipeline cache UUID (uint8_t[VK_UUID_SIZE])
+		static const uint32_t HEADER_NUMBER_OF_BYTES = sizeof(uint32_t) * 4 + VK_UUID_SIZE;
+		if (nullptr == mVulkanContext || numberOfBytes < HEADER_NUMBER_OF_BYTES)
+		{
+			return false;
+		}
+		uint32_t header[4] = {};
+		memcpy(header, data, sizeof(uint32_t) * 4);
+		VkPhysicalDeviceProperties vkPhysicalDeviceProperties;
+		vkGetPhysicalDeviceProperties(mVulkanContext->getVkPhysicalDevice(), &vkPhysicalDeviceProperties);
+		if (header[0] < HEADER_NUMBER_OF_BYTES || header[1] != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+			header[2] != vkPhysicalDeviceProperties.vendorID || header[3] != vkPhysicalDeviceProperties.deviceID ||
+			0 != memcmp(data + sizeof(uint32_t) * 4, vkPhysicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE))
+		{
+			// The pipeline cache data was created by another device or driver version, this is no error
+			return false;
+		}
+
+		// Replace the Vulkan pipeline cache
+		return createVkPipelineCache(data, numberOfBytes);
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
@@ -1066,15 +1372,18 @@ namespace VulkanRenderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can map, set known return values
 				mappedSubresource.data		 = nullptr;
@@ -1182,21 +1491,62 @@ namespace VulkanRenderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Nothing we can unmap
 				break;
 		}
 	}
 
+	bool VulkanRenderer::getQueryPoolResults(Renderer::IQueryPool& queryPool, uint32_t numberOfDataBytes, uint8_t* data, uint32_t firstQueryIndex, uint32_t numberOfQueries, uint32_t strideInBytes, uint32_t queryResultFlags)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, queryPool)
+
+		// Sanity checks
+		const QueryPool& vulkanQueryPool = static_cast<const QueryPool&>(queryPool);
+		RENDERER_ASSERT(mContext, firstQueryIndex + numberOfQueries <= vulkanQueryPool.getNumberOfQueries(), "Vulkan out-of-bounds query index")
+		const uint32_t numberOfResultBytes = (Renderer::QueryType::PIPELINE_STATISTICS == vulkanQueryPool.getQueryType()) ? sizeof(Renderer::PipelineStatisticsQueryResult) : sizeof(uint64_t);
+		if (0 == strideInBytes)
+		{
+			strideInBytes = numberOfResultBytes;
+		}
+		RENDERER_ASSERT(mContext, numberOfQueries > 0 && strideInBytes * (numberOfQueries - 1) + numberOfResultBytes <= numberOfDataBytes, "Vulkan query pool results data buffer is too small")
+
+		// Get the Vulkan query results, "VK_NOT_READY" is returned in case not all results are available, yet
+		const VkQueryResultFlags vkQueryResultFlags = (queryResultFlags & Renderer::QueryResultFlags::WAIT) ? (VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT) : VK_QUERY_RESULT_64_BIT;
+		if (vkGetQueryPoolResults(getVulkanContext().getVkDevice(), vulkanQueryPool.getVkQueryPool(), firstQueryIndex, numberOfQueries, numberOfDataBytes, data, strideInBytes, vkQueryResultFlags) != VK_SUCCESS)
+		{
+			// Not ready, yet
+			return false;
+		}
+
+		// Vulkan timestamps are in device specific ticks, convert them into nanoseconds
+		if (Renderer::QueryType::TIMESTAMP == vulkanQueryPool.getQueryType())
+		{
+			const double timestampPeriod = static_cast<double>(vulkanQueryPool.getTimestampPeriod());
+			for (uint32_t i = 0; i < numberOfQueries; ++i)
+			{
+				uint64_t& result = *reinterpret_cast<uint64_t*>(data + i * strideInBytes);
+				result = static_cast<uint64_t>(static_cast<double>(result) * timestampPeriod);
+			}
+		}
+
+		// Done
+		return true;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
@@ -1288,6 +1638,32 @@ namespace VulkanRenderer
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
+	bool VulkanRenderer::createVkPipelineCache(const uint8_t* data, uint32_t numberOfBytes)
+	{
+		const VkPipelineCacheCreateInfo vkPipelineCacheCreateInfo =
+		{
+			VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,	// sType (VkStructureType)
+			nullptr,										// pNext (const void*)
+			0,												// flags (VkPipelineCacheCreateFlags)
+			(nullptr != data) ? numberOfBytes : 0,			// initialDataSize (size_t)
+			data											// pInitialData (const void*)
+		};
+		VkPipelineCache vkPipelineCache = VK_NULL_HANDLE;
+		if (vkCreatePipelineCache(mVulkanContext->getVkDevice(), &vkPipelineCacheCreateInfo, getVkAllocationCallbacks(), &vkPipelineCache) != VK_SUCCESS)
+		{
+			RENDERER_LOG(mContext, CRITICAL, "Failed to create the Vulkan pipeline cache")
+			return false;
+		}
+		if (VK_NULL_HANDLE != mVkPipelineCache)
+		{
+			vkDestroyPipelineCache(mVulkanContext->getVkDevice(), mVkPipelineCache, getVkAllocationCallbacks());
+		}
+		mVkPipelineCache = vkPipelineCache;
+
+		// Done
+		return true;
+	}
+
 	void VulkanRenderer::initializeCapabilities()
 	{
 		{ // Get device name
@@ -1370,6 +1746,26 @@ namespace VulkanRenderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = true;
 
+		// Draw indirect count supported? ("VK_KHR_draw_indirect_count"-extension or "VK_AMD_draw_indirect_count"-extension required)
+		mCapabilities.drawIndirectCount = (nullptr != vkCmdDrawIndexedIndirectCountAMD);
+
+		{ // Asynchronous queries supported?
+			// -> Occlusion queries are a core feature
+			// -> Timestamp queries need a graphics queue family with valid timestamp bits
+			// -> Pipeline statistics queries need the optional "VkPhysicalDeviceFeatures::pipelineStatisticsQuery" feature, which is enabled on device creation if supported
+			const VkPhysicalDevice vkPhysicalDevice = mVulkanContext->getVkPhysicalDevice();
+			uint32_t queueFamilyPropertyCount = 0;
+			vkGetPhysicalDeviceQueueFamilyProperties(vkPhysicalDevice, &queueFamilyPropertyCount, nullptr);
+			std::vector<VkQueueFamilyProperties> vkQueueFamilyProperties(queueFamilyPropertyCount);
+			vkGetPhysicalDeviceQueueFamilyProperties(vkPhysicalDevice, &queueFamilyPropertyCount, vkQueueFamilyProperties.data());
+			const uint32_t graphicsQueueFamilyIndex = mVulkanContext->getGraphicsQueueFamilyIndex();
+			VkPhysicalDeviceFeatures vkPhysicalDeviceFeatures;
+			vkGetPhysicalDeviceFeatures(vkPhysicalDevice, &vkPhysicalDeviceFeatures);
+			mCapabilities.occlusionQuery = true;
+			mCapabilities.timestampQuery = (graphicsQueueFamilyIndex < queueFamilyPropertyCount && vkQueueFamilyProperties[graphicsQueueFamilyIndex].timestampValidBits > 0);
+			mCapabilities.pipelineStatisticsQuery = (VK_TRUE == vkPhysicalDeviceFeatures.pipelineStatisticsQuery);
+		}
+
 		// Vulkan has native multi-threading
 		mCapabilities.nativeMultiThreading = false;	// TODO(co) Enable native multi-threading when done
 
@@ -1381,6 +1777,9 @@ namespace VulkanRenderer
 
 		// Is there support for fragment shaders (FS)?
 		mCapabilities.fragmentShader = true;
+
+		// Is there support for compute shaders (CS)?
+		mCapabilities.computeShader = true;
 	}
 
 	void VulkanRenderer::iaUnsetVertexArray()
@@ -1427,6 +1826,7 @@ namespace VulkanRenderer
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::RENDER_PASS:
+			case Renderer::ResourceType::QUERY_POOL:
 			case Renderer::ResourceType::INDEX_BUFFER:
 			case Renderer::ResourceType::VERTEX_BUFFER:
 			case Renderer::ResourceType::UNIFORM_BUFFER:
@@ -1438,12 +1838,14 @@ namespace VulkanRenderer
 			case Renderer::ResourceType::TEXTURE_3D:
 			case Renderer::ResourceType::TEXTURE_CUBE:
 			case Renderer::ResourceType::PIPELINE_STATE:
+			case Renderer::ResourceType::COMPUTE_PIPELINE_STATE:
 			case Renderer::ResourceType::SAMPLER_STATE:
 			case Renderer::ResourceType::VERTEX_SHADER:
 			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			default:
 				// Not handled in here
 				break;
@@ -1451,6 +1853,49 @@ namespace VulkanRenderer
 		mInsideVulkanRenderPass = true;
 	}
 
+	void VulkanRenderer::setResourceGroup(const RootSignature& rootSignature, VkPipelineBindPoint vkPipelineBindPoint, uint32_t rootParameterIndex, Renderer::IResourceGroup* resourceGroup)
+	{
+		// Security checks
+		#ifdef RENDERER_DEBUG
+		{
+			const Renderer::RootSignature& rendererRootSignature = rootSignature.getRootSignature();
+			if (rootParameterIndex >= rendererRootSignature.numberOfParameters)
+			{
+				RENDERER_LOG(mContext, CRITICAL, "The Vulkan renderer backend root parameter index is out of bounds")
+				return;
+			}
+			const Renderer::RootParameter& rootParameter = rendererRootSignature.parameters[rootParameterIndex];
+			if (Renderer::RootParameterType::DESCRIPTOR_TABLE != rootParameter.parameterType)
+			{
+				RENDERER_LOG(mContext, CRITICAL, "The Vulkan renderer backend root parameter index doesn't reference a descriptor table")
+				return;
+			}
+			if (nullptr == reinterpret_cast<const Renderer::DescriptorRange*>(rootParameter.descriptorTable.descriptorRanges))
+			{
+				RENDERER_LOG(mContext, CRITICAL, "The Vulkan renderer backend descriptor ranges is a null pointer")
+				return;
+			}
+		}
+		#endif
+
+		if (nullptr != resourceGroup)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			VULKANRENDERER_RENDERERMATCHCHECK_ASSERT(*this, *resourceGroup)
+
+			// Bind Vulkan descriptor set
+			const VkDescriptorSet vkDescriptorSet = static_cast<ResourceGroup*>(resourceGroup)->getVkDescriptorSet();
+			if (VK_NULL_HANDLE != vkDescriptorSet)
+			{
+				vkCmdBindDescriptorSets(getVulkanContext().getVkCommandBuffer(), vkPipelineBindPoint, rootSignature.getVkPipelineLayout(), rootParameterIndex, 1, &vkDescriptorSet, 0, nullptr);
+			}
+		}
+		else
+		{
+			// TODO(co) Handle this situation?
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
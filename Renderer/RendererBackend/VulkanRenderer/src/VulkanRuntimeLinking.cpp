@@ -391,6 +391,7 @@ namespace VulkanRenderer
 		IMPORT_FUNC(vkDestroyFramebuffer)
 		IMPORT_FUNC(vkCreatePipelineCache)
 		IMPORT_FUNC(vkDestroyPipelineCache)
+		IMPORT_FUNC(vkGetPipelineCacheData)
 		IMPORT_FUNC(vkCreatePipelineLayout)
 		IMPORT_FUNC(vkDestroyPipelineLayout)
 		IMPORT_FUNC(vkCreateGraphicsPipelines)
@@ -410,6 +411,7 @@ namespace VulkanRenderer
 		IMPORT_FUNC(vkCmdEndQuery)
 		IMPORT_FUNC(vkCmdResetQueryPool)
 		IMPORT_FUNC(vkCmdCopyQueryPoolResults)
+		IMPORT_FUNC(vkCmdWriteTimestamp)
 		IMPORT_FUNC(vkCmdPipelineBarrier)
 		IMPORT_FUNC(vkCmdBeginRenderPass)
 		IMPORT_FUNC(vkCmdEndRenderPass)
@@ -98,6 +98,7 @@ namespace RendererRuntime
 		RENDERERRUNTIME_API_EXPORT AssetPackage& getAssetPackageById(AssetPackageId assetPackageId) const;
 		RENDERERRUNTIME_API_EXPORT AssetPackage* tryGetAssetPackageById(AssetPackageId assetPackageId) const;
 		RENDERERRUNTIME_API_EXPORT void removeAssetPackage(AssetPackageId assetPackageId);
+		inline const AssetPackageVector& getAssetPackageVector() const;
 
 		//[-------------------------------------------------------]
 		//[ Asset                                                 ]
@@ -28,6 +28,11 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
+	inline const AssetManager::AssetPackageVector& AssetManager::getAssetPackageVector() const
+	{
+		return mAssetPackageVector;
+	}
+
 	inline const Asset& AssetManager::getAssetByAssetId(AssetId assetId) const
 	{
 		const Asset* asset = tryGetAssetByAssetId(assetId);
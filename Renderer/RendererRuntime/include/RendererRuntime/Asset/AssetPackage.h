@@ -34,8 +34,14 @@
 PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
 	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
 	#include <vector>
+	#include <string>
 PRAGMA_WARNING_POP
 
 
@@ -91,6 +97,7 @@ namespace RendererRuntime
 		inline explicit AssetPackage(AssetPackageId assetPackageId);
 		inline ~AssetPackage();
 		inline AssetPackageId getAssetPackageId() const;
+		inline const std::string& getVirtualFilename() const;
 		inline void clear();
 		inline const SortedAssetVector& getSortedAssetVector() const;
 		RENDERERRUNTIME_API_EXPORT void addAsset(const Context& context, AssetId assetId, VirtualFilename virtualFilename);
@@ -115,6 +122,7 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	private:
 		AssetPackageId	  mAssetPackageId;
+		std::string		  mVirtualFilename;		///< UTF-8 virtual filename of the loaded asset package file (example "Example/Content.assets"), empty if the asset package wasn't loaded from a file
 		SortedAssetVector mSortedAssetVector;	///< Sorted vector of assets
 
 
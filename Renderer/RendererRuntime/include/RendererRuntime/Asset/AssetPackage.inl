@@ -56,6 +56,11 @@ namespace RendererRuntime
 		return mAssetPackageId;
 	}
 
+	inline const std::string& AssetPackage::getVirtualFilename() const
+	{
+		return mVirtualFilename;
+	}
+
 	inline void AssetPackage::clear()
 	{
 		mSortedAssetVector.clear();
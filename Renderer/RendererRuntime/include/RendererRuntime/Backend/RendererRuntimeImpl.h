@@ -120,6 +120,7 @@ namespace RendererRuntime
 		virtual void clearPipelineStateObjectCache() override;
 		virtual void loadPipelineStateObjectCache() override;
 		virtual void savePipelineStateObjectCache() override;
+		virtual bool saveShippedPipelineStateObjectCache(IFileManager& fileManager, VirtualFilename assetPackageVirtualFilename) override;
 
 
 	//[-------------------------------------------------------]
@@ -136,6 +137,21 @@ namespace RendererRuntime
 		explicit RendererRuntimeImpl(const RendererRuntimeImpl& source) = delete;
 		RendererRuntimeImpl& operator =(const RendererRuntimeImpl& source) = delete;
 
+		/**
+		*  @brief
+		*    Load the renderer implementation specific pipeline cache, if there's one
+		*
+		*  @note
+		*    - Must be called before any renderer pipeline state is created
+		*/
+		void loadRendererPipelineCache();
+
+		/**
+		*  @brief
+		*    Save the renderer implementation specific pipeline cache, if it has been changed
+		*/
+		void saveRendererPipelineCache();
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
@@ -151,6 +167,8 @@ namespace RendererRuntime
 		// Resource hot-reloading
 		std::mutex					mAssetIdsOfResourcesToReloadMutex;
 		AssetIdsOfResourcesToReload	mAssetIdsOfResourcesToReload;
+		// Renderer pipeline cache
+		uint32_t mRendererPipelineCacheNumberOfBytes;	///< Number of bytes of the renderer pipeline cache data as loaded or saved the last time, used to detect whether or not saving is required
 
 
 	};
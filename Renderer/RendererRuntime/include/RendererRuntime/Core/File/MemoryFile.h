@@ -92,6 +92,7 @@ namespace RendererRuntime
 		inline virtual ~MemoryFile() override;
 		inline ByteVector& getByteVector();
 		inline const ByteVector& getByteVector() const;
+		inline size_t getNumberOfRemainingBytes() const;
 		RENDERERRUNTIME_API_EXPORT bool loadLz4CompressedDataByVirtualFilename(uint32_t formatType, uint32_t formatVersion, const IFileManager& fileManager, VirtualFilename virtualFilename);
 		RENDERERRUNTIME_API_EXPORT bool loadLz4CompressedDataFromFile(uint32_t formatType, uint32_t formatVersion, IFile& file);
 		RENDERERRUNTIME_API_EXPORT void setLz4CompressedDataByFile(IFile& file, uint32_t numberOfCompressedBytes, uint32_t numberOfDecompressedBytes);
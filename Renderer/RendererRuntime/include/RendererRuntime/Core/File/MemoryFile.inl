@@ -71,6 +71,11 @@ namespace RendererRuntime
 		return mDecompressedData;
 	}
 
+	inline size_t MemoryFile::getNumberOfRemainingBytes() const
+	{
+		return (nullptr != mCurrentDataPointer) ? (mDecompressedData.size() - static_cast<size_t>(mCurrentDataPointer - mDecompressedData.data())) : 0;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual RendererRuntime::IFile methods         ]
@@ -0,0 +1,367 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Export.h"
+#include "RendererRuntime/Core/Manager.h"
+#include "RendererRuntime/Core/File/IFileManager.h"
+
+#include <Renderer/Public/Renderer.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Hierarchical CPU frame profiler
+	*
+	*  @remarks
+	*    Each thread records its finished scopes into an own fixed size ring buffer, so recording doesn't need any locks: only the owning
+	*    thread writes into a ring buffer and publishes the number of written events via an atomic, frames are published the same way.
+	*    Readers like the debug GUI timeline or the Chrome trace export copy the published events and afterwards discard all copied events
+	*    the owning thread might have overwritten in the meantime, so a reader never returns a torn event. The ring buffer of a thread is
+	*    registered lazily when the thread records its first event and is recycled for another thread as soon as the thread exits.
+	*
+	*    Don't use the profiler methods directly, use the "RENDERER_RUNTIME_CPU_PROFILER_*"-macros instead so the instrumentation
+	*    can be optimized out in retail builds.
+	*
+	*  @note
+	*    - Event names must be static strings (e.g. string literals or "__FUNCTION__"), only the pointer is stored
+	*    - The Chrome trace can be viewed using "chrome://tracing" or https://ui.perfetto.dev/
+	*/
+	class CpuProfiler final : private Manager
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const uint32_t NUMBER_OF_EVENTS_PER_THREAD = 8192;	///< Must be a power of two
+		static const uint32_t MAXIMUM_NUMBER_OF_THREADS	  = 64;		///< Maximum number of simultaneously profiled threads, threads above this limit aren't profiled
+		static const uint32_t NUMBER_OF_FRAMES			  = 64;		///< Number of remembered frame begin timestamps
+		struct Event final
+		{
+			const char* name;				///< Static event name, never a null pointer
+			uint64_t	beginNanoseconds;	///< Event begin timestamp in nanoseconds
+			uint64_t	endNanoseconds;		///< Event end timestamp in nanoseconds
+			uint32_t	depth;				///< Nesting depth inside the thread, 0 = top level
+			uint32_t	threadIndex;		///< Profiler thread index, not the operating system thread ID
+		};
+		typedef std::vector<Event> Events;
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the current profiler timestamp
+		*
+		*  @return
+		*    Monotonic timestamp in nanoseconds
+		*/
+		RENDERERRUNTIME_API_EXPORT static uint64_t getNanoseconds();
+
+		/**
+		*  @brief
+		*    Mark the begin of a new frame
+		*
+		*  @note
+		*    - Called by "RendererRuntime::IRendererRuntime::update()", there's usually no need to call this method manually
+		*/
+		RENDERERRUNTIME_API_EXPORT static void beginFrame();
+
+		/**
+		*  @brief
+		*    Begin a profiler event inside the current thread
+		*
+		*  @return
+		*    Begin timestamp in nanoseconds, pass it to "RendererRuntime::CpuProfiler::endEvent()"
+		*/
+		RENDERERRUNTIME_API_EXPORT static uint64_t beginEvent();
+
+		/**
+		*  @brief
+		*    End a profiler event inside the current thread
+		*
+		*  @param[in] name
+		*    Static event name, must be valid as long as the profiler is used
+		*  @param[in] beginNanoseconds
+		*    Begin timestamp returned by "RendererRuntime::CpuProfiler::beginEvent()"
+		*/
+		RENDERERRUNTIME_API_EXPORT static void endEvent(const char* name, uint64_t beginNanoseconds);
+
+		/**
+		*  @brief
+		*    Return the number of threads which recorded events
+		*
+		*  @return
+		*    The number of threads which recorded events
+		*/
+		RENDERERRUNTIME_API_EXPORT static uint32_t getNumberOfThreads();
+
+		/**
+		*  @brief
+		*    Gather the events of the last completed frame
+		*
+		*  @param[out] events
+		*    Receives the events which are fully inside the last completed frame, the list is cleared before new entries are added
+		*  @param[out] frameBeginNanoseconds
+		*    Receives the frame begin timestamp in nanoseconds
+		*  @param[out] frameEndNanoseconds
+		*    Receives the frame end timestamp in nanoseconds
+		*
+		*  @return
+		*    "true" if there's a completed frame, else "false"
+		*/
+		RENDERERRUNTIME_API_EXPORT static bool getLastFrameEvents(Events& events, uint64_t& frameBeginNanoseconds, uint64_t& frameEndNanoseconds);
+
+		/**
+		*  @brief
+		*    Write all currently recorded events as Chrome trace event JSON file
+		*
+		*  @param[in] fileManager
+		*    File manager to use
+		*  @param[in] virtualFilename
+		*    UTF-8 virtual filename of the file to write
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*/
+		RENDERERRUNTIME_API_EXPORT static bool writeChromeTrace(const IFileManager& fileManager, VirtualFilename virtualFilename);
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		CpuProfiler() = delete;
+		~CpuProfiler() = delete;
+		explicit CpuProfiler(const CpuProfiler&) = delete;
+		CpuProfiler& operator=(const CpuProfiler&) = delete;
+
+
+	};
+
+	/**
+	*  @brief
+	*    Scoped CPU profiler event, use "RENDERER_RUNTIME_CPU_PROFILER_SCOPE()" instead of using this class directly
+	*/
+	class CpuProfilerScope final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline explicit CpuProfilerScope(const char* name);
+		inline ~CpuProfilerScope();
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit CpuProfilerScope(const CpuProfilerScope&) = delete;
+		CpuProfilerScope& operator=(const CpuProfilerScope&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		const char* mName;				///< Static event name, never a null pointer
+		uint64_t	mBeginNanoseconds;	///< Event begin timestamp in nanoseconds
+
+
+	};
+
+	/**
+	*  @brief
+	*    Scoped CPU profiler event which additionally emits a renderer debug event into a command buffer, use "RENDERER_RUNTIME_CPU_PROFILER_COMMAND_BUFFER_SCOPE()" instead of using this class directly
+	*/
+	class CpuProfilerCommandBufferScope final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline CpuProfilerCommandBufferScope(Renderer::CommandBuffer& commandBuffer, const char* name);
+		inline ~CpuProfilerCommandBufferScope();
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit CpuProfilerCommandBufferScope(const CpuProfilerCommandBufferScope&) = delete;
+		CpuProfilerCommandBufferScope& operator=(const CpuProfilerCommandBufferScope&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Renderer::CommandBuffer& mCommandBuffer;	///< Command buffer to emit the debug event into
+		CpuProfilerScope		 mCpuProfilerScope;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/Time/CpuProfiler.inl"
+
+
+//[-------------------------------------------------------]
+//[ Debug                                                 ]
+//[-------------------------------------------------------]
+// Debug macros
+#define RENDERER_RUNTIME_CPU_PROFILER_CONCATENATE_DETAIL(a, b) a##b
+#define RENDERER_RUNTIME_CPU_PROFILER_CONCATENATE(a, b) RENDERER_RUNTIME_CPU_PROFILER_CONCATENATE_DETAIL(a, b)
+#ifdef RENDERER_DEBUG
+	/**
+	*  @brief
+	*    Mark the begin of a new CPU profiler frame
+	*
+	*  @note
+	*    - Use this macro for debugging helpers only to make it possible to optimize it out in retail builds
+	*/
+	#define RENDERER_RUNTIME_CPU_PROFILER_BEGIN_FRAME() RendererRuntime::CpuProfiler::beginFrame();
+
+	/**
+	*  @brief
+	*    Profile the CPU time of the current scope
+	*
+	*  @param[in] name
+	*    Static ASCII event name
+	*
+	*  @note
+	*    - Use this macro for debugging helpers only to make it possible to optimize it out in retail builds
+	*/
+	#define RENDERER_RUNTIME_CPU_PROFILER_SCOPE(name) RendererRuntime::CpuProfilerScope RENDERER_RUNTIME_CPU_PROFILER_CONCATENATE(cpuProfilerScope, __LINE__)(name);
+
+	/**
+	*  @brief
+	*    Profile the CPU time of the current scope, the current function name is used as event name
+	*
+	*  @note
+	*    - Use this macro for debugging helpers only to make it possible to optimize it out in retail builds
+	*/
+	#define RENDERER_RUNTIME_CPU_PROFILER_SCOPE_FUNCTION() RendererRuntime::CpuProfilerScope RENDERER_RUNTIME_CPU_PROFILER_CONCATENATE(cpuProfilerScope, __LINE__)(__FUNCTION__);
+
+	/**
+	*  @brief
+	*    Profile the CPU time of the current scope and wrap the commands added to the given command buffer inside this scope into a renderer debug event
+	*
+	*  @param[in] commandBuffer
+	*    Command buffer to emit the debug event into, must stay valid until the scope ends
+	*  @param[in] name
+	*    Static ASCII event name
+	*
+	*  @note
+	*    - Use this macro for debugging helpers only to make it possible to optimize it out in retail builds
+	*/
+	#define RENDERER_RUNTIME_CPU_PROFILER_COMMAND_BUFFER_SCOPE(commandBuffer, name) RendererRuntime::CpuProfilerCommandBufferScope RENDERER_RUNTIME_CPU_PROFILER_CONCATENATE(cpuProfilerScope, __LINE__)(commandBuffer, name);
+#else
+	/**
+	*  @brief
+	*    Mark the begin of a new CPU profiler frame
+	*
+	*  @note
+	*    - Use this macro for debugging helpers only to make it possible to optimize it out in retail builds
+	*/
+	#define RENDERER_RUNTIME_CPU_PROFILER_BEGIN_FRAME()
+
+	/**
+	*  @brief
+	*    Profile the CPU time of the current scope
+	*
+	*  @param[in] name
+	*    Static ASCII event name
+	*
+	*  @note
+	*    - Use this macro for debugging helpers only to make it possible to optimize it out in retail builds
+	*/
+	#define RENDERER_RUNTIME_CPU_PROFILER_SCOPE(name)
+
+	/**
+	*  @brief
+	*    Profile the CPU time of the current scope, the current function name is used as event name
+	*
+	*  @note
+	*    - Use this macro for debugging helpers only to make it possible to optimize it out in retail builds
+	*/
+	#define RENDERER_RUNTIME_CPU_PROFILER_SCOPE_FUNCTION()
+
+	/**
+	*  @brief
+	*    Profile the CPU time of the current scope and wrap the commands added to the given command buffer inside this scope into a renderer debug event
+	*
+	*  @param[in] commandBuffer
+	*    Command buffer to emit the debug event into, must stay valid until the scope ends
+	*  @param[in] name
+	*    Static ASCII event name
+	*
+	*  @note
+	*    - Use this macro for debugging helpers only to make it possible to optimize it out in retail builds
+	*/
+	#define RENDERER_RUNTIME_CPU_PROFILER_COMMAND_BUFFER_SCOPE(commandBuffer, name)
+#endif
@@ -0,0 +1,59 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	inline CpuProfilerScope::CpuProfilerScope(const char* name) :
+		mName(name),
+		mBeginNanoseconds(CpuProfiler::beginEvent())
+	{
+		// Nothing here
+	}
+
+	inline CpuProfilerScope::~CpuProfilerScope()
+	{
+		CpuProfiler::endEvent(mName, mBeginNanoseconds);
+	}
+
+	inline CpuProfilerCommandBufferScope::CpuProfilerCommandBufferScope(Renderer::CommandBuffer& commandBuffer, const char* name) :
+		mCommandBuffer(commandBuffer),
+		mCpuProfilerScope(name)
+	{
+		COMMAND_BEGIN_DEBUG_EVENT(mCommandBuffer, name)
+	}
+
+	inline CpuProfilerCommandBufferScope::~CpuProfilerCommandBufferScope()
+	{
+		COMMAND_END_DEBUG_EVENT(mCommandBuffer)
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
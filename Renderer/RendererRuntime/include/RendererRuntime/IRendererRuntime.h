@@ -83,7 +83,8 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Global definitions                                    ]
 	//[-------------------------------------------------------]
-	typedef StringId AssetId;	///< Asset identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset type>/<asset category>/<asset name>"
+	typedef StringId AssetId;				///< Asset identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset type>/<asset category>/<asset name>"
+	typedef const char* VirtualFilename;	///< UTF-8 virtual filename, the virtual filename scheme is "<mount point = project name>/<asset type>/<asset category>/<asset name>.<file extension>" (example "Example/Mesh/Monster/Squirrel.mesh"), never ever a null pointer and always finished by a terminating zero
 
 
 	//[-------------------------------------------------------]
@@ -393,6 +394,28 @@ namespace RendererRuntime
 		virtual void loadPipelineStateObjectCache() = 0;
 		virtual void savePipelineStateObjectCache() = 0;
 
+		/**
+		*  @brief
+		*    Save the current pipeline state object cache as pipeline state object cache shipped together with an asset package
+		*
+		*  @param[in] fileManager
+		*    File manager to use for writing
+		*  @param[in] assetPackageVirtualFilename
+		*    UTF-8 virtual filename of the asset package the pipeline state object cache is shipped with (example "DataPc/Example/Content/Content.assets")
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*
+		*  @remarks
+		*    The shipped pipeline state object cache is stored next to the asset package as "<asset package>.<renderer name>.pso_cache". In case there's
+		*    no locally saved pipeline state object cache, "RendererRuntime::IRendererRuntime::loadPipelineStateObjectCache()" loads the shipped pipeline
+		*    state object cache of the mounted asset packages instead. The renderer toolkit uses this to precompile the pipeline state object cache offline.
+		*
+		*  @note
+		*    - Requires renderer backend shader bytecode support or a shader bytecode compiler, see "RendererRuntime::ShaderBlueprintResourceManager::setShaderBytecodeCompiler()"
+		*/
+		virtual bool saveShippedPipelineStateObjectCache(IFileManager& fileManager, VirtualFilename assetPackageVirtualFilename) = 0;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -115,6 +115,7 @@ namespace RendererRuntime
 
 		inline ~RenderQueue();
 		inline uint32_t getNumberOfDrawCalls() const;
+		inline uint32_t getNumberOfTriangles() const;	// Number of triangles of the queued renderables, assumes triangle lists, useful e.g. for measuring the effect of the LOD selection
 		inline uint8_t getMinimumRenderQueueIndex() const;
 		inline uint8_t getMaximumRenderQueueIndex() const;
 		void clear();
@@ -176,6 +177,7 @@ namespace RendererRuntime
 		uint32_t				mNumberOfNullDrawCalls;
 		uint32_t				mNumberOfDrawIndexedInstancedCalls;
 		uint32_t				mNumberOfDrawInstancedCalls;
+		uint32_t				mNumberOfTriangles;
 		uint8_t					mMinimumRenderQueueIndex;	///< Inclusive
 		uint8_t					mMaximumRenderQueueIndex;	///< Inclusive
 		bool					mTransparentPass;
@@ -38,6 +38,11 @@ namespace RendererRuntime
 		return mNumberOfNullDrawCalls + mNumberOfDrawIndexedInstancedCalls + mNumberOfDrawInstancedCalls;
 	}
 
+	inline uint32_t RenderQueue::getNumberOfTriangles() const
+	{
+		return mNumberOfTriangles;
+	}
+
 	inline uint8_t RenderQueue::getMinimumRenderQueueIndex() const
 	{
 		return mMinimumRenderQueueIndex;
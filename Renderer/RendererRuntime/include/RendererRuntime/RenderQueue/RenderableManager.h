@@ -30,6 +30,8 @@
 #include "RendererRuntime/Core/Manager.h"
 #include "RendererRuntime/RenderQueue/Renderable.h"
 
+#include <cstring>	// For "memcpy()"
+
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
@@ -74,6 +76,8 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	public:
 		typedef std::vector<Renderable> Renderables;
+		typedef std::vector<float>		LodMinimumScreenSizes;	///< Per LOD minimum projected screen size, see "RendererRuntime::RenderableManager::setLods()"
+		typedef std::vector<float>		InstanceCustomParameters;	///< Instance texture buffer custom parameters, see "RendererRuntime::RenderableManager::setInstanceCustomParameters()"
 
 
 	//[-------------------------------------------------------]
@@ -93,11 +97,60 @@ namespace RendererRuntime
 		inline bool isVisible() const;
 		inline void setVisible(bool visible);
 
+		//[-------------------------------------------------------]
+		//[ Level of detail (LOD)                                 ]
+		//[-------------------------------------------------------]
+		inline uint8_t getNumberOfLods() const;
+		inline uint32_t getNumberOfRenderablesPerLod() const;
+		inline const LodMinimumScreenSizes& getLodMinimumScreenSizes() const;
+
+		/**
+		*  @brief
+		*    Set the level of detail (LOD) chain
+		*
+		*  @param[in] numberOfLods
+		*    Number of LODs, at least one, the renderables are stored LOD-major meaning the renderables of LOD 0 are followed by the renderables of LOD 1 and so on
+		*  @param[in] lodMinimumScreenSizes
+		*    Per LOD minimum projected screen size (bounding sphere diameter in relation to the render target height), "numberOfLods" entries, can be a null pointer if there's only a single LOD
+		*
+		*  @note
+		*    - The number of renderables must be a multiple of the number of LODs
+		*/
+		RENDERERRUNTIME_API_EXPORT void setLods(uint8_t numberOfLods, const float* lodMinimumScreenSizes);
+
+		//[-------------------------------------------------------]
+		//[ Instance custom parameters                            ]
+		//[-------------------------------------------------------]
+		inline const InstanceCustomParameters& getInstanceCustomParameters() const;
+
+		/**
+		*  @brief
+		*    Set the instance custom parameters
+		*
+		*  @param[in] numberOfFloats
+		*    Number of floats, must be a multiple of four since the instance texture buffer is working with "float4", zero to remove the instance custom parameters
+		*  @param[in] instanceCustomParameters
+		*    Instance custom parameters, can be a null pointer if "numberOfFloats" is zero, the data is copied
+		*
+		*  @remarks
+		*    The instance custom parameters are written into the instance texture buffer after the "POSITION_ROTATION_SCALE"-semantic and the optional bone
+		*    matrices, the shader gets the start index via the z-component of the "INSTANCE_INDICES"-reference (e.g. used for the mesh vertex dequantization)
+		*/
+		RENDERERRUNTIME_API_EXPORT void setInstanceCustomParameters(uint32_t numberOfFloats, const float* instanceCustomParameters);
+
 		//[-------------------------------------------------------]
 		//[ Cached data                                           ]
 		//[-------------------------------------------------------]
 		inline float getCachedDistanceToCamera() const;
 		inline void setCachedDistanceToCamera(float distanceToCamera);
+		inline const float* getCachedWorldSpaceBoundingSphere() const;	// World space bounding sphere center position (xyz) and radius (w), a negative radius means the renderable manager can't be culled, only updated if GPU culling is enabled
+		inline void setCachedWorldSpaceBoundingSphere(float x, float y, float z, float radius);
+		inline const float* getCachedWorldSpaceOrientedBoundingBox() const;	// World space object-oriented bounding box center position (xyz) followed by the three half axes (xyz each), only updated if GPU culling is enabled
+		inline void setCachedWorldSpaceOrientedBoundingBox(const float worldSpaceOrientedBoundingBox[12]);
+		inline float getCachedProjectedScreenSize() const;
+		inline void setCachedProjectedScreenSize(float projectedScreenSize);
+		inline uint8_t getCachedLodIndex() const;
+		inline void setCachedLodIndex(uint8_t lodIndex);
 
 		/**
 		*  @brief
@@ -160,14 +213,23 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	private:
 		// Data
-		Renderables		 mRenderables;				///< Renderables
-		const Transform* mTransform;				///< Transform instance, always valid, just shared meaning doesn't own the instance so don't delete it
-		bool			 mVisible;
+		Renderables				 mRenderables;				///< Renderables
+		const Transform*		 mTransform;				///< Transform instance, always valid, just shared meaning doesn't own the instance so don't delete it
+		bool					 mVisible;
+		// Level of detail (LOD)
+		uint8_t					 mNumberOfLods;				///< Number of LODs, at least one
+		LodMinimumScreenSizes	 mLodMinimumScreenSizes;	///< Per LOD minimum projected screen size, empty if there's only a single LOD
+		// Instance custom parameters
+		InstanceCustomParameters mInstanceCustomParameters;	///< Instance texture buffer custom parameters, usually empty
 		// Cached data
-		float			 mCachedDistanceToCamera;	///< Cached distance to camera is updated during the culling phase
-		uint8_t			 mMinimumRenderQueueIndex;	///< The minimum renderables render queue index (inclusive, set inside "RendererRuntime::RenderableManager::updateCachedRenderablesData()")
-		uint8_t			 mMaximumRenderQueueIndex;	///< The maximum renderables render queue index (inclusive, set inside "RendererRuntime::RenderableManager::updateCachedRenderablesData()")
-		bool			 mCastShadows;				///< "true" if at least one of the renderables is casting shadows, else "false" (set inside "RendererRuntime::RenderableManager::updateCachedRenderablesData()")
+		float					 mCachedDistanceToCamera;	///< Cached distance to camera is updated during the culling phase
+		float					 mCachedWorldSpaceBoundingSphere[4];	///< Cached world space bounding sphere center position (xyz) and radius (w) is updated during the culling phase, only used by GPU culling
+		float					 mCachedWorldSpaceOrientedBoundingBox[12];	///< Cached world space object-oriented bounding box center position (xyz) followed by the three half axes (xyz each) is updated during the culling phase, only used by GPU culling
+		float					 mCachedProjectedScreenSize;	///< Cached projected screen size (bounding sphere diameter in relation to the render target height) is updated during the culling phase, used for LOD selection
+		uint8_t					 mCachedLodIndex;			///< Cached LOD index is updated by the render queue, kept across frames for hysteresis
+		uint8_t					 mMinimumRenderQueueIndex;	///< The minimum renderables render queue index (inclusive, set inside "RendererRuntime::RenderableManager::updateCachedRenderablesData()")
+		uint8_t					 mMaximumRenderQueueIndex;	///< The maximum renderables render queue index (inclusive, set inside "RendererRuntime::RenderableManager::updateCachedRenderablesData()")
+		bool					 mCastShadows;				///< "true" if at least one of the renderables is casting shadows, else "false" (set inside "RendererRuntime::RenderableManager::updateCachedRenderablesData()")
 
 
 	};
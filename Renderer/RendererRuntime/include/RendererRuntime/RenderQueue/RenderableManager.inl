@@ -66,6 +66,27 @@ namespace RendererRuntime
 		mVisible = visible;
 	}
 
+	inline uint8_t RenderableManager::getNumberOfLods() const
+	{
+		return mNumberOfLods;
+	}
+
+	inline uint32_t RenderableManager::getNumberOfRenderablesPerLod() const
+	{
+		assert(0 == mRenderables.size() % mNumberOfLods);
+		return static_cast<uint32_t>(mRenderables.size() / mNumberOfLods);
+	}
+
+	inline const RenderableManager::LodMinimumScreenSizes& RenderableManager::getLodMinimumScreenSizes() const
+	{
+		return mLodMinimumScreenSizes;
+	}
+
+	inline const RenderableManager::InstanceCustomParameters& RenderableManager::getInstanceCustomParameters() const
+	{
+		return mInstanceCustomParameters;
+	}
+
 	inline float RenderableManager::getCachedDistanceToCamera() const
 	{
 		return mCachedDistanceToCamera;
@@ -76,6 +97,50 @@ namespace RendererRuntime
 		mCachedDistanceToCamera = distanceToCamera;
 	}
 
+	inline const float* RenderableManager::getCachedWorldSpaceBoundingSphere() const
+	{
+		return mCachedWorldSpaceBoundingSphere;
+	}
+
+	inline void RenderableManager::setCachedWorldSpaceBoundingSphere(float x, float y, float z, float radius)
+	{
+		mCachedWorldSpaceBoundingSphere[0] = x;
+		mCachedWorldSpaceBoundingSphere[1] = y;
+		mCachedWorldSpaceBoundingSphere[2] = z;
+		mCachedWorldSpaceBoundingSphere[3] = radius;
+	}
+
+	inline const float* RenderableManager::getCachedWorldSpaceOrientedBoundingBox() const
+	{
+		return mCachedWorldSpaceOrientedBoundingBox;
+	}
+
+	inline void RenderableManager::setCachedWorldSpaceOrientedBoundingBox(const float worldSpaceOrientedBoundingBox[12])
+	{
+		memcpy(mCachedWorldSpaceOrientedBoundingBox, worldSpaceOrientedBoundingBox, sizeof(mCachedWorldSpaceOrientedBoundingBox));
+	}
+
+	inline float RenderableManager::getCachedProjectedScreenSize() const
+	{
+		return mCachedProjectedScreenSize;
+	}
+
+	inline void RenderableManager::setCachedProjectedScreenSize(float projectedScreenSize)
+	{
+		mCachedProjectedScreenSize = projectedScreenSize;
+	}
+
+	inline uint8_t RenderableManager::getCachedLodIndex() const
+	{
+		return mCachedLodIndex;
+	}
+
+	inline void RenderableManager::setCachedLodIndex(uint8_t lodIndex)
+	{
+		assert(lodIndex < mNumberOfLods);
+		mCachedLodIndex = lodIndex;
+	}
+
 	inline uint8_t RenderableManager::getMinimumRenderQueueIndex() const
 	{
 		return mMinimumRenderQueueIndex;
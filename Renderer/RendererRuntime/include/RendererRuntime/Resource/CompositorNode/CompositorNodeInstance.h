@@ -41,6 +41,7 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace Renderer
 {
+	class IQueryPool;
 	class IRenderTarget;
 	class CommandBuffer;
 }
@@ -95,7 +96,7 @@ namespace RendererRuntime
 		explicit CompositorNodeInstance(const CompositorNodeInstance&) = delete;
 		CompositorNodeInstance& operator=(const CompositorNodeInstance&) = delete;
 		void compositorWorkspaceInstanceLoadingFinished() const;
-		Renderer::IRenderTarget& fillCommandBuffer(Renderer::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Renderer::CommandBuffer& commandBuffer) const;
+		Renderer::IRenderTarget& fillCommandBuffer(Renderer::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Renderer::CommandBuffer& commandBuffer, Renderer::IQueryPool* timestampQueryPool, uint32_t& timestampQueryIndex) const;	// If there's a timestamp query pool, each compositor instance pass is enclosed by two timestamp queries starting at the given timestamp query index which is advanced accordingly
 
 		/**
 		*  @brief
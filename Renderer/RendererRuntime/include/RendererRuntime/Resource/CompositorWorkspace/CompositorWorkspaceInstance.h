@@ -102,6 +102,18 @@ namespace RendererRuntime
 		};
 		typedef std::vector<RenderQueueIndexRange> RenderQueueIndexRanges;
 
+		struct CompositorInstancePassGpuTiming final
+		{
+			const ICompositorInstancePass* compositorInstancePass;	///< Compositor instance pass, always valid, don't destroy the instance
+			uint64_t					   nanoseconds;				///< GPU time the compositor instance pass execution took, in nanoseconds
+
+			CompositorInstancePassGpuTiming(const ICompositorInstancePass* _compositorInstancePass, uint64_t _nanoseconds) :
+				compositorInstancePass(_compositorInstancePass),
+				nanoseconds(_nanoseconds)
+			{}
+		};
+		typedef std::vector<CompositorInstancePassGpuTiming> CompositorInstancePassGpuTimings;
+
 
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
@@ -121,6 +133,9 @@ namespace RendererRuntime
 		RENDERERRUNTIME_API_EXPORT void execute(Renderer::IRenderTarget& renderTarget, const CameraSceneItem* cameraSceneItem, const LightSceneItem* lightSceneItem, bool singlePassStereoInstancing = false);
 		inline Renderer::IRenderTarget* getExecutionRenderTarget() const;	// Only valid during compositor workspace instance execution
 		inline const Renderer::CommandBuffer& getCommandBuffer() const;
+		inline bool getGpuTimingsEnabled() const;
+		RENDERERRUNTIME_API_EXPORT void setGpuTimingsEnabled(bool gpuTimingsEnabled);	// Enclose each executed compositor instance pass by GPU timestamp queries, disabled by default, stays disabled if the renderer backend has no timestamp query support ("Renderer::Capabilities::timestampQuery")
+		inline const CompositorInstancePassGpuTimings& getCompositorInstancePassGpuTimings() const;	// Sequential compositor instance pass GPU timings, the results are read back a few frames after the execution without stalling the GPU, empty if GPU timings are disabled
 
 
 	//[-------------------------------------------------------]
@@ -141,6 +156,9 @@ namespace RendererRuntime
 		void createFramebuffersAndRenderTargetTextures(const Renderer::IRenderTarget& mainRenderTarget);
 		void destroyFramebuffersAndRenderTargetTextures();
 		void clearRenderQueueIndexRangesRenderableManagers();
+		Renderer::IQueryPool* beginGpuTimings(Renderer::IRenderer& renderer, uint32_t& timestampQueryIndex);	// Returns a null pointer if there are no GPU timings
+		void endGpuTimings(Renderer::IRenderer& renderer);
+		void destroyGpuTimings();
 
 
 	//[-------------------------------------------------------]
@@ -148,6 +166,9 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	private:
 		typedef std::vector<CompositorNodeInstance*> CompositorNodeInstances;
+		typedef std::vector<uint64_t> TimestampQueryResults;
+
+		static const uint32_t NUMBER_OF_GPU_TIMING_FRAMES = 4;	///< Number of frames the GPU timestamp queries are buffered before the results are read back, avoids stalling the GPU
 
 
 	//[-------------------------------------------------------]
@@ -167,6 +188,12 @@ namespace RendererRuntime
 		RenderQueueIndexRanges			 mRenderQueueIndexRanges;				///< The render queue index ranges layout is fixed during runtime
 		Renderer::CommandBuffer			 mCommandBuffer;						///< Command buffer
 		CompositorInstancePassShadowMap* mCompositorInstancePassShadowMap;		///< Can be a null pointer, don't destroy the instance
+		// GPU timings
+		bool							 mGpuTimingsEnabled;
+		Renderer::IQueryPoolPtr			 mTimestampQueryPool;					///< Timestamp query pool with two timestamp queries per compositor instance pass for each of the "NUMBER_OF_GPU_TIMING_FRAMES" frames, can be a null pointer
+		uint32_t						 mNumberOfGpuTimingFrames;				///< Number of frames recorded into the timestamp query pool
+		TimestampQueryResults			 mTimestampQueryResults;				///< Timestamp query results read back buffer, two timestamp queries per compositor instance pass
+		CompositorInstancePassGpuTimings mCompositorInstancePassGpuTimings;
 
 
 	};
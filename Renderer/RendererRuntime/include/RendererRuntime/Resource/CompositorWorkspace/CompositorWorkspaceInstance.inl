@@ -63,6 +63,16 @@ namespace RendererRuntime
 		return mCommandBuffer;
 	}
 
+	inline bool CompositorWorkspaceInstance::getGpuTimingsEnabled() const
+	{
+		return mGpuTimingsEnabled;
+	}
+
+	inline const CompositorWorkspaceInstance::CompositorInstancePassGpuTimings& CompositorWorkspaceInstance::getCompositorInstancePassGpuTimings() const
+	{
+		return mCompositorInstancePassGpuTimings;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
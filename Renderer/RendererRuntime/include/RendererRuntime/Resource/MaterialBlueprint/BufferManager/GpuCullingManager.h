@@ -0,0 +1,295 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/Manager.h"
+
+#include <Renderer/Public/Renderer.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/fwd.hpp>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+	class IRendererRuntime;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    GPU culling manager
+	*
+	*  @remarks
+	*    Optional GPU-driven culling path for indexed draws: Instead of writing the indirect draw arguments directly into an indirect buffer, the render
+	*    queue hands them over to the GPU culling manager together with the world space bounding sphere and the world space object-oriented bounding
+	*    box (OOBB) of the renderable manager. The draws are grouped into batches, one batch is one multi-draw-indirect command. Right before the command
+	*    buffer is executed, a compute shader frustum-culls all draws and writes the surviving draw arguments compacted into an indirect buffer, the number
+	*    of surviving draws of each batch is written into a count indirect buffer. Batches are drawn by using "Renderer::Command::DrawIndexedIndirectCount".
+	*
+	*    The scene culling manager isn't doing any CPU frustum culling if GPU culling is enabled, it just hands over the world space to clip space matrix
+	*    and the bounding volumes. The compute shader performs the same frustum-sphere and frustum-OOBB tests as the CPU scene culling manager, so both
+	*    paths result in the same set of visible draws.
+	*
+	*    The draw records and the indirect buffers are used round-robin, one buffer set per command buffer execution. This way the CPU never writes into
+	*    resources which might still be read by the GPU when executing multiple compositor workspaces per frame.
+	*
+	*  @note
+	*    - Requires "Renderer::Capabilities::computeShader" and "Renderer::Capabilities::drawIndirectCount", disabled by default
+	*    - The renderer backend executes the compute work before the draws since the GPU culling command buffer is submitted first
+	*    - Only frustum culling is performed, occlusion culling (e.g. hierarchical-Z using the depth buffer of the previous frame) is out of scope
+	*/
+	class GpuCullingManager final : private Manager
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const uint32_t MAXIMUM_NUMBER_OF_DRAWS = 16 * 1024;	///< Maximum number of draws per command buffer execution, also the maximum number of batches since each batch contains at least one draw
+		static const uint32_t NUMBER_OF_BUFFER_SETS	  = 4;			///< Number of buffer sets which are used round-robin, one buffer set per command buffer execution
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] rendererRuntime
+		*    Renderer runtime instance to use, must stay valid as long as the GPU culling manager instance exists
+		*/
+		explicit GpuCullingManager(const IRendererRuntime& rendererRuntime);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~GpuCullingManager();
+
+		/**
+		*  @brief
+		*    Return whether or not GPU culling is supported by the used renderer
+		*
+		*  @return
+		*    "true" if GPU culling is supported, else "false"
+		*/
+		inline bool isSupported() const;
+
+		/**
+		*  @brief
+		*    Return whether or not GPU culling is enabled
+		*
+		*  @return
+		*    "true" if GPU culling is enabled, else "false" (always "false" if GPU culling isn't supported)
+		*/
+		inline bool isEnabled() const;
+
+		/**
+		*  @brief
+		*    Set whether or not GPU culling is enabled
+		*
+		*  @param[in] enabled
+		*    "true" to enable GPU culling, else "false", ignored if GPU culling isn't supported
+		*/
+		inline void setEnabled(bool enabled);
+
+		/**
+		*  @brief
+		*    Set the frustum to cull against
+		*
+		*  @param[in] worldSpaceToClipSpaceMatrix
+		*    World space to clip space matrix defining the frustum to cull against, null pointer to disable frustum culling (all draws are considered to be visible)
+		*/
+		void setFrustum(const glm::mat4* worldSpaceToClipSpaceMatrix);
+
+		/**
+		*  @brief
+		*    Return whether or not there's enough space left for the given number of draws
+		*
+		*  @param[in] numberOfDraws
+		*    Number of draws which are going to be added
+		*
+		*  @return
+		*    "true" if there's enough space left, else "false" (use the CPU path in this case)
+		*/
+		inline bool hasCapacity(uint32_t numberOfDraws) const;
+
+		/**
+		*  @brief
+		*    Begin a new batch, the following draws are added to this batch
+		*
+		*  @param[out] batchIndex
+		*    Receives the batch index, the number of visible draws of the batch is at "batchIndex * sizeof(uint32_t)" inside the count indirect buffer
+		*  @param[out] firstDrawIndex
+		*    Receives the index of the first draw of the batch, the draw arguments of the batch start at "firstDrawIndex * sizeof(Renderer::DrawIndexedInstancedArguments)" inside the draw indirect buffer
+		*/
+		void beginBatch(uint32_t& batchIndex, uint32_t& firstDrawIndex);
+
+		/**
+		*  @brief
+		*    Add a draw to the current batch
+		*
+		*  @param[in] drawIndexedInstancedArguments
+		*    Draw arguments to use if the draw is visible
+		*  @param[in] worldSpaceBoundingSphere
+		*    World space bounding sphere center position (xyz) and radius (w), a negative radius means the draw can't be culled
+		*  @param[in] worldSpaceOrientedBoundingBox
+		*    World space object-oriented bounding box center position (xyz) followed by the three half axes (xyz each), only used if the draw can be culled
+		*/
+		void addDraw(const Renderer::DrawIndexedInstancedArguments& drawIndexedInstancedArguments, const float worldSpaceBoundingSphere[4], const float worldSpaceOrientedBoundingBox[12]);
+
+		/**
+		*  @brief
+		*    Return the draw indirect buffer which receives the compacted draw arguments
+		*
+		*  @return
+		*    The draw indirect buffer of the current command buffer execution, don't destroy the instance, only valid if GPU culling is supported
+		*/
+		inline Renderer::IIndirectBuffer& getDrawIndirectBuffer() const;
+
+		/**
+		*  @brief
+		*    Return the count indirect buffer which receives the number of visible draws per batch
+		*
+		*  @return
+		*    The count indirect buffer of the current command buffer execution, don't destroy the instance, only valid if GPU culling is supported
+		*/
+		inline Renderer::IIndirectBuffer& getCountIndirectBuffer() const;
+
+		/**
+		*  @brief
+		*    Called pre command buffer execution
+		*
+		*  @note
+		*    - Uploads the draws added since the last call, submits the culling compute work to the renderer and switches to the next buffer set
+		*/
+		void onPreCommandBufferExecution();
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit GpuCullingManager(const GpuCullingManager&) = delete;
+		GpuCullingManager& operator=(const GpuCullingManager&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Draw record as seen by the compute shader
+		*/
+		struct DrawRecord final
+		{
+			float	 worldSpaceBoundingSphere[4];		///< World space bounding sphere center position (xyz) and radius (w), a negative radius means the draw can't be culled
+			float	 worldSpaceOrientedBoundingBox[12];	///< World space object-oriented bounding box center position (xyz) followed by the three half axes (xyz each)
+			uint32_t drawArguments[5];					///< "Renderer::DrawIndexedInstancedArguments"
+			uint32_t batchIndex;
+			uint32_t firstDrawIndex;					///< Index of the first draw of the batch
+			uint32_t padding;
+		};
+		typedef std::vector<DrawRecord> DrawRecords;
+
+		/**
+		*  @brief
+		*    Resources used by one command buffer execution
+		*/
+		struct BufferSet final
+		{
+			Renderer::ITextureBufferPtr	 drawRecordTextureBuffer;	///< Header and draw records
+			Renderer::IIndirectBufferPtr drawIndirectBuffer;		///< Compacted draw arguments written by the compute shader
+			Renderer::IIndirectBufferPtr countIndirectBuffer;		///< Number of visible draws per batch written by the compute shader
+			Renderer::IResourceGroupPtr	 resourceGroup;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		const IRendererRuntime&				mRendererRuntime;
+		bool								mEnabled;
+		bool								mFrustumCulling;					///< Cull against the frustum?
+		float								mFrustumPlanes[6][4];				///< World space frustum planes, normal (xyz) pointing into the frustum and distance (w)
+		float								mWorldSpaceToClipSpaceMatrix[16];	///< World space to clip space matrix defining the frustum, column-major
+		uint32_t							mMaximumNumberOfDraws;
+		Renderer::IRootSignaturePtr			mRootSignature;
+		Renderer::IComputePipelineStatePtr	mComputePipelineState;
+		BufferSet							mBufferSets[NUMBER_OF_BUFFER_SETS];
+		uint32_t							mCurrentBufferSetIndex;				///< Index of the buffer set used by the current command buffer execution
+		Renderer::CommandBuffer				mCommandBuffer;
+		DrawRecords							mDrawRecords;						///< Draw records added since the last command buffer execution
+		uint32_t							mNumberOfBatches;
+		uint32_t							mCurrentBatchIndex;
+		uint32_t							mCurrentFirstDrawIndex;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/GpuCullingManager.inl"
@@ -0,0 +1,69 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	inline bool GpuCullingManager::isSupported() const
+	{
+		return (nullptr != mComputePipelineState);
+	}
+
+	inline bool GpuCullingManager::isEnabled() const
+	{
+		return mEnabled;
+	}
+
+	inline void GpuCullingManager::setEnabled(bool enabled)
+	{
+		mEnabled = (enabled && isSupported());
+	}
+
+	inline bool GpuCullingManager::hasCapacity(uint32_t numberOfDraws) const
+	{
+		return (static_cast<uint32_t>(mDrawRecords.size()) + numberOfDraws <= mMaximumNumberOfDraws);
+	}
+
+	inline Renderer::IIndirectBuffer& GpuCullingManager::getDrawIndirectBuffer() const
+	{
+		// Sanity check
+		assert(nullptr != mBufferSets[mCurrentBufferSetIndex].drawIndirectBuffer);
+		return *mBufferSets[mCurrentBufferSetIndex].drawIndirectBuffer;
+	}
+
+	inline Renderer::IIndirectBuffer& GpuCullingManager::getCountIndirectBuffer() const
+	{
+		// Sanity check
+		assert(nullptr != mBufferSets[mCurrentBufferSetIndex].countIndirectBuffer);
+		return *mBufferSets[mCurrentBufferSetIndex].countIndirectBuffer;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
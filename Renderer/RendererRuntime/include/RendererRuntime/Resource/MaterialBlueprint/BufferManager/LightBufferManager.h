@@ -54,13 +54,14 @@ PRAGMA_WARNING_POP
 namespace Renderer
 {
 	class CommandBuffer;
+	class IRenderTarget;
 	class ITextureBuffer;
 	class IResourceGroup;
 }
 namespace RendererRuntime
 {
-	class SceneResource;
 	class IRendererRuntime;
+	class CompositorContextData;
 	class MaterialBlueprintResource;
 }
 
@@ -86,6 +87,19 @@ namespace RendererRuntime
 	/**
 	*  @brief
 	*    Light buffer manager
+	*
+	*  @remarks
+	*    Clustered shading using view frustum aligned clusters with exponential depth slicing. Each cluster references a list of light indices,
+	*    the light index lists of all clusters are stored in one flat index list. The light-to-cluster binning is done on the CPU using SIMD
+	*    and the default thread pool, each worker thread owns a range of depth slices so no synchronization is required.
+	*
+	*    The light texture buffer has the following layout:
+	*    - Light data: Four float4 texels per light, see "RendererRuntime::LightSceneItem::PackedShaderData"
+	*    - Flat light index list: Light indices stored as floats, four indices per texel
+	*
+	*    The clusters 3D texture ("R32_UINT") contains per cluster the offset of the first light index inside the light texture buffer counted in
+	*    scalars (upper 24 bits) and the number of light indices (lower 8 bits, so a cluster can reference up to 255 lights). Lights exceeding
+	*    this limit are dropped and reported via the log. Debug builds cross-check the binning against a brute-force reference every frame.
 	*/
 	class LightBufferManager final : private Manager
 	{
@@ -132,12 +146,14 @@ namespace RendererRuntime
 		*  @brief
 		*    Fill the light buffer
 		*
-		*  @param[in] sceneResource
-		*    Scene resource to use
+		*  @param[in] renderTarget
+		*    Render target to render into, used to derive the light clusters view frustum
+		*  @param[in] compositorContextData
+		*    Compositor context data to use, must provide a camera scene item
 		*  @param[out] commandBuffer
 		*    Command buffer to fill
 		*/
-		void fillBuffer(SceneResource& sceneResource, Renderer::CommandBuffer& commandBuffer);
+		void fillBuffer(const Renderer::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Renderer::CommandBuffer& commandBuffer);
 
 		/**
 		*  @brief
@@ -155,18 +171,18 @@ namespace RendererRuntime
 		*    Get light clusters scale
 		*
 		*  @return
-		*    Light clusters scale
+		*    Light clusters scale, applied to "float3(viewSpacePosition.xy / viewSpacePosition.z, log2(viewSpacePosition.z))" to get the cluster coordinate
 		*/
-		glm::vec3 getLightClustersScale() const;
+		inline const glm::vec3& getLightClustersScale() const;
 
 		/**
 		*  @brief
 		*    Get light clusters bias
 		*
 		*  @return
-		*    Light clusters bias
+		*    Light clusters bias, see "RendererRuntime::LightBufferManager::getLightClustersScale()"
 		*/
-		glm::vec3 getLightClustersBias() const;
+		inline const glm::vec3& getLightClustersBias() const;
 
 
 	//[-------------------------------------------------------]
@@ -175,28 +191,60 @@ namespace RendererRuntime
 	private:
 		explicit LightBufferManager(const LightBufferManager&) = delete;
 		LightBufferManager& operator=(const LightBufferManager&) = delete;
-		void fillTextureBuffer(SceneResource& sceneResource);
-		void fillClusters3DTexture(SceneResource& sceneResource, Renderer::CommandBuffer& commandBuffer);
+		void setLightClustersViewFrustum(const glm::mat4& viewSpaceToClipSpaceMatrix, float nearZ, float farZ);
+		void gatherLights(const CompositorContextData& compositorContextData);
+		void binLightsIntoClusters();
+		void binLightsIntoClusterSlices(uint32_t sliceIndexStart, uint32_t sliceIndexEnd);
+		#ifdef _DEBUG
+			void validateLightClusters() const;
+		#endif
+		void fillTextureBuffer();
+		void fillClusters3DTexture();
 
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
-		typedef std::vector<uint8_t> ScratchBuffer;
+		typedef std::vector<uint8_t>  ScratchBuffer;
+		typedef std::vector<float>	  Floats;
+		typedef std::vector<uint32_t> LightIndices;
+		typedef std::vector<LightIndices> ClusterLightIndices;
+
+		/**
+		*  @brief
+		*    Gathered light data relevant for clustering, structure of arrays, one entry per light inside the light texture buffer
+		*/
+		struct ViewSpaceLights final
+		{
+			Floats		 positionX;		///< View space light position x component
+			Floats		 positionY;		///< View space light position y component
+			Floats		 positionZ;		///< View space light position z component
+			Floats		 radius;		///< Light radius
+			LightIndices minimumSlice;	///< Index of the first depth slice touched by the light
+			LightIndices maximumSlice;	///< Index of the last depth slice touched by the light (inclusive)
+		};
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		IRendererRuntime&		  mRendererRuntime;	///< Renderer runtime instance to use
-		Renderer::ITextureBuffer* mTextureBuffer;	///< Texture buffer instance, always valid
+		IRendererRuntime&		  mRendererRuntime;				///< Renderer runtime instance to use
+		Renderer::ITextureBuffer* mTextureBuffer;				///< Texture buffer instance, always valid
 		ScratchBuffer			  mTextureScratchBuffer;
+		uint32_t				  mNumberOfLights;				///< Number of lights inside the texture scratch buffer
+		ViewSpaceLights			  mViewSpaceLights;				///< View space lights of the current frame
+		ClusterLightIndices		  mClusterLightIndices;			///< Light indices per cluster, the capacity is kept between frames to avoid memory allocations
+		LightIndices			  mClusters3DTextureData;		///< Packed light index list offset and count per cluster
 		TextureResourceId		  mClusters3DTextureResourceId;
-		glm::vec3				  mLightClustersAabbMinimum;
-		glm::vec3				  mLightClustersAabbMaximum;
-		Renderer::IResourceGroup* mResourceGroup;	///< Resource group instance, always valid
+		float					  mLightClustersNearZ;			///< View space depth of the first depth slice
+		float					  mLightClustersFarZ;			///< View space depth of the end of the last depth slice
+		glm::vec2				  mLightClustersTileScale;		///< Projection scale, "viewSpaceToClipSpaceMatrix[0][0]" and "viewSpaceToClipSpaceMatrix[1][1]"
+		glm::vec3				  mLightClustersScale;
+		glm::vec3				  mLightClustersBias;
+		Renderer::IResourceGroup* mResourceGroup;				///< Resource group instance, always valid
+		bool					  mLightLimitExceeded;			///< "true" if the light limit of a cluster or of the light index list has been exceeded during the last light buffer fill, used to log the issue only once
 
 
 	};
@@ -206,3 +254,9 @@ namespace RendererRuntime
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 } // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/LightBufferManager.inl"
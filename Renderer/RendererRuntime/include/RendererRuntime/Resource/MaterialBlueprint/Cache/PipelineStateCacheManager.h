@@ -53,6 +53,7 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace RendererRuntime
 {
+	class IFile;
 	class ShaderProperties;
 	class PipelineStateCache;
 	class MaterialBlueprintResource;
@@ -179,6 +180,30 @@ namespace RendererRuntime
 		explicit PipelineStateCacheManager(const PipelineStateCacheManager&) = delete;
 		PipelineStateCacheManager& operator=(const PipelineStateCacheManager&) = delete;
 
+		//[-------------------------------------------------------]
+		//[ Pipeline state object cache                           ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Load the pipeline state signatures of the material blueprint resource and create the pipeline state caches for them
+		*
+		*  @param[in] file
+		*    File to read from
+		*  @param[in] numberOfBytes
+		*    Number of bytes the material blueprint cache entry consumes inside the file, the file must contain at least this number of bytes
+		*
+		*  @return
+		*    "true" if all went fine, else "false" if the material blueprint cache entry is corrupt in which case nothing was created and the file position is undefined
+		*
+		*  @note
+		*    - The pipeline state caches are created using the pipeline state compiler, the caller might want to flush the pipeline state compiler queues afterwards
+		*    - Out-of-date pipeline state signatures are ignored, this is detected by using the asset file hashes of the assets which took part in the pipeline state creation
+		*/
+		bool loadPipelineStateObjectCache(IFile& file, uint32_t numberOfBytes);
+		inline bool doesPipelineStateObjectCacheNeedSaving() const;
+		void savePipelineStateObjectCache(IFile& file);
+		uint64_t calculateCombinedAssetFileHashes() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
@@ -195,6 +220,7 @@ namespace RendererRuntime
 		ProgramCacheManager							 mProgramCacheManager;
 		PipelineStateCacheByPipelineStateSignatureId mPipelineStateCacheByPipelineStateSignatureId;
 		PipelineStateSignature						 mTemporaryPipelineStateSignature;	///< Temporary pipeline state signature to reduce the number of memory allocations/deallocations
+		bool										 mPipelineStateObjectCacheNeedsSaving;	///< "true" if a pipeline state cache was added since the pipeline state object cache was loaded or saved the last time
 
 
 	};
@@ -50,7 +50,8 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	inline PipelineStateCacheManager::PipelineStateCacheManager(MaterialBlueprintResource& materialBlueprintResource) :
 		mMaterialBlueprintResource(materialBlueprintResource),
-		mProgramCacheManager(*this)
+		mProgramCacheManager(*this),
+		mPipelineStateObjectCacheNeedsSaving(false)
 	{
 		// Nothing here
 	}
@@ -60,6 +61,11 @@ namespace RendererRuntime
 		clearCache();
 	}
 
+	inline bool PipelineStateCacheManager::doesPipelineStateObjectCacheNeedSaving() const
+	{
+		return mPipelineStateObjectCacheNeedsSaving;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "RendererRuntime/Export.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderType.h"
 
 // Disable warnings in external headers, we can't fix them
@@ -45,6 +46,7 @@ PRAGMA_WARNING_PUSH
 	#include <atomic>	// For "std::atomic<>"
 	#include <deque>
 	#include <mutex>
+	#include <unordered_set>
 	#include <thread>
 	#include <condition_variable>
 PRAGMA_WARNING_POP
@@ -83,10 +85,13 @@ namespace RendererRuntime
 	*
 	*  @remarks
 	*    A pipeline state must master the following stages in order to archive the inner wisdom:
-	*    1. Asynchronous shader building
-	*    2. Asynchronous shader compilation
+	*    1. Asynchronous shader building, distributed over multiple builder threads
+	*    2. Asynchronous shader compilation, distributed over multiple compiler threads
 	*    3. Synchronous renderer backend dispatch TODO(co) Asynchronous renderer backend dispatch if supported by the renderer API
 	*
+	*    Builder threads never build one and the same shader cache concurrently: A builder thread which needs a shader cache another
+	*    builder thread is currently building puts its compiler request back into the builder queue and processes other compiler requests
+	*
 	*  @note
 	*    - Takes care of asynchronous pipeline state compilation
 	*/
@@ -101,19 +106,46 @@ namespace RendererRuntime
 		friend class PipelineStateCacheManager;	// Only the pipeline state cache manager is allowed to commit compiler requests
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Pipeline state compiler statistics, accumulated since the creation of the pipeline state compiler or the last statistics reset
+		*
+		*  @note
+		*    - The throughput of a stage is the number of processed items divided by the accumulated time of the stage, the time is summed up over all threads of the stage
+		*/
+		struct Statistics final
+		{
+			uint32_t numberOfBuiltShaders;				///< Number of shader source codes built by the builder threads
+			uint32_t numberOfReusedShaderSourceCodes;	///< Number of built shader source codes which were identical to an already existing shader source code, no compilation required
+			uint32_t numberOfDeferredBuilderRequests;	///< Number of times a builder thread had to wait because another builder thread was building a shader cache required by the compiler request
+			uint32_t numberOfCompiledShaders;			///< Number of shaders compiled by the compiler threads
+			uint32_t numberOfCompiledPipelineStates;	///< Number of pipeline state objects created by the compiler threads
+			uint64_t builderTimeInMicroseconds;			///< Accumulated time the builder threads spent building shader source codes
+			uint64_t compilerTimeInMicroseconds;		///< Accumulated time the compiler threads spent compiling shaders and creating pipeline state objects
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	public:
 		inline bool isAsynchronousCompilationEnabled() const;
-		void setAsynchronousCompilationEnabled(bool enabled);
+		RENDERERRUNTIME_API_EXPORT void setAsynchronousCompilationEnabled(bool enabled);
+		inline uint32_t getNumberOfBuilderThreads() const;
+		RENDERERRUNTIME_API_EXPORT void setNumberOfBuilderThreads(uint32_t numberOfBuilderThreads);
 		inline uint32_t getNumberOfCompilerThreads() const;
-		void setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads);
+		RENDERERRUNTIME_API_EXPORT void setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads);
 		inline uint32_t getNumberOfInFlightCompilerRequests() const;
 		inline void flushBuilderQueue();
 		inline void flushCompilerQueue();
 		inline void flushAllQueues();
 		void dispatch();
+		inline Statistics getStatistics() const;
+		inline void resetStatistics();
 
 
 	//[-------------------------------------------------------]
@@ -151,8 +183,10 @@ namespace RendererRuntime
 			CompilerRequest& operator=(const CompilerRequest&) = delete;
 		};
 
-		typedef std::vector<std::thread> CompilerThreads;
-		typedef std::deque<CompilerRequest> CompilerRequests;
+		typedef std::vector<std::thread>	  BuilderThreads;
+		typedef std::vector<std::thread>	  CompilerThreads;
+		typedef std::deque<CompilerRequest>	  CompilerRequests;
+		typedef std::unordered_set<uint32_t> ShaderCacheIds;	///< "RendererRuntime::ShaderCacheId"-set
 
 
 	//[-------------------------------------------------------]
@@ -165,7 +199,7 @@ namespace RendererRuntime
 		PipelineStateCompiler& operator=(const PipelineStateCompiler&) = delete;
 		void addAsynchronousCompilerRequest(PipelineStateCache& pipelineStateCache);
 		void instantSynchronousCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, PipelineStateCache& pipelineStateCache);
-		void flushQueue(std::mutex& mutex, const CompilerRequests& compilerRequests);
+		void flushQueue(std::mutex& mutex, const CompilerRequests& compilerRequests, const std::atomic<uint32_t>& numberOfProcessedCompilerRequests);
 		void builderThreadWorker();
 		void compilerThreadWorker();
 		Renderer::IPipelineState* createPipelineState(const RendererRuntime::MaterialBlueprintResource& materialBlueprintResource, uint32_t serializedPipelineStateHash, Renderer::IProgram& program) const;
@@ -177,6 +211,7 @@ namespace RendererRuntime
 	private:
 		IRendererRuntime&	  mRendererRuntime;	///< Renderer runtime instance, do not destroy the instance
 		bool				  mAsynchronousCompilationEnabled;
+		uint32_t			  mNumberOfBuilderThreads;
 		uint32_t			  mNumberOfCompilerThreads;
 		std::atomic<uint32_t> mNumberOfInFlightCompilerRequests;
 
@@ -185,7 +220,10 @@ namespace RendererRuntime
 		std::mutex				mBuilderMutex;
 		std::condition_variable	mBuilderConditionVariable;
 		CompilerRequests		mBuilderQueue;
-		std::thread				mBuilderThread;
+		BuilderThreads			mBuilderThreads;
+		std::atomic<uint32_t>	mNumberOfBuildingCompilerRequests;	///< Number of compiler requests currently taken out of the builder queue by builder threads
+		ShaderCacheIds			mBuildingShaderCacheIds;			///< Shader caches currently built by builder threads, protected by the shader cache manager mutex
+		std::condition_variable	mBuildingShaderCacheIdsConditionVariable;	///< Signaled when "mBuildingShaderCacheIds" shrinks, used together with the shader cache manager mutex
 
 		// Asynchronous compilation (nuts cost)
 		std::atomic<bool>		mShutdownCompilerThread;
@@ -193,11 +231,21 @@ namespace RendererRuntime
 		std::condition_variable	mCompilerConditionVariable;
 		CompilerRequests		mCompilerQueue;
 		CompilerThreads			mCompilerThreads;
+		std::atomic<uint32_t>	mNumberOfCompilingCompilerRequests;	///< Number of compiler requests currently taken out of the compiler queue by compiler threads
 
 		// Synchronous dispatch
 		std::mutex		 mDispatchMutex;
 		CompilerRequests mDispatchQueue;
 
+		// Statistics
+		std::atomic<uint32_t> mNumberOfBuiltShaders;
+		std::atomic<uint32_t> mNumberOfReusedShaderSourceCodes;
+		std::atomic<uint32_t> mNumberOfDeferredBuilderRequests;
+		std::atomic<uint32_t> mNumberOfCompiledShaders;
+		std::atomic<uint32_t> mNumberOfCompiledPipelineStates;
+		std::atomic<uint64_t> mBuilderTimeInMicroseconds;
+		std::atomic<uint64_t> mCompilerTimeInMicroseconds;
+
 
 	};
 
@@ -33,6 +33,11 @@ namespace RendererRuntime
 		return mAsynchronousCompilationEnabled;
 	}
 
+	inline uint32_t PipelineStateCompiler::getNumberOfBuilderThreads() const
+	{
+		return mNumberOfBuilderThreads;
+	}
+
 	inline uint32_t PipelineStateCompiler::getNumberOfCompilerThreads() const
 	{
 		return mNumberOfCompilerThreads;
@@ -45,12 +50,12 @@ namespace RendererRuntime
 
 	inline void PipelineStateCompiler::flushBuilderQueue()
 	{
-		flushQueue(mBuilderMutex, mBuilderQueue);
+		flushQueue(mBuilderMutex, mBuilderQueue, mNumberOfBuildingCompilerRequests);
 	}
 
 	inline void PipelineStateCompiler::flushCompilerQueue()
 	{
-		flushQueue(mCompilerMutex, mCompilerQueue);
+		flushQueue(mCompilerMutex, mCompilerQueue, mNumberOfCompilingCompilerRequests);
 	}
 
 	inline void PipelineStateCompiler::flushAllQueues()
@@ -59,6 +64,30 @@ namespace RendererRuntime
 		flushCompilerQueue();
 	}
 
+	inline PipelineStateCompiler::Statistics PipelineStateCompiler::getStatistics() const
+	{
+		Statistics statistics;
+		statistics.numberOfBuiltShaders			   = mNumberOfBuiltShaders;
+		statistics.numberOfReusedShaderSourceCodes = mNumberOfReusedShaderSourceCodes;
+		statistics.numberOfDeferredBuilderRequests = mNumberOfDeferredBuilderRequests;
+		statistics.numberOfCompiledShaders		   = mNumberOfCompiledShaders;
+		statistics.numberOfCompiledPipelineStates  = mNumberOfCompiledPipelineStates;
+		statistics.builderTimeInMicroseconds	   = mBuilderTimeInMicroseconds;
+		statistics.compilerTimeInMicroseconds	   = mCompilerTimeInMicroseconds;
+		return statistics;
+	}
+
+	inline void PipelineStateCompiler::resetStatistics()
+	{
+		mNumberOfBuiltShaders			 = 0;
+		mNumberOfReusedShaderSourceCodes = 0;
+		mNumberOfDeferredBuilderRequests = 0;
+		mNumberOfCompiledShaders		 = 0;
+		mNumberOfCompiledPipelineStates	 = 0;
+		mBuilderTimeInMicroseconds		 = 0;
+		mCompilerTimeInMicroseconds		 = 0;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -79,6 +79,56 @@ namespace RendererRuntime
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		typedef uint32_t DynamicShaderPiecesHashes[NUMBER_OF_SHADER_TYPES];	///< FNV1a hash of the dynamic shader pieces per shader type, "RendererRuntime::Math::FNV1a_INITIAL_HASH_32" if there are no dynamic shader pieces
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Generate the dynamic shader pieces hashes
+		*
+		*  @param[in] dynamicShaderPieces
+		*    Dynamic via C++ generated shader pieces to hash
+		*  @param[out] dynamicShaderPiecesHashes
+		*    Receives the dynamic shader pieces hashes
+		*
+		*  @remarks
+		*    The dynamic shader pieces hashes only depend on the dynamic shader pieces, so they can be generated once and then be reused
+		*    when generating multiple pipeline state signature IDs, e.g. while searching for a fallback pipeline state cache
+		*/
+		static void generateDynamicShaderPiecesHashes(const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES], DynamicShaderPiecesHashes& dynamicShaderPiecesHashes);
+
+		/**
+		*  @brief
+		*    Generate a pipeline state signature ID without having to set a pipeline state signature instance
+		*
+		*  @param[in] materialBlueprintResource
+		*    Material blueprint resource to use
+		*  @param[in] serializedPipelineStateHash
+		*    FNV1a hash of "Renderer::SerializedPipelineState"
+		*  @param[in] shaderProperties
+		*    Shader properties to use, you should ensure that this shader properties are already optimized by using e.g. "RendererRuntime::MaterialBlueprintResource::optimizeShaderProperties()"
+		*  @param[in] dynamicShaderPiecesHashes
+		*    Dynamic shader pieces hashes generated via "RendererRuntime::PipelineStateSignature::generateDynamicShaderPiecesHashes()"
+		*  @param[out] shaderCombinationIds
+		*    If not a null pointer, receives the shader combination ID per shader type
+		*
+		*  @return
+		*    The pipeline state signature ID, identical to the one a pipeline state signature set with the same data would return
+		*
+		*  @note
+		*    - Doesn't copy any data and hence doesn't allocate memory, use this for lookups
+		*/
+		static PipelineStateSignatureId generatePipelineStateSignatureId(const MaterialBlueprintResource& materialBlueprintResource, uint32_t serializedPipelineStateHash, const ShaderProperties& shaderProperties, const DynamicShaderPiecesHashes& dynamicShaderPiecesHashes, ShaderCombinationId shaderCombinationIds[NUMBER_OF_SHADER_TYPES] = nullptr);
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
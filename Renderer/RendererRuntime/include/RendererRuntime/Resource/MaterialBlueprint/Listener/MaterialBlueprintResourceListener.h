@@ -139,7 +139,7 @@ namespace RendererRuntime
 		RENDERERRUNTIME_API_EXPORT virtual bool fillPassValue(uint32_t referenceValue, uint8_t* buffer, uint32_t numberOfBytes) override;
 		inline virtual void beginFillMaterial() override;
 		inline virtual bool fillMaterialValue(uint32_t referenceValue, uint8_t* buffer, uint32_t numberOfBytes) override;
-		inline virtual void beginFillInstance(const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, MaterialTechnique& materialTechnique) override;
+		inline virtual void beginFillInstance(const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, MaterialTechnique& materialTechnique, uint32_t instanceCustomParametersOffset) override;
 		RENDERERRUNTIME_API_EXPORT virtual bool fillInstanceValue(uint32_t referenceValue, uint8_t* buffer, uint32_t numberOfBytes, uint32_t instanceTextureBufferStartIndex) override;
 
 
@@ -174,6 +174,7 @@ namespace RendererRuntime
 		// Instance
 		const Transform*   mObjectSpaceToWorldSpaceTransform;
 		MaterialTechnique* mMaterialTechnique;
+		uint32_t		   mInstanceCustomParametersOffset;	///< Instance custom parameters offset relative to the instance texture buffer start index, zero if there are no instance custom parameters
 
 
 	};
@@ -51,7 +51,8 @@ namespace RendererRuntime
 		mPreviousNumberOfRenderedFrames(getUninitialized<uint64_t>()),
 		mHosekWilkieSky(nullptr),
 		mObjectSpaceToWorldSpaceTransform(nullptr),
-		mMaterialTechnique(nullptr)
+		mMaterialTechnique(nullptr),
+		mInstanceCustomParametersOffset(0)
 	{
 		// Nothing here
 	}
@@ -101,7 +102,7 @@ namespace RendererRuntime
 		return false;
 	}
 
-	inline void MaterialBlueprintResourceListener::beginFillInstance(const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, MaterialTechnique& materialTechnique)
+	inline void MaterialBlueprintResourceListener::beginFillInstance(const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, MaterialTechnique& materialTechnique, uint32_t instanceCustomParametersOffset)
 	{
 		// Remember the pass data memory address of the current scope
 		// TODO(co) Rethink the evil const-cast on here
@@ -110,6 +111,7 @@ namespace RendererRuntime
 		// Remember the instance data of the current scope
 		mObjectSpaceToWorldSpaceTransform = &objectSpaceToWorldSpaceTransform;
 		mMaterialTechnique				  = &materialTechnique;
+		mInstanceCustomParametersOffset	  = instanceCustomParametersOffset;
 	}
 
 
@@ -58,7 +58,7 @@ namespace RendererRuntime
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static const uint32_t FORMAT_TYPE	 = StringId("MaterialBlueprint");
-		static const uint32_t FORMAT_VERSION = 9;
+		static const uint32_t FORMAT_VERSION = 10;
 
 		#pragma pack(push)
 		#pragma pack(1)
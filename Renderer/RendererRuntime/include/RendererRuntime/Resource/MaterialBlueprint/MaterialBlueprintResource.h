@@ -461,7 +461,7 @@ namespace RendererRuntime
 		//[ Pipeline state object cache                           ]
 		//[-------------------------------------------------------]
 		void clearPipelineStateObjectCache();
-		void loadPipelineStateObjectCache(IFile& file);
+		bool loadPipelineStateObjectCache(IFile& file, uint32_t numberOfBytes);
 		bool doesPipelineStateObjectCacheNeedSaving() const;
 		void savePipelineStateObjectCache(IFile& file);
 
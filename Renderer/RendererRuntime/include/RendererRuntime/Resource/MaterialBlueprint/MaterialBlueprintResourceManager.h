@@ -48,12 +48,12 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace RendererRuntime
 {
-	class IFile;
 	class MemoryFile;
 	class IRendererRuntime;
 	class LightBufferManager;
 	class InstanceBufferManager;
 	class IndirectBufferManager;
+	class GpuCullingManager;
 	class MaterialBlueprintResource;
 	class MaterialBlueprintResourceLoader;
 	class IMaterialBlueprintResourceListener;
@@ -87,7 +87,8 @@ namespace RendererRuntime
 		friend class RendererRuntimeImpl;
 		friend class IResource;				// Needed so that inside this classes an static_cast<CompositorNodeResourceManager*>(IResourceManager*) works
 		friend class MaterialTechnique;		// Needs to be able to call "RendererRuntime::MaterialBlueprintResourceManager::addSerializedPipelineState()"
-		friend class PipelineStateCompiler;	// Needs to be able to call "RendererRuntime::MaterialBlueprintResourceManager::applySerializedPipelineState()"
+		friend class PipelineStateCompiler;		// Needs to be able to call "RendererRuntime::MaterialBlueprintResourceManager::applySerializedPipelineState()"
+		friend class PipelineStateCacheManager;	// Needs to be able to call "RendererRuntime::MaterialBlueprintResourceManager::addSerializedPipelineState()" and "RendererRuntime::MaterialBlueprintResourceManager::getSerializedPipelineState()"
 
 
 	//[-------------------------------------------------------]
@@ -142,6 +143,7 @@ namespace RendererRuntime
 		//[-------------------------------------------------------]
 		inline InstanceBufferManager& getInstanceBufferManager() const;
 		inline IndirectBufferManager& getIndirectBufferManager() const;
+		inline GpuCullingManager& getGpuCullingManager() const;
 		inline LightBufferManager& getLightBufferManager() const;
 
 
@@ -178,8 +180,9 @@ namespace RendererRuntime
 		//[-------------------------------------------------------]
 		void addSerializedPipelineState(uint32_t serializedPipelineStateHash, const Renderer::SerializedPipelineState& serializedPipelineState);
 		void applySerializedPipelineState(uint32_t serializedPipelineStateHash, Renderer::PipelineState& pipelineState);
+		bool getSerializedPipelineState(uint32_t serializedPipelineStateHash, Renderer::SerializedPipelineState& serializedPipelineState);
 		void clearPipelineStateObjectCache();
-		void loadPipelineStateObjectCache(IFile& file);
+		bool loadPipelineStateObjectCache(MemoryFile& memoryFile);
 		bool doesPipelineStateObjectCacheNeedSaving() const;
 		void savePipelineStateObjectCache(MemoryFile& memoryFile);
 
@@ -198,6 +201,7 @@ namespace RendererRuntime
 		SerializedPipelineStates			mSerializedPipelineStates;			///< Serialized pipeline states
 		InstanceBufferManager*				mInstanceBufferManager;				///< Instance buffer manager, always valid in a sane none-legacy environment
 		IndirectBufferManager*				mIndirectBufferManager;				///< Indirect buffer manager, always valid in a sane none-legacy environment
+		GpuCullingManager*					mGpuCullingManager;					///< GPU culling manager, always valid in a sane none-legacy environment (but GPU culling itself might not be supported)
 		LightBufferManager*					mLightBufferManager;				///< Light buffer manager, always valid in a sane none-legacy environment
 
 		// Internal resource manager implementation
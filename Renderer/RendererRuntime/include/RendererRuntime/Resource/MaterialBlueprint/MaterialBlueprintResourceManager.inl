@@ -84,6 +84,13 @@ namespace RendererRuntime
 		return *mIndirectBufferManager;
 	}
 
+	inline GpuCullingManager& MaterialBlueprintResourceManager::getGpuCullingManager() const
+	{
+		// We know this pointer must always be valid
+		assert(nullptr != mGpuCullingManager);
+		return *mGpuCullingManager;
+	}
+
 	inline LightBufferManager& MaterialBlueprintResourceManager::getLightBufferManager() const
 	{
 		// We know this pointer must always be valid
@@ -56,7 +56,9 @@ namespace RendererRuntime
 	// - Mesh header
 	// - Vertex and index buffer data
 	// - Vertex array attribute definitions
-	// - Sub-meshes
+	// - Sub-meshes, LOD-major: The sub-meshes of LOD 0 are followed by the sub-meshes of LOD 1 and so on, all LODs share one and the same vertex buffer
+	// - Per LOD minimum projected screen size as "float"
+	// - Optional skeleton
 	namespace v1Mesh
 	{
 
@@ -65,7 +67,7 @@ namespace RendererRuntime
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static const uint32_t FORMAT_TYPE	 = StringId("Mesh");
-		static const uint32_t FORMAT_VERSION = 7;
+		static const uint32_t FORMAT_VERSION = 9;
 
 		#pragma pack(push)
 		#pragma pack(1)
@@ -82,8 +84,16 @@ namespace RendererRuntime
 				uint8_t  indexBufferFormat;
 				uint32_t numberOfIndices;
 				uint8_t  numberOfVertexAttributes;
+				// Optional vertex quantization, dequantized value = quantized value * scale + bias
+				bool	  quantizedVertices;	///< If "true", the 16 bit position and texture coordinate have to be dequantized, see "RendererRuntime::MeshResource::QUANTIZED_VERTEX_ATTRIBUTES"
+				glm::vec3 positionDequantizationScale;
+				glm::vec3 positionDequantizationBias;
+				glm::vec2 textureCoordinateDequantizationScale;
+				glm::vec2 textureCoordinateDequantizationBias;
 				// Sub-meshes
-				uint16_t numberOfSubMeshes;
+				uint16_t numberOfSubMeshes;	///< Number of sub-meshes per LOD
+				// Level of detail (LOD)
+				uint8_t  numberOfLods;		///< Number of LODs, at least one
 				// Optional skeleton
 				uint8_t  numberOfBones;
 			};
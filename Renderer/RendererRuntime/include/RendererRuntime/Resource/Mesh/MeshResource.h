@@ -97,6 +97,11 @@ namespace RendererRuntime
 	public:
 		RENDERERRUNTIME_API_EXPORT static const Renderer::VertexAttributes VERTEX_ATTRIBUTES;			///< Default vertex attributes layout, whenever possible stick to this to be as compatible as possible to the rest
 		RENDERERRUNTIME_API_EXPORT static const Renderer::VertexAttributes SKINNED_VERTEX_ATTRIBUTES;	///< Default skinned vertex attributes layout, whenever possible stick to this to be as compatible as possible to the rest
+		RENDERERRUNTIME_API_EXPORT static const Renderer::VertexAttributes QUANTIZED_VERTEX_ATTRIBUTES;			///< Quantized vertex attributes layout (16 bit position and texture coordinate), see "RendererRuntime::MeshResource::getVertexDequantization()"
+		RENDERERRUNTIME_API_EXPORT static const Renderer::VertexAttributes QUANTIZED_SKINNED_VERTEX_ATTRIBUTES;	///< Quantized skinned vertex attributes layout (16 bit position and texture coordinate), see "RendererRuntime::MeshResource::getVertexDequantization()"
+		static const uint32_t NUMBER_OF_VERTEX_DEQUANTIZATION_FLOATS = 12;	///< xyz position scale, xyz position bias, xy texture coordinate scale, xy texture coordinate bias; each group padded to "float4"
+		typedef std::vector<float> LodMinimumScreenSizes;	///< Per LOD minimum projected screen size (bounding sphere diameter in relation to the render target height)
+		typedef std::vector<float> VertexDequantization;	///< Empty if the vertices aren't quantized, else "RendererRuntime::MeshResource::NUMBER_OF_VERTEX_DEQUANTIZATION_FLOATS" floats
 
 
 	//[-------------------------------------------------------]
@@ -122,13 +127,23 @@ namespace RendererRuntime
 		inline void setNumberOfIndices(uint32_t numberOfIndices);
 		inline Renderer::IVertexArrayPtr getVertexArrayPtr() const;
 		inline void setVertexArray(Renderer::IVertexArray* vertexArray);
+		inline const VertexDequantization& getVertexDequantization() const;	// Vertex dequantization in the layout of the instance texture buffer custom parameters, empty if the vertices aren't quantized
+		inline VertexDequantization& getVertexDequantization();
 
 		//[-------------------------------------------------------]
 		//[ Sub-meshes                                            ]
 		//[-------------------------------------------------------]
-		inline const SubMeshes& getSubMeshes() const;
+		inline const SubMeshes& getSubMeshes() const;	// LOD-major, see "RendererRuntime::MeshResource::getNumberOfLods()"
 		inline SubMeshes& getSubMeshes();
 
+		//[-------------------------------------------------------]
+		//[ Level of detail (LOD)                                 ]
+		//[-------------------------------------------------------]
+		inline uint8_t getNumberOfLods() const;
+		inline void setNumberOfLods(uint8_t numberOfLods);
+		inline const LodMinimumScreenSizes& getLodMinimumScreenSizes() const;
+		inline LodMinimumScreenSizes& getLodMinimumScreenSizes();
+
 		//[-------------------------------------------------------]
 		//[ Optional skeleton                                     ]
 		//[-------------------------------------------------------]
@@ -165,8 +180,12 @@ namespace RendererRuntime
 		uint32_t				  mNumberOfVertices;	///< Number of vertices
 		uint32_t				  mNumberOfIndices;		///< Number of indices
 		Renderer::IVertexArrayPtr mVertexArray;			///< Vertex array object (VAO), can be a null pointer
+		VertexDequantization	  mVertexDequantization;	///< Vertex dequantization, empty if the vertices aren't quantized
 		// Sub-meshes
-		SubMeshes				  mSubMeshes;			///< Sub-meshes
+		SubMeshes				  mSubMeshes;			///< Sub-meshes, LOD-major meaning the sub-meshes of LOD 0 are followed by the sub-meshes of LOD 1 and so on
+		// Level of detail (LOD)
+		uint8_t					  mNumberOfLods;			///< Number of LODs, at least one, all LODs share one and the same vertex array
+		LodMinimumScreenSizes	  mLodMinimumScreenSizes;	///< Per LOD minimum projected screen size, empty or one entry per LOD
 		// Optional skeleton
 		SkeletonResourceId		  mSkeletonResourceId;	///< Resource ID of the used skeleton, can be uninitialized
 
@@ -96,6 +96,16 @@ namespace RendererRuntime
 		mVertexArray = vertexArray;
 	}
 
+	inline const MeshResource::VertexDequantization& MeshResource::getVertexDequantization() const
+	{
+		return mVertexDequantization;
+	}
+
+	inline MeshResource::VertexDequantization& MeshResource::getVertexDequantization()
+	{
+		return mVertexDequantization;
+	}
+
 	inline const SubMeshes& MeshResource::getSubMeshes() const
 	{
 		return mSubMeshes;
@@ -106,6 +116,27 @@ namespace RendererRuntime
 		return mSubMeshes;
 	}
 
+	inline uint8_t MeshResource::getNumberOfLods() const
+	{
+		return mNumberOfLods;
+	}
+
+	inline void MeshResource::setNumberOfLods(uint8_t numberOfLods)
+	{
+		assert(numberOfLods > 0);
+		mNumberOfLods = numberOfLods;
+	}
+
+	inline const MeshResource::LodMinimumScreenSizes& MeshResource::getLodMinimumScreenSizes() const
+	{
+		return mLodMinimumScreenSizes;
+	}
+
+	inline MeshResource::LodMinimumScreenSizes& MeshResource::getLodMinimumScreenSizes()
+	{
+		return mLodMinimumScreenSizes;
+	}
+
 	inline SkeletonResourceId MeshResource::getSkeletonResourceId() const
 	{
 		return mSkeletonResourceId;
@@ -129,6 +160,8 @@ namespace RendererRuntime
 		// Vertex and index data
 		mNumberOfVertices(0),
 		mNumberOfIndices(0),
+		// Level of detail (LOD)
+		mNumberOfLods(1),
 		// Optional skeleton
 		mSkeletonResourceId(getUninitialized<SkeletonResourceId>())
 	{
@@ -145,7 +178,10 @@ namespace RendererRuntime
 		assert(0 == mNumberOfVertices);
 		assert(0 == mNumberOfIndices);
 		assert(nullptr == mVertexArray.getPointer());
+		assert(mVertexDequantization.empty());
 		assert(mSubMeshes.empty());
+		assert(1 == mNumberOfLods);
+		assert(mLodMinimumScreenSizes.empty());
 		assert(isUninitialized(mSkeletonResourceId));
 	}
 
@@ -159,7 +195,10 @@ namespace RendererRuntime
 		assert(0 == mNumberOfVertices);
 		assert(0 == mNumberOfIndices);
 		assert(nullptr == mVertexArray.getPointer());
+		assert(mVertexDequantization.empty());
 		assert(mSubMeshes.empty());
+		assert(1 == mNumberOfLods);
+		assert(mLodMinimumScreenSizes.empty());
 		assert(isUninitialized(mSkeletonResourceId));
 
 		// Call base implementation
@@ -182,7 +221,10 @@ namespace RendererRuntime
 		mNumberOfVertices = 0;
 		mNumberOfIndices = 0;
 		mVertexArray = nullptr;
+		mVertexDequantization.clear();
 		mSubMeshes.clear();
+		mNumberOfLods = 1;
+		mLodMinimumScreenSizes.clear();
 		setUninitialized(mSkeletonResourceId);
 
 		// Call base implementation
@@ -82,7 +82,44 @@ namespace RendererRuntime
 		~SceneCullingManager();
 		void gatherRenderQueueIndexRangesRenderableManagers(const Renderer::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges);
 		inline SceneItemSet& getCullableSceneItemSet() const;
-		inline SceneItems& getUncullableSceneItems();
+
+		/**
+		*  @brief
+		*    Add a cullable scene item
+		*
+		*  @param[in] sceneItem
+		*    Scene item to add, must stay valid as long as it's inside the cullable scene item set
+		*
+		*  @return
+		*    Stable scene item set handle, resolve it into the current scene item index by using "RendererRuntime::SceneItemSet::indexByHandle"
+		*/
+		uint32_t addCullableSceneItem(ISceneItem& sceneItem);
+
+		/**
+		*  @brief
+		*    Remove a cullable scene item
+		*
+		*  @param[in] sceneItemSetHandle
+		*    Scene item set handle as returned by "RendererRuntime::SceneCullingManager::addCullableSceneItem()"
+		*
+		*  @note
+		*    - The removal is batched and applied during the next scene item set update, the handle must not be used anymore
+		*/
+		void removeCullableSceneItem(uint32_t sceneItemSetHandle);
+
+		void addUncullableSceneItem(ISceneItem& sceneItem);
+
+		/**
+		*  @brief
+		*    Remove an uncullable scene item
+		*
+		*  @param[in] uncullableSceneItemIndex
+		*    Index of the scene item inside the uncullable scene items, stored inside the scene item by "RendererRuntime::SceneCullingManager::addUncullableSceneItem()"
+		*
+		*  @note
+		*    - The last uncullable scene item is moved into the released slot, the order of the uncullable scene items is not stable
+		*/
+		void removeUncullableSceneItem(uint32_t uncullableSceneItemIndex);
 
 
 	//[-------------------------------------------------------]
@@ -91,6 +128,7 @@ namespace RendererRuntime
 	private:
 		explicit SceneCullingManager(const SceneCullingManager&) = delete;
 		SceneCullingManager& operator=(const SceneCullingManager&) = delete;
+		void updateCullableSceneItemSet();
 
 
 	//[-------------------------------------------------------]
@@ -35,11 +35,6 @@ namespace RendererRuntime
 		return *mCullableSceneItemSet;
 	}
 
-	inline SceneCullingManager::SceneItems& SceneCullingManager::getUncullableSceneItems()
-	{
-		return mUncullableSceneItems;
-	}
-
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
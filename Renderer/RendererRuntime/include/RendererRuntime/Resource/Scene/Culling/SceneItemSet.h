@@ -63,6 +63,11 @@ namespace RendererRuntime
 	*  @brief
 	*    Scene item set
 	*
+	*  @remarks
+	*    The structure of arrays is kept dense: When a scene item is removed, the last scene item is moved into the free slot. Scene items are
+	*    therefore referenced by stable handles which are resolved into the current scene item index by using "indexByHandle". Scene item
+	*    management is done by "RendererRuntime::SceneCullingManager", removals are batched and applied once per frame.
+	*
 	*  @note
 	*    - Basing on "The Implementation of Frustum Culling in Stingray" - http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html
 	*/
@@ -76,6 +81,7 @@ namespace RendererRuntime
 		typedef std::vector<float, xsimd::aligned_allocator<float, XSIMD_DEFAULT_ALIGNMENT>>			 FloatVector;
 		typedef std::vector<uint32_t, xsimd::aligned_allocator<uint32_t, XSIMD_DEFAULT_ALIGNMENT>>		 IntegerVector;
 		typedef std::vector<ISceneItem*, xsimd::aligned_allocator<ISceneItem*, XSIMD_DEFAULT_ALIGNMENT>> SceneItemVector;	// TODO(co) No raw pointers here (no smart pointers either, handles please)
+		typedef std::vector<uint32_t>																	 Handles;
 
 
 		//[-------------------------------------------------------]
@@ -120,10 +126,19 @@ namespace RendererRuntime
 		// Flag to indicate if an object is culled or not
 		IntegerVector visibilityFlag;
 
-		// The type and ID of an object
+		// The type and ID of an object, a null pointer for scene items which are going to be removed
 		SceneItemVector sceneItemVector;
 
+		// Handle of an object, used to update "indexByHandle" when the object is moved inside the arrays
+		IntegerVector handle;
+
+		// Handle management
+		Handles indexByHandle;		///< Current scene item index by handle, uninitialized for free handles
+		Handles freeHandles;		///< Handles which can be reused
+		Handles pendingRemovals;	///< Handles of scene items which are going to be removed during the next scene item set update
+
 		uint32_t numberOfSceneItems = 0;
+		uint32_t capacity = 0;		///< Number of scene items the arrays can hold, always a multiple of the SIMD lane count; the arrays have some additional padding for prefetching
 
 
 	};
@@ -65,9 +65,10 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
-		friend class SceneNode;		// TODO(co) Remove this
-		friend class MeshSceneItem;	// TODO(co) Remove this
-		friend class SceneResource;	// Needs to be able to destroy scene items
+		friend class SceneNode;				// TODO(co) Remove this
+		friend class MeshSceneItem;			// TODO(co) Remove this
+		friend class SceneResource;			// Needs to be able to destroy scene items
+		friend class SceneCullingManager;	// Needs to be able to update the uncullable scene item index
 
 
 	//[-------------------------------------------------------]
@@ -109,9 +110,12 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	private:
 		SceneResource& mSceneResource;
-		SceneNode*	   mParentSceneNode;	///< Parent scene node, can be a null pointer, don't destroy the instance
-		SceneItemSet*  mSceneItemSet;		///< Scene item set, always valid, don't destroy the instance
-		uint32_t	   mSceneItemSetIndex;	///< Index inside the scene item set
+		SceneNode*	   mParentSceneNode;			///< Parent scene node, can be a null pointer, don't destroy the instance
+		SceneItemSet*  mSceneItemSet;				///< Scene item set, can be a null pointer for uncullable scene items, don't destroy the instance
+		uint32_t	   mSceneItemSetHandle;			///< Handle inside the scene item set, resolve it into the current index by using "RendererRuntime::SceneItemSet::indexByHandle"
+		uint32_t	   mUncullableSceneItemIndex;	///< Index inside the uncullable scene items of the scene culling manager, uninitialized for cullable scene items
+		uint32_t	   mSceneItemIndex;				///< Index inside the scene items of the owner scene resource, used for constant time scene item destruction
+		uint32_t	   mSceneItemTypeIndex;			///< Index inside the scene item type registry of the owner scene resource, used for constant time scene item destruction
 
 
 	};
@@ -60,7 +60,9 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
+		friend class SceneNode;				// Needs to be able to update the light scene item registry
 		friend class SceneFactory;			// Needs to be able to create scene item instances
+		friend class SceneResource;			// Needs to be able to maintain the light scene item registry
 		friend class LightBufferManager;	// Needs access to "RendererRuntime::LightSceneItem::mPackedShaderData"
 
 
@@ -117,6 +119,13 @@ namespace RendererRuntime
 		LightSceneItem& operator=(const LightSceneItem&) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		inline void updateLightSceneItemRegistry();
+
+
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
@@ -149,8 +158,9 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	private:
 		PackedShaderData mPackedShaderData;
-		float			 mInnerAngle;	///< Inner angle in radians; interval in degrees: 0..90, must be smaller as the outer angle
-		float			 mOuterAngle;	///< Outer angle in radians; interval in degrees: 0..90, must be greater as the inner angle
+		float			 mInnerAngle;					///< Inner angle in radians; interval in degrees: 0..90, must be smaller as the outer angle
+		float			 mOuterAngle;					///< Outer angle in radians; interval in degrees: 0..90, must be greater as the inner angle
+		uint32_t		 mLightSceneItemRegistryIndex;	///< Index inside the light scene item registry of the owner scene resource, uninitialized if not registered
 
 
 	};
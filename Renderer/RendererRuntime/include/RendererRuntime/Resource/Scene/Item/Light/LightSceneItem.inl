@@ -21,6 +21,9 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "RendererRuntime/Resource/Scene/SceneResource.h"
+#include "RendererRuntime/Core/GetUninitialized.h"
+
 #include <cassert>
 
 
@@ -46,6 +49,9 @@ namespace RendererRuntime
 		// Sanity checks
 		assert(lightType == LightType::DIRECTIONAL || mPackedShaderData.radius > 0.0f);
 		assert(lightType != LightType::DIRECTIONAL || 0.0f == mPackedShaderData.radius);
+
+		// Update the light scene item registry
+		updateLightSceneItemRegistry();
 	}
 
 	inline void LightSceneItem::setLightTypeAndRadius(LightType lightType, float radius)
@@ -56,6 +62,9 @@ namespace RendererRuntime
 		// Sanity checks
 		assert(lightType == LightType::DIRECTIONAL || mPackedShaderData.radius > 0.0f);
 		assert(lightType != LightType::DIRECTIONAL || 0.0f == mPackedShaderData.radius);
+
+		// Update the light scene item registry
+		updateLightSceneItemRegistry();
 	}
 
 	inline const glm::vec3& LightSceneItem::getColor() const
@@ -83,6 +92,9 @@ namespace RendererRuntime
 		// Sanity checks
 		assert(mPackedShaderData.lightType == static_cast<float>(LightType::DIRECTIONAL) || mPackedShaderData.radius > 0.0f);
 		assert(mPackedShaderData.lightType != static_cast<float>(LightType::DIRECTIONAL) || 0.0f == mPackedShaderData.radius);
+
+		// Update the light scene item registry
+		updateLightSceneItemRegistry();
 	}
 
 	inline float LightSceneItem::getInnerAngle() const
@@ -164,6 +176,7 @@ namespace RendererRuntime
 	inline void LightSceneItem::setVisible(bool visible)
 	{
 		mPackedShaderData.visible = static_cast<uint32_t>(visible);
+		updateLightSceneItemRegistry();
 	}
 
 
@@ -173,7 +186,8 @@ namespace RendererRuntime
 	inline LightSceneItem::LightSceneItem(SceneResource& sceneResource) :
 		ISceneItem(sceneResource),
 		mInnerAngle(0.0f),
-		mOuterAngle(0.1f)
+		mOuterAngle(0.1f),
+		mLightSceneItemRegistryIndex(getUninitialized<uint32_t>())
 	{
 		setInnerOuterAngle(glm::radians(40.0f), glm::radians(50.0f));
 	}
@@ -184,6 +198,22 @@ namespace RendererRuntime
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	inline void LightSceneItem::updateLightSceneItemRegistry()
+	{
+		// The world space position is updated by the parent scene node
+		if (isInitialized(mLightSceneItemRegistryIndex))
+		{
+			SceneResource::LightSceneItemRegistry& registry = getSceneResource().mLightSceneItemRegistry;
+			assert(registry.lightSceneItems[mLightSceneItemRegistryIndex] == this);
+			registry.radius[mLightSceneItemRegistryIndex] = mPackedShaderData.radius;
+			registry.visible[mLightSceneItemRegistryIndex] = static_cast<uint8_t>(mPackedShaderData.visible);
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -35,12 +35,13 @@ namespace RendererRuntime
 
 	inline uint32_t MeshSceneItem::getNumberOfSubMeshes() const
 	{
-		return static_cast<uint32_t>(mRenderableManager.getRenderables().size());
+		// The renderables of all LODs are stored LOD-major and use the same materials
+		return mRenderableManager.getNumberOfRenderablesPerLod();
 	}
 
 	inline MaterialResourceId MeshSceneItem::getMaterialResourceIdOfSubMesh(uint32_t subMeshIndex) const
 	{
-		assert(subMeshIndex < mRenderableManager.getRenderables().size());
+		assert(subMeshIndex < getNumberOfSubMeshes());
 		return mRenderableManager.getRenderables()[subMeshIndex].getMaterialResourceId();
 	}
 
@@ -50,6 +50,11 @@ namespace RendererRuntime
 	// Scene file format content:
 	// - File format header
 	// - Scene header
+	// - Scene nodes header
+	// - Transforms of all scene nodes as contiguous array, the instance scene nodes are stored behind the regular scene nodes in instance group order
+	// - Number of scene items of each regular scene node as contiguous array
+	// - Scene items of all regular scene nodes
+	// - Instance groups: Instance group header followed by the scene item data shared by all instances of the group
 	namespace v1Scene
 	{
 
@@ -58,7 +63,7 @@ namespace RendererRuntime
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static const uint32_t FORMAT_TYPE	 = StringId("Scene");
-		static const uint32_t FORMAT_VERSION = 3;
+		static const uint32_t FORMAT_VERSION = 4;
 
 		#pragma pack(push)
 		#pragma pack(1)
@@ -69,19 +74,22 @@ namespace RendererRuntime
 
 			struct Nodes final
 			{
-				uint32_t numberOfNodes;
+				uint32_t numberOfNodes;				///< Number of regular scene nodes with individual scene items
+				uint32_t numberOfInstanceNodes;		///< Number of instance scene nodes, each one owns a single scene item of its instance group
+				uint32_t numberOfInstanceGroups;
 			};
 
-			struct Node final
+			struct ItemHeader final
 			{
-				Transform transform;
-				uint32_t  numberOfItems;
+				SceneItemTypeId typeId;
+				uint32_t		numberOfBytes;
 			};
 
-			struct ItemHeader final
+			struct InstanceGroup final
 			{
 				SceneItemTypeId typeId;
-				uint32_t		numberOfBytes;
+				uint32_t		numberOfBytes;		///< Number of bytes of the scene item data shared by all instances
+				uint32_t		numberOfInstances;
 			};
 
 			struct CameraItem final
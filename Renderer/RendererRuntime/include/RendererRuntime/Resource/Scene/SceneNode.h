@@ -45,6 +45,7 @@ PRAGMA_WARNING_POP
 namespace RendererRuntime
 {
 	class ISceneItem;
+	class SceneResource;
 }
 
 
@@ -93,6 +94,8 @@ namespace RendererRuntime
 		//[-------------------------------------------------------]
 		//[ Derived global transform                              ]
 		//[-------------------------------------------------------]
+		// -> The global transforms are derived in a batch once per frame by "RendererRuntime::SceneResource::updateGlobalTransforms()"
+		// -> Reading the global transform of a scene node with pending local transform changes of the scene node or its parent scene nodes derives it on demand (not thread-safe)
 		inline const Transform& getGlobalTransform() const;
 		inline const Transform& getPreviousGlobalTransform() const;
 
@@ -108,6 +111,7 @@ namespace RendererRuntime
 		//[ Attached scene items                                  ]
 		//[-------------------------------------------------------]
 		RENDERERRUNTIME_API_EXPORT void attachSceneItem(ISceneItem& sceneItem);
+		RENDERERRUNTIME_API_EXPORT void detachSceneItem(ISceneItem& sceneItem);
 		RENDERERRUNTIME_API_EXPORT void detachAllSceneItems();
 		inline const AttachedSceneItems& getAttachedSceneItems() const;
 		RENDERERRUNTIME_API_EXPORT void setSceneItemsVisible(bool visible);
@@ -117,7 +121,7 @@ namespace RendererRuntime
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
 	protected:
-		inline explicit SceneNode(const Transform& transform);
+		inline SceneNode(SceneResource& sceneResource, const Transform& transform);
 		inline ~SceneNode();
 		explicit SceneNode(const SceneNode&) = delete;
 		SceneNode& operator=(const SceneNode&) = delete;
@@ -127,7 +131,9 @@ namespace RendererRuntime
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	private:
-		RENDERERRUNTIME_API_EXPORT void updateGlobalTransformRecursive();
+		inline void setTransformDirty();
+		bool updateGlobalTransformOnDemand() const;
+		void updateGlobalTransform();
 		void updateSceneItemTransform(ISceneItem& sceneItem);
 
 
@@ -135,10 +141,13 @@ namespace RendererRuntime
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
+		SceneResource&	   mSceneResource;				///< Owner scene resource
 		SceneNode*		   mParentSceneNode;			///< Parent scene node the scene node is attached to, can be a null pointer, don't destroy the instance
+		uint32_t		   mSceneNodeIndex;				///< Index inside the depth sorted scene node hierarchy of the owner scene resource
+		uint32_t		   mUnsortedSceneNodeIndex;		///< Index inside the unsorted scene nodes of the owner scene resource, used for constant time scene node destruction
 		Transform		   mTransform;					///< Local transform
-		Transform		   mGlobalTransform;			///< Derived global transform - TODO(co) Will of course later on be handled in another way to be cache efficient and more efficient to calculate and incrementally update. But lets start simple.
-		Transform		   mPreviousGlobalTransform;	///< Previous derived global transform
+		mutable Transform  mGlobalTransform;			///< Derived global transform, updated in a batch by "RendererRuntime::SceneResource::updateGlobalTransforms()" or on demand; the address is stable since renderable managers are referencing it
+		mutable Transform  mPreviousGlobalTransform;	///< Previous derived global transform
 		AttachedSceneNodes mAttachedSceneNodes;
 		AttachedSceneItems mAttachedSceneItems;
 
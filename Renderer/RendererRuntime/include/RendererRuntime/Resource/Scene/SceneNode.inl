@@ -18,6 +18,15 @@
 \*********************************************************/
 
 
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Resource/Scene/SceneResource.h"
+#include "RendererRuntime/Core/GetUninitialized.h"
+
+#include <cassert>
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -36,36 +45,41 @@ namespace RendererRuntime
 	inline void SceneNode::setTransform(const Transform& transform)
 	{
 		mTransform = transform;
-		updateGlobalTransformRecursive();
+		setTransformDirty();
 	}
 
 	inline void SceneNode::setPosition(const glm::vec3& position)
 	{
 		mTransform.position = position;
-		updateGlobalTransformRecursive();
+		setTransformDirty();
 	}
 
 	inline void SceneNode::setRotation(const glm::quat& rotation)
 	{
 		mTransform.rotation = rotation;
-		updateGlobalTransformRecursive();
+		setTransformDirty();
 	}
 
 	inline void SceneNode::setPositionRotation(const glm::vec3& position, const glm::quat& rotation)
 	{
 		mTransform.position = position;
 		mTransform.rotation = rotation;
-		updateGlobalTransformRecursive();
+		setTransformDirty();
 	}
 
 	inline void SceneNode::setScale(const glm::vec3& scale)
 	{
 		mTransform.scale = scale;
-		updateGlobalTransformRecursive();
+		setTransformDirty();
 	}
 
 	inline const Transform& SceneNode::getGlobalTransform() const
 	{
+		// Derive the global transform on demand if there are local transform changes which haven't been applied by "RendererRuntime::SceneResource::updateGlobalTransforms()", yet
+		if (mSceneResource.mSceneNodeTransformDirty)
+		{
+			updateGlobalTransformOnDemand();
+		}
 		return mGlobalTransform;
 	}
 
@@ -88,8 +102,11 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
-	inline SceneNode::SceneNode(const Transform& transform) :
+	inline SceneNode::SceneNode(SceneResource& sceneResource, const Transform& transform) :
+		mSceneResource(sceneResource),
 		mParentSceneNode(nullptr),
+		mSceneNodeIndex(getUninitialized<uint32_t>()),
+		mUnsortedSceneNodeIndex(getUninitialized<uint32_t>()),
 		mTransform(transform),
 		mGlobalTransform(transform),
 		mPreviousGlobalTransform(transform)
@@ -104,6 +121,21 @@ namespace RendererRuntime
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	inline void SceneNode::setTransformDirty()
+	{
+		assert(mSceneNodeIndex < mSceneResource.mSceneNodeDirtyFlags.size());
+		uint8_t& dirtyFlag = mSceneResource.mSceneNodeDirtyFlags[mSceneNodeIndex];
+		if (SceneResource::CLEAN == dirtyFlag)
+		{
+			dirtyFlag = SceneResource::TRANSFORM_DIRTY;
+		}
+		mSceneResource.mSceneNodeTransformDirty = true;
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -36,6 +36,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
 	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
 	#include <vector>
+	#include <unordered_map>
 PRAGMA_WARNING_POP
 
 
@@ -48,6 +49,7 @@ namespace RendererRuntime
 	class SceneNode;
 	class ISceneItem;
 	class ISceneFactory;
+	class LightSceneItem;
 	class IRendererRuntime;
 	class SceneCullingManager;
 	class SceneResourceLoader;
@@ -80,6 +82,8 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
+		friend class SceneNode;																		// Needs to be able to update the light scene item registry
+		friend class LightSceneItem;																// Needs to be able to update the light scene item registry
 		friend class SceneResourceManager;															// Needs to be able to update the scene factory instance
 		friend PackedElementManager<SceneResource, SceneResourceId, 16>;							// Type definition of template class
 		friend ResourceManagerTemplate<SceneResource, SceneResourceLoader, SceneResourceId, 16>;	// Type definition of template class
@@ -91,6 +95,29 @@ namespace RendererRuntime
 	public:
 		typedef std::vector<SceneNode*> SceneNodes;
 		typedef std::vector<ISceneItem*> SceneItems;
+		typedef std::unordered_map<uint32_t, SceneItems> SceneItemsByTypeId;	///< Key = "RendererRuntime::SceneItemTypeId"
+
+		/**
+		*  @brief
+		*    Dense structure of arrays (SoA) registry of all light scene items of the scene resource
+		*
+		*  @remarks
+		*    Maintained on scene item creation and destruction, scene node transform change as well as light property and visibility
+		*    change. Light gathering is a linear scan over this packed data instead of a walk through all scene nodes and scene items.
+		*/
+		struct LightSceneItemRegistry final
+		{
+			typedef std::vector<float> Floats;
+			std::vector<LightSceneItem*> lightSceneItems;
+			// World space light position, derived from the parent scene node
+			Floats positionX;
+			Floats positionY;
+			Floats positionZ;
+			// Light radius, zero for directional lights
+			Floats radius;
+			// Boolean visibility
+			std::vector<uint8_t> visible;
+		};
 
 
 	//[-------------------------------------------------------]
@@ -105,18 +132,57 @@ namespace RendererRuntime
 		//[ Node                                                  ]
 		//[-------------------------------------------------------]
 		RENDERERRUNTIME_API_EXPORT SceneNode* createSceneNode(const Transform& transform);
+
+		/**
+		*  @brief
+		*    Create multiple scene nodes at once
+		*
+		*  @param[in] numberOfSceneNodes
+		*    Number of scene nodes to create, must be greater as zero
+		*  @param[in] transforms
+		*    "numberOfSceneNodes" local transforms, one per scene node
+		*
+		*  @return
+		*    The first of the "numberOfSceneNodes" created scene nodes, the scene nodes are stored as contiguous array, destroy a scene node via "RendererRuntime::SceneResource::destroySceneNode()"
+		*
+		*  @note
+		*    - The scene nodes are constructed inside a single memory pool which is released as soon as the last scene node of the pool has been destroyed
+		*/
+		RENDERERRUNTIME_API_EXPORT SceneNode* createSceneNodes(uint32_t numberOfSceneNodes, const Transform* transforms);
+
 		RENDERERRUNTIME_API_EXPORT void destroySceneNode(SceneNode& sceneNode);
 		RENDERERRUNTIME_API_EXPORT void destroyAllSceneNodes();
 		inline const SceneNodes& getSceneNodes() const;
+		RENDERERRUNTIME_API_EXPORT void updateGlobalTransforms();
 
 		//[-------------------------------------------------------]
 		//[ Item                                                  ]
 		//[-------------------------------------------------------]
 		RENDERERRUNTIME_API_EXPORT ISceneItem* createSceneItem(SceneItemTypeId sceneItemTypeId, SceneNode& sceneNode);
 		template <typename T> T* createSceneItem(SceneNode& sceneNode);
+
+		/**
+		*  @brief
+		*    Create one scene item of the same type and with the same data for each of the given scene nodes
+		*
+		*  @param[in] sceneItemTypeId
+		*    Scene item type ID
+		*  @param[in] numberOfSceneNodes
+		*    Number of scene nodes
+		*  @param[in] sceneNodes
+		*    "numberOfSceneNodes" scene nodes stored as contiguous array, e.g. the result of "RendererRuntime::SceneResource::createSceneNodes()"
+		*  @param[in] numberOfBytes
+		*    Number of bytes of the scene item data, can be zero
+		*  @param[in] data
+		*    Scene item data passed to "RendererRuntime::ISceneItem::deserialize()" of each created scene item, can be a null pointer if "numberOfBytes" is zero
+		*/
+		RENDERERRUNTIME_API_EXPORT void createSceneItems(SceneItemTypeId sceneItemTypeId, uint32_t numberOfSceneNodes, SceneNode* sceneNodes, uint32_t numberOfBytes, const uint8_t* data);
+
 		RENDERERRUNTIME_API_EXPORT void destroySceneItem(ISceneItem& sceneItem);
 		RENDERERRUNTIME_API_EXPORT void destroyAllSceneItems();
 		inline const SceneItems& getSceneItems() const;
+		RENDERERRUNTIME_API_EXPORT const SceneItems& getSceneItemsByTypeId(SceneItemTypeId sceneItemTypeId) const;
+		inline const LightSceneItemRegistry& getLightSceneItemRegistry() const;
 
 
 	//[-------------------------------------------------------]
@@ -135,15 +201,67 @@ namespace RendererRuntime
 		void initializeElement(SceneResourceId sceneResourceId);
 		void deinitializeElement();
 
+		//[-------------------------------------------------------]
+		//[ Scene node hierarchy                                  ]
+		//[-------------------------------------------------------]
+		void rebuildSceneNodeHierarchy();
+		void deleteSceneNode(SceneNode& sceneNode);
+		void updateGlobalTransformsRange(uint32_t startIndex, uint32_t endIndex);
+
+		//[-------------------------------------------------------]
+		//[ Scene item registries                                 ]
+		//[-------------------------------------------------------]
+		void addSceneNode(SceneNode& sceneNode);
+		void removeSceneNode(SceneNode& sceneNode);
+		void registerSceneItem(ISceneItem& sceneItem);
+		void unregisterSceneItem(ISceneItem& sceneItem);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::vector<uint32_t> Indices;
+		typedef std::vector<uint8_t>  Flags;
+
+		/**
+		*  @brief
+		*    Per sorted scene node dirty flag values
+		*/
+		enum SceneNodeDirtyFlag : uint8_t
+		{
+			CLEAN							   = 0,	///< The global transform is up-to-date
+			TRANSFORM_DIRTY					   = 1,	///< The local transform of the scene node or of one of its parent scene nodes has been changed
+			GLOBAL_TRANSFORM_DERIVED_ON_DEMAND = 2	///< Like "TRANSFORM_DIRTY", but the global transform has already been derived on demand and the previous global transform has already been backed up
+		};
+
+		struct SceneNodePool final
+		{
+			SceneNode* sceneNodes;					///< Raw memory of "numberOfSceneNodes" scene nodes, released via "::operator delete()"
+			uint32_t   numberOfSceneNodes;
+			uint32_t   numberOfAliveSceneNodes;		///< The pool is released as soon as this reaches zero
+		};
+		typedef std::vector<SceneNodePool> SceneNodePools;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		const ISceneFactory* mSceneFactory;			///< Scene factory instance, always valid, do not destroy the instance
-		SceneCullingManager* mSceneCullingManager;	///< Scene culling manager, always valid, destroy the instance if you no longer need it
-		SceneNodes			 mSceneNodes;
-		SceneItems			 mSceneItems;
+		const ISceneFactory*   mSceneFactory;				///< Scene factory instance, always valid, do not destroy the instance
+		SceneCullingManager*   mSceneCullingManager;		///< Scene culling manager, always valid, destroy the instance if you no longer need it
+		SceneNodes			   mSceneNodes;
+		SceneItems			   mSceneItems;
+		// Flattened scene node hierarchy, sorted by depth so parents are always in front of their children and scene nodes of the same depth are independent of each other
+		SceneNodes			   mSortedSceneNodes;
+		Indices				   mSortedParentIndices;		///< Index of the parent scene node inside "mSortedSceneNodes", uninitialized for root scene nodes
+		Indices				   mDepthOffsets;				///< Start index of each depth level inside "mSortedSceneNodes", terminated by the number of sorted scene nodes
+		Flags				   mSceneNodeDirtyFlags;		///< Per sorted scene node dirty flag, see "RendererRuntime::SceneResource::SceneNodeDirtyFlag"
+		bool				   mSceneNodeHierarchyDirty;	///< Scene nodes have been created, destroyed, attached or detached, the hierarchy needs to be sorted again
+		bool				   mSceneNodeTransformDirty;	///< At least one scene node dirty flag is set
+		SceneItemsByTypeId	   mSceneItemsByTypeId;			///< Dense per scene item type registries, the order inside a registry is not stable
+		LightSceneItemRegistry mLightSceneItemRegistry;	///< Dense light scene item registry, the order is not stable
+		SceneNodePools		   mSceneNodePools;				///< Memory pools of scene nodes created via "RendererRuntime::SceneResource::createSceneNodes()"
 
 
 	};
@@ -50,13 +50,20 @@ namespace RendererRuntime
 		return mSceneItems;
 	}
 
+	inline const SceneResource::LightSceneItemRegistry& SceneResource::getLightSceneItemRegistry() const
+	{
+		return mLightSceneItemRegistry;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	inline SceneResource::SceneResource() :
 		mSceneFactory(nullptr),
-		mSceneCullingManager(nullptr)
+		mSceneCullingManager(nullptr),
+		mSceneNodeHierarchyDirty(false),
+		mSceneNodeTransformDirty(false)
 	{
 		// Nothing here
 	}
@@ -68,6 +75,9 @@ namespace RendererRuntime
 		assert(nullptr == mSceneCullingManager);
 		assert(mSceneNodes.empty());
 		assert(mSceneItems.empty());
+		assert(mSceneItemsByTypeId.empty());
+		assert(mLightSceneItemRegistry.lightSceneItems.empty());
+		assert(mSceneNodePools.empty());
 	}
 
 	inline SceneResource& SceneResource::operator=(SceneResource&& sceneResource)
@@ -80,6 +90,15 @@ namespace RendererRuntime
 		std::swap(mSceneCullingManager, sceneResource.mSceneCullingManager);
 		std::swap(mSceneNodes, sceneResource.mSceneNodes);
 		std::swap(mSceneItems, sceneResource.mSceneItems);
+		std::swap(mSortedSceneNodes, sceneResource.mSortedSceneNodes);
+		std::swap(mSortedParentIndices, sceneResource.mSortedParentIndices);
+		std::swap(mDepthOffsets, sceneResource.mDepthOffsets);
+		std::swap(mSceneNodeDirtyFlags, sceneResource.mSceneNodeDirtyFlags);
+		std::swap(mSceneNodeHierarchyDirty, sceneResource.mSceneNodeHierarchyDirty);
+		std::swap(mSceneNodeTransformDirty, sceneResource.mSceneNodeTransformDirty);
+		std::swap(mSceneItemsByTypeId, sceneResource.mSceneItemsByTypeId);
+		std::swap(mLightSceneItemRegistry, sceneResource.mLightSceneItemRegistry);
+		std::swap(mSceneNodePools, sceneResource.mSceneNodePools);
 
 		// Done
 		return *this;
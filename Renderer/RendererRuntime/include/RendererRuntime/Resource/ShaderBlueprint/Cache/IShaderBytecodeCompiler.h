@@ -0,0 +1,148 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Resource/ShaderBlueprint/ShaderType.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class ShaderBytecode;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Abstract shader bytecode compiler interface
+	*
+	*  @remarks
+	*    Turns shader source code into the shader bytecode of a target renderer backend without the need for a renderer backend instance or a GPU. This
+	*    way e.g. the renderer toolkit can precompile the pipeline state object cache of a renderer backend offline, see
+	*    "RendererRuntime::ShaderBlueprintResourceManager::setShaderBytecodeCompiler()".
+	*
+	*  @note
+	*    - The shader bytecode must be identical to the shader bytecode the target renderer backend itself produces, else the target renderer backend will be unable to load it
+	*    - "compileShaderSourceCode()" is called by multiple pipeline state compiler threads at one and the same time, so the implementation must be thread safe
+	*/
+	class IShaderBytecodeCompiler
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererRuntime::IShaderBytecodeCompiler methods ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the name of the target renderer backend
+		*
+		*  @return
+		*    The ASCII name of the target renderer backend (for example "OpenGL" or "Vulkan"), never ever a null pointer
+		*/
+		virtual const char* getRendererName() const = 0;
+
+		/**
+		*  @brief
+		*    Return the name of the shader language of the target renderer backend
+		*
+		*  @return
+		*    The ASCII name of the shader language (for example "GLSL" or "HLSL"), never ever a null pointer
+		*/
+		virtual const char* getShaderLanguageName() const = 0;
+
+		/**
+		*  @brief
+		*    Return whether or not the target renderer backend is using a zero-to-one clip space depth range
+		*
+		*  @return
+		*    "true" if the target renderer backend is using a zero-to-one clip space depth range, else "false", see "Renderer::Capabilities::zeroToOneClipZ"
+		*/
+		virtual bool isZeroToOneClipZ() const = 0;
+
+		/**
+		*  @brief
+		*    Return whether or not the target renderer backend is using an upper left origin
+		*
+		*  @return
+		*    "true" if the target renderer backend is using an upper left origin, else "false", see "Renderer::Capabilities::upperLeftOrigin"
+		*/
+		virtual bool isUpperLeftOrigin() const = 0;
+
+		/**
+		*  @brief
+		*    Compile shader source code into shader bytecode
+		*
+		*  @param[in] shaderType
+		*    Shader type
+		*  @param[in] sourceCode
+		*    Shader ASCII source code, must be valid
+		*  @param[out] shaderBytecode
+		*    Receives the shader bytecode, left untouched on failure
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*/
+		virtual bool compileShaderSourceCode(ShaderType shaderType, const char* sourceCode, Renderer::ShaderBytecode& shaderBytecode) = 0;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		inline IShaderBytecodeCompiler();
+		inline virtual ~IShaderBytecodeCompiler();
+		explicit IShaderBytecodeCompiler(const IShaderBytecodeCompiler&) = delete;
+		IShaderBytecodeCompiler& operator=(const IShaderBytecodeCompiler&) = delete;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/IShaderBytecodeCompiler.inl"
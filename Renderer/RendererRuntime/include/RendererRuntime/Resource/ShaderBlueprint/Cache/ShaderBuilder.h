@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderProperties.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderTemplate.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -41,6 +42,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
 	#include <map>
 	#include <string>
+	#include <unordered_map>
 PRAGMA_WARNING_POP
 
 
@@ -49,6 +51,7 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace RendererRuntime
 {
+	class ShaderPieceResource;
 	class ShaderBlueprintResource;
 	class ShaderPieceResourceManager;
 }
@@ -95,6 +98,25 @@ namespace RendererRuntime
 		};
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Compile shader blueprint or shader piece source code into a shader template
+		*
+		*  @param[in] sourceCode
+		*    Shader blueprint or shader piece ASCII source code to compile
+		*  @param[out] shaderTemplate
+		*    Receives the shader template, invalid if the source code uses shader builder syntax which must be processed by the multi-pass shader builder
+		*
+		*  @note
+		*    - Meant to be called once when loading a shader blueprint or shader piece resource
+		*/
+		static void compileShaderTemplate(const std::string& sourceCode, ShaderTemplate& shaderTemplate);
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -127,6 +149,19 @@ namespace RendererRuntime
 		void createSourceCode(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties, BuildShader& buildShader);
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct ShaderTemplatePiece final
+		{
+			const ShaderTemplate* shaderTemplate;
+			uint32_t			  nodeIndex;	///< Index of the "RendererRuntime::ShaderTemplate::NodeType::PIECE" node
+		};
+		typedef std::unordered_map<uint32_t, ShaderTemplatePiece> ShaderTemplatePieces;	///< Key = "RendererRuntime::StringId" of the piece name
+		typedef std::vector<const ShaderPieceResource*> ShaderPieceResources;
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -141,6 +176,15 @@ namespace RendererRuntime
 		bool parseCounter(const std::string& inBuffer, std::string& outBuffer);
 		bool parse(const std::string& inBuffer, std::string& outBuffer) const;
 
+		//[-------------------------------------------------------]
+		//[ Shader template                                       ]
+		//[-------------------------------------------------------]
+		bool createSourceCodeByShaderTemplates(const ShaderBlueprintResource& shaderBlueprintResource);
+		bool isShaderTemplateUsable(const ShaderTemplate& shaderTemplate) const;
+		bool collectShaderTemplatePieces(const ShaderTemplate& shaderTemplate, uint32_t firstNodeIndex, uint32_t endNodeIndex);
+		bool evaluateShaderTemplate(const ShaderTemplate& shaderTemplate, uint32_t firstNodeIndex, uint32_t endNodeIndex, size_t forEachCounter, uint32_t pieceNestingDepth, std::string& outBuffer);
+		bool evaluateShaderTemplateExpression(const ShaderTemplate& shaderTemplate, uint32_t expressionIndex) const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -150,6 +194,11 @@ namespace RendererRuntime
 		DynamicShaderPieces	mDynamicShaderPieces;
 		std::string			mInString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
 		std::string			mOutString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
+		ShaderPieceResources	mShaderPieceResources;	///< Shader piece resources to include, could be a local variable, but when making it to a member we reduce memory allocations
+		ShaderTemplatePieces	mShaderTemplatePieces;	///< Pieces collected while evaluating shader templates
+		uint32_t				mNumberOfShaderTemplateTokens;			///< Number of text, "@foreach" counter, "@value" and "@insertpiece" tokens evaluated
+		uint32_t				mLastInsertPieceShaderTemplateToken;	///< Token number of the last evaluated "@insertpiece", uninitialized if there's none
+		size_t					mLastValueShaderTemplateEnd;			///< Output position after the last evaluated "@value", "std::string::npos" if there's none
 
 
 	};
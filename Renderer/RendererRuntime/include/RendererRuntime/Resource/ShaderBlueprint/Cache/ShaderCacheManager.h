@@ -50,6 +50,7 @@ namespace Renderer
 namespace RendererRuntime
 {
 	class IFile;
+	class MemoryFile;
 	class ShaderCache;
 	class PipelineStateSignature;
 	class MaterialBlueprintResource;
@@ -136,7 +137,7 @@ namespace RendererRuntime
 	public:
 		void clearCache();
 	private:
-		void loadCache(IFile& file);
+		bool loadCache(MemoryFile& memoryFile);
 		inline bool doesCacheNeedSaving() const;
 		void saveCache(IFile& file);
 
@@ -156,6 +157,7 @@ namespace RendererRuntime
 		ShaderBlueprintResourceManager& mShaderBlueprintResourceManager;	///< Owner shader blueprint resource manager
 		ShaderCacheByShaderCacheId		mShaderCacheByShaderCacheId;		///< Manages the shader cache instances
 		ShaderCacheByShaderSourceCodeId	mShaderCacheByShaderSourceCodeId;	///< Shader source code ID to shader cache ID mapping
+		uint8_t*						mShaderBytecodeBlob;				///< Shader bytecode of all master shader caches loaded from the cache as one contiguous memory block the shader caches directly point into, can be a null pointer, must stay valid as long as shader caches reference it
 		bool							mCacheNeedsSaving;					///< "true" if a cache needs saving due to changes during runtime, else "false"
 		std::mutex						mMutex;								///< Mutex due to "RendererRuntime::PipelineStateCompiler" interaction, no too fine granular lock/unlock required because usually it's only asynchronous or synchronous processing, not both at one and the same time
 
@@ -39,6 +39,7 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	inline ShaderCacheManager::ShaderCacheManager(ShaderBlueprintResourceManager& shaderBlueprintResourceManager) :
 		mShaderBlueprintResourceManager(shaderBlueprintResourceManager),
+		mShaderBytecodeBlob(nullptr),
 		mCacheNeedsSaving(true)
 	{
 		// Nothing here
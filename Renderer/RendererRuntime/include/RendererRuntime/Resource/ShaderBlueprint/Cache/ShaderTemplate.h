@@ -0,0 +1,197 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/StringId.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	#include <string>
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Shader template: Shader blueprint or shader piece source code which was parsed once into text chunks and directive nodes
+	*
+	*  @remarks
+	*    The shader builder evaluates a shader template in a single pass against the shader properties instead of running several
+	*    string passes over the source code for each permutation. Compilation only accepts the subset of the shader builder syntax
+	*    for which a single pass provably results in the same source code as the multi-pass shader builder:
+	*    - "@property(<expression>)", "@piece(<name>)", "@insertpiece(<name>)", "@foreach(<count>, <counter>, <start>)", "@end", "@value(<name>)"
+	*    - No nested "@foreach", no "@piece" inside "@foreach" or "@piece"
+	*    - No property math ("@pset" etc.) and no counters ("@counter", "@add" etc.), since those modify the shader properties while the passes run
+	*    Everything else results in an invalid shader template and the shader builder uses the multi-pass implementation instead.
+	*
+	*  @note
+	*    - Created via "RendererRuntime::ShaderBuilder::compileShaderTemplate()"
+	*/
+	class ShaderTemplate final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class ShaderBuilder;
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		enum class NodeType : uint8_t
+		{
+			TEXT,				///< Plain text without any directive
+			PROPERTY,			///< "@property(<expression>)" block
+			PIECE,				///< "@piece(<name>)" block
+			INSERT_PIECE,		///< "@insertpiece(<name>)"
+			FOR_EACH,			///< "@foreach(<count>, <counter>, <start>)" block
+			FOR_EACH_COUNTER,	///< "@<counter>" inside a "@foreach" block
+			VALUE				///< "@value(<name>)"
+		};
+		/**
+		*  @brief
+		*    Node, the subtree of a node directly follows the node (pre-order)
+		*/
+		struct Node final
+		{
+			NodeType type;
+			uint32_t numberOfDescendants;	///< Number of nodes inside the subtree of this node, children are reached by skipping the descendants of their previous sibling
+			uint32_t index;					///< "TEXT": First character inside the text, "PROPERTY": Index of the expression root node, "FOR_EACH": Index of the for each loop
+			uint32_t numberOfCharacters;	///< "TEXT": Number of characters inside the text
+			StringId name;					///< "PIECE", "INSERT_PIECE": Piece name, "VALUE": Property name
+		};
+		typedef std::vector<Node> Nodes;
+
+		enum class ExpressionType : uint8_t
+		{
+			OPERATOR_OR,	///< ||
+			OPERATOR_AND,	///< &&
+			OBJECT,			///< (...)
+			VARIABLE		///< Property
+		};
+		/**
+		*  @brief
+		*    Expression node, the subtree of an expression node directly follows the expression node (pre-order)
+		*/
+		struct Expression final
+		{
+			ExpressionType type;
+			bool		   negated;
+			uint32_t	   numberOfDescendants;
+			StringId	   propertyId;	///< "VARIABLE": Property to evaluate
+		};
+		typedef std::vector<Expression> Expressions;
+
+		struct ForEach final
+		{
+			bool	 countIsProperty;	///< "true" if the count is the value of "countPropertyId", else "count" is used
+			StringId countPropertyId;
+			int32_t  count;
+			bool	 startIsProperty;	///< "true" if the start is the value of "startPropertyId", else "start" is used
+			StringId startPropertyId;
+			int32_t  start;
+		};
+		typedef std::vector<ForEach> ForEaches;
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline ShaderTemplate();
+		inline ~ShaderTemplate();
+
+		/**
+		*  @brief
+		*    Return whether or not the shader template can be used instead of the multi-pass shader builder
+		*
+		*  @return
+		*    "true" if the shader template is valid, else "false"
+		*/
+		inline bool isValid() const;
+
+		/**
+		*  @brief
+		*    Clear the shader template, results in an invalid shader template
+		*/
+		inline void clear();
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit ShaderTemplate(const ShaderTemplate&) = delete;
+		ShaderTemplate& operator=(const ShaderTemplate&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		bool		mValid;
+		std::string	mText;			///< Concatenated text of all text nodes
+		Nodes		mNodes;			///< All nodes in pre-order, top level nodes are reached by skipping the descendants of their previous sibling
+		Expressions	mExpressions;
+		ForEaches	mForEaches;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderTemplate.inl"
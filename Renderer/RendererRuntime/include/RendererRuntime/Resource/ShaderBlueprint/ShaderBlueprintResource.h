@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include "RendererRuntime/Resource/Detail/IResource.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderProperties.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderTemplate.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -125,6 +126,15 @@ namespace RendererRuntime
 		*/
 		inline const std::string& getShaderSourceCode() const;
 
+		/**
+		*  @brief
+		*    Return the shader template compiled from the shader source code
+		*
+		*  @return
+		*    The shader template, invalid if the shader source code must be processed by the multi-pass shader builder
+		*/
+		inline const ShaderTemplate& getShaderTemplate() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -149,6 +159,7 @@ namespace RendererRuntime
 		IncludeShaderPieceResourceIds mIncludeShaderPieceResourceIds;
 		ShaderProperties			  mReferencedShaderProperties;	// Directly use "RendererRuntime::ShaderProperties" to keep things simple, although we don't need a shader property value
 		std::string					  mShaderSourceCode;
+		ShaderTemplate				  mShaderTemplate;
 
 
 	};
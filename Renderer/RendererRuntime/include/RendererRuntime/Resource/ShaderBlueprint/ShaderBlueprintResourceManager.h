@@ -38,8 +38,10 @@
 namespace RendererRuntime
 {
 	class IFile;
+	class MemoryFile;
 	class IRendererRuntime;
 	class ShaderBlueprintResource;
+	class IShaderBytecodeCompiler;
 	class ShaderBlueprintResourceLoader;
 	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
 }
@@ -105,6 +107,33 @@ namespace RendererRuntime
 		*/
 		inline ShaderCacheManager& getShaderCacheManager();
 
+		/**
+		*  @brief
+		*    Return the shader bytecode compiler used for offline shader bytecode compilation
+		*
+		*  @return
+		*    The shader bytecode compiler, null pointer if the renderer backend compiles the shaders (the usual case), do not destroy the instance
+		*/
+		inline IShaderBytecodeCompiler* getShaderBytecodeCompiler() const;
+
+		/**
+		*  @brief
+		*    Set the shader bytecode compiler used for offline shader bytecode compilation
+		*
+		*  @param[in] shaderBytecodeCompiler
+		*    Shader bytecode compiler to use, null pointer to let the renderer backend compile the shaders again, the instance must stay valid as long as it's set
+		*
+		*  @remarks
+		*    While a shader bytecode compiler is set, the shader caches only receive the shader bytecode of the target renderer backend the shader bytecode
+		*    compiler is describing. No renderer shaders, programs or pipeline state objects are created, so the renderer runtime can e.g. run using the null
+		*    renderer. The renderer shader properties as well as the pipeline state object cache filename are the ones of the target renderer backend.
+		*
+		*  @note
+		*    - Used by the renderer toolkit to precompile the pipeline state object cache of a renderer backend without a GPU
+		*    - Clears the pipeline state object cache, don't call this method while the pipeline state compiler is busy
+		*/
+		RENDERERRUNTIME_API_EXPORT void setShaderBytecodeCompiler(IShaderBytecodeCompiler* shaderBytecodeCompiler);
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual RendererRuntime::IResourceManager methods ]
@@ -133,12 +162,13 @@ namespace RendererRuntime
 		virtual ~ShaderBlueprintResourceManager() override;
 		explicit ShaderBlueprintResourceManager(const ShaderBlueprintResourceManager&) = delete;
 		ShaderBlueprintResourceManager& operator=(const ShaderBlueprintResourceManager&) = delete;
+		void gatherRendererShaderProperties();
 
 		//[-------------------------------------------------------]
 		//[ Pipeline state object cache                           ]
 		//[-------------------------------------------------------]
 		inline void clearPipelineStateObjectCache();
-		inline void loadPipelineStateObjectCache(IFile& file);
+		inline bool loadPipelineStateObjectCache(MemoryFile& memoryFile);
 		inline bool doesPipelineStateObjectCacheNeedSaving() const;
 		inline void savePipelineStateObjectCache(IFile& file);
 
@@ -147,9 +177,10 @@ namespace RendererRuntime
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		IRendererRuntime&  mRendererRuntime;
-		ShaderProperties   mRendererShaderProperties;
-		ShaderCacheManager mShaderCacheManager;
+		IRendererRuntime&		 mRendererRuntime;
+		IShaderBytecodeCompiler* mShaderBytecodeCompiler;	///< Shader bytecode compiler used for offline shader bytecode compilation, can be a null pointer, don't destroy the instance
+		ShaderProperties		 mRendererShaderProperties;
+		ShaderCacheManager		 mShaderCacheManager;
 
 		// Internal resource manager implementation
 		ResourceManagerTemplate<ShaderBlueprintResource, ShaderBlueprintResourceLoader, ShaderBlueprintResourceId, 64>* mInternalResourceManager;
@@ -43,6 +43,11 @@ namespace RendererRuntime
 		return mShaderCacheManager;
 	}
 
+	inline IShaderBytecodeCompiler* ShaderBlueprintResourceManager::getShaderBytecodeCompiler() const
+	{
+		return mShaderBytecodeCompiler;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual RendererRuntime::IResourceManager methods ]
@@ -61,9 +66,9 @@ namespace RendererRuntime
 		mShaderCacheManager.clearCache();
 	}
 
-	inline void ShaderBlueprintResourceManager::loadPipelineStateObjectCache(IFile& file)
+	inline bool ShaderBlueprintResourceManager::loadPipelineStateObjectCache(MemoryFile& memoryFile)
 	{
-		mShaderCacheManager.loadCache(file);
+		return mShaderCacheManager.loadCache(memoryFile);
 	}
 
 	inline bool ShaderBlueprintResourceManager::doesPipelineStateObjectCacheNeedSaving() const
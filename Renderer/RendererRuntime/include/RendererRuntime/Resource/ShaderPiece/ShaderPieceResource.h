@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererRuntime/Resource/Detail/IResource.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderTemplate.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -98,6 +99,15 @@ namespace RendererRuntime
 		*/
 		inline const std::string& getShaderSourceCode() const;
 
+		/**
+		*  @brief
+		*    Return the shader template compiled from the shader source code
+		*
+		*  @return
+		*    The shader template, invalid if the shader source code must be processed by the multi-pass shader builder
+		*/
+		inline const ShaderTemplate& getShaderTemplate() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -119,7 +129,8 @@ namespace RendererRuntime
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		std::string mShaderSourceCode;
+		std::string	   mShaderSourceCode;
+		ShaderTemplate mShaderTemplate;
 
 
 	};
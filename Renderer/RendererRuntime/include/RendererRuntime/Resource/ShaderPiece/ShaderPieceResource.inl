@@ -33,6 +33,11 @@ namespace RendererRuntime
 		return mShaderSourceCode;
 	}
 
+	inline const ShaderTemplate& ShaderPieceResource::getShaderTemplate() const
+	{
+		return mShaderTemplate;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -61,6 +66,7 @@ namespace RendererRuntime
 	{
 		// Reset everything
 		mShaderSourceCode.clear();
+		mShaderTemplate.clear();
 
 		// Call base implementation
 		IResource::deinitializeElement();
@@ -91,6 +91,7 @@ namespace RendererRuntime
 		uint32_t mWidth;
 		uint32_t mHeight;
 		uint32_t mDepth;
+		uint32_t mNumberOfSlices;	///< Number of 2D texture array slices, 1 if it's no 2D texture array
 		uint8_t  mTextureFormat;	// "Renderer::TextureFormat", don't want to include the header in here
 		bool	 mDataContainsMipmaps;
 		// Temporary image data
@@ -47,6 +47,7 @@ namespace RendererRuntime
 		mWidth(0),
 		mHeight(0),
 		mDepth(0),
+		mNumberOfSlices(0),
 		mTextureFormat(0),
 		mDataContainsMipmaps(false),
 		mNumberOfImageDataBytes(0),
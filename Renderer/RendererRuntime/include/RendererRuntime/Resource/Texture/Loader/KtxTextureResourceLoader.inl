@@ -46,6 +46,7 @@ namespace RendererRuntime
 		ITextureResourceLoader(resourceManager, rendererRuntime),
 		mWidth(0),
 		mHeight(0),
+		mNumberOfSlices(0),
 		mTextureFormat(0),
 		mCubeMap(false),
 		mDataContainsMipmaps(false),
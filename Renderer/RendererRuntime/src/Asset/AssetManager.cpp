@@ -136,6 +136,7 @@ namespace RendererRuntime
 		if (nullptr != file)
 		{
 			AssetPackage* assetPackage = new AssetPackage(assetPackageId);
+			assetPackage->mVirtualFilename = virtualFilename;
 			AssetPackageLoader().loadAssetPackage(*assetPackage, *file);
 			mAssetPackageVector.push_back(assetPackage);
 			fileManager.closeFile(*file);
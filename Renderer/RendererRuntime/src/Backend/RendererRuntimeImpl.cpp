@@ -24,8 +24,10 @@
 #include "RendererRuntime/PrecompiledHeader.h"
 #include "RendererRuntime/Backend/RendererRuntimeImpl.h"
 #include "RendererRuntime/Asset/AssetManager.h"
+#include "RendererRuntime/Asset/AssetPackage.h"
 #include "RendererRuntime/Core/File/MemoryFile.h"
 #include "RendererRuntime/Core/Time/TimeManager.h"
+#include "RendererRuntime/Core/Time/CpuProfiler.h"
 #include "RendererRuntime/Core/File/IFileManager.h"
 #include "RendererRuntime/Core/Thread/ThreadPool.h"
 #include "RendererRuntime/Resource/Detail/ResourceStreamer.h"
@@ -34,6 +36,7 @@
 #include "RendererRuntime/Resource/Scene/SceneResourceManager.h"
 #include "RendererRuntime/Resource/ShaderPiece/ShaderPieceResourceManager.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/IShaderBytecodeCompiler.h"
 #include "RendererRuntime/Resource/VertexAttributes/VertexAttributesResourceManager.h"
 #include "RendererRuntime/Resource/Texture/TextureResourceManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
@@ -81,6 +84,12 @@ namespace
 		namespace PipelineStateCache
 		{
 			static const uint32_t FORMAT_TYPE	 = RendererRuntime::StringId("PipelineStateCache");
+			static const uint32_t FORMAT_VERSION = 4;
+		}
+
+		namespace RendererPipelineCache
+		{
+			static const uint32_t FORMAT_TYPE	 = RendererRuntime::StringId("RendererPipelineCache");
 			static const uint32_t FORMAT_VERSION = 1;
 		}
 
@@ -88,10 +97,44 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
-		void getPipelineStateObjectCacheFilename(const RendererRuntime::IRendererRuntime& rendererRuntime, std::string& virtualDirectoryName, std::string& virtualFilename)
+		bool isShaderBytecodeAvailable(const RendererRuntime::IRendererRuntime& rendererRuntime)
+		{
+			// Without shader bytecode a pipeline state object cache is pointless, during offline shader bytecode compilation there's no need for renderer backend support
+			return (rendererRuntime.getRenderer().getCapabilities().shaderBytecode || nullptr != rendererRuntime.getShaderBlueprintResourceManager().getShaderBytecodeCompiler());
+		}
+
+		const char* getPipelineStateObjectCacheRendererName(const RendererRuntime::IRendererRuntime& rendererRuntime)
+		{
+			// During offline shader bytecode compilation the pipeline state object cache is the one of the target renderer backend
+			const RendererRuntime::IShaderBytecodeCompiler* shaderBytecodeCompiler = rendererRuntime.getShaderBlueprintResourceManager().getShaderBytecodeCompiler();
+			return (nullptr != shaderBytecodeCompiler) ? shaderBytecodeCompiler->getRendererName() : rendererRuntime.getRenderer().getName();
+		}
+
+		void getPipelineStateObjectCacheDirectoryName(const RendererRuntime::IRendererRuntime& rendererRuntime, std::string& virtualDirectoryName)
 		{
 			virtualDirectoryName = std::string(rendererRuntime.getFileManager().getLocalDataMountPoint()) + "/PipelineStateObjectCache";
-			virtualFilename = virtualDirectoryName + '/' + rendererRuntime.getRenderer().getName() + ".pso_cache";
+		}
+
+		void getPipelineStateObjectCacheFilename(const RendererRuntime::IRendererRuntime& rendererRuntime, std::string& virtualDirectoryName, std::string& virtualFilename)
+		{
+			getPipelineStateObjectCacheDirectoryName(rendererRuntime, virtualDirectoryName);
+			virtualFilename = virtualDirectoryName + '/' + getPipelineStateObjectCacheRendererName(rendererRuntime) + ".pso_cache";
+		}
+
+		void getShippedPipelineStateObjectCacheFilename(const RendererRuntime::IRendererRuntime& rendererRuntime, const std::string& assetPackageVirtualFilename, std::string& virtualFilename)
+		{
+			// Stored next to the asset package: "<asset package>.<renderer name>.pso_cache"
+			const size_t extensionIndex = assetPackageVirtualFilename.find_last_of('.');
+			const size_t lastSlashIndex = assetPackageVirtualFilename.find_last_of('/');
+			const bool hasExtension = (std::string::npos != extensionIndex && (std::string::npos == lastSlashIndex || extensionIndex > lastSlashIndex));
+			virtualFilename = (hasExtension ? assetPackageVirtualFilename.substr(0, extensionIndex) : assetPackageVirtualFilename) + '.' + getPipelineStateObjectCacheRendererName(rendererRuntime) + ".pso_cache";
+		}
+
+		void getRendererPipelineCacheFilename(const RendererRuntime::IRendererRuntime& rendererRuntime, std::string& virtualDirectoryName, std::string& virtualFilename)
+		{
+			// Stored next to the pipeline state object cache, loaded before the shader blueprint resource manager exists
+			getPipelineStateObjectCacheDirectoryName(rendererRuntime, virtualDirectoryName);
+			virtualFilename = virtualDirectoryName + '/' + rendererRuntime.getRenderer().getName() + ".pipeline_cache";
 		}
 
 		bool loadPipelineStateObjectCacheFile(const RendererRuntime::IRendererRuntime& rendererRuntime, RendererRuntime::MemoryFile& memoryFile)
@@ -99,14 +142,36 @@ namespace
 			// Tell the memory mapped file about the LZ4 compressed data and decompress it at once
 			std::string virtualDirectoryName;
 			std::string virtualFilename;
-			getPipelineStateObjectCacheFilename(rendererRuntime, virtualDirectoryName, virtualFilename);
 			const RendererRuntime::IFileManager& fileManager = rendererRuntime.getFileManager();
-			if (fileManager.doesFileExist(virtualFilename.c_str()) && memoryFile.loadLz4CompressedDataByVirtualFilename(PipelineStateCache::FORMAT_TYPE, PipelineStateCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+			if (nullptr != fileManager.getLocalDataMountPoint())
 			{
-				memoryFile.decompress();
+				getPipelineStateObjectCacheFilename(rendererRuntime, virtualDirectoryName, virtualFilename);
+				if (fileManager.doesFileExist(virtualFilename.c_str()) && memoryFile.loadLz4CompressedDataByVirtualFilename(PipelineStateCache::FORMAT_TYPE, PipelineStateCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+				{
+					memoryFile.decompress();
 
-				// Done
-				return true;
+					// Done
+					return true;
+				}
+			}
+
+			// There's no locally saved pipeline state object cache, use the pipeline state object cache shipped together with an asset package, if there's one
+			// -> Later added asset packages cover old ones
+			const RendererRuntime::AssetManager::AssetPackageVector& assetPackageVector = rendererRuntime.getAssetManager().getAssetPackageVector();
+			for (RendererRuntime::AssetManager::AssetPackageVector::const_reverse_iterator iterator = assetPackageVector.crbegin(); iterator != assetPackageVector.crend(); ++iterator)
+			{
+				const std::string& assetPackageVirtualFilename = (*iterator)->getVirtualFilename();
+				if (!assetPackageVirtualFilename.empty())
+				{
+					getShippedPipelineStateObjectCacheFilename(rendererRuntime, assetPackageVirtualFilename, virtualFilename);
+					if (fileManager.doesFileExist(virtualFilename.c_str()) && memoryFile.loadLz4CompressedDataByVirtualFilename(PipelineStateCache::FORMAT_TYPE, PipelineStateCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+					{
+						memoryFile.decompress();
+
+						// Done
+						return true;
+					}
+				}
 			}
 			
 			// Failed to load the cache
@@ -157,7 +222,8 @@ namespace RendererRuntime
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	RendererRuntimeImpl::RendererRuntimeImpl(Context& context) :
-		IRendererRuntime(context)
+		IRendererRuntime(context),
+		mRendererPipelineCacheNumberOfBytes(0)
 	{
 		// Backup the given renderer and add our reference
 		mRenderer = &context.getRenderer();
@@ -172,6 +238,9 @@ namespace RendererRuntime
 		// Backup the given file manager instance
 		mFileManager = &context.getFileManager();
 
+		// Load the renderer pipeline cache before anyone is able to create renderer pipeline states
+		loadRendererPipelineCache();
+
 		// Create the core manager instances
 		mDefaultThreadPool = new DefaultThreadPool();
 		mAssetManager = new AssetManager(*this);
@@ -286,6 +355,10 @@ namespace RendererRuntime
 
 	void RendererRuntimeImpl::update()
 	{
+		// Begin a new CPU profiler frame
+		RENDERER_RUNTIME_CPU_PROFILER_BEGIN_FRAME()
+		RENDERER_RUNTIME_CPU_PROFILER_SCOPE_FUNCTION()
+
 		// Update the time manager
 		mTimeManager->update();
 
@@ -327,7 +400,7 @@ namespace RendererRuntime
 
 	void RendererRuntimeImpl::loadPipelineStateObjectCache()
 	{
-		if (mRenderer->getCapabilities().shaderBytecode)
+		if (::detail::isShaderBytecodeAvailable(*this))
 		{
 			clearPipelineStateObjectCache();
 
@@ -335,8 +408,12 @@ namespace RendererRuntime
 			MemoryFile memoryFile;
 			if (::detail::loadPipelineStateObjectCacheFile(*this, memoryFile))
 			{
-				mShaderBlueprintResourceManager->loadPipelineStateObjectCache(memoryFile);
-				mMaterialBlueprintResourceManager->loadPipelineStateObjectCache(memoryFile);
+				if (!mShaderBlueprintResourceManager->loadPipelineStateObjectCache(memoryFile) || !mMaterialBlueprintResourceManager->loadPipelineStateObjectCache(memoryFile))
+				{
+					// Discard the whole pipeline state object cache, it's going to be rebuilt on demand and saved again
+					RENDERER_LOG(getContext(), CRITICAL, "The renderer runtime discarded the pipeline state object cache since it's corrupt")
+					clearPipelineStateObjectCache();
+				}
 			}
 			else
 			{
@@ -348,8 +425,11 @@ namespace RendererRuntime
 
 	void RendererRuntimeImpl::savePipelineStateObjectCache()
 	{
+		// The renderer pipeline cache is independent of the shader bytecode support
+		saveRendererPipelineCache();
+
 		// Do only save the pipeline state object cache if writing local data is allowed
-		if (mRenderer->getCapabilities().shaderBytecode &&
+		if (::detail::isShaderBytecodeAvailable(*this) &&
 			(mShaderBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving() || mMaterialBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving()) &&
 			nullptr != mFileManager->getLocalDataMountPoint())
 		{
@@ -360,6 +440,31 @@ namespace RendererRuntime
 		}
 	}
 
+	bool RendererRuntimeImpl::saveShippedPipelineStateObjectCache(IFileManager& fileManager, VirtualFilename assetPackageVirtualFilename)
+	{
+		if (::detail::isShaderBytecodeAvailable(*this))
+		{
+			// Wait for the pipeline state compiler, the pipeline state object cache must contain everything which is known at this point in time
+			mPipelineStateCompiler->flushAllQueues();
+
+			// Write the pipeline state object cache
+			MemoryFile memoryFile;
+			mShaderBlueprintResourceManager->savePipelineStateObjectCache(memoryFile);
+			mMaterialBlueprintResourceManager->savePipelineStateObjectCache(memoryFile);
+			std::string virtualFilename;
+			::detail::getShippedPipelineStateObjectCacheFilename(*this, assetPackageVirtualFilename, virtualFilename);
+			if (memoryFile.writeLz4CompressedDataByVirtualFilename(::detail::PipelineStateCache::FORMAT_TYPE, ::detail::PipelineStateCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+			{
+				// Done
+				return true;
+			}
+			RENDERER_LOG(getContext(), CRITICAL, "The renderer runtime failed to save the shipped pipeline state object cache to \"%s\"", virtualFilename.c_str())
+		}
+
+		// Error!
+		return false;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::RefCount methods          ]
@@ -370,6 +475,55 @@ namespace RendererRuntime
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void RendererRuntimeImpl::loadRendererPipelineCache()
+	{
+		if (nullptr != mFileManager->getLocalDataMountPoint())
+		{
+			std::string virtualDirectoryName;
+			std::string virtualFilename;
+			::detail::getRendererPipelineCacheFilename(*this, virtualDirectoryName, virtualFilename);
+			MemoryFile memoryFile;
+			if (mFileManager->doesFileExist(virtualFilename.c_str()) && memoryFile.loadLz4CompressedDataByVirtualFilename(::detail::RendererPipelineCache::FORMAT_TYPE, ::detail::RendererPipelineCache::FORMAT_VERSION, *mFileManager, virtualFilename.c_str()))
+			{
+				memoryFile.decompress();
+				const MemoryFile::ByteVector& byteVector = memoryFile.getByteVector();
+				if (!byteVector.empty() && mRenderer->setPipelineCacheData(byteVector.data(), static_cast<uint32_t>(byteVector.size())))
+				{
+					mRendererPipelineCacheNumberOfBytes = static_cast<uint32_t>(byteVector.size());
+				}
+			}
+		}
+	}
+
+	void RendererRuntimeImpl::saveRendererPipelineCache()
+	{
+		// Do only save the renderer pipeline cache if it has been changed and writing local data is allowed
+		// -> Renderer pipeline caches only grow, so comparing the number of bytes is sufficient
+		const uint32_t numberOfBytes = mRenderer->getPipelineCacheData(nullptr, 0);
+		if (0 != numberOfBytes && numberOfBytes != mRendererPipelineCacheNumberOfBytes && nullptr != mFileManager->getLocalDataMountPoint())
+		{
+			MemoryFile memoryFile;
+			MemoryFile::ByteVector& byteVector = memoryFile.getByteVector();
+			byteVector.resize(numberOfBytes);
+			byteVector.resize(mRenderer->getPipelineCacheData(byteVector.data(), numberOfBytes));
+			std::string virtualDirectoryName;
+			std::string virtualFilename;
+			::detail::getRendererPipelineCacheFilename(*this, virtualDirectoryName, virtualFilename);
+			if (mFileManager->createDirectories(virtualDirectoryName.c_str()) && memoryFile.writeLz4CompressedDataByVirtualFilename(::detail::RendererPipelineCache::FORMAT_TYPE, ::detail::RendererPipelineCache::FORMAT_VERSION, *mFileManager, virtualFilename.c_str()))
+			{
+				mRendererPipelineCacheNumberOfBytes = static_cast<uint32_t>(byteVector.size());
+			}
+			else
+			{
+				RENDERER_LOG(getContext(), CRITICAL, "The renderer runtime failed to save the renderer pipeline cache to \"%s\"", virtualFilename.c_str())
+			}
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
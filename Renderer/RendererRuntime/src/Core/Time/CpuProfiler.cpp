@@ -0,0 +1,379 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/PrecompiledHeader.h"
+#include "RendererRuntime/Core/Time/CpuProfiler.h"
+#include "RendererRuntime/Core/File/IFileManager.h"
+#include "RendererRuntime/Core/File/IFile.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4548)	// warning C4548: expression before comma has no effect; expected expression with side-effect
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <mutex>
+	#include <atomic>
+	#include <chrono>
+	#include <limits>
+	#include <string>
+	#include <cstdio>
+	#include <algorithm>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Ring buffer event, all members are atomics so a reader can copy an event while the owning thread is overwriting it without a data race
+		*/
+		struct RingBufferEvent final
+		{
+			std::atomic<const char*> name;
+			std::atomic<uint64_t>	 beginNanoseconds;
+			std::atomic<uint64_t>	 endNanoseconds;
+			std::atomic<uint32_t>	 depth;
+		};
+
+		struct ThreadEventRingBuffer final
+		{
+			uint32_t			  threadIndex;
+			uint32_t			  depth;					///< Only accessed by the owning thread
+			std::atomic<uint64_t> numberOfWrittenEvents;	///< Written by the owning thread only, the ring buffer index is "numberOfWrittenEvents % NUMBER_OF_EVENTS_PER_THREAD"
+			RingBufferEvent		  events[RendererRuntime::CpuProfiler::NUMBER_OF_EVENTS_PER_THREAD];
+
+			explicit ThreadEventRingBuffer(uint32_t _threadIndex) :
+				threadIndex(_threadIndex),
+				depth(0),
+				numberOfWrittenEvents(0)
+			{
+				// Nothing here
+			}
+		};
+
+		struct ThreadEventRingBuffers final
+		{
+			std::mutex			   registrationMutex;
+			std::atomic<uint32_t>  numberOfThreads;		///< Number of ever registered ring buffers, a ring buffer is never destroyed before the profiler shutdown
+			ThreadEventRingBuffer* threadEventRingBuffers[RendererRuntime::CpuProfiler::MAXIMUM_NUMBER_OF_THREADS];
+			std::vector<uint32_t>  freeThreadIndices;		///< Ring buffers of exited threads which can be recycled, protected by "registrationMutex"
+			std::atomic<uint64_t>  numberOfFrames;		///< Number of published frame begin timestamps
+			std::atomic<uint64_t>  frameBeginNanoseconds[RendererRuntime::CpuProfiler::NUMBER_OF_FRAMES];
+
+			ThreadEventRingBuffers() :
+				numberOfThreads(0),
+				threadEventRingBuffers{},
+				numberOfFrames(0)
+			{
+				for (std::atomic<uint64_t>& frameBegin : frameBeginNanoseconds)
+				{
+					frameBegin.store(0, std::memory_order_relaxed);
+				}
+			}
+
+			~ThreadEventRingBuffers()
+			{
+				const uint32_t currentNumberOfThreads = numberOfThreads.load();
+				for (uint32_t i = 0; i < currentNumberOfThreads; ++i)
+				{
+					delete threadEventRingBuffers[i];
+				}
+			}
+		};
+
+		/**
+		*  @brief
+		*    Thread local ring buffer registration, releases the ring buffer for recycling as soon as the thread exits
+		*/
+		struct ThreadRegistration final
+		{
+			bool				   registered;
+			ThreadEventRingBuffer* threadEventRingBuffer;	///< Can be a null pointer if the maximum number of threads has been reached
+
+			ThreadRegistration() :
+				registered(false),
+				threadEventRingBuffer(nullptr)
+			{
+				// Nothing here
+			}
+
+			~ThreadRegistration();
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		static ThreadEventRingBuffers threadEventRingBuffers;
+		static thread_local ThreadRegistration currentThreadRegistration;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		ThreadRegistration::~ThreadRegistration()
+		{
+			// The events recorded so far stay readable until the next thread using the recycled ring buffer overwrites them
+			if (nullptr != threadEventRingBuffer)
+			{
+				std::lock_guard<std::mutex> registrationMutexLock(threadEventRingBuffers.registrationMutex);
+				threadEventRingBuffers.freeThreadIndices.push_back(threadEventRingBuffer->threadIndex);
+			}
+		}
+
+		ThreadEventRingBuffer* getCurrentThreadEventRingBuffer()
+		{
+			// Lazy registration of the current thread, the only place where a lock is needed
+			ThreadRegistration& threadRegistration = currentThreadRegistration;
+			if (!threadRegistration.registered)
+			{
+				threadRegistration.registered = true;
+				std::lock_guard<std::mutex> registrationMutexLock(threadEventRingBuffers.registrationMutex);
+				if (!threadEventRingBuffers.freeThreadIndices.empty())
+				{
+					// Recycle the ring buffer of an exited thread
+					threadRegistration.threadEventRingBuffer = threadEventRingBuffers.threadEventRingBuffers[threadEventRingBuffers.freeThreadIndices.back()];
+					threadEventRingBuffers.freeThreadIndices.pop_back();
+					threadRegistration.threadEventRingBuffer->depth = 0;
+				}
+				else
+				{
+					const uint32_t threadIndex = threadEventRingBuffers.numberOfThreads.load(std::memory_order_relaxed);
+					if (threadIndex < RendererRuntime::CpuProfiler::MAXIMUM_NUMBER_OF_THREADS)
+					{
+						threadRegistration.threadEventRingBuffer = new ThreadEventRingBuffer(threadIndex);
+						threadEventRingBuffers.threadEventRingBuffers[threadIndex] = threadRegistration.threadEventRingBuffer;
+						threadEventRingBuffers.numberOfThreads.store(threadIndex + 1, std::memory_order_release);
+					}
+				}
+			}
+			return threadRegistration.threadEventRingBuffer;
+		}
+
+		void gatherEvents(uint64_t beginNanoseconds, uint64_t endNanoseconds, RendererRuntime::CpuProfiler::Events& events)
+		{
+			RendererRuntime::CpuProfiler::Events threadEvents;
+			const uint32_t numberOfThreads = threadEventRingBuffers.numberOfThreads.load(std::memory_order_acquire);
+			for (uint32_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex)
+			{
+				// Copy the published events of the thread
+				const ThreadEventRingBuffer& threadEventRingBuffer = *threadEventRingBuffers.threadEventRingBuffers[threadIndex];
+				const uint64_t numberOfWrittenEvents = threadEventRingBuffer.numberOfWrittenEvents.load(std::memory_order_acquire);
+				const uint64_t firstEvent = (numberOfWrittenEvents > RendererRuntime::CpuProfiler::NUMBER_OF_EVENTS_PER_THREAD) ? (numberOfWrittenEvents - RendererRuntime::CpuProfiler::NUMBER_OF_EVENTS_PER_THREAD) : 0;
+				threadEvents.clear();
+				for (uint64_t i = firstEvent; i < numberOfWrittenEvents; ++i)
+				{
+					const RingBufferEvent& ringBufferEvent = threadEventRingBuffer.events[i & (RendererRuntime::CpuProfiler::NUMBER_OF_EVENTS_PER_THREAD - 1)];
+					threadEvents.push_back({ringBufferEvent.name.load(std::memory_order_relaxed), ringBufferEvent.beginNanoseconds.load(std::memory_order_relaxed), ringBufferEvent.endNanoseconds.load(std::memory_order_relaxed), ringBufferEvent.depth.load(std::memory_order_relaxed), threadIndex});
+				}
+
+				// Discard the copied events the owning thread might have overwritten while they were copied
+				// -> The owning thread might currently be writing the not yet published event "numberOfWrittenEventsAfterCopy", which shares the ring buffer slot with the event "numberOfWrittenEventsAfterCopy - NUMBER_OF_EVENTS_PER_THREAD"
+				std::atomic_thread_fence(std::memory_order_acquire);
+				const uint64_t numberOfWrittenEventsAfterCopy = threadEventRingBuffer.numberOfWrittenEvents.load(std::memory_order_relaxed);
+				const uint64_t firstValidEvent = (numberOfWrittenEventsAfterCopy >= RendererRuntime::CpuProfiler::NUMBER_OF_EVENTS_PER_THREAD) ? (numberOfWrittenEventsAfterCopy + 1 - RendererRuntime::CpuProfiler::NUMBER_OF_EVENTS_PER_THREAD) : 0;
+				const size_t numberOfThreadEvents = threadEvents.size();
+				for (size_t i = (firstValidEvent > firstEvent) ? static_cast<size_t>(std::min(firstValidEvent - firstEvent, static_cast<uint64_t>(numberOfThreadEvents))) : 0; i < numberOfThreadEvents; ++i)
+				{
+					const RendererRuntime::CpuProfiler::Event& event = threadEvents[i];
+					if (event.beginNanoseconds >= beginNanoseconds && event.endNanoseconds <= endNanoseconds)
+					{
+						events.push_back(event);
+					}
+				}
+			}
+		}
+
+		void appendJsonString(std::string& json, const char* text)
+		{
+			json += '"';
+			for (const char* character = text; '\0' != *character; ++character)
+			{
+				if ('"' == *character || '\\' == *character)
+				{
+					json += '\\';
+				}
+				json += *character;
+			}
+			json += '"';
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	uint64_t CpuProfiler::getNanoseconds()
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	void CpuProfiler::beginFrame()
+	{
+		// Only called by a single thread, so there's no need for a compare-and-swap
+		const uint64_t numberOfFrames = ::detail::threadEventRingBuffers.numberOfFrames.load(std::memory_order_relaxed);
+		::detail::threadEventRingBuffers.frameBeginNanoseconds[numberOfFrames % NUMBER_OF_FRAMES].store(getNanoseconds(), std::memory_order_relaxed);
+		::detail::threadEventRingBuffers.numberOfFrames.store(numberOfFrames + 1, std::memory_order_release);
+	}
+
+	uint64_t CpuProfiler::beginEvent()
+	{
+		::detail::ThreadEventRingBuffer* threadEventRingBuffer = ::detail::getCurrentThreadEventRingBuffer();
+		if (nullptr != threadEventRingBuffer)
+		{
+			++threadEventRingBuffer->depth;
+		}
+		return getNanoseconds();
+	}
+
+	void CpuProfiler::endEvent(const char* name, uint64_t beginNanoseconds)
+	{
+		const uint64_t endNanoseconds = getNanoseconds();
+		::detail::ThreadEventRingBuffer* threadEventRingBuffer = ::detail::currentThreadRegistration.threadEventRingBuffer;
+		if (nullptr != threadEventRingBuffer)
+		{
+			assert(0 != threadEventRingBuffer->depth && "Unbalanced CPU profiler event");
+			--threadEventRingBuffer->depth;
+
+			// Single producer: Write the event and publish it afterwards
+			// -> The release fence ensures that a reader which sees a part of the new event also sees the number of written events published before
+			const uint64_t numberOfWrittenEvents = threadEventRingBuffer->numberOfWrittenEvents.load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			::detail::RingBufferEvent& event = threadEventRingBuffer->events[numberOfWrittenEvents & (NUMBER_OF_EVENTS_PER_THREAD - 1)];
+			event.name.store(name, std::memory_order_relaxed);
+			event.beginNanoseconds.store(beginNanoseconds, std::memory_order_relaxed);
+			event.endNanoseconds.store(endNanoseconds, std::memory_order_relaxed);
+			event.depth.store(threadEventRingBuffer->depth, std::memory_order_relaxed);
+			threadEventRingBuffer->numberOfWrittenEvents.store(numberOfWrittenEvents + 1, std::memory_order_release);
+		}
+	}
+
+	uint32_t CpuProfiler::getNumberOfThreads()
+	{
+		return ::detail::threadEventRingBuffers.numberOfThreads.load(std::memory_order_acquire);
+	}
+
+	bool CpuProfiler::getLastFrameEvents(Events& events, uint64_t& frameBeginNanoseconds, uint64_t& frameEndNanoseconds)
+	{
+		events.clear();
+		const uint64_t numberOfFrames = ::detail::threadEventRingBuffers.numberOfFrames.load(std::memory_order_acquire);
+		if (numberOfFrames >= 2)
+		{
+			// The frame timestamps are published via the atomic number of frames, the last completed frame is the one in front of the current frame
+			frameBeginNanoseconds = ::detail::threadEventRingBuffers.frameBeginNanoseconds[(numberOfFrames - 2) % NUMBER_OF_FRAMES].load(std::memory_order_relaxed);
+			frameEndNanoseconds   = ::detail::threadEventRingBuffers.frameBeginNanoseconds[(numberOfFrames - 1) % NUMBER_OF_FRAMES].load(std::memory_order_relaxed);
+			::detail::gatherEvents(frameBeginNanoseconds, frameEndNanoseconds, events);
+			return true;
+		}
+		else
+		{
+			frameBeginNanoseconds = frameEndNanoseconds = 0;
+			return false;
+		}
+	}
+
+	bool CpuProfiler::writeChromeTrace(const IFileManager& fileManager, VirtualFilename virtualFilename)
+	{
+		// Gather all currently recorded events
+		Events events;
+		::detail::gatherEvents(0, std::numeric_limits<uint64_t>::max(), events);
+		uint64_t firstBeginNanoseconds = std::numeric_limits<uint64_t>::max();
+		for (const Event& event : events)
+		{
+			if (firstBeginNanoseconds > event.beginNanoseconds)
+			{
+				firstBeginNanoseconds = event.beginNanoseconds;
+			}
+		}
+
+		// Build the Chrome trace event JSON, see "Trace Event Format" ( https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU )
+		// -> Timestamps are in microseconds relative to the first event
+		std::string json;
+		json.reserve(events.size() * 96 + 256);
+		json += "{\"traceEvents\":[";
+		char buffer[128];
+		bool firstEntry = true;
+		const uint32_t numberOfThreads = getNumberOfThreads();
+		for (uint32_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex)
+		{
+			snprintf(buffer, sizeof(buffer), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}", firstEntry ? "" : ",", threadIndex, threadIndex);
+			json += buffer;
+			firstEntry = false;
+		}
+		for (const Event& event : events)
+		{
+			json += firstEntry ? "{\"name\":" : ",{\"name\":";
+			::detail::appendJsonString(json, event.name);
+			snprintf(buffer, sizeof(buffer), ",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", event.threadIndex, static_cast<double>(event.beginNanoseconds - firstBeginNanoseconds) * 0.001, static_cast<double>(event.endNanoseconds - event.beginNanoseconds) * 0.001);
+			json += buffer;
+			firstEntry = false;
+		}
+		json += "]}";
+
+		// Write the file
+		IFile* file = fileManager.openFile(IFileManager::FileMode::WRITE, virtualFilename);
+		if (nullptr != file)
+		{
+			file->write(json.data(), json.size());
+			fileManager.closeFile(*file);
+			return true;
+		}
+
+		// Error!
+		return false;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
@@ -32,6 +32,8 @@
 #include "RendererRuntime/Resource/Skeleton/SkeletonResourceManager.h"
 #include "RendererRuntime/Resource/Skeleton/SkeletonResource.h"
 #include "RendererRuntime/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
+#include "RendererRuntime/Core/Time/CpuProfiler.h"
+#include "RendererRuntime/Core/File/IFileManager.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
 #include <imguizmo/ImGuizmo.h>
@@ -127,6 +129,91 @@ namespace
 			}
 		}
 
+		#ifdef RENDERER_DEBUG
+			void drawCpuProfilerTimeline(const RendererRuntime::IRendererRuntime& rendererRuntime)
+			{
+				// Gather the events of the last completed frame
+				// -> Since this debugging code isn't performance critical we're using a static event list to avoid memory allocations each frame
+				static RendererRuntime::CpuProfiler::Events events;
+				uint64_t frameBeginNanoseconds = 0;
+				uint64_t frameEndNanoseconds = 0;
+				if (!RendererRuntime::CpuProfiler::getLastFrameEvents(events, frameBeginNanoseconds, frameEndNanoseconds) || frameEndNanoseconds <= frameBeginNanoseconds)
+				{
+					ImGui::Text("No CPU profiler frame recorded, yet");
+					return;
+				}
+				const float frameMilliseconds = static_cast<float>(frameEndNanoseconds - frameBeginNanoseconds) * 0.000001f;
+				ImGui::Text("Last frame %.3f ms, %d events", frameMilliseconds, events.size());
+
+				// Chrome trace export, see "RendererRuntime::CpuProfiler::writeChromeTrace()"
+				{
+					const RendererRuntime::IFileManager& fileManager = rendererRuntime.getFileManager();
+					const char* localDataMountPoint = fileManager.getLocalDataMountPoint();
+					if (nullptr != localDataMountPoint)
+					{
+						ImGui::SameLine();
+						if (ImGui::Button("Write Chrome trace"))
+						{
+							const std::string virtualDebugGuiDirectoryName = std::string(localDataMountPoint) + "/DebugGui";
+							if (fileManager.createDirectories(virtualDebugGuiDirectoryName.c_str()))
+							{
+								RendererRuntime::CpuProfiler::writeChromeTrace(fileManager, (virtualDebugGuiDirectoryName + "/UnrimpCpuProfilerTrace.json").c_str());
+							}
+						}
+					}
+				}
+
+				// Get the timeline layout: One lane per thread, one row per nesting depth inside a lane
+				static const float ROW_HEIGHT = 16.0f;
+				uint32_t numberOfRowsPerThread[RendererRuntime::CpuProfiler::MAXIMUM_NUMBER_OF_THREADS] = {};
+				for (const RendererRuntime::CpuProfiler::Event& event : events)
+				{
+					if (numberOfRowsPerThread[event.threadIndex] <= event.depth)
+					{
+						numberOfRowsPerThread[event.threadIndex] = event.depth + 1;
+					}
+				}
+				float laneOffsets[RendererRuntime::CpuProfiler::MAXIMUM_NUMBER_OF_THREADS] = {};
+				float timelineHeight = 0.0f;
+				const uint32_t numberOfThreads = RendererRuntime::CpuProfiler::getNumberOfThreads();
+				for (uint32_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex)
+				{
+					laneOffsets[threadIndex] = timelineHeight;
+					if (numberOfRowsPerThread[threadIndex] > 0)
+					{
+						timelineHeight += static_cast<float>(numberOfRowsPerThread[threadIndex]) * ROW_HEIGHT + 4.0f;
+					}
+				}
+
+				// Draw the timeline
+				const ImVec2 timelinePosition = ImGui::GetCursorScreenPos();
+				const float timelineWidth = std::max(ImGui::GetContentRegionAvailWidth(), 1.0f);
+				ImDrawList* imDrawList = ImGui::GetWindowDrawList();
+				imDrawList->AddRectFilled(timelinePosition, ImVec2(timelinePosition.x + timelineWidth, timelinePosition.y + timelineHeight), IM_COL32(32, 32, 32, 255));
+				const float pixelsPerNanosecond = timelineWidth / static_cast<float>(frameEndNanoseconds - frameBeginNanoseconds);
+				for (const RendererRuntime::CpuProfiler::Event& event : events)
+				{
+					const ImVec2 minimum(timelinePosition.x + static_cast<float>(event.beginNanoseconds - frameBeginNanoseconds) * pixelsPerNanosecond, timelinePosition.y + laneOffsets[event.threadIndex] + static_cast<float>(event.depth) * ROW_HEIGHT);
+					const ImVec2 maximum(std::max(timelinePosition.x + static_cast<float>(event.endNanoseconds - frameBeginNanoseconds) * pixelsPerNanosecond, minimum.x + 1.0f), minimum.y + ROW_HEIGHT - 1.0f);
+
+					// Derive a stable color from the static event name pointer
+					const float hue = static_cast<float>((reinterpret_cast<uintptr_t>(event.name) >> 4) % 64) / 64.0f;
+					imDrawList->AddRectFilled(minimum, maximum, ImColor::HSV(hue, 0.6f, 0.7f));
+					if (maximum.x - minimum.x > 32.0f)
+					{
+						imDrawList->PushClipRect(minimum, maximum, true);
+						imDrawList->AddText(ImVec2(minimum.x + 2.0f, minimum.y + 1.0f), IM_COL32_WHITE, event.name);
+						imDrawList->PopClipRect();
+					}
+					if (ImGui::IsMouseHoveringRect(minimum, maximum))
+					{
+						ImGui::SetTooltip("%s\nThread %d\n%.3f ms", event.name, event.threadIndex, static_cast<float>(event.endNanoseconds - event.beginNanoseconds) * 0.000001f);
+					}
+				}
+				ImGui::Dummy(ImVec2(timelineWidth, timelineHeight));
+			}
+		#endif
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -394,7 +481,10 @@ namespace RendererRuntime
 						"ExecuteCommandBuffer",
 						"SetGraphicsRootSignature",
 						"SetGraphicsResourceGroup",
+						"SetComputeRootSignature",
+						"SetComputeResourceGroup",
 						"SetPipelineState",
+						"SetComputePipelineState",
 						"SetVertexArray",
 						"SetViewports",
 						"SetScissorRectangles",
@@ -404,6 +494,7 @@ namespace RendererRuntime
 						"CopyResource",
 						"Draw",
 						"DrawIndexed",
+						"DispatchCompute",
 						"SetDebugMarker",
 						"BeginDebugEvent",
 						"EndDebugEvent"
@@ -416,6 +507,15 @@ namespace RendererRuntime
 				}
 			}
 
+			// CPU profiler timeline of the last completed frame
+			#ifdef RENDERER_DEBUG
+				if (ImGui::TreeNode("CpuProfiler", "CPU profiler"))
+				{
+					::detail::drawCpuProfilerTimeline(compositorWorkspaceInstance->getRendererRuntime());
+					ImGui::TreePop();
+				}
+			#endif
+
 			// Renderer statistics
 			#ifndef RENDERER_NO_STATISTICS
 				const Renderer::Statistics& statistics = compositorWorkspaceInstance->getRendererRuntime().getRenderer().getStatistics();
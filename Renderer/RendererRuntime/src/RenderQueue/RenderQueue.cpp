@@ -33,7 +33,9 @@
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/LightBufferManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/InstanceBufferManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/IndirectBufferManager.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/GpuCullingManager.h"
 #include "RendererRuntime/Core/Math/Transform.h"
+#include "RendererRuntime/Core/Time/CpuProfiler.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
 #include <array>
@@ -52,7 +54,8 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global definitions                                    ]
 		//[-------------------------------------------------------]
-		const int DepthBits = 15;
+		const int   DepthBits     = 15;
+		const float LodHysteresis = 0.1f;	///< Relative projected screen size band around a LOD switch threshold, avoids LOD popping when an object hovers around a threshold
 
 
 		//[-------------------------------------------------------]
@@ -78,6 +81,26 @@ namespace
 			return (f2i.i >> (32 - DepthBits));	// Take highest n-bits
 		}
 
+		uint8_t selectLodIndex(const RendererRuntime::RenderableManager& renderableManager)
+		{
+			// The projected screen size was calculated during the culling phase, the previously selected LOD is the starting point for hysteresis
+			// -> Switch to a coarser LOD only if the screen size is clearly below the minimum screen size of the current LOD
+			// -> Switch to a finer LOD only if the screen size is clearly above the minimum screen size of the finer LOD
+			const uint8_t numberOfLods = renderableManager.getNumberOfLods();
+			const RendererRuntime::RenderableManager::LodMinimumScreenSizes& lodMinimumScreenSizes = renderableManager.getLodMinimumScreenSizes();
+			const float projectedScreenSize = renderableManager.getCachedProjectedScreenSize();
+			uint8_t lodIndex = renderableManager.getCachedLodIndex();
+			while (lodIndex + 1 < numberOfLods && projectedScreenSize < lodMinimumScreenSizes[lodIndex] * (1.0f - LodHysteresis))
+			{
+				++lodIndex;
+			}
+			while (lodIndex > 0 && projectedScreenSize > lodMinimumScreenSizes[lodIndex - 1u] * (1.0f + LodHysteresis))
+			{
+				--lodIndex;
+			}
+			return lodIndex;
+		}
+
 		inline void setShaderPropertiesPropertyValue(RendererRuntime::MaterialPropertyId materialPropertyId, const RendererRuntime::MaterialPropertyValue& materialPropertyValue, RendererRuntime::ShaderProperties& shaderProperties)
 		{
 			switch (materialPropertyValue.getValueType())
@@ -240,6 +263,7 @@ namespace RendererRuntime
 		mNumberOfNullDrawCalls(0),
 		mNumberOfDrawIndexedInstancedCalls(0),
 		mNumberOfDrawInstancedCalls(0),
+		mNumberOfTriangles(0),
 		mMinimumRenderQueueIndex(minimumRenderQueueIndex),
 		mMaximumRenderQueueIndex(maximumRenderQueueIndex),
 		mTransparentPass(transparentPass),
@@ -258,7 +282,7 @@ namespace RendererRuntime
 				queue.queuedRenderables.clear();
 				queue.sorted = false;
 			}
-			mNumberOfNullDrawCalls = mNumberOfDrawIndexedInstancedCalls = mNumberOfDrawInstancedCalls = 0;
+			mNumberOfNullDrawCalls = mNumberOfDrawIndexedInstancedCalls = mNumberOfDrawInstancedCalls = mNumberOfTriangles = 0;
 		}
 	}
 
@@ -270,9 +294,22 @@ namespace RendererRuntime
 		// Quantize the cached distance to camera
 		const uint32_t quantizedDepth = ::detail::depthToBits(renderableManager.getCachedDistanceToCamera());
 
+		// Select the level of detail (LOD), the renderables are stored LOD-major
+		const RenderableManager::Renderables& renderables = renderableManager.getRenderables();
+		size_t firstRenderableIndex = 0;
+		size_t numberOfRenderables = renderables.size();
+		if (renderableManager.getNumberOfLods() > 1)
+		{
+			const uint8_t lodIndex = ::detail::selectLodIndex(renderableManager);
+			const_cast<RenderableManager&>(renderableManager).setCachedLodIndex(lodIndex);	// TODO(co) Get rid of the evil const-cast
+			numberOfRenderables = renderableManager.getNumberOfRenderablesPerLod();
+			firstRenderableIndex = lodIndex * numberOfRenderables;
+		}
+
 		// Register the renderables inside our renderables queue
-		for (const Renderable& renderable : renderableManager.getRenderables())
+		for (size_t renderableIndex = firstRenderableIndex; renderableIndex < firstRenderableIndex + numberOfRenderables; ++renderableIndex)
 		{
+			const Renderable& renderable = renderables[renderableIndex];
 			if (!castShadows || renderable.getCastShadows())
 			{
 				// It's valid if one or more renderables inside a renderable manager don't fall into the range processed by this render queue
@@ -294,6 +331,7 @@ namespace RendererRuntime
 					queue.queuedRenderables.emplace_back(renderable, sortingKey);
 					if (0 != renderable.getNumberOfIndices())
 					{
+						mNumberOfTriangles += renderable.getNumberOfIndices() / 3;
 						if (renderable.getDrawIndexed())
 						{
 							++mNumberOfDrawIndexedInstancedCalls;
@@ -318,8 +356,8 @@ namespace RendererRuntime
 		assert((getNumberOfDrawCalls() > 0) && "Don't call the fill command buffer method if there's no work to be done");
 		assert(mScratchCommandBuffer.isEmpty() && "Scratch command buffer should be empty at this point in time");
 
-		// Begin debug event
-		COMMAND_BEGIN_DEBUG_EVENT_FUNCTION(commandBuffer)
+		// Begin CPU profiler and debug event, ends with the scope
+		RENDERER_RUNTIME_CPU_PROFILER_COMMAND_BUFFER_SCOPE(commandBuffer, __FUNCTION__)
 
 		// TODO(co) This is just a dummy implementation. For example automatic instancing has to be incorporated as well as more efficient buffer management.
 		const MaterialResourceManager& materialResourceManager = mRendererRuntime.getMaterialResourceManager();
@@ -339,13 +377,21 @@ namespace RendererRuntime
 		// that pass data like world space to clip space transform might have been changed and needs to be updated inside the pass uniform buffer
 		bool enforcePassBufferManagerFillBuffer = true;
 
+		// Use GPU culling for indexed draws, if enabled and if there's enough space left
+		// -> The draw arguments are handed over to the GPU culling manager which writes the visible ones compacted into its own indirect buffer
+		GpuCullingManager& gpuCullingManager = materialBlueprintResourceManager.getGpuCullingManager();
+		const bool gpuCulling = (mNumberOfDrawIndexedInstancedCalls > 0 && gpuCullingManager.isEnabled() && gpuCullingManager.hasCapacity(mNumberOfDrawIndexedInstancedCalls));
+		const uint32_t numberOfCpuDrawIndexedInstancedCalls = gpuCulling ? 0 : mNumberOfDrawIndexedInstancedCalls;
+		uint32_t currentGpuCullingBatchIndex = 0;
+		uint32_t currentGpuCullingFirstDrawIndex = 0;
+
 		// Get indirect buffer
 		Renderer::IIndirectBuffer* indirectBuffer = nullptr;
 		uint32_t indirectBufferOffset = 0;
 		uint8_t* indirectBufferData = nullptr;
-		if (mNumberOfDrawIndexedInstancedCalls > 0 || mNumberOfDrawInstancedCalls > 0 )
+		if (numberOfCpuDrawIndexedInstancedCalls > 0 || mNumberOfDrawInstancedCalls > 0 )
 		{
-			IndirectBufferManager::IndirectBuffer* managedIndirectBuffer = mIndirectBufferManager.getIndirectBuffer(sizeof(Renderer::DrawIndexedInstancedArguments) * mNumberOfDrawIndexedInstancedCalls + sizeof(Renderer::DrawInstancedArguments) * mNumberOfDrawInstancedCalls);
+			IndirectBufferManager::IndirectBuffer* managedIndirectBuffer = mIndirectBufferManager.getIndirectBuffer(sizeof(Renderer::DrawIndexedInstancedArguments) * numberOfCpuDrawIndexedInstancedCalls + sizeof(Renderer::DrawInstancedArguments) * mNumberOfDrawInstancedCalls);
 			assert(nullptr != managedIndirectBuffer);
 			indirectBuffer		 = managedIndirectBuffer->indirectBuffer;
 			indirectBufferOffset = managedIndirectBuffer->indirectBufferOffset;
@@ -478,7 +524,14 @@ namespace RendererRuntime
 										{
 											if (currentNumberOfDraws)
 											{
-												Renderer::Command::DrawIndexed::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+												if (gpuCulling)
+												{
+													Renderer::Command::DrawIndexedIndirectCount::create(commandBuffer, gpuCullingManager.getDrawIndirectBuffer(), currentGpuCullingFirstDrawIndex * static_cast<uint32_t>(sizeof(Renderer::DrawIndexedInstancedArguments)), gpuCullingManager.getCountIndirectBuffer(), currentGpuCullingBatchIndex * static_cast<uint32_t>(sizeof(uint32_t)), currentNumberOfDraws);
+												}
+												else
+												{
+													Renderer::Command::DrawIndexed::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+												}
 												currentNumberOfDraws = 0;
 											}
 										}
@@ -503,13 +556,22 @@ namespace RendererRuntime
 									// -> Please note that it's valid that there are no indices, for example "RendererRuntime::CompositorInstancePassDebugGui" is using the render queue only to set the material resource blueprint
 									if (0 != renderable.getNumberOfIndices())
 									{
-										// Sanity checks
-										assert(nullptr != indirectBuffer);
-										assert(nullptr != indirectBufferData);
-
-										// Fill indirect buffer
-										if (renderable.getDrawIndexed())
+										if (gpuCulling && renderable.getDrawIndexed())
 										{
+											// Hand over the draw to the GPU culling manager, a new batch starts with each new multi-draw-indirect command
+											if (0 == currentNumberOfDraws)
+											{
+												gpuCullingManager.beginBatch(currentGpuCullingBatchIndex, currentGpuCullingFirstDrawIndex);
+											}
+											gpuCullingManager.addDraw(Renderer::DrawIndexedInstancedArguments(renderable.getNumberOfIndices(), instanceCount * renderable.getInstanceCount(), renderable.getStartIndexLocation(), 0, startInstanceLocation), renderable.getRenderableManager().getCachedWorldSpaceBoundingSphere(), renderable.getRenderableManager().getCachedWorldSpaceOrientedBoundingBox());
+											currentDrawIndexed = true;
+										}
+										else if (renderable.getDrawIndexed())
+										{
+											// Sanity checks
+											assert(nullptr != indirectBuffer);
+											assert(nullptr != indirectBufferData);
+
 											// Fill indirect buffer
 											Renderer::DrawIndexedInstancedArguments* drawIndexedInstancedArguments = reinterpret_cast<Renderer::DrawIndexedInstancedArguments*>(indirectBufferData + indirectBufferOffset);
 											drawIndexedInstancedArguments->indexCountPerInstance = renderable.getNumberOfIndices();
@@ -524,6 +586,10 @@ namespace RendererRuntime
 										}
 										else
 										{
+											// Sanity checks
+											assert(nullptr != indirectBuffer);
+											assert(nullptr != indirectBufferData);
+
 											// Fill indirect buffer
 											Renderer::DrawInstancedArguments* drawInstancedArguments = reinterpret_cast<Renderer::DrawInstancedArguments*>(indirectBufferData + indirectBufferOffset);
 											drawInstancedArguments->vertexCountPerInstance = renderable.getNumberOfIndices();
@@ -550,16 +616,20 @@ namespace RendererRuntime
 		{
 			if (currentDrawIndexed)
 			{
-				Renderer::Command::DrawIndexed::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+				if (gpuCulling)
+				{
+					Renderer::Command::DrawIndexedIndirectCount::create(commandBuffer, gpuCullingManager.getDrawIndirectBuffer(), currentGpuCullingFirstDrawIndex * static_cast<uint32_t>(sizeof(Renderer::DrawIndexedInstancedArguments)), gpuCullingManager.getCountIndirectBuffer(), currentGpuCullingBatchIndex * static_cast<uint32_t>(sizeof(uint32_t)), currentNumberOfDraws);
+				}
+				else
+				{
+					Renderer::Command::DrawIndexed::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+				}
 			}
 			else
 			{
 				Renderer::Command::Draw::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
 			}
 		}
-
-		// End debug event
-		COMMAND_END_DEBUG_EVENT(commandBuffer)
 	}
 
 
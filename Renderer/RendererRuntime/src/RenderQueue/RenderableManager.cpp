@@ -25,6 +25,8 @@
 #include "RendererRuntime/RenderQueue/RenderableManager.h"
 #include "RendererRuntime/Core/Math/Transform.h"
 
+#include <limits>
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -61,12 +63,17 @@ namespace RendererRuntime
 	RenderableManager::RenderableManager() :
 		mTransform(&::detail::IdentityTransform),
 		mVisible(true),
+		mNumberOfLods(1),
 		mCachedDistanceToCamera(getUninitialized<float>()),
+		mCachedProjectedScreenSize(std::numeric_limits<float>::max()),
+		mCachedLodIndex(0),
 		mMinimumRenderQueueIndex(0),
 		mMaximumRenderQueueIndex(0),
 		mCastShadows(false)
 	{
-		// Nothing here
+		// By default, the renderable manager can't be culled
+		setCachedWorldSpaceBoundingSphere(0.0f, 0.0f, 0.0f, -1.0f);
+		memset(mCachedWorldSpaceOrientedBoundingBox, 0, sizeof(mCachedWorldSpaceOrientedBoundingBox));
 	}
 
 	void RenderableManager::setTransform(const Transform* transform)
@@ -74,6 +81,35 @@ namespace RendererRuntime
 		mTransform = (nullptr != transform) ? transform : &::detail::IdentityTransform;
 	}
 
+	void RenderableManager::setLods(uint8_t numberOfLods, const float* lodMinimumScreenSizes)
+	{
+		// Sanity checks
+		assert(numberOfLods > 0);
+		assert(1 == numberOfLods || nullptr != lodMinimumScreenSizes);
+
+		// Set LOD chain, the first LOD is used until the LOD selection says otherwise
+		mNumberOfLods = numberOfLods;
+		if (numberOfLods > 1)
+		{
+			mLodMinimumScreenSizes.assign(lodMinimumScreenSizes, lodMinimumScreenSizes + numberOfLods);
+		}
+		else
+		{
+			mLodMinimumScreenSizes.clear();
+		}
+		mCachedLodIndex = 0;
+	}
+
+	void RenderableManager::setInstanceCustomParameters(uint32_t numberOfFloats, const float* instanceCustomParameters)
+	{
+		// Sanity checks
+		assert((0 == numberOfFloats % 4) && "The instance texture buffer is working with float4");
+		assert(0 == numberOfFloats || nullptr != instanceCustomParameters);
+
+		// Set instance custom parameters
+		mInstanceCustomParameters.assign(instanceCustomParameters, instanceCustomParameters + numberOfFloats);
+	}
+
 	void RenderableManager::updateCachedRenderablesData()
 	{
 		if (mRenderables.empty())
@@ -57,11 +57,19 @@ namespace RendererRuntime
 		}
 	}
 
-	Renderer::IRenderTarget& CompositorNodeInstance::fillCommandBuffer(Renderer::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Renderer::CommandBuffer& commandBuffer) const
+	Renderer::IRenderTarget& CompositorNodeInstance::fillCommandBuffer(Renderer::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Renderer::CommandBuffer& commandBuffer, Renderer::IQueryPool* timestampQueryPool, uint32_t& timestampQueryIndex) const
 	{
 		Renderer::IRenderTarget* currentRenderTarget = &renderTarget;
 		for (ICompositorInstancePass* compositorInstancePass : mCompositorInstancePasses)
 		{
+			// Begin GPU timing of the compositor instance pass
+			// -> Skipped compositor instance passes are timed as well so the timestamp query indices stay fixed
+			if (nullptr != timestampQueryPool)
+			{
+				Renderer::Command::WriteTimestampQuery::create(commandBuffer, *timestampQueryPool, timestampQueryIndex);
+				++timestampQueryIndex;
+			}
+
 			// Check whether or not to execute the compositor pass instance
 			const ICompositorResourcePass& compositorResourcePass = compositorInstancePass->getCompositorResourcePass();
 			if ((!compositorResourcePass.getSkipFirstExecution() || compositorInstancePass->mNumberOfExecutionRequests > 0) &&
@@ -95,6 +103,13 @@ namespace RendererRuntime
 				compositorInstancePass->onFillCommandBuffer(*currentRenderTarget, compositorContextData, commandBuffer);
 			}
 
+			// End GPU timing of the compositor instance pass
+			if (nullptr != timestampQueryPool)
+			{
+				Renderer::Command::WriteTimestampQuery::create(commandBuffer, *timestampQueryPool, timestampQueryIndex);
+				++timestampQueryIndex;
+			}
+
 			// Update the number of compositor instance pass execution requests and don't forget to avoid integer range overflow
 			if (compositorInstancePass->mNumberOfExecutionRequests < std::numeric_limits<uint32_t>::max())
 			{
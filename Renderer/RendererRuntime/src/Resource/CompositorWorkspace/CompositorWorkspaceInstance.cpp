@@ -47,6 +47,7 @@
 #include "RendererRuntime/Resource/Scene/Culling/SceneCullingManager.h"
 #include "RendererRuntime/Core/Renderer/FramebufferManager.h"
 #include "RendererRuntime/Core/Renderer/RenderTargetTextureManager.h"
+#include "RendererRuntime/Core/Time/CpuProfiler.h"
 #include "RendererRuntime/Vr/IVrManager.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
@@ -73,7 +74,9 @@ namespace RendererRuntime
 		mExecutionRenderTarget(nullptr),
 		mCompositorWorkspaceResourceId(getUninitialized<CompositorWorkspaceResourceId>()),
 		mFramebufferManagerInitialized(false),
-		mCompositorInstancePassShadowMap(nullptr)
+		mCompositorInstancePassShadowMap(nullptr),
+		mGpuTimingsEnabled(false),
+		mNumberOfGpuTimingFrames(0)
 	{
 		rendererRuntime.getCompositorWorkspaceResourceManager().loadCompositorWorkspaceResourceByAssetId(compositorWorkspaceAssetId, mCompositorWorkspaceResourceId, this);
 	}
@@ -94,6 +97,23 @@ namespace RendererRuntime
 		mNumberOfMultisamples = numberOfMultisamples;
 	}
 
+	void CompositorWorkspaceInstance::setGpuTimingsEnabled(bool gpuTimingsEnabled)
+	{
+		// GPU timings require timestamp query support by the renderer backend
+		if (gpuTimingsEnabled && !mRendererRuntime.getRenderer().getCapabilities().timestampQuery)
+		{
+			gpuTimingsEnabled = false;
+		}
+		if (mGpuTimingsEnabled != gpuTimingsEnabled)
+		{
+			mGpuTimingsEnabled = gpuTimingsEnabled;
+			if (!mGpuTimingsEnabled)
+			{
+				destroyGpuTimings();
+			}
+		}
+	}
+
 	const CompositorWorkspaceInstance::RenderQueueIndexRange* CompositorWorkspaceInstance::getRenderQueueIndexRangeByRenderQueueIndex(uint8_t renderQueueIndex) const
 	{
 		for (const RenderQueueIndexRange& renderQueueIndexRange : mRenderQueueIndexRanges)
@@ -144,6 +164,8 @@ namespace RendererRuntime
 
 	void CompositorWorkspaceInstance::execute(Renderer::IRenderTarget& renderTarget, const CameraSceneItem* cameraSceneItem, const LightSceneItem* lightSceneItem, bool singlePassStereoInstancing)
 	{
+		RENDERER_RUNTIME_CPU_PROFILER_SCOPE_FUNCTION()
+
 		// Clear the command buffer from the previous frame
 		mCommandBuffer.clear();
 
@@ -209,34 +231,40 @@ namespace RendererRuntime
 				const CompositorContextData compositorContextData(this, cameraSceneItem, singlePassStereoInstancing, lightSceneItem, mCompositorInstancePassShadowMap);
 				if (nullptr != cameraSceneItem)
 				{
+					// Derive the global transforms of all scene nodes which have been changed since the last update
+					cameraSceneItem->getSceneResource().updateGlobalTransforms();
+
 					// Gather render queue index ranges renderable managers
 					cameraSceneItem->getSceneResource().getSceneCullingManager().gatherRenderQueueIndexRangesRenderableManagers(renderTarget, compositorContextData, mRenderQueueIndexRanges);
 
 					// Fill the light buffer manager
-					materialBlueprintResourceManager.getLightBufferManager().fillBuffer(cameraSceneItem->getSceneResource(), mCommandBuffer);
+					materialBlueprintResourceManager.getLightBufferManager().fillBuffer(renderTarget, compositorContextData, mCommandBuffer);
 				}
 
-				// Begin debug event
-				COMMAND_BEGIN_DEBUG_EVENT_FUNCTION(mCommandBuffer)
+				{ // Begin CPU profiler and debug event, ends with the scope
+					RENDERER_RUNTIME_CPU_PROFILER_COMMAND_BUFFER_SCOPE(mCommandBuffer, __FUNCTION__)
 
-				// Set the current render target
-				Renderer::Command::SetRenderTarget::create(mCommandBuffer, &renderTarget);
+					// Begin GPU timings, if enabled
+					// -> Must be done before the first render target is set since resetting timestamp queries isn't allowed inside a Vulkan render pass
+					uint32_t timestampQueryIndex = 0;
+					Renderer::IQueryPool* timestampQueryPool = mGpuTimingsEnabled ? beginGpuTimings(renderer, timestampQueryIndex) : nullptr;
 
-				// Set the viewport and scissor rectangle
-				// -> Since Direct3D 12 is command list based, the viewport and scissor rectangle must be set in every draw call to work with all supported renderer APIs
-				Renderer::Command::SetViewportAndScissorRectangle::create(mCommandBuffer, 0, 0, renderTargetWidth, renderTargetHeight);
+					// Set the current render target
+					Renderer::Command::SetRenderTarget::create(mCommandBuffer, &renderTarget);
 
-				{ // Fill command buffer
-					Renderer::IRenderTarget* currentRenderTarget = &renderTarget;
-					for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
-					{
-						currentRenderTarget = &compositorNodeInstance->fillCommandBuffer(*currentRenderTarget, compositorContextData, mCommandBuffer);
+					// Set the viewport and scissor rectangle
+					// -> Since Direct3D 12 is command list based, the viewport and scissor rectangle must be set in every draw call to work with all supported renderer APIs
+					Renderer::Command::SetViewportAndScissorRectangle::create(mCommandBuffer, 0, 0, renderTargetWidth, renderTargetHeight);
+
+					{ // Fill command buffer
+						Renderer::IRenderTarget* currentRenderTarget = &renderTarget;
+						for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+						{
+							currentRenderTarget = &compositorNodeInstance->fillCommandBuffer(*currentRenderTarget, compositorContextData, mCommandBuffer, timestampQueryPool, timestampQueryIndex);
+						}
 					}
 				}
 
-				// End debug event
-				COMMAND_END_DEBUG_EVENT(mCommandBuffer)
-
 				{ // Submit command buffer to the renderer backend
 					// The command buffer is about to be submitted, inform everyone who cares about this
 					materialBlueprintResourceManager.onPreCommandBufferExecution();
@@ -266,6 +294,12 @@ namespace RendererRuntime
 				// -> Required for Direct3D 9 and Direct3D 12
 				// -> Not required for Direct3D 10, Direct3D 11, OpenGL and OpenGL ES 3
 				renderer.endScene();
+
+				// End GPU timings, if there are any
+				if (nullptr != mTimestampQueryPool)
+				{
+					endGpuTimings(renderer);
+				}
 			}
 
 			// In case the render target is a swap chain, present the content of the current back buffer
@@ -425,6 +459,9 @@ namespace RendererRuntime
 		mRenderQueueIndexRanges.clear();
 		mCompositorInstancePassShadowMap = nullptr;
 
+		// The GPU timings reference the compositor instance passes
+		destroyGpuTimings();
+
 		// Destroy framebuffers and render target textures
 		destroyFramebuffersAndRenderTargetTextures();
 	}
@@ -475,6 +512,74 @@ namespace RendererRuntime
 		}
 	}
 
+	Renderer::IQueryPool* CompositorWorkspaceInstance::beginGpuTimings(Renderer::IRenderer& renderer, uint32_t& timestampQueryIndex)
+	{
+		// Create the timestamp query pool, if necessary
+		if (nullptr == mTimestampQueryPool)
+		{
+			// Gather the sequential compositor instance passes, they're fixed until the compositor workspace resource changes
+			for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+			{
+				for (const ICompositorInstancePass* compositorInstancePass : compositorNodeInstance->mCompositorInstancePasses)
+				{
+					mCompositorInstancePassGpuTimings.emplace_back(compositorInstancePass, 0);
+				}
+			}
+			if (mCompositorInstancePassGpuTimings.empty())
+			{
+				// Nothing to time
+				return nullptr;
+			}
+
+			// Two timestamp queries per compositor instance pass and frame
+			mTimestampQueryResults.resize(mCompositorInstancePassGpuTimings.size() * 2);
+			// -> "setGpuTimingsEnabled()" ensured that the renderer backend has timestamp query support
+			mTimestampQueryPool = renderer.createQueryPool(Renderer::QueryType::TIMESTAMP, static_cast<uint32_t>(mTimestampQueryResults.size()) * NUMBER_OF_GPU_TIMING_FRAMES);
+			assert(nullptr != mTimestampQueryPool);
+			RENDERER_SET_RESOURCE_DEBUG_NAME(mTimestampQueryPool, "Compositor workspace instance GPU timings")
+		}
+
+		// Reset the timestamp queries of the current frame
+		const uint32_t numberOfTimestampQueriesPerFrame = static_cast<uint32_t>(mTimestampQueryResults.size());
+		timestampQueryIndex = (mNumberOfGpuTimingFrames % NUMBER_OF_GPU_TIMING_FRAMES) * numberOfTimestampQueriesPerFrame;
+		Renderer::Command::ResetQueryPool::create(mCommandBuffer, *mTimestampQueryPool, timestampQueryIndex, numberOfTimestampQueriesPerFrame);
+
+		// Done
+		return mTimestampQueryPool;
+	}
+
+	void CompositorWorkspaceInstance::endGpuTimings(Renderer::IRenderer& renderer)
+	{
+		// The current frame has been recorded
+		++mNumberOfGpuTimingFrames;
+
+		// Read back the timestamp queries of the oldest recorded frame, its timestamp queries are going to be reset by the next frame
+		// -> Don't wait for the results, if they're not available, yet, the previous GPU timings are kept
+		if (mNumberOfGpuTimingFrames >= NUMBER_OF_GPU_TIMING_FRAMES)
+		{
+			const uint32_t numberOfTimestampQueriesPerFrame = static_cast<uint32_t>(mTimestampQueryResults.size());
+			const uint32_t firstTimestampQueryIndex = (mNumberOfGpuTimingFrames % NUMBER_OF_GPU_TIMING_FRAMES) * numberOfTimestampQueriesPerFrame;
+			if (renderer.getQueryPoolResults(*mTimestampQueryPool, numberOfTimestampQueriesPerFrame * sizeof(uint64_t), reinterpret_cast<uint8_t*>(mTimestampQueryResults.data()), firstTimestampQueryIndex, numberOfTimestampQueriesPerFrame))
+			{
+				const size_t numberOfCompositorInstancePassGpuTimings = mCompositorInstancePassGpuTimings.size();
+				for (size_t i = 0; i < numberOfCompositorInstancePassGpuTimings; ++i)
+				{
+					const uint64_t beginNanoseconds = mTimestampQueryResults[i * 2];
+					const uint64_t endNanoseconds = mTimestampQueryResults[i * 2 + 1];
+					mCompositorInstancePassGpuTimings[i].nanoseconds = (endNanoseconds > beginNanoseconds) ? (endNanoseconds - beginNanoseconds) : 0;
+				}
+			}
+		}
+	}
+
+	void CompositorWorkspaceInstance::destroyGpuTimings()
+	{
+		mTimestampQueryPool = nullptr;
+		mNumberOfGpuTimingFrames = 0;
+		mTimestampQueryResults.clear();
+		mCompositorInstancePassGpuTimings.clear();
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
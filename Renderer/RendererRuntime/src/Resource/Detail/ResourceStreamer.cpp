@@ -26,6 +26,7 @@
 #include "RendererRuntime/Resource/Detail/IResourceLoader.h"
 #include "RendererRuntime/Resource/Detail/IResourceManager.h"
 #include "RendererRuntime/Core/Platform/PlatformManager.h"
+#include "RendererRuntime/Core/Time/CpuProfiler.h"
 #include "RendererRuntime/Core/File/IFileManager.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
@@ -107,6 +108,8 @@ namespace RendererRuntime
 
 	void ResourceStreamer::dispatch()
 	{
+		RENDERER_RUNTIME_CPU_PROFILER_SCOPE_FUNCTION()
+
 		// Resource streamer stage: 3. Synchronous dispatch to e.g. the renderer backend
 
 		// Continue as long as there's a load request left inside the queue
@@ -255,6 +258,7 @@ namespace RendererRuntime
 				if (nullptr != loadRequest.resourceLoader)
 				{
 					deserializationMutexLock.unlock();
+					RENDERER_RUNTIME_CPU_PROFILER_SCOPE("Resource streamer deserialization")
 					loadRequest.resourceLoader->initialize(*loadRequest.asset, loadRequest.reload, loadRequest.getResource());
 
 					// Do the work
@@ -307,7 +311,10 @@ namespace RendererRuntime
 				processingMutexLock.unlock();
 
 				// Do the work
-				loadRequest.resourceLoader->onProcessing();
+				{
+					RENDERER_RUNTIME_CPU_PROFILER_SCOPE("Resource streamer processing")
+					loadRequest.resourceLoader->onProcessing();
+				}
 
 				{ // Push the load request into the queue of the next resource streamer pipeline stage
 				  // -> Resource streamer stage: 3. Synchronous dispatch to e.g. the renderer backend
@@ -0,0 +1,150 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Shader start                                          ]
+//[-------------------------------------------------------]
+#ifndef RENDERER_NO_OPENGL
+if (0 == strcmp(renderer.getName(), "OpenGL"))
+{
+
+
+//[-------------------------------------------------------]
+//[ Compute shader source code                            ]
+//[-------------------------------------------------------]
+// One compute shader invocation per draw
+computeShaderSourceCode = R"(#version 430 core	// OpenGL 4.3
+
+// Input
+layout(local_size_x = 64) in;
+
+// Uniforms
+layout(r32ui) uniform readonly  uimageBuffer DrawRecordTextureBuffer;
+layout(r32ui) uniform writeonly uimageBuffer DrawIndirectBuffer;
+layout(r32ui) uniform			uimageBuffer DrawCountBuffer;
+
+// Draw record texture buffer layout, all values are 32-bit unsigned integers, floating point values are stored as bit pattern to not be affected by denormal flushing
+// - Header: Six world space frustum planes (normal xyz pointing into the frustum, distance w), column-major world space to clip space matrix, number of draws, frustum culling enabled, two padding values
+// - Per draw 24 values: World space bounding sphere (center xyz, radius w; a negative radius means the draw can't be culled), world space object-oriented bounding box (center xyz followed by the three half axes),
+//   the five draw indexed instanced arguments, batch index, index of the first draw of the batch, padding
+const int HEADER_WORLD_SPACE_TO_CLIP_SPACE_MATRIX = 24;
+const int HEADER_NUMBER_OF_DRAWS = 40;
+const int HEADER_FRUSTUM_CULLING = 41;
+const int HEADER_NUMBER_OF_VALUES = 44;
+const int DRAW_RECORD_ORIENTED_BOUNDING_BOX = 4;
+const int DRAW_RECORD_DRAW_ARGUMENTS = 16;
+const int DRAW_RECORD_BATCH_INDEX = 21;
+const int DRAW_RECORD_FIRST_DRAW_INDEX = 22;
+const int DRAW_RECORD_NUMBER_OF_VALUES = 24;
+
+// Functions
+uint loadValue(int index)
+{
+	return imageLoad(DrawRecordTextureBuffer, index).x;
+}
+
+float loadFloatValue(int index)
+{
+	return uintBitsToFloat(loadValue(index));
+}
+
+vec3 loadVec3Value(int index)
+{
+	return vec3(loadFloatValue(index), loadFloatValue(index + 1), loadFloatValue(index + 2));
+}
+
+vec4 loadVec4Value(int index)
+{
+	return vec4(loadFloatValue(index), loadFloatValue(index + 1), loadFloatValue(index + 2), loadFloatValue(index + 3));
+}
+
+// Frustum-sphere test, matches the sphere test of the CPU scene culling manager
+bool isSphereVisible(vec3 center, float radius)
+{
+	for (int plane = 0; plane < 6; ++plane)
+	{
+		if (dot(loadVec3Value(plane * 4), center) + loadFloatValue(plane * 4 + 3) <= -radius)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Frustum-OOBB test, matches the OOBB test of the CPU scene culling manager: The OOBB is culled if all eight corners are outside of the same clip space plane
+bool isOrientedBoundingBoxVisible(int drawRecordIndex)
+{
+	mat4 worldSpaceToClipSpaceMatrix = mat4(loadVec4Value(HEADER_WORLD_SPACE_TO_CLIP_SPACE_MATRIX), loadVec4Value(HEADER_WORLD_SPACE_TO_CLIP_SPACE_MATRIX + 4), loadVec4Value(HEADER_WORLD_SPACE_TO_CLIP_SPACE_MATRIX + 8), loadVec4Value(HEADER_WORLD_SPACE_TO_CLIP_SPACE_MATRIX + 12));
+	int orientedBoundingBoxIndex = drawRecordIndex + DRAW_RECORD_ORIENTED_BOUNDING_BOX;
+	vec4 center = worldSpaceToClipSpaceMatrix * vec4(loadVec3Value(orientedBoundingBoxIndex), 1.0);
+	vec4 halfAxisX = worldSpaceToClipSpaceMatrix * vec4(loadVec3Value(orientedBoundingBoxIndex + 3), 0.0);
+	vec4 halfAxisY = worldSpaceToClipSpaceMatrix * vec4(loadVec3Value(orientedBoundingBoxIndex + 6), 0.0);
+	vec4 halfAxisZ = worldSpaceToClipSpaceMatrix * vec4(loadVec3Value(orientedBoundingBoxIndex + 9), 0.0);
+	bvec3 allLess = bvec3(true);
+	bvec3 allGreater = bvec3(true);
+	for (int corner = 0; corner < 8; ++corner)
+	{
+		vec4 clipSpacePosition = center + (((corner & 1) != 0) ? halfAxisX : -halfAxisX) + (((corner & 2) != 0) ? halfAxisY : -halfAxisY) + (((corner & 4) != 0) ? halfAxisZ : -halfAxisZ);
+		allLess = bvec3(allLess.x && clipSpacePosition.x <= -clipSpacePosition.w, allLess.y && clipSpacePosition.y <= -clipSpacePosition.w, allLess.z && clipSpacePosition.z <= 0.0);
+		allGreater = bvec3(allGreater.x && clipSpacePosition.x >= clipSpacePosition.w, allGreater.y && clipSpacePosition.y >= clipSpacePosition.w, allGreater.z && clipSpacePosition.z >= clipSpacePosition.w);
+	}
+	return !any(allLess) && !any(allGreater);
+}
+
+// Programs
+void main()
+{
+	// Ignore invocations beyond the number of draws
+	uint drawIndex = gl_GlobalInvocationID.x;
+	if (drawIndex >= loadValue(HEADER_NUMBER_OF_DRAWS))
+	{
+		return;
+	}
+	int drawRecordIndex = HEADER_NUMBER_OF_VALUES + int(drawIndex) * DRAW_RECORD_NUMBER_OF_VALUES;
+
+	// Frustum culling: Cheap sphere test first, the object-oriented bounding box test only for draws which passed the sphere test
+	bool visible = true;
+	float radius = loadFloatValue(drawRecordIndex + 3);
+	if (0u != loadValue(HEADER_FRUSTUM_CULLING) && radius >= 0.0)
+	{
+		visible = (isSphereVisible(loadVec3Value(drawRecordIndex), radius) && isOrientedBoundingBoxVisible(drawRecordIndex));
+	}
+
+	// Append the draw arguments of visible draws to the draw arguments of its batch
+	if (visible)
+	{
+		uint batchIndex = loadValue(drawRecordIndex + DRAW_RECORD_BATCH_INDEX);
+		uint firstDrawIndex = loadValue(drawRecordIndex + DRAW_RECORD_FIRST_DRAW_INDEX);
+		int outputIndex = int(firstDrawIndex + imageAtomicAdd(DrawCountBuffer, int(batchIndex), 1u)) * 5;
+		for (int i = 0; i < 5; ++i)
+		{
+			imageStore(DrawIndirectBuffer, outputIndex + i, uvec4(loadValue(drawRecordIndex + DRAW_RECORD_DRAW_ARGUMENTS + i)));
+		}
+	}
+}
+)";
+
+
+//[-------------------------------------------------------]
+//[ Shader end                                            ]
+//[-------------------------------------------------------]
+}
+else
+#endif
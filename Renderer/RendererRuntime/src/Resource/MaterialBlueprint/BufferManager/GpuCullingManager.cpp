@@ -0,0 +1,302 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/PrecompiledHeader.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/GpuCullingManager.h"
+#include "RendererRuntime/Core/Math/Frustum.h"
+#include "RendererRuntime/Core/GetUninitialized.h"
+#include "RendererRuntime/IRendererRuntime.h"
+#include "RendererRuntime/Context.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/glm.hpp>
+	#include <glm/gtc/type_ptr.hpp>
+	#include <glm/detail/setup.hpp>	// For "glm::countof()"
+PRAGMA_WARNING_POP
+
+#include <cassert>
+#include <cstring>	// For "strcmp()" and "memcpy()"
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t NUMBER_OF_THREADS_PER_WORK_GROUP = 64;	///< Must match the compute shader local size
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Draw record texture buffer header as seen by the compute shader
+		*/
+		struct Header final
+		{
+			float	 frustumPlanes[6][4];				///< World space frustum planes, normal (xyz) pointing into the frustum and distance (w)
+			float	 worldSpaceToClipSpaceMatrix[16];	///< World space to clip space matrix, column-major
+			uint32_t numberOfDraws;
+			uint32_t frustumCulling;					///< 1 if frustum culling is enabled, else 0
+			uint32_t padding[2];
+		};
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	GpuCullingManager::GpuCullingManager(const IRendererRuntime& rendererRuntime) :
+		mRendererRuntime(rendererRuntime),
+		mEnabled(false),
+		mFrustumCulling(false),
+		mMaximumNumberOfDraws(0),
+		mCurrentBufferSetIndex(0),
+		mNumberOfBatches(0),
+		mCurrentBatchIndex(getUninitialized<uint32_t>()),
+		mCurrentFirstDrawIndex(getUninitialized<uint32_t>())
+	{
+		memset(mFrustumPlanes, 0, sizeof(mFrustumPlanes));
+		memset(mWorldSpaceToClipSpaceMatrix, 0, sizeof(mWorldSpaceToClipSpaceMatrix));
+
+		// GPU culling requires compute shaders and draw indirect count support
+		Renderer::IRenderer& renderer = rendererRuntime.getRenderer();
+		const Renderer::Capabilities& capabilities = renderer.getCapabilities();
+		const uint32_t headerNumberOfValues = sizeof(::detail::Header) / sizeof(uint32_t);
+		const uint32_t drawRecordNumberOfValues = sizeof(DrawRecord) / sizeof(uint32_t);
+		if (!capabilities.computeShader || !capabilities.drawIndirectCount || capabilities.maximumTextureBufferSize <= headerNumberOfValues + drawRecordNumberOfValues)
+		{
+			// Nothing to do in here, GPU culling isn't supported
+			return;
+		}
+		mMaximumNumberOfDraws = std::min(static_cast<uint32_t>(MAXIMUM_NUMBER_OF_DRAWS), (capabilities.maximumTextureBufferSize - headerNumberOfValues) / drawRecordNumberOfValues);
+		mMaximumNumberOfDraws = std::min(mMaximumNumberOfDraws, capabilities.maximumIndirectBufferSize / static_cast<uint32_t>(sizeof(Renderer::DrawIndexedInstancedArguments)));
+
+		{ // Create the root signature
+			Renderer::DescriptorRangeBuilder ranges[3];
+			ranges[0].initialize(Renderer::ResourceType::TEXTURE_BUFFER, Renderer::DescriptorRangeType::UAV, 1, 0, "DrawRecordTextureBuffer", Renderer::ShaderVisibility::COMPUTE);
+			ranges[1].initialize(Renderer::ResourceType::INDIRECT_BUFFER, Renderer::DescriptorRangeType::UAV, 1, 1, "DrawIndirectBuffer", Renderer::ShaderVisibility::COMPUTE);
+			ranges[2].initialize(Renderer::ResourceType::INDIRECT_BUFFER, Renderer::DescriptorRangeType::UAV, 1, 2, "DrawCountBuffer", Renderer::ShaderVisibility::COMPUTE);
+
+			Renderer::RootParameterBuilder rootParameters[1];
+			rootParameters[0].initializeAsDescriptorTable(static_cast<uint32_t>(glm::countof(ranges)), ranges);
+
+			// Setup
+			Renderer::RootSignatureBuilder rootSignature;
+			rootSignature.initialize(static_cast<uint32_t>(glm::countof(rootParameters)), rootParameters, 0, nullptr, Renderer::RootSignatureFlags::NONE);
+
+			// Create the instance
+			mRootSignature = renderer.createRootSignature(rootSignature);
+			RENDERER_SET_RESOURCE_DEBUG_NAME(mRootSignature, "GPU culling manager")
+		}
+
+		// Create the buffer sets
+		Renderer::IBufferManager& bufferManager = rendererRuntime.getBufferManager();
+		for (BufferSet& bufferSet : mBufferSets)
+		{
+			bufferSet.drawRecordTextureBuffer = bufferManager.createTextureBuffer(sizeof(::detail::Header) + sizeof(DrawRecord) * mMaximumNumberOfDraws, Renderer::TextureFormat::R32_UINT, nullptr, Renderer::BufferUsage::DYNAMIC_DRAW);
+			RENDERER_SET_RESOURCE_DEBUG_NAME(bufferSet.drawRecordTextureBuffer, "GPU culling manager draw records")
+			bufferSet.drawIndirectBuffer = bufferManager.createIndirectBuffer(sizeof(Renderer::DrawIndexedInstancedArguments) * mMaximumNumberOfDraws, nullptr, Renderer::BufferUsage::DYNAMIC_COPY, Renderer::IndirectBufferFlag::UNORDERED_ACCESS);
+			RENDERER_SET_RESOURCE_DEBUG_NAME(bufferSet.drawIndirectBuffer, "GPU culling manager draw arguments")
+			bufferSet.countIndirectBuffer = bufferManager.createIndirectBuffer(sizeof(uint32_t) * mMaximumNumberOfDraws, nullptr, Renderer::BufferUsage::DYNAMIC_DRAW, Renderer::IndirectBufferFlag::UNORDERED_ACCESS);
+			RENDERER_SET_RESOURCE_DEBUG_NAME(bufferSet.countIndirectBuffer, "GPU culling manager draw counts")
+			Renderer::IResource* resources[3] = { bufferSet.drawRecordTextureBuffer, bufferSet.drawIndirectBuffer, bufferSet.countIndirectBuffer };
+			bufferSet.resourceGroup = mRootSignature->createResourceGroup(0, static_cast<uint32_t>(glm::countof(resources)), resources);
+		}
+
+		// Decide which shader language should be used (for example "GLSL" or "HLSL")
+		Renderer::IShaderLanguage* shaderLanguage = renderer.getShaderLanguage();
+		if (nullptr != shaderLanguage)
+		{
+			// Get the shader source code (outsourced to keep an overview)
+			const char* computeShaderSourceCode = nullptr;
+			#include "Detail/Shader/GpuCulling_GLSL_450.h"	// For Vulkan
+			#include "Detail/Shader/GpuCulling_GLSL_430.h"	// OpenGL 4.3 is the first OpenGL version with compute shaders
+			#include "Detail/Shader/GpuCulling_Null.h"
+
+			// Create the compute pipeline state object
+			if (nullptr != computeShaderSourceCode)
+			{
+				Renderer::IComputeShaderPtr computeShader(shaderLanguage->createComputeShaderFromSourceCode(computeShaderSourceCode));
+				if (nullptr != computeShader)
+				{
+					RENDERER_SET_RESOURCE_DEBUG_NAME(computeShader, "GPU culling manager")
+					mComputePipelineState = renderer.createComputePipelineState(*mRootSignature, *computeShader);
+					RENDERER_SET_RESOURCE_DEBUG_NAME(mComputePipelineState, "GPU culling manager")
+				}
+			}
+		}
+
+		// Reserve memory for the draw records
+		if (isSupported())
+		{
+			mDrawRecords.reserve(mMaximumNumberOfDraws);
+		}
+	}
+
+	GpuCullingManager::~GpuCullingManager()
+	{
+		// At this point in time, no draw records should be pending anymore
+		assert(mDrawRecords.empty());
+		assert(0 == mNumberOfBatches);
+	}
+
+	void GpuCullingManager::setFrustum(const glm::mat4* worldSpaceToClipSpaceMatrix)
+	{
+		if (nullptr != worldSpaceToClipSpaceMatrix)
+		{
+			const Frustum frustum(*worldSpaceToClipSpaceMatrix);
+			for (int i = 0; i < Frustum::NUMBER_OF_PLANES; ++i)
+			{
+				const Plane& plane = frustum.planes[i];
+				mFrustumPlanes[i][0] = plane.normal.x;
+				mFrustumPlanes[i][1] = plane.normal.y;
+				mFrustumPlanes[i][2] = plane.normal.z;
+				mFrustumPlanes[i][3] = plane.d;
+			}
+			memcpy(mWorldSpaceToClipSpaceMatrix, glm::value_ptr(*worldSpaceToClipSpaceMatrix), sizeof(mWorldSpaceToClipSpaceMatrix));
+			mFrustumCulling = true;
+		}
+		else
+		{
+			mFrustumCulling = false;
+		}
+	}
+
+	void GpuCullingManager::beginBatch(uint32_t& batchIndex, uint32_t& firstDrawIndex)
+	{
+		// Sanity check
+		assert(isEnabled());
+		assert(hasCapacity(1) && "Use \"RendererRuntime::GpuCullingManager::hasCapacity()\" before adding draws");
+
+		// Each batch contains at least one draw, so there can't be more batches than draws
+		mCurrentBatchIndex = batchIndex = mNumberOfBatches;
+		mCurrentFirstDrawIndex = firstDrawIndex = static_cast<uint32_t>(mDrawRecords.size());
+		++mNumberOfBatches;
+	}
+
+	void GpuCullingManager::addDraw(const Renderer::DrawIndexedInstancedArguments& drawIndexedInstancedArguments, const float worldSpaceBoundingSphere[4], const float worldSpaceOrientedBoundingBox[12])
+	{
+		// Sanity checks
+		assert(isInitialized(mCurrentBatchIndex) && "Use \"RendererRuntime::GpuCullingManager::beginBatch()\" before adding draws");
+		assert(hasCapacity(1) && "Use \"RendererRuntime::GpuCullingManager::hasCapacity()\" before adding draws");
+
+		// Add draw record
+		mDrawRecords.emplace_back();
+		DrawRecord& drawRecord = mDrawRecords.back();
+		memcpy(drawRecord.worldSpaceBoundingSphere, worldSpaceBoundingSphere, sizeof(float) * 4);
+		memcpy(drawRecord.worldSpaceOrientedBoundingBox, worldSpaceOrientedBoundingBox, sizeof(float) * 12);
+		drawRecord.drawArguments[0] = drawIndexedInstancedArguments.indexCountPerInstance;
+		drawRecord.drawArguments[1] = drawIndexedInstancedArguments.instanceCount;
+		drawRecord.drawArguments[2] = drawIndexedInstancedArguments.startIndexLocation;
+		drawRecord.drawArguments[3] = static_cast<uint32_t>(drawIndexedInstancedArguments.baseVertexLocation);
+		drawRecord.drawArguments[4] = drawIndexedInstancedArguments.startInstanceLocation;
+		drawRecord.batchIndex		= mCurrentBatchIndex;
+		drawRecord.firstDrawIndex	= mCurrentFirstDrawIndex;
+		drawRecord.padding			= 0;
+	}
+
+	void GpuCullingManager::onPreCommandBufferExecution()
+	{
+		if (!mDrawRecords.empty())
+		{
+			Renderer::IRenderer& renderer = mRendererRuntime.getRenderer();
+			const BufferSet& bufferSet = mBufferSets[mCurrentBufferSetIndex];
+			const uint32_t numberOfDraws = static_cast<uint32_t>(mDrawRecords.size());
+
+			{ // Upload the header and the draw records
+				Renderer::MappedSubresource mappedSubresource;
+				if (renderer.map(*bufferSet.drawRecordTextureBuffer, 0, Renderer::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				{
+					::detail::Header* header = static_cast<::detail::Header*>(mappedSubresource.data);
+					memcpy(header->frustumPlanes, mFrustumPlanes, sizeof(mFrustumPlanes));
+					memcpy(header->worldSpaceToClipSpaceMatrix, mWorldSpaceToClipSpaceMatrix, sizeof(mWorldSpaceToClipSpaceMatrix));
+					header->numberOfDraws  = numberOfDraws;
+					header->frustumCulling = mFrustumCulling ? 1u : 0u;
+					header->padding[0] = header->padding[1] = 0;
+					memcpy(header + 1, mDrawRecords.data(), sizeof(DrawRecord) * numberOfDraws);
+					renderer.unmap(*bufferSet.drawRecordTextureBuffer, 0);
+				}
+			}
+
+			{ // Reset the number of visible draws per batch
+				Renderer::MappedSubresource mappedSubresource;
+				if (renderer.map(*bufferSet.countIndirectBuffer, 0, Renderer::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				{
+					memset(mappedSubresource.data, 0, sizeof(uint32_t) * mNumberOfBatches);
+					renderer.unmap(*bufferSet.countIndirectBuffer, 0);
+				}
+			}
+
+			{ // Cull and compact the draws
+				// -> Submitted before the command buffer consuming the draw arguments, outside of any render pass since e.g. Vulkan doesn't allow dispatching compute work inside a render pass
+				COMMAND_BEGIN_DEBUG_EVENT_FUNCTION(mCommandBuffer)
+				Renderer::Command::SetComputeRootSignature::create(mCommandBuffer, mRootSignature);
+				Renderer::Command::SetComputePipelineState::create(mCommandBuffer, mComputePipelineState);
+				Renderer::Command::SetComputeResourceGroup::create(mCommandBuffer, 0, bufferSet.resourceGroup);
+				Renderer::Command::DispatchCompute::create(mCommandBuffer, (numberOfDraws + ::detail::NUMBER_OF_THREADS_PER_WORK_GROUP - 1) / ::detail::NUMBER_OF_THREADS_PER_WORK_GROUP);
+				COMMAND_END_DEBUG_EVENT(mCommandBuffer)
+				mCommandBuffer.submitToRendererAndClear(renderer);
+			}
+
+			// Start over using the next buffer set, the draws of the next command buffer execution must not touch resources which might still be in use by the GPU
+			mDrawRecords.clear();
+			mNumberOfBatches = 0;
+			mCurrentBufferSetIndex = (mCurrentBufferSetIndex + 1) % NUMBER_OF_BUFFER_SETS;
+		}
+
+		// The frustum must be set again before the next command buffer execution, else draws aren't culled
+		mFrustumCulling = false;
+		setUninitialized(mCurrentBatchIndex);
+		setUninitialized(mCurrentFirstDrawIndex);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
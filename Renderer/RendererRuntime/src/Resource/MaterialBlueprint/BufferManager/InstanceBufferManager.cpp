@@ -159,8 +159,19 @@ namespace RendererRuntime
 		const size_t numberOfUniformBufferElementProperties = uniformBufferElementProperties.size();
 		const SkeletonResourceId skeletonResourceId = renderable.getSkeletonResourceId();
 		const SkeletonResource* skeletonResource = isInitialized(skeletonResourceId) ? &mRendererRuntime.getSkeletonResourceManager().getById(skeletonResourceId) : nullptr;
+		const RenderableManager::InstanceCustomParameters& instanceCustomParameters = renderable.getRenderableManager().getInstanceCustomParameters();
+		uint32_t instanceCustomParametersOffset = 0;	// In float4, relative to the instance texture buffer start index of this instance
+		if (!instanceCustomParameters.empty())
+		{
+			// The instance custom parameters are located after the "POSITION_ROTATION_SCALE"-semantic and the optional bone matrices
+			instanceCustomParametersOffset = 3;
+			if (nullptr != skeletonResource)
+			{
+				instanceCustomParametersOffset += static_cast<uint32_t>(sizeof(glm::mat3x4) / (sizeof(float) * 4)) * skeletonResource->getNumberOfBones();
+			}
+		}
 		static const PassBufferManager::PassData passData = {};
-		materialBlueprintResourceListener.beginFillInstance((nullptr != passBufferManager) ? passBufferManager->getPassData() : passData, objectSpaceToWorldSpaceTransform, materialTechnique);
+		materialBlueprintResourceListener.beginFillInstance((nullptr != passBufferManager) ? passBufferManager->getPassData() : passData, objectSpaceToWorldSpaceTransform, materialTechnique, instanceCustomParametersOffset);
 
 		{ // Handle instance buffer overflow
 			// Calculate number of additionally needed uniform buffer bytes
@@ -195,6 +206,7 @@ namespace RendererRuntime
 				assert((numberOfBytes <= mMaximumTextureBufferSize) && "The skeleton has too many bones for the available maximum texture buffer size");
 				newNeededTextureBufferSize += numberOfBytes;
 			}
+			newNeededTextureBufferSize += static_cast<uint32_t>(sizeof(float) * instanceCustomParameters.size());
 
 			// Detect and handle instance buffer overflow
 			const uint32_t totalNeededUniformBufferSize = (static_cast<uint32_t>(mCurrentUniformBufferPointer - mStartUniformBufferPointer) + newNeededUniformBufferSize);
@@ -307,6 +319,13 @@ namespace RendererRuntime
 				memcpy(mCurrentTextureBufferPointer, boneSpaceMatrices, numberOfBytes);
 				mCurrentTextureBufferPointer += numberOfBytes / sizeof(float);
 			}
+
+			// Do we also need to pass on instance custom parameters? (e.g. vertex dequantization of quantized meshes)
+			if (!instanceCustomParameters.empty())
+			{
+				memcpy(mCurrentTextureBufferPointer, instanceCustomParameters.data(), sizeof(float) * instanceCustomParameters.size());
+				mCurrentTextureBufferPointer += instanceCustomParameters.size();
+			}
 		}
 
 		// Done
@@ -24,13 +24,30 @@
 #include "RendererRuntime/PrecompiledHeader.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/LightBufferManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
+#include "RendererRuntime/Resource/CompositorWorkspace/CompositorContextData.h"
 #include "RendererRuntime/Resource/Texture/TextureResourceManager.h"
 #include "RendererRuntime/Resource/Texture/TextureResource.h"
 #include "RendererRuntime/Resource/Scene/SceneNode.h"
 #include "RendererRuntime/Resource/Scene/SceneResource.h"
 #include "RendererRuntime/Resource/Scene/Item/Light/LightSceneItem.h"
+#include "RendererRuntime/Resource/Scene/Item/Camera/CameraSceneItem.h"
+#include "RendererRuntime/Core/Thread/ThreadPool.h"
+#include "RendererRuntime/Core/Time/CpuProfiler.h"
 #include "RendererRuntime/Core/Math/Math.h"
 #include "RendererRuntime/IRendererRuntime.h"
+#include "RendererRuntime/Context.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: 'xsimd::hadd::<unnamed-tag>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4505)	// warning C4505: 'xsimd::detail::__ieee754_rem_pio2': unreferenced local function has been removed
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <xsimd/xsimd.hpp>
+	#include <glm/gtc/matrix_transform.hpp>
+PRAGMA_WARNING_POP
 
 #include <algorithm>
 
@@ -48,13 +65,19 @@ namespace
 		//[ Global definitions                                    ]
 		//[-------------------------------------------------------]
 		// TODO(co) Add support for persistent mapped buffers. For now, the big picture has to be OK so first focus on that.
-		static uint32_t DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES = 64 * 1024;	// 64 KiB
-		// static uint32_t DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES = 512 * 1024;	// 512 KiB
+		static uint32_t DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES = 512 * 1024;	// 512 KiB, light data as well as the flat light index list
 
-		// TODO(co) Just for the clusters shading kickoff
-		static const uint32_t CLUSTER_X = 32;
+		// View frustum aligned clusters, the depth is sliced exponentially
+		static const uint32_t CLUSTER_X = 16;
 		static const uint32_t CLUSTER_Y = 8;
-		static const uint32_t CLUSTER_Z = 32;
+		static const uint32_t CLUSTER_Z = 24;
+		static const uint32_t NUMBER_OF_CLUSTERS = CLUSTER_X * CLUSTER_Y * CLUSTER_Z;
+		static const uint32_t MAXIMUM_NUMBER_OF_LIGHTS_PER_CLUSTER = 255;	///< The number of light indices is stored inside the lower 8 bits of a cluster texel
+		static const uint32_t MAXIMUM_LIGHT_INDEX_OFFSET = (1u << 24) - 1;		///< The light index offset is stored inside the upper 24 bits of a cluster texel
+		static const size_t   LIGHTS_MULTI_THREADING_THRESHOLD = 64;			///< Below this number of lights, the binning is done directly inside the current thread	TODO(co) This value needs to be fine-tuned
+		static const size_t   SLICES_SPLIT_COUNT = 2;							///< Package size for each thread to work on	TODO(co) This value needs to be fine-tuned
+		static_assert(0 == (CLUSTER_X % 4), "The number of clusters in x direction must be a multiple of the SIMD lane count");
+		typedef xsimd::batch<float, 4> float4;
 
 
 //[-------------------------------------------------------]
@@ -93,12 +116,20 @@ namespace RendererRuntime
 	LightBufferManager::LightBufferManager(IRendererRuntime& rendererRuntime) :
 		mRendererRuntime(rendererRuntime),
 		mTextureBuffer(nullptr),
+		mNumberOfLights(0),
+		mClusterLightIndices(::detail::NUMBER_OF_CLUSTERS),
+		mClusters3DTextureData(::detail::NUMBER_OF_CLUSTERS, 0),
 		mClusters3DTextureResourceId(getUninitialized<TextureResourceId>()),
-		mLightClustersAabbMinimum(-16.0f, -0.5f, -6.0f),	// TODO(co) Just for the clusters shading kickoff
-		mLightClustersAabbMaximum(14.0f, 15.0f, 7.0f),		// TODO(co) Just for the clusters shading kickoff
-		mResourceGroup(nullptr)
+		mLightClustersNearZ(CameraSceneItem::DEFAULT_NEAR_Z),
+		mLightClustersFarZ(CameraSceneItem::DEFAULT_FAR_Z),
+		mLightClustersTileScale(1.0f, 1.0f),
+		mLightClustersScale(1.0f, 1.0f, 1.0f),
+		mLightClustersBias(0.0f, 0.0f, 0.0f),
+		mResourceGroup(nullptr),
+		mLightLimitExceeded(false)
 	{
 		// Create texture buffer instance
+		// -> Texture buffer size must be a multiple of the light data size, the remaining space is used for the flat light index list
 		mTextureScratchBuffer.resize(std::min(mRendererRuntime.getRenderer().getCapabilities().maximumTextureBufferSize, ::detail::DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES));
 		mTextureBuffer = mRendererRuntime.getBufferManager().createTextureBuffer(static_cast<uint32_t>(mTextureScratchBuffer.size()), Renderer::TextureFormat::R32G32B32A32F, nullptr, Renderer::BufferUsage::DYNAMIC_DRAW);
 		RENDERER_SET_RESOURCE_DEBUG_NAME(mTextureBuffer, "Light buffer manager")
@@ -112,6 +143,9 @@ namespace RendererRuntime
 			// Create dynamic texture asset
 			mClusters3DTextureResourceId = mRendererRuntime.getTextureResourceManager().createTextureResourceByAssetId("Unrimp/Texture/DynamicByCode/LightClustersMap3D", *texturePtr);
 		}
+
+		// Setup a reasonable default light clusters view frustum until the first light buffer fill
+		setLightClustersViewFrustum(glm::perspective(CameraSceneItem::DEFAULT_FOV_Y, 1.0f, CameraSceneItem::DEFAULT_NEAR_Z, CameraSceneItem::DEFAULT_FAR_Z), CameraSceneItem::DEFAULT_NEAR_Z, CameraSceneItem::DEFAULT_FAR_Z);
 	}
 
 	LightBufferManager::~LightBufferManager()
@@ -124,10 +158,32 @@ namespace RendererRuntime
 		mRendererRuntime.getTextureResourceManager().destroyTextureResource(mClusters3DTextureResourceId);
 	}
 
-	void LightBufferManager::fillBuffer(SceneResource& sceneResource, Renderer::CommandBuffer& commandBuffer)
+	void LightBufferManager::fillBuffer(const Renderer::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Renderer::CommandBuffer&)
 	{
-		fillTextureBuffer(sceneResource);
-		fillClusters3DTexture(sceneResource, commandBuffer);
+		RENDERER_RUNTIME_CPU_PROFILER_SCOPE_FUNCTION()
+
+		// Get the camera scene item
+		const CameraSceneItem* cameraSceneItem = compositorContextData.getCameraSceneItem();
+		assert(nullptr != cameraSceneItem);
+
+		{ // Setup the light clusters view frustum
+			// Get the render target with and height
+			uint32_t renderTargetWidth = 0;
+			uint32_t renderTargetHeight = 0;
+			renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+			if (compositorContextData.getSinglePassStereoInstancing())
+			{
+				// TODO(co) Single pass stereo rendering: For now, the light clusters are using the view frustum of the mono camera
+				renderTargetWidth /= 2;
+			}
+			setLightClustersViewFrustum(cameraSceneItem->getViewSpaceToClipSpaceMatrix(static_cast<float>(renderTargetWidth) / renderTargetHeight), cameraSceneItem->getNearZ(), cameraSceneItem->getFarZ());
+		}
+
+		// Gather the lights, bin them into the light clusters and upload the result
+		gatherLights(compositorContextData);
+		binLightsIntoClusters();
+		fillTextureBuffer();
+		fillClusters3DTexture();
 	}
 
 	void LightBufferManager::fillCommandBuffer(const MaterialBlueprintResource& materialBlueprintResource, Renderer::CommandBuffer& commandBuffer)
@@ -153,151 +209,359 @@ namespace RendererRuntime
 		}
 	}
 
-	glm::vec3 LightBufferManager::getLightClustersScale() const
-	{
-		return glm::vec3(static_cast<float>(::detail::CLUSTER_X), static_cast<float>(::detail::CLUSTER_Y), static_cast<float>(::detail::CLUSTER_Z)) / (mLightClustersAabbMaximum - mLightClustersAabbMinimum);
-	}
-
-	glm::vec3 LightBufferManager::getLightClustersBias() const
-	{
-		return glm::vec3(-static_cast<float>(::detail::CLUSTER_X), -static_cast<float>(::detail::CLUSTER_Y), -static_cast<float>(::detail::CLUSTER_Z)) / (mLightClustersAabbMaximum - mLightClustersAabbMinimum) * mLightClustersAabbMinimum;
-	}
-
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
-	void LightBufferManager::fillTextureBuffer(SceneResource& sceneResource)
+	void LightBufferManager::setLightClustersViewFrustum(const glm::mat4& viewSpaceToClipSpaceMatrix, float nearZ, float farZ)
 	{
-		// TODO(co) This is just a placeholder implementation until "RendererRuntime::LightBufferManager" is ready (containing e.g. reasonable optimizations)
+		assert(nearZ > 0.0f && farZ > nearZ);
+		mLightClustersNearZ = nearZ;
+		mLightClustersFarZ = farZ;
+
+		// Screen space tiles: "cluster.xy = viewSpacePosition.xy / viewSpacePosition.z * projectionScale * halfNumberOfClusters + halfNumberOfClusters"
+		mLightClustersTileScale.x = viewSpaceToClipSpaceMatrix[0][0] * static_cast<float>(::detail::CLUSTER_X) * 0.5f;
+		mLightClustersTileScale.y = viewSpaceToClipSpaceMatrix[1][1] * static_cast<float>(::detail::CLUSTER_Y) * 0.5f;
+
+		// Exponential depth slices: "cluster.z = log2(viewSpacePosition.z / nearZ) * numberOfSlices / log2(farZ / nearZ)"
+		const float sliceScale = static_cast<float>(::detail::CLUSTER_Z) / std::log2(farZ / nearZ);
+		mLightClustersScale = glm::vec3(mLightClustersTileScale.x, mLightClustersTileScale.y, sliceScale);
+		mLightClustersBias = glm::vec3(static_cast<float>(::detail::CLUSTER_X) * 0.5f, static_cast<float>(::detail::CLUSTER_Y) * 0.5f, -std::log2(nearZ) * sliceScale);
+	}
 
-		// Loop through all scene nodes and look for point and spot lights
+	void LightBufferManager::gatherLights(const CompositorContextData& compositorContextData)
+	{
+		const CameraSceneItem* cameraSceneItem = compositorContextData.getCameraSceneItem();
+		const glm::mat4& worldSpaceToViewSpaceMatrix = cameraSceneItem->getWorldSpaceToViewSpaceMatrix();
+		const float sliceScale = mLightClustersScale.z;
+		const float sliceBias = mLightClustersBias.z;
+		const uint32_t maximumNumberOfLights = static_cast<uint32_t>(mTextureScratchBuffer.size() / sizeof(LightSceneItem::PackedShaderData));
+
+		// Clear the view space lights of the previous frame, the capacity is kept
+		ViewSpaceLights& viewSpaceLights = mViewSpaceLights;
+		viewSpaceLights.positionX.clear();
+		viewSpaceLights.positionY.clear();
+		viewSpaceLights.positionZ.clear();
+		viewSpaceLights.radius.clear();
+		viewSpaceLights.minimumSlice.clear();
+		viewSpaceLights.maximumSlice.clear();
+
+		// Linear scan over the light scene item registry of the scene resource
+		const SceneResource::LightSceneItemRegistry& registry = cameraSceneItem->getSceneResource().getLightSceneItemRegistry();
+		const size_t numberOfRegisteredLights = registry.lightSceneItems.size();
 		uint8_t* scratchBufferPointer = mTextureScratchBuffer.data();
-		for (const SceneNode* sceneNode : sceneResource.getSceneNodes())
+		mNumberOfLights = 0;
+		for (size_t i = 0; i < numberOfRegisteredLights; ++i)
+		{
+			// Directional lights have a radius of zero and are not handled by clustered shading
+			const float radius = registry.radius[i];
+			if (0 == registry.visible[i] || radius <= 0.0f)
+			{
+				continue;
+			}
+
+			// Lights completely in front of the near plane or behind the far plane can't influence any cluster
+			const glm::vec3 worldSpacePosition(registry.positionX[i], registry.positionY[i], registry.positionZ[i]);
+			const glm::vec3 viewSpacePosition = glm::vec3(worldSpaceToViewSpaceMatrix * glm::vec4(worldSpacePosition, 1.0f));
+			if (viewSpacePosition.z + radius < mLightClustersNearZ || viewSpacePosition.z - radius > mLightClustersFarZ)
+			{
+				continue;
+			}
+			assert(mNumberOfLights < maximumNumberOfLights);
+			if (mNumberOfLights >= maximumNumberOfLights)
+			{
+				break;
+			}
+
+			// Update the world space light position and the normalized view space light direction
+			LightSceneItem& lightSceneItem = *registry.lightSceneItems[i];
+			LightSceneItem::PackedShaderData& packedShaderData = lightSceneItem.mPackedShaderData;
+			packedShaderData.position = worldSpacePosition;
+			if (lightSceneItem.getLightType() == LightSceneItem::LightType::SPOT && lightSceneItem.hasParentSceneNode())
+			{
+				packedShaderData.direction = lightSceneItem.getParentSceneNodeSafe().getGlobalTransform().rotation * Math::VEC3_FORWARD;
+			}
+
+			// Remember the view space light and the depth slices it touches
+			viewSpaceLights.positionX.push_back(viewSpacePosition.x);
+			viewSpaceLights.positionY.push_back(viewSpacePosition.y);
+			viewSpaceLights.positionZ.push_back(viewSpacePosition.z);
+			viewSpaceLights.radius.push_back(radius);
+			const float minimumSlice = std::floor(std::log2(std::max(viewSpacePosition.z - radius, mLightClustersNearZ)) * sliceScale + sliceBias);
+			const float maximumSlice = std::floor(std::log2(std::min(viewSpacePosition.z + radius, mLightClustersFarZ)) * sliceScale + sliceBias);
+			viewSpaceLights.minimumSlice.push_back(static_cast<uint32_t>(glm::clamp(minimumSlice, 0.0f, static_cast<float>(::detail::CLUSTER_Z - 1))));
+			viewSpaceLights.maximumSlice.push_back(static_cast<uint32_t>(glm::clamp(maximumSlice, 0.0f, static_cast<float>(::detail::CLUSTER_Z - 1))));
+
+			// Copy the light data into the texture scratch buffer
+			memcpy(scratchBufferPointer, &packedShaderData, sizeof(LightSceneItem::PackedShaderData));
+			scratchBufferPointer += sizeof(LightSceneItem::PackedShaderData);
+			++mNumberOfLights;
+		}
+	}
+
+	void LightBufferManager::binLightsIntoClusters()
+	{
+		// Each worker thread owns a range of depth slices, so the clusters light indices can be written without any synchronization
+		const size_t numberOfLights = mNumberOfLights;
+		if (numberOfLights < ::detail::LIGHTS_MULTI_THREADING_THRESHOLD)
+		{
+			// Just execute it directly inside the current thread, not worth the additional threading effort
+			binLightsIntoClusterSlices(0, ::detail::CLUSTER_Z);
+		}
+		else
 		{
-			// Loop through all scene items attached to the current scene node
-			for (ISceneItem* sceneItem : sceneNode->getAttachedSceneItems())
+			DefaultThreadPool& defaultThreadPool = mRendererRuntime.getDefaultThreadPool();
+			size_t itemCount = ::detail::CLUSTER_Z;
+			size_t splitCount = ::detail::SLICES_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
+			if (1 == threadCount)
+			{
+				binLightsIntoClusterSlices(0, ::detail::CLUSTER_Z);
+			}
+			else
 			{
-				if (sceneItem->getSceneItemTypeId() == LightSceneItem::TYPE_ID)
+				// Multi-threaded
+				size_t threadSliceIndexOffset = 0;
+				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
 				{
-					LightSceneItem* lightSceneItem = static_cast<LightSceneItem*>(sceneItem);
-					if (lightSceneItem->getLightType() != LightSceneItem::LightType::DIRECTIONAL && lightSceneItem->isVisible())
-					{
-						// Update the world space light position and the normalized view space light direction
-						LightSceneItem::PackedShaderData& packedShaderData = lightSceneItem->mPackedShaderData;
-						const Transform& transform = sceneNode->getGlobalTransform();
-						packedShaderData.position  = transform.position;
-						packedShaderData.direction = transform.rotation * Math::VEC3_FORWARD;
-
-						// Copy the light data into the texture scratch buffer
-						memcpy(scratchBufferPointer, &packedShaderData, sizeof(LightSceneItem::PackedShaderData));
-						scratchBufferPointer += sizeof(LightSceneItem::PackedShaderData);
-					}
+					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+					defaultThreadPool.queueTask(std::bind(&LightBufferManager::binLightsIntoClusterSlices, this, static_cast<uint32_t>(threadSliceIndexOffset), static_cast<uint32_t>(threadSliceIndexOffset + numberOfItemsToProcess)));
+					itemCount -= splitCount;
+					threadSliceIndexOffset += splitCount;
 				}
+
+				// Wait that all worker threads have done their part of the calculation
+				defaultThreadPool.process();
 			}
 		}
 
-		// Update the texture buffer by using our scratch buffer
-		const uint32_t numberOfBytes = static_cast<uint32_t>(scratchBufferPointer - mTextureScratchBuffer.data());
-		if (0 != numberOfBytes)
+		// Build the flat light index list behind the light data and the per cluster offset and count
+		// -> The light indices are stored as floats inside the "R32G32B32A32F" texture buffer, floats can exactly represent integers up to 2^24
+		const uint32_t lightIndexListStart = static_cast<uint32_t>(mNumberOfLights * sizeof(LightSceneItem::PackedShaderData) / sizeof(float));
+		const uint32_t lightIndexListCapacity = std::min(static_cast<uint32_t>(mTextureScratchBuffer.size() / sizeof(float)), ::detail::MAXIMUM_LIGHT_INDEX_OFFSET);
+		float* lightIndexList = reinterpret_cast<float*>(mTextureScratchBuffer.data());
+		uint32_t currentLightIndexListIndex = lightIndexListStart;
+		uint32_t maximumNumberOfLightsPerCluster = 0;
+		uint32_t numberOfDroppedLightIndices = 0;
+		for (uint32_t clusterIndex = 0; clusterIndex < ::detail::NUMBER_OF_CLUSTERS; ++clusterIndex)
 		{
-			Renderer::MappedSubresource mappedSubresource;
-			Renderer::IRenderer& renderer = mRendererRuntime.getRenderer();
-			if (renderer.map(*mTextureBuffer, 0, Renderer::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			const LightIndices& lightIndices = mClusterLightIndices[clusterIndex];
+			const uint32_t numberOfClusterLights = static_cast<uint32_t>(lightIndices.size());
+			const uint32_t numberOfLightIndices = std::min(std::min(numberOfClusterLights, ::detail::MAXIMUM_NUMBER_OF_LIGHTS_PER_CLUSTER), lightIndexListCapacity - currentLightIndexListIndex);
+			maximumNumberOfLightsPerCluster = std::max(maximumNumberOfLightsPerCluster, numberOfClusterLights);
+			numberOfDroppedLightIndices += numberOfClusterLights - numberOfLightIndices;
+			mClusters3DTextureData[clusterIndex] = (currentLightIndexListIndex << 8) | numberOfLightIndices;
+			for (uint32_t i = 0; i < numberOfLightIndices; ++i)
 			{
-				memcpy(mappedSubresource.data, mTextureScratchBuffer.data(), numberOfBytes);
-				renderer.unmap(*mTextureBuffer, 0);
+				lightIndexList[currentLightIndexListIndex + i] = static_cast<float>(lightIndices[i]);
+			}
+			currentLightIndexListIndex += numberOfLightIndices;
+		}
+
+		// Report dropped lights once, until the light limits are met again
+		if (0 != numberOfDroppedLightIndices)
+		{
+			if (!mLightLimitExceeded)
+			{
+				RENDERER_LOG(mRendererRuntime.getContext(), WARNING, "The light buffer manager dropped %u light cluster references: Up to %u lights are inside a single light cluster (limit is %u), the light index list capacity is %u", numberOfDroppedLightIndices, maximumNumberOfLightsPerCluster, ::detail::MAXIMUM_NUMBER_OF_LIGHTS_PER_CLUSTER, lightIndexListCapacity - lightIndexListStart)
+				mLightLimitExceeded = true;
 			}
 		}
+		else
+		{
+			mLightLimitExceeded = false;
+		}
+
+		// Debug builds cross-check the binning against a brute-force reference
+		#ifdef _DEBUG
+			validateLightClusters();
+		#endif
 	}
 
-	void LightBufferManager::fillClusters3DTexture(SceneResource& sceneResource, Renderer::CommandBuffer&)
+	void LightBufferManager::binLightsIntoClusterSlices(uint32_t sliceIndexStart, uint32_t sliceIndexEnd)
 	{
-		// Basing on the clustered shading demo from Emil Persson - http://humus.name/index.php?page=3D
-		// "
-		// We're using a 32bit integer format where each set bit enables the light of that index.
-		// This supports up to 32 lights, which is enough for this demo, and probably for some games. It's possible to expand if more lights are needed,
-		// for instance RGBA32_UINT for up to 128 lights in a single fetch, which is enough for many AAA titles. At some point, a list of indices becomes
-		// more compact in practice, so if thousands of lights are needed, that's probably the way to go. Using a fixed bitmask has the advantage of fixed
-		// size storage, simple addressing, and one indirection less in the inner loop.
-		// "
-
-		// TODO(co) This is just a placeholder implementation until "RendererRuntime::LightBufferManager" is ready
-		//          - Containing e.g. reasonable optimizations
-		//          - Processing on the GPU instead of CPU
-		//          - Using a dynamic light clusters AABB
-		uint32_t lights[::detail::CLUSTER_Z][::detail::CLUSTER_Y][::detail::CLUSTER_X] = {};
-		const glm::vec3 scale = glm::vec3(static_cast<float>(::detail::CLUSTER_X), static_cast<float>(::detail::CLUSTER_Y), static_cast<float>(::detail::CLUSTER_Z)) / (mLightClustersAabbMaximum - mLightClustersAabbMinimum);
-		const glm::vec3 inverseScale = 1.0f / scale;
-
-		// Loop through all scene nodes and look for point and spot lights
-		uint32_t currentLightIndex = 0;
-		for (const SceneNode* sceneNode : sceneResource.getSceneNodes())
+		RENDERER_RUNTIME_CPU_PROFILER_SCOPE_FUNCTION()
+
+		// Get pointers to the view space light data
+		const float* RESTRICT positionX = mViewSpaceLights.positionX.data();
+		const float* RESTRICT positionY = mViewSpaceLights.positionY.data();
+		const float* RESTRICT positionZ = mViewSpaceLights.positionZ.data();
+		const float* RESTRICT radiusData = mViewSpaceLights.radius.data();
+		const uint32_t* RESTRICT minimumSlice = mViewSpaceLights.minimumSlice.data();
+		const uint32_t* RESTRICT maximumSlice = mViewSpaceLights.maximumSlice.data();
+
+		// The tile tangents are the same for all depth slices: "tangent = (tileIndex - halfNumberOfTiles) / tileScale"
+		const float halfClusterX = static_cast<float>(::detail::CLUSTER_X) * 0.5f;
+		const float halfClusterY = static_cast<float>(::detail::CLUSTER_Y) * 0.5f;
+		const float inverseTileScaleX = 1.0f / mLightClustersTileScale.x;
+		const float inverseTileScaleY = 1.0f / mLightClustersTileScale.y;
+		const float depthRatio = mLightClustersFarZ / mLightClustersNearZ;
+		const ::detail::float4 zero(0.0f);
+
+		for (uint32_t sliceIndex = sliceIndexStart; sliceIndex < sliceIndexEnd; ++sliceIndex)
 		{
-			// Loop through all scene items attached to the current scene node
-			for (ISceneItem* sceneItem : sceneNode->getAttachedSceneItems())
+			// View space depth range of the current depth slice
+			const float sliceNearZ = mLightClustersNearZ * std::pow(depthRatio, static_cast<float>(sliceIndex) / ::detail::CLUSTER_Z);
+			const float sliceFarZ  = mLightClustersNearZ * std::pow(depthRatio, static_cast<float>(sliceIndex + 1) / ::detail::CLUSTER_Z);
+
+			// View space axis aligned bounding boxes of the clusters inside the current depth slice
+			alignas(16) float clusterMinimumX[::detail::CLUSTER_X];
+			alignas(16) float clusterMaximumX[::detail::CLUSTER_X];
+			float clusterMinimumY[::detail::CLUSTER_Y];
+			float clusterMaximumY[::detail::CLUSTER_Y];
+			for (uint32_t x = 0; x < ::detail::CLUSTER_X; ++x)
+			{
+				const float minimumTangent = (static_cast<float>(x) - halfClusterX) * inverseTileScaleX;
+				const float maximumTangent = (static_cast<float>(x + 1) - halfClusterX) * inverseTileScaleX;
+				clusterMinimumX[x] = std::min(minimumTangent * sliceNearZ, minimumTangent * sliceFarZ);
+				clusterMaximumX[x] = std::max(maximumTangent * sliceNearZ, maximumTangent * sliceFarZ);
+			}
+			for (uint32_t y = 0; y < ::detail::CLUSTER_Y; ++y)
+			{
+				const float minimumTangent = (static_cast<float>(y) - halfClusterY) * inverseTileScaleY;
+				const float maximumTangent = (static_cast<float>(y + 1) - halfClusterY) * inverseTileScaleY;
+				clusterMinimumY[y] = std::min(minimumTangent * sliceNearZ, minimumTangent * sliceFarZ);
+				clusterMaximumY[y] = std::max(maximumTangent * sliceNearZ, maximumTangent * sliceFarZ);
+			}
+
+			// Clear the light indices of the clusters inside the current depth slice, the capacity is kept
+			LightIndices* sliceLightIndices = &mClusterLightIndices[sliceIndex * ::detail::CLUSTER_X * ::detail::CLUSTER_Y];
+			for (uint32_t i = 0; i < ::detail::CLUSTER_X * ::detail::CLUSTER_Y; ++i)
+			{
+				sliceLightIndices[i].clear();
+			}
+
+			// Bin the lights touching the current depth slice
+			for (uint32_t lightIndex = 0; lightIndex < mNumberOfLights; ++lightIndex)
 			{
-				assert(currentLightIndex < 32);
-				if (sceneItem->getSceneItemTypeId() == LightSceneItem::TYPE_ID && currentLightIndex < 32)
+				if (sliceIndex < minimumSlice[lightIndex] || sliceIndex > maximumSlice[lightIndex])
+				{
+					continue;
+				}
+				const float lightX = positionX[lightIndex];
+				const float lightY = positionY[lightIndex];
+				const float lightZ = positionZ[lightIndex];
+				const float radius = radiusData[lightIndex];
+				const float squaredRadius = radius * radius;
+
+				// Conservative screen space tile range of the light sphere clipped to the current depth slice
+				const float nearZ = std::max(sliceNearZ, lightZ - radius);
+				const float farZ = std::min(sliceFarZ, lightZ + radius);
+				const float minimumTileX = std::min((lightX - radius) / nearZ, (lightX - radius) / farZ) * mLightClustersTileScale.x + halfClusterX;
+				const float maximumTileX = std::max((lightX + radius) / nearZ, (lightX + radius) / farZ) * mLightClustersTileScale.x + halfClusterX;
+				const float minimumTileY = std::min((lightY - radius) / nearZ, (lightY - radius) / farZ) * mLightClustersTileScale.y + halfClusterY;
+				const float maximumTileY = std::max((lightY + radius) / nearZ, (lightY + radius) / farZ) * mLightClustersTileScale.y + halfClusterY;
+				if (maximumTileX < 0.0f || minimumTileX >= static_cast<float>(::detail::CLUSTER_X) || maximumTileY < 0.0f || minimumTileY >= static_cast<float>(::detail::CLUSTER_Y))
+				{
+					// Outside of the view frustum
+					continue;
+				}
+				const uint32_t x0 = static_cast<uint32_t>(std::max(minimumTileX, 0.0f));
+				const uint32_t x1 = std::min(static_cast<uint32_t>(maximumTileX), ::detail::CLUSTER_X - 1);
+				const uint32_t y0 = static_cast<uint32_t>(std::max(minimumTileY, 0.0f));
+				const uint32_t y1 = std::min(static_cast<uint32_t>(maximumTileY), ::detail::CLUSTER_Y - 1);
+
+				// Do cluster AABB <-> sphere tests to figure out which clusters are actually intersected by the light, four clusters at once
+				float dz = std::max(std::max(sliceNearZ - lightZ, lightZ - sliceFarZ), 0.0f);
+				dz *= dz;
+				const ::detail::float4 simdLightX(lightX);
+				for (uint32_t y = y0; y <= y1; ++y)
 				{
-					LightSceneItem* lightSceneItem = static_cast<LightSceneItem*>(sceneItem);
-					if (lightSceneItem->getLightType() != LightSceneItem::LightType::DIRECTIONAL && lightSceneItem->isVisible())
+					float dy = std::max(std::max(clusterMinimumY[y] - lightY, lightY - clusterMaximumY[y]), 0.0f);
+					dy = dy * dy + dz;
+					if (dy >= squaredRadius)
 					{
-						const LightSceneItem::PackedShaderData& packedShaderData = lightSceneItem->mPackedShaderData;
-
-						const glm::vec3 p = (packedShaderData.position - mLightClustersAabbMinimum);
-						const glm::vec3 p_min = (p - packedShaderData.radius) * scale;
-						const glm::vec3 p_max = (p + packedShaderData.radius) * scale;
-
-						// Cluster for the center of the light
-						const int px = static_cast<int>(std::floor(p.x * scale.x));
-						const int py = static_cast<int>(std::floor(p.y * scale.y));
-						const int pz = static_cast<int>(std::floor(p.z * scale.z));
-
-						// Cluster bounds for the light
-						const int x0 = std::max(static_cast<int>(std::floor(p_min.x)), 0);
-						const int x1 = std::min(static_cast<int>(std::ceil(p_max.x)), static_cast<int>(::detail::CLUSTER_X));
-						const int y0 = std::max(static_cast<int>(std::floor(p_min.y)), 0);
-						const int y1 = std::min(static_cast<int>(std::ceil(p_max.y)), static_cast<int>(::detail::CLUSTER_Y));
-						const int z0 = std::max(static_cast<int>(std::floor(p_min.z)), 0);
-						const int z1 = std::min(static_cast<int>(std::ceil(p_max.z)), static_cast<int>(::detail::CLUSTER_Z));
-
-						const float squaredRadius = packedShaderData.radius * packedShaderData.radius;
-						const int mask = (1 << currentLightIndex);
-
-						// Do AABB <-> sphere tests to figure out which clusters are actually intersected by the light
-						for (int z = z0; z < z1; ++z)
+						continue;
+					}
+					const ::detail::float4 simdDyz(dy);
+					const ::detail::float4 simdSquaredRadius(squaredRadius);
+					LightIndices* rowLightIndices = &sliceLightIndices[y * ::detail::CLUSTER_X];
+					for (uint32_t simdX = x0 & ~3u; simdX <= x1; simdX += 4)
+					{
+						const ::detail::float4 minimumX = xsimd::load_aligned(&clusterMinimumX[simdX]);
+						const ::detail::float4 maximumX = xsimd::load_aligned(&clusterMaximumX[simdX]);
+						const ::detail::float4 dx = xsimd::max(xsimd::max(minimumX - simdLightX, simdLightX - maximumX), zero);
+						const ::detail::float4 squaredDistance = dx * dx + simdDyz;
+						alignas(16) float intersects[4];
+						xsimd::select(squaredDistance < simdSquaredRadius, ::detail::float4(1.0f), zero).store_aligned(intersects);
+						for (uint32_t i = 0; i < 4; ++i)
 						{
-							float dz = (pz == z) ? 0.0f : mLightClustersAabbMinimum.z + ((pz < z) ? z : z + 1) * inverseScale.z - packedShaderData.position.z;
-							dz *= dz;
-
-							for (int y = y0; y < y1; ++y)
+							const uint32_t x = simdX + i;
+							if (0.0f != intersects[i] && x >= x0 && x <= x1)
 							{
-								float dy = (py == y) ? 0.0f : mLightClustersAabbMinimum.y + ((py < y) ? y : y + 1) * inverseScale.y - packedShaderData.position.y;
-								dy *= dy;
-								dy += dz;
-
-								for (int x = x0; x < x1; ++x)
-								{
-									float dx = (px == x) ? 0.0f : mLightClustersAabbMinimum.x + ((px < x) ? x : x + 1) * inverseScale.x - packedShaderData.position.x;
-									dx *= dx;
-									dx += dy;
-
-									if (dx < squaredRadius)
-									{
-										lights[z][y][x] |= mask;
-									}
-								}
+								rowLightIndices[x].push_back(lightIndex);
 							}
 						}
+					}
+				}
+			}
+		}
+	}
 
-						// Done, next light
-						++currentLightIndex;
+	#ifdef _DEBUG
+		void LightBufferManager::validateLightClusters() const
+		{
+			// Brute-force reference: Test every light against every cluster using scalar math only
+			// -> A light must be inside every cluster whose center is inside the light sphere (binning is conservative)
+			// -> A light must not be inside a cluster whose view space axis aligned bounding box doesn't intersect the light sphere (binning is tight)
+			const float halfClusterX = static_cast<float>(::detail::CLUSTER_X) * 0.5f;
+			const float halfClusterY = static_cast<float>(::detail::CLUSTER_Y) * 0.5f;
+			const float inverseTileScaleX = 1.0f / mLightClustersTileScale.x;
+			const float inverseTileScaleY = 1.0f / mLightClustersTileScale.y;
+			const float depthRatio = mLightClustersFarZ / mLightClustersNearZ;
+			for (uint32_t z = 0; z < ::detail::CLUSTER_Z; ++z)
+			{
+				const float sliceNearZ = mLightClustersNearZ * std::pow(depthRatio, static_cast<float>(z) / ::detail::CLUSTER_Z);
+				const float sliceFarZ  = mLightClustersNearZ * std::pow(depthRatio, static_cast<float>(z + 1) / ::detail::CLUSTER_Z);
+				const float sliceCenterZ = mLightClustersNearZ * std::pow(depthRatio, (static_cast<float>(z) + 0.5f) / ::detail::CLUSTER_Z);
+				for (uint32_t y = 0; y < ::detail::CLUSTER_Y; ++y)
+				{
+					const float minimumTangentY = (static_cast<float>(y) - halfClusterY) * inverseTileScaleY;
+					const float maximumTangentY = (static_cast<float>(y + 1) - halfClusterY) * inverseTileScaleY;
+					for (uint32_t x = 0; x < ::detail::CLUSTER_X; ++x)
+					{
+						const float minimumTangentX = (static_cast<float>(x) - halfClusterX) * inverseTileScaleX;
+						const float maximumTangentX = (static_cast<float>(x + 1) - halfClusterX) * inverseTileScaleX;
+						const glm::vec3 aabbMinimum(std::min(minimumTangentX * sliceNearZ, minimumTangentX * sliceFarZ), std::min(minimumTangentY * sliceNearZ, minimumTangentY * sliceFarZ), sliceNearZ);
+						const glm::vec3 aabbMaximum(std::max(maximumTangentX * sliceNearZ, maximumTangentX * sliceFarZ), std::max(maximumTangentY * sliceNearZ, maximumTangentY * sliceFarZ), sliceFarZ);
+						const glm::vec3 center((minimumTangentX + maximumTangentX) * 0.5f * sliceCenterZ, (minimumTangentY + maximumTangentY) * 0.5f * sliceCenterZ, sliceCenterZ);
+						const LightIndices& lightIndices = mClusterLightIndices[(z * ::detail::CLUSTER_Y + y) * ::detail::CLUSTER_X + x];
+						for (uint32_t lightIndex = 0; lightIndex < mNumberOfLights; ++lightIndex)
+						{
+							const glm::vec3 lightPosition(mViewSpaceLights.positionX[lightIndex], mViewSpaceLights.positionY[lightIndex], mViewSpaceLights.positionZ[lightIndex]);
+							const float squaredRadius = mViewSpaceLights.radius[lightIndex] * mViewSpaceLights.radius[lightIndex];
+							const bool binned = (std::find(lightIndices.cbegin(), lightIndices.cend(), lightIndex) != lightIndices.cend());
+							const glm::vec3 distance = glm::max(glm::max(aabbMinimum - lightPosition, lightPosition - aabbMaximum), glm::vec3(0.0f));
+							assert((!binned || glm::dot(distance, distance) < squaredRadius * 1.001f) && "Light buffer manager binned a light into a cluster it doesn't touch");
+							const glm::vec3 centerDistance = center - lightPosition;
+							assert((binned || glm::dot(centerDistance, centerDistance) >= squaredRadius * 0.999f) && "Light buffer manager missed a light touching a cluster");
+							std::ignore = binned;
+						}
 					}
 				}
 			}
 		}
+	#endif
+
+	void LightBufferManager::fillTextureBuffer()
+	{
+		// Update the texture buffer by using our scratch buffer: Light data followed by the flat light index list
+		const uint32_t numberOfLightIndexListScalars = (mClusters3DTextureData.back() >> 8) + (mClusters3DTextureData.back() & 0xFF);
+		const uint32_t numberOfBytes = std::min(static_cast<uint32_t>(mTextureScratchBuffer.size()), Math::makeMultipleOf(numberOfLightIndexListScalars, 4) * static_cast<uint32_t>(sizeof(float)));
+		if (0 != mNumberOfLights && 0 != numberOfBytes)
+		{
+			Renderer::MappedSubresource mappedSubresource;
+			Renderer::IRenderer& renderer = mRendererRuntime.getRenderer();
+			if (renderer.map(*mTextureBuffer, 0, Renderer::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			{
+				memcpy(mappedSubresource.data, mTextureScratchBuffer.data(), numberOfBytes);
+				renderer.unmap(*mTextureBuffer, 0);
+			}
+		}
+	}
 
+	void LightBufferManager::fillClusters3DTexture()
+	{
 		// Upload the cluster data to a volume texture
 		Renderer::ITexturePtr texturePtr = mRendererRuntime.getTextureResourceManager().getById(mClusters3DTextureResourceId).getTexture();
 		assert(nullptr != texturePtr.getPointer());
@@ -307,7 +571,7 @@ namespace RendererRuntime
 		Renderer::IRenderer& renderer = mRendererRuntime.getRenderer();
 		if (renderer.map(*texture3D, 0, Renderer::MapType::WRITE_DISCARD, 0, mappedSubresource))
 		{
-			memcpy(mappedSubresource.data, lights, ::detail::CLUSTER_X * ::detail::CLUSTER_Y * ::detail::CLUSTER_Z * sizeof(uint32_t));
+			memcpy(mappedSubresource.data, mClusters3DTextureData.data(), ::detail::NUMBER_OF_CLUSTERS * sizeof(uint32_t));
 			renderer.unmap(*texture3D, 0);
 		}
 	}
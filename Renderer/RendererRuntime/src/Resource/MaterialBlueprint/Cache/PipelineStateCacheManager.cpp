@@ -27,8 +27,77 @@
 #include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateCache.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResource.h"
+#include "RendererRuntime/Resource/VertexAttributes/VertexAttributesResourceManager.h"
+#include "RendererRuntime/Resource/VertexAttributes/VertexAttributesResource.h"
+#include "RendererRuntime/Asset/AssetManager.h"
+#include "RendererRuntime/Core/File/IFile.h"
+#include "RendererRuntime/Core/Math/Math.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4548)	// warning C4548: expression before comma has no effect; expected expression with side-effect
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <algorithm>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		struct PipelineStateSignatureEntry final
+		{
+			uint32_t							 serializedPipelineStateHash = RendererRuntime::getUninitialized<uint32_t>();
+			bool								 hasSerializedPipelineState  = false;
+			Renderer::SerializedPipelineState	 serializedPipelineState;
+			RendererRuntime::ShaderProperties	 shaderProperties;
+			RendererRuntime::DynamicShaderPieces dynamicShaderPieces[RendererRuntime::NUMBER_OF_SHADER_TYPES];
+		};
+
+		// Serialized pipeline state hash, serialized pipeline state flag, number of shader properties and number of dynamic shader pieces per shader type
+		static const uint32_t MINIMUM_NUMBER_OF_PIPELINE_STATE_SIGNATURE_BYTES = sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint32_t) * RendererRuntime::NUMBER_OF_SHADER_TYPES;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		bool readCacheData(RendererRuntime::IFile& file, uint32_t& numberOfRemainingBytes, void* destinationBuffer, size_t numberOfBytes)
+		{
+			if (numberOfBytes > numberOfRemainingBytes)
+			{
+				// The pipeline state object cache is corrupt
+				return false;
+			}
+			if (numberOfBytes > 0)
+			{
+				file.read(destinationBuffer, numberOfBytes);
+				numberOfRemainingBytes -= static_cast<uint32_t>(numberOfBytes);
+			}
+			return true;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -45,10 +114,11 @@ namespace RendererRuntime
 		// TODO(co) Asserts whether or not e.g. the material resource is using the owning material resource blueprint
 		assert(IResource::LoadingState::LOADED == mMaterialBlueprintResource.getLoadingState());
 
-		// Generate the pipeline state signature
-		mTemporaryPipelineStateSignature.set(mMaterialBlueprintResource, serializedPipelineStateHash, shaderProperties, dynamicShaderPieces);
+		// Generate the pipeline state signature ID, this doesn't copy anything so the usual case of an already known pipeline state signature is free of memory allocations
+		PipelineStateSignature::DynamicShaderPiecesHashes dynamicShaderPiecesHashes;
+		PipelineStateSignature::generateDynamicShaderPiecesHashes(dynamicShaderPieces, dynamicShaderPiecesHashes);
 		{
-			PipelineStateCacheByPipelineStateSignatureId::const_iterator iterator = mPipelineStateCacheByPipelineStateSignatureId.find(mTemporaryPipelineStateSignature.getPipelineStateSignatureId());
+			PipelineStateCacheByPipelineStateSignatureId::const_iterator iterator = mPipelineStateCacheByPipelineStateSignatureId.find(PipelineStateSignature::generatePipelineStateSignatureId(mMaterialBlueprintResource, serializedPipelineStateHash, shaderProperties, dynamicShaderPiecesHashes));
 			if (iterator != mPipelineStateCacheByPipelineStateSignatureId.cend())
 			{
 				// There's already a pipeline state cache for the pipeline state signature ID
@@ -71,7 +141,9 @@ namespace RendererRuntime
 			// do this by reducing the shader properties set until we find something, hopefully. In case no fallback can be found we have to switch to synchronous processing.
 
 			// Start with the full shader properties and then clear one shader property after another
-			ShaderProperties fallbackShaderProperties(shaderProperties);	// TODO(co) Optimization: There are allocations for vector involved in here, we might want to get rid of this
+			// -> The dynamic shader pieces don't change, so their hashes are reused for each fallback pipeline state signature ID
+			// -> Only reached for unknown pipeline state signatures which are going to create a new pipeline state cache anyway, so a local copy is fine
+			ShaderProperties fallbackShaderProperties(shaderProperties);
 			ShaderProperties::SortedPropertyVector& sortedFallbackPropertyVector = fallbackShaderProperties.getSortedPropertyVector();
 			while (nullptr == fallbackPipelineStateCache && !sortedFallbackPropertyVector.empty())
 			{
@@ -115,9 +187,8 @@ namespace RendererRuntime
 					sortedFallbackPropertyVector.erase(worstHitShaderPropertyIterator);
 				}
 
-				// Generate the current fallback pipeline state signature
-				PipelineStateSignature fallbackPipelineStateSignature(mMaterialBlueprintResource, serializedPipelineStateHash, fallbackShaderProperties, dynamicShaderPieces);	// TODO(co) Optimization: There are allocations for vector and map involved in here, we might want to get rid of those
-				PipelineStateCacheByPipelineStateSignatureId::const_iterator iterator = mPipelineStateCacheByPipelineStateSignatureId.find(fallbackPipelineStateSignature.getPipelineStateSignatureId());
+				// Generate the current fallback pipeline state signature ID
+				PipelineStateCacheByPipelineStateSignatureId::const_iterator iterator = mPipelineStateCacheByPipelineStateSignatureId.find(PipelineStateSignature::generatePipelineStateSignatureId(mMaterialBlueprintResource, serializedPipelineStateHash, fallbackShaderProperties, dynamicShaderPiecesHashes));
 				if (iterator != mPipelineStateCacheByPipelineStateSignatureId.cend())
 				{
 					// We don't care whether or not the pipeline state cache is currently using fallback data due to asynchronous complication
@@ -131,9 +202,8 @@ namespace RendererRuntime
 			//    might not involve our first born.
 			if (!allowEmergencySynchronousCompilation && nullptr == fallbackPipelineStateCache)
 			{
-				// TODO(co) Optimization: There are allocations for vector and map involved in here, we might want to get rid of those
 				fallbackShaderProperties.clear();
-				PipelineStateCacheByPipelineStateSignatureId::const_iterator iterator = mPipelineStateCacheByPipelineStateSignatureId.find(PipelineStateSignature(mMaterialBlueprintResource, serializedPipelineStateHash, fallbackShaderProperties, dynamicShaderPieces).getPipelineStateSignatureId());
+				PipelineStateCacheByPipelineStateSignatureId::const_iterator iterator = mPipelineStateCacheByPipelineStateSignatureId.find(PipelineStateSignature::generatePipelineStateSignatureId(mMaterialBlueprintResource, serializedPipelineStateHash, fallbackShaderProperties, dynamicShaderPiecesHashes));
 				if (iterator != mPipelineStateCacheByPipelineStateSignatureId.cend())
 				{
 					// We don't care whether or not the pipeline state cache is currently using fallback data due to asynchronous complication
@@ -142,7 +212,8 @@ namespace RendererRuntime
 			}
 		}
 
-		// Create the new pipeline state cache instance
+		// Create the new pipeline state cache instance, only now the complete pipeline state signature is needed
+		mTemporaryPipelineStateSignature.set(mMaterialBlueprintResource, serializedPipelineStateHash, shaderProperties, dynamicShaderPieces);
 		PipelineStateCache* pipelineStateCache = new PipelineStateCache(mTemporaryPipelineStateSignature);
 		mPipelineStateCacheByPipelineStateSignatureId.emplace(mTemporaryPipelineStateSignature.getPipelineStateSignatureId(), pipelineStateCache);
 
@@ -161,7 +232,7 @@ namespace RendererRuntime
 		}
 
 		// Done
-		// TODO(co) Mark material cache as dirty
+		mPipelineStateObjectCacheNeedsSaving = true;
 		return pipelineStateCache->getPipelineStateObjectPtr();
 	}
 
@@ -172,6 +243,218 @@ namespace RendererRuntime
 			delete pipelineStateCacheElement.second;
 		}
 		mPipelineStateCacheByPipelineStateSignatureId.clear();
+		mPipelineStateObjectCacheNeedsSaving = true;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	bool PipelineStateCacheManager::loadPipelineStateObjectCache(IFile& file, uint32_t numberOfBytes)
+	{
+		// The counts inside the file can't be trusted, each one is validated against the remaining number of bytes of the
+		// material blueprint cache entry before it's used to allocate or read anything. The whole entry is parsed before
+		// anything is applied, so a corrupt entry doesn't leave behind e.g. serialized pipeline states built from garbage.
+		uint32_t numberOfRemainingBytes = numberOfBytes;
+
+		// Read the header and check whether or not the pipeline state signatures are still valid
+		uint64_t combinedAssetFileHashes = getUninitialized<uint64_t>();
+		uint32_t numberOfPipelineStateSignatures = 0;
+		if (!::detail::readCacheData(file, numberOfRemainingBytes, &combinedAssetFileHashes, sizeof(uint64_t)) ||
+			!::detail::readCacheData(file, numberOfRemainingBytes, &numberOfPipelineStateSignatures, sizeof(uint32_t)) ||
+			numberOfPipelineStateSignatures > numberOfRemainingBytes / ::detail::MINIMUM_NUMBER_OF_PIPELINE_STATE_SIGNATURE_BYTES)
+		{
+			return false;
+		}
+		const bool upToDate = (calculateCombinedAssetFileHashes() == combinedAssetFileHashes);
+
+		// Read the pipeline state signatures
+		std::vector< ::detail::PipelineStateSignatureEntry> pipelineStateSignatureEntries(numberOfPipelineStateSignatures);
+		for (::detail::PipelineStateSignatureEntry& pipelineStateSignatureEntry : pipelineStateSignatureEntries)
+		{
+			{ // Serialized pipeline state
+				uint8_t hasSerializedPipelineState = 0;
+				if (!::detail::readCacheData(file, numberOfRemainingBytes, &pipelineStateSignatureEntry.serializedPipelineStateHash, sizeof(uint32_t)) ||
+					!::detail::readCacheData(file, numberOfRemainingBytes, &hasSerializedPipelineState, sizeof(uint8_t)))
+				{
+					return false;
+				}
+				pipelineStateSignatureEntry.hasSerializedPipelineState = (0 != hasSerializedPipelineState);
+				if (pipelineStateSignatureEntry.hasSerializedPipelineState && !::detail::readCacheData(file, numberOfRemainingBytes, &pipelineStateSignatureEntry.serializedPipelineState, sizeof(Renderer::SerializedPipelineState)))
+				{
+					return false;
+				}
+			}
+
+			{ // Shader properties
+				uint32_t numberOfShaderProperties = 0;
+				if (!::detail::readCacheData(file, numberOfRemainingBytes, &numberOfShaderProperties, sizeof(uint32_t)) ||
+					numberOfShaderProperties > numberOfRemainingBytes / sizeof(ShaderProperties::Property))
+				{
+					return false;
+				}
+				ShaderProperties::SortedPropertyVector& sortedPropertyVector = pipelineStateSignatureEntry.shaderProperties.getSortedPropertyVector();
+				sortedPropertyVector.resize(numberOfShaderProperties);
+				::detail::readCacheData(file, numberOfRemainingBytes, sortedPropertyVector.data(), sizeof(ShaderProperties::Property) * numberOfShaderProperties);
+			}
+
+			// Dynamic shader pieces
+			for (uint8_t shaderType = 0; shaderType < NUMBER_OF_SHADER_TYPES; ++shaderType)
+			{
+				uint32_t numberOfDynamicShaderPieces = 0;
+				if (!::detail::readCacheData(file, numberOfRemainingBytes, &numberOfDynamicShaderPieces, sizeof(uint32_t)))
+				{
+					return false;
+				}
+				DynamicShaderPieces& dynamicShaderPieces = pipelineStateSignatureEntry.dynamicShaderPieces[shaderType];
+				for (uint32_t dynamicShaderPieceIndex = 0; dynamicShaderPieceIndex < numberOfDynamicShaderPieces; ++dynamicShaderPieceIndex)
+				{
+					uint32_t dynamicShaderPieceId = getUninitialized<uint32_t>();
+					uint32_t numberOfSourceCodeBytes = 0;
+					if (!::detail::readCacheData(file, numberOfRemainingBytes, &dynamicShaderPieceId, sizeof(uint32_t)) ||
+						!::detail::readCacheData(file, numberOfRemainingBytes, &numberOfSourceCodeBytes, sizeof(uint32_t)) ||
+						numberOfSourceCodeBytes > numberOfRemainingBytes)
+					{
+						return false;
+					}
+					std::string& dynamicShaderPieceSourceCode = dynamicShaderPieces[StringId(dynamicShaderPieceId)];
+					dynamicShaderPieceSourceCode.resize(numberOfSourceCodeBytes);
+					::detail::readCacheData(file, numberOfRemainingBytes, &dynamicShaderPieceSourceCode[0], numberOfSourceCodeBytes);
+				}
+			}
+		}
+
+		// The pipeline state signatures must consume the material blueprint cache entry exactly
+		if (0 != numberOfRemainingBytes)
+		{
+			return false;
+		}
+
+		// Create the pipeline state caches
+		// -> The entries are sorted by the number of shader properties, so the pipeline state caches created first are able to act as fallback for the following ones
+		// -> Emergency synchronous compilation is allowed since we're not inside a frame and the first pipeline state cache has no fallback
+		if (upToDate)
+		{
+			MaterialBlueprintResourceManager& materialBlueprintResourceManager = mMaterialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>();
+			for (const ::detail::PipelineStateSignatureEntry& pipelineStateSignatureEntry : pipelineStateSignatureEntries)
+			{
+				// The pipeline state compiler is going to need the serialized pipeline state before the material resource using it might have been loaded
+				if (pipelineStateSignatureEntry.hasSerializedPipelineState)
+				{
+					materialBlueprintResourceManager.addSerializedPipelineState(pipelineStateSignatureEntry.serializedPipelineStateHash, pipelineStateSignatureEntry.serializedPipelineState);
+				}
+				getPipelineStateCacheByCombination(pipelineStateSignatureEntry.serializedPipelineStateHash, pipelineStateSignatureEntry.shaderProperties, pipelineStateSignatureEntry.dynamicShaderPieces, true);
+			}
+		}
+
+		// Done
+		mPipelineStateObjectCacheNeedsSaving = !upToDate;
+		return true;
+	}
+
+	void PipelineStateCacheManager::savePipelineStateObjectCache(IFile& file)
+	{
+		// Write the header
+		const uint64_t combinedAssetFileHashes = calculateCombinedAssetFileHashes();
+		file.write(&combinedAssetFileHashes, sizeof(uint64_t));
+		const uint32_t numberOfPipelineStateSignatures = static_cast<uint32_t>(mPipelineStateCacheByPipelineStateSignatureId.size());
+		file.write(&numberOfPipelineStateSignatures, sizeof(uint32_t));
+
+		// Sort the pipeline state caches by the number of shader properties so the ones created first while loading are able to act as fallback for the following ones
+		std::vector<const PipelineStateSignature*> pipelineStateSignatures;
+		pipelineStateSignatures.reserve(numberOfPipelineStateSignatures);
+		for (const auto& pipelineStateCacheElement : mPipelineStateCacheByPipelineStateSignatureId)
+		{
+			pipelineStateSignatures.push_back(&pipelineStateCacheElement.second->getPipelineStateSignature());
+		}
+		std::sort(pipelineStateSignatures.begin(), pipelineStateSignatures.end(), [](const PipelineStateSignature* left, const PipelineStateSignature* right)
+			{
+				const size_t leftNumberOfShaderProperties = left->getShaderProperties().getSortedPropertyVector().size();
+				const size_t rightNumberOfShaderProperties = right->getShaderProperties().getSortedPropertyVector().size();
+				return (leftNumberOfShaderProperties == rightNumberOfShaderProperties) ? (left->getPipelineStateSignatureId() < right->getPipelineStateSignatureId()) : (leftNumberOfShaderProperties < rightNumberOfShaderProperties);
+			});
+
+		// Write the pipeline state signatures
+		MaterialBlueprintResourceManager& materialBlueprintResourceManager = mMaterialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>();
+		for (const PipelineStateSignature* pipelineStateSignature : pipelineStateSignatures)
+		{
+			{ // Serialized pipeline state
+				const uint32_t serializedPipelineStateHash = pipelineStateSignature->getSerializedPipelineStateHash();
+				file.write(&serializedPipelineStateHash, sizeof(uint32_t));
+				Renderer::SerializedPipelineState serializedPipelineState;
+				const uint8_t hasSerializedPipelineState = materialBlueprintResourceManager.getSerializedPipelineState(serializedPipelineStateHash, serializedPipelineState) ? 1u : 0u;
+				file.write(&hasSerializedPipelineState, sizeof(uint8_t));
+				if (0 != hasSerializedPipelineState)
+				{
+					file.write(&serializedPipelineState, sizeof(Renderer::SerializedPipelineState));
+				}
+			}
+
+			{ // Shader properties
+				const ShaderProperties::SortedPropertyVector& sortedPropertyVector = pipelineStateSignature->getShaderProperties().getSortedPropertyVector();
+				const uint32_t numberOfShaderProperties = static_cast<uint32_t>(sortedPropertyVector.size());
+				file.write(&numberOfShaderProperties, sizeof(uint32_t));
+				if (numberOfShaderProperties > 0)
+				{
+					file.write(sortedPropertyVector.data(), sizeof(ShaderProperties::Property) * numberOfShaderProperties);
+				}
+			}
+
+			// Dynamic shader pieces
+			for (uint8_t shaderType = 0; shaderType < NUMBER_OF_SHADER_TYPES; ++shaderType)
+			{
+				const DynamicShaderPieces& dynamicShaderPieces = pipelineStateSignature->getDynamicShaderPieces(static_cast<ShaderType>(shaderType));
+				const uint32_t numberOfDynamicShaderPieces = static_cast<uint32_t>(dynamicShaderPieces.size());
+				file.write(&numberOfDynamicShaderPieces, sizeof(uint32_t));
+				for (const auto& dynamicShaderPiecesElement : dynamicShaderPieces)
+				{
+					const uint32_t dynamicShaderPieceId = dynamicShaderPiecesElement.first;
+					file.write(&dynamicShaderPieceId, sizeof(uint32_t));
+					const uint32_t numberOfBytes = static_cast<uint32_t>(dynamicShaderPiecesElement.second.size());
+					file.write(&numberOfBytes, sizeof(uint32_t));
+					file.write(dynamicShaderPiecesElement.second.data(), numberOfBytes);
+				}
+			}
+		}
+
+		// Done
+		mPipelineStateObjectCacheNeedsSaving = false;
+	}
+
+	uint64_t PipelineStateCacheManager::calculateCombinedAssetFileHashes() const
+	{
+		// Combine the asset file hashes of the assets (material blueprint, vertex attributes, shader blueprints) the pipeline state signatures depend on
+		const IRendererRuntime& rendererRuntime = mMaterialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().getRendererRuntime();
+		const AssetManager& assetManager = rendererRuntime.getAssetManager();
+		uint64_t combinedAssetFileHashes = Math::FNV1a_INITIAL_HASH_64;
+		const auto combineAssetFileHash = [&assetManager, &combinedAssetFileHashes](AssetId assetId)
+		{
+			const Asset* asset = assetManager.tryGetAssetByAssetId(assetId);
+			if (nullptr != asset)
+			{
+				combinedAssetFileHashes = Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&asset->fileHash), sizeof(uint64_t), combinedAssetFileHashes);
+			}
+		};
+		combineAssetFileHash(mMaterialBlueprintResource.getAssetId());
+		{ // Vertex attributes
+			const VertexAttributesResource* vertexAttributesResource = rendererRuntime.getVertexAttributesResourceManager().tryGetById(mMaterialBlueprintResource.getVertexAttributesResourceId());
+			if (nullptr != vertexAttributesResource)
+			{
+				combineAssetFileHash(vertexAttributesResource->getAssetId());
+			}
+		}
+		const ShaderBlueprintResourceManager& shaderBlueprintResourceManager = rendererRuntime.getShaderBlueprintResourceManager();
+		for (uint8_t shaderType = 0; shaderType < NUMBER_OF_SHADER_TYPES; ++shaderType)
+		{
+			const ShaderBlueprintResource* shaderBlueprintResource = shaderBlueprintResourceManager.tryGetById(mMaterialBlueprintResource.getShaderBlueprintResourceId(static_cast<ShaderType>(shaderType)));
+			if (nullptr != shaderBlueprintResource)
+			{
+				combineAssetFileHash(shaderBlueprintResource->getAssetId());
+			}
+		}
+
+		// Done
+		return combinedAssetFileHashes;
 	}
 
 
@@ -29,11 +29,14 @@
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderBuilder.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderCache.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/IShaderBytecodeCompiler.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResource.h"
 #include "RendererRuntime/Resource/VertexAttributes/VertexAttributesResourceManager.h"
 #include "RendererRuntime/Resource/VertexAttributes/VertexAttributesResource.h"
 #include "RendererRuntime/Core/Platform/PlatformManager.h"
+#include "RendererRuntime/Core/Time/CpuProfiler.h"
+#include "RendererRuntime/Core/Time/Stopwatch.h"
 #include "RendererRuntime/IRendererRuntime.h"
 #include "RendererRuntime/Core/Math/Math.h"
 
@@ -68,12 +71,42 @@ namespace RendererRuntime
 		}
 	}
 
+	void PipelineStateCompiler::setNumberOfBuilderThreads(uint32_t numberOfBuilderThreads)
+	{
+		if (mNumberOfBuilderThreads != numberOfBuilderThreads)
+		{
+			// Builder threads shutdown
+			{
+				std::lock_guard<std::mutex> builderMutexLock(mBuilderMutex);
+				mShutdownBuilderThread = true;
+			}
+			mBuilderConditionVariable.notify_all();
+			for (std::thread& thread : mBuilderThreads)
+			{
+				thread.join();
+			}
+
+			// Create the builder threads building the shader source codes
+			mNumberOfBuilderThreads = numberOfBuilderThreads;
+			mBuilderThreads.clear();
+			mBuilderThreads.reserve(mNumberOfBuilderThreads);
+			mShutdownBuilderThread = false;
+			for (uint32_t i = 0; i < mNumberOfBuilderThreads; ++i)
+			{
+				mBuilderThreads.push_back(std::thread(&PipelineStateCompiler::builderThreadWorker, this));
+			}
+		}
+	}
+
 	void PipelineStateCompiler::setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads)
 	{
 		if (mNumberOfCompilerThreads != numberOfCompilerThreads)
 		{
 			// Compiler threads shutdown
-			mShutdownCompilerThread = true;
+			{
+				std::lock_guard<std::mutex> compilerMutexLock(mCompilerMutex);
+				mShutdownCompilerThread = true;
+			}
 			mCompilerConditionVariable.notify_all();
 			for (std::thread& thread : mCompilerThreads)
 			{
@@ -94,15 +127,20 @@ namespace RendererRuntime
 
 	void PipelineStateCompiler::dispatch()
 	{
+		RENDERER_RUNTIME_CPU_PROFILER_SCOPE_FUNCTION()
+
 		// Synchronous dispatch
 		// TODO(co) Add maximum dispatch time budget
-		// TODO(co) More clever mutex usage in order to reduce pipeline state compiler stalls due to synchronization
-		std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-		while (!mDispatchQueue.empty())
+		// -> Only swap the dispatch queue while the mutex is locked, this way the compiler threads are never blocked by the dispatch itself
+		CompilerRequests dispatchQueue;
+		{
+			std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
+			std::swap(dispatchQueue, mDispatchQueue);
+		}
+		while (!dispatchQueue.empty())
 		{
 			// Get the compiler request
-			CompilerRequest compilerRequest(mDispatchQueue.back());
-			mDispatchQueue.pop_back();
+			const CompilerRequest& compilerRequest = dispatchQueue.back();
 
 			// Tell the pipeline state cache about the real compiled pipeline state object
 			PipelineStateCache& pipelineStateCache = compilerRequest.pipelineStateCache;
@@ -110,6 +148,7 @@ namespace RendererRuntime
 			pipelineStateCache.mIsUsingFallback = false;
 			assert(0 != mNumberOfInFlightCompilerRequests);
 			--mNumberOfInFlightCompilerRequests;
+			dispatchQueue.pop_back();
 		}
 	}
 
@@ -120,24 +159,30 @@ namespace RendererRuntime
 	PipelineStateCompiler::PipelineStateCompiler(IRendererRuntime& rendererRuntime) :
 		mRendererRuntime(rendererRuntime),
 		mAsynchronousCompilationEnabled(false),
+		mNumberOfBuilderThreads(0),
 		mNumberOfCompilerThreads(0),
 		mNumberOfInFlightCompilerRequests(0),
 		mShutdownBuilderThread(false),
-		mBuilderThread(&PipelineStateCompiler::builderThreadWorker, this),
-		mShutdownCompilerThread(false)
+		mNumberOfBuildingCompilerRequests(0),
+		mShutdownCompilerThread(false),
+		mNumberOfCompilingCompilerRequests(0),
+		mNumberOfBuiltShaders(0),
+		mNumberOfReusedShaderSourceCodes(0),
+		mNumberOfDeferredBuilderRequests(0),
+		mNumberOfCompiledShaders(0),
+		mNumberOfCompiledPipelineStates(0),
+		mBuilderTimeInMicroseconds(0),
+		mCompilerTimeInMicroseconds(0)
 	{
 		// Create and start the threads
+		setNumberOfBuilderThreads(2);
 		setNumberOfCompilerThreads(2);
 	}
 
 	PipelineStateCompiler::~PipelineStateCompiler()
 	{
-		// Builder thread shutdown
-		mShutdownBuilderThread = true;
-		mBuilderConditionVariable.notify_one();
-		mBuilderThread.join();
-
-		// Compiler threads shutdown
+		// Builder and compiler threads shutdown
+		setNumberOfBuilderThreads(0);
 		setNumberOfCompilerThreads(0);
 	}
 
@@ -166,14 +211,15 @@ namespace RendererRuntime
 		}
 	}
 
-	void PipelineStateCompiler::flushQueue(std::mutex& mutex, const CompilerRequests& compilerRequests)
+	void PipelineStateCompiler::flushQueue(std::mutex& mutex, const CompilerRequests& compilerRequests, const std::atomic<uint32_t>& numberOfProcessedCompilerRequests)
 	{
 		bool everythingFlushed = false;
 		do
 		{
 			{ // Process
+				// -> Compiler requests currently processed by a thread are no longer inside the queue, but we still have to wait for them
 				std::lock_guard<std::mutex> compilerMutexLock(mutex);
-				everythingFlushed = compilerRequests.empty();
+				everythingFlushed = (compilerRequests.empty() && 0 == numberOfProcessedCompilerRequests);
 			}
 			dispatch();
 
@@ -195,28 +241,54 @@ namespace RendererRuntime
 		ShaderBuilder shaderBuilder;
 
 		RENDERER_RUNTIME_SET_CURRENT_THREAD_DEBUG_NAME("PSC: Stage 1", "Renderer runtime: Pipeline state compiler stage: 1. Asynchronous shader building");
+		std::unique_lock<std::mutex> builderMutexLock(mBuilderMutex);
 		while (!mShutdownBuilderThread)
 		{
 			// Continue as long as there's a compiler request left inside the queue, if it's empty go to sleep
-			std::unique_lock<std::mutex> builderMutexLock(mBuilderMutex);
-			mBuilderConditionVariable.wait(builderMutexLock);
+			mBuilderConditionVariable.wait(builderMutexLock, [this]() { return (!mBuilderQueue.empty() || mShutdownBuilderThread); });
 			while (!mBuilderQueue.empty() && !mShutdownBuilderThread)
 			{
 				// Get the compiler request
 				CompilerRequest compilerRequest(mBuilderQueue.back());
 				mBuilderQueue.pop_back();
+				++mNumberOfBuildingCompilerRequests;
 				builderMutexLock.unlock();
 
-				{ // Do the work: Building the shader source code for the required combination
+				// Do the work: Building the shader source code for the required combination
+				// -> Shader caches currently built by another builder thread are waited for, building them twice would be pointless
+				ShaderCacheId waitingShaderCacheIds[NUMBER_OF_SHADER_TYPES];
+				uint8_t numberOfWaitingShaderCacheIds = 0;
+				do
+				{
+					// Wait until the other builder threads are done with the shader caches we need, the compiler request keeps the shader caches it already got
+					if (0 != numberOfWaitingShaderCacheIds)
+					{
+						++mNumberOfDeferredBuilderRequests;
+						std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
+						mBuildingShaderCacheIdsConditionVariable.wait(shaderCacheManagerMutexLock, [this, &waitingShaderCacheIds, numberOfWaitingShaderCacheIds]()
+							{
+								for (uint8_t i = 0; i < numberOfWaitingShaderCacheIds; ++i)
+								{
+									if (mBuildingShaderCacheIds.find(waitingShaderCacheIds[i]) != mBuildingShaderCacheIds.cend())
+									{
+										return false;
+									}
+								}
+								return true;
+							});
+						numberOfWaitingShaderCacheIds = 0;
+					}
+
+					RENDERER_RUNTIME_CPU_PROFILER_SCOPE("Pipeline state compiler shader building")
 					const PipelineStateSignature& pipelineStateSignature = compilerRequest.pipelineStateCache.getPipelineStateSignature();
 					const MaterialBlueprintResource& materialBlueprintResource = materialBlueprintResourceManager.getById(pipelineStateSignature.getMaterialBlueprintResourceId());
 
 					for (uint8_t i = 0; i < NUMBER_OF_SHADER_TYPES; ++i)
 					{
-						// Get the shader blueprint resource ID
+						// Get the shader blueprint resource ID, skip shader caches we already got during a previous round
 						const ShaderType shaderType = static_cast<ShaderType>(i);
 						const ShaderBlueprintResourceId shaderBlueprintResourceId = materialBlueprintResource.getShaderBlueprintResourceId(shaderType);
-						if (isInitialized(shaderBlueprintResourceId))
+						if (isInitialized(shaderBlueprintResourceId) && nullptr == compilerRequest.shaderCache[i])
 						{
 							// Get the shader cache identifier, often but not always identical to the shader combination ID
 							const ShaderCacheId shaderCacheId = pipelineStateSignature.getShaderCombinationId(shaderType);
@@ -229,6 +301,12 @@ namespace RendererRuntime
 							{
 								shaderCache = shaderCacheIdIterator->second;
 							}
+							else if (mBuildingShaderCacheIds.find(shaderCacheId) != mBuildingShaderCacheIds.cend())
+							{
+								// Another builder thread is currently building the shader cache, wait for it and try again
+								waitingShaderCacheIds[numberOfWaitingShaderCacheIds] = shaderCacheId;
+								++numberOfWaitingShaderCacheIds;
+							}
 							else
 							{
 								// Try to create the new program cache instance
@@ -236,9 +314,23 @@ namespace RendererRuntime
 								if (nullptr != shaderBlueprintResource)
 								{
 									// Build the shader source code
+									// -> The shader cache manager mutex isn't locked while building so other builder threads can continue meanwhile
+									mBuildingShaderCacheIds.insert(shaderCacheId);
+									shaderCacheManagerMutexLock.unlock();
+									Stopwatch stopwatch(true);
 									ShaderBuilder::BuildShader buildShader;
 									shaderBuilder.createSourceCode(shaderPieceResourceManager, *shaderBlueprintResource, pipelineStateSignature.getShaderProperties(), buildShader);
 									const std::string& sourceCode = buildShader.sourceCode;
+
+									// Generate the shader source code ID
+									// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
+									// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
+									const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
+									mBuilderTimeInMicroseconds += static_cast<uint64_t>(stopwatch.stop());
+									++mNumberOfBuiltShaders;
+									shaderCacheManagerMutexLock.lock();
+									mBuildingShaderCacheIds.erase(shaderCacheId);
+									mBuildingShaderCacheIdsConditionVariable.notify_all();
 									if (sourceCode.empty())
 									{
 										// TODO(co) Error handling
@@ -246,17 +338,20 @@ namespace RendererRuntime
 									}
 									else
 									{
-										// Generate the shader source code ID
-										// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
-										// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
-										const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
+										// The synchronous shader cache manager processing might have created the shader cache meanwhile
+										shaderCacheIdIterator = shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderCacheId);
 										ShaderCacheManager::ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = shaderCacheManager.mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
-										if (shaderSourceCodeIdIterator != shaderCacheManager.mShaderCacheByShaderSourceCodeId.cend())
+										if (shaderCacheIdIterator != shaderCacheManager.mShaderCacheByShaderCacheId.cend())
+										{
+											shaderCache = shaderCacheIdIterator->second;
+										}
+										else if (shaderSourceCodeIdIterator != shaderCacheManager.mShaderCacheByShaderSourceCodeId.cend())
 										{
 											// Reuse already existing shader instance
 											// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
 											shaderCache = new ShaderCache(shaderCacheId, shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderSourceCodeIdIterator->second)->second);
 											shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+											++mNumberOfReusedShaderSourceCodes;
 										}
 										else
 										{
@@ -279,13 +374,15 @@ namespace RendererRuntime
 							compilerRequest.shaderCache[i] = shaderCache;
 						}
 					}
-				}
+				} while (0 != numberOfWaitingShaderCacheIds);
 
-				{ // Push the compiler request into the queue of the asynchronous shader compilation
+				// Push the compiler request into the queue of the asynchronous shader compilation
+				{
 					std::unique_lock<std::mutex> compilerMutexLock(mCompilerMutex);
 					mCompilerQueue.emplace_back(compilerRequest);
 					compilerMutexLock.unlock();
 					mCompilerConditionVariable.notify_one();
+					--mNumberOfBuildingCompilerRequests;
 				}
 
 				// We're ready for the next round
@@ -300,26 +397,65 @@ namespace RendererRuntime
 		if (nullptr != shaderLanguage)
 		{
 			const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRendererRuntime.getMaterialBlueprintResourceManager();
+			ShaderBlueprintResourceManager& shaderBlueprintResourceManager = mRendererRuntime.getShaderBlueprintResourceManager();
+			ShaderCacheManager& shaderCacheManager = shaderBlueprintResourceManager.getShaderCacheManager();
 			RENDERER_RUNTIME_SET_CURRENT_THREAD_DEBUG_NAME("PSC: Stage 2", "Renderer runtime: Pipeline state compiler stage: 2. Asynchronous shader compilation");
+			std::unique_lock<std::mutex> compilerMutexLock(mCompilerMutex);
 			while (!mShutdownCompilerThread)
 			{
 				// Continue as long as there's a compiler request left inside the queue, if it's empty go to sleep
-				std::unique_lock<std::mutex> compilerMutexLock(mCompilerMutex);
-				mCompilerConditionVariable.wait(compilerMutexLock);
+				mCompilerConditionVariable.wait(compilerMutexLock, [this]() { return (!mCompilerQueue.empty() || mShutdownCompilerThread); });
 				while (!mCompilerQueue.empty() && !mShutdownCompilerThread)
 				{
 					// Get the compiler request
 					CompilerRequest compilerRequest(mCompilerQueue.back());
 					mCompilerQueue.pop_back();
+					++mNumberOfCompilingCompilerRequests;
 					compilerMutexLock.unlock();
 
 					// Do the work: Compiling the shader source code it in order to get the shader bytecode
+					// -> During offline shader bytecode compilation the shader bytecode is all we need, there are no renderer shaders, programs or pipeline state objects
+					Stopwatch stopwatch(true);
+					IShaderBytecodeCompiler* shaderBytecodeCompiler = shaderBlueprintResourceManager.getShaderBytecodeCompiler();
 					bool needToWaitForShaderCache = false;
 					Renderer::IShader* shaders[NUMBER_OF_SHADER_TYPES] = {};
 					for (uint8_t i = 0; i < NUMBER_OF_SHADER_TYPES && !needToWaitForShaderCache; ++i)
 					{
 						ShaderCache* shaderCache = compilerRequest.shaderCache[i];
-						if (nullptr != shaderCache)
+						if (nullptr != shaderCache && nullptr != shaderBytecodeCompiler)
+						{
+							// Is the shader bytecode ready or do we need to compile it right now or is this the job of a shader cache master?
+							bool shaderBytecodeReady = false;
+							{
+								std::lock_guard<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
+								const ShaderCache* masterShaderCache = (nullptr != shaderCache->getMasterShaderCache()) ? shaderCache->getMasterShaderCache() : shaderCache;
+								shaderBytecodeReady = (0 != masterShaderCache->mShaderBytecode.getNumberOfBytes());
+							}
+							if (!shaderBytecodeReady)
+							{
+								const std::string& shaderSourceCode = compilerRequest.shaderSourceCode[i];
+								if (shaderSourceCode.empty())
+								{
+									// We're not aware of any shader source code but we need a shader cache, so, there must be a shader cache master or another compiler request compiling the shader we need to wait for
+									needToWaitForShaderCache = true;
+								}
+								else
+								{
+									// Compile the shader bytecode, the shader cache manager mutex isn't locked while compiling so the other compiler threads can continue meanwhile
+									RENDERER_RUNTIME_CPU_PROFILER_SCOPE("Pipeline state compiler shader compilation")
+									Renderer::ShaderBytecode shaderBytecode;
+									const bool compiled = shaderBytecodeCompiler->compileShaderSourceCode(static_cast<ShaderType>(i), shaderSourceCode.c_str(), shaderBytecode);
+									assert(compiled);	// TODO(co) Error handling
+									if (compiled)
+									{
+										std::lock_guard<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
+										shaderCache->mShaderBytecode.setBytecodeCopy(shaderBytecode.getNumberOfBytes(), const_cast<uint8_t*>(shaderBytecode.getBytecode()));
+									}
+									++mNumberOfCompiledShaders;
+								}
+							}
+						}
+						else if (nullptr != shaderCache)
 						{
 							shaders[i] = shaderCache->getShaderPtr();
 							if (nullptr == shaders[i])
@@ -328,13 +464,14 @@ namespace RendererRuntime
 								const std::string& shaderSourceCode = compilerRequest.shaderSourceCode[i];
 								if (shaderSourceCode.empty())
 								{
-									// We're not aware of any shader source code but we need a shader cache, so, there must be a shader cache master we need to wait for
-									assert(nullptr != shaderCache->getMasterShaderCache());
+									// We're not aware of any shader source code but we need a shader cache, so, there must be a shader cache master or another compiler request compiling the shader we need to wait for
 									needToWaitForShaderCache = true;
 								}
 								else
 								{
 									// Create the shader instance
+									// -> The shader bytecode is requested as well, else the shader cache couldn't be written into the pipeline state object cache
+									RENDERER_RUNTIME_CPU_PROFILER_SCOPE("Pipeline state compiler shader compilation")
 									Renderer::IShader* shader = nullptr;
 									switch (static_cast<ShaderType>(i))
 									{
@@ -342,30 +479,31 @@ namespace RendererRuntime
 										{
 											const MaterialBlueprintResource& materialBlueprintResource = materialBlueprintResourceManager.getById(compilerRequest.pipelineStateCache.getPipelineStateSignature().getMaterialBlueprintResourceId());
 											const Renderer::VertexAttributes& vertexAttributes = mRendererRuntime.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
-											shader = shaderLanguage->createVertexShaderFromSourceCode(vertexAttributes, shaderSourceCode.c_str());
+											shader = shaderLanguage->createVertexShaderFromSourceCode(vertexAttributes, shaderSourceCode.c_str(), &shaderCache->mShaderBytecode);
 											break;
 										}
 
 										case ShaderType::TessellationControl:
-											shader = shaderLanguage->createTessellationControlShaderFromSourceCode(shaderSourceCode.c_str());
+											shader = shaderLanguage->createTessellationControlShaderFromSourceCode(shaderSourceCode.c_str(), &shaderCache->mShaderBytecode);
 											break;
 
 										case ShaderType::TessellationEvaluation:
-											shader = shaderLanguage->createTessellationEvaluationShaderFromSourceCode(shaderSourceCode.c_str());
+											shader = shaderLanguage->createTessellationEvaluationShaderFromSourceCode(shaderSourceCode.c_str(), &shaderCache->mShaderBytecode);
 											break;
 
 										case ShaderType::Geometry:
 											// TODO(co) "RendererRuntime::ShaderCacheManager::getShaderCache()" needs to provide additional geometry shader information
-											// shader = shaderLanguage->createGeometryShaderFromSourceCode(shaderSourceCode.c_str());
+											// shader = shaderLanguage->createGeometryShaderFromSourceCode(shaderSourceCode.c_str(), &shaderCache->mShaderBytecode);
 											break;
 
 										case ShaderType::Fragment:
-											shader = shaderLanguage->createFragmentShaderFromSourceCode(shaderSourceCode.c_str());
+											shader = shaderLanguage->createFragmentShaderFromSourceCode(shaderSourceCode.c_str(), &shaderCache->mShaderBytecode);
 											break;
 									}
 									assert(nullptr != shader);	// TODO(co) Error handling
 									RENDERER_SET_RESOURCE_DEBUG_NAME(shader, "Pipeline state compiler")
 									shaderCache->mShaderPtr = shaders[i] = shader;
+									++mNumberOfCompiledShaders;
 								}
 							}
 						}
@@ -374,7 +512,9 @@ namespace RendererRuntime
 					// Are all required shader caches ready for rumble?
 					if (!needToWaitForShaderCache)
 					{
-						{ // Create the pipeline state object (PSO)
+						// Create the program and the pipeline state object (PSO), not required during offline shader bytecode compilation
+						if (nullptr == shaderBytecodeCompiler)
+						{
 							const PipelineStateSignature& pipelineStateSignature = compilerRequest.pipelineStateCache.getPipelineStateSignature();
 							MaterialBlueprintResource& materialBlueprintResource = materialBlueprintResourceManager.getById(pipelineStateSignature.getMaterialBlueprintResourceId());
 
@@ -398,12 +538,18 @@ namespace RendererRuntime
 								assert(programCacheManager.mProgramCacheById.find(programCacheId) == programCacheManager.mProgramCacheById.cend());	// TODO(co) Error handling
 								programCacheManager.mProgramCacheById.emplace(programCacheId, new ProgramCache(programCacheId, *program));
 							}
+							++mNumberOfCompiledPipelineStates;
 						}
+						mCompilerTimeInMicroseconds += static_cast<uint64_t>(stopwatch.stop());
 
 						// Push the compiler request into the queue of the synchronous shader dispatch
 						std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
 						mDispatchQueue.emplace_back(compilerRequest);
 					}
+					else
+					{
+						mCompilerTimeInMicroseconds += static_cast<uint64_t>(stopwatch.stop());
+					}
 
 					// We're ready for the next round
 					compilerMutexLock.lock();
@@ -412,6 +558,7 @@ namespace RendererRuntime
 						// At least one shader cache instance we need is referencing a master shader cache which hasn't finished processing yet, so we need to wait a while before we can continue with our request
 						mCompilerQueue.emplace_front(compilerRequest);
 					}
+					--mNumberOfCompilingCompilerRequests;
 				}
 			}
 		}
@@ -43,7 +43,7 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
-		RendererRuntime::ShaderCombinationId generateShaderCombinationId(const RendererRuntime::ShaderBlueprintResource& shaderBlueprintResource, const RendererRuntime::ShaderProperties& shaderProperties, const RendererRuntime::DynamicShaderPieces& dynamicShaderPieces)
+		RendererRuntime::ShaderCombinationId generateShaderCombinationId(const RendererRuntime::ShaderBlueprintResource& shaderBlueprintResource, const RendererRuntime::ShaderProperties& shaderProperties, uint32_t dynamicShaderPiecesHash)
 		{
 			RendererRuntime::ShaderCombinationId shaderCombinationId(RendererRuntime::Math::FNV1a_INITIAL_HASH_32);
 
@@ -70,14 +70,10 @@ namespace
 				}
 			}
 
-			// Apply dynamic shader pieces
-			for (auto& dynamicShaderPiecesElement : dynamicShaderPieces)
+			// Apply dynamic shader pieces hash, no dynamic shader pieces result in the same shader combination ID as without a dynamic shader pieces hash
+			if (RendererRuntime::Math::FNV1a_INITIAL_HASH_32 != dynamicShaderPiecesHash)
 			{
-				// Apply dynamic shader piece ID
-				shaderCombinationId = RendererRuntime::Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&dynamicShaderPiecesElement.first), sizeof(uint32_t), shaderCombinationId);
-
-				// Apply shader property value
-				shaderCombinationId = RendererRuntime::Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(dynamicShaderPiecesElement.second.c_str()), static_cast<uint32_t>(dynamicShaderPiecesElement.second.length()), shaderCombinationId);
+				shaderCombinationId = RendererRuntime::Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&dynamicShaderPiecesHash), sizeof(uint32_t), shaderCombinationId);
 			}
 
 			// Done
@@ -137,21 +133,48 @@ namespace RendererRuntime
 		mMaterialBlueprintResourceId = materialBlueprintResource.getId();
 		mSerializedPipelineStateHash = serializedPipelineStateHash;
 		mShaderProperties			 = shaderProperties;
-		mPipelineStateSignatureId	 = Math::FNV1a_INITIAL_HASH_32;
+
+		// Before doing anything else: Copy the dynamic shader properties because they're an important part of the pipeline state signature
 		for (uint8_t i = 0; i < NUMBER_OF_SHADER_TYPES; ++i)
 		{
-			mShaderCombinationId[i] = getUninitialized<ShaderCombinationId>();
+			mDynamicShaderPieces[i] = dynamicShaderPieces[i];
 		}
 
-		// Before doing anything else: Copy the dynamic shader properties because they're an important part of the pipeline state signature
+		// Derived data
+		DynamicShaderPiecesHashes dynamicShaderPiecesHashes;
+		generateDynamicShaderPiecesHashes(mDynamicShaderPieces, dynamicShaderPiecesHashes);
+		mPipelineStateSignatureId = generatePipelineStateSignatureId(materialBlueprintResource, mSerializedPipelineStateHash, mShaderProperties, dynamicShaderPiecesHashes, mShaderCombinationId);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	void PipelineStateSignature::generateDynamicShaderPiecesHashes(const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES], DynamicShaderPiecesHashes& dynamicShaderPiecesHashes)
+	{
 		for (uint8_t i = 0; i < NUMBER_OF_SHADER_TYPES; ++i)
 		{
-			mDynamicShaderPieces[i] = dynamicShaderPieces[i];
+			uint32_t& dynamicShaderPiecesHash = dynamicShaderPiecesHashes[i];
+			dynamicShaderPiecesHash = Math::FNV1a_INITIAL_HASH_32;
+			for (const auto& dynamicShaderPiecesElement : dynamicShaderPieces[i])
+			{
+				// Apply dynamic shader piece ID
+				dynamicShaderPiecesHash = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&dynamicShaderPiecesElement.first), sizeof(uint32_t), dynamicShaderPiecesHash);
+
+				// Apply dynamic shader piece source code
+				dynamicShaderPiecesHash = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(dynamicShaderPiecesElement.second.c_str()), static_cast<uint32_t>(dynamicShaderPiecesElement.second.length()), dynamicShaderPiecesHash);
+			}
 		}
+	}
+
+	PipelineStateSignatureId PipelineStateSignature::generatePipelineStateSignatureId(const MaterialBlueprintResource& materialBlueprintResource, uint32_t serializedPipelineStateHash, const ShaderProperties& shaderProperties, const DynamicShaderPiecesHashes& dynamicShaderPiecesHashes, ShaderCombinationId shaderCombinationIds[NUMBER_OF_SHADER_TYPES])
+	{
+		PipelineStateSignatureId pipelineStateSignatureId = Math::FNV1a_INITIAL_HASH_32;
 
 		// Incorporate primitive hashes
-		mPipelineStateSignatureId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&mMaterialBlueprintResourceId), sizeof(uint32_t), mPipelineStateSignatureId);
-		mPipelineStateSignatureId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&mSerializedPipelineStateHash), sizeof(uint32_t), mPipelineStateSignatureId);
+		const MaterialBlueprintResourceId materialBlueprintResourceId = materialBlueprintResource.getId();
+		pipelineStateSignatureId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&materialBlueprintResourceId), sizeof(uint32_t), pipelineStateSignatureId);
+		pipelineStateSignatureId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&serializedPipelineStateHash), sizeof(uint32_t), pipelineStateSignatureId);
 
 		// Incorporate shader related hashes
 		const ShaderBlueprintResourceManager& shaderBlueprintResourceManager = materialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().getRendererRuntime().getShaderBlueprintResourceManager();
@@ -160,10 +183,21 @@ namespace RendererRuntime
 			const ShaderBlueprintResource* shaderBlueprintResource = shaderBlueprintResourceManager.tryGetById(materialBlueprintResource.getShaderBlueprintResourceId(static_cast<ShaderType>(i)));
 			if (nullptr != shaderBlueprintResource)
 			{
-				const uint32_t hash = mShaderCombinationId[i] = ::detail::generateShaderCombinationId(*shaderBlueprintResource, mShaderProperties, mDynamicShaderPieces[i]);
-				mPipelineStateSignatureId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&hash), sizeof(uint32_t), mPipelineStateSignatureId);
+				const uint32_t hash = ::detail::generateShaderCombinationId(*shaderBlueprintResource, shaderProperties, dynamicShaderPiecesHashes[i]);
+				pipelineStateSignatureId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&hash), sizeof(uint32_t), pipelineStateSignatureId);
+				if (nullptr != shaderCombinationIds)
+				{
+					shaderCombinationIds[i] = hash;
+				}
+			}
+			else if (nullptr != shaderCombinationIds)
+			{
+				shaderCombinationIds[i] = getUninitialized<ShaderCombinationId>();
 			}
 		}
+
+		// Done
+		return pipelineStateSignatureId;
 	}
 
 
@@ -86,7 +86,8 @@ namespace RendererRuntime
 				const IRendererRuntime& rendererRuntime = materialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().getRendererRuntime();
 
 				// Create the shaders
-				ShaderCacheManager& shaderCacheManager = rendererRuntime.getShaderBlueprintResourceManager().getShaderCacheManager();
+				ShaderBlueprintResourceManager& shaderBlueprintResourceManager = rendererRuntime.getShaderBlueprintResourceManager();
+				ShaderCacheManager& shaderCacheManager = shaderBlueprintResourceManager.getShaderCacheManager();
 				Renderer::IShader* shaders[NUMBER_OF_SHADER_TYPES] = {};
 				for (uint8_t i = 0; i < NUMBER_OF_SHADER_TYPES; ++i)
 				{
@@ -101,6 +102,12 @@ namespace RendererRuntime
 					}
 				}
 
+				// Offline shader bytecode compilation only fills the shader caches, there are no renderer shaders to create a program from
+				if (nullptr != shaderBlueprintResourceManager.getShaderBytecodeCompiler())
+				{
+					return nullptr;
+				}
+
 				// Create the program
 				Renderer::IProgram* program = shaderLanguage->createProgram(*rootSignaturePtr,
 					rendererRuntime.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes(),
@@ -884,8 +884,8 @@ namespace RendererRuntime
 			// 1 = y = The assigned material slot inside the material uniform buffer
 			integerBuffer[1] = mMaterialTechnique->getAssignedMaterialSlot();
 
-			// 2 = z = The custom parameters start index inside the instance texture buffer
-			integerBuffer[2] = 0;
+			// 2 = z = The custom parameters start index inside the instance texture buffer, zero if there are no custom parameters
+			integerBuffer[2] = (0 != mInstanceCustomParametersOffset) ? (instanceTextureBufferStartIndex + mInstanceCustomParametersOffset) : 0;
 
 			// 3 = w = Unused
 			integerBuffer[3] = 0;
@@ -419,8 +419,9 @@ namespace RendererRuntime
 				}
 
 				// Create the current pipeline state cache instances for the material blueprint
+				// -> Offline shader bytecode compilation doesn't create pipeline state objects
 				const Renderer::IPipelineStatePtr pipelineStatePtr = mPipelineStateCacheManager.getPipelineStateCacheByCombination(getUninitialized<uint32_t>(), shaderProperties, dynamicShaderPieces, true);
-				assert(nullptr != pipelineStatePtr);	// TODO(co) Decent error handling
+				assert((nullptr != pipelineStatePtr || nullptr != getResourceManager<MaterialBlueprintResourceManager>().getRendererRuntime().getShaderBlueprintResourceManager().getShaderBytecodeCompiler()) && "Failed to create the pipeline state object");	// TODO(co) Decent error handling
 			}
 			while (shaderCombinationIterator.iterate());
 		}
@@ -505,26 +506,22 @@ namespace RendererRuntime
 
 	void MaterialBlueprintResource::clearPipelineStateObjectCache()
 	{
-		// TODO(co) Implement me
-		NOP;
+		mPipelineStateCacheManager.clearCache();
 	}
 
-	void MaterialBlueprintResource::loadPipelineStateObjectCache(IFile&)
+	bool MaterialBlueprintResource::loadPipelineStateObjectCache(IFile& file, uint32_t numberOfBytes)
 	{
-		// TODO(co) Implement me
-		NOP;
+		return mPipelineStateCacheManager.loadPipelineStateObjectCache(file, numberOfBytes);
 	}
 
 	bool MaterialBlueprintResource::doesPipelineStateObjectCacheNeedSaving() const
 	{
-		// TODO(co) Implement me
-		return false;
+		return mPipelineStateCacheManager.doesPipelineStateObjectCacheNeedSaving();
 	}
 
-	void MaterialBlueprintResource::savePipelineStateObjectCache(IFile&)
+	void MaterialBlueprintResource::savePipelineStateObjectCache(IFile& file)
 	{
-		// TODO(co) Implement me
-		NOP;
+		mPipelineStateCacheManager.savePipelineStateObjectCache(file);
 	}
 
 	void MaterialBlueprintResource::initializeElement(MaterialBlueprintResourceId materialBlueprintResourceId)
@@ -28,12 +28,14 @@
 #include "RendererRuntime/Resource/MaterialBlueprint/Listener/MaterialBlueprintResourceListener.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/InstanceBufferManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/IndirectBufferManager.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/GpuCullingManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/LightBufferManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/MaterialBufferManager.h"
 #include "RendererRuntime/Resource/Material/MaterialResourceManager.h"
 #include "RendererRuntime/Resource/Material/MaterialTechnique.h"
 #include "RendererRuntime/Resource/Material/MaterialResource.h"
 #include "RendererRuntime/Resource/Detail/ResourceManagerTemplate.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateCompiler.h"
 #include "RendererRuntime/Core/Time/TimeManager.h"
 
 
@@ -160,6 +162,10 @@ namespace RendererRuntime
 		{
 			mIndirectBufferManager->onPreCommandBufferExecution();
 		}
+		if (nullptr != mGpuCullingManager)
+		{
+			mGpuCullingManager->onPreCommandBufferExecution();
+		}
 	}
 
 	void MaterialBlueprintResourceManager::setDefaultTextureFiltering(Renderer::FilterMode filterMode, uint8_t maximumAnisotropy)
@@ -319,6 +325,7 @@ namespace RendererRuntime
 		mDefaultMaximumTextureAnisotropy(1),
 		mInstanceBufferManager(nullptr),
 		mIndirectBufferManager(nullptr),
+		mGpuCullingManager(nullptr),
 		mLightBufferManager(nullptr)
 	{
 		// Create internal resource manager
@@ -333,6 +340,7 @@ namespace RendererRuntime
 		{
 			mInstanceBufferManager = new InstanceBufferManager(rendererRuntime);
 			mIndirectBufferManager = new IndirectBufferManager(rendererRuntime);
+			mGpuCullingManager = new GpuCullingManager(rendererRuntime);
 			mLightBufferManager = new LightBufferManager(rendererRuntime);
 		}
 
@@ -346,6 +354,7 @@ namespace RendererRuntime
 		// Destroy buffer managers
 		delete mInstanceBufferManager;
 		delete mIndirectBufferManager;
+		delete mGpuCullingManager;
 		delete mLightBufferManager;
 
 		// Shutdown material blueprint resource listener (we know there must be such an instance)
@@ -369,6 +378,18 @@ namespace RendererRuntime
 		}
 	}
 
+	bool MaterialBlueprintResourceManager::getSerializedPipelineState(uint32_t serializedPipelineStateHash, Renderer::SerializedPipelineState& serializedPipelineState)
+	{
+		std::lock_guard<std::mutex> serializedPipelineStatesMutexLock(mSerializedPipelineStatesMutex);
+		SerializedPipelineStates::const_iterator iterator = mSerializedPipelineStates.find(serializedPipelineStateHash);
+		if (iterator != mSerializedPipelineStates.cend())
+		{
+			serializedPipelineState = iterator->second;
+			return true;
+		}
+		return false;
+	}
+
 	void MaterialBlueprintResourceManager::applySerializedPipelineState(uint32_t serializedPipelineStateHash, Renderer::PipelineState& pipelineState)
 	{
 		std::lock_guard<std::mutex> serializedPipelineStatesMutexLock(mSerializedPipelineStatesMutex);
@@ -393,17 +414,38 @@ namespace RendererRuntime
 		}
 	}
 
-	void MaterialBlueprintResourceManager::loadPipelineStateObjectCache(IFile& file)
+	bool MaterialBlueprintResourceManager::loadPipelineStateObjectCache(MemoryFile& memoryFile)
 	{
 		// Read the pipeline state object cache header which consists of information about the contained material blueprint resources
+		// -> The counts inside the file can't be trusted, the material blueprint cache entries must consume the rest of the file exactly
 		uint32_t numberOfElements = 0;
-		file.read(&numberOfElements, sizeof(uint32_t));
+		if (memoryFile.getNumberOfRemainingBytes() < sizeof(uint32_t))
+		{
+			return false;
+		}
+		memoryFile.read(&numberOfElements, sizeof(uint32_t));
+		if (numberOfElements > memoryFile.getNumberOfRemainingBytes() / sizeof(::detail::MaterialBlueprintCacheEntry))
+		{
+			return false;
+		}
 		std::vector< ::detail::MaterialBlueprintCacheEntry> materialBlueprintCacheEntries;
 		materialBlueprintCacheEntries.resize(numberOfElements);
-		file.read(materialBlueprintCacheEntries.data(), sizeof(::detail::MaterialBlueprintCacheEntry) * numberOfElements);
+		memoryFile.read(materialBlueprintCacheEntries.data(), sizeof(::detail::MaterialBlueprintCacheEntry) * numberOfElements);
+		{
+			uint64_t numberOfBytes = 0;
+			for (const ::detail::MaterialBlueprintCacheEntry& materialBlueprintCacheEntry : materialBlueprintCacheEntries)
+			{
+				numberOfBytes += materialBlueprintCacheEntry.numberOfBytes;
+			}
+			if (numberOfBytes != memoryFile.getNumberOfRemainingBytes())
+			{
+				return false;
+			}
+		}
 
 		// Loop through all material blueprint resources and read the cache entries
-		for (uint32_t i = 0; i < numberOfElements; ++i)
+		bool result = true;
+		for (uint32_t i = 0; i < numberOfElements && result; ++i)
 		{
 			// TODO(co) Currently material blueprint resource loading is a blocking process
 			const ::detail::MaterialBlueprintCacheEntry& materialBlueprintCacheEntry = materialBlueprintCacheEntries[i];
@@ -411,14 +453,21 @@ namespace RendererRuntime
 			loadMaterialBlueprintResourceByAssetId(materialBlueprintCacheEntry.materialBlueprintAssetId, materialBlueprintResourceId);
 			if (isInitialized(materialBlueprintResourceId))
 			{
-				mInternalResourceManager->getResources().getElementById(materialBlueprintResourceId).loadPipelineStateObjectCache(file);
+				result = mInternalResourceManager->getResources().getElementById(materialBlueprintResourceId).loadPipelineStateObjectCache(memoryFile, materialBlueprintCacheEntry.numberOfBytes);
 			}
 			else
 			{
 				assert(false && "The pipeline state object cache contains an unknown material blueprint asset");
-				file.skip(materialBlueprintCacheEntry.numberOfBytes);
+				memoryFile.skip(materialBlueprintCacheEntry.numberOfBytes);
 			}
 		}
+
+		// Wait for the pipeline state compiler to finish the pipeline state objects of the cache, we don't want to see fallbacks during the first frame
+		// -> Also required in case of a corrupt cache since the caller is going to destroy the pipeline state caches created so far
+		mRendererRuntime.getPipelineStateCompiler().flushAllQueues();
+
+		// Done
+		return result;
 	}
 
 	bool MaterialBlueprintResourceManager::doesPipelineStateObjectCacheNeedSaving() const
@@ -74,6 +74,24 @@ namespace RendererRuntime
 		mMeshResource->setNumberOfVertices(meshHeader.numberOfVertices);
 		mMeshResource->setNumberOfIndices(meshHeader.numberOfIndices);
 
+		{ // Optional vertex quantization: The matching vertex attributes are part of the mesh file, the dequantization is passed on to the shaders as instance texture buffer custom parameters
+			MeshResource::VertexDequantization& vertexDequantization = mMeshResource->getVertexDequantization();
+			if (meshHeader.quantizedVertices)
+			{
+				const float vertexDequantizationData[MeshResource::NUMBER_OF_VERTEX_DEQUANTIZATION_FLOATS] =
+				{
+					meshHeader.positionDequantizationScale.x,		   meshHeader.positionDequantizationScale.y,		  meshHeader.positionDequantizationScale.z,		   0.0f,
+					meshHeader.positionDequantizationBias.x,		   meshHeader.positionDequantizationBias.y,			  meshHeader.positionDequantizationBias.z,		   0.0f,
+					meshHeader.textureCoordinateDequantizationScale.x, meshHeader.textureCoordinateDequantizationScale.y, meshHeader.textureCoordinateDequantizationBias.x, meshHeader.textureCoordinateDequantizationBias.y
+				};
+				vertexDequantization.assign(vertexDequantizationData, vertexDequantizationData + MeshResource::NUMBER_OF_VERTEX_DEQUANTIZATION_FLOATS);
+			}
+			else
+			{
+				vertexDequantization.clear();
+			}
+		}
+
 		// Allocate memory for the local vertex buffer data
 		mNumberOfUsedVertexBufferDataBytes = meshHeader.numberOfBytesPerVertex * mMeshResource->getNumberOfVertices();
 		if (mNumberOfVertexBufferDataBytes < mNumberOfUsedVertexBufferDataBytes)
@@ -107,8 +125,9 @@ namespace RendererRuntime
 		}
 		mMemoryFile.read(mVertexAttributes, sizeof(Renderer::VertexAttribute) * mNumberOfUsedVertexAttributes);
 
-		// Read in the sub-meshes
-		mNumberOfUsedSubMeshes = meshHeader.numberOfSubMeshes;
+		// Read in the sub-meshes of all LODs
+		assert(meshHeader.numberOfLods > 0);
+		mNumberOfUsedSubMeshes = static_cast<uint32_t>(meshHeader.numberOfSubMeshes) * meshHeader.numberOfLods;
 		if (mNumberOfSubMeshes < mNumberOfUsedSubMeshes)
 		{
 			mNumberOfSubMeshes = mNumberOfUsedSubMeshes;
@@ -117,6 +136,13 @@ namespace RendererRuntime
 		}
 		mMemoryFile.read(mSubMeshes, sizeof(v1Mesh::SubMesh) * mNumberOfUsedSubMeshes);
 
+		{ // Read in the LOD minimum screen sizes
+			mMeshResource->setNumberOfLods(meshHeader.numberOfLods);
+			MeshResource::LodMinimumScreenSizes& lodMinimumScreenSizes = mMeshResource->getLodMinimumScreenSizes();
+			lodMinimumScreenSizes.resize(meshHeader.numberOfLods);
+			mMemoryFile.read(lodMinimumScreenSizes.data(), sizeof(float) * meshHeader.numberOfLods);
+		}
+
 		// Read in optional skeleton
 		mNumberOfBones = meshHeader.numberOfBones;
 		if (mNumberOfBones > 0)
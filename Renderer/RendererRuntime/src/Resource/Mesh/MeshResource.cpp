@@ -170,6 +170,133 @@ namespace
 				0																// instancesPerElement (uint32_t)
 			}
 		};
+		// Quantized vertex input layout: 16 bit position quantized to the bounding box (w is unused padding), 16 bit texture coordinate quantized to the texture coordinate bounds, see "RendererRuntime::MeshResource::getVertexDequantization()"
+		const Renderer::VertexAttribute QuantizedVertexAttributesLayout[] =
+		{
+			{ // Attribute 0
+				// Data destination
+				Renderer::VertexAttributeFormat::SHORT_4,	// vertexAttributeFormat (Renderer::VertexAttributeFormat)
+				"Position",									// name[32] (char)
+				"POSITION",									// semanticName[32] (char)
+				0,											// semanticIndex (uint32_t)
+				// Data source
+				0,											// inputSlot (uint32_t)
+				0,											// alignedByteOffset (uint32_t)
+				sizeof(short) * 10,							// strideInBytes (uint32_t)
+				0											// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 1
+				// Data destination
+				Renderer::VertexAttributeFormat::SHORT_2,	// vertexAttributeFormat (Renderer::VertexAttributeFormat)
+				"TexCoord",									// name[32] (char)
+				"TEXCOORD",									// semanticName[32] (char)
+				0,											// semanticIndex (uint32_t)
+				// Data source
+				0,											// inputSlot (uint32_t)
+				sizeof(short) * 4,							// alignedByteOffset (uint32_t)
+				sizeof(short) * 10,							// strideInBytes (uint32_t)
+				0											// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 2
+				// Data destination
+				Renderer::VertexAttributeFormat::SHORT_4,	// vertexAttributeFormat (Renderer::VertexAttributeFormat)
+				"QTangent",									// name[32] (char)
+				"TEXCOORD",									// semanticName[32] (char)
+				1,											// semanticIndex (uint32_t)
+				// Data source
+				0,											// inputSlot (uint32_t)
+				sizeof(short) * 6,							// alignedByteOffset (uint32_t)
+				sizeof(short) * 10,							// strideInBytes (uint32_t)
+				0											// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 3, see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html
+				// Data destination
+				Renderer::VertexAttributeFormat::UINT_1,	// vertexAttributeFormat (Renderer::VertexAttributeFormat)
+				"drawId",									// name[32] (char)
+				"DRAWID",									// semanticName[32] (char)
+				0,											// semanticIndex (uint32_t)
+				// Data source
+				1,											// inputSlot (uint32_t)
+				0,											// alignedByteOffset (uint32_t)
+				sizeof(uint32_t),							// strideInBytes (uint32_t)
+				1											// instancesPerElement (uint32_t)
+			}
+		};
+		const Renderer::VertexAttribute QuantizedSkinnedVertexAttributesLayout[] =
+		{
+			{ // Attribute 0
+				// Data destination
+				Renderer::VertexAttributeFormat::SHORT_4,			// vertexAttributeFormat (Renderer::VertexAttributeFormat)
+				"Position",											// name[32] (char)
+				"POSITION",											// semanticName[32] (char)
+				0,													// semanticIndex (uint32_t)
+				// Data source
+				0,													// inputSlot (uint32_t)
+				0,													// alignedByteOffset (uint32_t)
+				sizeof(short) * 10 + sizeof(uint8_t) * 8,			// strideInBytes (uint32_t)
+				0													// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 1
+				// Data destination
+				Renderer::VertexAttributeFormat::SHORT_2,			// vertexAttributeFormat (Renderer::VertexAttributeFormat)
+				"TexCoord",											// name[32] (char)
+				"TEXCOORD",											// semanticName[32] (char)
+				0,													// semanticIndex (uint32_t)
+				// Data source
+				0,													// inputSlot (uint32_t)
+				sizeof(short) * 4,									// alignedByteOffset (uint32_t)
+				sizeof(short) * 10 + sizeof(uint8_t) * 8,			// strideInBytes (uint32_t)
+				0													// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 2
+				// Data destination
+				Renderer::VertexAttributeFormat::SHORT_4,			// vertexAttributeFormat (Renderer::VertexAttributeFormat)
+				"QTangent",											// name[32] (char)
+				"TEXCOORD",											// semanticName[32] (char)
+				1,													// semanticIndex (uint32_t)
+				// Data source
+				0,													// inputSlot (uint32_t)
+				sizeof(short) * 6,									// alignedByteOffset (uint32_t)
+				sizeof(short) * 10 + sizeof(uint8_t) * 8,			// strideInBytes (uint32_t)
+				0													// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 3, see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html
+				// Data destination
+				Renderer::VertexAttributeFormat::UINT_1,	// vertexAttributeFormat (Renderer::VertexAttributeFormat)
+				"drawId",									// name[32] (char)
+				"DRAWID",									// semanticName[32] (char)
+				0,											// semanticIndex (uint32_t)
+				// Data source
+				1,											// inputSlot (uint32_t)
+				0,											// alignedByteOffset (uint32_t)
+				sizeof(uint32_t),							// strideInBytes (uint32_t)
+				1											// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 4
+				// Data destination
+				Renderer::VertexAttributeFormat::R8G8B8A8_UINT,		// vertexAttributeFormat (Renderer::VertexAttributeFormat)
+				"BlendIndices",										// name[32] (char)
+				"BLENDINDICES",										// semanticName[32] (char)
+				0,													// semanticIndex (uint32_t)
+				// Data source
+				0,													// inputSlot (uint32_t)
+				sizeof(short) * 10,									// alignedByteOffset (uint32_t)
+				sizeof(short) * 10 + sizeof(uint8_t) * 8,			// strideInBytes (uint32_t)
+				0													// instancesPerElement (uint32_t)
+			},
+			{ // Attribute 5
+				// Data destination
+				Renderer::VertexAttributeFormat::R8G8B8A8_UINT,		// vertexAttributeFormat (Renderer::VertexAttributeFormat)
+				"BlendWeights",										// name[32] (char)
+				"BLENDWEIGHT",										// semanticName[32] (char)
+				0,													// semanticIndex (uint32_t)
+				// Data source
+				0,													// inputSlot (uint32_t)
+				sizeof(short) * 10 + sizeof(uint8_t) * 4,			// alignedByteOffset (uint32_t)
+				sizeof(short) * 10 + sizeof(uint8_t) * 8,			// strideInBytes (uint32_t)
+				0													// instancesPerElement (uint32_t)
+			}
+		};
 
 
 //[-------------------------------------------------------]
@@ -191,6 +318,8 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	const Renderer::VertexAttributes MeshResource::VERTEX_ATTRIBUTES(static_cast<uint32_t>(glm::countof(::detail::VertexAttributesLayout)), ::detail::VertexAttributesLayout);
 	const Renderer::VertexAttributes MeshResource::SKINNED_VERTEX_ATTRIBUTES(static_cast<uint32_t>(glm::countof(::detail::SkinnedVertexAttributesLayout)), ::detail::SkinnedVertexAttributesLayout);
+	const Renderer::VertexAttributes MeshResource::QUANTIZED_VERTEX_ATTRIBUTES(static_cast<uint32_t>(glm::countof(::detail::QuantizedVertexAttributesLayout)), ::detail::QuantizedVertexAttributesLayout);
+	const Renderer::VertexAttributes MeshResource::QUANTIZED_SKINNED_VERTEX_ATTRIBUTES(static_cast<uint32_t>(glm::countof(::detail::QuantizedSkinnedVertexAttributesLayout)), ::detail::QuantizedSkinnedVertexAttributesLayout);
 
 
 //[-------------------------------------------------------]
@@ -29,7 +29,10 @@
 #include "RendererRuntime/Resource/CompositorWorkspace/CompositorContextData.h"
 #include "RendererRuntime/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
 #include "RendererRuntime/RenderQueue/RenderableManager.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/GpuCullingManager.h"
 #include "RendererRuntime/Core/Thread/ThreadPool.h"
+#include "RendererRuntime/Core/Time/CpuProfiler.h"
 #include "RendererRuntime/Core/Math/Math.h"
 #include "RendererRuntime/Core/Math/Frustum.h"
 #include "RendererRuntime/Vr/IVrManager.h"
@@ -37,6 +40,8 @@
 
 #include <Renderer/Public/Renderer.h>
 
+#include <limits>
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -50,7 +55,8 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global definitions                                    ]
 		//[-------------------------------------------------------]
-		static const size_t SCENE_ITEMS_SPLIT_COUNT = 256;	///< Package size for each thread to work on	TODO(co) This value needs to be fine-tuned
+		static const size_t SCENE_ITEMS_SPLIT_COUNT = 256;						///< Package size for each thread to work on	TODO(co) This value needs to be fine-tuned
+		static const uint32_t MINIMUM_SCENE_ITEM_SET_CAPACITY = 1024;			///< Minimum scene item set capacity, must be a multiple of the SIMD lane count	TODO(co) This value needs to be fine-tuned
 		typedef xsimd::batch_bool<float, 4> bool4;
 		typedef xsimd::simd_type<float> float4;
 		static const float4 FLOAT4_ALL_ZERO(0.0f);
@@ -87,6 +93,114 @@ namespace
 			return RendererRuntime::Math::makeMultipleOf(value, xsimd::simd_type<float>::size);
 		}
 
+		void resizeSceneItemSet(RendererRuntime::SceneItemSet& sceneItemSet, uint32_t capacity)
+		{
+			assert(alignToSimdLaneCount(capacity) == capacity);
+			assert(capacity >= sceneItemSet.numberOfSceneItems);
+
+			// Determine the needed vector size which takes alignment as well as prefetch ("xsimd::prefetch()" -> "_mm_prefetch()") into account
+			const uint32_t size = capacity + xsimd::simd_type<float>::size;
+			const bool shrink = (capacity < sceneItemSet.capacity);
+
+			// Define helper macro
+			#define RESIZE(vector) sceneItemSet.vector.resize(size); if (shrink) { sceneItemSet.vector.shrink_to_fit(); }
+
+			// Minimum object space bounding box corner position
+			RESIZE(minimumX)
+			RESIZE(minimumY)
+			RESIZE(minimumZ)
+
+			// Maximum object space bounding box corner position
+			RESIZE(maximumX)
+			RESIZE(maximumY)
+			RESIZE(maximumZ)
+
+			// Object space to world space matrix
+			RESIZE(worldXX)
+			RESIZE(worldXY)
+			RESIZE(worldXZ)
+			RESIZE(worldXW)
+			RESIZE(worldYX)
+			RESIZE(worldYY)
+			RESIZE(worldYZ)
+			RESIZE(worldYW)
+			RESIZE(worldZX)
+			RESIZE(worldZY)
+			RESIZE(worldZZ)
+			RESIZE(worldZW)
+			RESIZE(worldWX)
+			RESIZE(worldWY)
+			RESIZE(worldWZ)
+			RESIZE(worldWW)
+
+			// World space center position of bounding sphere
+			RESIZE(spherePositionX)
+			RESIZE(spherePositionY)
+			RESIZE(spherePositionZ)
+
+			// Negative world space radius of bounding sphere
+			RESIZE(negativeRadius)
+
+			RESIZE(visibilityFlag)
+			RESIZE(sceneItemVector)
+			RESIZE(handle)
+
+			// Undefine helper macro
+			#undef RESIZE
+
+			// Done
+			sceneItemSet.capacity = capacity;
+		}
+
+		void moveSceneItem(RendererRuntime::SceneItemSet& sceneItemSet, uint32_t sourceIndex, uint32_t destinationIndex)
+		{
+			// Define helper macro
+			#define MOVE(vector) sceneItemSet.vector[destinationIndex] = sceneItemSet.vector[sourceIndex];
+
+			// Minimum object space bounding box corner position
+			MOVE(minimumX)
+			MOVE(minimumY)
+			MOVE(minimumZ)
+
+			// Maximum object space bounding box corner position
+			MOVE(maximumX)
+			MOVE(maximumY)
+			MOVE(maximumZ)
+
+			// Object space to world space matrix
+			MOVE(worldXX)
+			MOVE(worldXY)
+			MOVE(worldXZ)
+			MOVE(worldXW)
+			MOVE(worldYX)
+			MOVE(worldYY)
+			MOVE(worldYZ)
+			MOVE(worldYW)
+			MOVE(worldZX)
+			MOVE(worldZY)
+			MOVE(worldZZ)
+			MOVE(worldZW)
+			MOVE(worldWX)
+			MOVE(worldWY)
+			MOVE(worldWZ)
+			MOVE(worldWW)
+
+			// World space center position of bounding sphere
+			MOVE(spherePositionX)
+			MOVE(spherePositionY)
+			MOVE(spherePositionZ)
+
+			// Negative world space radius of bounding sphere
+			MOVE(negativeRadius)
+
+			MOVE(visibilityFlag)
+			MOVE(sceneItemVector)
+			MOVE(handle)
+
+			// Undefine helper macro
+			#undef MOVE
+		}
+
 		uint32_t removeNotVisible(const RendererRuntime::SceneItemSet& sceneItemSet, uint32_t count, const uint32_t* inputIndirection, uint32_t* outputIndirection)
 		{
 			const uint32_t* RESTRICT visibilityFlag = sceneItemSet.visibilityFlag.data();
@@ -265,13 +379,22 @@ namespace
 			}
 		}
 
-		FORCEINLINE void gatherRenderQueueIndexRangesRenderableManagersBySceneItem(const RendererRuntime::ISceneItem& sceneItem, const glm::vec3& cameraPosition, RendererRuntime::CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges)
+		FORCEINLINE void gatherRenderQueueIndexRangesRenderableManagersBySceneItem(const RendererRuntime::ISceneItem& sceneItem, const glm::vec3& cameraPosition, float boundingSphereRadius, float projectionScale, RendererRuntime::CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges)
 		{
 			RendererRuntime::RenderableManager* renderableManager = const_cast<RendererRuntime::RenderableManager*>(sceneItem.getRenderableManager());	// TODO(co) Get rid of the evil const-cast
 			if (nullptr != renderableManager && renderableManager->isVisible() && !renderableManager->getRenderables().empty())
 			{
 				// Calculate the distance to the camera
-				renderableManager->setCachedDistanceToCamera(glm::distance(cameraPosition, sceneItem.getParentSceneNodeSafe().getGlobalTransform().position));
+				const float distanceToCamera = glm::distance(cameraPosition, sceneItem.getParentSceneNodeSafe().getGlobalTransform().position);
+				renderableManager->setCachedDistanceToCamera(distanceToCamera);
+
+				// Calculate the projected screen size used for the LOD selection: Bounding sphere diameter in relation to the render target height
+				// -> "projectionScale" is "1 / tan(fovY / 2)", which is the y-scale of a perspective view space to clip space matrix
+				// -> Uncullable scene items don't have a bounding sphere and the camera might be inside the bounding sphere, use the finest LOD in this case
+				if (renderableManager->getNumberOfLods() > 1)
+				{
+					renderableManager->setCachedProjectedScreenSize((boundingSphereRadius >= 0.0f && distanceToCamera > boundingSphereRadius) ? (boundingSphereRadius * projectionScale / distanceToCamera) : std::numeric_limits<float>::max());
+				}
 
 				// A renderable manager can be inside multiple render queue index ranges
 				for (RendererRuntime::CompositorWorkspaceInstance::RenderQueueIndexRange& renderQueueIndexRange : renderQueueIndexRanges)
@@ -288,6 +411,56 @@ namespace
 		}
 
 
+		void setCachedWorldSpaceBoundingSphere(const RendererRuntime::ISceneItem& sceneItem, float x, float y, float z, float radius)
+		{
+			RendererRuntime::RenderableManager* renderableManager = const_cast<RendererRuntime::RenderableManager*>(sceneItem.getRenderableManager());	// TODO(co) Get rid of the evil const-cast
+			if (nullptr != renderableManager)
+			{
+				renderableManager->setCachedWorldSpaceBoundingSphere(x, y, z, radius);
+			}
+		}
+
+		void setCachedWorldSpaceOrientedBoundingBox(const RendererRuntime::SceneItemSet& sceneItemSet, uint32_t sceneItemIndex)
+		{
+			RendererRuntime::RenderableManager* renderableManager = const_cast<RendererRuntime::RenderableManager*>(sceneItemSet.sceneItemVector[sceneItemIndex]->getRenderableManager());	// TODO(co) Get rid of the evil const-cast
+			if (nullptr != renderableManager)
+			{
+				// Object space bounding box center position and half extents
+				const float centerX = (sceneItemSet.minimumX[sceneItemIndex] + sceneItemSet.maximumX[sceneItemIndex]) * 0.5f;
+				const float centerY = (sceneItemSet.minimumY[sceneItemIndex] + sceneItemSet.maximumY[sceneItemIndex]) * 0.5f;
+				const float centerZ = (sceneItemSet.minimumZ[sceneItemIndex] + sceneItemSet.maximumZ[sceneItemIndex]) * 0.5f;
+				const float halfExtentX = (sceneItemSet.maximumX[sceneItemIndex] - sceneItemSet.minimumX[sceneItemIndex]) * 0.5f;
+				const float halfExtentY = (sceneItemSet.maximumY[sceneItemIndex] - sceneItemSet.minimumY[sceneItemIndex]) * 0.5f;
+				const float halfExtentZ = (sceneItemSet.maximumZ[sceneItemIndex] - sceneItemSet.minimumZ[sceneItemIndex]) * 0.5f;
+
+				// Transform into world space, the rows of the object space to world space matrix are the transformed axes and the translation
+				const float worldSpaceOrientedBoundingBox[12] =
+				{
+					// Center position
+					centerX * sceneItemSet.worldXX[sceneItemIndex] + centerY * sceneItemSet.worldYX[sceneItemIndex] + centerZ * sceneItemSet.worldZX[sceneItemIndex] + sceneItemSet.worldWX[sceneItemIndex],
+					centerX * sceneItemSet.worldXY[sceneItemIndex] + centerY * sceneItemSet.worldYY[sceneItemIndex] + centerZ * sceneItemSet.worldZY[sceneItemIndex] + sceneItemSet.worldWY[sceneItemIndex],
+					centerX * sceneItemSet.worldXZ[sceneItemIndex] + centerY * sceneItemSet.worldYZ[sceneItemIndex] + centerZ * sceneItemSet.worldZZ[sceneItemIndex] + sceneItemSet.worldWZ[sceneItemIndex],
+
+					// Half x-axis
+					halfExtentX * sceneItemSet.worldXX[sceneItemIndex],
+					halfExtentX * sceneItemSet.worldXY[sceneItemIndex],
+					halfExtentX * sceneItemSet.worldXZ[sceneItemIndex],
+
+					// Half y-axis
+					halfExtentY * sceneItemSet.worldYX[sceneItemIndex],
+					halfExtentY * sceneItemSet.worldYY[sceneItemIndex],
+					halfExtentY * sceneItemSet.worldYZ[sceneItemIndex],
+
+					// Half z-axis
+					halfExtentZ * sceneItemSet.worldZX[sceneItemIndex],
+					halfExtentZ * sceneItemSet.worldZY[sceneItemIndex],
+					halfExtentZ * sceneItemSet.worldZZ[sceneItemIndex]
+				};
+				renderableManager->setCachedWorldSpaceOrientedBoundingBox(worldSpaceOrientedBoundingBox);
+			}
+		}
+
+
 		//[-------------------------------------------------------]
 		//[ Global thread functions                               ]
 		//[-------------------------------------------------------]
@@ -349,7 +522,7 @@ namespace
 			}
 		}
 
-		void simdOobbCulling(const SimdMatrix& viewSpaceToClipSpaceMatrix, const RendererRuntime::SceneItemSet& sceneItemSet, const uint32_t* RESTRICT indirection, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, uint32_t* RESTRICT visibilityFlag)
+		void simdOobbCulling(const SimdMatrix& worldSpaceToClipSpaceMatrix, const RendererRuntime::SceneItemSet& sceneItemSet, const uint32_t* RESTRICT indirection, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, uint32_t* RESTRICT visibilityFlag)
 		{
 			// Get pointers to the necessary members of the object set
 
@@ -454,7 +627,7 @@ namespace
 				world.w.w = float4(worldWW[i0], worldWW[i1], worldWW[i2], worldWW[i3]);
 
 				// Create the matrix to go from object->world->view->clip space
-				const SimdMatrix clip = simdMultiply(viewSpaceToClipSpaceMatrix, world);
+				const SimdMatrix clip = simdMultiply(world, worldSpaceToClipSpaceMatrix);
 
 				// Load the minimum and maximum corner positions of the bounding box in object space
 				SimdVector minimumPosition;
@@ -513,9 +686,14 @@ namespace
 
 				// TODO(co) Add "contribution culling" as mentioned at http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html - "Conclusion"
 
-				// Store the result in the "visibilityFlag"-array in a compacted way
+				// Store the result in the "visibilityFlag"-array, the flags are indexed by scene item and not by indirection
 				// TODO(co) No direct usage of "__m128"
-				xsimd::store_aligned(reinterpret_cast<__m128*>(&visibilityFlag[sceneItemIndex]), inside);
+				alignas(16) uint32_t insideFlags[4];
+				xsimd::store_aligned(reinterpret_cast<__m128*>(insideFlags), inside);
+				visibilityFlag[i0] = insideFlags[0];
+				visibilityFlag[i1] = insideFlags[1];
+				visibilityFlag[i2] = insideFlags[2];
+				visibilityFlag[i3] = insideFlags[3];
 			}
 		}
 
@@ -552,6 +730,8 @@ namespace RendererRuntime
 
 	void SceneCullingManager::gatherRenderQueueIndexRangesRenderableManagers(const Renderer::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges)
 	{
+		RENDERER_RUNTIME_CPU_PROFILER_SCOPE_FUNCTION()
+
 		// Overview over the basic workflow of "The Implementation of Frustum Culling in Stingray" - http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html
 		// - Kick jobs to do frustum vs sphere culling
 		//   - For each frustum plane, test plane vs sphere
@@ -560,6 +740,9 @@ namespace RendererRuntime
 		//   - For each frustum plane, test plane vs OOBB
 		// - Wait for OOBB culling to finish
 
+		// Apply batched scene item set changes
+		updateCullableSceneItemSet();
+
 		// Get the camera scene item
 		const CameraSceneItem* cameraSceneItem = compositorContextData.getCameraSceneItem();
 		assert(nullptr != cameraSceneItem);
@@ -567,22 +750,29 @@ namespace RendererRuntime
 		// Get view space to clip space matrix
 		assert(nullptr != compositorContextData.getCompositorWorkspaceInstance());
 		const IRendererRuntime& rendererRuntime = compositorContextData.getCompositorWorkspaceInstance()->getRendererRuntime();
+		GpuCullingManager& gpuCullingManager = rendererRuntime.getMaterialBlueprintResourceManager().getGpuCullingManager();
 		glm::mat4 viewSpaceToClipSpaceMatrix;
 		{
 			const IVrManager& vrManager = rendererRuntime.getVrManager();
 			if (compositorContextData.getSinglePassStereoInstancing() && vrManager.isRunning() && !cameraSceneItem->hasCustomWorldSpaceToViewSpaceMatrix() && !cameraSceneItem->hasCustomViewSpaceToClipSpaceMatrix())
 			{
 				// TODO(co) There are currently multiple culling issues notable when using stereo rendering, so disabled culling for now until this has been resolved
+				if (gpuCullingManager.isEnabled())
+				{
+					gpuCullingManager.setFrustum(nullptr);
+				}
+
 				// Fill render queue index ranges with the visible stuff
 				const glm::vec3& cameraPosition = cameraSceneItem->getParentSceneNodeSafe().getGlobalTransform().position;
+				const float projectionScale = 1.0f / std::tan(cameraSceneItem->getFovY() * 0.5f);
 				for (uint32_t i = 0; i < mCullableSceneItemSet->numberOfSceneItems; ++i)
 				{
-					::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[i], cameraPosition, renderQueueIndexRanges);
+					::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[i], cameraPosition, -mCullableSceneItemSet->negativeRadius[i], projectionScale, renderQueueIndexRanges);
 				}
 				// Fill render queue index ranges with the always-visible stuff
 				for (const ISceneItem* sceneItem : mUncullableSceneItems)
 				{
-					::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, renderQueueIndexRanges);
+					::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, -1.0f, projectionScale, renderQueueIndexRanges);
 				}
 				return;
 
@@ -602,7 +792,34 @@ namespace RendererRuntime
 		}
 
 		// Calculate frustum using a world space to clip space matrix
-		const Frustum frustum(viewSpaceToClipSpaceMatrix * cameraSceneItem->getWorldSpaceToViewSpaceMatrix());
+		const glm::mat4 worldSpaceToClipSpaceMatrix = viewSpaceToClipSpaceMatrix * cameraSceneItem->getWorldSpaceToViewSpaceMatrix();
+		const Frustum frustum(worldSpaceToClipSpaceMatrix);
+		const float projectionScale = viewSpaceToClipSpaceMatrix[1][1];
+
+		// GPU culling: Hand over the frustum and the bounding volumes, the frustum culling of indexed draws is done by "RendererRuntime::GpuCullingManager"
+		// -> Non-indexed draws aren't culled at all in this case
+		if (gpuCullingManager.isEnabled())
+		{
+			gpuCullingManager.setFrustum(&worldSpaceToClipSpaceMatrix);
+			const glm::vec3& cameraPosition = cameraSceneItem->getParentSceneNodeSafe().getGlobalTransform().position;
+
+			// Fill render queue index ranges with the cullable stuff
+			for (uint32_t i = 0; i < mCullableSceneItemSet->numberOfSceneItems; ++i)
+			{
+				const ISceneItem& sceneItem = *mCullableSceneItemSet->sceneItemVector[i];
+				::detail::setCachedWorldSpaceBoundingSphere(sceneItem, mCullableSceneItemSet->spherePositionX[i], mCullableSceneItemSet->spherePositionY[i], mCullableSceneItemSet->spherePositionZ[i], -mCullableSceneItemSet->negativeRadius[i]);
+				::detail::setCachedWorldSpaceOrientedBoundingBox(*mCullableSceneItemSet, i);
+				::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(sceneItem, cameraPosition, -mCullableSceneItemSet->negativeRadius[i], projectionScale, renderQueueIndexRanges);
+			}
+
+			// Fill render queue index ranges with the always-visible stuff
+			for (const ISceneItem* sceneItem : mUncullableSceneItems)
+			{
+				::detail::setCachedWorldSpaceBoundingSphere(*sceneItem, 0.0f, 0.0f, 0.0f, -1.0f);
+				::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, -1.0f, projectionScale, renderQueueIndexRanges);
+			}
+			return;
+		}
 
 		// Splat out the planes to be able to do plane-sphere test with SIMD
 		const ::detail::SimdPlane planes[6] =
@@ -647,52 +864,6 @@ namespace RendererRuntime
 		// Make sure to align the size to the SIMD lane count
 		const uint32_t n_aligned_objects = ::detail::alignToSimdLaneCount(mCullableSceneItemSet->numberOfSceneItems);
 
-		// TODO(co) We need to ensure that scene item set fits the SIMD lane count, this is only done at this place for the culling kickoff
-		if (mCullableSceneItemSet->minimumX.size() != n_aligned_objects)
-		{
-			// Determine the needed vector size which takes alignment as well as prefetch ("xsimd::prefetch()" -> "_mm_prefetch()") into account
-			const uint32_t size = n_aligned_objects + xsimd::simd_type<float>::size;
-
-			// Minimum object space bounding box corner position
-			mCullableSceneItemSet->minimumX.resize(size);
-			mCullableSceneItemSet->minimumY.resize(size);
-			mCullableSceneItemSet->minimumZ.resize(size);
-
-			// Maximum object space bounding box corner position
-			mCullableSceneItemSet->maximumX.resize(size);
-			mCullableSceneItemSet->maximumY.resize(size);
-			mCullableSceneItemSet->maximumZ.resize(size);
-
-			// Object space to world space matrix
-			mCullableSceneItemSet->worldXX.resize(size);
-			mCullableSceneItemSet->worldXY.resize(size);
-			mCullableSceneItemSet->worldXZ.resize(size);
-			mCullableSceneItemSet->worldXW.resize(size);
-			mCullableSceneItemSet->worldYX.resize(size);
-			mCullableSceneItemSet->worldYY.resize(size);
-			mCullableSceneItemSet->worldYZ.resize(size);
-			mCullableSceneItemSet->worldYW.resize(size);
-			mCullableSceneItemSet->worldZX.resize(size);
-			mCullableSceneItemSet->worldZY.resize(size);
-			mCullableSceneItemSet->worldZZ.resize(size);
-			mCullableSceneItemSet->worldZW.resize(size);
-			mCullableSceneItemSet->worldWX.resize(size);
-			mCullableSceneItemSet->worldWY.resize(size);
-			mCullableSceneItemSet->worldWZ.resize(size);
-			mCullableSceneItemSet->worldWW.resize(size);
-
-			// World space center position of bounding sphere
-			mCullableSceneItemSet->spherePositionX.resize(size);
-			mCullableSceneItemSet->spherePositionY.resize(size);
-			mCullableSceneItemSet->spherePositionZ.resize(size);
-
-			// Negative world space radius of bounding sphere
-			mCullableSceneItemSet->negativeRadius.resize(size);
-
-			mCullableSceneItemSet->visibilityFlag.resize(size);
-			mCullableSceneItemSet->sceneItemVector.resize(size);
-		}
-
 		// Get the thread pool instance
 		DefaultThreadPool& defaultThreadPool = rendererRuntime.getDefaultThreadPool();
 
@@ -726,28 +897,28 @@ namespace RendererRuntime
 		mIndirection.resize(n_aligned_objects);
 		const uint32_t numberOfVisibleItems = ::detail::removeNotVisible(*mCullableSceneItemSet, mCullableSceneItemSet->numberOfSceneItems, nullptr, mIndirection.data());
 
-		// Construct the SimdMatrix "simd_view_proj"
+		// Construct the SimdMatrix "simd_view_proj", the rows are the columns of the world space to clip space matrix since the culling uses row vectors
 		const ::detail::SimdMatrix simd_view_proj =
 		{
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][3]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[0][0]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[0][1]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[0][2]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[0][3]),
+
+			::detail::float4(worldSpaceToClipSpaceMatrix[1][0]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[1][1]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[1][2]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[1][3]),
+
+			::detail::float4(worldSpaceToClipSpaceMatrix[2][0]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[2][1]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[2][2]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[2][3]),
+
+			::detail::float4(worldSpaceToClipSpaceMatrix[3][0]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[3][1]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[3][2]),
+			::detail::float4(worldSpaceToClipSpaceMatrix[3][3]),
 		};
 
 		{ // Do SIMD multi-threaded frustum-OOBB culling
@@ -783,13 +954,148 @@ namespace RendererRuntime
 		const glm::vec3& cameraPosition = cameraSceneItem->getParentSceneNodeSafe().getGlobalTransform().position;
 		for (uint32_t indirectionIndex = 0; indirectionIndex < numberOfOobbVisible; ++indirectionIndex)
 		{
-			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[mIndirection[indirectionIndex]], cameraPosition, renderQueueIndexRanges);
+			const uint32_t sceneItemIndex = mIndirection[indirectionIndex];
+			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[sceneItemIndex], cameraPosition, -mCullableSceneItemSet->negativeRadius[sceneItemIndex], projectionScale, renderQueueIndexRanges);
 		}
 
 		// Fill render queue index ranges with the always-visible stuff
 		for (const ISceneItem* sceneItem : mUncullableSceneItems)
 		{
-			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, renderQueueIndexRanges);
+			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, -1.0f, projectionScale, renderQueueIndexRanges);
+		}
+	}
+
+	uint32_t SceneCullingManager::addCullableSceneItem(ISceneItem& sceneItem)
+	{
+		SceneItemSet& sceneItemSet = *mCullableSceneItemSet;
+
+		// Grow the scene item set, if required
+		if (sceneItemSet.numberOfSceneItems == sceneItemSet.capacity)
+		{
+			::detail::resizeSceneItemSet(sceneItemSet, std::max(::detail::MINIMUM_SCENE_ITEM_SET_CAPACITY, sceneItemSet.capacity * 2));
+		}
+
+		// Get a handle
+		uint32_t handle = 0;
+		if (sceneItemSet.freeHandles.empty())
+		{
+			handle = static_cast<uint32_t>(sceneItemSet.indexByHandle.size());
+			sceneItemSet.indexByHandle.push_back(getUninitialized<uint32_t>());
+		}
+		else
+		{
+			handle = sceneItemSet.freeHandles.back();
+			sceneItemSet.freeHandles.pop_back();
+		}
+		const uint32_t index = sceneItemSet.numberOfSceneItems;
+		sceneItemSet.indexByHandle[handle] = index;
+		++sceneItemSet.numberOfSceneItems;
+
+		// Set minimum object space bounding box corner position
+		sceneItemSet.minimumX[index] = -0.5f;
+		sceneItemSet.minimumY[index] = -0.5f;
+		sceneItemSet.minimumZ[index] = -0.5f;
+
+		// Set maximum object space bounding box corner position
+		sceneItemSet.maximumX[index] = 0.5f;
+		sceneItemSet.maximumY[index] = 0.5f;
+		sceneItemSet.maximumZ[index] = 0.5f;
+
+		// Set object space to world space matrix
+		sceneItemSet.worldXX[index] = 1.0f;
+		sceneItemSet.worldXY[index] = 0.0f;
+		sceneItemSet.worldXZ[index] = 0.0f;
+		sceneItemSet.worldXW[index] = 0.0f;
+		sceneItemSet.worldYX[index] = 0.0f;
+		sceneItemSet.worldYY[index] = 1.0f;
+		sceneItemSet.worldYZ[index] = 0.0f;
+		sceneItemSet.worldYW[index] = 0.0f;
+		sceneItemSet.worldZX[index] = 0.0f;
+		sceneItemSet.worldZY[index] = 0.0f;
+		sceneItemSet.worldZZ[index] = 1.0f;
+		sceneItemSet.worldZW[index] = 0.0f;
+		sceneItemSet.worldWX[index] = 0.0f;
+		sceneItemSet.worldWY[index] = 0.0f;
+		sceneItemSet.worldWZ[index] = 0.0f;
+		sceneItemSet.worldWW[index] = 1.0f;
+
+		// Set world space center position of bounding sphere
+		sceneItemSet.spherePositionX[index] = 0.0f;
+		sceneItemSet.spherePositionY[index] = 0.0f;
+		sceneItemSet.spherePositionZ[index] = 0.0f;
+
+		// Set negative world space radius of bounding sphere
+		sceneItemSet.negativeRadius[index] = -1.0f;
+
+		sceneItemSet.visibilityFlag[index] = 0;
+		sceneItemSet.sceneItemVector[index] = &sceneItem;
+		sceneItemSet.handle[index] = handle;
+
+		// Done
+		return handle;
+	}
+
+	void SceneCullingManager::removeCullableSceneItem(uint32_t sceneItemSetHandle)
+	{
+		SceneItemSet& sceneItemSet = *mCullableSceneItemSet;
+		assert(sceneItemSetHandle < sceneItemSet.indexByHandle.size());
+		assert(isInitialized(sceneItemSet.indexByHandle[sceneItemSetHandle]));
+
+		// The scene item instance is going to be destroyed, don't reference it any longer
+		sceneItemSet.sceneItemVector[sceneItemSet.indexByHandle[sceneItemSetHandle]] = nullptr;
+		sceneItemSet.pendingRemovals.push_back(sceneItemSetHandle);
+	}
+
+	void SceneCullingManager::addUncullableSceneItem(ISceneItem& sceneItem)
+	{
+		assert(isUninitialized(sceneItem.mUncullableSceneItemIndex));
+		sceneItem.mUncullableSceneItemIndex = static_cast<uint32_t>(mUncullableSceneItems.size());
+		mUncullableSceneItems.push_back(&sceneItem);
+	}
+
+	void SceneCullingManager::removeUncullableSceneItem(uint32_t uncullableSceneItemIndex)
+	{
+		// The order is not stable so we can swap with the last element
+		assert(uncullableSceneItemIndex < mUncullableSceneItems.size());
+		ISceneItem* sceneItem = mUncullableSceneItems[uncullableSceneItemIndex];
+		ISceneItem* lastSceneItem = mUncullableSceneItems.back();
+		lastSceneItem->mUncullableSceneItemIndex = uncullableSceneItemIndex;
+		mUncullableSceneItems[uncullableSceneItemIndex] = lastSceneItem;
+		mUncullableSceneItems.pop_back();
+		setUninitialized(sceneItem->mUncullableSceneItemIndex);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void SceneCullingManager::updateCullableSceneItemSet()
+	{
+		SceneItemSet& sceneItemSet = *mCullableSceneItemSet;
+		if (!sceneItemSet.pendingRemovals.empty())
+		{
+			// Apply the batched removals: Move the last scene item into the free slot to keep the arrays dense
+			for (uint32_t handle : sceneItemSet.pendingRemovals)
+			{
+				const uint32_t index = sceneItemSet.indexByHandle[handle];
+				const uint32_t lastIndex = sceneItemSet.numberOfSceneItems - 1;
+				if (index != lastIndex)
+				{
+					::detail::moveSceneItem(sceneItemSet, lastIndex, index);
+					sceneItemSet.indexByHandle[sceneItemSet.handle[index]] = index;
+				}
+				sceneItemSet.sceneItemVector[lastIndex] = nullptr;
+				--sceneItemSet.numberOfSceneItems;
+				setUninitialized(sceneItemSet.indexByHandle[handle]);
+				sceneItemSet.freeHandles.push_back(handle);
+			}
+			sceneItemSet.pendingRemovals.clear();
+
+			// Shrink with hysteresis: Only shrink to half the capacity if less than a quarter is used, so scene item churn around a capacity boundary doesn't cause reallocations
+			if (sceneItemSet.capacity > ::detail::MINIMUM_SCENE_ITEM_SET_CAPACITY && sceneItemSet.numberOfSceneItems < sceneItemSet.capacity / 4)
+			{
+				::detail::resizeSceneItemSet(sceneItemSet, std::max(::detail::MINIMUM_SCENE_ITEM_SET_CAPACITY, ::detail::alignToSimdLaneCount(sceneItemSet.capacity / 2)));
+			}
 		}
 	}
 
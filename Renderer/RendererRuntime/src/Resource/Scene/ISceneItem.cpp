@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "RendererRuntime/PrecompiledHeader.h"
 #include "RendererRuntime/Resource/Scene/Item/ISceneItem.h"
+#include "RendererRuntime/Resource/Scene/SceneNode.h"
 #include "RendererRuntime/Resource/Scene/SceneResource.h"
 #include "RendererRuntime/Resource/Scene/Culling/SceneItemSet.h"
 #include "RendererRuntime/Resource/Scene/Culling/SceneCullingManager.h"
@@ -42,63 +43,37 @@ namespace RendererRuntime
 		mSceneResource(sceneResource),
 		mParentSceneNode(nullptr),
 		mSceneItemSet(nullptr),
-		mSceneItemSetIndex(getUninitialized<uint32_t>())
+		mSceneItemSetHandle(getUninitialized<uint32_t>()),
+		mUncullableSceneItemIndex(getUninitialized<uint32_t>()),
+		mSceneItemIndex(getUninitialized<uint32_t>()),
+		mSceneItemTypeIndex(getUninitialized<uint32_t>())
 	{
 		// TODO(co) The following is just for culling kickoff and won't stay this way
 		if (cullable)
 		{
 			mSceneItemSet = &mSceneResource.getSceneCullingManager().getCullableSceneItemSet();
-			mSceneItemSetIndex = mSceneItemSet->numberOfSceneItems;
-
-			// Set minimum object space bounding box corner position
-			mSceneItemSet->minimumX.push_back(-0.5f);
-			mSceneItemSet->minimumY.push_back(-0.5f);
-			mSceneItemSet->minimumZ.push_back(-0.5f);
-
-			// Set maximum object space bounding box corner position
-			mSceneItemSet->maximumX.push_back(0.5f);
-			mSceneItemSet->maximumY.push_back(0.5f);
-			mSceneItemSet->maximumZ.push_back(0.5f);
-
-			// Set object space to world space matrix
-			mSceneItemSet->worldXX.push_back(1.0f);
-			mSceneItemSet->worldXY.push_back(0.0f);
-			mSceneItemSet->worldXZ.push_back(0.0f);
-			mSceneItemSet->worldXW.push_back(0.0f);
-			mSceneItemSet->worldYX.push_back(0.0f);
-			mSceneItemSet->worldYY.push_back(1.0f);
-			mSceneItemSet->worldYZ.push_back(0.0f);
-			mSceneItemSet->worldYW.push_back(0.0f);
-			mSceneItemSet->worldZX.push_back(0.0f);
-			mSceneItemSet->worldZY.push_back(0.0f);
-			mSceneItemSet->worldZZ.push_back(1.0f);
-			mSceneItemSet->worldZW.push_back(0.0f);
-			mSceneItemSet->worldWX.push_back(0.0f);
-			mSceneItemSet->worldWY.push_back(0.0f);
-			mSceneItemSet->worldWZ.push_back(0.0f);
-			mSceneItemSet->worldWW.push_back(1.0f);
-
-			// Set world space center position of bounding sphere
-			mSceneItemSet->spherePositionX.push_back(0.0f);
-			mSceneItemSet->spherePositionY.push_back(0.0f);
-			mSceneItemSet->spherePositionZ.push_back(0.0f);
-
-			// Set negative world space radius of bounding sphere
-			mSceneItemSet->negativeRadius.push_back(-1.0f);
-
-			mSceneItemSet->visibilityFlag.push_back(0);
-			mSceneItemSet->sceneItemVector.push_back(this);
-			++mSceneItemSet->numberOfSceneItems;
+			mSceneItemSetHandle = mSceneResource.getSceneCullingManager().addCullableSceneItem(*this);
 		}
 		else
 		{
-			mSceneResource.getSceneCullingManager().getUncullableSceneItems().push_back(this);
+			mSceneResource.getSceneCullingManager().addUncullableSceneItem(*this);
 		}
 	}
 
 	ISceneItem::~ISceneItem()
 	{
-		// Nothing here
+		// The scene item must have been detached from its parent scene node before, "RendererRuntime::ISceneItem::onDetachedFromSceneNode()" is virtual
+		assert(nullptr == mParentSceneNode && "The scene item must be detached from its parent scene node before its destruction, use \"RendererRuntime::SceneResource::destroySceneItem()\"");
+
+		// Remove the scene item from the scene culling manager
+		if (nullptr != mSceneItemSet)
+		{
+			mSceneResource.getSceneCullingManager().removeCullableSceneItem(mSceneItemSetHandle);
+		}
+		else
+		{
+			mSceneResource.getSceneCullingManager().removeUncullableSceneItem(mUncullableSceneItemIndex);
+		}
 	}
 
 
@@ -64,6 +64,7 @@ namespace RendererRuntime
 		mPackedShaderData.radius = lightItem->radius;
 		setInnerOuterAngle(lightItem->innerAngle, lightItem->outerAngle);
 		mPackedShaderData.nearClipDistance = lightItem->nearClipDistance;
+		updateLightSceneItemRegistry();
 
 		// Sanity checks
 		assert(mPackedShaderData.color.r >= 0.0f && mPackedShaderData.color.g >= 0.0f && mPackedShaderData.color.b >= 0.0f);
@@ -82,8 +82,15 @@ namespace RendererRuntime
 
 	void MeshSceneItem::setMaterialResourceIdOfSubMesh(uint32_t subMeshIndex, MaterialResourceId materialResourceId)
 	{
-		assert(subMeshIndex < mRenderableManager.getRenderables().size());
-		mRenderableManager.getRenderables()[subMeshIndex].setMaterialResourceId(getSceneResource().getRendererRuntime().getMaterialResourceManager(), materialResourceId);
+		// The sub-mesh material is used by all LODs
+		const uint32_t numberOfSubMeshes = getNumberOfSubMeshes();
+		assert(subMeshIndex < numberOfSubMeshes);
+		const MaterialResourceManager& materialResourceManager = getSceneResource().getRendererRuntime().getMaterialResourceManager();
+		RenderableManager::Renderables& renderables = mRenderableManager.getRenderables();
+		for (size_t i = subMeshIndex; i < renderables.size(); i += numberOfSubMeshes)
+		{
+			renderables[i].setMaterialResourceId(materialResourceManager, materialResourceId);
+		}
 	}
 
 	void MeshSceneItem::setMaterialResourceIdOfAllSubMeshes(MaterialResourceId materialResourceId)
@@ -141,6 +148,8 @@ namespace RendererRuntime
 			{
 				RenderableManager::Renderables& renderables = mRenderableManager.getRenderables();
 				renderables.clear();
+				mRenderableManager.setLods(1, nullptr);
+				mRenderableManager.setInstanceCustomParameters(0, nullptr);
 
 				// Get mesh resource instance
 				const IRendererRuntime& rendererRuntime = getSceneResource().getRendererRuntime();
@@ -152,19 +161,20 @@ namespace RendererRuntime
 					if (nullptr != mSceneItemSet)
 					{
 						const SceneNode* parentSceneNode = getParentSceneNode();
+						const uint32_t sceneItemSetIndex = mSceneItemSet->indexByHandle[mSceneItemSetHandle];
 
 						{ // Set minimum object space bounding box corner position
 							const glm::vec3& minimumBoundingBoxPosition = meshResource->getMinimumBoundingBoxPosition();
-							mSceneItemSet->minimumX[mSceneItemSetIndex] = minimumBoundingBoxPosition.x;
-							mSceneItemSet->minimumY[mSceneItemSetIndex] = minimumBoundingBoxPosition.y;
-							mSceneItemSet->minimumZ[mSceneItemSetIndex] = minimumBoundingBoxPosition.z;
+							mSceneItemSet->minimumX[sceneItemSetIndex] = minimumBoundingBoxPosition.x;
+							mSceneItemSet->minimumY[sceneItemSetIndex] = minimumBoundingBoxPosition.y;
+							mSceneItemSet->minimumZ[sceneItemSetIndex] = minimumBoundingBoxPosition.z;
 						}
 
 						{ // Set maximum object space bounding box corner position
 							const glm::vec3& maximumBoundingBoxPosition = meshResource->getMaximumBoundingBoxPosition();
-							mSceneItemSet->maximumX[mSceneItemSetIndex] = maximumBoundingBoxPosition.x;
-							mSceneItemSet->maximumY[mSceneItemSetIndex] = maximumBoundingBoxPosition.y;
-							mSceneItemSet->maximumZ[mSceneItemSetIndex] = maximumBoundingBoxPosition.z;
+							mSceneItemSet->maximumX[sceneItemSetIndex] = maximumBoundingBoxPosition.x;
+							mSceneItemSet->maximumY[sceneItemSetIndex] = maximumBoundingBoxPosition.y;
+							mSceneItemSet->maximumZ[sceneItemSetIndex] = maximumBoundingBoxPosition.z;
 						}
 
 						{ // Set world space center position of bounding sphere
@@ -173,15 +183,15 @@ namespace RendererRuntime
 							{
 								const glm::vec3& position = parentSceneNode->getTransform().position;
 								const glm::vec3& scale = parentSceneNode->getTransform().scale;
-								mSceneItemSet->spherePositionX[mSceneItemSetIndex] = boundingSpherePosition.x * scale.x + position.x;
-								mSceneItemSet->spherePositionY[mSceneItemSetIndex] = boundingSpherePosition.y * scale.y + position.y;
-								mSceneItemSet->spherePositionZ[mSceneItemSetIndex] = boundingSpherePosition.z * scale.z + position.z;
+								mSceneItemSet->spherePositionX[sceneItemSetIndex] = boundingSpherePosition.x * scale.x + position.x;
+								mSceneItemSet->spherePositionY[sceneItemSetIndex] = boundingSpherePosition.y * scale.y + position.y;
+								mSceneItemSet->spherePositionZ[sceneItemSetIndex] = boundingSpherePosition.z * scale.z + position.z;
 							}
 							else
 							{
-								mSceneItemSet->spherePositionX[mSceneItemSetIndex] = boundingSpherePosition.x;
-								mSceneItemSet->spherePositionY[mSceneItemSetIndex] = boundingSpherePosition.y;
-								mSceneItemSet->spherePositionZ[mSceneItemSetIndex] = boundingSpherePosition.z;
+								mSceneItemSet->spherePositionX[sceneItemSetIndex] = boundingSpherePosition.x;
+								mSceneItemSet->spherePositionY[sceneItemSetIndex] = boundingSpherePosition.y;
+								mSceneItemSet->spherePositionZ[sceneItemSetIndex] = boundingSpherePosition.z;
 							}
 						}
 
@@ -191,14 +201,14 @@ namespace RendererRuntime
 							{
 								boundingSphereRadius *= glm::compMax(parentSceneNode->getTransform().scale);
 							}
-							mSceneItemSet->negativeRadius[mSceneItemSetIndex] = -boundingSphereRadius;
+							mSceneItemSet->negativeRadius[sceneItemSetIndex] = -boundingSphereRadius;
 						}
 					}
 
 					// Get vertex array instance
 					const Renderer::IVertexArrayPtr vertexArrayPtr = meshResource->getVertexArrayPtr();
 
-					// Set material resource ID of each sub-mesh
+					// Set material resource ID of each sub-mesh, the sub-meshes of all LODs are stored LOD-major
 					const SkeletonResourceId skeletonResourceId = meshResource->getSkeletonResourceId();
 					MaterialResourceManager& materialResourceManager = rendererRuntime.getMaterialResourceManager();
 					const SubMeshes& subMeshes = static_cast<const MeshResource&>(resource).getSubMeshes();
@@ -209,13 +219,24 @@ namespace RendererRuntime
 						const SubMesh& subMesh = subMeshes[i];
 						renderables.emplace_back(mRenderableManager, vertexArrayPtr, true, subMesh.getStartIndexLocation(), subMesh.getNumberOfIndices(), materialResourceManager, subMesh.getMaterialResourceId(), skeletonResourceId);
 					}
+					if (meshResource->getNumberOfLods() > 1)
+					{
+						mRenderableManager.setLods(meshResource->getNumberOfLods(), meshResource->getLodMinimumScreenSizes().data());
+					}
+
+					// Pass on the optional vertex dequantization of quantized meshes, the shaders get it via the instance texture buffer
+					const MeshResource::VertexDequantization& vertexDequantization = meshResource->getVertexDequantization();
+					if (!vertexDequantization.empty())
+					{
+						mRenderableManager.setInstanceCustomParameters(static_cast<uint32_t>(vertexDequantization.size()), vertexDequantization.data());
+					}
 
 					// Handle overwritten sub-meshes
 					// -> In case the overwritten material resource is not yet fully loaded, the original material resource of the sub-mesh is temporarily used
 					// -> In case there are more overwritten sub-meshes as there are sub-meshes, be error tolerant here (mesh assets might have been changed, but not updated scene assets in use)
 					if (!mSubMeshMaterialAssetIds.empty())
 					{
-						const uint32_t numberOfMaterials = static_cast<uint32_t>(std::min(mSubMeshMaterialAssetIds.size(), mRenderableManager.getRenderables().size()));
+						const uint32_t numberOfMaterials = std::min(static_cast<uint32_t>(mSubMeshMaterialAssetIds.size()), getNumberOfSubMeshes());
 						for (size_t i = 0; i < numberOfMaterials; ++i)
 						{
 							if (isInitialized(mSubMeshMaterialAssetIds[i]))
@@ -234,13 +255,13 @@ namespace RendererRuntime
 			{
 				// Overwritten sub-mesh material loaded now?
 				// -> In case there are more overwritten sub-meshes as there are sub-meshes, be error tolerant here (mesh assets might have been changed, but not updated scene assets in use)
-				const uint32_t numberOfMaterials = static_cast<uint32_t>(std::min(mSubMeshMaterialAssetIds.size(), mRenderableManager.getRenderables().size()));
+				const uint32_t numberOfMaterials = std::min(static_cast<uint32_t>(mSubMeshMaterialAssetIds.size()), getNumberOfSubMeshes());
 				bool updateCachedRenderablesDataRequired = false;
 				for (uint32_t i = 0; i < numberOfMaterials; ++i)
 				{
 					if (resource.getAssetId() == mSubMeshMaterialAssetIds[i])
 					{
-						mRenderableManager.getRenderables()[i].setMaterialResourceId(getSceneResource().getRendererRuntime().getMaterialResourceManager(), resource.getId());
+						setMaterialResourceIdOfSubMesh(i, resource.getId());
 
 						// Don't break, multiple sub-meshes might use one and the same material resource
 						updateCachedRenderablesDataRequired = true;
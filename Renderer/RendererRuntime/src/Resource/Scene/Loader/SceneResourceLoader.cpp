@@ -25,6 +25,7 @@
 #include "RendererRuntime/Resource/Scene/Loader/SceneResourceLoader.h"
 #include "RendererRuntime/Resource/Scene/Loader/SceneFileFormat.h"
 #include "RendererRuntime/Resource/Scene/Item/ISceneItem.h"
+#include "RendererRuntime/Resource/Scene/SceneNode.h"
 #include "RendererRuntime/Resource/Scene/SceneResource.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
@@ -44,7 +45,7 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
-		void itemDeserialization(RendererRuntime::IFile& file, RendererRuntime::SceneResource& sceneResource, RendererRuntime::SceneNode& sceneNode)
+		void itemDeserialization(RendererRuntime::IFile& file, RendererRuntime::SceneResource& sceneResource, RendererRuntime::SceneNode& sceneNode, std::vector<uint8_t>& itemData)
 		{
 			// Read the scene item header
 			RendererRuntime::v1Scene::ItemHeader itemHeader;
@@ -52,57 +53,84 @@ namespace
 
 			// Create the scene item
 			RendererRuntime::ISceneItem* sceneItem = sceneResource.createSceneItem(itemHeader.typeId, sceneNode);
-			if (nullptr != sceneItem && 0 != itemHeader.numberOfBytes)
+			if (nullptr != sceneItem)
 			{
-				// Load in the scene item data
-				// TODO(co) Get rid of the new/delete in here
-				uint8_t* data = new uint8_t[itemHeader.numberOfBytes];
-				file.read(data, itemHeader.numberOfBytes);
-
-				// Deserialize the scene item
-				sceneItem->deserialize(itemHeader.numberOfBytes, data);
-
-				// Cleanup
-				delete [] data;
-			}
-			else
-			{
-				// TODO(co) Error handling
-			}
-		}
-
-		void nodeDeserialization(RendererRuntime::IFile& file, RendererRuntime::SceneResource& sceneResource)
-		{
-			// Read in the scene node
-			RendererRuntime::v1Scene::Node node;
-			file.read(&node, sizeof(RendererRuntime::v1Scene::Node));
-
-			// Create the scene node
-			RendererRuntime::SceneNode* sceneNode = sceneResource.createSceneNode(node.transform);
-			if (nullptr != sceneNode)
-			{
-				// Read in the scene items
-				for (uint32_t i = 0; i < node.numberOfItems; ++i)
+				if (0 != itemHeader.numberOfBytes)
 				{
-					itemDeserialization(file, sceneResource, *sceneNode);
+					// Load in the scene item data, the buffer is reused for all scene items
+					if (itemData.size() < itemHeader.numberOfBytes)
+					{
+						itemData.resize(itemHeader.numberOfBytes);
+					}
+					file.read(itemData.data(), itemHeader.numberOfBytes);
+
+					// Deserialize the scene item
+					sceneItem->deserialize(itemHeader.numberOfBytes, itemData.data());
 				}
 			}
 			else
 			{
 				// TODO(co) Error handling
+				file.skip(itemHeader.numberOfBytes);
 			}
 		}
 
 		void nodesDeserialization(RendererRuntime::IFile& file, RendererRuntime::SceneResource& sceneResource)
 		{
-			// Read in the scene nodes
+			// Read in the scene nodes header
 			RendererRuntime::v1Scene::Nodes nodes;
 			file.read(&nodes, sizeof(RendererRuntime::v1Scene::Nodes));
+			const uint32_t numberOfSceneNodes = nodes.numberOfNodes + nodes.numberOfInstanceNodes;
+			if (0 == numberOfSceneNodes)
+			{
+				// Nothing to do
+				return;
+			}
 
-			// Read in the scene nodes
-			for (uint32_t i = 0; i < nodes.numberOfNodes; ++i)
+			// Read in the transforms of all scene nodes in one go and create all scene nodes at once
+			RendererRuntime::SceneNode* sceneNodes = nullptr;
 			{
-				nodeDeserialization(file, sceneResource);
+				std::vector<RendererRuntime::Transform> transforms(numberOfSceneNodes);
+				file.read(transforms.data(), sizeof(RendererRuntime::Transform) * numberOfSceneNodes);
+				sceneNodes = sceneResource.createSceneNodes(numberOfSceneNodes, transforms.data());
+			}
+			std::vector<uint8_t> itemData;
+
+			// Read in the scene items of the regular scene nodes
+			if (nodes.numberOfNodes > 0)
+			{
+				std::vector<uint32_t> numberOfItems(nodes.numberOfNodes);
+				file.read(numberOfItems.data(), sizeof(uint32_t) * nodes.numberOfNodes);
+				for (uint32_t nodeIndex = 0; nodeIndex < nodes.numberOfNodes; ++nodeIndex)
+				{
+					RendererRuntime::SceneNode& sceneNode = sceneNodes[nodeIndex];
+					for (uint32_t i = 0; i < numberOfItems[nodeIndex]; ++i)
+					{
+						itemDeserialization(file, sceneResource, sceneNode, itemData);
+					}
+				}
+			}
+
+			// Read in the instance groups, the instance scene nodes are stored behind the regular scene nodes
+			RendererRuntime::SceneNode* instanceSceneNodes = sceneNodes + nodes.numberOfNodes;
+			for (uint32_t i = 0; i < nodes.numberOfInstanceGroups; ++i)
+			{
+				// Read in the instance group header and the scene item data shared by all instances
+				RendererRuntime::v1Scene::InstanceGroup instanceGroup;
+				file.read(&instanceGroup, sizeof(RendererRuntime::v1Scene::InstanceGroup));
+				if (itemData.size() < instanceGroup.numberOfBytes)
+				{
+					itemData.resize(instanceGroup.numberOfBytes);
+				}
+				if (0 != instanceGroup.numberOfBytes)
+				{
+					file.read(itemData.data(), instanceGroup.numberOfBytes);
+				}
+
+				// Create all scene items of the instance group at once
+				assert(instanceSceneNodes + instanceGroup.numberOfInstances <= sceneNodes + numberOfSceneNodes);
+				sceneResource.createSceneItems(instanceGroup.typeId, instanceGroup.numberOfInstances, instanceSceneNodes, instanceGroup.numberOfBytes, itemData.data());
+				instanceSceneNodes += instanceGroup.numberOfInstances;
 			}
 		}
 
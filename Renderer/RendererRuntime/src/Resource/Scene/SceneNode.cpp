@@ -26,6 +26,7 @@
 #include "RendererRuntime/Resource/Scene/SceneResource.h"
 #include "RendererRuntime/Resource/Scene/Item/ISceneItem.h"
 #include "RendererRuntime/Resource/Scene/Item/Mesh/MeshSceneItem.h"
+#include "RendererRuntime/Resource/Scene/Item/Light/LightSceneItem.h"
 #include "RendererRuntime/Resource/Scene/Culling/SceneItemSet.h"
 #include "RendererRuntime/Resource/Mesh/MeshResourceManager.h"
 #include "RendererRuntime/Resource/Mesh/MeshResource.h"
@@ -53,7 +54,8 @@ namespace RendererRuntime
 		// TODO(co) Need to guarantee that one scene node is only attached to one scene node at the same time
 		mAttachedSceneNodes.push_back(&sceneNode);
 		sceneNode.mParentSceneNode = this;
-		sceneNode.updateGlobalTransformRecursive();
+		sceneNode.setTransformDirty();
+		mSceneResource.mSceneNodeHierarchyDirty = true;
 	}
 
 	void SceneNode::detachAllSceneNodes()
@@ -61,9 +63,13 @@ namespace RendererRuntime
 		for (SceneNode* sceneNode : mAttachedSceneNodes)
 		{
 			sceneNode->mParentSceneNode = nullptr;
-			sceneNode->updateGlobalTransformRecursive();
+			sceneNode->setTransformDirty();
+		}
+		if (!mAttachedSceneNodes.empty())
+		{
+			mAttachedSceneNodes.clear();
+			mSceneResource.mSceneNodeHierarchyDirty = true;
 		}
-		mAttachedSceneNodes.clear();
 	}
 
 	void SceneNode::setVisible(bool visible)
@@ -83,6 +89,16 @@ namespace RendererRuntime
 		sceneItem.onAttachedToSceneNode(*this);
 	}
 
+	void SceneNode::detachSceneItem(ISceneItem& sceneItem)
+	{
+		AttachedSceneItems::iterator iterator = std::find(mAttachedSceneItems.begin(), mAttachedSceneItems.end(), &sceneItem);
+		if (iterator != mAttachedSceneItems.end())
+		{
+			mAttachedSceneItems.erase(iterator);
+			sceneItem.onDetachedFromSceneNode(*this);
+		}
+	}
+
 	void SceneNode::detachAllSceneItems()
 	{
 		for (ISceneItem* sceneItem : mAttachedSceneItems)
@@ -104,12 +120,25 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
-	void SceneNode::updateGlobalTransformRecursive()
+	bool SceneNode::updateGlobalTransformOnDemand() const
 	{
-		// Backup the previous global transform
-		mPreviousGlobalTransform = mGlobalTransform;
+		// The global transform is outdated if the local transform of the scene node or of one of its parent scene nodes has been changed
+		const bool parentSceneNodeDirty = (nullptr != mParentSceneNode && mParentSceneNode->updateGlobalTransformOnDemand());
+		assert(mSceneNodeIndex < mSceneResource.mSceneNodeDirtyFlags.size());
+		uint8_t& dirtyFlag = mSceneResource.mSceneNodeDirtyFlags[mSceneNodeIndex];
+		if (!parentSceneNodeDirty && SceneResource::CLEAN == dirtyFlag)
+		{
+			return false;
+		}
 
-		// Update this node
+		// Backup the previous global transform only once until the next batch update, the scene node stays dirty so the batch update still updates the scene items
+		if (SceneResource::GLOBAL_TRANSFORM_DERIVED_ON_DEMAND != dirtyFlag)
+		{
+			mPreviousGlobalTransform = mGlobalTransform;
+			dirtyFlag = SceneResource::GLOBAL_TRANSFORM_DERIVED_ON_DEMAND;
+		}
+
+		// Update this node, the parent scene node global transform is already up-to-date
 		if (nullptr != mParentSceneNode)
 		{
 			mGlobalTransform = mParentSceneNode->mGlobalTransform;
@@ -120,47 +149,75 @@ namespace RendererRuntime
 			mGlobalTransform = mTransform;
 		}
 
-		// Update scene items
-		for (ISceneItem* sceneItem : mAttachedSceneItems)
+		// Done
+		return true;
+	}
+
+	void SceneNode::updateGlobalTransform()
+	{
+		// Backup the previous global transform, unless this has already been done while deriving the global transform on demand
+		if (SceneResource::GLOBAL_TRANSFORM_DERIVED_ON_DEMAND != mSceneResource.mSceneNodeDirtyFlags[mSceneNodeIndex])
 		{
-			updateSceneItemTransform(*sceneItem);
+			mPreviousGlobalTransform = mGlobalTransform;
 		}
 
-		// Update attached scene nodes
-		for (SceneNode* sceneNode : mAttachedSceneNodes)
+		// Update this node, the parent scene node global transform is already up-to-date
+		if (nullptr != mParentSceneNode)
+		{
+			mGlobalTransform = mParentSceneNode->mGlobalTransform;
+			mGlobalTransform += mTransform;
+		}
+		else
+		{
+			mGlobalTransform = mTransform;
+		}
+
+		// Update scene items
+		for (ISceneItem* sceneItem : mAttachedSceneItems)
 		{
-			sceneNode->mGlobalTransform = mGlobalTransform;
-			sceneNode->mGlobalTransform += sceneNode->mTransform;
-			sceneNode->updateGlobalTransformRecursive();
+			updateSceneItemTransform(*sceneItem);
 		}
 	}
 
 	void SceneNode::updateSceneItemTransform(ISceneItem& sceneItem)
 	{
+		// Update the world space light position inside the light scene item registry
+		if (sceneItem.getSceneItemTypeId() == LightSceneItem::TYPE_ID)
+		{
+			const uint32_t lightSceneItemRegistryIndex = static_cast<LightSceneItem&>(sceneItem).mLightSceneItemRegistryIndex;
+			if (isInitialized(lightSceneItemRegistryIndex))
+			{
+				SceneResource::LightSceneItemRegistry& registry = sceneItem.getSceneResource().mLightSceneItemRegistry;
+				registry.positionX[lightSceneItemRegistryIndex] = mGlobalTransform.position.x;
+				registry.positionY[lightSceneItemRegistryIndex] = mGlobalTransform.position.y;
+				registry.positionZ[lightSceneItemRegistryIndex] = mGlobalTransform.position.z;
+			}
+		}
+
 		// TODO(co) The following is just for culling kickoff and won't stay this way
 		SceneItemSet* sceneItemSet = sceneItem.mSceneItemSet;
 		if (nullptr != sceneItemSet)
 		{
-			const uint32_t sceneItemSetIndex = sceneItem.mSceneItemSetIndex;
+			const uint32_t sceneItemSetIndex = sceneItemSet->indexByHandle[sceneItem.mSceneItemSetHandle];
 
-			{ // Set object space to world space matrix
+			{ // Set object space to world space matrix, "worldXY" is the y-component of the transformed x-axis (the culling uses row vectors)
 				glm::mat4 objectSpaceToWorldSpace;
 				mGlobalTransform.getAsMatrix(objectSpaceToWorldSpace);
 				sceneItemSet->worldXX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][0];
-				sceneItemSet->worldXY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][0];
-				sceneItemSet->worldXZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][0];
-				sceneItemSet->worldXW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][0];
-				sceneItemSet->worldYX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][1];
+				sceneItemSet->worldXY[sceneItemSetIndex] = objectSpaceToWorldSpace[0][1];
+				sceneItemSet->worldXZ[sceneItemSetIndex] = objectSpaceToWorldSpace[0][2];
+				sceneItemSet->worldXW[sceneItemSetIndex] = objectSpaceToWorldSpace[0][3];
+				sceneItemSet->worldYX[sceneItemSetIndex] = objectSpaceToWorldSpace[1][0];
 				sceneItemSet->worldYY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][1];
-				sceneItemSet->worldYZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][1];
-				sceneItemSet->worldYW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][1];
-				sceneItemSet->worldZX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][2];
-				sceneItemSet->worldZY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][2];
+				sceneItemSet->worldYZ[sceneItemSetIndex] = objectSpaceToWorldSpace[1][2];
+				sceneItemSet->worldYW[sceneItemSetIndex] = objectSpaceToWorldSpace[1][3];
+				sceneItemSet->worldZX[sceneItemSetIndex] = objectSpaceToWorldSpace[2][0];
+				sceneItemSet->worldZY[sceneItemSetIndex] = objectSpaceToWorldSpace[2][1];
 				sceneItemSet->worldZZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][2];
-				sceneItemSet->worldZW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][2];
-				sceneItemSet->worldWX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][3];
-				sceneItemSet->worldWY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][3];
-				sceneItemSet->worldWZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][3];
+				sceneItemSet->worldZW[sceneItemSetIndex] = objectSpaceToWorldSpace[2][3];
+				sceneItemSet->worldWX[sceneItemSetIndex] = objectSpaceToWorldSpace[3][0];
+				sceneItemSet->worldWY[sceneItemSetIndex] = objectSpaceToWorldSpace[3][1];
+				sceneItemSet->worldWZ[sceneItemSetIndex] = objectSpaceToWorldSpace[3][2];
 				sceneItemSet->worldWW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][3];
 			}
 
@@ -26,11 +26,50 @@
 #include "RendererRuntime/Resource/Scene/SceneNode.h"
 #include "RendererRuntime/Resource/Scene/SceneResourceManager.h"
 #include "RendererRuntime/Resource/Scene/Item/ISceneItem.h"
+#include "RendererRuntime/Resource/Scene/Item/Light/LightSceneItem.h"
 #include "RendererRuntime/Resource/Scene/Factory/ISceneFactory.h"
 #include "RendererRuntime/Resource/Scene/Culling/SceneCullingManager.h"
+#include "RendererRuntime/Core/Math/Math.h"
+#include "RendererRuntime/Core/Thread/ThreadPool.h"
+#include "RendererRuntime/Core/Time/CpuProfiler.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
 
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		static const RendererRuntime::SceneResource::SceneItems NO_SCENE_ITEMS;
+		static const size_t SCENE_NODES_MULTI_THREADING_THRESHOLD = 1024;	///< Below this number of scene nodes inside a depth level, the global transforms are updated directly inside the current thread	TODO(co) This value needs to be fine-tuned
+		static const size_t SCENE_NODES_SPLIT_COUNT = 256;					///< Package size for each thread to work on	TODO(co) This value needs to be fine-tuned
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		template <typename T>
+		void swapAndPopBack(std::vector<T>& vector, uint32_t index)
+		{
+			vector[index] = vector.back();
+			vector.pop_back();
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -62,18 +101,61 @@ namespace RendererRuntime
 
 	SceneNode* SceneResource::createSceneNode(const Transform& transform)
 	{
-		SceneNode* sceneNode = new SceneNode(transform);
-		mSceneNodes.push_back(sceneNode);
+		SceneNode* sceneNode = new SceneNode(*this, transform);
+		addSceneNode(*sceneNode);
+
+		// Append the new root scene node to the flattened scene node hierarchy, it will be sorted in during the next global transforms update
+		sceneNode->mSceneNodeIndex = static_cast<uint32_t>(mSortedSceneNodes.size());
+		mSortedSceneNodes.push_back(sceneNode);
+		mSortedParentIndices.push_back(getUninitialized<uint32_t>());
+		mSceneNodeDirtyFlags.push_back(CLEAN);
+		mSceneNodeHierarchyDirty = true;
+
+		// Done
 		return sceneNode;
 	}
 
+	SceneNode* SceneResource::createSceneNodes(uint32_t numberOfSceneNodes, const Transform* transforms)
+	{
+		// Sanity checks
+		assert(numberOfSceneNodes > 0);
+		assert(nullptr != transforms);
+
+		// Allocate the scene node memory pool in one go
+		SceneNode* sceneNodes = static_cast<SceneNode*>(::operator new(sizeof(SceneNode) * numberOfSceneNodes));
+		mSceneNodePools.push_back({sceneNodes, numberOfSceneNodes, numberOfSceneNodes});
+
+		// Reserve the scene node hierarchy memory in one go as well
+		const size_t numberOfSortedSceneNodes = mSortedSceneNodes.size();
+		const size_t newNumberOfSortedSceneNodes = numberOfSortedSceneNodes + numberOfSceneNodes;
+		mSceneNodes.reserve(mSceneNodes.size() + numberOfSceneNodes);
+		mSortedSceneNodes.reserve(newNumberOfSortedSceneNodes);
+		mSortedParentIndices.resize(newNumberOfSortedSceneNodes, getUninitialized<uint32_t>());
+		mSceneNodeDirtyFlags.resize(newNumberOfSortedSceneNodes, CLEAN);
+
+		// Construct the new root scene nodes and append them to the flattened scene node hierarchy, they will be sorted in during the next global transforms update
+		for (uint32_t i = 0; i < numberOfSceneNodes; ++i)
+		{
+			SceneNode* sceneNode = new (&sceneNodes[i]) SceneNode(*this, transforms[i]);
+			sceneNode->mSceneNodeIndex = static_cast<uint32_t>(numberOfSortedSceneNodes + i);
+			addSceneNode(*sceneNode);
+			mSortedSceneNodes.push_back(sceneNode);
+		}
+		mSceneNodeHierarchyDirty = true;
+
+		// Done
+		return sceneNodes;
+	}
+
 	void SceneResource::destroySceneNode(SceneNode& sceneNode)
 	{
-		SceneNodes::iterator iterator = std::find(mSceneNodes.begin(), mSceneNodes.end(), &sceneNode);
-		if (iterator != mSceneNodes.end())
+		const uint32_t unsortedSceneNodeIndex = sceneNode.mUnsortedSceneNodeIndex;
+		if (unsortedSceneNodeIndex < mSceneNodes.size() && mSceneNodes[unsortedSceneNodeIndex] == &sceneNode)
 		{
-			mSceneNodes.erase(iterator);
-			delete &sceneNode;
+			removeSceneNode(sceneNode);
+			mSortedSceneNodes[sceneNode.mSceneNodeIndex] = nullptr;
+			mSceneNodeHierarchyDirty = true;
+			deleteSceneNode(sceneNode);
 		}
 		else
 		{
@@ -83,12 +165,94 @@ namespace RendererRuntime
 
 	void SceneResource::destroyAllSceneNodes()
 	{
+		// Break up the scene node hierarchy first, the destruction order of the scene nodes is arbitrary
+		for (SceneNode* sceneNode : mSceneNodes)
+		{
+			sceneNode->mParentSceneNode = nullptr;
+			sceneNode->mAttachedSceneNodes.clear();
+		}
 		const size_t numberOfSceneNodes = mSceneNodes.size();
-		for (size_t i = 0; i < numberOfSceneNodes; ++i)
+		if (mSceneNodePools.empty())
 		{
-			delete mSceneNodes[i];
+			for (size_t i = 0; i < numberOfSceneNodes; ++i)
+			{
+				delete mSceneNodes[i];
+			}
+		}
+		else
+		{
+			for (size_t i = 0; i < numberOfSceneNodes; ++i)
+			{
+				deleteSceneNode(*mSceneNodes[i]);
+			}
+			assert(mSceneNodePools.empty());
 		}
 		mSceneNodes.clear();
+		mSortedSceneNodes.clear();
+		mSortedParentIndices.clear();
+		mDepthOffsets.clear();
+		mSceneNodeDirtyFlags.clear();
+		mSceneNodeHierarchyDirty = false;
+		mSceneNodeTransformDirty = false;
+	}
+
+	void SceneResource::updateGlobalTransforms()
+	{
+		RENDERER_RUNTIME_CPU_PROFILER_SCOPE_FUNCTION()
+
+		// Sort the scene node hierarchy by depth, if required
+		if (mSceneNodeHierarchyDirty)
+		{
+			rebuildSceneNodeHierarchy();
+		}
+
+		// Update the global transforms of dirty scene nodes and their children, depth level by depth level
+		// -> Scene nodes of the same depth level are independent of each other, so each depth level can be processed in parallel
+		if (mSceneNodeTransformDirty)
+		{
+			// Global transforms mustn't be derived on demand while the worker threads are updating them
+			mSceneNodeTransformDirty = false;
+			DefaultThreadPool& defaultThreadPool = getRendererRuntime().getDefaultThreadPool();
+			const size_t numberOfDepthLevels = mDepthOffsets.size() - 1;
+			for (size_t depthLevel = 0; depthLevel < numberOfDepthLevels; ++depthLevel)
+			{
+				const uint32_t startIndex = mDepthOffsets[depthLevel];
+				const uint32_t endIndex = mDepthOffsets[depthLevel + 1];
+				size_t itemCount = endIndex - startIndex;
+				if (itemCount < ::detail::SCENE_NODES_MULTI_THREADING_THRESHOLD)
+				{
+					// Just execute it directly inside the current thread, not worth the additional threading effort
+					updateGlobalTransformsRange(startIndex, endIndex);
+				}
+				else
+				{
+					size_t splitCount = ::detail::SCENE_NODES_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+					const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
+					if (1 == threadCount)
+					{
+						updateGlobalTransformsRange(startIndex, endIndex);
+					}
+					else
+					{
+						// Multi-threaded
+						uint32_t threadStartIndex = startIndex;
+						for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+						{
+							const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+							defaultThreadPool.queueTask(std::bind(&SceneResource::updateGlobalTransformsRange, this, threadStartIndex, static_cast<uint32_t>(threadStartIndex + numberOfItemsToProcess)));
+							itemCount -= splitCount;
+							threadStartIndex += static_cast<uint32_t>(splitCount);
+						}
+
+						// Wait that all worker threads have done their part of the calculation, the next depth level depends on the result
+						defaultThreadPool.process();
+					}
+				}
+			}
+
+			// All scene nodes are up-to-date now
+			std::fill(mSceneNodeDirtyFlags.begin(), mSceneNodeDirtyFlags.end(), static_cast<uint8_t>(CLEAN));
+		}
 	}
 
 	ISceneItem* SceneResource::createSceneItem(SceneItemTypeId sceneItemTypeId, SceneNode& sceneNode)
@@ -102,7 +266,7 @@ namespace RendererRuntime
 		if (nullptr != sceneItem)
 		{
 			sceneNode.attachSceneItem(*sceneItem);
-			mSceneItems.push_back(sceneItem);
+			registerSceneItem(*sceneItem);
 		}
 		else
 		{
@@ -111,12 +275,56 @@ namespace RendererRuntime
 		return sceneItem;
 	}
 
+	void SceneResource::createSceneItems(SceneItemTypeId sceneItemTypeId, uint32_t numberOfSceneNodes, SceneNode* sceneNodes, uint32_t numberOfBytes, const uint8_t* data)
+	{
+		// Sanity checks
+		assert(nullptr != sceneNodes || 0 == numberOfSceneNodes);
+		assert(nullptr != data || 0 == numberOfBytes);
+
+		// Get the scene factory
+		if (nullptr == mSceneFactory)
+		{
+			mSceneFactory = &getResourceManager<SceneResourceManager>().getSceneFactory();
+		}
+		assert(nullptr != mSceneFactory);
+
+		// Reserve the scene item memory in one go
+		mSceneItems.reserve(mSceneItems.size() + numberOfSceneNodes);
+		SceneItems& sceneItemsOfType = mSceneItemsByTypeId[sceneItemTypeId];
+		sceneItemsOfType.reserve(sceneItemsOfType.size() + numberOfSceneNodes);
+
+		// Create, attach and deserialize the scene items
+		for (uint32_t i = 0; i < numberOfSceneNodes; ++i)
+		{
+			ISceneItem* sceneItem = mSceneFactory->createSceneItem(sceneItemTypeId, *this);
+			if (nullptr != sceneItem)
+			{
+				sceneNodes[i].attachSceneItem(*sceneItem);
+				registerSceneItem(*sceneItem);
+				if (0 != numberOfBytes)
+				{
+					sceneItem->deserialize(numberOfBytes, data);
+				}
+			}
+			else
+			{
+				// TODO(co) Error handling
+				break;
+			}
+		}
+	}
+
 	void SceneResource::destroySceneItem(ISceneItem& sceneItem)
 	{
-		SceneItems::iterator iterator = std::find(mSceneItems.begin(), mSceneItems.end(), &sceneItem);
-		if (iterator != mSceneItems.end())
+		const uint32_t sceneItemIndex = sceneItem.mSceneItemIndex;
+		if (sceneItemIndex < mSceneItems.size() && mSceneItems[sceneItemIndex] == &sceneItem)
 		{
-			mSceneItems.erase(iterator);
+			// Detach the scene item from its parent scene node while it's still fully alive, the detach notification is a virtual method call
+			if (nullptr != sceneItem.mParentSceneNode)
+			{
+				sceneItem.mParentSceneNode->detachSceneItem(sceneItem);
+			}
+			unregisterSceneItem(sceneItem);
 			delete &sceneItem;
 		}
 		else
@@ -130,9 +338,22 @@ namespace RendererRuntime
 		const size_t numberOfSceneItems = mSceneItems.size();
 		for (size_t i = 0; i < numberOfSceneItems; ++i)
 		{
-			delete mSceneItems[i];
+			ISceneItem* sceneItem = mSceneItems[i];
+			if (nullptr != sceneItem->mParentSceneNode)
+			{
+				sceneItem->mParentSceneNode->detachSceneItem(*sceneItem);
+			}
+			delete sceneItem;
 		}
 		mSceneItems.clear();
+		mSceneItemsByTypeId.clear();
+		mLightSceneItemRegistry = LightSceneItemRegistry();
+	}
+
+	const SceneResource::SceneItems& SceneResource::getSceneItemsByTypeId(SceneItemTypeId sceneItemTypeId) const
+	{
+		SceneItemsByTypeId::const_iterator iterator = mSceneItemsByTypeId.find(sceneItemTypeId);
+		return (iterator != mSceneItemsByTypeId.cend()) ? iterator->second : ::detail::NO_SCENE_ITEMS;
 	}
 
 
@@ -146,6 +367,9 @@ namespace RendererRuntime
 		assert(nullptr == mSceneCullingManager);
 		assert(mSceneNodes.empty());
 		assert(mSceneItems.empty());
+		assert(mSceneItemsByTypeId.empty());
+		assert(mLightSceneItemRegistry.lightSceneItems.empty());
+		assert(mSortedSceneNodes.empty());
 
 		// Create scene culling manager
 		mSceneCullingManager = new SceneCullingManager();
@@ -166,6 +390,204 @@ namespace RendererRuntime
 		IResource::deinitializeElement();
 	}
 
+	void SceneResource::rebuildSceneNodeHierarchy()
+	{
+		// Gather the depth of each scene node and the number of scene nodes per depth level
+		const uint32_t numberOfSceneNodes = static_cast<uint32_t>(mSceneNodes.size());
+		Indices depths(numberOfSceneNodes);
+		Indices numberOfSceneNodesPerDepth;
+		for (uint32_t i = 0; i < numberOfSceneNodes; ++i)
+		{
+			uint32_t depth = 0;
+			for (const SceneNode* parentSceneNode = mSceneNodes[i]->mParentSceneNode; nullptr != parentSceneNode; parentSceneNode = parentSceneNode->mParentSceneNode)
+			{
+				++depth;
+			}
+			depths[i] = depth;
+			if (depth >= numberOfSceneNodesPerDepth.size())
+			{
+				numberOfSceneNodesPerDepth.resize(depth + 1, 0);
+			}
+			++numberOfSceneNodesPerDepth[depth];
+		}
+
+		// Calculate the depth offsets
+		const size_t numberOfDepthLevels = numberOfSceneNodesPerDepth.size();
+		mDepthOffsets.resize(numberOfDepthLevels + 1);
+		mDepthOffsets[0] = 0;
+		for (size_t depth = 0; depth < numberOfDepthLevels; ++depth)
+		{
+			mDepthOffsets[depth + 1] = mDepthOffsets[depth] + numberOfSceneNodesPerDepth[depth];
+		}
+
+		// Counting sort of the scene nodes by depth, the dirty flags are carried over
+		SceneNodes sortedSceneNodes(numberOfSceneNodes);
+		Flags sceneNodeDirtyFlags(numberOfSceneNodes);
+		Indices currentDepthOffsets(mDepthOffsets.begin(), mDepthOffsets.end() - 1);
+		for (uint32_t i = 0; i < numberOfSceneNodes; ++i)
+		{
+			SceneNode* sceneNode = mSceneNodes[i];
+			const uint32_t sortedIndex = currentDepthOffsets[depths[i]]++;
+			sortedSceneNodes[sortedIndex] = sceneNode;
+			sceneNodeDirtyFlags[sortedIndex] = mSceneNodeDirtyFlags[sceneNode->mSceneNodeIndex];
+		}
+		for (uint32_t i = 0; i < numberOfSceneNodes; ++i)
+		{
+			sortedSceneNodes[i]->mSceneNodeIndex = i;
+		}
+		mSortedParentIndices.resize(numberOfSceneNodes);
+		for (uint32_t i = 0; i < numberOfSceneNodes; ++i)
+		{
+			const SceneNode* parentSceneNode = sortedSceneNodes[i]->mParentSceneNode;
+			mSortedParentIndices[i] = (nullptr != parentSceneNode) ? parentSceneNode->mSceneNodeIndex : getUninitialized<uint32_t>();
+		}
+		std::swap(mSortedSceneNodes, sortedSceneNodes);
+		std::swap(mSceneNodeDirtyFlags, sceneNodeDirtyFlags);
+
+		// Done
+		mSceneNodeHierarchyDirty = false;
+	}
+
+	void SceneResource::deleteSceneNode(SceneNode& sceneNode)
+	{
+		// Scene nodes created via "RendererRuntime::SceneResource::createSceneNodes()" are living inside a scene node memory pool
+		const SceneNode* sceneNodeAddress = &sceneNode;
+		const size_t numberOfSceneNodePools = mSceneNodePools.size();
+		for (size_t i = 0; i < numberOfSceneNodePools; ++i)
+		{
+			SceneNodePool& sceneNodePool = mSceneNodePools[i];
+			if (std::less_equal<const SceneNode*>()(sceneNodePool.sceneNodes, sceneNodeAddress) && std::less<const SceneNode*>()(sceneNodeAddress, sceneNodePool.sceneNodes + sceneNodePool.numberOfSceneNodes))
+			{
+				sceneNode.~SceneNode();
+				assert(sceneNodePool.numberOfAliveSceneNodes > 0);
+				--sceneNodePool.numberOfAliveSceneNodes;
+				if (0 == sceneNodePool.numberOfAliveSceneNodes)
+				{
+					::operator delete(sceneNodePool.sceneNodes);
+					::detail::swapAndPopBack(mSceneNodePools, static_cast<uint32_t>(i));
+				}
+				return;
+			}
+		}
+
+		// Individually created scene node
+		delete &sceneNode;
+	}
+
+	void SceneResource::updateGlobalTransformsRange(uint32_t startIndex, uint32_t endIndex)
+	{
+		const SceneNodes::value_type* sortedSceneNodes = mSortedSceneNodes.data();
+		const uint32_t* sortedParentIndices = mSortedParentIndices.data();
+		uint8_t* sceneNodeDirtyFlags = mSceneNodeDirtyFlags.data();
+		for (uint32_t i = startIndex; i < endIndex; ++i)
+		{
+			// A dirty parent scene node makes the scene node dirty as well, parents are always processed before their children
+			const uint32_t parentIndex = sortedParentIndices[i];
+			if (isInitialized(parentIndex) && CLEAN != sceneNodeDirtyFlags[parentIndex] && CLEAN == sceneNodeDirtyFlags[i])
+			{
+				sceneNodeDirtyFlags[i] = TRANSFORM_DIRTY;
+			}
+			if (CLEAN != sceneNodeDirtyFlags[i])
+			{
+				sortedSceneNodes[i]->updateGlobalTransform();
+			}
+		}
+	}
+
+	void SceneResource::addSceneNode(SceneNode& sceneNode)
+	{
+		assert(isUninitialized(sceneNode.mUnsortedSceneNodeIndex));
+		sceneNode.mUnsortedSceneNodeIndex = static_cast<uint32_t>(mSceneNodes.size());
+		mSceneNodes.push_back(&sceneNode);
+	}
+
+	void SceneResource::removeSceneNode(SceneNode& sceneNode)
+	{
+		// The order is not stable so we can swap with the last element
+		const uint32_t index = sceneNode.mUnsortedSceneNodeIndex;
+		assert(index < mSceneNodes.size());
+		assert(mSceneNodes[index] == &sceneNode);
+		mSceneNodes.back()->mUnsortedSceneNodeIndex = index;
+		::detail::swapAndPopBack(mSceneNodes, index);
+		setUninitialized(sceneNode.mUnsortedSceneNodeIndex);
+	}
+
+	void SceneResource::registerSceneItem(ISceneItem& sceneItem)
+	{
+		// Scene items
+		assert(isUninitialized(sceneItem.mSceneItemIndex));
+		sceneItem.mSceneItemIndex = static_cast<uint32_t>(mSceneItems.size());
+		mSceneItems.push_back(&sceneItem);
+
+		// Scene item type registry
+		const SceneItemTypeId sceneItemTypeId = sceneItem.getSceneItemTypeId();
+		SceneItems& sceneItemsOfType = mSceneItemsByTypeId[sceneItemTypeId];
+		assert(isUninitialized(sceneItem.mSceneItemTypeIndex));
+		sceneItem.mSceneItemTypeIndex = static_cast<uint32_t>(sceneItemsOfType.size());
+		sceneItemsOfType.push_back(&sceneItem);
+
+		// Light scene item registry
+		if (LightSceneItem::TYPE_ID == sceneItemTypeId)
+		{
+			LightSceneItem& lightSceneItem = static_cast<LightSceneItem&>(sceneItem);
+			LightSceneItemRegistry& registry = mLightSceneItemRegistry;
+			assert(isUninitialized(lightSceneItem.mLightSceneItemRegistryIndex));
+			lightSceneItem.mLightSceneItemRegistryIndex = static_cast<uint32_t>(registry.lightSceneItems.size());
+			const glm::vec3 position = sceneItem.hasParentSceneNode() ? sceneItem.getParentSceneNodeSafe().getGlobalTransform().position : Math::VEC3_ZERO;
+			registry.lightSceneItems.push_back(&lightSceneItem);
+			registry.positionX.push_back(position.x);
+			registry.positionY.push_back(position.y);
+			registry.positionZ.push_back(position.z);
+			registry.radius.push_back(0.0f);
+			registry.visible.push_back(0);
+			lightSceneItem.updateLightSceneItemRegistry();
+		}
+	}
+
+	void SceneResource::unregisterSceneItem(ISceneItem& sceneItem)
+	{
+		{ // Scene items, the order is not stable so we can swap with the last element
+			const uint32_t index = sceneItem.mSceneItemIndex;
+			assert(index < mSceneItems.size());
+			assert(mSceneItems[index] == &sceneItem);
+			mSceneItems.back()->mSceneItemIndex = index;
+			::detail::swapAndPopBack(mSceneItems, index);
+			setUninitialized(sceneItem.mSceneItemIndex);
+		}
+
+		// Scene item type registry, the order is not stable so we can swap with the last element
+		const SceneItemTypeId sceneItemTypeId = sceneItem.getSceneItemTypeId();
+		{
+			SceneItemsByTypeId::iterator iterator = mSceneItemsByTypeId.find(sceneItemTypeId);
+			assert(iterator != mSceneItemsByTypeId.end());
+			SceneItems& sceneItems = iterator->second;
+			const uint32_t index = sceneItem.mSceneItemTypeIndex;
+			assert(index < sceneItems.size());
+			assert(sceneItems[index] == &sceneItem);
+			sceneItems.back()->mSceneItemTypeIndex = index;
+			::detail::swapAndPopBack(sceneItems, index);
+			setUninitialized(sceneItem.mSceneItemTypeIndex);
+		}
+
+		// Light scene item registry
+		if (LightSceneItem::TYPE_ID == sceneItemTypeId)
+		{
+			LightSceneItem& lightSceneItem = static_cast<LightSceneItem&>(sceneItem);
+			LightSceneItemRegistry& registry = mLightSceneItemRegistry;
+			const uint32_t index = lightSceneItem.mLightSceneItemRegistryIndex;
+			assert(index < registry.lightSceneItems.size());
+			assert(registry.lightSceneItems[index] == &lightSceneItem);
+			registry.lightSceneItems.back()->mLightSceneItemRegistryIndex = index;
+			::detail::swapAndPopBack(registry.lightSceneItems, index);
+			::detail::swapAndPopBack(registry.positionX, index);
+			::detail::swapAndPopBack(registry.positionY, index);
+			::detail::swapAndPopBack(registry.positionZ, index);
+			::detail::swapAndPopBack(registry.radius, index);
+			::detail::swapAndPopBack(registry.visible, index);
+			setUninitialized(lightSceneItem.mLightSceneItemRegistryIndex);
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -532,25 +532,13 @@ namespace
 			return retVal;
 		}
 
-		bool evaluateExpression(const RendererRuntime::ShaderProperties& shaderProperties, SubStringRef& outSubString, bool& outSyntaxError)
+		void tokenizeExpression(const SubStringRef& subString, ExpressionVec& outExpressions, bool& outSyntaxError)
 		{
-			const size_t expEnd = evaluateExpressionEnd(outSubString);
-			if (std::string::npos == expEnd)
-			{
-				outSyntaxError = true;
-				return false;
-			}
-
-			SubStringRef subString(&outSubString.getOriginalBuffer(), outSubString.getStart(), outSubString.getStart() + expEnd);
-
-			outSubString = SubStringRef(&outSubString.getOriginalBuffer(), outSubString.getStart() + expEnd + 1);
-
 			bool textStarted = false;
 			bool syntaxError = false;
 			bool nextExpressionNegates = false;
 
 			std::vector<Expression*> expressionParents;
-			ExpressionVec outExpressions;
 			outExpressions.clear();
 			outExpressions.resize(1);
 
@@ -625,12 +613,33 @@ namespace
 				++it;
 			}
 
-			bool retVal = false;
-
 			if (!expressionParents.empty())
 			{
 				syntaxError = true;
 			}
+
+			outSyntaxError = syntaxError;
+		}
+
+		bool evaluateExpression(const RendererRuntime::ShaderProperties& shaderProperties, SubStringRef& outSubString, bool& outSyntaxError)
+		{
+			const size_t expEnd = evaluateExpressionEnd(outSubString);
+			if (std::string::npos == expEnd)
+			{
+				outSyntaxError = true;
+				return false;
+			}
+
+			SubStringRef subString(&outSubString.getOriginalBuffer(), outSubString.getStart(), outSubString.getStart() + expEnd);
+
+			outSubString = SubStringRef(&outSubString.getOriginalBuffer(), outSubString.getStart() + expEnd + 1);
+
+			bool syntaxError = false;
+			ExpressionVec outExpressions;
+			tokenizeExpression(subString, outExpressions, syntaxError);
+
+			bool retVal = false;
+
 			if (!syntaxError)
 			{
 				retVal = evaluateExpressionRecursive(shaderProperties, outExpressions, syntaxError);
@@ -753,6 +762,350 @@ namespace
 		}
 
 
+		static const uint32_t MAXIMUM_PIECE_NESTING_DEPTH = 64;	///< Guards against pieces which are inserting themselves
+
+		bool isIdentifierCharacter(char character)
+		{
+			return ((character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') || (character >= '0' && character <= '9') || '_' == character);
+		}
+
+		/**
+		*  @brief
+		*    Shader template compiler
+		*
+		*  @remarks
+		*    Rejects everything for which a single pass evaluation of the shader template might differ from the multi-pass shader builder
+		*    result. The "@end" handling mirrors the multi-pass shader builder: "@end" additionally swallows the following character.
+		*/
+		class ShaderTemplateCompiler final
+		{
+
+
+		public:
+			ShaderTemplateCompiler(const std::string& sourceCode, std::string& text, RendererRuntime::ShaderTemplate::Nodes& nodes, RendererRuntime::ShaderTemplate::Expressions& expressions, RendererRuntime::ShaderTemplate::ForEaches& forEaches) :
+				mSourceCode(sourceCode),
+				mText(text),
+				mNodes(nodes),
+				mExpressions(expressions),
+				mForEaches(forEaches)
+			{
+				// Nothing here
+			}
+
+			bool compile()
+			{
+				size_t position = 0;
+				return compileBlock(position, false, false, nullptr);
+			}
+
+
+		private:
+			enum class Keyword
+			{
+				NONE,
+				PROPERTY,
+				PIECE,
+				INSERT_PIECE,
+				FOR_EACH,
+				END,
+				VALUE
+			};
+
+			ShaderTemplateCompiler(const ShaderTemplateCompiler&) = delete;
+			ShaderTemplateCompiler& operator=(const ShaderTemplateCompiler&) = delete;
+
+			Keyword getKeyword(size_t identifierStart, size_t identifierEnd) const
+			{
+				static const struct
+				{
+					const char* name;
+					Keyword		keyword;
+				} keywords[] =
+				{
+					{ "property",	 Keyword::PROPERTY },
+					{ "piece",		 Keyword::PIECE },
+					{ "insertpiece", Keyword::INSERT_PIECE },
+					{ "foreach",	 Keyword::FOR_EACH },
+					{ "end",		 Keyword::END },
+					{ "value",		 Keyword::VALUE }
+				};
+				for (size_t i = 0; i < sizeof(keywords) / sizeof(keywords[0]); ++i)
+				{
+					if (0 == mSourceCode.compare(identifierStart, identifierEnd - identifierStart, keywords[i].name))
+					{
+						return keywords[i].keyword;
+					}
+				}
+				return Keyword::NONE;
+			}
+
+			bool startsWithKeyword(size_t identifierStart) const
+			{
+				// The multi-pass shader builder searches block starts and ends by prefix
+				static const char* keywords[] = { "property", "piece", "insertpiece", "foreach", "end", "value" };
+				for (size_t i = 0; i < sizeof(keywords) / sizeof(char*); ++i)
+				{
+					if (0 == mSourceCode.compare(identifierStart, strlen(keywords[i]), keywords[i]))
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+
+			bool isPropertyMathOperation(size_t atPosition) const
+			{
+				// Same keyword detection as "RendererRuntime::ShaderBuilder::parseMath()"
+				size_t maxSize = mSourceCode.find_first_of(" \t(", atPosition + 1);
+				maxSize = (std::string::npos == maxSize) ? mSourceCode.size() : maxSize;
+				const SubStringRef keywordStr(&mSourceCode, atPosition + 1, maxSize);
+				for (size_t i = 0; i < 8; ++i)
+				{
+					if (keywordStr.matchEqual(c_operations[i].opName))
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+
+			uint32_t addNode(RendererRuntime::ShaderTemplate::NodeType nodeType, RendererRuntime::StringId name = RendererRuntime::StringId())
+			{
+				mNodes.push_back({nodeType, 0, 0, 0, name});
+				return static_cast<uint32_t>(mNodes.size() - 1);
+			}
+
+			void addText(size_t start, size_t end)
+			{
+				if (start < end)
+				{
+					const uint32_t nodeIndex = addNode(RendererRuntime::ShaderTemplate::NodeType::TEXT);
+					mNodes[nodeIndex].index = static_cast<uint32_t>(mText.size());
+					mNodes[nodeIndex].numberOfCharacters = static_cast<uint32_t>(end - start);
+					mText.append(mSourceCode, start, end - start);
+				}
+			}
+
+			bool addExpressions(ExpressionVec& expressionVec)
+			{
+				// Same expression type classification and syntax check as "::detail::evaluateExpressionRecursive()", just without evaluation
+				bool lastExpWasOperator = true;
+				for (Expression& expression : expressionVec)
+				{
+					RendererRuntime::ShaderTemplate::ExpressionType expressionType = RendererRuntime::ShaderTemplate::ExpressionType::VARIABLE;
+					if (expression.value == "&&")
+					{
+						expressionType = RendererRuntime::ShaderTemplate::ExpressionType::OPERATOR_AND;
+					}
+					else if (expression.value == "||")
+					{
+						expressionType = RendererRuntime::ShaderTemplate::ExpressionType::OPERATOR_OR;
+					}
+					else if (!expression.children.empty())
+					{
+						expressionType = RendererRuntime::ShaderTemplate::ExpressionType::OBJECT;
+					}
+					const bool isOperator = (RendererRuntime::ShaderTemplate::ExpressionType::OPERATOR_OR == expressionType || RendererRuntime::ShaderTemplate::ExpressionType::OPERATOR_AND == expressionType);
+					if (isOperator == lastExpWasOperator)
+					{
+						// Syntax error
+						return false;
+					}
+					lastExpWasOperator = isOperator;
+
+					const size_t expressionIndex = mExpressions.size();
+					mExpressions.push_back({expressionType, expression.negated, 0, RendererRuntime::StringId(expression.value.c_str())});
+					if (RendererRuntime::ShaderTemplate::ExpressionType::OBJECT == expressionType)
+					{
+						if (!addExpressions(expression.children))
+						{
+							return false;
+						}
+						mExpressions[expressionIndex].numberOfDescendants = static_cast<uint32_t>(mExpressions.size() - expressionIndex - 1);
+					}
+				}
+				return true;
+			}
+
+			bool compileBlock(size_t& position, bool isBlock, bool insidePiece, const std::string* counterVar)
+			{
+				StringVector argValues;
+				size_t textStart = position;
+				size_t atPosition = mSourceCode.find('@', position);
+				while (std::string::npos != atPosition)
+				{
+					// Get the identifier directly following "@"
+					const size_t identifierStart = atPosition + 1;
+					size_t identifierEnd = identifierStart;
+					while (identifierEnd < mSourceCode.size() && isIdentifierCharacter(mSourceCode[identifierEnd]))
+					{
+						++identifierEnd;
+					}
+					const Keyword keyword = getKeyword(identifierStart, identifierEnd);
+
+					// Property math is executed by the multi-pass shader builder before anything else
+					if (isPropertyMathOperation(atPosition))
+					{
+						return false;
+					}
+					else if (nullptr != counterVar && !counterVar->empty() && 0 == mSourceCode.compare(identifierStart, counterVar->size(), *counterVar))
+					{
+						// The multi-pass shader builder replaces the "@foreach" counter before any other directive is processed, reject ambiguities
+						if (startsWithKeyword(identifierStart))
+						{
+							return false;
+						}
+						addText(textStart, atPosition);
+						addNode(RendererRuntime::ShaderTemplate::NodeType::FOR_EACH_COUNTER);
+						position = identifierStart + counterVar->size();
+					}
+					else if (Keyword::END == keyword)
+					{
+						// The character swallowed by "@end" must not be the start of another directive
+						if (!isBlock || (identifierEnd < mSourceCode.size() && '@' == mSourceCode[identifierEnd]))
+						{
+							return false;
+						}
+						addText(textStart, atPosition);
+						position = std::min(identifierEnd + 1, mSourceCode.size());
+						return true;
+					}
+					else if (Keyword::NONE == keyword || identifierEnd >= mSourceCode.size() || '(' != mSourceCode[identifierEnd])
+					{
+						return false;
+					}
+					else
+					{
+						addText(textStart, atPosition);
+						SubStringRef subString(&mSourceCode, identifierEnd + 1);
+						bool syntaxError = false;
+						uint32_t nodeIndex = 0;
+						switch (keyword)
+						{
+							case Keyword::PROPERTY:
+							{
+								const size_t expEnd = evaluateExpressionEnd(subString);
+								if (std::string::npos == expEnd || mSourceCode.find('@', subString.getStart()) < subString.getStart() + expEnd)
+								{
+									return false;
+								}
+								ExpressionVec expressionVec;
+								tokenizeExpression(SubStringRef(&mSourceCode, subString.getStart(), subString.getStart() + expEnd), expressionVec, syntaxError);
+								if (syntaxError)
+								{
+									return false;
+								}
+								nodeIndex = addNode(RendererRuntime::ShaderTemplate::NodeType::PROPERTY);
+								mNodes[nodeIndex].index = static_cast<uint32_t>(mExpressions.size());
+								if (!addExpressions(expressionVec))
+								{
+									return false;
+								}
+								position = subString.getStart() + expEnd + 1;
+								if (!compileBlock(position, true, insidePiece, counterVar))
+								{
+									return false;
+								}
+								break;
+							}
+
+							case Keyword::PIECE:
+								evaluateParamArgs(subString, argValues, syntaxError);
+								if (syntaxError || argValues.size() != 1 || insidePiece || nullptr != counterVar)
+								{
+									return false;
+								}
+								nodeIndex = addNode(RendererRuntime::ShaderTemplate::NodeType::PIECE, RendererRuntime::StringId(argValues[0].c_str()));
+								position = subString.getStart();
+								if (!compileBlock(position, true, true, nullptr))
+								{
+									return false;
+								}
+								break;
+
+							case Keyword::INSERT_PIECE:
+							case Keyword::VALUE:
+								evaluateParamArgs(subString, argValues, syntaxError);
+								if (syntaxError || argValues.size() != 1)
+								{
+									return false;
+								}
+								nodeIndex = addNode((Keyword::VALUE == keyword) ? RendererRuntime::ShaderTemplate::NodeType::VALUE : RendererRuntime::ShaderTemplate::NodeType::INSERT_PIECE, RendererRuntime::StringId(argValues[0].c_str()));
+								position = subString.getStart();
+								break;
+
+							case Keyword::FOR_EACH:
+							{
+								evaluateParamArgs(subString, argValues, syntaxError);
+								if (syntaxError || nullptr != counterVar)
+								{
+									return false;
+								}
+
+								// Same argument interpretation as "RendererRuntime::ShaderBuilder::parseForEach()"
+								RendererRuntime::ShaderTemplate::ForEach forEach = {};
+								char* endPtr = nullptr;
+								forEach.count = strtol(argValues[0].c_str(), &endPtr, 10);
+								if (argValues[0].c_str() == endPtr)
+								{
+									forEach.countIsProperty = true;
+									forEach.countPropertyId = RendererRuntime::StringId(argValues[0].c_str());
+								}
+								if (argValues.size() > 2)
+								{
+									forEach.start = strtol(argValues[2].c_str(), &endPtr, 10);
+									if (argValues[2].c_str() == endPtr)
+									{
+										forEach.startIsProperty = true;
+										forEach.startPropertyId = RendererRuntime::StringId(argValues[2].c_str());
+									}
+								}
+								const std::string forEachCounterVar = (argValues.size() > 1) ? argValues[1] : std::string();
+
+								nodeIndex = addNode(RendererRuntime::ShaderTemplate::NodeType::FOR_EACH);
+								mNodes[nodeIndex].index = static_cast<uint32_t>(mForEaches.size());
+								mForEaches.push_back(forEach);
+								position = subString.getStart();
+								if (!compileBlock(position, true, insidePiece, &forEachCounterVar))
+								{
+									return false;
+								}
+								break;
+							}
+
+							case Keyword::NONE:
+							case Keyword::END:
+								// Already handled above
+								return false;
+						}
+						mNodes[nodeIndex].numberOfDescendants = static_cast<uint32_t>(mNodes.size() - nodeIndex - 1);
+					}
+
+					textStart = position;
+					atPosition = mSourceCode.find('@', position);
+				}
+
+				// A block without matching "@end" is a syntax error
+				if (isBlock)
+				{
+					return false;
+				}
+				addText(textStart, mSourceCode.size());
+				position = mSourceCode.size();
+				return true;
+			}
+
+
+		private:
+			const std::string&							  mSourceCode;
+			std::string&								  mText;
+			RendererRuntime::ShaderTemplate::Nodes&		  mNodes;
+			RendererRuntime::ShaderTemplate::Expressions& mExpressions;
+			RendererRuntime::ShaderTemplate::ForEaches&	  mForEaches;
+
+
+		};
+
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
 //[-------------------------------------------------------]
@@ -767,10 +1120,28 @@ namespace RendererRuntime
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	void ShaderBuilder::compileShaderTemplate(const std::string& sourceCode, ShaderTemplate& shaderTemplate)
+	{
+		shaderTemplate.clear();
+		shaderTemplate.mValid = ::detail::ShaderTemplateCompiler(sourceCode, shaderTemplate.mText, shaderTemplate.mNodes, shaderTemplate.mExpressions, shaderTemplate.mForEaches).compile();
+		if (!shaderTemplate.mValid)
+		{
+			// The multi-pass shader builder is used for this source code, don't waste memory
+			shaderTemplate.clear();
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	ShaderBuilder::ShaderBuilder()
+	ShaderBuilder::ShaderBuilder() :
+		mNumberOfShaderTemplateTokens(0),
+		mLastInsertPieceShaderTemplateToken(getUninitialized<uint32_t>()),
+		mLastValueShaderTemplateEnd(std::string::npos)
 	{
 		// Nothing here
 	}
@@ -789,7 +1160,8 @@ namespace RendererRuntime
 		const AssetManager& assetManager = shaderPieceResourceManager.getRendererRuntime().getAssetManager();
 		uint64_t combinedAssetFileHashes = Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&assetManager.getAssetByAssetId(shaderBlueprintResource.getAssetId()).fileHash), sizeof(uint64_t), Math::FNV1a_INITIAL_HASH_64);
 
-		{ // Process the shader piece resources to include
+		{ // Gather the shader piece resources to include
+			mShaderPieceResources.clear();
 			const ShaderBlueprintResource::IncludeShaderPieceResourceIds& includeShaderPieceResourceIds = shaderBlueprintResource.getIncludeShaderPieceResourceIds();
 			const size_t numberOfShaderPieces = includeShaderPieceResourceIds.size();
 			for (size_t i = 0; i < numberOfShaderPieces; ++i)
@@ -799,7 +1171,22 @@ namespace RendererRuntime
 				{
 					buildShader.assetIds.push_back(shaderPieceResource->getAssetId());
 					combinedAssetFileHashes = Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&assetManager.getAssetByAssetId(shaderPieceResource->getAssetId()).fileHash), sizeof(uint64_t), combinedAssetFileHashes);
+					mShaderPieceResources.push_back(shaderPieceResource);
+				}
+				else
+				{
+					// TODO(co) Error handling
+					assert(false);
+				}
+			}
+		}
 
+		// Evaluate the shader templates compiled at load time in a single pass, fall back to the multi-pass shader builder if this isn't possible
+		if (!createSourceCodeByShaderTemplates(shaderBlueprintResource))
+		{
+			{ // Process the shader piece resources to include
+				for (const ShaderPieceResource* shaderPieceResource : mShaderPieceResources)
+				{
 					// Initialize
 					mInString = shaderPieceResource->getShaderSourceCode();
 					mOutString.clear();
@@ -811,30 +1198,25 @@ namespace RendererRuntime
 					collectPieces(mOutString, mInString);
 					parseCounter(mInString, mOutString);
 				}
-				else
-				{
-					// TODO(co) Error handling
-					assert(false);
-				}
 			}
-		}
-
-		{ // Process the shader blueprint resource
-			// Initialize
-			mInString = shaderBlueprintResource.getShaderSourceCode();
-			mOutString.clear();
 
-			// Process
-			bool syntaxError = false;
-			syntaxError |= parseMath(mInString, mOutString);
-			syntaxError |= parseForEach(mOutString, mInString);
-			syntaxError |= parseProperties(mInString, mOutString);
-			while (!syntaxError && (mOutString.find("@piece") != std::string::npos || mOutString.find("@insertpiece") != std::string::npos))
-			{
-				syntaxError |= collectPieces(mOutString, mInString);
-				syntaxError |= insertPieces(mInString, mOutString);
+			{ // Process the shader blueprint resource
+				// Initialize
+				mInString = shaderBlueprintResource.getShaderSourceCode();
+				mOutString.clear();
+
+				// Process
+				bool syntaxError = false;
+				syntaxError |= parseMath(mInString, mOutString);
+				syntaxError |= parseForEach(mOutString, mInString);
+				syntaxError |= parseProperties(mInString, mOutString);
+				while (!syntaxError && (mOutString.find("@piece") != std::string::npos || mOutString.find("@insertpiece") != std::string::npos))
+				{
+					syntaxError |= collectPieces(mOutString, mInString);
+					syntaxError |= insertPieces(mInString, mOutString);
+				}
+				syntaxError |= parseCounter(mOutString, mInString);
 			}
-			syntaxError |= parseCounter(mOutString, mInString);
 		}
 
 		// Apply a C-preprocessor
@@ -1312,6 +1694,228 @@ namespace RendererRuntime
 		return parseForEach(inBuffer, outBuffer);
 	}
 
+	bool ShaderBuilder::createSourceCodeByShaderTemplates(const ShaderBlueprintResource& shaderBlueprintResource)
+	{
+		// Check whether or not all shader templates can be used
+		const ShaderTemplate& shaderTemplate = shaderBlueprintResource.getShaderTemplate();
+		if (!isShaderTemplateUsable(shaderTemplate))
+		{
+			return false;
+		}
+		for (const ShaderPieceResource* shaderPieceResource : mShaderPieceResources)
+		{
+			if (!isShaderTemplateUsable(shaderPieceResource->getShaderTemplate()))
+			{
+				return false;
+			}
+		}
+
+		// Collect the pieces, shader piece resources first and then the shader blueprint resource
+		// -> Since shader templates don't modify the shader properties, the remaining shader piece resource source code has no influence on the result
+		mShaderTemplatePieces.clear();
+		for (const ShaderPieceResource* shaderPieceResource : mShaderPieceResources)
+		{
+			const ShaderTemplate& shaderPieceTemplate = shaderPieceResource->getShaderTemplate();
+			if (!collectShaderTemplatePieces(shaderPieceTemplate, 0, static_cast<uint32_t>(shaderPieceTemplate.mNodes.size())))
+			{
+				return false;
+			}
+		}
+		if (!collectShaderTemplatePieces(shaderTemplate, 0, static_cast<uint32_t>(shaderTemplate.mNodes.size())))
+		{
+			return false;
+		}
+
+		// Evaluate the shader blueprint resource in a single pass
+		mInString.clear();
+		mInString.reserve(shaderBlueprintResource.getShaderSourceCode().size());
+		mNumberOfShaderTemplateTokens = 0;
+		mLastInsertPieceShaderTemplateToken = getUninitialized<uint32_t>();
+		mLastValueShaderTemplateEnd = std::string::npos;
+		if (!evaluateShaderTemplate(shaderTemplate, 0, static_cast<uint32_t>(shaderTemplate.mNodes.size()), 0, 0, mInString))
+		{
+			return false;
+		}
+
+		// The multi-pass shader builder treats a directive as syntax error if its closing parenthesis is the last character of the string processed
+		// by the pass, only "@insertpiece" and "@value" can end up there
+		return (mNumberOfShaderTemplateTokens != mLastInsertPieceShaderTemplateToken && mInString.size() != mLastValueShaderTemplateEnd);
+	}
+
+	bool ShaderBuilder::isShaderTemplateUsable(const ShaderTemplate& shaderTemplate) const
+	{
+		if (!shaderTemplate.isValid())
+		{
+			return false;
+		}
+
+		// The multi-pass shader builder treats a "@foreach" start which is neither a number nor a property as syntax error, no matter where the "@foreach" is located
+		for (const ShaderTemplate::ForEach& forEach : shaderTemplate.mForEaches)
+		{
+			if (forEach.startIsProperty && !mShaderProperties.hasPropertyValue(forEach.startPropertyId))
+			{
+				return false;
+			}
+		}
+
+		// Done
+		return true;
+	}
+
+	bool ShaderBuilder::collectShaderTemplatePieces(const ShaderTemplate& shaderTemplate, uint32_t firstNodeIndex, uint32_t endNodeIndex)
+	{
+		const ShaderTemplate::Nodes& nodes = shaderTemplate.mNodes;
+		for (uint32_t nodeIndex = firstNodeIndex; nodeIndex < endNodeIndex; nodeIndex += 1 + nodes[nodeIndex].numberOfDescendants)
+		{
+			const ShaderTemplate::Node& node = nodes[nodeIndex];
+			if (ShaderTemplate::NodeType::PROPERTY == node.type)
+			{
+				if (evaluateShaderTemplateExpression(shaderTemplate, node.index) && !collectShaderTemplatePieces(shaderTemplate, nodeIndex + 1, nodeIndex + 1 + node.numberOfDescendants))
+				{
+					return false;
+				}
+			}
+			else if (ShaderTemplate::NodeType::PIECE == node.type)
+			{
+				// Piece already defined: Let the multi-pass shader builder deal with this syntax error
+				if (!mShaderTemplatePieces.emplace(node.name, ShaderTemplatePiece{&shaderTemplate, nodeIndex}).second)
+				{
+					return false;
+				}
+			}
+		}
+
+		// Done
+		return true;
+	}
+
+	bool ShaderBuilder::evaluateShaderTemplate(const ShaderTemplate& shaderTemplate, uint32_t firstNodeIndex, uint32_t endNodeIndex, size_t forEachCounter, uint32_t pieceNestingDepth, std::string& outBuffer)
+	{
+		const ShaderTemplate::Nodes& nodes = shaderTemplate.mNodes;
+		for (uint32_t nodeIndex = firstNodeIndex; nodeIndex < endNodeIndex; nodeIndex += 1 + nodes[nodeIndex].numberOfDescendants)
+		{
+			const ShaderTemplate::Node& node = nodes[nodeIndex];
+			switch (node.type)
+			{
+				case ShaderTemplate::NodeType::TEXT:
+					outBuffer.append(shaderTemplate.mText, node.index, node.numberOfCharacters);
+					++mNumberOfShaderTemplateTokens;
+					break;
+
+				case ShaderTemplate::NodeType::PROPERTY:
+					if (evaluateShaderTemplateExpression(shaderTemplate, node.index) && !evaluateShaderTemplate(shaderTemplate, nodeIndex + 1, nodeIndex + 1 + node.numberOfDescendants, forEachCounter, pieceNestingDepth, outBuffer))
+					{
+						return false;
+					}
+					break;
+
+				case ShaderTemplate::NodeType::PIECE:
+					// Nothing here, pieces have already been collected
+					break;
+
+				case ShaderTemplate::NodeType::INSERT_PIECE:
+				{
+					ShaderTemplatePieces::const_iterator iterator = mShaderTemplatePieces.find(node.name);
+					if (mShaderTemplatePieces.cend() != iterator)
+					{
+						// Recursive piece insertion: Let the multi-pass shader builder deal with it
+						if (pieceNestingDepth >= ::detail::MAXIMUM_PIECE_NESTING_DEPTH)
+						{
+							return false;
+						}
+						const ShaderTemplatePiece& shaderTemplatePiece = iterator->second;
+						const uint32_t pieceNodeIndex = shaderTemplatePiece.nodeIndex;
+						if (!evaluateShaderTemplate(*shaderTemplatePiece.shaderTemplate, pieceNodeIndex + 1, pieceNodeIndex + 1 + shaderTemplatePiece.shaderTemplate->mNodes[pieceNodeIndex].numberOfDescendants, 0, pieceNestingDepth + 1, outBuffer))
+						{
+							return false;
+						}
+					}
+
+					// The inserted piece isn't taken into account, it's not yet there when the "@insertpiece" gets processed
+					mLastInsertPieceShaderTemplateToken = ++mNumberOfShaderTemplateTokens;
+					break;
+				}
+
+				case ShaderTemplate::NodeType::FOR_EACH:
+				{
+					const ShaderTemplate::ForEach& forEach = shaderTemplate.mForEaches[node.index];
+					const int count = forEach.countIsProperty ? mShaderProperties.getPropertyValueUnsafe(forEach.countPropertyId) : forEach.count;
+					const int start = forEach.startIsProperty ? mShaderProperties.getPropertyValueUnsafe(forEach.startPropertyId) : forEach.start;
+					for (int i = start; i < count; ++i)
+					{
+						if (!evaluateShaderTemplate(shaderTemplate, nodeIndex + 1, nodeIndex + 1 + node.numberOfDescendants, static_cast<size_t>(i), pieceNestingDepth, outBuffer))
+						{
+							return false;
+						}
+					}
+					break;
+				}
+
+				case ShaderTemplate::NodeType::FOR_EACH_COUNTER:
+				{
+					char temp[24];	// A negative "@foreach" start results in a huge unsigned counter
+					sprintf(temp, "%lu", static_cast<unsigned long>(forEachCounter));
+					outBuffer += temp;
+					++mNumberOfShaderTemplateTokens;
+					break;
+				}
+
+				case ShaderTemplate::NodeType::VALUE:
+				{
+					char temp[16];
+					sprintf(temp, "%i", mShaderProperties.getPropertyValueUnsafe(node.name));
+					outBuffer += temp;
+					++mNumberOfShaderTemplateTokens;
+					mLastValueShaderTemplateEnd = outBuffer.size();
+					break;
+				}
+			}
+		}
+
+		// Done
+		return true;
+	}
+
+	bool ShaderBuilder::evaluateShaderTemplateExpression(const ShaderTemplate& shaderTemplate, uint32_t expressionIndex) const
+	{
+		// Same evaluation as "::detail::evaluateExpressionRecursive()"
+		const ShaderTemplate::Expressions& expressions = shaderTemplate.mExpressions;
+		const ShaderTemplate::Expression& expression = expressions[expressionIndex];
+		if (ShaderTemplate::ExpressionType::VARIABLE == expression.type)
+		{
+			return (0 != mShaderProperties.getPropertyValueUnsafe(expression.propertyId));
+		}
+
+		bool result = true;
+		bool andMode = true;
+		const uint32_t endExpressionIndex = expressionIndex + 1 + expression.numberOfDescendants;
+		for (uint32_t childExpressionIndex = expressionIndex + 1; childExpressionIndex < endExpressionIndex; childExpressionIndex += 1 + expressions[childExpressionIndex].numberOfDescendants)
+		{
+			const ShaderTemplate::Expression& childExpression = expressions[childExpressionIndex];
+			if (ShaderTemplate::ExpressionType::OPERATOR_OR == childExpression.type)
+			{
+				andMode = false;
+			}
+			else if (ShaderTemplate::ExpressionType::OPERATOR_AND == childExpression.type)
+			{
+				andMode = true;
+			}
+			else
+			{
+				const bool childResult = (evaluateShaderTemplateExpression(shaderTemplate, childExpressionIndex) != childExpression.negated);
+				if (andMode)
+				{
+					result &= childResult;
+				}
+				else
+				{
+					result |= childResult;
+				}
+			}
+		}
+		return result;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -25,6 +25,7 @@
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderCacheManager.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderCache.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderBuilder.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/IShaderBytecodeCompiler.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResource.h"
 #include "RendererRuntime/Resource/VertexAttributes/VertexAttributesResourceManager.h"
@@ -35,6 +36,86 @@
 #include "RendererRuntime/Core/Math/Math.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4548)	// warning C4548: expression before comma has no effect; expected expression with side-effect
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <algorithm>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Shader cache file layout
+		*
+		*  @remarks
+		*    - "CacheHeader"
+		*    - "ShaderCacheEntry" table sorted by shader cache ID
+		*    - Asset ID table referenced by the master shader cache entries
+		*    - One contiguous shader bytecode blob referenced by the master shader cache entries
+		*    - "ShaderSourceCodeEntry" table
+		*    All tables are read with a single read each, the shader caches directly point into the shader bytecode blob
+		*/
+		struct CacheHeader final
+		{
+			uint32_t numberOfShaderCaches;
+			uint32_t numberOfAssetIds;
+			uint32_t numberOfBytecodeBytes;
+			uint32_t numberOfShaderSourceCodeIds;
+		};
+
+		struct ShaderCacheEntry final
+		{
+			uint64_t						combinedAssetFileHashes;	///< Combination of the file hash of all assets which took part in the shader cache creation, unused for slave shader caches
+			RendererRuntime::ShaderCacheId	shaderCacheId;
+			RendererRuntime::ShaderCacheId	masterShaderCacheId;		///< Uninitialized for master shader caches
+			uint32_t						firstAssetId;				///< Index of the first asset ID inside the asset ID table, unused for slave shader caches
+			uint32_t						numberOfAssetIds;			///< Unused for slave shader caches
+			uint32_t						bytecodeOffset;				///< Byte offset inside the shader bytecode blob, unused for slave shader caches
+			uint32_t						numberOfBytecodeBytes;		///< Unused for slave shader caches
+		};
+
+		struct ShaderSourceCodeEntry final
+		{
+			RendererRuntime::ShaderSourceCodeId shaderSourceCodeId;
+			RendererRuntime::ShaderCacheId		shaderCacheId;
+		};
+
+		typedef std::vector<ShaderCacheEntry> ShaderCacheEntries;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		inline uint32_t findShaderCacheEntryIndex(const ShaderCacheEntries& shaderCacheEntries, RendererRuntime::ShaderCacheId shaderCacheId)
+		{
+			ShaderCacheEntries::const_iterator iterator = std::lower_bound(shaderCacheEntries.cbegin(), shaderCacheEntries.cend(), shaderCacheId, [](const ShaderCacheEntry& shaderCacheEntry, RendererRuntime::ShaderCacheId value) { return (shaderCacheEntry.shaderCacheId < value); });
+			return (iterator != shaderCacheEntries.cend() && iterator->shaderCacheId == shaderCacheId) ? static_cast<uint32_t>(iterator - shaderCacheEntries.cbegin()) : RendererRuntime::getUninitialized<uint32_t>();
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -69,7 +150,8 @@ namespace RendererRuntime
 				}
 
 				// Create renderer shader instance using the shader bytecode, if necessary
-				if (nullptr == shaderCache->mShaderPtr.getPointer())
+				// -> During offline shader bytecode compilation there are no renderer shader instances
+				if (nullptr == shaderCache->mShaderPtr.getPointer() && nullptr == mShaderBlueprintResourceManager.getShaderBytecodeCompiler())
 				{
 					assert((0 != shaderCache->mShaderBytecode.getNumberOfBytes()) && "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache");
 					switch (shaderType)
@@ -144,39 +226,51 @@ namespace RendererRuntime
 							shaderCache = new ShaderCache(shaderCacheId);
 							shaderCache->mAssetIds = buildShader.assetIds;
 							shaderCache->mCombinedAssetFileHashes = buildShader.combinedAssetFileHashes;
-							switch (shaderType)
+							IShaderBytecodeCompiler* shaderBytecodeCompiler = mShaderBlueprintResourceManager.getShaderBytecodeCompiler();
+							if (nullptr != shaderBytecodeCompiler)
+							{
+								// Offline shader bytecode compilation: The shader bytecode of the target renderer backend is all we need, there's no renderer shader instance
+								shaderBytecodeCompiler->compileShaderSourceCode(shaderType, sourceCode.c_str(), shaderCache->mShaderBytecode);
+							}
+							else
 							{
-								case ShaderType::Vertex:
+								switch (shaderType)
 								{
-									const Renderer::VertexAttributes& vertexAttributes = mShaderBlueprintResourceManager.getRendererRuntime().getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
-									shader = shaderLanguage.createVertexShaderFromSourceCode(vertexAttributes, sourceCode.c_str(), &shaderCache->mShaderBytecode);
-									break;
+									case ShaderType::Vertex:
+									{
+										const Renderer::VertexAttributes& vertexAttributes = mShaderBlueprintResourceManager.getRendererRuntime().getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
+										shader = shaderLanguage.createVertexShaderFromSourceCode(vertexAttributes, sourceCode.c_str(), &shaderCache->mShaderBytecode);
+										break;
+									}
+
+									case ShaderType::TessellationControl:
+										shader = shaderLanguage.createTessellationControlShaderFromSourceCode(sourceCode.c_str(), &shaderCache->mShaderBytecode);
+										break;
+
+									case ShaderType::TessellationEvaluation:
+										shader = shaderLanguage.createTessellationEvaluationShaderFromSourceCode(sourceCode.c_str(), &shaderCache->mShaderBytecode);
+										break;
+
+									case ShaderType::Geometry:
+										// TODO(co) "RendererRuntime::ShaderCacheManager::getShaderCache()" needs to provide additional geometry shader information
+										// shader = shaderLanguage.createGeometryShaderFromSourceCode(sourceCode.c_str(), &shaderCache->mShaderBytecode);
+										break;
+
+									case ShaderType::Fragment:
+										shader = shaderLanguage.createFragmentShaderFromSourceCode(sourceCode.c_str(), &shaderCache->mShaderBytecode);
+										break;
 								}
-
-								case ShaderType::TessellationControl:
-									shader = shaderLanguage.createTessellationControlShaderFromSourceCode(sourceCode.c_str(), &shaderCache->mShaderBytecode);
-									break;
-
-								case ShaderType::TessellationEvaluation:
-									shader = shaderLanguage.createTessellationEvaluationShaderFromSourceCode(sourceCode.c_str(), &shaderCache->mShaderBytecode);
-									break;
-
-								case ShaderType::Geometry:
-									// TODO(co) "RendererRuntime::ShaderCacheManager::getShaderCache()" needs to provide additional geometry shader information
-									// shader = shaderLanguage.createGeometryShaderFromSourceCode(sourceCode.c_str(), &shaderCache->mShaderBytecode);
-									break;
-
-								case ShaderType::Fragment:
-									shader = shaderLanguage.createFragmentShaderFromSourceCode(sourceCode.c_str(), &shaderCache->mShaderBytecode);
-									break;
 							}
 
 							// Create the new shader cache instance
-							if (nullptr != shader)
+							if (nullptr != shader || (nullptr != shaderBytecodeCompiler && 0 != shaderCache->mShaderBytecode.getNumberOfBytes()))
 							{
-								RENDERER_SET_RESOURCE_DEBUG_NAME(shader, shaderBlueprintAsset.virtualFilename)
-								assert((!shaderLanguage.getRenderer().getCapabilities().shaderBytecode || 0 != shaderCache->mShaderBytecode.getNumberOfBytes()) && "Invalid shader bytecode received from renderer implementation");
-								shaderCache->mShaderPtr = shader;
+								if (nullptr != shader)
+								{
+									RENDERER_SET_RESOURCE_DEBUG_NAME(shader, shaderBlueprintAsset.virtualFilename)
+									assert((!shaderLanguage.getRenderer().getCapabilities().shaderBytecode || 0 != shaderCache->mShaderBytecode.getNumberOfBytes()) && "Invalid shader bytecode received from renderer implementation");
+									shaderCache->mShaderPtr = shader;
+								}
 								mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
 								mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
 								mCacheNeedsSaving = true;
@@ -185,6 +279,7 @@ namespace RendererRuntime
 							{
 								// TODO(co) Error handling
 								delete shaderCache;
+								shaderCache = nullptr;
 								assert(false);
 							}
 						}
@@ -211,190 +306,235 @@ namespace RendererRuntime
 		}
 		mShaderCacheByShaderCacheId.clear();
 		mShaderCacheByShaderSourceCodeId.clear();
+		delete [] mShaderBytecodeBlob;
+		mShaderBytecodeBlob = nullptr;
 		mCacheNeedsSaving = true;
 	}
 
-	void ShaderCacheManager::loadCache(IFile& file)
+	bool ShaderCacheManager::loadCache(MemoryFile& memoryFile)
 	{
-		// TODO(co) This can certainly be implemented in a more efficient way. For instance, we could store all shader bytecodes inside a LZ4 compressed buffer and let shader caches directly point into this buffer.
-		typedef std::unordered_set<ShaderCacheId> OutOfDateShaderCacheIds;
-		OutOfDateShaderCacheIds outOfDateShaderCacheIds;
+		// The shader caches are going to point into the shader bytecode blob, so it must not be replaced while referenced
+		// -> The caller has to clear the cache before loading it again
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		if (nullptr != mShaderBytecodeBlob)
+		{
+			assert(false && "The shader cache has already been loaded");
+			return false;
+		}
 		const AssetManager& assetManager = mShaderBlueprintResourceManager.getRendererRuntime().getAssetManager();
 
-		{ // Load shader caches
-			uint32_t numberOfShaderCaches = getUninitialized<uint32_t>();
-			file.read(&numberOfShaderCaches, sizeof(uint32_t));
-			mShaderCacheByShaderCacheId.reserve(numberOfShaderCaches);
-			std::vector<uint8_t> bytecode;
-			AssetIds assetIds;
-			for (uint32_t i = 0; i < numberOfShaderCaches; ++i)
+		// Read the header and check the counts against the remaining number of bytes, they can't be trusted
+		::detail::CacheHeader cacheHeader;
+		if (memoryFile.getNumberOfRemainingBytes() < sizeof(::detail::CacheHeader))
+		{
+			return false;
+		}
+		memoryFile.read(&cacheHeader, sizeof(::detail::CacheHeader));
+		{
+			const uint64_t numberOfBytes = static_cast<uint64_t>(sizeof(::detail::ShaderCacheEntry)) * cacheHeader.numberOfShaderCaches +
+										   static_cast<uint64_t>(sizeof(AssetId)) * cacheHeader.numberOfAssetIds +
+										   cacheHeader.numberOfBytecodeBytes +
+										   static_cast<uint64_t>(sizeof(::detail::ShaderSourceCodeEntry)) * cacheHeader.numberOfShaderSourceCodeIds;
+			if (numberOfBytes > memoryFile.getNumberOfRemainingBytes())
 			{
-				ShaderCache* shaderCache = nullptr;
-
-				// Load shader cache
-				ShaderCacheId shaderCacheId = getUninitialized<ShaderCacheId>();
-				file.read(&shaderCacheId, sizeof(ShaderCacheId));
-				uint32_t numberOfBytes = getUninitialized<uint32_t>();
-				file.read(&numberOfBytes, sizeof(uint32_t));
-				if (isInitialized(numberOfBytes))
-				{
-					// Master shader cache
-
-					// Load list of IDs of the assets (shader blueprint, shader piece) which took part in the shader cache creation
-					uint32_t numberOfAssetIds = getUninitialized<uint32_t>();
-					file.read(&numberOfAssetIds, sizeof(uint32_t));
-					assert(0 != numberOfAssetIds);
-					assetIds.resize(numberOfAssetIds);
-					file.read(assetIds.data(), sizeof(uint32_t) * numberOfAssetIds);
-					uint64_t combinedAssetFileHashes = getUninitialized<uint64_t>();
-					file.read(&combinedAssetFileHashes, sizeof(uint64_t));
-
-					// Check whether or not the shader cache is still valid
-					uint64_t currentCombinedAssetFileHashes = Math::FNV1a_INITIAL_HASH_64;
-					for (AssetId assetId : assetIds)
-					{
-						const Asset* asset = assetManager.tryGetAssetByAssetId(assetId);
-						if (nullptr != asset)
-						{
-							currentCombinedAssetFileHashes = Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&asset->fileHash), sizeof(uint64_t), currentCombinedAssetFileHashes);
-						}
-					}
-					if (currentCombinedAssetFileHashes != combinedAssetFileHashes)
-					{
-						// Shader cache is out-of-date
-						file.skip(numberOfBytes);
-						outOfDateShaderCacheIds.insert(shaderCacheId);
-					}
-					else
-					{
-						// Shader cache is still valid
+				return false;
+			}
+		}
 
-						// Create shader cache instance
-						shaderCache = new ShaderCache(shaderCacheId);
-						shaderCache->mAssetIds = assetIds;
-						shaderCache->mCombinedAssetFileHashes = combinedAssetFileHashes;
+		// Read the shader cache entry and asset ID tables, each with a single read
+		::detail::ShaderCacheEntries shaderCacheEntries(cacheHeader.numberOfShaderCaches);
+		memoryFile.read(shaderCacheEntries.data(), sizeof(::detail::ShaderCacheEntry) * cacheHeader.numberOfShaderCaches);
+		AssetIds assetIds(cacheHeader.numberOfAssetIds);
+		memoryFile.read(assetIds.data(), sizeof(AssetId) * cacheHeader.numberOfAssetIds);
 
-						// Load shader bytecode
-						bytecode.resize(numberOfBytes);
-						file.read(bytecode.data(), numberOfBytes);
-						shaderCache->mShaderBytecode.setBytecodeCopy(numberOfBytes, bytecode.data());
-					}
+		// Validate the shader cache entries before anything is created
+		for (uint32_t i = 0; i < cacheHeader.numberOfShaderCaches; ++i)
+		{
+			const ::detail::ShaderCacheEntry& shaderCacheEntry = shaderCacheEntries[i];
+			if (i > 0 && shaderCacheEntries[i - 1].shaderCacheId >= shaderCacheEntry.shaderCacheId)
+			{
+				// The shader cache is corrupt since the shader cache entries aren't sorted by shader cache ID
+				return false;
+			}
+			if (isUninitialized(shaderCacheEntry.masterShaderCacheId))
+			{
+				if (0 == shaderCacheEntry.numberOfAssetIds ||
+					static_cast<uint64_t>(shaderCacheEntry.firstAssetId) + shaderCacheEntry.numberOfAssetIds > cacheHeader.numberOfAssetIds ||
+					static_cast<uint64_t>(shaderCacheEntry.bytecodeOffset) + shaderCacheEntry.numberOfBytecodeBytes > cacheHeader.numberOfBytecodeBytes)
+				{
+					// The shader cache is corrupt since an asset ID or a shader bytecode is out of range
+					return false;
 				}
-				else
+			}
+			else
+			{
+				const uint32_t masterShaderCacheEntryIndex = ::detail::findShaderCacheEntryIndex(shaderCacheEntries, shaderCacheEntry.masterShaderCacheId);
+				if (isUninitialized(masterShaderCacheEntryIndex) || isInitialized(shaderCacheEntries[masterShaderCacheEntryIndex].masterShaderCacheId))
 				{
-					ShaderCacheId masterShaderCacheId = getUninitialized<ShaderCacheId>();
-					file.read(&masterShaderCacheId, sizeof(ShaderCacheId));
-					if (outOfDateShaderCacheIds.find(masterShaderCacheId) == outOfDateShaderCacheIds.cend())
-					{
-						// Shader cache is still valid
-						ShaderCacheByShaderCacheId::const_iterator masterShaderCacheIdIterator = mShaderCacheByShaderCacheId.find(masterShaderCacheId);
-						if (masterShaderCacheIdIterator != mShaderCacheByShaderCacheId.cend())
-						{
-							// Create shader cache instance
-							shaderCache = new ShaderCache(shaderCacheId);
-							shaderCache->mMasterShaderCache = masterShaderCacheIdIterator->second;
-						}
-						else
-						{
-							// Error!
-							assert(false && "The shader cache is corrupt since a master shader cache is referenced which doesn't exist");
-						}
-					}
-					else
+					// The shader cache is corrupt since a master shader cache is referenced which doesn't exist or which is a slave shader cache itself
+					return false;
+				}
+			}
+		}
+
+		// Read the shader bytecode blob and the shader source code entry table, each with a single read
+		mShaderBytecodeBlob = new uint8_t[cacheHeader.numberOfBytecodeBytes];
+		memoryFile.read(mShaderBytecodeBlob, cacheHeader.numberOfBytecodeBytes);
+		std::vector< ::detail::ShaderSourceCodeEntry> shaderSourceCodeEntries(cacheHeader.numberOfShaderSourceCodeIds);
+		memoryFile.read(shaderSourceCodeEntries.data(), sizeof(::detail::ShaderSourceCodeEntry) * cacheHeader.numberOfShaderSourceCodeIds);
+
+		// Create the shader cache instances, masters first so the slaves are able to reference them
+		// -> A shader cache entry without instance is out-of-date
+		std::vector<ShaderCache*> shaderCaches(cacheHeader.numberOfShaderCaches, nullptr);
+		for (uint32_t i = 0; i < cacheHeader.numberOfShaderCaches; ++i)
+		{
+			const ::detail::ShaderCacheEntry& shaderCacheEntry = shaderCacheEntries[i];
+			if (isUninitialized(shaderCacheEntry.masterShaderCacheId))
+			{
+				// Check whether or not the shader cache is still valid
+				const AssetIds::const_iterator assetIdsBegin = assetIds.cbegin() + shaderCacheEntry.firstAssetId;
+				const AssetIds::const_iterator assetIdsEnd = assetIdsBegin + shaderCacheEntry.numberOfAssetIds;
+				uint64_t currentCombinedAssetFileHashes = Math::FNV1a_INITIAL_HASH_64;
+				for (AssetIds::const_iterator iterator = assetIdsBegin; iterator != assetIdsEnd; ++iterator)
+				{
+					const Asset* asset = assetManager.tryGetAssetByAssetId(*iterator);
+					if (nullptr != asset)
 					{
-						// Shader cache is out-of-date
-						outOfDateShaderCacheIds.insert(shaderCacheId);
+						currentCombinedAssetFileHashes = Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&asset->fileHash), sizeof(uint64_t), currentCombinedAssetFileHashes);
 					}
 				}
-
-				// Register shader cache
-				if (nullptr != shaderCache)
+				if (currentCombinedAssetFileHashes == shaderCacheEntry.combinedAssetFileHashes)
 				{
-					mShaderCacheByShaderCacheId.emplace(shaderCache->mShaderCacheId, shaderCache);
+					// Shader cache is still valid, the shader bytecode is directly referenced inside the shader bytecode blob
+					ShaderCache* shaderCache = new ShaderCache(shaderCacheEntry.shaderCacheId);
+					shaderCache->mAssetIds.assign(assetIdsBegin, assetIdsEnd);
+					shaderCache->mCombinedAssetFileHashes = shaderCacheEntry.combinedAssetFileHashes;
+					shaderCache->mShaderBytecode.setBytecodeReference(shaderCacheEntry.numberOfBytecodeBytes, mShaderBytecodeBlob + shaderCacheEntry.bytecodeOffset);
+					shaderCaches[i] = shaderCache;
 				}
 			}
 		}
-
-		{ // Load shader source code ID to shader cache ID mapping
-			uint32_t numberOfElements = getUninitialized<uint32_t>();
-			file.read(&numberOfElements, sizeof(uint32_t));
-			mShaderCacheByShaderSourceCodeId.reserve(numberOfElements);
-			for (uint32_t i = 0; i < numberOfElements; ++i)
+		for (uint32_t i = 0; i < cacheHeader.numberOfShaderCaches; ++i)
+		{
+			const ::detail::ShaderCacheEntry& shaderCacheEntry = shaderCacheEntries[i];
+			if (isInitialized(shaderCacheEntry.masterShaderCacheId))
 			{
-				ShaderSourceCodeId shaderSourceCodeId = getUninitialized<ShaderSourceCodeId>();
-				file.read(&shaderSourceCodeId, sizeof(ShaderSourceCodeId));
-				ShaderCacheId shaderCacheId = getUninitialized<ShaderCacheId>();
-				file.read(&shaderCacheId, sizeof(ShaderCacheId));
-				if (outOfDateShaderCacheIds.find(shaderCacheId) == outOfDateShaderCacheIds.cend())
+				const uint32_t masterShaderCacheEntryIndex = ::detail::findShaderCacheEntryIndex(shaderCacheEntries, shaderCacheEntry.masterShaderCacheId);
+				if (nullptr != shaderCaches[masterShaderCacheEntryIndex])
 				{
 					// Shader cache is still valid
-					mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+					shaderCaches[i] = new ShaderCache(shaderCacheEntry.shaderCacheId, shaderCaches[masterShaderCacheEntryIndex]);
 				}
 			}
 		}
 
+		// Register shader caches
+		mShaderCacheByShaderCacheId.reserve(mShaderCacheByShaderCacheId.size() + cacheHeader.numberOfShaderCaches);
+		for (ShaderCache* shaderCache : shaderCaches)
+		{
+			if (nullptr != shaderCache)
+			{
+				mShaderCacheByShaderCacheId.emplace(shaderCache->mShaderCacheId, shaderCache);
+			}
+		}
+
+		// Shader source code ID to shader cache ID mapping
+		mShaderCacheByShaderSourceCodeId.reserve(mShaderCacheByShaderSourceCodeId.size() + cacheHeader.numberOfShaderSourceCodeIds);
+		for (const ::detail::ShaderSourceCodeEntry& shaderSourceCodeEntry : shaderSourceCodeEntries)
+		{
+			const uint32_t shaderCacheEntryIndex = ::detail::findShaderCacheEntryIndex(shaderCacheEntries, shaderSourceCodeEntry.shaderCacheId);
+			if (isInitialized(shaderCacheEntryIndex) && nullptr != shaderCaches[shaderCacheEntryIndex])
+			{
+				// Shader cache is still valid
+				mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeEntry.shaderSourceCodeId, shaderSourceCodeEntry.shaderCacheId);
+			}
+		}
+
 		// Done
 		mCacheNeedsSaving = false;
+		return true;
 	}
 
 	void ShaderCacheManager::saveCache(IFile& file)
 	{
-		{ // Save shader caches
-		  // -> Shader caches with a master shader cache must come last to ensure the master is already loaded
-			const uint32_t numberOfShaderCaches = static_cast<uint32_t>(mShaderCacheByShaderCacheId.size());
-			file.write(&numberOfShaderCaches, sizeof(uint32_t));
-			std::vector<const ShaderCache*> shaderCachesWithMaster;
-			for (auto& shaderCacheElement : mShaderCacheByShaderCacheId)
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+
+		// Gather the shader cache entries sorted by shader cache ID as well as the asset ID table and the shader bytecode blob layout
+		::detail::CacheHeader cacheHeader = {};
+		::detail::ShaderCacheEntries shaderCacheEntries;
+		shaderCacheEntries.reserve(mShaderCacheByShaderCacheId.size());
+		for (const auto& shaderCacheElement : mShaderCacheByShaderCacheId)
+		{
+			const ShaderCache* shaderCache = shaderCacheElement.second;
+			::detail::ShaderCacheEntry shaderCacheEntry = {};
+			shaderCacheEntry.shaderCacheId = shaderCache->mShaderCacheId;
+			if (nullptr == shaderCache->getMasterShaderCache())
 			{
-				const ShaderCache* shaderCache = shaderCacheElement.second;
-				if (nullptr == shaderCache->getMasterShaderCache())
+				// Master shader cache
+				const uint32_t numberOfBytes = shaderCache->mShaderBytecode.getNumberOfBytes();
+				assert((0 != numberOfBytes) && "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache");
+				assert(!shaderCache->mAssetIds.empty());
+				if (0 == numberOfBytes)
 				{
-					// Master shader cache
-					const Renderer::ShaderBytecode& shaderBytecode = shaderCache->mShaderBytecode;
-					const uint32_t numberOfBytes = shaderBytecode.getNumberOfBytes();
-					assert((0 != numberOfBytes) && "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache");
-					if (0 != numberOfBytes)
-					{
-						file.write(&shaderCache->mShaderCacheId, sizeof(ShaderCacheId));
-						file.write(&numberOfBytes, sizeof(uint32_t));
-
-						// Write list of IDs of the assets (shader blueprint, shader piece) which took part in the shader cache creation
-						const uint32_t numberOfAssetIds = static_cast<uint32_t>(shaderCache->mAssetIds.size());
-						assert(0 != numberOfAssetIds);
-						file.write(&numberOfAssetIds, sizeof(uint32_t));
-						file.write(shaderCache->mAssetIds.data(), sizeof(uint32_t) * numberOfAssetIds);
-						file.write(&shaderCache->mCombinedAssetFileHashes, sizeof(uint64_t));
-
-						// Write shader bytecode
-						file.write(shaderBytecode.getBytecode(), numberOfBytes);
-					}
+					continue;
 				}
-				else
+				shaderCacheEntry.combinedAssetFileHashes = shaderCache->mCombinedAssetFileHashes;
+				shaderCacheEntry.masterShaderCacheId	 = getUninitialized<ShaderCacheId>();
+				shaderCacheEntry.firstAssetId			 = cacheHeader.numberOfAssetIds;
+				shaderCacheEntry.numberOfAssetIds		 = static_cast<uint32_t>(shaderCache->mAssetIds.size());
+				shaderCacheEntry.bytecodeOffset			 = cacheHeader.numberOfBytecodeBytes;
+				shaderCacheEntry.numberOfBytecodeBytes	 = numberOfBytes;
+				cacheHeader.numberOfAssetIds += shaderCacheEntry.numberOfAssetIds;
+				cacheHeader.numberOfBytecodeBytes += numberOfBytes;
+			}
+			else
+			{
+				// Slave shader cache, a master shader cache without shader bytecode isn't written so its slaves can't be written either
+				if (0 == shaderCache->getMasterShaderCache()->mShaderBytecode.getNumberOfBytes())
 				{
-					shaderCachesWithMaster.push_back(shaderCache);
+					continue;
 				}
+				shaderCacheEntry.masterShaderCacheId = shaderCache->getMasterShaderCache()->mShaderCacheId;
 			}
-			for (const ShaderCache* shaderCache : shaderCachesWithMaster)
+			shaderCacheEntries.push_back(shaderCacheEntry);
+		}
+		std::sort(shaderCacheEntries.begin(), shaderCacheEntries.end(), [](const ::detail::ShaderCacheEntry& left, const ::detail::ShaderCacheEntry& right) { return (left.shaderCacheId < right.shaderCacheId); });
+		cacheHeader.numberOfShaderCaches = static_cast<uint32_t>(shaderCacheEntries.size());
+		cacheHeader.numberOfShaderSourceCodeIds = static_cast<uint32_t>(mShaderCacheByShaderSourceCodeId.size());
+
+		// Write the header and the shader cache entry table
+		file.write(&cacheHeader, sizeof(::detail::CacheHeader));
+		file.write(shaderCacheEntries.data(), sizeof(::detail::ShaderCacheEntry) * cacheHeader.numberOfShaderCaches);
+
+		// Write the asset ID table and the shader bytecode blob, the order must match the offsets gathered above (the unordered map wasn't modified in between)
+		for (const auto& shaderCacheElement : mShaderCacheByShaderCacheId)
+		{
+			const ShaderCache* shaderCache = shaderCacheElement.second;
+			if (nullptr == shaderCache->getMasterShaderCache() && 0 != shaderCache->mShaderBytecode.getNumberOfBytes())
 			{
-				const ShaderCache* masterShaderCache = shaderCache->getMasterShaderCache();
-				assert((nullptr != masterShaderCache->getShaderPtr().getPointer()) && "A shader cache must always have a valid shader instance, else it's a pointless shader cache");
-				file.write(&shaderCache->mShaderCacheId, sizeof(ShaderCacheId));
-				const uint32_t numberOfBytes = getUninitialized<uint32_t>();
-				file.write(&numberOfBytes, sizeof(uint32_t));
-				file.write(&masterShaderCache->mShaderCacheId, sizeof(ShaderCacheId));
+				file.write(shaderCache->mAssetIds.data(), sizeof(AssetId) * shaderCache->mAssetIds.size());
 			}
 		}
-
-		{ // Save shader source code ID to shader cache ID mapping
-			const uint32_t numberOfElements = static_cast<uint32_t>(mShaderCacheByShaderSourceCodeId.size());
-			file.write(&numberOfElements, sizeof(uint32_t));
-			for (auto& element : mShaderCacheByShaderSourceCodeId)
+		for (const auto& shaderCacheElement : mShaderCacheByShaderCacheId)
+		{
+			const ShaderCache* shaderCache = shaderCacheElement.second;
+			if (nullptr == shaderCache->getMasterShaderCache())
 			{
-				file.write(&element.first, sizeof(ShaderSourceCodeId));
-				file.write(&element.second, sizeof(ShaderCacheId));
+				const Renderer::ShaderBytecode& shaderBytecode = shaderCache->mShaderBytecode;
+				if (0 != shaderBytecode.getNumberOfBytes())
+				{
+					file.write(shaderBytecode.getBytecode(), shaderBytecode.getNumberOfBytes());
+				}
 			}
 		}
 
+		// Write the shader source code ID to shader cache ID mapping
+		for (const auto& element : mShaderCacheByShaderSourceCodeId)
+		{
+			const ::detail::ShaderSourceCodeEntry shaderSourceCodeEntry = { element.first, element.second };
+			file.write(&shaderSourceCodeEntry, sizeof(::detail::ShaderSourceCodeEntry));
+		}
+
 		// Done
 		mCacheNeedsSaving = false;
 	}
@@ -30,6 +30,7 @@
 #include "RendererRuntime/Resource/Material/MaterialResourceManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderBuilder.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
 #include <unordered_set>
@@ -99,6 +100,9 @@ namespace RendererRuntime
 		// Read the shader blueprint ASCII source code
 		mMemoryFile.read(mShaderSourceCode, shaderBlueprintHeader.numberOfShaderSourceCodeBytes);
 		mShaderBlueprintResource->mShaderSourceCode.assign(mShaderSourceCode, mShaderSourceCode + shaderBlueprintHeader.numberOfShaderSourceCodeBytes);
+
+		// Compile the shader template once so the shader builder doesn't need to parse the shader source code for each shader combination
+		ShaderBuilder::compileShaderTemplate(mShaderBlueprintResource->mShaderSourceCode, mShaderBlueprintResource->mShaderTemplate);
 	}
 
 	bool ShaderBlueprintResourceLoader::onDispatch()
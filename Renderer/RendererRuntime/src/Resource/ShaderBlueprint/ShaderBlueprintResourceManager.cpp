@@ -25,6 +25,7 @@
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResource.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Loader/ShaderBlueprintResourceLoader.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/IShaderBytecodeCompiler.h"
 #include "RendererRuntime/Resource/Detail/ResourceManagerTemplate.h"
 
 
@@ -48,6 +49,17 @@ namespace RendererRuntime
 		mInternalResourceManager->loadResourceByAssetId(assetId, shaderBlueprintResourceId, resourceListener, reload, resourceLoaderTypeId);
 	}
 
+	void ShaderBlueprintResourceManager::setShaderBytecodeCompiler(IShaderBytecodeCompiler* shaderBytecodeCompiler)
+	{
+		if (mShaderBytecodeCompiler != shaderBytecodeCompiler)
+		{
+			// The shader caches and pipeline state caches are for the previous target renderer backend, so get rid of them
+			mRendererRuntime.clearPipelineStateObjectCache();
+			mShaderBytecodeCompiler = shaderBytecodeCompiler;
+			gatherRendererShaderProperties();
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual RendererRuntime::IResourceManager methods ]
@@ -92,28 +104,45 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	ShaderBlueprintResourceManager::ShaderBlueprintResourceManager(IRendererRuntime& rendererRuntime) :
 		mRendererRuntime(rendererRuntime),
+		mShaderBytecodeCompiler(nullptr),
 		mShaderCacheManager(*this)
 	{
 		mInternalResourceManager = new ResourceManagerTemplate<ShaderBlueprintResource, ShaderBlueprintResourceLoader, ShaderBlueprintResourceId, 64>(rendererRuntime, *this);
+		gatherRendererShaderProperties();
+	}
 
+	ShaderBlueprintResourceManager::~ShaderBlueprintResourceManager()
+	{
+		delete mInternalResourceManager;
+	}
+
+	void ShaderBlueprintResourceManager::gatherRendererShaderProperties()
+	{
 		// Gather renderer shader properties
 		// -> Write the renderer name as well as the shader language name into the shader properties so shaders can perform renderer specific handling if required
 		// -> We really need both, usually shader language name is sufficient, but if more fine granular information is required it's accessible
-		Renderer::IRenderer& renderer = mRendererRuntime.getRenderer();
-		const Renderer::Capabilities& capabilities = mRendererRuntime.getRenderer().getCapabilities();
-		mRendererShaderProperties.setPropertyValue(StringId(renderer.getName()), 1);
-		mRendererShaderProperties.setPropertyValue(StringId("ZeroToOneClipZ"), capabilities.zeroToOneClipZ ? 1 : 0);
-		mRendererShaderProperties.setPropertyValue(StringId("UpperLeftOrigin"), capabilities.upperLeftOrigin ? 1 : 0);
-		const Renderer::IShaderLanguage* shaderLanguage = renderer.getShaderLanguage();
-		if (nullptr != shaderLanguage)
+		// -> During offline shader bytecode compilation the renderer shader properties are the ones of the target renderer backend
+		mRendererShaderProperties.clear();
+		if (nullptr != mShaderBytecodeCompiler)
 		{
-			mRendererShaderProperties.setPropertyValue(StringId(shaderLanguage->getShaderLanguageName()), 1);
+			mRendererShaderProperties.setPropertyValue(StringId(mShaderBytecodeCompiler->getRendererName()), 1);
+			mRendererShaderProperties.setPropertyValue(StringId("ZeroToOneClipZ"), mShaderBytecodeCompiler->isZeroToOneClipZ() ? 1 : 0);
+			mRendererShaderProperties.setPropertyValue(StringId("UpperLeftOrigin"), mShaderBytecodeCompiler->isUpperLeftOrigin() ? 1 : 0);
+			mRendererShaderProperties.setPropertyValue(StringId(mShaderBytecodeCompiler->getShaderLanguageName()), 1);
+		}
+		else
+		{
+			Renderer::IRenderer& renderer = mRendererRuntime.getRenderer();
+			const Renderer::Capabilities& capabilities = renderer.getCapabilities();
+			mRendererShaderProperties.setPropertyValue(StringId(renderer.getName()), 1);
+			mRendererShaderProperties.setPropertyValue(StringId("ZeroToOneClipZ"), capabilities.zeroToOneClipZ ? 1 : 0);
+			mRendererShaderProperties.setPropertyValue(StringId("UpperLeftOrigin"), capabilities.upperLeftOrigin ? 1 : 0);
+			const Renderer::IShaderLanguage* shaderLanguage = renderer.getShaderLanguage();
+			if (nullptr != shaderLanguage)
+			{
+				mRendererShaderProperties.setPropertyValue(StringId(shaderLanguage->getShaderLanguageName()), 1);
+			}
 		}
-	}
-
-	ShaderBlueprintResourceManager::~ShaderBlueprintResourceManager()
-	{
-		delete mInternalResourceManager;
 	}
 
 
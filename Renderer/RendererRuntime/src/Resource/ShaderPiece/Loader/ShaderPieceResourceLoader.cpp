@@ -30,6 +30,7 @@
 #include "RendererRuntime/Resource/Material/MaterialResourceManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderBuilder.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
 #include <unordered_set>
@@ -83,6 +84,9 @@ namespace RendererRuntime
 		// Read the shader piece ASCII source code
 		mMemoryFile.read(mShaderSourceCode, shaderPieceHeader.numberOfShaderSourceCodeBytes);
 		mShaderPieceResource->mShaderSourceCode.assign(mShaderSourceCode, mShaderSourceCode + shaderPieceHeader.numberOfShaderSourceCodeBytes);
+
+		// Compile the shader template once so the shader builder doesn't need to parse the shader source code for each shader combination
+		ShaderBuilder::compileShaderTemplate(mShaderPieceResource->mShaderSourceCode, mShaderPieceResource->mShaderTemplate);
 	}
 
 	bool ShaderPieceResourceLoader::onDispatch()
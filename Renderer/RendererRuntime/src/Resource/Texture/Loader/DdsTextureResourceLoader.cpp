@@ -27,6 +27,8 @@
 #include "RendererRuntime/Core/File/IFile.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
+#include <algorithm>
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -159,6 +161,10 @@ namespace RendererRuntime
 			// Does the data contain mipmaps?
 			mDataContainsMipmaps = (ddsHeader.mipMapCount > 0);
 
+			// Only the DX10 header can define 2D texture arrays and a texture format which doesn't need to be guessed
+			mNumberOfSlices = 1;
+			Renderer::TextureFormat::Enum dx10TextureFormat = Renderer::TextureFormat::UNKNOWN;
+
 			// Is this image compressed?
 			if (ddsHeader.ddpfPixelFormat.flags & ::detail::DDS_FOURCC)
 			{
@@ -168,6 +174,7 @@ namespace RendererRuntime
 					// Read the DX10 header
 					::detail::DdsHeaderDX10 ddsHeaderDX10;
 					file.read(&ddsHeaderDX10, sizeof(::detail::DdsHeaderDX10));
+					mNumberOfSlices = std::max(1u, ddsHeaderDX10.arraySize);
 
 					// Get the color format and compression
 					switch (ddsHeaderDX10.DXGIFormat)
@@ -247,6 +254,7 @@ namespace RendererRuntime
 					// Compressed
 						// DXT1 (BC1 UNORM)
 						case 71:
+							dx10TextureFormat = Renderer::TextureFormat::BC1;
 							// TODO(co)
 							// nInternalColorFormat = nColorFormat = ColorRGB;
 							// nCompression = CompressionDXT1;
@@ -254,6 +262,7 @@ namespace RendererRuntime
 
 						// DXT3 (BC2 UNORM)
 						case 74:
+							dx10TextureFormat = Renderer::TextureFormat::BC2;
 							// TODO(co)
 							// nInternalColorFormat = nColorFormat = ColorRGBA;
 							// nCompression = CompressionDXT3;
@@ -261,6 +270,7 @@ namespace RendererRuntime
 
 						// DXT5 (BC3 UNORM)
 						case 77:
+							dx10TextureFormat = Renderer::TextureFormat::BC3;
 							// TODO(co)
 							// nInternalColorFormat = nColorFormat = ColorRGBA;
 							// nCompression = CompressionDXT5;
@@ -275,6 +285,7 @@ namespace RendererRuntime
 
 						// LATC2 (BC5 UNORM, previously known as ATI2N)
 						case 83:
+							dx10TextureFormat = Renderer::TextureFormat::BC5;
 							// TODO(co)
 							// nInternalColorFormat = nColorFormat = ColorGrayscaleA;
 							// nCompression = CompressionLATC2;
@@ -494,6 +505,11 @@ namespace RendererRuntime
 						// 16-bit height map
 						mTextureFormat = Renderer::TextureFormat::R16_UNORM;
 					}
+					else if (Renderer::TextureFormat::UNKNOWN != dx10TextureFormat)
+					{
+						// Inside "Renderer::TextureFormat" the sRGB variant directly follows the BC1, BC2 and BC3 texture format, there's no BC5 sRGB variant
+						mTextureFormat = static_cast<uint8_t>((mTextureResource->isRgbHardwareGammaCorrection() && Renderer::TextureFormat::BC5 != dx10TextureFormat) ? (dx10TextureFormat + 1) : dx10TextureFormat);
+					}
 					else
 					{
 						mTextureFormat = static_cast<uint8_t>(mTextureResource->isRgbHardwareGammaCorrection() ? Renderer::TextureFormat::BC1_SRGB : Renderer::TextureFormat::BC1);
@@ -501,7 +517,50 @@ namespace RendererRuntime
 				}
 			}
 
-			{ // Loop through all faces
+			if (mNumberOfSlices > 1)
+			{
+				// 2D texture array: Calculate the number of image data bytes
+				const Renderer::TextureFormat::Enum textureFormat = static_cast<Renderer::TextureFormat::Enum>(mTextureFormat);
+				{
+					uint32_t width = mWidth;
+					uint32_t height = mHeight;
+					mNumberOfUsedImageDataBytes = 0;
+					for (uint32_t mipmap = 0; mipmap < numberOfMipmaps; ++mipmap)
+					{
+						mNumberOfUsedImageDataBytes += Renderer::TextureFormat::getNumberOfBytesPerSlice(textureFormat, width, height);
+						width = std::max(width >> 1, 1u);	// /= 2
+						height = std::max(height >> 1, 1u);	// /= 2
+					}
+					mNumberOfUsedImageDataBytes *= mNumberOfSlices;
+				}
+				if (mNumberOfImageDataBytes < mNumberOfUsedImageDataBytes)
+				{
+					mNumberOfImageDataBytes = mNumberOfUsedImageDataBytes;
+					delete [] mImageData;
+					mImageData = new uint8_t[mNumberOfImageDataBytes];
+				}
+
+				// DDS files are organized in slice-major order, the renderer interface expects mip-major order, so reorder while reading
+				for (uint32_t slice = 0; slice < mNumberOfSlices; ++slice)
+				{
+					uint32_t width = mWidth;
+					uint32_t height = mHeight;
+					uint8_t* currentImageData = mImageData;
+					for (uint32_t mipmap = 0; mipmap < numberOfMipmaps; ++mipmap)
+					{
+						const uint32_t numberOfBytesPerSlice = Renderer::TextureFormat::getNumberOfBytesPerSlice(textureFormat, width, height);
+						file.read(currentImageData + slice * numberOfBytesPerSlice, numberOfBytesPerSlice);
+
+						// Move on to the next mipmap
+						currentImageData += numberOfBytesPerSlice * mNumberOfSlices;
+						width = std::max(width >> 1, 1u);	// /= 2
+						height = std::max(height >> 1, 1u);	// /= 2
+					}
+				}
+			}
+			else
+			{
+				// Loop through all faces
 				uint32_t width = mWidth;
 				uint32_t height = mHeight;
 				uint32_t depth = mDepth;
@@ -685,7 +744,12 @@ namespace RendererRuntime
 	Renderer::ITexture* DdsTextureResourceLoader::createRendererTexture()
 	{
 		Renderer::ITexture* texture = nullptr;
-		if (1 == mWidth || 1 == mHeight)
+		if (mNumberOfSlices > 1)
+		{
+			// 2D texture array
+			texture = mRendererRuntime.getTextureManager().createTexture2DArray(mWidth, mHeight, mNumberOfSlices, static_cast<Renderer::TextureFormat::Enum>(mTextureFormat), mImageData, mDataContainsMipmaps ? Renderer::TextureFlag::DATA_CONTAINS_MIPMAPS : 0u, Renderer::TextureUsage::IMMUTABLE);
+		}
+		else if (1 == mWidth || 1 == mHeight)
 		{
 			// 1D texture
 			texture = mRendererRuntime.getTextureManager().createTexture1D((1 == mWidth) ? mHeight : mWidth, static_cast<Renderer::TextureFormat::Enum>(mTextureFormat), mImageData, mDataContainsMipmaps ? Renderer::TextureFlag::DATA_CONTAINS_MIPMAPS : 0u, Renderer::TextureUsage::IMMUTABLE);
@@ -256,7 +256,6 @@ namespace RendererRuntime
 	{
 		// TODO(co) Add optional top mipmap removal support (see "RendererRuntime::TextureResourceManager::NumberOfTopMipmapsToRemove")
 		// TODO(co) Add support for 3D textures (if supported by the KTX format)
-		// TODO(co) Add support for array textures (if supported by the KTX format)
 
 		// KTX header
 		::detail::KtxHeader ktxHeader;
@@ -274,12 +273,17 @@ namespace RendererRuntime
 		// Texture dimension
 		mWidth  = ktxHeader.pixelWidth;
 		mHeight = ktxHeader.pixelHeight;
+		mNumberOfSlices = std::max(1u, ktxHeader.numberOfArrayElements);
 
 		// Check if the file contains data for one texture or for 6 textures
 		if (1 != ktxHeader.numberOfFaces && 6 != ktxHeader.numberOfFaces)
 		{
 			assert(false && "Don't support more then one faces or exactly 6 faces");
 		}
+		if (mNumberOfSlices > 1 && 1 != ktxHeader.numberOfFaces)
+		{
+			assert(false && "Cube map arrays aren't supported");
+		}
 
 		// Texture format
 		if (0 == ktxHeader.glFormat)
@@ -331,6 +335,7 @@ namespace RendererRuntime
 				width  = std::max(width >> 1, 1u);	// /= 2
 				height = std::max(height >> 1, 1u);	// /= 2
 			}
+			mNumberOfUsedImageDataBytes *= mNumberOfSlices;
 		}
 		if (mNumberOfImageDataBytes < mNumberOfUsedImageDataBytes)
 		{
@@ -343,6 +348,7 @@ namespace RendererRuntime
 		//   Mip0: Face0, Face1, Face2, Face3, Face4, Face5
 		//   Mip1: Face0, Face1, Face2, Face3, Face4, Face5
 		//   etc.
+		// -> For 2D texture arrays the KTX image size of a mipmap covers all slices of this mipmap, which is again the layout the renderer interface expects
 
 		// Load in the image data
 		uint8_t* currentImageData = mImageData;
@@ -401,7 +407,12 @@ namespace RendererRuntime
 	Renderer::ITexture* KtxTextureResourceLoader::createRendererTexture()
 	{
 		Renderer::ITexture* texture = nullptr;
-		if (mCubeMap)
+		if (mNumberOfSlices > 1)
+		{
+			// 2D texture array
+			texture = mRendererRuntime.getTextureManager().createTexture2DArray(mWidth, mHeight, mNumberOfSlices, static_cast<Renderer::TextureFormat::Enum>(mTextureFormat), mImageData, mDataContainsMipmaps ? Renderer::TextureFlag::DATA_CONTAINS_MIPMAPS : 0u, Renderer::TextureUsage::IMMUTABLE);
+		}
+		else if (mCubeMap)
 		{
 			// Cube texture
 			texture = mRendererRuntime.getTextureManager().createTextureCube(mWidth, mHeight, static_cast<Renderer::TextureFormat::Enum>(mTextureFormat), mImageData, mDataContainsMipmaps ? Renderer::TextureFlag::DATA_CONTAINS_MIPMAPS : 0u, Renderer::TextureUsage::IMMUTABLE);
@@ -151,6 +151,14 @@ namespace RendererRuntime
 		{
 			mVertexAttributesResource->mVertexAttributes = Renderer::VertexAttributes(MeshResource::SKINNED_VERTEX_ATTRIBUTES.numberOfAttributes, MeshResource::SKINNED_VERTEX_ATTRIBUTES.attributes);
 		}
+		else if (2658181492 == getAsset().assetId)	// "Example/VertexAttributes/Default/QuantizedMesh"
+		{
+			mVertexAttributesResource->mVertexAttributes = Renderer::VertexAttributes(MeshResource::QUANTIZED_VERTEX_ATTRIBUTES.numberOfAttributes, MeshResource::QUANTIZED_VERTEX_ATTRIBUTES.attributes);
+		}
+		else if (547304290 == getAsset().assetId)	// "Example/VertexAttributes/Default/QuantizedSkinnedMesh"
+		{
+			mVertexAttributesResource->mVertexAttributes = Renderer::VertexAttributes(MeshResource::QUANTIZED_SKINNED_VERTEX_ATTRIBUTES.numberOfAttributes, MeshResource::QUANTIZED_SKINNED_VERTEX_ATTRIBUTES.attributes);
+		}
 		else if (684507259 == getAsset().assetId)	// "Example/VertexAttributes/Default/Terrain"
 		{
 			mVertexAttributesResource->mVertexAttributes = Renderer::VertexAttributes(TerrainSceneItem::VERTEX_ATTRIBUTES.numberOfAttributes, TerrainSceneItem::VERTEX_ATTRIBUTES.attributes);
@@ -84,6 +84,7 @@ namespace RendererToolkit
 	typedef std::unordered_map<uint32_t, uint32_t>	  CompiledAssetIdToSourceAssetId;	///< Key = compiled asset ID, value = source asset ID ("AssetId"-type not used directly or we would need to define a hash-function for it)
 	typedef std::unordered_map<uint32_t, std::string> SourceAssetIdToVirtualFilename;	///< Key = source asset ID, virtual asset filename
 	typedef std::unordered_set<uint32_t>			  DefaultTextureAssetIds;			///< "RendererRuntime::AssetId"-type for compiled asset IDs
+	typedef std::vector<uint32_t>					  SourceAssetIds;					///< "RendererRuntime::AssetId"-type for source asset IDs
 
 	/**
 	*  @brief
@@ -131,10 +132,12 @@ namespace RendererToolkit
 			const CompiledAssetIdToSourceAssetId&	compiledAssetIdToSourceAssetId;
 			const SourceAssetIdToVirtualFilename&	sourceAssetIdToVirtualFilename;
 			const DefaultTextureAssetIds&			defaultTextureAssetIds;
+			SourceAssetIds&							dependencySourceAssetIds;			///< Receives the source asset IDs of the assets the compiled asset depends on, filled by the asset ID lookups, may contain duplicates and is used to build the asset dependency graph
 
 			Input() = delete;
 			Input(const Context& _context, const std::string _projectName, CacheManager& _cacheManager, const std::string& _virtualAssetPackageInputDirectory, const std::string& _virtualAssetFilename, const std::string& _virtualAssetInputDirectory,
-				  const std::string& _virtualAssetOutputDirectory, const SourceAssetIdToCompiledAssetId& _sourceAssetIdToCompiledAssetId, const CompiledAssetIdToSourceAssetId& _compiledAssetIdToSourceAssetId, const SourceAssetIdToVirtualFilename& _sourceAssetIdToVirtualFilename, const DefaultTextureAssetIds& _defaultTextureAssetIds) :
+				  const std::string& _virtualAssetOutputDirectory, const SourceAssetIdToCompiledAssetId& _sourceAssetIdToCompiledAssetId, const CompiledAssetIdToSourceAssetId& _compiledAssetIdToSourceAssetId, const SourceAssetIdToVirtualFilename& _sourceAssetIdToVirtualFilename, const DefaultTextureAssetIds& _defaultTextureAssetIds,
+				  SourceAssetIds& _dependencySourceAssetIds) :
 				context(_context),
 				projectName(_projectName),
 				cacheManager(_cacheManager),
@@ -145,10 +148,24 @@ namespace RendererToolkit
 				sourceAssetIdToCompiledAssetId(_sourceAssetIdToCompiledAssetId),
 				compiledAssetIdToSourceAssetId(_compiledAssetIdToSourceAssetId),
 				sourceAssetIdToVirtualFilename(_sourceAssetIdToVirtualFilename),
-				defaultTextureAssetIds(_defaultTextureAssetIds)
+				defaultTextureAssetIds(_defaultTextureAssetIds),
+				dependencySourceAssetIds(_dependencySourceAssetIds)
 			{
 				// Nothing here
 			}
+			void addDependencySourceAssetId(uint32_t sourceAssetId) const
+			{
+				dependencySourceAssetIds.push_back(sourceAssetId);
+			}
+			void addDependencyCompiledAssetId(uint32_t compiledAssetId) const
+			{
+				// Compiled or runtime generated assets which aren't part of the project (e.g. default textures) are no dependencies
+				CompiledAssetIdToSourceAssetId::const_iterator iterator = compiledAssetIdToSourceAssetId.find(compiledAssetId);
+				if (iterator != compiledAssetIdToSourceAssetId.cend())
+				{
+					dependencySourceAssetIds.push_back(iterator->second);
+				}
+			}
 			uint32_t getCompiledAssetIdBySourceAssetId(uint32_t sourceAssetId) const
 			{
 				SourceAssetIdToCompiledAssetId::const_iterator iterator = sourceAssetIdToCompiledAssetId.find(sourceAssetId);
@@ -156,6 +173,7 @@ namespace RendererToolkit
 				{
 					throw std::runtime_error(std::string("Source asset ID ") + std::to_string(sourceAssetId) + " is unknown");
 				}
+				addDependencySourceAssetId(sourceAssetId);
 				return iterator->second;
 			}
 			uint32_t getCompiledAssetIdBySourceAssetIdAsString(const std::string& sourceAssetIdAsString) const
@@ -166,6 +184,7 @@ namespace RendererToolkit
 				{
 					throw std::runtime_error(std::string("Source asset ID \"") + sourceAssetIdAsString + "\" is unknown");
 				}
+				addDependencySourceAssetId(iterator->first);
 				return iterator->second;
 			}
 			std::string sourceAssetIdToDebugName(uint32_t sourceAssetId) const
@@ -182,6 +201,7 @@ namespace RendererToolkit
 				SourceAssetIdToVirtualFilename::const_iterator iterator = sourceAssetIdToVirtualFilename.find(sourceAssetId);
 				if (sourceAssetIdToVirtualFilename.cend() != iterator)
 				{
+					addDependencySourceAssetId(sourceAssetId);
 					return iterator->second;
 				}
 				else
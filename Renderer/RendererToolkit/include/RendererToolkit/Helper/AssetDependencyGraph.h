@@ -0,0 +1,282 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/AssetCompiler/IAssetCompiler.h"	// For "RendererToolkit::SourceAssetIds"
+
+#include <RendererRuntime/Asset/AssetPackage.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <string>
+	#include <vector>
+	#include <unordered_map>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+	class Context;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Persistent asset dependency graph of a project and renderer target
+	*
+	*  @remarks
+	*    There's one node per source asset. A node knows the input files of the asset (the asset file itself as well as the source files),
+	*    the source assets the asset depends on (e.g. material -> material blueprint -> shader blueprint -> shader piece, mesh -> material,
+	*    scene -> mesh) and the output assets written by the previous compilation of the asset.
+	*
+	*    The input files are only compared by file size and file time, this way a compilation run without any changes doesn't need to parse
+	*    a single asset file or hash a single source file. Only the transitive closure of changed assets has to be compiled, the asset compilers
+	*    still use the cache manager to skip work in case e.g. a file time has been changed but the file content is still the same.
+	*
+	*  @note
+	*    - Not thread-safe, the project compiler worker threads synchronize the access
+	*/
+	class AssetDependencyGraph final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		typedef std::vector<std::string> VirtualFilenames;
+
+		struct InputFile final
+		{
+			std::string virtualFilename;
+			int64_t		fileSize;	///< The file size, -1 if the file doesn't exist
+			int64_t		fileTime;	///< The file time (last write time), -1 if the file doesn't exist
+		};
+		typedef std::vector<InputFile> InputFiles;
+
+		struct Node final
+		{
+			InputFiles										   inputFiles;					///< Input files of the asset, the asset file included
+			SourceAssetIds									   dependencySourceAssetIds;	///< Source asset IDs of the assets this asset depends on, sorted and without duplicates
+			RendererRuntime::AssetPackage::SortedAssetVector outputAssets;				///< Output assets written by the last compilation of the asset
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor, loads the asset dependency graph
+		*
+		*  @param[in] context
+		*    The renderer toolkit context to use, the renderer toolkit context instance must stay valid as long as the asset dependency graph instance exists
+		*  @param[in] projectName
+		*    UTF-8 name of the project this asset dependency graph is for
+		*  @param[in] rendererTarget
+		*    UTF-8 renderer target name this asset dependency graph is for
+		*/
+		AssetDependencyGraph(const Context& context, const std::string& projectName, const std::string& rendererTarget);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~AssetDependencyGraph();
+
+		/**
+		*  @brief
+		*    Return the node of a source asset
+		*
+		*  @param[in] sourceAssetId
+		*    Source asset ID
+		*
+		*  @return
+		*    The node, null pointer if the source asset is unknown, don't destroy the instance
+		*/
+		const Node* tryGetNode(uint32_t sourceAssetId) const;
+
+		/**
+		*  @brief
+		*    Gather the current file size and file time of the given files
+		*
+		*  @param[in] virtualInputFilenames
+		*    Virtual UTF-8 input filenames
+		*  @param[out] inputFiles
+		*    Receives the input files, list is cleared before new entries are added
+		*
+		*  @note
+		*    - Only accesses the file manager, can be called by multiple threads at the same time
+		*/
+		void fillInputFiles(const VirtualFilenames& virtualInputFilenames, InputFiles& inputFiles) const;
+
+		/**
+		*  @brief
+		*    Set the node of a source asset after the asset has been compiled
+		*
+		*  @param[in] sourceAssetId
+		*    Source asset ID
+		*  @param[in] inputFiles
+		*    Input files of the asset, see "RendererToolkit::AssetDependencyGraph::fillInputFiles()"
+		*  @param[in] dependencySourceAssetIds
+		*    Source asset IDs of the assets the asset depends on, may contain duplicates and the asset itself
+		*  @param[in] outputAssets
+		*    Output assets written by the compilation of the asset
+		*/
+		void setNode(uint32_t sourceAssetId, const InputFiles& inputFiles, const SourceAssetIds& dependencySourceAssetIds, const RendererRuntime::AssetPackage::SortedAssetVector& outputAssets);
+
+		/**
+		*  @brief
+		*    Remove the nodes of all source assets which are not inside the given list
+		*
+		*  @param[in] sourceAssetIds
+		*    Source asset IDs of all assets of the project
+		*
+		*  @return
+		*    "true" if at least one node has been removed, else "false"
+		*/
+		bool removeUnknownNodes(const SourceAssetIds& sourceAssetIds);
+
+		/**
+		*  @brief
+		*    Return whether or not the given project files (e.g. project and targets file) have been changed since the asset dependency graph has been saved
+		*
+		*  @param[in] virtualProjectFilenames
+		*    Virtual UTF-8 filenames of files all assets depend on, the current file size and file time is stored
+		*
+		*  @return
+		*    "true" if the project files have been changed, all nodes have been removed in this case, else "false"
+		*/
+		bool updateProjectFiles(const VirtualFilenames& virtualProjectFilenames);
+
+		/**
+		*  @brief
+		*    Gather the assets which need to be compiled
+		*
+		*  @param[in] sourceAssetIds
+		*    Source asset IDs of all assets of the project
+		*  @param[out] changedSourceAssetIds
+		*    Receives the source asset IDs of the assets whose input files or output files have been changed, list is not cleared before new entries are added
+		*  @param[out] unknownSourceAssetIds
+		*    Receives the source asset IDs of the assets without a node, list is not cleared before new entries are added
+		*  @param[out] dependentSourceAssetIds
+		*    Receives the source asset IDs of the assets which are unchanged but (transitively) depend on a changed or unknown asset, list is not cleared before new entries are added
+		*/
+		void getAssetsToCompile(const SourceAssetIds& sourceAssetIds, SourceAssetIds& changedSourceAssetIds, SourceAssetIds& unknownSourceAssetIds, SourceAssetIds& dependentSourceAssetIds) const;
+
+		/**
+		*  @brief
+		*    Gather the assets using at least one of the given input files
+		*
+		*  @param[in] virtualInputFilenames
+		*    Virtual UTF-8 filenames of changed input files, e.g. reported by a file watcher
+		*  @param[out] sourceAssetIds
+		*    Receives the source asset IDs of the assets using one of the input files, list is not cleared before new entries are added
+		*
+		*  @note
+		*    - No file is accessed, only the input files known by the nodes are searched
+		*/
+		void getAssetsByInputFiles(const VirtualFilenames& virtualInputFilenames, SourceAssetIds& sourceAssetIds) const;
+
+		/**
+		*  @brief
+		*    Gather the assets which (transitively) depend on the given assets
+		*
+		*  @param[in] sourceAssetIds
+		*    Source asset IDs of the changed assets
+		*  @param[out] dependentSourceAssetIds
+		*    Receives the source asset IDs of the depending assets which are not part of the given list, list is not cleared before new entries are added
+		*/
+		void getDependentAssets(const SourceAssetIds& sourceAssetIds, SourceAssetIds& dependentSourceAssetIds) const;
+
+		/**
+		*  @brief
+		*    Save the asset dependency graph, if it has been changed
+		*/
+		void save();
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		void load();
+		bool areInputFilesChanged(const InputFiles& inputFiles) const;
+
+		AssetDependencyGraph(const AssetDependencyGraph&) = delete;
+		AssetDependencyGraph& operator=(const AssetDependencyGraph&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::unordered_map<uint32_t, Node> Nodes;	///< Key = source asset ID ("AssetId"-type not used directly or we would need to define a hash-function for it)
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		const Context&	  mContext;
+		const std::string mProjectName;		///< UTF-8 name of the project this asset dependency graph is for
+		const std::string mRendererTarget;	///< UTF-8 renderer target name this asset dependency graph is for
+		InputFiles		  mProjectFiles;	///< Files all assets depend on
+		Nodes			  mNodes;
+		bool			  mDirty;			///< "true" if the asset dependency graph has to be saved, else "false"
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
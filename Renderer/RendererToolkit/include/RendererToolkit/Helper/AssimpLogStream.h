@@ -43,6 +43,18 @@ PRAGMA_WARNING_PUSH
 	#include <assimp/DefaultLogger.hpp>
 PRAGMA_WARNING_POP
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <mutex>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -54,6 +66,14 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Assimp log stream redirecting Assimp errors into exceptions
+	*
+	*  @note
+	*    - The Assimp default logger is a global singleton which isn't thread-safe, so while an Assimp log stream instance exists other
+	*      threads creating an Assimp log stream instance are blocked (Assimp importer usage of the project compiler worker threads is serialized)
+	*/
 	class AssimpLogStream final : public Assimp::LogStream
 	{
 
@@ -84,7 +104,8 @@ namespace RendererToolkit
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		std::string mLastErrorMessage;
+		std::unique_lock<std::mutex> mMutexLock;	///< Lock of the global Assimp default logger mutex, hold during the lifetime of the Assimp log stream instance
+		std::string					 mLastErrorMessage;
 
 
 	};
@@ -42,6 +42,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
 	#include <string>
 	#include <vector>
+	#include <mutex>
 	#include <unordered_map>
 PRAGMA_WARNING_POP
 
@@ -73,8 +74,15 @@ namespace RendererToolkit
 	*  @brief
 	*    Cache manager for source assets
 	*
+	*  @remarks
+	*    Additionally, the cache manager provides a content-addressed store of compiled files. The content address is the hash of the compiler version,
+	*    the relevant renderer target configuration, the virtual asset filename and the content of all input files. Since neither the renderer
+	*    target name nor the output directory is part of the content address, compiled files are shared between renderer targets having the same
+	*    configuration, between branches and between clean builds. The content cache directory can be located on a shared network drive.
+	*
 	*  @note
 	*    - This manager caches the content hash of source assets to speed up project compilation when the source doesn't changes
+	*    - Thread-safe, the project compiler worker threads share a single cache manager instance
 	*/
 	class CacheManager final
 	{
@@ -109,6 +117,10 @@ namespace RendererToolkit
 		{
 			std::vector<CacheEntry>	sourceCacheEntries;
 			CacheEntry				assetCacheEntry;
+			// Content cache
+			uint64_t				contentHash = 0;						///< Content address of the compiled file, set by "RendererToolkit::CacheManager::needsToBeCompiled()" in case a compilation is needed, 0 if unknown
+			std::string				virtualDestinationFilename;				///< Virtual UTF-8 filename of the compiled file
+			std::vector<uint32_t>*	dependencySourceAssetIds = nullptr;		///< Dependencies recorded during the compilation which are stored with the compiled file, set by "RendererToolkit::CacheManager::tryRestoreFromContentCache()" in case of a content cache miss, don't destroy the instance
 		};
 
 
@@ -186,6 +198,55 @@ namespace RendererToolkit
 		*/
 		void storeOrUpdateCacheEntries(const CacheEntries& cacheEntries);
 
+		/**
+		*  @brief
+		*    Set the content cache directory
+		*
+		*  @param[in] virtualContentCacheDirectory
+		*    Virtual UTF-8 name of the directory storing the compiled files by content address, empty string to disable the content cache
+		*/
+		void setContentCacheDirectory(const std::string& virtualContentCacheDirectory);
+
+		/**
+		*  @brief
+		*    Set the hash of the renderer target configuration relevant for the asset compilers
+		*
+		*  @param[in] rendererTarget
+		*    The UTF-8 renderer target name
+		*  @param[in] configurationHash
+		*    Hash of the renderer target configuration the asset compilers depend on, renderer targets with the same configuration hash share compiled files
+		*/
+		void setRendererTargetConfigurationHash(const std::string& rendererTarget, uint64_t configurationHash);
+
+		/**
+		*  @brief
+		*    Try to restore a compiled file from the content cache instead of compiling it
+		*
+		*  @param[in, out] cacheEntries
+		*    Cache entries filled by "RendererToolkit::CacheManager::needsToBeCompiled()" which returned "true"
+		*  @param[in, out] dependencySourceAssetIds
+		*    Dependencies of the asset, in case of a content cache hit the dependencies stored with the compiled file are added, in case of a miss the dependencies
+		*    recorded until "RendererToolkit::CacheManager::storeOrUpdateCacheEntries()" is called are stored with the compiled file, must stay valid until then
+		*
+		*  @return
+		*    "true" if the compiled file has been restored and the cache entries have been stored, "false" if the file needs to be compiled
+		*
+		*  @note
+		*    - Only to be used by asset compilers whose output exclusively depends on the input files known by the cache manager, not on the content of other assets
+		*/
+		bool tryRestoreFromContentCache(CacheEntries& cacheEntries, std::vector<uint32_t>& dependencySourceAssetIds);
+
+		/**
+		*  @brief
+		*    Return the content cache statistics of the current compilation run
+		*
+		*  @param[out] numberOfHits
+		*    Receives the number of compiled files restored from the content cache
+		*  @param[out] numberOfMisses
+		*    Receives the number of compiled files not found inside the content cache
+		*/
+		void getContentCacheStatistics(uint32_t& numberOfHits, uint32_t& numberOfMisses);
+
 		/**
 		*  @brief
 		*    Return whether or not least one of the given files has been modified since the last check
@@ -223,7 +284,32 @@ namespace RendererToolkit
 
 		/**
 		*  @brief
-		*    Clear the internal cache for file changes
+		*    Enforce that the given file is considered to be changed during the current compilation run
+		*
+		*  @param[in] rendererTarget
+		*    The UTF-8 renderer target name for which the asset should be compiled
+		*  @param[in] virtualFilename
+		*    Virtual UTF-8 filename of the file to invalidate, usually the file containing the asset metadata
+		*
+		*  @note
+		*    - Used to compile assets whose own files are unchanged but which depend on a changed asset
+		*/
+		void invalidateFile(const std::string& rendererTarget, const std::string& virtualFilename);
+
+		/**
+		*  @brief
+		*    Return the source filenames an asset was checked with during the current compilation run
+		*
+		*  @param[in] virtualAssetFilename
+		*    Virtual UTF-8 filename of the file containing the asset metadata
+		*  @param[out] virtualSourceFilenames
+		*    Receives the virtual UTF-8 source filenames passed into "RendererToolkit::CacheManager::needsToBeCompiled()", not cleared before adding new entries
+		*/
+		void getVirtualSourceFilenames(const std::string& virtualAssetFilename, std::vector<std::string>& virtualSourceFilenames);
+
+		/**
+		*  @brief
+		*    Clear the internal cache for file changes as well as the content cache statistics
 		*/
 		void clearInternalCache();
 
@@ -257,6 +343,9 @@ namespace RendererToolkit
 		*
 		*  @return
 		*    "true" if a cache entry exists otherwise "false"
+		*
+		*  @note
+		*    - The cache manager mutex must be locked by the caller
 		*/
 		bool fillEntryForFile(const std::string& rendererTarget, RendererRuntime::StringId fileId, CacheEntry& cacheEntry);
 
@@ -278,6 +367,7 @@ namespace RendererToolkit
 		*
 		*  @note
 		*    - When a change was detected the an cache entry is stored/updated
+		*    - Must be called without holding the cache manager mutex, file contents are hashed while the mutex is unlocked
 		*/
 		bool checkIfFileChanged(const std::string& rendererTarget, RendererRuntime::VirtualFilename virtualFilename, uint32_t compilerVersion, CacheEntry& cacheEntry);
 
@@ -287,9 +377,27 @@ namespace RendererToolkit
 		*
 		*  @param[in] cacheEntry
 		*    The cache entry data to store / update
+		*
+		*  @note
+		*    - The cache manager mutex must be locked by the caller
 		*/
 		void storeOrUpdateCacheEntry(const CacheEntry& cacheEntry);
 
+		/**
+		*  @brief
+		*    Return the virtual filename of a content cache file
+		*
+		*  @param[in] contentHash
+		*    Content address of the compiled file
+		*
+		*  @return
+		*    The virtual UTF-8 filename, empty string if the content cache is disabled
+		*
+		*  @note
+		*    - The cache manager mutex must be locked by the caller
+		*/
+		std::string getVirtualContentCacheFilename(uint64_t contentHash) const;
+
 		CacheManager(const CacheManager&) = delete;
 		CacheManager& operator=(const CacheManager&) = delete;
 
@@ -306,6 +414,8 @@ namespace RendererToolkit
 			CacheEntry cacheEntry;
 		};
 		typedef std::unordered_map<uint32_t, CheckedFile> CheckedFilesStatus;
+		typedef std::unordered_map<uint32_t, std::vector<std::string>> VirtualSourceFilenames;	///< Key = asset file ID, value = virtual source filenames
+		typedef std::unordered_map<uint32_t, uint64_t> ConfigurationHashes;							///< Key = renderer target ID, value = configuration hash
 
 
 	//[-------------------------------------------------------]
@@ -314,11 +424,19 @@ namespace RendererToolkit
 	private:
 		const Context&	   mContext;
 		const std::string  mProjectName;	///< UTF-8 name of the project this cache is for
+		std::mutex		   mMutex;			///< Guards the stored cache entries and the checked files status, the cache manager is used by multiple project compiler worker threads
 		StoredCacheEntries mStoredCacheEntries;
 		bool			   mDiskCacheDirty;
 
 		// We use here "uint32_t" instead of "RendererRuntime::StringId" because we don't define a "std::hash"-method for "RendererRuntime::StringId", which internal stores an "uint32_t"
-		CheckedFilesStatus mCheckedFilesStatus;	///< Holds the status of each file checked via "RendererToolkit::CacheManager::checkIfFileChanged()"
+		CheckedFilesStatus	   mCheckedFilesStatus;		///< Holds the status of each file checked via "RendererToolkit::CacheManager::checkIfFileChanged()"
+		VirtualSourceFilenames mVirtualSourceFilenames;	///< Holds the source filenames of each asset checked via "RendererToolkit::CacheManager::needsToBeCompiled()"
+
+		// Content cache
+		std::string			mVirtualContentCacheDirectory;	///< Virtual UTF-8 name of the content cache directory, empty string if the content cache is disabled
+		ConfigurationHashes	mConfigurationHashes;
+		uint32_t			mNumberOfContentCacheHits;
+		uint32_t			mNumberOfContentCacheMisses;
 
 
 	};
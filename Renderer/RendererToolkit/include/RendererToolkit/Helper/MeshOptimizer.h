@@ -0,0 +1,177 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <RendererRuntime/Core/Platform/PlatformTypes.h>
+
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Mesh optimizer reordering triangle lists for the post-transform vertex cache, for less overdraw and for vertex fetch locality
+	*
+	*  @remarks
+	*    The optimizations are meant to be applied per sub-mesh in the following order
+	*    - "RendererToolkit::MeshOptimizer::optimizeVertexCache()": Triangle order for the post-transform vertex cache (Tom Forsyth, "Linear-Speed Vertex Cache Optimisation")
+	*    - "RendererToolkit::MeshOptimizer::optimizeOverdraw()": Cluster order for less overdraw (Pedro V. Sander, Diego Nehab, Joshua Barczak, "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw")
+	*    - "RendererToolkit::MeshOptimizer::optimizeVertexFetch()": Vertex order for the pre-transform vertex cache, applied once to the whole vertex buffer
+	*
+	*    The indices are 32 bit triangle list indices. The vertex cache is simulated as FIFO cache, the average cache miss ratio (ACMR, vertex shader
+	*    invocations per triangle, 0.5 is the optimum for large regular grids) and the average transformed vertex ratio (ATVR, vertex shader
+	*    invocations per referenced vertex, 1.0 is the optimum) can be computed on the CPU without the need for a GPU.
+	*/
+	class MeshOptimizer final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const uint32_t VERTEX_CACHE_SIZE = 32;	///< Simulated post-transform vertex cache size, number of vertices
+
+		struct VertexCacheStatistics final
+		{
+			uint32_t numberOfTriangles;				///< Number of triangles
+			uint32_t numberOfVertices;				///< Number of referenced vertices
+			uint32_t numberOfTransformedVertices;	///< Number of vertex cache misses, each vertex cache miss results in a vertex shader invocation
+
+			inline float getAverageCacheMissRatio() const	// ACMR
+			{
+				return (numberOfTriangles > 0) ? static_cast<float>(numberOfTransformedVertices) / static_cast<float>(numberOfTriangles) : 0.0f;
+			}
+
+			inline float getAverageTransformedVertexRatio() const	// ATVR
+			{
+				return (numberOfVertices > 0) ? static_cast<float>(numberOfTransformedVertices) / static_cast<float>(numberOfVertices) : 0.0f;
+			}
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Simulate a FIFO post-transform vertex cache and gather statistics
+		*
+		*  @param[in] indices
+		*    Triangle list indices, each index must be smaller than the given number of vertices
+		*  @param[in] numberOfIndices
+		*    Number of indices, must be a multiple of three
+		*  @param[in] numberOfVertices
+		*    Number of vertices
+		*  @param[in, out] vertexCacheStatistics
+		*    Vertex cache statistics to add the statistics of the given triangle list to, this way the statistics of multiple sub-meshes can be summed up
+		*/
+		static void analyzeVertexCache(const uint32_t* indices, uint32_t numberOfIndices, uint32_t numberOfVertices, VertexCacheStatistics& vertexCacheStatistics);
+
+		/**
+		*  @brief
+		*    Reorder the triangles for the post-transform vertex cache
+		*
+		*  @param[in, out] indices
+		*    Triangle list indices to reorder, each index must be smaller than the given number of vertices
+		*  @param[in] numberOfIndices
+		*    Number of indices, must be a multiple of three
+		*  @param[in] numberOfVertices
+		*    Number of vertices
+		*/
+		static void optimizeVertexCache(uint32_t* indices, uint32_t numberOfIndices, uint32_t numberOfVertices);
+
+		/**
+		*  @brief
+		*    Reorder clusters of triangles for less overdraw while keeping most of the post-transform vertex cache efficiency
+		*
+		*  @param[in, out] indices
+		*    Triangle list indices to reorder, each index must be smaller than the given number of vertices, should already be optimized for the post-transform vertex cache
+		*  @param[in] numberOfIndices
+		*    Number of indices, must be a multiple of three
+		*  @param[in] vertices
+		*    Vertex data, each vertex must start with a 32 bit float position
+		*  @param[in] numberOfVertices
+		*    Number of vertices
+		*  @param[in] numberOfBytesPerVertex
+		*    Number of bytes per vertex
+		*  @param[in] threshold
+		*    Tolerated post-transform vertex cache efficiency loss, e.g. 1.05 for a 5% higher average cache miss ratio, the higher the value the smaller the clusters, 1.0 to only reorder disjoint triangle patches
+		*
+		*  @remarks
+		*    The triangle list is split into clusters which are sorted so that clusters facing away from the mesh center are drawn first, those are likely to occlude the other clusters.
+		*/
+		static void optimizeOverdraw(uint32_t* indices, uint32_t numberOfIndices, const uint8_t* vertices, uint32_t numberOfVertices, uint32_t numberOfBytesPerVertex, float threshold);
+
+		/**
+		*  @brief
+		*    Reorder the vertices in the order they are used by the triangles for the pre-transform vertex cache
+		*
+		*  @param[in, out] vertices
+		*    Vertex data to reorder
+		*  @param[in] numberOfVertices
+		*    Number of vertices
+		*  @param[in] numberOfBytesPerVertex
+		*    Number of bytes per vertex
+		*  @param[in, out] indices
+		*    Indices to remap, each index must be smaller than the given number of vertices
+		*  @param[in] numberOfIndices
+		*    Number of indices
+		*
+		*  @note
+		*    - Unused vertices are kept and moved to the end of the vertex data, the number of vertices doesn't change
+		*/
+		static void optimizeVertexFetch(uint8_t* vertices, uint32_t numberOfVertices, uint32_t numberOfBytesPerVertex, uint32_t* indices, uint32_t numberOfIndices);
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		MeshOptimizer(const MeshOptimizer&) = delete;
+		MeshOptimizer& operator=(const MeshOptimizer&) = delete;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
@@ -0,0 +1,114 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <RendererRuntime/Core/Platform/PlatformTypes.h>
+
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Mesh simplifier reducing the number of triangles of a triangle list, used to generate level of detail (LOD) chains
+	*
+	*  @remarks
+	*    Quadric error metric (QEM) based edge collapse as described in Michael Garland, Paul S. Heckbert, "Surface Simplification Using Quadric Error Metrics".
+	*    A vertex is always collapsed onto one of its neighbour vertices (half-edge collapse), this way no new vertices are created and all
+	*    simplified triangle lists can share one and the same vertex buffer with the original triangle list.
+	*
+	*    - Open borders are preserved: Border vertices are only collapsed along the border and the border edges contribute additional planes to the quadrics
+	*    - Attribute seams are preserved: Vertices whose position is shared with other vertices (e.g. texture coordinate seams or hard normal edges) are never collapsed
+	*    - The texture coordinate difference of a collapse is added to the collapse error, this way texture stretching is kept low
+	*    - Collapses flipping triangles are rejected
+	*
+	*    The collapse error is relative to the mesh extent, e.g. 0.01 means a geometric deviation of 1% of the largest bounding box edge length.
+	*/
+	class MeshSimplifier final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Simplify a triangle list
+		*
+		*  @param[in] indices
+		*    Triangle list indices, each index must be smaller than the given number of vertices
+		*  @param[in] numberOfIndices
+		*    Number of indices, must be a multiple of three
+		*  @param[in] vertices
+		*    Vertex data, each vertex must start with a 32 bit float position followed by a 32 bit float texture coordinate
+		*  @param[in] numberOfVertices
+		*    Number of vertices
+		*  @param[in] numberOfBytesPerVertex
+		*    Number of bytes per vertex
+		*  @param[in] targetNumberOfIndices
+		*    Target number of indices, the simplification stops as soon as the number of indices is equal or below this value
+		*  @param[in] targetError
+		*    Maximum tolerated relative collapse error, the simplification stops before reaching the target number of indices in case there's no collapse with a smaller error left
+		*  @param[in] textureCoordinateWeight
+		*    Weight of the squared texture coordinate difference of a collapse, 0 to ignore the texture coordinates
+		*  @param[out] destinationIndices
+		*    Receives the simplified triangle list indices, must have room for the given number of indices, may be identical to "indices"
+		*  @param[out] resultError
+		*    If not a null pointer, receives the maximum relative error of all performed collapses
+		*
+		*  @return
+		*    The number of written indices, the simplified triangle list is referencing the given vertices
+		*/
+		static uint32_t simplify(const uint32_t* indices, uint32_t numberOfIndices, const uint8_t* vertices, uint32_t numberOfVertices, uint32_t numberOfBytesPerVertex, uint32_t targetNumberOfIndices, float targetError, float textureCoordinateWeight, uint32_t* destinationIndices, float* resultError = nullptr);
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		MeshSimplifier(const MeshSimplifier&) = delete;
+		MeshSimplifier& operator=(const MeshSimplifier&) = delete;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
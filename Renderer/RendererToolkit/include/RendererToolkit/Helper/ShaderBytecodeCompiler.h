@@ -0,0 +1,144 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <RendererRuntime/Resource/ShaderBlueprint/Cache/IShaderBytecodeCompiler.h>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+	class Context;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Offline GLSL to SPIR-V shader bytecode compiler for the OpenGL and the Vulkan renderer backend
+	*
+	*  @remarks
+	*    Uses glslang to compile GLSL into SPIR-V which is then encoded to SMOL-V, using the same settings as the OpenGL renderer backend (GLSL 4.10,
+	*    OpenGL client) respectively the Vulkan renderer backend (GLSL 4.50, Vulkan client) do. No renderer backend instance or GPU is required, so the
+	*    pipeline state object cache can be precompiled using a renderer runtime instance running with the null renderer.
+	*
+	*  @note
+	*    - The OpenGL renderer backend can only load SPIR-V shader bytecode if "GL_ARB_gl_spirv" is available, since all drivers exposing it also expose "GL_ARB_clip_control" the OpenGL target assumes a zero-to-one clip space depth range and an upper left origin
+	*    - As long as the OpenGL renderer backend keeps its "GL_ARB_gl_spirv"-support disabled, precompiled OpenGL pipeline state object caches are ignored at runtime
+	*/
+	class ShaderBytecodeCompiler final : public RendererRuntime::IShaderBytecodeCompiler
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return whether or not offline shader bytecode compilation for a given renderer backend is supported
+		*
+		*  @param[in] rendererBackendName
+		*    ASCII name of the renderer backend (for example "OpenGL"), must be valid
+		*
+		*  @return
+		*    "true" if offline shader bytecode compilation for the given renderer backend is supported, else "false"
+		*/
+		static bool isRendererBackendSupported(const char* rendererBackendName);
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] context
+		*    Renderer toolkit context used for logging, must stay valid as long as this instance exists
+		*  @param[in] rendererBackendName
+		*    ASCII name of the target renderer backend (for example "OpenGL"), must be supported, see "RendererToolkit::ShaderBytecodeCompiler::isRendererBackendSupported()"
+		*/
+		ShaderBytecodeCompiler(const Context& context, const char* rendererBackendName);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline virtual ~ShaderBytecodeCompiler() override
+		{
+			// Nothing here
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererRuntime::IShaderBytecodeCompiler methods ]
+	//[-------------------------------------------------------]
+	public:
+		virtual const char* getRendererName() const override;
+		virtual const char* getShaderLanguageName() const override;
+		virtual bool isZeroToOneClipZ() const override;
+		virtual bool isUpperLeftOrigin() const override;
+		virtual bool compileShaderSourceCode(RendererRuntime::ShaderType shaderType, const char* sourceCode, Renderer::ShaderBytecode& shaderBytecode) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit ShaderBytecodeCompiler(const ShaderBytecodeCompiler&) = delete;
+		ShaderBytecodeCompiler& operator=(const ShaderBytecodeCompiler&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		const Context& mContext;
+		bool		   mVulkan;	///< "true" if the target renderer backend is Vulkan, else "false" (OpenGL)
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
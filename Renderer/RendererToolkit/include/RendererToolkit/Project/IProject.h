@@ -108,6 +108,70 @@ namespace RendererToolkit
 		virtual void startupAssetMonitor(RendererRuntime::IRendererRuntime& rendererRuntime, const char* rendererTarget) = 0;
 		virtual void shutdownAssetMonitor() = 0;
 
+		/**
+		*  @brief
+		*    Return the number of compiler threads
+		*
+		*  @return
+		*    The number of compiler threads processing the asset compiler queue, by default the number of hardware threads
+		*/
+		virtual uint32_t getNumberOfCompilerThreads() const = 0;
+
+		/**
+		*  @brief
+		*    Set the number of compiler threads
+		*
+		*  @param[in] numberOfCompilerThreads
+		*    The number of compiler threads processing the asset compiler queue, at least one compiler thread is used
+		*
+		*  @note
+		*    - Must not be called while a compilation run is in progress
+		*/
+		virtual void setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads) = 0;
+
+		/**
+		*  @brief
+		*    Set the content cache directory
+		*
+		*  @param[in] absoluteDirectoryName
+		*    UTF-8 absolute directory name of the content cache, e.g. a directory shared by multiple machines via the network, empty string for the local default
+		*
+		*  @remarks
+		*    Compiled assets are stored inside the content cache by using a hash of everything influencing the compilation result as key. Renderer targets
+		*    sharing the same configuration as well as multiple machines compiling the same project can reuse compiled assets this way. By default the
+		*    content cache is located inside the local data directory of the renderer toolkit.
+		*
+		*  @note
+		*    - Must not be called while a compilation run is in progress
+		*/
+		virtual void setContentCacheDirectory(RendererRuntime::AbsoluteDirectoryName absoluteDirectoryName) = 0;
+
+		/**
+		*  @brief
+		*    Precompile the pipeline state object cache and write it into the output asset package
+		*
+		*  @param[in] rendererRuntime
+		*    Renderer runtime instance to use, the renderer backend of the renderer runtime instance compiles the shaders. If the renderer backend has no
+		*    shader bytecode support (e.g. the null renderer, no GPU required), the shaders are compiled offline for the OpenGL or Vulkan renderer backend
+		*    of the renderer target instead, see "RendererToolkit::ShaderBytecodeCompiler"
+		*  @param[in] rendererTarget
+		*    Renderer target the output asset package was compiled for
+		*  @param[in] allShaderCombinations
+		*    "false" to only precompile the recorded pipeline state signatures of the locally saved pipeline state object cache (a list of the pipeline
+		*    state signatures used at runtime), "true" to additionally precompile all shader combinations of all material blueprints of the project
+		*
+		*  @remarks
+		*    The pipeline state compiler of the renderer runtime builds and compiles the shaders using all CPU cores. The resulting pipeline state object
+		*    cache is written next to the output asset package, see "RendererRuntime::IRendererRuntime::saveShippedPipelineStateObjectCache()" for details.
+		*    The number of possible shader combinations grows exponentially with the number of shader combination properties, so the visual importance
+		*    of the material blueprint properties should be used to keep it manageable.
+		*
+		*  @note
+		*    - The output asset package must already have been compiled via "RendererToolkit::IProject::compileAllAssets()" and must be mounted by the renderer runtime instance
+		*    - Throws an exception if neither the renderer backend of the renderer runtime instance nor offline compilation supports shader bytecode for the renderer target
+		*/
+		virtual void compilePipelineStateObjectCache(RendererRuntime::IRendererRuntime& rendererRuntime, const char* rendererTarget, bool allShaderCombinations) = 0;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
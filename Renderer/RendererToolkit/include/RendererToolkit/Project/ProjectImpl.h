@@ -40,9 +40,11 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_Ptr_base<_Ty>': assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
 	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	#include <mutex>
 	#include <thread>
 	#include <atomic>	// For "std::atomic<>"
 	#include <unordered_set>
+	#include <condition_variable>
 PRAGMA_WARNING_POP
 
 
@@ -58,6 +60,7 @@ namespace RendererToolkit
 	class Context;
 	class CacheManager;
 	class ProjectAssetMonitor;
+	class AssetDependencyGraph;
 	class RendererToolkitImpl;
 }
 
@@ -76,6 +79,8 @@ namespace RendererToolkit
 	typedef std::unordered_map<uint32_t, uint32_t>	  CompiledAssetIdToSourceAssetId;	///< Key = compiled asset ID, value = source asset ID ("AssetId"-type not used directly or we would need to define a hash-function for it)
 	typedef std::unordered_map<uint32_t, std::string> SourceAssetIdToVirtualFilename;	///< Key = source asset ID, virtual asset filename
 	typedef std::unordered_set<uint32_t>			  DefaultTextureAssetIds;			///< "RendererRuntime::AssetId"-type for compiled asset IDs
+	typedef std::vector<uint32_t>					  CompiledAssetIds;					///< "RendererRuntime::AssetId"-type for compiled asset IDs
+	typedef std::vector<uint32_t>					  SourceAssetIds;					///< "RendererRuntime::AssetId"-type for source asset IDs
 
 
 	//[-------------------------------------------------------]
@@ -89,6 +94,13 @@ namespace RendererToolkit
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		typedef std::vector<std::string> VirtualFilenames;
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -113,18 +125,22 @@ namespace RendererToolkit
 		inline const std::string& getAbsoluteProjectDirectory() const;	// Has no "/" at the end
 		inline const RendererRuntime::AssetPackage& getAssetPackage() const;
 		RendererRuntime::VirtualFilename tryGetVirtualFilenameByAssetId(RendererRuntime::AssetId assetId) const;
-		bool checkAssetIsChanged(const RendererRuntime::Asset& asset, const char* rendererTarget);
-		void compileAsset(const RendererRuntime::Asset& asset, const char* rendererTarget, RendererRuntime::AssetPackage& outputAssetPackage);
-		void compileAssetIncludingDependencies(const RendererRuntime::Asset& asset, const char* rendererTarget, RendererRuntime::AssetPackage& outputAssetPackage) noexcept;
+		void compileAsset(const RendererRuntime::Asset& asset, const char* rendererTarget, RendererRuntime::AssetPackage& outputAssetPackage, SourceAssetIds& dependencySourceAssetIds);
 
 		/**
 		*  @brief
-		*    Inform project about compilation run finish
+		*    Compile the assets affected by the given changed files
 		*
-		*  @note
-		*    - Call this after a compilation run has been finish, this will clear any internal caches/states
+		*  @param[in] rendererTarget
+		*    Renderer target to compile the assets for
+		*  @param[in] changedVirtualFilenames
+		*    Virtual UTF-8 filenames of changed files, e.g. reported by a file watcher, asset files as well as source files
+		*
+		*  @remarks
+		*    Unlike "RendererToolkit::IProject::compileAllAssets()", the input files of the assets aren't checked for changes. The changed files
+		*    are mapped to assets using the asset dependency graph of the previous compilation run and only the transitive closure of those assets is compiled.
 		*/
-		void onCompilationRunFinished();
+		void compileChangedAssets(const char* rendererTarget, const VirtualFilenames& changedVirtualFilenames);
 
 
 	//[-------------------------------------------------------]
@@ -136,6 +152,10 @@ namespace RendererToolkit
 		virtual void importAssets(const AbsoluteFilenames& absoluteSourceFilenames, const std::string& targetAssetPackageName) override;
 		virtual void startupAssetMonitor(RendererRuntime::IRendererRuntime& rendererRuntime, const char* rendererTarget) override;
 		virtual void shutdownAssetMonitor() override;
+		virtual uint32_t getNumberOfCompilerThreads() const override;
+		virtual void setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads) override;
+		virtual void setContentCacheDirectory(RendererRuntime::AbsoluteDirectoryName absoluteDirectoryName) override;
+		virtual void compilePipelineStateObjectCache(RendererRuntime::IRendererRuntime& rendererRuntime, const char* rendererTarget, bool allShaderCombinations) override;
 
 
 	//[-------------------------------------------------------]
@@ -145,6 +165,31 @@ namespace RendererToolkit
 		virtual void selfDestruct() override;
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::unordered_map<uint32_t, IAssetCompiler*> AssetCompilers;
+		typedef std::vector<const RendererRuntime::Asset*>	  CompilerQueue;
+		typedef std::vector<std::thread>					  CompilerThreads;
+
+		/**
+		*  @brief
+		*    Compilation stages, assets of a stage only depend on assets of previous stages
+		*
+		*  @note
+		*    - The stages are processed one after another, the assets of a single stage are processed in parallel by the compiler threads
+		*/
+		enum CompilationStage
+		{
+			RESOURCE_STAGE = 0,				///< Textures, meshes, skeletons, shaders and vertex attributes
+			MATERIAL_BLUEPRINT_STAGE,		///< Material blueprints referencing shaders
+			MATERIAL_STAGE,					///< Materials referencing material blueprints and textures
+			SCENE_STAGE,					///< Scenes and compositors referencing meshes and materials
+			NUMBER_OF_COMPILATION_STAGES	///< Number of compilation stages
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -156,14 +201,64 @@ namespace RendererToolkit
 		void readTargetsByFilename(const std::string& relativeFilename);
 		std::string getRenderTargetDataRootDirectory(const char* rendererTarget) const;	// Directory name has no "/" at the end
 		void buildSourceAssetIdToCompiledAssetId();
-		void threadWorker();
+		void destroyCompilerThreads();
+		void setupContentCache();
 
+		/**
+		*  @brief
+		*    Compile the assets which need to be compiled and write the runtime asset package, if necessary
+		*
+		*  @param[in] rendererTarget
+		*    Renderer target to compile the assets for
+		*  @param[in] changedVirtualFilenames
+		*    Virtual UTF-8 filenames of changed files, if null pointer the input files of all assets are checked for changes
+		*/
+		void compileAssets(const char* rendererTarget, const VirtualFilenames* changedVirtualFilenames);
 
-	//[-------------------------------------------------------]
-	//[ Private definitions                                   ]
-	//[-------------------------------------------------------]
-	private:
-		typedef std::unordered_map<uint32_t, IAssetCompiler*> AssetCompilers;
+		/**
+		*  @brief
+		*    Let the compiler threads compile the given assets and wait until all of them have been compiled
+		*
+		*  @param[in] compilerQueue
+		*    Assets to compile, the assets must not depend on each other
+		*  @param[in] rendererTarget
+		*    Renderer target to compile the assets for
+		*  @param[in, out] assetDependencyGraph
+		*    Asset dependency graph receiving the input files, the dependencies and the output assets of the compiled assets
+		*
+		*  @note
+		*    - Throws an exception if compiling one of the assets failed, the remaining assets are not compiled in this case
+		*/
+		void processCompilerQueue(const CompilerQueue& compilerQueue, const char* rendererTarget, AssetDependencyGraph& assetDependencyGraph);
+
+		/**
+		*  @brief
+		*    Inform project about compilation run finish
+		*
+		*  @note
+		*    - Called by the thread coordinating the compilation run after the compiler threads are done, also if the compilation run failed
+		*    - Saves the renderer toolkit cache once, clears any internal caches/states and sets the renderer toolkit state to idle
+		*/
+		void onCompilationRunFinished();
+
+		/**
+		*  @brief
+		*    Return the number of base materials the given material asset derives from
+		*
+		*  @param[in] sourceAssetId
+		*    Source asset ID of the material asset
+		*  @param[in, out] baseMaterialDepths
+		*    Already known base material depths, key = source asset ID
+		*
+		*  @return
+		*    Number of base materials the material asset derives from, 0 if it has no base material
+		*
+		*  @note
+		*    - Throws an exception in case of a base material cycle
+		*/
+		uint32_t getBaseMaterialDepth(uint32_t sourceAssetId, std::unordered_map<uint32_t, uint32_t>& baseMaterialDepths) const;
+
+		void compilerThreadWorker();
 
 
 	//[-------------------------------------------------------]
@@ -177,16 +272,31 @@ namespace RendererToolkit
 		QualityStrategy					mQualityStrategy;
 		RendererRuntime::AssetPackage	mAssetPackage;
 		std::string						mAssetPackageDirectoryName;	///< UTF-8 asset package name, has no "/" at the end
+		VirtualFilenames				mVirtualProjectFilenames;	///< Virtual UTF-8 filenames of the project file and the targets file, all assets depend on them
 		SourceAssetIdToCompiledAssetId	mSourceAssetIdToCompiledAssetId;
 		CompiledAssetIdToSourceAssetId	mCompiledAssetIdToSourceAssetId;
 		SourceAssetIdToVirtualFilename	mSourceAssetIdToVirtualFilename;
 		DefaultTextureAssetIds			mDefaultTextureAssetIds;
+		CompiledAssetIds				mCompiledMaterialBlueprintAssetIds;	///< Compiled asset IDs of all material blueprint assets of the project, used for pipeline state object cache precompilation
 		rapidjson::Document*			mRapidJsonDocument;			///< There's no real benefit in trying to store the targets data in custom data structures, so we just stick to the read in JSON object
 		ProjectAssetMonitor*			mProjectAssetMonitor;
-		std::atomic<bool>				mShutdownThread;
-		std::thread						mThread;
 		CacheManager*					mCacheManager;				///< Cache manager, can be a null pointer, destroy the instance if no longer needed
-		AssetCompilers					mAssetCompilers;			///< List of asset compilers key "AssetCompilerTypeId" (type not used directly or we would need to define a hash-function for it)
+		std::string						mAbsoluteContentCacheDirectory;	///< UTF-8 content cache directory, has no "/" at the end, empty for the local default
+		AssetCompilers					mAssetCompilers;			///< List of asset compilers key "AssetCompilerTypeId" (type not used directly or we would need to define a hash-function for it), the asset compilers are stateless and shared by all compiler threads
+		CompilerQueue					mCompilationStages[NUMBER_OF_COMPILATION_STAGES];	///< Assets of the asset package sorted into compilation stages, the asset pointers point into "mAssetPackage"
+		// Compiler threads
+		uint32_t						mNumberOfCompilerThreads;
+		std::atomic<bool>				mShutdownCompilerThread;
+		std::mutex						mCompilerMutex;						///< Guards the compiler queue and the compiler results
+		std::condition_variable			mCompilerConditionVariable;			///< Wakes up the compiler threads as soon as there are assets inside the compiler queue
+		std::condition_variable			mCompilerFinishedConditionVariable;	///< Wakes up the thread waiting inside "RendererToolkit::ProjectImpl::processCompilerQueue()" as soon as the compiler threads have got results
+		CompilerThreads					mCompilerThreads;
+		CompilerQueue					mCompilerQueue;						///< Assets the compiler threads have to compile, processed from back to front
+		const char*						mCompilerRendererTarget;			///< Renderer target of the current compiler queue, can be a null pointer, don't destroy the instance
+		AssetDependencyGraph*			mCompilerAssetDependencyGraph;		///< Asset dependency graph of the current compiler queue, can be a null pointer, don't destroy the instance
+		uint32_t						mNumberOfCompilingAssets;			///< Number of assets currently compiled by the compiler threads
+		SourceAssetIds					mCompilerProcessedAssetIds;			///< Source asset IDs of assets which have been compiled successfully and not yet been consumed by "RendererToolkit::ProjectImpl::processCompilerQueue()"
+		std::string						mCompilerErrorMessage;				///< First error message of the current compiler queue, empty if there's no error
 
 
 	};
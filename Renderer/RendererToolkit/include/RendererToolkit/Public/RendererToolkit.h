@@ -105,6 +105,10 @@ namespace RendererToolkit
 		virtual void compileAllAssets(const char* rendererTarget) = 0;
 		virtual void startupAssetMonitor(RendererRuntime::IRendererRuntime& rendererRuntime, const char* rendererTarget) = 0;
 		virtual void shutdownAssetMonitor() = 0;
+		virtual uint32_t getNumberOfCompilerThreads() const = 0;
+		virtual void setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads) = 0;
+		virtual void setContentCacheDirectory(RendererRuntime::AbsoluteDirectoryName absoluteDirectoryName) = 0;
+		virtual void compilePipelineStateObjectCache(RendererRuntime::IRendererRuntime& rendererRuntime, const char* rendererTarget, bool allShaderCombinations) = 0;
 	protected:
 		IProject();
 		explicit IProject(const IProject& source) = delete;
@@ -99,9 +99,9 @@ namespace RendererToolkit
 		const std::string assetName = std_filesystem::path(input.virtualAssetFilename).stem().generic_string();
 		const std::string virtualOutputAssetFilename = input.virtualAssetOutputDirectory + '/' + assetName + ".compositor_workspace";
 
-		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there)
+		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there), if so try to restore the compiled file from the content cache
 		CacheManager::CacheEntries cacheEntries;
-		if (input.cacheManager.needsToBeCompiled(configuration.rendererTarget, input.virtualAssetFilename, virtualInputFilename, virtualOutputAssetFilename, RendererRuntime::v1CompositorWorkspace::FORMAT_VERSION, cacheEntries))
+		if (input.cacheManager.needsToBeCompiled(configuration.rendererTarget, input.virtualAssetFilename, virtualInputFilename, virtualOutputAssetFilename, RendererRuntime::v1CompositorWorkspace::FORMAT_VERSION, cacheEntries) && !input.cacheManager.tryRestoreFromContentCache(cacheEntries, input.dependencySourceAssetIds))
 		{
 			RendererRuntime::MemoryFile memoryFile(0, 4096);
 
@@ -193,9 +193,9 @@ namespace RendererToolkit
 		const std::string assetName = std_filesystem::path(input.virtualAssetFilename).stem().generic_string();
 		const std::string virtualOutputAssetFilename = input.virtualAssetOutputDirectory + '/' + assetName + ".material_blueprint";
 
-		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there)
+		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there), if so try to restore the compiled file from the content cache
 		CacheManager::CacheEntries cacheEntries;
-		if (input.cacheManager.needsToBeCompiled(configuration.rendererTarget, input.virtualAssetFilename, virtualInputFilename, virtualOutputAssetFilename, RendererRuntime::v1MaterialBlueprint::FORMAT_VERSION, cacheEntries))
+		if (input.cacheManager.needsToBeCompiled(configuration.rendererTarget, input.virtualAssetFilename, virtualInputFilename, virtualOutputAssetFilename, RendererRuntime::v1MaterialBlueprint::FORMAT_VERSION, cacheEntries) && !input.cacheManager.tryRestoreFromContentCache(cacheEntries, input.dependencySourceAssetIds))
 		{
 			RendererRuntime::MemoryFile memoryFile(0, 4096);
 
@@ -25,6 +25,8 @@
 #include "RendererToolkit/Helper/AssimpLogStream.h"
 #include "RendererToolkit/Helper/AssimpIOSystem.h"
 #include "RendererToolkit/Helper/AssimpHelper.h"
+#include "RendererToolkit/Helper/MeshOptimizer.h"
+#include "RendererToolkit/Helper/MeshSimplifier.h"
 #include "RendererToolkit/Helper/CacheManager.h"
 #include "RendererToolkit/Helper/StringHelper.h"
 #include "RendererToolkit/Helper/JsonHelper.h"
@@ -152,7 +154,13 @@ namespace
 		//[-------------------------------------------------------]
 		static const uint8_t NUMBER_OF_BYTES_PER_VERTEX = 28;										///< Number of bytes per vertex (3 float position, 2 float texture coordinate, 4 short QTangent)
 		static const uint8_t NUMBER_OF_BYTES_PER_SKINNED_VERTEX = NUMBER_OF_BYTES_PER_VERTEX + 8;	///< Number of bytes per skinned vertex (+4 byte bone indices, +4 byte bone weights)
+		static const uint8_t NUMBER_OF_BYTES_PER_QUANTIZED_VERTEX = 20;								///< Number of bytes per quantized vertex (4 short position, 2 short texture coordinate, 4 short QTangent)
+		static const uint8_t NUMBER_OF_BYTES_PER_QUANTIZED_SKINNED_VERTEX = NUMBER_OF_BYTES_PER_QUANTIZED_VERTEX + 8;	///< Number of bytes per quantized skinned vertex (+4 byte bone indices, +4 byte bone weights)
+		static const float	 QUANTIZATION_RANGE = 32767.0f;											///< Signed 16 bit quantization range, -32768 isn't used to keep the range symmetric
+		static const float	 DEFAULT_LOD_MAXIMUM_ERROR = 0.05f;										///< Default maximum relative LOD edge collapse error, see "RendererToolkit::MeshSimplifier::simplify()"
+		static const float	 LOD_TEXTURE_COORDINATE_WEIGHT = 1.0f;									///< Weight of the squared texture coordinate difference of a LOD edge collapse, see "RendererToolkit::MeshSimplifier::simplify()"
 		typedef std::vector<RendererRuntime::v1Mesh::SubMesh> SubMeshes;
+		typedef std::vector<float> LodMinimumScreenSizes;
 		typedef std::unordered_map<std::string, RendererRuntime::AssetId> MaterialNameToAssetId;
 
 
@@ -629,6 +637,378 @@ namespace
 			}
 		}
 
+		bool isPureTriangleList(const aiScene& assimpScene)
+		{
+			// Importing without the "TRIANGULATE"-flag might result in other primitive types
+			for (uint32_t i = 0; i < assimpScene.mNumMeshes; ++i)
+			{
+				if (aiPrimitiveType_TRIANGLE != assimpScene.mMeshes[i]->mPrimitiveTypes)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/**
+		*  @brief
+		*    Optional level of detail (LOD) generation
+		*
+		*  @param[in] input
+		*    Asset compiler input
+		*  @param[in] rapidJsonValueMeshAssetCompiler
+		*    Mesh asset compiler JSON value, the LODs are opt-in per asset
+		*  @param[in] assimpScene
+		*    Assimp scene the mesh data has been filled from
+		*  @param[in, out] subMeshes
+		*    Sub-meshes of LOD 0, receives the sub-meshes of the generated LODs, LOD-major
+		*  @param[in] numberOfBytesPerVertex
+		*    Number of bytes per vertex
+		*  @param[in] vertexBuffer
+		*    Vertex buffer, shared by all LODs
+		*  @param[in, out] indexBuffer
+		*    Index buffer, the indices of the generated LODs are appended, the index buffer is reallocated in this case
+		*  @param[in, out] numberOfIndices
+		*    Number of indices
+		*  @param[out] lodMinimumScreenSizes
+		*    Receives the per LOD minimum projected screen size, one entry per LOD
+		*
+		*  @remarks
+		*    Example for two generated LODs:
+		*    "Lods":
+		*    {
+		*        "1": { "ScreenSize": "0.4", "IndexRatio": "0.5" },
+		*        "2": { "ScreenSize": "0.15", "IndexRatio": "0.2", "MaximumError": "0.1" }
+		*    }
+		*    - "ScreenSize": Projected screen size (bounding sphere diameter in relation to the render target height) below which the LOD is used, must decrease from LOD to LOD
+		*    - "IndexRatio": Target number of indices in relation to LOD 0
+		*    - "MaximumError": Optional maximum collapse error relative to the mesh extent, the target number of indices might not be reached
+		*/
+		void generateLods(const RendererToolkit::IAssetCompiler::Input& input, const rapidjson::Value& rapidJsonValueMeshAssetCompiler, const aiScene& assimpScene, SubMeshes& subMeshes,
+						  uint8_t numberOfBytesPerVertex, const uint8_t* vertexBuffer, uint32_t*& indexBuffer, uint32_t& numberOfIndices, LodMinimumScreenSizes& lodMinimumScreenSizes)
+		{
+			// LOD 0 is used down to a screen size of zero unless there are further LODs
+			lodMinimumScreenSizes.assign(1, 0.0f);
+			if (!rapidJsonValueMeshAssetCompiler.HasMember("Lods"))
+			{
+				// Nothing to do in here
+				return;
+			}
+			if (!isPureTriangleList(assimpScene))
+			{
+				RENDERER_LOG(input.context, WARNING, "Mesh \"%s\" isn't a pure triangle list, the LOD generation is skipped", input.virtualAssetFilename.c_str())
+				return;
+			}
+
+			// Generate the LODs
+			// -> Each LOD is simplified from LOD 0, the LODs reference the vertex buffer of LOD 0 and only add indices
+			// -> Sub-meshes reference a consecutive vertex range, the indices are made relative to the start of the range so the simplifier doesn't need to know about all vertices
+			const rapidjson::Value& rapidJsonValueLods = rapidJsonValueMeshAssetCompiler["Lods"];
+			const size_t numberOfSubMeshesPerLod = subMeshes.size();
+			std::vector<uint32_t> lodIndices;
+			std::vector<uint32_t> subMeshIndices;
+			uint32_t lodIndex = 1;
+			for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIterator = rapidJsonValueLods.MemberBegin(); rapidJsonMemberIterator != rapidJsonValueLods.MemberEnd(); ++rapidJsonMemberIterator, ++lodIndex)
+			{
+				// Get and check the LOD settings
+				if (std::to_string(lodIndex) != rapidJsonMemberIterator->name.GetString())
+				{
+					throw std::runtime_error("Mesh LOD \"" + std::string(rapidJsonMemberIterator->name.GetString()) + "\" is out of order, the LODs must be numbered consecutively starting with 1");
+				}
+				if (lodIndex > std::numeric_limits<uint8_t>::max() - 1u)
+				{
+					throw std::runtime_error("The maximum number of supported mesh LODs is " + std::to_string(std::numeric_limits<uint8_t>::max()));
+				}
+				const rapidjson::Value& rapidJsonValueLod = rapidJsonMemberIterator->value;
+				float screenSize = 0.0f;
+				float indexRatio = 0.0f;
+				float maximumError = DEFAULT_LOD_MAXIMUM_ERROR;
+				RendererToolkit::JsonHelper::optionalFloatProperty(rapidJsonValueLod, "ScreenSize", screenSize);
+				RendererToolkit::JsonHelper::optionalFloatProperty(rapidJsonValueLod, "IndexRatio", indexRatio);
+				RendererToolkit::JsonHelper::optionalFloatProperty(rapidJsonValueLod, "MaximumError", maximumError);
+				if (screenSize <= 0.0f || (lodIndex > 1 && screenSize >= lodMinimumScreenSizes[lodIndex - 2]))
+				{
+					throw std::runtime_error("Mesh LOD " + std::to_string(lodIndex) + " needs a positive screen size which is smaller as the screen size of the previous LOD");
+				}
+				if (indexRatio <= 0.0f || indexRatio > 1.0f)
+				{
+					throw std::runtime_error("Mesh LOD " + std::to_string(lodIndex) + " needs an index ratio within ]0, 1]");
+				}
+				lodMinimumScreenSizes.back() = screenSize;
+				lodMinimumScreenSizes.push_back(0.0f);
+
+				// Simplify each sub-mesh of LOD 0
+				uint32_t numberOfLodIndices = 0;
+				float lodError = 0.0f;
+				for (size_t subMeshIndex = 0; subMeshIndex < numberOfSubMeshesPerLod; ++subMeshIndex)
+				{
+					RendererRuntime::v1Mesh::SubMesh subMesh = subMeshes[subMeshIndex];
+					if (0 != subMesh.numberOfIndices)
+					{
+						const uint32_t* lod0SubMeshIndices = indexBuffer + subMesh.startIndexLocation;
+						const std::pair<const uint32_t*, const uint32_t*> minimumMaximumIndex = std::minmax_element(lod0SubMeshIndices, lod0SubMeshIndices + subMesh.numberOfIndices);
+						const uint32_t startVertex = *minimumMaximumIndex.first;
+						const uint32_t numberOfSubMeshVertices = *minimumMaximumIndex.second - startVertex + 1;
+						subMeshIndices.resize(subMesh.numberOfIndices);
+						for (uint32_t i = 0; i < subMesh.numberOfIndices; ++i)
+						{
+							subMeshIndices[i] = lod0SubMeshIndices[i] - startVertex;
+						}
+						const uint32_t targetNumberOfIndices = static_cast<uint32_t>(static_cast<float>(subMesh.numberOfIndices / 3) * indexRatio) * 3;
+						float subMeshError = 0.0f;
+						const uint32_t numberOfSubMeshIndices = RendererToolkit::MeshSimplifier::simplify(subMeshIndices.data(), subMesh.numberOfIndices, vertexBuffer + startVertex * numberOfBytesPerVertex, numberOfSubMeshVertices, numberOfBytesPerVertex, targetNumberOfIndices, maximumError, LOD_TEXTURE_COORDINATE_WEIGHT, subMeshIndices.data(), &subMeshError);
+						if (numberOfSubMeshIndices > 0)
+						{
+							subMesh.startIndexLocation = numberOfIndices + static_cast<uint32_t>(lodIndices.size());
+							subMesh.numberOfIndices = numberOfSubMeshIndices;
+							for (uint32_t i = 0; i < numberOfSubMeshIndices; ++i)
+							{
+								lodIndices.push_back(subMeshIndices[i] + startVertex);
+							}
+							lodError = std::max(lodError, subMeshError);
+						}
+						else
+						{
+							// Never let a sub-mesh vanish, reuse the indices of the previous LOD instead
+							subMesh = subMeshes[subMeshes.size() - numberOfSubMeshesPerLod];
+						}
+					}
+					subMeshes.push_back(subMesh);
+					numberOfLodIndices += subMesh.numberOfIndices;
+				}
+				RENDERER_LOG(input.context, INFORMATION, "Mesh \"%s\" LOD %u: %u of %u triangles, maximum relative error %.4f", input.virtualAssetFilename.c_str(), lodIndex, numberOfLodIndices / 3, numberOfIndices / 3, static_cast<double>(lodError))
+			}
+			if (lodIndices.empty())
+			{
+				// All LODs reuse the indices of LOD 0
+				return;
+			}
+
+			// Append the LOD indices to the index buffer
+			uint32_t* newIndexBuffer = new uint32_t[numberOfIndices + lodIndices.size()];
+			memcpy(newIndexBuffer, indexBuffer, sizeof(uint32_t) * numberOfIndices);
+			memcpy(newIndexBuffer + numberOfIndices, lodIndices.data(), sizeof(uint32_t) * lodIndices.size());
+			delete [] indexBuffer;
+			indexBuffer = newIndexBuffer;
+			numberOfIndices += static_cast<uint32_t>(lodIndices.size());
+		}
+
+		/**
+		*  @brief
+		*    Optimize the mesh data for the post-transform vertex cache, for less overdraw and for vertex fetch locality, see "RendererToolkit::MeshOptimizer" for details
+		*
+		*  @param[in] input
+		*    Asset compiler input
+		*  @param[in] rapidJsonValueMeshAssetCompiler
+		*    Mesh asset compiler JSON value, the optimizations are opt-in per asset
+		*  @param[in] assimpScene
+		*    Assimp scene the mesh data has been filled from
+		*  @param[in] subMeshes
+		*    Sub-meshes, each sub-mesh is optimized on its own
+		*  @param[in] numberOfBytesPerVertex
+		*    Number of bytes per vertex
+		*  @param[in, out] vertexBuffer
+		*    Vertex buffer to optimize
+		*  @param[in] numberOfVertices
+		*    Number of vertices
+		*  @param[in, out] indexBuffer
+		*    Index buffer to optimize
+		*  @param[in] numberOfIndices
+		*    Number of indices
+		*/
+		void optimizeMesh(const RendererToolkit::IAssetCompiler::Input& input, const rapidjson::Value& rapidJsonValueMeshAssetCompiler, const aiScene& assimpScene, const SubMeshes& subMeshes,
+						  uint8_t numberOfBytesPerVertex, uint8_t* vertexBuffer, uint32_t numberOfVertices, uint32_t* indexBuffer, uint32_t numberOfIndices)
+		{
+			// Get the optional optimization settings, all optimizations are disabled by default
+			bool optimizeVertexCache = false;
+			bool optimizeOverdraw = false;
+			float overdrawThreshold = 1.05f;
+			bool optimizeVertexFetch = false;
+			RendererToolkit::JsonHelper::optionalBooleanProperty(rapidJsonValueMeshAssetCompiler, "OptimizeVertexCache", optimizeVertexCache);
+			RendererToolkit::JsonHelper::optionalBooleanProperty(rapidJsonValueMeshAssetCompiler, "OptimizeOverdraw", optimizeOverdraw);
+			RendererToolkit::JsonHelper::optionalFloatProperty(rapidJsonValueMeshAssetCompiler, "OverdrawThreshold", overdrawThreshold);
+			RendererToolkit::JsonHelper::optionalBooleanProperty(rapidJsonValueMeshAssetCompiler, "OptimizeVertexFetch", optimizeVertexFetch);
+			if (!optimizeVertexCache && !optimizeOverdraw && !optimizeVertexFetch)
+			{
+				// Nothing to do in here
+				return;
+			}
+			if (overdrawThreshold < 1.0f)
+			{
+				throw std::runtime_error("The mesh overdraw threshold must be at least 1.0");
+			}
+
+			// The optimizations work on triangle lists only
+			if (!isPureTriangleList(assimpScene))
+			{
+				RENDERER_LOG(input.context, WARNING, "Mesh \"%s\" isn't a pure triangle list, the mesh optimization is skipped", input.virtualAssetFilename.c_str())
+				return;
+			}
+
+			// Optimize the triangle order of each sub-mesh
+			// -> Sub-meshes reference a consecutive vertex range, the indices are made relative to the start of the range so the optimizer doesn't need to know about all vertices
+			RendererToolkit::MeshOptimizer::VertexCacheStatistics originalVertexCacheStatistics = {};
+			RendererToolkit::MeshOptimizer::VertexCacheStatistics optimizedVertexCacheStatistics = {};
+			for (const RendererRuntime::v1Mesh::SubMesh& subMesh : subMeshes)
+			{
+				uint32_t* subMeshIndices = indexBuffer + subMesh.startIndexLocation;
+				const uint32_t numberOfSubMeshIndices = subMesh.numberOfIndices;
+				if (0 == numberOfSubMeshIndices)
+				{
+					continue;
+				}
+				const std::pair<uint32_t*, uint32_t*> minimumMaximumIndex = std::minmax_element(subMeshIndices, subMeshIndices + numberOfSubMeshIndices);
+				const uint32_t startVertex = *minimumMaximumIndex.first;
+				const uint32_t numberOfSubMeshVertices = *minimumMaximumIndex.second - startVertex + 1;
+				for (uint32_t i = 0; i < numberOfSubMeshIndices; ++i)
+				{
+					subMeshIndices[i] -= startVertex;
+				}
+				RendererToolkit::MeshOptimizer::analyzeVertexCache(subMeshIndices, numberOfSubMeshIndices, numberOfSubMeshVertices, originalVertexCacheStatistics);
+				if (optimizeVertexCache)
+				{
+					RendererToolkit::MeshOptimizer::optimizeVertexCache(subMeshIndices, numberOfSubMeshIndices, numberOfSubMeshVertices);
+				}
+				if (optimizeOverdraw)
+				{
+					RendererToolkit::MeshOptimizer::optimizeOverdraw(subMeshIndices, numberOfSubMeshIndices, vertexBuffer + startVertex * numberOfBytesPerVertex, numberOfSubMeshVertices, numberOfBytesPerVertex, overdrawThreshold);
+				}
+				RendererToolkit::MeshOptimizer::analyzeVertexCache(subMeshIndices, numberOfSubMeshIndices, numberOfSubMeshVertices, optimizedVertexCacheStatistics);
+				for (uint32_t i = 0; i < numberOfSubMeshIndices; ++i)
+				{
+					subMeshIndices[i] += startVertex;
+				}
+			}
+
+			// Optimize the vertex order of the whole vertex buffer, the sub-meshes share a single vertex buffer
+			if (optimizeVertexFetch)
+			{
+				RendererToolkit::MeshOptimizer::optimizeVertexFetch(vertexBuffer, numberOfVertices, numberOfBytesPerVertex, indexBuffer, numberOfIndices);
+			}
+
+			// Report, the vertex fetch optimization doesn't influence the post-transform vertex cache statistics
+			RENDERER_LOG(input.context, INFORMATION, "Mesh \"%s\" with %u triangles: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f (simulated FIFO vertex cache with %u entries)", input.virtualAssetFilename.c_str(), originalVertexCacheStatistics.numberOfTriangles,
+						 static_cast<double>(originalVertexCacheStatistics.getAverageCacheMissRatio()), static_cast<double>(optimizedVertexCacheStatistics.getAverageCacheMissRatio()),
+						 static_cast<double>(originalVertexCacheStatistics.getAverageTransformedVertexRatio()), static_cast<double>(optimizedVertexCacheStatistics.getAverageTransformedVertexRatio()),
+						 RendererToolkit::MeshOptimizer::VERTEX_CACHE_SIZE)
+		}
+
+		inline int16_t quantize(float value, float bias, float inverseScale)
+		{
+			return static_cast<int16_t>(glm::clamp(std::round((value - bias) * inverseScale), -QUANTIZATION_RANGE, QUANTIZATION_RANGE));
+		}
+
+		/**
+		*  @brief
+		*    Quantize the 32 bit position and texture coordinate of the vertices to 16 bit, see "RendererRuntime::MeshResource::QUANTIZED_VERTEX_ATTRIBUTES"
+		*
+		*  @param[in] input
+		*    Asset compiler input
+		*  @param[in] rapidJsonValueMeshAssetCompiler
+		*    Mesh asset compiler JSON value, the vertex quantization is opt-in per asset
+		*  @param[in] skinned
+		*    "true" if the vertices have bone indices and bone weights, else "false"
+		*  @param[in, out] numberOfBytesPerVertex
+		*    Number of bytes per vertex, receives the number of bytes per quantized vertex
+		*  @param[in, out] vertexBuffer
+		*    Vertex buffer to quantize, is replaced by the quantized vertex buffer
+		*  @param[in] numberOfVertices
+		*    Number of vertices
+		*  @param[in] minimumBoundingBoxPosition
+		*    Minimum bounding box position, the position is quantized to the bounding box
+		*  @param[in] maximumBoundingBoxPosition
+		*    Maximum bounding box position, the position is quantized to the bounding box
+		*  @param[out] meshHeader
+		*    Receives the vertex dequantization
+		*
+		*  @return
+		*    "true" if the vertices have been quantized, else "false"
+		*
+		*  @note
+		*    - Must be done after all other vertex buffer processing since the LOD generation and the mesh optimization are working with the 32 bit position and texture coordinate
+		*/
+		bool quantizeVertices(const RendererToolkit::IAssetCompiler::Input& input, const rapidjson::Value& rapidJsonValueMeshAssetCompiler, bool skinned, uint8_t& numberOfBytesPerVertex, uint8_t*& vertexBuffer, uint32_t numberOfVertices,
+							  const glm::vec3& minimumBoundingBoxPosition, const glm::vec3& maximumBoundingBoxPosition, RendererRuntime::v1Mesh::MeshHeader& meshHeader)
+		{
+			// Get the optional vertex quantization setting, disabled by default
+			bool vertexQuantization = false;
+			RendererToolkit::JsonHelper::optionalBooleanProperty(rapidJsonValueMeshAssetCompiler, "QuantizeVertices", vertexQuantization);
+			meshHeader.quantizedVertices = vertexQuantization && (0 != numberOfVertices);
+			if (!meshHeader.quantizedVertices)
+			{
+				// Nothing to do in here
+				meshHeader.positionDequantizationScale			= glm::vec3(1.0f);
+				meshHeader.positionDequantizationBias			= glm::vec3(0.0f);
+				meshHeader.textureCoordinateDequantizationScale = glm::vec2(1.0f);
+				meshHeader.textureCoordinateDequantizationBias  = glm::vec2(0.0f);
+				return false;
+			}
+
+			// Gather the texture coordinate bounds
+			glm::vec2 minimumTextureCoordinate(std::numeric_limits<float>::max());
+			glm::vec2 maximumTextureCoordinate(std::numeric_limits<float>::lowest());
+			for (uint32_t i = 0; i < numberOfVertices; ++i)
+			{
+				const float* textureCoordinate = reinterpret_cast<const float*>(vertexBuffer + i * numberOfBytesPerVertex + sizeof(float) * 3);
+				minimumTextureCoordinate = glm::min(minimumTextureCoordinate, glm::vec2(textureCoordinate[0], textureCoordinate[1]));
+				maximumTextureCoordinate = glm::max(maximumTextureCoordinate, glm::vec2(textureCoordinate[0], textureCoordinate[1]));
+			}
+
+			// Calculate the vertex dequantization: The position is quantized to the bounding box and the texture coordinate to the texture coordinate bounds, dequantized value = quantized value * scale + bias
+			meshHeader.positionDequantizationScale			= (maximumBoundingBoxPosition - minimumBoundingBoxPosition) * 0.5f / QUANTIZATION_RANGE;
+			meshHeader.positionDequantizationBias			= (minimumBoundingBoxPosition + maximumBoundingBoxPosition) * 0.5f;
+			meshHeader.textureCoordinateDequantizationScale = (maximumTextureCoordinate - minimumTextureCoordinate) * 0.5f / QUANTIZATION_RANGE;
+			meshHeader.textureCoordinateDequantizationBias  = (minimumTextureCoordinate + maximumTextureCoordinate) * 0.5f;
+			const glm::vec3 positionInverseScale(
+				(meshHeader.positionDequantizationScale.x > 0.0f) ? (1.0f / meshHeader.positionDequantizationScale.x) : 0.0f,
+				(meshHeader.positionDequantizationScale.y > 0.0f) ? (1.0f / meshHeader.positionDequantizationScale.y) : 0.0f,
+				(meshHeader.positionDequantizationScale.z > 0.0f) ? (1.0f / meshHeader.positionDequantizationScale.z) : 0.0f);
+			const glm::vec2 textureCoordinateInverseScale(
+				(meshHeader.textureCoordinateDequantizationScale.x > 0.0f) ? (1.0f / meshHeader.textureCoordinateDequantizationScale.x) : 0.0f,
+				(meshHeader.textureCoordinateDequantizationScale.y > 0.0f) ? (1.0f / meshHeader.textureCoordinateDequantizationScale.y) : 0.0f);
+
+			// Fill the quantized vertex buffer
+			const uint8_t numberOfBytesPerQuantizedVertex = skinned ? NUMBER_OF_BYTES_PER_QUANTIZED_SKINNED_VERTEX : NUMBER_OF_BYTES_PER_QUANTIZED_VERTEX;
+			uint8_t* quantizedVertexBuffer = new uint8_t[numberOfBytesPerQuantizedVertex * numberOfVertices];
+			for (uint32_t i = 0; i < numberOfVertices; ++i)
+			{
+				const uint8_t* vertex = vertexBuffer + i * numberOfBytesPerVertex;
+				uint8_t* quantizedVertex = quantizedVertexBuffer + i * numberOfBytesPerQuantizedVertex;
+
+				{ // 16 bit position, w is unused
+					const float* position = reinterpret_cast<const float*>(vertex);
+					int16_t* quantizedPosition = reinterpret_cast<int16_t*>(quantizedVertex);
+					quantizedPosition[0] = quantize(position[0], meshHeader.positionDequantizationBias.x, positionInverseScale.x);
+					quantizedPosition[1] = quantize(position[1], meshHeader.positionDequantizationBias.y, positionInverseScale.y);
+					quantizedPosition[2] = quantize(position[2], meshHeader.positionDequantizationBias.z, positionInverseScale.z);
+					quantizedPosition[3] = 0;
+				}
+
+				{ // 16 bit texture coordinate
+					const float* textureCoordinate = reinterpret_cast<const float*>(vertex + sizeof(float) * 3);
+					int16_t* quantizedTextureCoordinate = reinterpret_cast<int16_t*>(quantizedVertex + sizeof(int16_t) * 4);
+					quantizedTextureCoordinate[0] = quantize(textureCoordinate[0], meshHeader.textureCoordinateDequantizationBias.x, textureCoordinateInverseScale.x);
+					quantizedTextureCoordinate[1] = quantize(textureCoordinate[1], meshHeader.textureCoordinateDequantizationBias.y, textureCoordinateInverseScale.y);
+				}
+
+				// 16 bit QTangent and the optional 8 bit bone indices and 8 bit bone weights are just copied over
+				memcpy(quantizedVertex + sizeof(int16_t) * 6, vertex + sizeof(float) * 5, static_cast<size_t>(numberOfBytesPerVertex - sizeof(float) * 5));
+			}
+
+			// Tell the user about the savings
+			RENDERER_LOG(input.context, INFORMATION, "Mesh \"%s\" vertex quantization: %u -> %u bytes per vertex, vertex buffer %u -> %u bytes, maximum position error (%.6f, %.6f, %.6f)", input.virtualAssetFilename.c_str(),
+						 numberOfBytesPerVertex, numberOfBytesPerQuantizedVertex, numberOfBytesPerVertex * numberOfVertices, numberOfBytesPerQuantizedVertex * numberOfVertices,
+						 static_cast<double>(meshHeader.positionDequantizationScale.x * 0.5f), static_cast<double>(meshHeader.positionDequantizationScale.y * 0.5f), static_cast<double>(meshHeader.positionDequantizationScale.z * 0.5f))
+
+			// Replace the vertex buffer
+			delete [] vertexBuffer;
+			vertexBuffer = quantizedVertexBuffer;
+			numberOfBytesPerVertex = numberOfBytesPerQuantizedVertex;
+
+			// Done
+			return true;
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -689,9 +1069,9 @@ namespace RendererToolkit
 		const std::string assetName = std_filesystem::path(input.virtualAssetFilename).stem().generic_string();
 		const std::string virtualOutputAssetFilename = input.virtualAssetOutputDirectory + '/' + assetName + ".mesh";
 
-		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there)
+		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there), if so try to restore the compiled file from the content cache
 		CacheManager::CacheEntries cacheEntries;
-		if (input.cacheManager.needsToBeCompiled(configuration.rendererTarget, input.virtualAssetFilename, virtualInputFilename, virtualOutputAssetFilename, RendererRuntime::v1Mesh::FORMAT_VERSION, cacheEntries))
+		if (input.cacheManager.needsToBeCompiled(configuration.rendererTarget, input.virtualAssetFilename, virtualInputFilename, virtualOutputAssetFilename, RendererRuntime::v1Mesh::FORMAT_VERSION, cacheEntries) && !input.cacheManager.tryRestoreFromContentCache(cacheEntries, input.dependencySourceAssetIds))
 		{
 			RendererRuntime::MemoryFile memoryFile(0, 42 * 1024);
 
@@ -762,8 +1142,8 @@ namespace RendererToolkit
 				const Renderer::IndexBufferFormat::Enum indexBufferFormat = (numberOfVertices > std::numeric_limits<uint16_t>::max()) ? Renderer::IndexBufferFormat::UNSIGNED_INT : Renderer::IndexBufferFormat::UNSIGNED_SHORT;
 
 				// Is there an optional skeleton?
-				const Renderer::VertexAttributes& vertexAttributes = (numberOfBones > 0) ? RendererRuntime::MeshResource::SKINNED_VERTEX_ATTRIBUTES : RendererRuntime::MeshResource::VERTEX_ATTRIBUTES;
-				const uint8_t numberOfBytesPerVertex = (numberOfBones > 0) ? ::detail::NUMBER_OF_BYTES_PER_SKINNED_VERTEX : ::detail::NUMBER_OF_BYTES_PER_VERTEX;
+				const Renderer::VertexAttributes* vertexAttributes = (numberOfBones > 0) ? &RendererRuntime::MeshResource::SKINNED_VERTEX_ATTRIBUTES : &RendererRuntime::MeshResource::VERTEX_ATTRIBUTES;
+				uint8_t numberOfBytesPerVertex = (numberOfBones > 0) ? ::detail::NUMBER_OF_BYTES_PER_SKINNED_VERTEX : ::detail::NUMBER_OF_BYTES_PER_VERTEX;
 
 				// Allocate memory for the local vertex and index buffer data
 				// -> Do also initialize the vertex buffer data with zero to handle not filled vertex bone weights
@@ -784,9 +1164,22 @@ namespace RendererToolkit
 					}
 				}
 
-				{ // Write down the mesh header
-					RendererRuntime::v1Mesh::MeshHeader meshHeader;
+				// Optional LOD generation, done before the optimization so the LODs get optimized as well
+				::detail::LodMinimumScreenSizes lodMinimumScreenSizes;
+				const uint32_t numberOfSubMeshesPerLod = static_cast<uint32_t>(subMeshes.size());
+				::detail::generateLods(input, rapidJsonValueMeshAssetCompiler, *assimpScene, subMeshes, numberOfBytesPerVertex, vertexBufferData, indexBufferData, numberOfIndices, lodMinimumScreenSizes);
 
+				// Optional mesh optimization
+				::detail::optimizeMesh(input, rapidJsonValueMeshAssetCompiler, *assimpScene, subMeshes, numberOfBytesPerVertex, vertexBufferData, numberOfVertices, indexBufferData, numberOfIndices);
+
+				// Optional vertex quantization, done after everything else which works with the 32 bit position and texture coordinate
+				RendererRuntime::v1Mesh::MeshHeader meshHeader;
+				if (::detail::quantizeVertices(input, rapidJsonValueMeshAssetCompiler, (numberOfBones > 0), numberOfBytesPerVertex, vertexBufferData, numberOfVertices, minimumBoundingBoxPosition, maximumBoundingBoxPosition, meshHeader))
+				{
+					vertexAttributes = (numberOfBones > 0) ? &RendererRuntime::MeshResource::QUANTIZED_SKINNED_VERTEX_ATTRIBUTES : &RendererRuntime::MeshResource::QUANTIZED_VERTEX_ATTRIBUTES;
+				}
+
+				{ // Write down the mesh header
 					// Bounding
 					// -> Calculate the bounding sphere radius enclosing the bounding box (don't use the inner bounding box radius)
 					meshHeader.minimumBoundingBoxPosition = minimumBoundingBoxPosition;
@@ -799,10 +1192,13 @@ namespace RendererToolkit
 					meshHeader.numberOfVertices			= numberOfVertices;
 					meshHeader.indexBufferFormat		= static_cast<uint8_t>(indexBufferFormat);
 					meshHeader.numberOfIndices			= numberOfIndices;
-					meshHeader.numberOfVertexAttributes = static_cast<uint8_t>(vertexAttributes.numberOfAttributes);
+					meshHeader.numberOfVertexAttributes = static_cast<uint8_t>(vertexAttributes->numberOfAttributes);
 
 					// Sub-meshes
-					meshHeader.numberOfSubMeshes = static_cast<uint16_t>(subMeshes.size());
+					meshHeader.numberOfSubMeshes = static_cast<uint16_t>(numberOfSubMeshesPerLod);
+
+					// Level of detail (LOD)
+					meshHeader.numberOfLods = static_cast<uint8_t>(lodMinimumScreenSizes.size());
 
 					// Optional skeleton
 					meshHeader.numberOfBones = skeleton.numberOfBones;
@@ -835,11 +1231,14 @@ namespace RendererToolkit
 				delete [] indexBufferData;
 
 				// Write down the vertex array attributes
-				memoryFile.write(vertexAttributes.attributes, sizeof(Renderer::VertexAttribute) * vertexAttributes.numberOfAttributes);
+				memoryFile.write(vertexAttributes->attributes, sizeof(Renderer::VertexAttribute) * vertexAttributes->numberOfAttributes);
 
-				// Write down the sub-meshes
+				// Write down the sub-meshes of all LODs
 				memoryFile.write(subMeshes.data(), sizeof(RendererRuntime::v1Mesh::SubMesh) * subMeshes.size());
 
+				// Write down the LOD minimum screen sizes
+				memoryFile.write(lodMinimumScreenSizes.data(), sizeof(float) * lodMinimumScreenSizes.size());
+
 				// Write down the optional skeleton
 				if (skeleton.numberOfBones > 0)
 				{
@@ -55,6 +55,8 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
 	#include <rapidjson/document.h>
+
+	#include <map>
 PRAGMA_WARNING_POP
 
 
@@ -67,6 +69,19 @@ namespace
 	{
 
 
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		struct InstanceGroup final
+		{
+			RendererRuntime::SceneItemTypeId		 typeId;
+			RendererRuntime::MemoryFile::ByteVector	 itemData;		///< Scene item data shared by all instances
+			std::vector<RendererRuntime::Transform> transforms;	///< Transform of each instance scene node
+		};
+		typedef std::vector<InstanceGroup> InstanceGroups;
+		typedef std::map<RendererRuntime::MemoryFile::ByteVector, size_t> InstanceGroupIndexBySceneItemData;	///< Key = scene item data, value = index inside the instance groups
+
+
 		//[-------------------------------------------------------]
 		//[ Functions                                             ]
 		//[-------------------------------------------------------]
@@ -164,6 +179,171 @@ namespace
 			}
 		}
 
+		void writeSceneItemData(const RendererToolkit::IAssetCompiler::Input& input, const char* typeName, const rapidjson::Value& rapidJsonValueItem, RendererRuntime::MemoryFile& memoryFile)
+		{
+			// TODO(co) Make this more generic via scene factory
+			const RendererRuntime::SceneItemTypeId typeId = RendererRuntime::StringId(typeName);
+
+			if (RendererRuntime::CameraSceneItem::TYPE_ID == typeId)
+			{
+				// Nothing here
+			}
+			else if (RendererRuntime::LightSceneItem::TYPE_ID == typeId)
+			{
+				RendererRuntime::v1Scene::LightItem lightItem;
+
+				// Read properties
+				optionalLightTypeProperty(rapidJsonValueItem, "LightType", lightItem.lightType);
+				RendererToolkit::JsonHelper::optionalRgbColorProperty(rapidJsonValueItem, "Color", lightItem.color);
+				RendererToolkit::JsonHelper::optionalUnitNProperty(rapidJsonValueItem, "Radius", &lightItem.radius, 1);
+				RendererToolkit::JsonHelper::optionalAngleProperty(rapidJsonValueItem, "InnerAngle", lightItem.innerAngle);
+				RendererToolkit::JsonHelper::optionalAngleProperty(rapidJsonValueItem, "OuterAngle", lightItem.outerAngle);
+				RendererToolkit::JsonHelper::optionalUnitNProperty(rapidJsonValueItem, "NearClipDistance", &lightItem.nearClipDistance, 1);
+
+				// Sanity checks
+				if (lightItem.color[0] < 0.0f || lightItem.color[1] < 0.0f || lightItem.color[2] < 0.0f)
+				{
+					throw std::runtime_error("All light item color components must be positive");
+				}
+				if (lightItem.lightType != RendererRuntime::LightSceneItem::LightType::DIRECTIONAL && lightItem.radius <= 0.0f)
+				{
+					throw std::runtime_error("For point or spot light items the radius must be greater as zero");
+				}
+				if (lightItem.lightType == RendererRuntime::LightSceneItem::LightType::DIRECTIONAL && lightItem.radius != 0.0f)
+				{
+					throw std::runtime_error("For directional light items the radius must be zero");
+				}
+				if (lightItem.innerAngle < 0.0f)
+				{
+					throw std::runtime_error("The inner spot light angle must be >= 0 degrees");
+				}
+				if (lightItem.outerAngle >= glm::radians(90.0f))
+				{
+					throw std::runtime_error("The outer spot light angle must be < 90 degrees");
+				}
+				if (lightItem.innerAngle >= lightItem.outerAngle)
+				{
+					throw std::runtime_error("The inner spot light angle must be smaller as the outer spot light angle");
+				}
+				if (lightItem.nearClipDistance < 0.0f)
+				{
+					throw std::runtime_error("The spot light near clip distance must be greater as zero");
+				}
+
+				// Write down
+				memoryFile.write(&lightItem, sizeof(RendererRuntime::v1Scene::LightItem));
+			}
+			else if (RendererRuntime::SunlightSceneItem::TYPE_ID == typeId)
+			{
+				RendererRuntime::v1Scene::SunlightItem sunlightItem;
+
+				// Read properties
+				RendererToolkit::JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "SunriseTime", sunlightItem.sunriseTime);
+				RendererToolkit::JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "SunsetTime", sunlightItem.sunsetTime);
+				RendererToolkit::JsonHelper::optionalAngleProperty(rapidJsonValueItem, "EastDirection", sunlightItem.eastDirection);
+				RendererToolkit::JsonHelper::optionalAngleProperty(rapidJsonValueItem, "AngleOfIncidence", sunlightItem.angleOfIncidence);
+				RendererToolkit::JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "TimeOfDay", sunlightItem.timeOfDay);
+
+				// Write down
+				memoryFile.write(&sunlightItem, sizeof(RendererRuntime::v1Scene::SunlightItem));
+			}
+			else if (RendererRuntime::MeshSceneItem::TYPE_ID == typeId || RendererRuntime::SkeletonMeshSceneItem::TYPE_ID == typeId)
+			{
+				// Skeleton mesh scene item
+				if (RendererRuntime::SkeletonMeshSceneItem::TYPE_ID == typeId)
+				{
+					RendererRuntime::v1Scene::SkeletonMeshItem skeletonMeshItem;
+
+					// Optional skeleton animation: Map the source asset ID to the compiled asset ID
+					skeletonMeshItem.skeletonAnimationAssetId = RendererRuntime::getUninitialized<RendererRuntime::AssetId>();
+					RendererToolkit::JsonHelper::optionalCompiledAssetId(input, rapidJsonValueItem, "SkeletonAnimation", skeletonMeshItem.skeletonAnimationAssetId);
+
+					// Write down
+					memoryFile.write(&skeletonMeshItem, sizeof(RendererRuntime::v1Scene::SkeletonMeshItem));
+				}
+
+				// Mesh scene item
+				RendererRuntime::v1Scene::MeshItem meshItem;
+
+				// Map the source asset ID to the compiled asset ID
+				meshItem.meshAssetId = RendererToolkit::JsonHelper::getCompiledAssetId(input, rapidJsonValueItem, "Mesh");
+
+				// Optional sub-mesh material asset IDs to be able to overwrite the original material asset ID of sub-meshes
+				std::vector<RendererRuntime::AssetId> subMeshMaterialAssetIds;
+				if (rapidJsonValueItem.HasMember("SubMeshMaterials"))
+				{
+					const rapidjson::Value& rapidJsonValueSubMeshMaterialAssetIds = rapidJsonValueItem["SubMeshMaterials"];
+					const uint32_t numberOfSubMeshMaterialAssetIds = rapidJsonValueSubMeshMaterialAssetIds.Size();
+					subMeshMaterialAssetIds.resize(numberOfSubMeshMaterialAssetIds);
+					for (uint32_t i = 0; i < numberOfSubMeshMaterialAssetIds; ++i)
+					{
+						// Empty string means "Don't overwrite the original material asset ID of the sub-mesh"
+						const std::string valueAsString = rapidJsonValueSubMeshMaterialAssetIds[i].GetString();
+						subMeshMaterialAssetIds[i] = valueAsString.empty() ? RendererRuntime::getUninitialized<RendererRuntime::AssetId>() : RendererToolkit::StringHelper::getAssetIdByString(valueAsString, input);
+					}
+				}
+				meshItem.numberOfSubMeshMaterialAssetIds = static_cast<uint32_t>(subMeshMaterialAssetIds.size());
+
+				// Write down
+				memoryFile.write(&meshItem, sizeof(RendererRuntime::v1Scene::MeshItem));
+				if (!subMeshMaterialAssetIds.empty())
+				{
+					// Write down all sub-mesh material asset IDs
+					memoryFile.write(subMeshMaterialAssetIds.data(), sizeof(RendererRuntime::AssetId) * subMeshMaterialAssetIds.size());
+				}
+			}
+			else if (RendererRuntime::SkySceneItem::TYPE_ID == typeId)
+			{
+				RendererRuntime::MaterialProperties::SortedPropertyVector sortedMaterialPropertyVector;
+				fillSortedMaterialPropertyVector(input, rapidJsonValueItem, sortedMaterialPropertyVector);
+				RendererRuntime::v1Scene::SkyItem skyItem;
+				readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, skyItem);
+
+				// Write down
+				memoryFile.write(&skyItem, sizeof(RendererRuntime::v1Scene::SkyItem));
+				if (!sortedMaterialPropertyVector.empty())
+				{
+					// Write down all material properties
+					memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(RendererRuntime::MaterialProperty) * sortedMaterialPropertyVector.size());
+				}
+			}
+			else if (RendererRuntime::TerrainSceneItem::TYPE_ID == typeId)
+			{
+				RendererRuntime::MaterialProperties::SortedPropertyVector sortedMaterialPropertyVector;
+				fillSortedMaterialPropertyVector(input, rapidJsonValueItem, sortedMaterialPropertyVector);
+				RendererRuntime::v1Scene::TerrainItem terrainItem;
+				readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, terrainItem);
+
+				// Write down
+				memoryFile.write(&terrainItem, sizeof(RendererRuntime::v1Scene::TerrainItem));
+				if (!sortedMaterialPropertyVector.empty())
+				{
+					// Write down all material properties
+					memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(RendererRuntime::MaterialProperty) * sortedMaterialPropertyVector.size());
+				}
+			}
+			else if (RendererRuntime::ParticlesSceneItem::TYPE_ID == typeId)
+			{
+				RendererRuntime::MaterialProperties::SortedPropertyVector sortedMaterialPropertyVector;
+				fillSortedMaterialPropertyVector(input, rapidJsonValueItem, sortedMaterialPropertyVector);
+				RendererRuntime::v1Scene::ParticlesItem particlesItem;
+				readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, particlesItem);
+
+				// Write down
+				memoryFile.write(&particlesItem, sizeof(RendererRuntime::v1Scene::ParticlesItem));
+				if (!sortedMaterialPropertyVector.empty())
+				{
+					// Write down all material properties
+					memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(RendererRuntime::MaterialProperty) * sortedMaterialPropertyVector.size());
+				}
+			}
+			else
+			{
+				// Error!
+				throw std::runtime_error("Scene item type \"" + std::string(typeName) + "\" is unknown");
+			}
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -234,251 +414,133 @@ namespace RendererToolkit
 				rapidjson::Document rapidJsonDocument;
 				JsonHelper::loadDocumentByFilename(input.context.getFileManager(), virtualInputFilename, "SceneAsset", "1", rapidJsonDocument);
 
+				// Mandatory main sections of the material blueprint
+				const rapidjson::Value& rapidJsonValueSceneAsset = rapidJsonDocument["SceneAsset"];
+				const rapidjson::Value& rapidJsonValueNodes = rapidJsonValueSceneAsset["Nodes"];
+
+				// Gather the scene nodes
+				// -> Scene nodes with a single mesh scene item are instance scene nodes, they're grouped by their scene item data so the runtime can create them in bulk
+				// -> All other scene nodes are regular scene nodes with individual scene items
+				std::vector<RendererRuntime::Transform> transforms;
+				std::vector<uint32_t> numberOfItems;
+				RendererRuntime::MemoryFile itemsMemoryFile(0, 4096);
+				::detail::InstanceGroups instanceGroups;
+				::detail::InstanceGroupIndexBySceneItemData instanceGroupIndexBySceneItemData;
+				const rapidjson::SizeType numberOfNodes = rapidJsonValueNodes.Size();
+				transforms.reserve(numberOfNodes);
+				for (rapidjson::SizeType nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex)
+				{
+					const rapidjson::Value& rapidJsonValueNode = rapidJsonValueNodes[nodeIndex];
+					const rapidjson::Value* rapidJsonValueItems = rapidJsonValueNode.HasMember("Items") ? &rapidJsonValueNode["Items"] : nullptr;
+
+					// Get the scene node transform
+					RendererRuntime::Transform transform;
+					transform.scale = RendererRuntime::Math::VEC3_ONE;
+					if (rapidJsonValueNode.HasMember("Properties"))
+					{
+						const rapidjson::Value& rapidJsonValueProperties = rapidJsonValueNode["Properties"];
+
+						// Position, rotation and scale
+						JsonHelper::optionalUnitNProperty(rapidJsonValueProperties, "Position", &transform.position.x, 3);
+						JsonHelper::optionalRotationQuaternionProperty(rapidJsonValueProperties, "Rotation", transform.rotation);
+						JsonHelper::optionalFactorNProperty(rapidJsonValueProperties, "Scale", &transform.scale.x, 3);
+					}
+
+					// Instance scene node?
+					const uint32_t numberOfNodeItems = (nullptr != rapidJsonValueItems) ? rapidJsonValueItems->MemberCount() : 0;
+					if (1 == numberOfNodeItems && RendererRuntime::MeshSceneItem::TYPE_ID == RendererRuntime::StringId(rapidJsonValueItems->MemberBegin()->name.GetString()))
+					{
+						RendererRuntime::MemoryFile itemMemoryFile;
+						::detail::writeSceneItemData(input, rapidJsonValueItems->MemberBegin()->name.GetString(), rapidJsonValueItems->MemberBegin()->value, itemMemoryFile);
+						::detail::InstanceGroupIndexBySceneItemData::const_iterator iterator = instanceGroupIndexBySceneItemData.find(itemMemoryFile.getByteVector());
+						size_t instanceGroupIndex = 0;
+						if (instanceGroupIndexBySceneItemData.cend() == iterator)
+						{
+							instanceGroupIndex = instanceGroups.size();
+							instanceGroupIndexBySceneItemData.emplace(itemMemoryFile.getByteVector(), instanceGroupIndex);
+							instanceGroups.push_back({RendererRuntime::MeshSceneItem::TYPE_ID, itemMemoryFile.getByteVector(), {}});
+						}
+						else
+						{
+							instanceGroupIndex = iterator->second;
+						}
+						instanceGroups[instanceGroupIndex].transforms.push_back(transform);
+						continue;
+					}
+
+					// Regular scene node
+					transforms.push_back(transform);
+					numberOfItems.push_back(numberOfNodeItems);
+					if (nullptr != rapidJsonValueItems)
+					{
+						for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIteratorItems = rapidJsonValueItems->MemberBegin(); rapidJsonMemberIteratorItems != rapidJsonValueItems->MemberEnd(); ++rapidJsonMemberIteratorItems)
+						{
+							// Get the scene item type specific data, if there is any
+							RendererRuntime::MemoryFile itemMemoryFile;
+							::detail::writeSceneItemData(input, rapidJsonMemberIteratorItems->name.GetString(), rapidJsonMemberIteratorItems->value, itemMemoryFile);
+							const RendererRuntime::MemoryFile::ByteVector& itemData = itemMemoryFile.getByteVector();
+
+							{ // Write down the scene item header
+								RendererRuntime::v1Scene::ItemHeader itemHeader;
+								itemHeader.typeId		 = RendererRuntime::StringId(rapidJsonMemberIteratorItems->name.GetString());
+								itemHeader.numberOfBytes = static_cast<uint32_t>(itemData.size());
+								itemsMemoryFile.write(&itemHeader, sizeof(RendererRuntime::v1Scene::ItemHeader));
+							}
+
+							// Write down the scene item type specific data, if there is any
+							if (!itemData.empty())
+							{
+								itemsMemoryFile.write(itemData.data(), itemData.size());
+							}
+						}
+					}
+				}
+
 				{ // Write down the scene resource header
 					RendererRuntime::v1Scene::SceneHeader sceneHeader;
 					sceneHeader.unused = 42;	// TODO(co) Currently the scene header is unused
 					memoryFile.write(&sceneHeader, sizeof(RendererRuntime::v1Scene::SceneHeader));
 				}
 
-				// Mandatory main sections of the material blueprint
-				const rapidjson::Value& rapidJsonValueSceneAsset = rapidJsonDocument["SceneAsset"];
-				const rapidjson::Value& rapidJsonValueNodes = rapidJsonValueSceneAsset["Nodes"];
-
 				{ // Write down the scene nodes
-					const rapidjson::SizeType numberOfNodes = rapidJsonValueNodes.Size();
 					RendererRuntime::v1Scene::Nodes nodes;
-					nodes.numberOfNodes = numberOfNodes;
+					nodes.numberOfNodes			 = static_cast<uint32_t>(numberOfItems.size());
+					nodes.numberOfInstanceNodes	 = static_cast<uint32_t>(numberOfNodes - numberOfItems.size());
+					nodes.numberOfInstanceGroups = static_cast<uint32_t>(instanceGroups.size());
 					memoryFile.write(&nodes, sizeof(RendererRuntime::v1Scene::Nodes));
 
-					// Loop through all scene nodes
-					for (rapidjson::SizeType nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex)
+					// Write down the transforms of all scene nodes as contiguous array, the instance scene nodes are stored behind the regular scene nodes in instance group order
+					for (const ::detail::InstanceGroup& instanceGroup : instanceGroups)
 					{
-						const rapidjson::Value& rapidJsonValueNode = rapidJsonValueNodes[nodeIndex];
-						const rapidjson::Value* rapidJsonValueItems = rapidJsonValueNode.HasMember("Items") ? &rapidJsonValueNode["Items"] : nullptr;
-
-						{ // Write down the scene node
-							RendererRuntime::v1Scene::Node node;
-
-							// Get the scene node transform
-							node.transform.scale = RendererRuntime::Math::VEC3_ONE;
-							if (rapidJsonValueNode.HasMember("Properties"))
-							{
-								const rapidjson::Value& rapidJsonValueProperties = rapidJsonValueNode["Properties"];
-
-								// Position, rotation and scale
-								JsonHelper::optionalUnitNProperty(rapidJsonValueProperties, "Position", &node.transform.position.x, 3);
-								JsonHelper::optionalRotationQuaternionProperty(rapidJsonValueProperties, "Rotation", node.transform.rotation);
-								JsonHelper::optionalFactorNProperty(rapidJsonValueProperties, "Scale", &node.transform.scale.x, 3);
-							}
+						transforms.insert(transforms.end(), instanceGroup.transforms.cbegin(), instanceGroup.transforms.cend());
+					}
+					if (!transforms.empty())
+					{
+						memoryFile.write(transforms.data(), sizeof(RendererRuntime::Transform) * transforms.size());
+					}
 
-							// Write down the scene node
-							node.numberOfItems = (nullptr != rapidJsonValueItems) ? rapidJsonValueItems->MemberCount() : 0;
-							memoryFile.write(&node, sizeof(RendererRuntime::v1Scene::Node));
+					// Write down the number of scene items of the regular scene nodes as contiguous array as well as the scene items
+					if (!numberOfItems.empty())
+					{
+						memoryFile.write(numberOfItems.data(), sizeof(uint32_t) * numberOfItems.size());
+						const RendererRuntime::MemoryFile::ByteVector& itemsData = itemsMemoryFile.getByteVector();
+						if (!itemsData.empty())
+						{
+							memoryFile.write(itemsData.data(), itemsData.size());
 						}
+					}
 
-						// Write down the scene items
-						if (nullptr != rapidJsonValueItems)
+					// Write down the instance groups
+					for (const ::detail::InstanceGroup& instanceGroup : instanceGroups)
+					{
+						RendererRuntime::v1Scene::InstanceGroup instanceGroupHeader;
+						instanceGroupHeader.typeId			  = instanceGroup.typeId;
+						instanceGroupHeader.numberOfBytes	  = static_cast<uint32_t>(instanceGroup.itemData.size());
+						instanceGroupHeader.numberOfInstances = static_cast<uint32_t>(instanceGroup.transforms.size());
+						memoryFile.write(&instanceGroupHeader, sizeof(RendererRuntime::v1Scene::InstanceGroup));
+						if (!instanceGroup.itemData.empty())
 						{
-							for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIteratorItems = rapidJsonValueItems->MemberBegin(); rapidJsonMemberIteratorItems != rapidJsonValueItems->MemberEnd(); ++rapidJsonMemberIteratorItems)
-							{
-								const rapidjson::Value& rapidJsonValueItem = rapidJsonMemberIteratorItems->value;
-								const RendererRuntime::SceneItemTypeId typeId = RendererRuntime::StringId(rapidJsonMemberIteratorItems->name.GetString());
-
-								// Get the scene item type specific data number of bytes
-								// TODO(co) Make this more generic via scene factory
-								uint32_t numberOfBytes = 0;
-								RendererRuntime::MaterialProperties::SortedPropertyVector sortedMaterialPropertyVector;
-								if (RendererRuntime::CameraSceneItem::TYPE_ID == typeId)
-								{
-									// Nothing here
-								}
-								else if (RendererRuntime::LightSceneItem::TYPE_ID == typeId)
-								{
-									numberOfBytes = sizeof(RendererRuntime::v1Scene::LightItem);
-								}
-								else if (RendererRuntime::SunlightSceneItem::TYPE_ID == typeId)
-								{
-									numberOfBytes = sizeof(RendererRuntime::v1Scene::SunlightItem);
-								}
-								else if (RendererRuntime::MeshSceneItem::TYPE_ID == typeId || RendererRuntime::SkeletonMeshSceneItem::TYPE_ID == typeId)
-								{
-									const uint32_t numberOfSubMeshMaterialAssetIds = rapidJsonValueItem.HasMember("SubMeshMaterials") ? rapidJsonValueItem["SubMeshMaterials"].Size() : 0;
-									numberOfBytes = sizeof(RendererRuntime::v1Scene::MeshItem) + sizeof(RendererRuntime::AssetId) * numberOfSubMeshMaterialAssetIds;
-									if (RendererRuntime::SkeletonMeshSceneItem::TYPE_ID == typeId)
-									{
-										numberOfBytes += sizeof(RendererRuntime::v1Scene::SkeletonMeshItem);
-									}
-								}
-								else if (RendererRuntime::SkySceneItem::TYPE_ID == typeId || RendererRuntime::TerrainSceneItem::TYPE_ID == typeId || RendererRuntime::ParticlesSceneItem::TYPE_ID == typeId)
-								{
-									::detail::fillSortedMaterialPropertyVector(input, rapidJsonValueItem, sortedMaterialPropertyVector);
-									numberOfBytes = static_cast<uint32_t>(sizeof(RendererRuntime::v1Scene::MaterialItem) + sizeof(RendererRuntime::MaterialProperty) * sortedMaterialPropertyVector.size());
-								}
-								else
-								{
-									// Error!
-									throw std::runtime_error("Scene item type \"" + std::string(rapidJsonMemberIteratorItems->name.GetString()) + "\" is unknown");
-								}
-
-								{ // Write down the scene item header
-									RendererRuntime::v1Scene::ItemHeader itemHeader;
-									itemHeader.typeId		 = typeId;
-									itemHeader.numberOfBytes = numberOfBytes;
-									memoryFile.write(&itemHeader, sizeof(RendererRuntime::v1Scene::ItemHeader));
-								}
-
-								// Write down the scene item type specific data, if there is any
-								if (0 != numberOfBytes)
-								{
-									if (RendererRuntime::CameraSceneItem::TYPE_ID == typeId)
-									{
-										// Nothing here
-									}
-									else if (RendererRuntime::LightSceneItem::TYPE_ID == typeId)
-									{
-										RendererRuntime::v1Scene::LightItem lightItem;
-
-										// Read properties
-										::detail::optionalLightTypeProperty(rapidJsonValueItem, "LightType", lightItem.lightType);
-										JsonHelper::optionalRgbColorProperty(rapidJsonValueItem, "Color", lightItem.color);
-										JsonHelper::optionalUnitNProperty(rapidJsonValueItem, "Radius", &lightItem.radius, 1);
-										JsonHelper::optionalAngleProperty(rapidJsonValueItem, "InnerAngle", lightItem.innerAngle);
-										JsonHelper::optionalAngleProperty(rapidJsonValueItem, "OuterAngle", lightItem.outerAngle);
-										JsonHelper::optionalUnitNProperty(rapidJsonValueItem, "NearClipDistance", &lightItem.nearClipDistance, 1);
-
-										// Sanity checks
-										if (lightItem.color[0] < 0.0f || lightItem.color[1] < 0.0f || lightItem.color[2] < 0.0f)
-										{
-											throw std::runtime_error("All light item color components must be positive");
-										}
-										if (lightItem.lightType != RendererRuntime::LightSceneItem::LightType::DIRECTIONAL && lightItem.radius <= 0.0f)
-										{
-											throw std::runtime_error("For point or spot light items the radius must be greater as zero");
-										}
-										if (lightItem.lightType == RendererRuntime::LightSceneItem::LightType::DIRECTIONAL && lightItem.radius != 0.0f)
-										{
-											throw std::runtime_error("For directional light items the radius must be zero");
-										}
-										if (lightItem.innerAngle < 0.0f)
-										{
-											throw std::runtime_error("The inner spot light angle must be >= 0 degrees");
-										}
-										if (lightItem.outerAngle >= glm::radians(90.0f))
-										{
-											throw std::runtime_error("The outer spot light angle must be < 90 degrees");
-										}
-										if (lightItem.innerAngle >= lightItem.outerAngle)
-										{
-											throw std::runtime_error("The inner spot light angle must be smaller as the outer spot light angle");
-										}
-										if (lightItem.nearClipDistance < 0.0f)
-										{
-											throw std::runtime_error("The spot light near clip distance must be greater as zero");
-										}
-
-										// Write down
-										memoryFile.write(&lightItem, sizeof(RendererRuntime::v1Scene::LightItem));
-									}
-									else if (RendererRuntime::SunlightSceneItem::TYPE_ID == typeId)
-									{
-										RendererRuntime::v1Scene::SunlightItem sunlightItem;
-
-										// Read properties
-										JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "SunriseTime", sunlightItem.sunriseTime);
-										JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "SunsetTime", sunlightItem.sunsetTime);
-										JsonHelper::optionalAngleProperty(rapidJsonValueItem, "EastDirection", sunlightItem.eastDirection);
-										JsonHelper::optionalAngleProperty(rapidJsonValueItem, "AngleOfIncidence", sunlightItem.angleOfIncidence);
-										JsonHelper::optionalTimeOfDayProperty(rapidJsonValueItem, "TimeOfDay", sunlightItem.timeOfDay);
-
-										// Write down
-										memoryFile.write(&sunlightItem, sizeof(RendererRuntime::v1Scene::SunlightItem));
-									}
-									else if (RendererRuntime::MeshSceneItem::TYPE_ID == typeId || RendererRuntime::SkeletonMeshSceneItem::TYPE_ID == typeId)
-									{
-										// Skeleton mesh scene item
-										if (RendererRuntime::SkeletonMeshSceneItem::TYPE_ID == typeId)
-										{
-											RendererRuntime::v1Scene::SkeletonMeshItem skeletonMeshItem;
-
-											// Optional skeleton animation: Map the source asset ID to the compiled asset ID
-											skeletonMeshItem.skeletonAnimationAssetId = RendererRuntime::getUninitialized<RendererRuntime::AssetId>();
-											JsonHelper::optionalCompiledAssetId(input, rapidJsonValueItem, "SkeletonAnimation", skeletonMeshItem.skeletonAnimationAssetId);
-
-											// Write down
-											memoryFile.write(&skeletonMeshItem, sizeof(RendererRuntime::v1Scene::SkeletonMeshItem));
-										}
-
-										// Mesh scene item
-										RendererRuntime::v1Scene::MeshItem meshItem;
-
-										// Map the source asset ID to the compiled asset ID
-										meshItem.meshAssetId = JsonHelper::getCompiledAssetId(input, rapidJsonValueItem, "Mesh");
-
-										// Optional sub-mesh material asset IDs to be able to overwrite the original material asset ID of sub-meshes
-										std::vector<RendererRuntime::AssetId> subMeshMaterialAssetIds;
-										if (rapidJsonValueItem.HasMember("SubMeshMaterials"))
-										{
-											const rapidjson::Value& rapidJsonValueSubMeshMaterialAssetIds = rapidJsonValueItem["SubMeshMaterials"];
-											const uint32_t numberOfSubMeshMaterialAssetIds = rapidJsonValueSubMeshMaterialAssetIds.Size();
-											subMeshMaterialAssetIds.resize(numberOfSubMeshMaterialAssetIds);
-											for (uint32_t i = 0; i < numberOfSubMeshMaterialAssetIds; ++i)
-											{
-												// Empty string means "Don't overwrite the original material asset ID of the sub-mesh"
-												const std::string valueAsString = rapidJsonValueSubMeshMaterialAssetIds[i].GetString();
-												subMeshMaterialAssetIds[i] = valueAsString.empty() ? RendererRuntime::getUninitialized<RendererRuntime::AssetId>() : StringHelper::getAssetIdByString(valueAsString, input);
-											}
-										}
-										meshItem.numberOfSubMeshMaterialAssetIds = static_cast<uint32_t>(subMeshMaterialAssetIds.size());
-
-										// Write down
-										memoryFile.write(&meshItem, sizeof(RendererRuntime::v1Scene::MeshItem));
-										if (!subMeshMaterialAssetIds.empty())
-										{
-											// Write down all sub-mesh material asset IDs
-											memoryFile.write(subMeshMaterialAssetIds.data(), sizeof(RendererRuntime::AssetId) * subMeshMaterialAssetIds.size());
-										}
-									}
-									else if (RendererRuntime::SkySceneItem::TYPE_ID == typeId)
-									{
-										RendererRuntime::v1Scene::SkyItem skyItem;
-										::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, skyItem);
-
-										// Write down
-										memoryFile.write(&skyItem, sizeof(RendererRuntime::v1Scene::SkyItem));
-										if (!sortedMaterialPropertyVector.empty())
-										{
-											// Write down all material properties
-											memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(RendererRuntime::MaterialProperty) * sortedMaterialPropertyVector.size());
-										}
-									}
-									else if (RendererRuntime::TerrainSceneItem::TYPE_ID == typeId)
-									{
-										RendererRuntime::v1Scene::TerrainItem terrainItem;
-										::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, terrainItem);
-
-										// Write down
-										memoryFile.write(&terrainItem, sizeof(RendererRuntime::v1Scene::TerrainItem));
-										if (!sortedMaterialPropertyVector.empty())
-										{
-											// Write down all material properties
-											memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(RendererRuntime::MaterialProperty) * sortedMaterialPropertyVector.size());
-										}
-									}
-									else if (RendererRuntime::ParticlesSceneItem::TYPE_ID == typeId)
-									{
-										RendererRuntime::v1Scene::ParticlesItem particlesItem;
-										::detail::readMaterialSceneItem(input, sortedMaterialPropertyVector, rapidJsonValueItem, particlesItem);
-
-										// Write down
-										memoryFile.write(&particlesItem, sizeof(RendererRuntime::v1Scene::ParticlesItem));
-										if (!sortedMaterialPropertyVector.empty())
-										{
-											// Write down all material properties
-											memoryFile.write(sortedMaterialPropertyVector.data(), sizeof(RendererRuntime::MaterialProperty) * sortedMaterialPropertyVector.size());
-										}
-									}
-								}
-							}
+							memoryFile.write(instanceGroup.itemData.data(), instanceGroup.itemData.size());
 						}
 					}
 				}
@@ -70,12 +70,84 @@ PRAGMA_WARNING_PUSH
 	#include <rapidjson/document.h>
 PRAGMA_WARNING_POP
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4355)	// warning C4355: 'this': used in base member initializer list
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::_Generic_error_category': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_Generic_error_category': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	#include <mutex>
+	#include <thread>
+	#include <condition_variable>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
 //[-------------------------------------------------------]
 namespace
 {
+	// Data-parallel per-pixel image processing
+	// -> Every pixel is written by exactly one thread and only depends on read-only input, so the result is independent of the number of threads
+	namespace parallel
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const crnlib::uint MINIMUM_NUMBER_OF_ROWS_PER_THREAD = 32;	///< Don't spawn threads for tiny images, the thread creation would be more expensive than the work itself
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Split the given number of rows into horizontal bands and call the given function once per band, the bands are processed concurrently
+		*
+		*  @param[in] height
+		*    Number of rows to process
+		*  @param[in] function
+		*    Function with the signature "void(crnlib::uint startRow, crnlib::uint endRow)", must not throw and must only write pixels of its own band
+		*/
+		template <typename Function>
+		void forEachRowBand(crnlib::uint height, const Function& function)
+		{
+			const crnlib::uint numberOfHardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+			const crnlib::uint numberOfThreads = std::max(1u, std::min(numberOfHardwareThreads, height / MINIMUM_NUMBER_OF_ROWS_PER_THREAD));
+			if (numberOfThreads > 1)
+			{
+				// The calling thread processes the last band including the remaining rows
+				const crnlib::uint numberOfRowsPerThread = height / numberOfThreads;
+				std::vector<std::thread> threads;
+				threads.reserve(numberOfThreads - 1);
+				for (crnlib::uint threadIndex = 0; threadIndex < numberOfThreads - 1; ++threadIndex)
+				{
+					threads.emplace_back(std::cref(function), threadIndex * numberOfRowsPerThread, (threadIndex + 1) * numberOfRowsPerThread);
+				}
+				function((numberOfThreads - 1) * numberOfRowsPerThread, height);
+
+				// Wait until all worker threads are done
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+			}
+			else
+			{
+				function(0, height);
+			}
+		}
+
+
+	} // parallel
+
 	// Create Toksvig specular anti-aliasing to reduce shimmering
 	// -> Basing on "Specular Showdown in the Wild West" by Stephen Hill - http://blog.selfshadow.com/2011/07/22/specular-showdown/ - http://www.selfshadow.com/sandbox/toksvig.html
 	namespace toksvig
@@ -137,17 +209,20 @@ namespace
 			const crnlib::uint height = normalMapCrunchMipLevel.get_height();
 			crnlib::image_u8* normalMapCrunchImage = normalMapCrunchMipLevel.get_image();
 			crnlib::image_u8* crunchImage = toksvigCrunchMipLevel.get_image();
-			for (crnlib::uint y = 0; y < height; ++y)
+			::parallel::forEachRowBand(height, [=](crnlib::uint startRow, crnlib::uint endRow)
 			{
-				for (crnlib::uint x = 0; x < width; ++x)
+				for (crnlib::uint y = startRow; y < endRow; ++y)
 				{
-					// Toksvig: Areas in the original normal map that were flat are white (glossy), whereas noisy, bumpy sections are darker
-					const float toksvig = glm::clamp(calculateToksvig(*normalMapCrunchImage, glm::vec2(x, y), POWER), 0.0f, 1.0f);
+					for (crnlib::uint x = 0; x < width; ++x)
+					{
+						// Toksvig: Areas in the original normal map that were flat are white (glossy), whereas noisy, bumpy sections are darker
+						const float toksvig = glm::clamp(calculateToksvig(*normalMapCrunchImage, glm::vec2(x, y), POWER), 0.0f, 1.0f);
 
-					// Roughness = 1 - glossiness
-					(*crunchImage)(x, y) = static_cast<crnlib::uint8>((1.0f - toksvig) * 255.0f);
+						// Roughness = 1 - glossiness
+						(*crunchImage)(x, y) = static_cast<crnlib::uint8>((1.0f - toksvig) * 255.0f);
+					}
 				}
-			}
+			});
 		}
 
 		void compositeToksvigRoughnessMap(const crnlib::mip_level& roughnessMapCrunchMipLevel, const crnlib::mip_level& normalMapCrunchMipLevel, crnlib::mip_level& crunchMipLevel)
@@ -157,18 +232,21 @@ namespace
 			crnlib::image_u8* roughnessMapCrunchImage = roughnessMapCrunchMipLevel.get_image();
 			crnlib::image_u8* normalMapCrunchImage = normalMapCrunchMipLevel.get_image();
 			crnlib::image_u8* crunchImage = crunchMipLevel.get_image();
-			for (crnlib::uint y = 0; y < height; ++y)
+			::parallel::forEachRowBand(height, [=](crnlib::uint startRow, crnlib::uint endRow)
 			{
-				for (crnlib::uint x = 0; x < width; ++x)
+				for (crnlib::uint y = startRow; y < endRow; ++y)
 				{
-					// Toksvig: Areas in the original normal map that were flat are white (glossy), whereas noisy, bumpy sections are darker
-					const float toksvig = glm::clamp(calculateToksvig(*normalMapCrunchImage, glm::vec2(x, y), POWER), 0.0f, 1.0f);
+					for (crnlib::uint x = 0; x < width; ++x)
+					{
+						// Toksvig: Areas in the original normal map that were flat are white (glossy), whereas noisy, bumpy sections are darker
+						const float toksvig = glm::clamp(calculateToksvig(*normalMapCrunchImage, glm::vec2(x, y), POWER), 0.0f, 1.0f);
 
-					// Roughness = 1 - glossiness
-					const float originalGlossiness = 1.0f - ((*roughnessMapCrunchImage)(x, y).r / 255.0f);
-					(*crunchImage)(x, y).r = 255 - static_cast<crnlib::uint8>(originalGlossiness * toksvig * 255.0f);
+						// Roughness = 1 - glossiness
+						const float originalGlossiness = 1.0f - ((*roughnessMapCrunchImage)(x, y).r / 255.0f);
+						(*crunchImage)(x, y).r = 255 - static_cast<crnlib::uint8>(originalGlossiness * toksvig * 255.0f);
+					}
 				}
-			}
+			});
 		}
 
 
@@ -206,19 +284,91 @@ namespace
 		};
 
 		static const uint16_t TEXTURE_FORMAT_VERSION = 0;
+		static const uint32_t DEFAULT_MEMORY_BUDGET_IN_MEBIBYTES = 2048;	///< Default process wide memory budget for concurrent texture compression, can be changed by the "TextureAssetCompiler"-block of the targets
+		static const uint64_t CRUNCH_MEMORY_FACTOR = 3;						///< Rough estimate of Crunch working memory: Input image, generated mipmap chain and compressed intermediate data
 
 		typedef std::vector<std::string> Filenames;
 
+		struct DdsHeaderDX10 final
+		{
+			uint32_t dxgiFormat;		///< "DXGI_FORMAT"
+			uint32_t resourceDimension;	///< "D3D10_RESOURCE_DIMENSION"
+			uint32_t miscFlag;
+			uint32_t arraySize;
+			uint32_t miscFlags2;
+		};
+
 
 		//[-------------------------------------------------------]
 		//[ Global variables                                      ]
 		//[-------------------------------------------------------]
-		static bool g_CrunchInitialized = false;
+		static bool					   g_CrunchInitialized = false;
+		static std::mutex			   g_MemoryBudgetMutex;
+		static std::condition_variable g_MemoryBudgetConditionVariable;
+		static uint64_t				   g_UsedMemoryBudgetInBytes = 0;	///< Estimated memory of all textures which are currently compressed, protected by "g_MemoryBudgetMutex"
 
 
 		//[-------------------------------------------------------]
 		//[ Global classes                                        ]
 		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Scoped acquisition of the process wide memory budget for texture compression
+		*
+		*  @remarks
+		*    The project compiler runs multiple compiler threads, so multiple textures can be compressed at one and the same time. Crunch is quite memory hungry,
+		*    hence the constructor blocks until the estimated memory of the texture fits into the budget. A texture exceeding the budget on its own is still
+		*    compressed, but only while no other texture is compressed. A budget of zero means unlimited.
+		*/
+		class MemoryBudgetScope final
+		{
+
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		public:
+			MemoryBudgetScope(uint64_t numberOfBytes, uint64_t budgetInBytes) :
+				mNumberOfBytes((0 != budgetInBytes) ? numberOfBytes : 0)
+			{
+				if (0 != mNumberOfBytes)
+				{
+					std::unique_lock<std::mutex> memoryBudgetMutexLock(g_MemoryBudgetMutex);
+					g_MemoryBudgetConditionVariable.wait(memoryBudgetMutexLock, [=]{ return (0 == g_UsedMemoryBudgetInBytes || g_UsedMemoryBudgetInBytes + mNumberOfBytes <= budgetInBytes); });
+					g_UsedMemoryBudgetInBytes += mNumberOfBytes;
+				}
+			}
+
+			~MemoryBudgetScope()
+			{
+				if (0 != mNumberOfBytes)
+				{
+					{
+						std::lock_guard<std::mutex> memoryBudgetMutexLock(g_MemoryBudgetMutex);
+						g_UsedMemoryBudgetInBytes -= mNumberOfBytes;
+					}
+					g_MemoryBudgetConditionVariable.notify_all();
+				}
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Private methods                                       ]
+		//[-------------------------------------------------------]
+		private:
+			explicit MemoryBudgetScope(const MemoryBudgetScope&) = delete;
+			MemoryBudgetScope& operator=(const MemoryBudgetScope&) = delete;
+
+
+		//[-------------------------------------------------------]
+		//[ Private data                                          ]
+		//[-------------------------------------------------------]
+		private:
+			const uint64_t mNumberOfBytes;
+
+
+		};
+
 		class FileStream final : public crnlib::data_stream
 		{
 
@@ -373,7 +523,7 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
-		void getVirtualOutputAssetFilenameAndCrunchOutputTextureFileType(const RendererToolkit::IAssetCompiler::Configuration& configuration, const std::string& assetFileFormat, const std::string& assetName, const std::string& virtualAssetOutputDirectory, TextureSemantic textureSemantic, std::string& virtualOutputAssetFilename, crnlib::texture_file_types::format& crunchOutputTextureFileType)
+		void getVirtualOutputAssetFilenameAndCrunchOutputTextureFileType(const RendererToolkit::IAssetCompiler::Configuration& configuration, const std::string& assetFileFormat, const std::string& assetName, const std::string& virtualAssetOutputDirectory, TextureSemantic textureSemantic, bool textureArray, std::string& virtualOutputAssetFilename, crnlib::texture_file_types::format& crunchOutputTextureFileType)
 		{
 			const rapidjson::Value& rapidJsonValueTargets = configuration.rapidJsonValueTargets;
 
@@ -385,7 +535,8 @@ namespace
 				textureTargetName = rapidJsonValueRendererTarget["TextureTarget"].GetString();
 			}
 			{
-				std::string fileFormat = assetFileFormat;
+				// CRN has no texture array support, so texture arrays are always DDS
+				std::string fileFormat = textureArray ? "dds" : assetFileFormat;
 				if (fileFormat.empty())
 				{
 					const rapidjson::Value& rapidJsonValueTextureTargets = rapidJsonValueTargets["TextureTargets"];
@@ -408,7 +559,7 @@ namespace
 			}
 
 			// Handle DDS LZ4 compression
-			if (::detail::TextureSemantic::TERRAIN_HEIGHT_MAP == textureSemantic)
+			if (::detail::TextureSemantic::TERRAIN_HEIGHT_MAP == textureSemantic || textureArray)
 			{
 				RendererToolkit::StringHelper::replaceFirstString(virtualOutputAssetFilename, ".dds", ".lz4dds");
 			}
@@ -526,6 +677,11 @@ namespace
 			}
 		}
 
+		bool isTextureArray(const rapidjson::Value& rapidJsonValueTextureAssetCompiler)
+		{
+			return rapidJsonValueTextureAssetCompiler.HasMember("TextureArrayInputFiles");
+		}
+
 		bool isToksvigSpecularAntiAliasingEnabled(const rapidjson::Value& rapidJsonValueTextureAssetCompiler)
 		{
 			bool toksvigSpecularAntiAliasing = false;
@@ -952,6 +1108,24 @@ namespace
 			}
 		}
 
+		void getCompressionSettings(const RendererToolkit::IAssetCompiler::Configuration& configuration, uint32_t& numberOfHelperThreads, uint64_t& memoryBudgetInBytes)
+		{
+			// By default, Crunch is using all hardware threads (the calling thread plus the helper threads), Crunch supports only a limited number of helper threads
+			numberOfHelperThreads = (crnlib::g_number_of_processors > 1) ? (crnlib::g_number_of_processors - 1) : 0;
+			uint32_t memoryBudgetInMebibytes = DEFAULT_MEMORY_BUDGET_IN_MEBIBYTES;
+
+			// Optional project wide settings, e.g. to reduce the number of Crunch helper threads when there are many project compiler threads
+			const rapidjson::Value& rapidJsonValueTargets = configuration.rapidJsonValueTargets;
+			if (rapidJsonValueTargets.HasMember("TextureAssetCompiler"))
+			{
+				const rapidjson::Value& rapidJsonValueTextureAssetCompiler = rapidJsonValueTargets["TextureAssetCompiler"];
+				RendererToolkit::JsonHelper::optionalIntegerProperty(rapidJsonValueTextureAssetCompiler, "NumberOfHelperThreads", numberOfHelperThreads);
+				RendererToolkit::JsonHelper::optionalIntegerProperty(rapidJsonValueTextureAssetCompiler, "MemoryBudget", memoryBudgetInMebibytes);
+			}
+			numberOfHelperThreads = std::min(numberOfHelperThreads, static_cast<uint32_t>(cCRNMaxHelperThreads));
+			memoryBudgetInBytes = static_cast<uint64_t>(memoryBudgetInMebibytes) * 1024 * 1024;
+		}
+
 		std::string widthHeightToString(uint32_t width, uint32_t height)
 		{
 			return std::to_string(width) + 'x' + std::to_string(height);
@@ -981,9 +1155,37 @@ namespace
 			return filenames;
 		}
 
+		Filenames getTextureArrayFilenames(const rapidjson::Value& rapidJsonValueTextureAssetCompiler, const std::string& basePath)
+		{
+			// The slice order is the order of the input files inside the asset
+			const rapidjson::Value& rapidJsonValueTextureArrayInputFiles = rapidJsonValueTextureAssetCompiler["TextureArrayInputFiles"];
+			Filenames filenames;
+			filenames.reserve(rapidJsonValueTextureArrayInputFiles.MemberCount());
+			for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIteratorInputFile = rapidJsonValueTextureArrayInputFiles.MemberBegin(); rapidJsonMemberIteratorInputFile != rapidJsonValueTextureArrayInputFiles.MemberEnd(); ++rapidJsonMemberIteratorInputFile)
+			{
+				filenames.emplace_back(basePath + '/' + rapidJsonMemberIteratorInputFile->value.GetString());
+			}
+			return filenames;
+		}
+
 		bool checkIfChanged(const RendererToolkit::IAssetCompiler::Input& input, const RendererToolkit::IAssetCompiler::Configuration& configuration, const rapidjson::Value& rapidJsonValueTextureAssetCompiler, TextureSemantic textureSemantic, const std::string& virtualInputAssetFilename, const std::string& virtualOutputAssetFilename, std::vector<RendererToolkit::CacheManager::CacheEntries>& cacheEntries)
 		{
-			if (TextureSemantic::REFLECTION_CUBE_MAP == textureSemantic)
+			if (isTextureArray(rapidJsonValueTextureAssetCompiler))
+			{
+				// A texture array has one source file per slice, so check if any of the files has been changed
+				const Filenames sliceFilenames = getTextureArrayFilenames(rapidJsonValueTextureAssetCompiler, input.virtualAssetInputDirectory);
+				RendererToolkit::CacheManager::CacheEntries cacheEntriesCandidate;
+				if (input.cacheManager.needsToBeCompiled(configuration.rendererTarget, input.virtualAssetFilename, sliceFilenames, virtualOutputAssetFilename, TEXTURE_FORMAT_VERSION, cacheEntriesCandidate))
+				{
+					// Changed
+					cacheEntries.push_back(cacheEntriesCandidate);
+					return true;
+				}
+
+				// Not changed
+				return false;
+			}
+			else if (TextureSemantic::REFLECTION_CUBE_MAP == textureSemantic)
 			{
 				// A cube map has six source files (for each face one source), so check if any of the six files has been changed
 				// -> "virtualInputAssetFilename" specifies the base directory of the faces source files
@@ -1137,25 +1339,31 @@ namespace
 					// Fill with source texture channel color
 					const crnlib::image_u8* sourceCrunchImage = source.crunchMipmappedTexture.get_level(0, 0)->get_image();
 					const uint8_t sourceChannel = destination.sourceChannel;
-					for (crnlib::uint y = 0; y < height; ++y)
+					::parallel::forEachRowBand(height, [=](crnlib::uint startRow, crnlib::uint endRow)
 					{
-						for (crnlib::uint x = 0; x < width; ++x)
+						for (crnlib::uint y = startRow; y < endRow; ++y)
 						{
-							(*destinationCrunchImage)(x, y).c[destinationChannel] = (*sourceCrunchImage)(x, y).c[sourceChannel];
+							for (crnlib::uint x = 0; x < width; ++x)
+							{
+								(*destinationCrunchImage)(x, y).c[destinationChannel] = (*sourceCrunchImage)(x, y).c[sourceChannel];
+							}
 						}
-					}
+					});
 				}
 				else
 				{
 					// Fill with uniform default color
 					const crnlib::uint8 value = static_cast<crnlib::uint8>(source.defaultColor[destination.sourceChannel] * 255.0f);
-					for (crnlib::uint y = 0; y < height; ++y)
+					::parallel::forEachRowBand(height, [=](crnlib::uint startRow, crnlib::uint endRow)
 					{
-						for (crnlib::uint x = 0; x < width; ++x)
+						for (crnlib::uint y = startRow; y < endRow; ++y)
 						{
-							(*destinationCrunchImage)(x, y).c[destinationChannel] = value;
+							for (crnlib::uint x = 0; x < width; ++x)
+							{
+								(*destinationCrunchImage)(x, y).c[destinationChannel] = value;
+							}
 						}
-					}
+					});
 				}
 			}
 		}
@@ -1199,7 +1407,10 @@ namespace
 			crunchConvertParams.m_y_flip = true;
 			crunchConvertParams.m_no_stats = true;
 			crunchConvertParams.m_dst_format = crnlib::PIXEL_FMT_INVALID;
-			crunchConvertParams.m_comp_params.m_num_helper_threads = crnlib::g_number_of_processors - 1;
+			uint32_t numberOfHelperThreads = 0;
+			uint64_t memoryBudgetInBytes = 0;
+			getCompressionSettings(configuration, numberOfHelperThreads, memoryBudgetInBytes);
+			crunchConvertParams.m_comp_params.m_num_helper_threads = numberOfHelperThreads;
 
 			// The 4x4 block size based DXT compression format has no support for 1D textures
 			if (crunchMipmappedTexture.get_width() == 1 || crunchMipmappedTexture.get_height() == 1)
@@ -1348,6 +1559,10 @@ namespace
 				crunchConvertParams.m_comp_params.m_quality_level = cCRNMaxQualityLevel;
 			}
 
+			// Wait until the texture fits into the memory budget, the estimate includes the mipmap chain (4/3 of the base mipmap) of all faces in 32-bit per texel
+			const uint64_t numberOfTexels = static_cast<uint64_t>(crunchMipmappedTexture.get_width()) * crunchMipmappedTexture.get_height() * crunchMipmappedTexture.get_num_faces();
+			const MemoryBudgetScope memoryBudgetScope(numberOfTexels * sizeof(crnlib::color_quad_u8) * 4 / 3 * CRUNCH_MEMORY_FACTOR, memoryBudgetInBytes);
+
 			// Compress now
 			crnlib::texture_conversion::convert_stats stats;
 			if (!crnlib::texture_conversion::process(crunchConvertParams, stats))
@@ -1363,6 +1578,102 @@ namespace
 			}
 		}
 
+		void convertTextureArray(const RendererToolkit::IAssetCompiler::Input& input, const RendererToolkit::IAssetCompiler::Configuration& configuration, const rapidjson::Value& rapidJsonValueTextureAssetCompiler, RendererRuntime::VirtualFilename virtualDestinationFilename, TextureSemantic textureSemantic, bool createMipmaps, float mipmapBlurriness)
+		{
+			RendererRuntime::IFileManager& fileManager = input.context.getFileManager();
+			const Filenames sliceFilenames = getTextureArrayFilenames(rapidJsonValueTextureAssetCompiler, input.virtualAssetInputDirectory);
+			if (sliceFilenames.empty())
+			{
+				throw std::runtime_error("A texture array needs at least one texture array input file");
+			}
+
+			// Each slice is compressed on its own with exactly the same settings as a regular 2D texture of the given texture semantic
+			// -> Crunch has no texture array support, so let Crunch write a temporary DDS file per slice and gather the compressed data of all slices
+			// -> DDS files are organized in slice-major order, that's exactly the order the slices are appended
+			RendererRuntime::MemoryFile memoryFile(0, 4096);
+			crnlib::DDSURFACEDESC2 firstDdsSurfaceDesc2 = {};
+			std::vector<uint8_t> sliceData;
+			const uint32_t numberOfSlices = static_cast<uint32_t>(sliceFilenames.size());
+			for (uint32_t sliceIndex = 0; sliceIndex < numberOfSlices; ++sliceIndex)
+			{
+				// Compress the slice into a temporary DDS file
+				const std::string virtualSliceFilename = std::string(virtualDestinationFilename) + '.' + std::to_string(sliceIndex) + ".dds";
+				convertFile(input, configuration, rapidJsonValueTextureAssetCompiler, input.virtualAssetInputDirectory.c_str(), sliceFilenames[sliceIndex].c_str(), virtualSliceFilename.c_str(), crnlib::texture_file_types::cFormatDDS, textureSemantic, createMipmaps, mipmapBlurriness, nullptr);
+
+				{ // Read the compressed slice data and remove the temporary DDS file
+					RendererRuntime::IFile* file = fileManager.openFile(RendererRuntime::IFileManager::FileMode::READ, virtualSliceFilename.c_str());
+					if (nullptr == file)
+					{
+						throw std::runtime_error("Failed to open the temporary texture array slice file \"" + virtualSliceFilename + '\"');
+					}
+					uint32_t magic = 0;
+					crnlib::DDSURFACEDESC2 ddsSurfaceDesc2 = {};
+					file->read(&magic, sizeof(uint32_t));
+					file->read(&ddsSurfaceDesc2, sizeof(crnlib::DDSURFACEDESC2));
+					sliceData.resize(file->getNumberOfBytes() - sizeof(uint32_t) - sizeof(crnlib::DDSURFACEDESC2));
+					file->read(sliceData.data(), sliceData.size());
+					fileManager.closeFile(*file);
+					std_filesystem::remove(fileManager.mapVirtualToAbsoluteFilename(RendererRuntime::IFileManager::FileMode::WRITE, virtualSliceFilename.c_str()));
+					if (crnlib::cDDSFileSignature != magic || 0 == (ddsSurfaceDesc2.ddpfPixelFormat.dwFlags & crnlib::DDPF_FOURCC))
+					{
+						throw std::runtime_error("Texture array slice \"" + sliceFilenames[sliceIndex] + "\" isn't block compressed, texture arrays only support BC1, BC2, BC3 and BC5");
+					}
+
+					// All slices must share the same dimension, number of mipmaps and texture format
+					if (0 == sliceIndex)
+					{
+						firstDdsSurfaceDesc2 = ddsSurfaceDesc2;
+						DdsHeaderDX10 ddsHeaderDX10 = {};
+						switch (ddsSurfaceDesc2.ddpfPixelFormat.dwFourCC)
+						{
+							case crnlib::PIXEL_FMT_DXT1:
+								ddsHeaderDX10.dxgiFormat = 71;	// "DXGI_FORMAT_BC1_UNORM"
+								break;
+
+							case crnlib::PIXEL_FMT_DXT3:
+								ddsHeaderDX10.dxgiFormat = 74;	// "DXGI_FORMAT_BC2_UNORM"
+								break;
+
+							case crnlib::PIXEL_FMT_DXT5:
+								ddsHeaderDX10.dxgiFormat = 77;	// "DXGI_FORMAT_BC3_UNORM"
+								break;
+
+							case crnlib::PIXEL_FMT_3DC:
+								ddsHeaderDX10.dxgiFormat = 83;	// "DXGI_FORMAT_BC5_UNORM"
+								break;
+
+							default:
+								throw std::runtime_error("Texture array slice \"" + sliceFilenames[sliceIndex] + "\" has an unsupported texture format, texture arrays only support BC1, BC2, BC3 and BC5");
+						}
+						ddsHeaderDX10.resourceDimension = 3;	// "D3D10_RESOURCE_DIMENSION_TEXTURE2D"
+						ddsHeaderDX10.arraySize			= numberOfSlices;
+
+						// Write down the DDS header, the texture format is defined by the DX10 header
+						crnlib::DDSURFACEDESC2 arrayDdsSurfaceDesc2 = ddsSurfaceDesc2;
+						arrayDdsSurfaceDesc2.ddpfPixelFormat.dwFourCC = CRNLIB_PIXEL_FMT_FOURCC('D', 'X', '1', '0');
+						memoryFile.write(&magic, sizeof(uint32_t));
+						memoryFile.write(&arrayDdsSurfaceDesc2, sizeof(crnlib::DDSURFACEDESC2));
+						memoryFile.write(&ddsHeaderDX10, sizeof(DdsHeaderDX10));
+					}
+					else if (ddsSurfaceDesc2.dwWidth != firstDdsSurfaceDesc2.dwWidth || ddsSurfaceDesc2.dwHeight != firstDdsSurfaceDesc2.dwHeight ||
+							 ddsSurfaceDesc2.dwMipMapCount != firstDdsSurfaceDesc2.dwMipMapCount || ddsSurfaceDesc2.ddpfPixelFormat.dwFourCC != firstDdsSurfaceDesc2.ddpfPixelFormat.dwFourCC)
+					{
+						throw std::runtime_error("Texture array slice \"" + sliceFilenames[sliceIndex] + "\" doesn't match the dimension " + widthHeightToString(firstDdsSurfaceDesc2.dwWidth, firstDdsSurfaceDesc2.dwHeight) +
+												 ", number of mipmaps or texture format of the first slice, all slices of a texture array must be identical in this regard");
+					}
+				}
+
+				// Append the compressed slice data
+				memoryFile.write(sliceData.data(), sliceData.size());
+			}
+
+			// Write LZ4 compressed output
+			if (!memoryFile.writeLz4CompressedDataByVirtualFilename(RendererRuntime::Lz4DdsTextureResourceLoader::FORMAT_TYPE, RendererRuntime::Lz4DdsTextureResourceLoader::FORMAT_VERSION, fileManager, virtualDestinationFilename))
+			{
+				throw std::runtime_error("Failed to write LZ4 compressed output file \"" + std::string(virtualDestinationFilename) + '\"');
+			}
+		}
+
 		void convertColorCorrectionLookupTable(RendererRuntime::IFileManager& fileManager, RendererRuntime::VirtualFilename virtualSourceFilename, RendererRuntime::VirtualFilename virtualDestinationFilename)
 		{
 			// Load the 2D source image
@@ -1559,7 +1870,7 @@ namespace RendererToolkit
 		// Get output related settings
 		std::string virtualOutputAssetFilename;
 		crnlib::texture_file_types::format crunchOutputTextureFileType = crnlib::texture_file_types::cFormatCRN;
-		::detail::getVirtualOutputAssetFilenameAndCrunchOutputTextureFileType(configuration, assetFileFormat, assetName, input.virtualAssetOutputDirectory, textureSemantic, virtualOutputAssetFilename, crunchOutputTextureFileType);
+		::detail::getVirtualOutputAssetFilenameAndCrunchOutputTextureFileType(configuration, assetFileFormat, assetName, input.virtualAssetOutputDirectory, textureSemantic, ::detail::isTextureArray(rapidJsonValueTextureAssetCompiler), virtualOutputAssetFilename, crunchOutputTextureFileType);
 
 		// Check if changed
 		std::vector<CacheManager::CacheEntries> cacheEntries;
@@ -1609,7 +1920,19 @@ namespace RendererToolkit
 		const std::string assetName = std_filesystem::path(input.virtualAssetFilename).stem().generic_string();
 
 		// Sanity checks
-		if (inputFile.empty())
+		const bool textureArray = ::detail::isTextureArray(rapidJsonValueTextureAssetCompiler);
+		if (textureArray)
+		{
+			if (!inputFile.empty() || !normalMapInputFile.empty())
+			{
+				throw std::runtime_error("A texture array is defined by its texture array input files, an input file or normal map input file is invalid");
+			}
+			if (::detail::TextureSemantic::REFLECTION_CUBE_MAP == textureSemantic || ::detail::TextureSemantic::PACKED_CHANNELS == textureSemantic || ::detail::TextureSemantic::COLOR_CORRECTION_LOOKUP_TABLE == textureSemantic || ::detail::TextureSemantic::TERRAIN_HEIGHT_MAP == textureSemantic)
+			{
+				throw std::runtime_error("Texture arrays are only supported for 2D texture semantics");
+			}
+		}
+		else if (inputFile.empty())
 		{
 			bool throwException = true;
 			if (::detail::TextureSemantic::REFLECTION_CUBE_MAP == textureSemantic || ::detail::TextureSemantic::PACKED_CHANNELS == textureSemantic)
@@ -1635,13 +1958,17 @@ namespace RendererToolkit
 		// Get output related settings
 		std::string virtualOutputAssetFilename;
 		crnlib::texture_file_types::format crunchOutputTextureFileType = crnlib::texture_file_types::cFormatCRN;
-		::detail::getVirtualOutputAssetFilenameAndCrunchOutputTextureFileType(configuration, assetFileFormat, assetName, input.virtualAssetOutputDirectory, textureSemantic, virtualOutputAssetFilename, crunchOutputTextureFileType);
+		::detail::getVirtualOutputAssetFilenameAndCrunchOutputTextureFileType(configuration, assetFileFormat, assetName, input.virtualAssetOutputDirectory, textureSemantic, ::detail::isTextureArray(rapidJsonValueTextureAssetCompiler), virtualOutputAssetFilename, crunchOutputTextureFileType);
 
-		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there)
+		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there), if so try to restore the compiled file from the content cache
 		std::vector<CacheManager::CacheEntries> cacheEntries;
-		if (::detail::checkIfChanged(input, configuration, rapidJsonValueTextureAssetCompiler, textureSemantic, virtualInputAssetFilename, virtualOutputAssetFilename, cacheEntries))
+		if (::detail::checkIfChanged(input, configuration, rapidJsonValueTextureAssetCompiler, textureSemantic, virtualInputAssetFilename, virtualOutputAssetFilename, cacheEntries) && !input.cacheManager.tryRestoreFromContentCache(cacheEntries.back(), input.dependencySourceAssetIds))
 		{
-			if (::detail::TextureSemantic::COLOR_CORRECTION_LOOKUP_TABLE == textureSemantic)
+			if (textureArray)
+			{
+				detail::convertTextureArray(input, configuration, rapidJsonValueTextureAssetCompiler, virtualOutputAssetFilename.c_str(), textureSemantic, createMipmaps, mipmapBlurriness);
+			}
+			else if (::detail::TextureSemantic::COLOR_CORRECTION_LOOKUP_TABLE == textureSemantic)
 			{
 				detail::convertColorCorrectionLookupTable(input.context.getFileManager(), virtualInputAssetFilename.c_str(), virtualOutputAssetFilename.c_str());
 			}
@@ -0,0 +1,392 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/Helper/AssetDependencyGraph.h"
+#include "RendererToolkit/Context.h"
+
+#include <RendererRuntime/Core/File/MemoryFile.h>
+#include <RendererRuntime/Core/File/IFileManager.h>
+
+#include <algorithm>
+#include <unordered_set>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		namespace AssetDependencyGraph
+		{
+			static const uint32_t FORMAT_TYPE	 = RendererRuntime::StringId("AssetDependencyGraph");
+			static const uint32_t FORMAT_VERSION = 1;
+		}
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void getAssetDependencyGraphFilename(const RendererRuntime::IFileManager& fileManager, const std::string& projectName, const std::string& rendererTarget, std::string& virtualDirectoryName, std::string& virtualFilename)
+		{
+			virtualDirectoryName = std::string(fileManager.getLocalDataMountPoint()) + "/RendererToolkit";
+			virtualFilename = virtualDirectoryName + '/' + projectName + '_' + rendererTarget + ".asset_dependency_graph";
+		}
+
+		void writeInputFiles(RendererRuntime::MemoryFile& memoryFile, const RendererToolkit::AssetDependencyGraph::InputFiles& inputFiles)
+		{
+			const uint32_t numberOfInputFiles = static_cast<uint32_t>(inputFiles.size());
+			memoryFile.write(&numberOfInputFiles, sizeof(uint32_t));
+			for (const RendererToolkit::AssetDependencyGraph::InputFile& inputFile : inputFiles)
+			{
+				const uint32_t numberOfCharacters = static_cast<uint32_t>(inputFile.virtualFilename.length());
+				memoryFile.write(&numberOfCharacters, sizeof(uint32_t));
+				memoryFile.write(inputFile.virtualFilename.data(), numberOfCharacters);
+				memoryFile.write(&inputFile.fileSize, sizeof(int64_t));
+				memoryFile.write(&inputFile.fileTime, sizeof(int64_t));
+			}
+		}
+
+		void readInputFiles(RendererRuntime::MemoryFile& memoryFile, RendererToolkit::AssetDependencyGraph::InputFiles& inputFiles)
+		{
+			uint32_t numberOfInputFiles = 0;
+			memoryFile.read(&numberOfInputFiles, sizeof(uint32_t));
+			inputFiles.resize(numberOfInputFiles);
+			for (RendererToolkit::AssetDependencyGraph::InputFile& inputFile : inputFiles)
+			{
+				uint32_t numberOfCharacters = 0;
+				memoryFile.read(&numberOfCharacters, sizeof(uint32_t));
+				inputFile.virtualFilename.resize(numberOfCharacters);
+				if (numberOfCharacters > 0)
+				{
+					memoryFile.read(&inputFile.virtualFilename[0], numberOfCharacters);
+				}
+				memoryFile.read(&inputFile.fileSize, sizeof(int64_t));
+				memoryFile.read(&inputFile.fileTime, sizeof(int64_t));
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	AssetDependencyGraph::AssetDependencyGraph(const Context& context, const std::string& projectName, const std::string& rendererTarget) :
+		mContext(context),
+		mProjectName(projectName),
+		mRendererTarget(rendererTarget),
+		mDirty(false)
+	{
+		load();
+	}
+
+	AssetDependencyGraph::~AssetDependencyGraph()
+	{
+		// Nothing here
+	}
+
+	const AssetDependencyGraph::Node* AssetDependencyGraph::tryGetNode(uint32_t sourceAssetId) const
+	{
+		Nodes::const_iterator iterator = mNodes.find(sourceAssetId);
+		return (mNodes.cend() != iterator) ? &iterator->second : nullptr;
+	}
+
+	void AssetDependencyGraph::fillInputFiles(const VirtualFilenames& virtualInputFilenames, InputFiles& inputFiles) const
+	{
+		const RendererRuntime::IFileManager& fileManager = mContext.getFileManager();
+		inputFiles.resize(virtualInputFilenames.size());
+		for (size_t i = 0; i < virtualInputFilenames.size(); ++i)
+		{
+			InputFile& inputFile = inputFiles[i];
+			inputFile.virtualFilename = virtualInputFilenames[i];
+			inputFile.fileSize = fileManager.doesFileExist(inputFile.virtualFilename.c_str()) ? fileManager.getFileSize(inputFile.virtualFilename.c_str()) : -1;
+			inputFile.fileTime = (inputFile.fileSize >= 0) ? fileManager.getLastModificationTime(inputFile.virtualFilename.c_str()) : -1;
+		}
+	}
+
+	void AssetDependencyGraph::setNode(uint32_t sourceAssetId, const InputFiles& inputFiles, const SourceAssetIds& dependencySourceAssetIds, const RendererRuntime::AssetPackage::SortedAssetVector& outputAssets)
+	{
+		Node& node = mNodes[sourceAssetId];
+		node.inputFiles = inputFiles;
+		node.outputAssets = outputAssets;
+
+		// Sort the dependencies and remove duplicates as well as self-references
+		node.dependencySourceAssetIds = dependencySourceAssetIds;
+		std::sort(node.dependencySourceAssetIds.begin(), node.dependencySourceAssetIds.end());
+		node.dependencySourceAssetIds.erase(std::unique(node.dependencySourceAssetIds.begin(), node.dependencySourceAssetIds.end()), node.dependencySourceAssetIds.end());
+		node.dependencySourceAssetIds.erase(std::remove(node.dependencySourceAssetIds.begin(), node.dependencySourceAssetIds.end(), sourceAssetId), node.dependencySourceAssetIds.end());
+
+		// The asset dependency graph has to be saved
+		mDirty = true;
+	}
+
+	bool AssetDependencyGraph::removeUnknownNodes(const SourceAssetIds& sourceAssetIds)
+	{
+		const std::unordered_set<uint32_t> knownSourceAssetIds(sourceAssetIds.cbegin(), sourceAssetIds.cend());
+		bool removed = false;
+		Nodes::iterator iterator = mNodes.begin();
+		while (mNodes.end() != iterator)
+		{
+			if (knownSourceAssetIds.find(iterator->first) == knownSourceAssetIds.cend())
+			{
+				iterator = mNodes.erase(iterator);
+				removed = true;
+			}
+			else
+			{
+				++iterator;
+			}
+		}
+		if (removed)
+		{
+			mDirty = true;
+		}
+		return removed;
+	}
+
+	bool AssetDependencyGraph::updateProjectFiles(const VirtualFilenames& virtualProjectFilenames)
+	{
+		InputFiles projectFiles;
+		fillInputFiles(virtualProjectFilenames, projectFiles);
+		const bool changed = (projectFiles.size() != mProjectFiles.size() || !std::equal(projectFiles.cbegin(), projectFiles.cend(), mProjectFiles.cbegin(), [](const InputFile& left, const InputFile& right) { return (left.virtualFilename == right.virtualFilename && left.fileSize == right.fileSize && left.fileTime == right.fileTime); }));
+		if (changed)
+		{
+			// All assets depend on the project files (e.g. quality strategy and renderer targets), so forget everything we know
+			mProjectFiles = std::move(projectFiles);
+			mNodes.clear();
+			mDirty = true;
+		}
+		return changed;
+	}
+
+	void AssetDependencyGraph::getAssetsToCompile(const SourceAssetIds& sourceAssetIds, SourceAssetIds& changedSourceAssetIds, SourceAssetIds& unknownSourceAssetIds, SourceAssetIds& dependentSourceAssetIds) const
+	{
+		// Gather the changed and unknown assets
+		// -> Only the file sizes and file times of the input files are compared and the existence of the output files is checked, no file content is read
+		const RendererRuntime::IFileManager& fileManager = mContext.getFileManager();
+		SourceAssetIds changedOrUnknownSourceAssetIds;
+		for (uint32_t sourceAssetId : sourceAssetIds)
+		{
+			Nodes::const_iterator iterator = mNodes.find(sourceAssetId);
+			if (mNodes.cend() == iterator)
+			{
+				unknownSourceAssetIds.push_back(sourceAssetId);
+				changedOrUnknownSourceAssetIds.push_back(sourceAssetId);
+			}
+			else
+			{
+				const Node& node = iterator->second;
+				bool changed = areInputFilesChanged(node.inputFiles);
+				for (size_t i = 0; i < node.outputAssets.size() && !changed; ++i)
+				{
+					changed = !fileManager.doesFileExist(node.outputAssets[i].virtualFilename);
+				}
+				if (changed)
+				{
+					changedSourceAssetIds.push_back(sourceAssetId);
+					changedOrUnknownSourceAssetIds.push_back(sourceAssetId);
+				}
+			}
+		}
+
+		// Gather the transitive closure of the changed and unknown assets
+		getDependentAssets(changedOrUnknownSourceAssetIds, dependentSourceAssetIds);
+	}
+
+	void AssetDependencyGraph::getAssetsByInputFiles(const VirtualFilenames& virtualInputFilenames, SourceAssetIds& sourceAssetIds) const
+	{
+		const std::unordered_set<std::string> changedVirtualInputFilenames(virtualInputFilenames.cbegin(), virtualInputFilenames.cend());
+		for (const auto& nodeElement : mNodes)
+		{
+			for (const InputFile& inputFile : nodeElement.second.inputFiles)
+			{
+				if (changedVirtualInputFilenames.find(inputFile.virtualFilename) != changedVirtualInputFilenames.cend())
+				{
+					sourceAssetIds.push_back(nodeElement.first);
+					break;
+				}
+			}
+		}
+	}
+
+	void AssetDependencyGraph::getDependentAssets(const SourceAssetIds& sourceAssetIds, SourceAssetIds& dependentSourceAssetIds) const
+	{
+		if (sourceAssetIds.empty())
+		{
+			// Nothing to do
+			return;
+		}
+
+		// Build the reverse dependency edges
+		std::unordered_map<uint32_t, SourceAssetIds> dependentsBySourceAssetId;
+		for (const auto& nodeElement : mNodes)
+		{
+			for (uint32_t dependencySourceAssetId : nodeElement.second.dependencySourceAssetIds)
+			{
+				dependentsBySourceAssetId[dependencySourceAssetId].push_back(nodeElement.first);
+			}
+		}
+
+		// Walk the reverse dependency edges
+		std::unordered_set<uint32_t> visitedSourceAssetIds(sourceAssetIds.cbegin(), sourceAssetIds.cend());
+		SourceAssetIds pendingSourceAssetIds(sourceAssetIds);
+		while (!pendingSourceAssetIds.empty())
+		{
+			const uint32_t sourceAssetId = pendingSourceAssetIds.back();
+			pendingSourceAssetIds.pop_back();
+			std::unordered_map<uint32_t, SourceAssetIds>::const_iterator iterator = dependentsBySourceAssetId.find(sourceAssetId);
+			if (dependentsBySourceAssetId.cend() != iterator)
+			{
+				for (uint32_t dependentSourceAssetId : iterator->second)
+				{
+					if (visitedSourceAssetIds.insert(dependentSourceAssetId).second)
+					{
+						dependentSourceAssetIds.push_back(dependentSourceAssetId);
+						pendingSourceAssetIds.push_back(dependentSourceAssetId);
+					}
+				}
+			}
+		}
+	}
+
+	void AssetDependencyGraph::save()
+	{
+		// Do only save the asset dependency graph if writing local data is allowed
+		const RendererRuntime::IFileManager& fileManager = mContext.getFileManager();
+		if (mDirty && nullptr != fileManager.getLocalDataMountPoint())
+		{
+			RendererRuntime::MemoryFile memoryFile(0, 4096);
+			::detail::writeInputFiles(memoryFile, mProjectFiles);
+			const uint32_t numberOfNodes = static_cast<uint32_t>(mNodes.size());
+			memoryFile.write(&numberOfNodes, sizeof(uint32_t));
+			for (const auto& nodeElement : mNodes)
+			{
+				const Node& node = nodeElement.second;
+				memoryFile.write(&nodeElement.first, sizeof(uint32_t));
+				::detail::writeInputFiles(memoryFile, node.inputFiles);
+				const uint32_t numberOfDependencies = static_cast<uint32_t>(node.dependencySourceAssetIds.size());
+				memoryFile.write(&numberOfDependencies, sizeof(uint32_t));
+				memoryFile.write(node.dependencySourceAssetIds.data(), sizeof(uint32_t) * numberOfDependencies);
+				const uint32_t numberOfOutputAssets = static_cast<uint32_t>(node.outputAssets.size());
+				memoryFile.write(&numberOfOutputAssets, sizeof(uint32_t));
+				memoryFile.write(node.outputAssets.data(), sizeof(RendererRuntime::Asset) * numberOfOutputAssets);
+			}
+
+			// Save file
+			std::string virtualDirectoryName;
+			std::string virtualFilename;
+			::detail::getAssetDependencyGraphFilename(fileManager, mProjectName, mRendererTarget, virtualDirectoryName, virtualFilename);
+			if (fileManager.createDirectories(virtualDirectoryName.c_str()) && !memoryFile.writeLz4CompressedDataByVirtualFilename(::detail::AssetDependencyGraph::FORMAT_TYPE, ::detail::AssetDependencyGraph::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+			{
+				RENDERER_LOG(mContext, CRITICAL, "The renderer toolkit failed to save the asset dependency graph to \"%s\"", virtualFilename.c_str())
+			}
+			mDirty = false;
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void AssetDependencyGraph::load()
+	{
+		// Clear the asset dependency graph
+		mDirty = false;
+		mProjectFiles.clear();
+		mNodes.clear();
+
+		// Tell the memory mapped file about the LZ4 compressed data and decompress it at once
+		// -> No error if the file doesn't exist since the asset dependency graph might just not exist which is a valid situation, all assets are compiled in this case
+		const RendererRuntime::IFileManager& fileManager = mContext.getFileManager();
+		if (nullptr != fileManager.getLocalDataMountPoint())
+		{
+			std::string virtualDirectoryName;
+			std::string virtualFilename;
+			::detail::getAssetDependencyGraphFilename(fileManager, mProjectName, mRendererTarget, virtualDirectoryName, virtualFilename);
+			RendererRuntime::MemoryFile memoryFile;
+			if (fileManager.doesFileExist(virtualFilename.c_str()) && memoryFile.loadLz4CompressedDataByVirtualFilename(::detail::AssetDependencyGraph::FORMAT_TYPE, ::detail::AssetDependencyGraph::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+			{
+				memoryFile.decompress();
+				::detail::readInputFiles(memoryFile, mProjectFiles);
+				uint32_t numberOfNodes = 0;
+				memoryFile.read(&numberOfNodes, sizeof(uint32_t));
+				mNodes.reserve(numberOfNodes);
+				for (uint32_t i = 0; i < numberOfNodes; ++i)
+				{
+					uint32_t sourceAssetId = 0;
+					memoryFile.read(&sourceAssetId, sizeof(uint32_t));
+					Node& node = mNodes[sourceAssetId];
+					::detail::readInputFiles(memoryFile, node.inputFiles);
+					uint32_t numberOfDependencies = 0;
+					memoryFile.read(&numberOfDependencies, sizeof(uint32_t));
+					node.dependencySourceAssetIds.resize(numberOfDependencies);
+					memoryFile.read(node.dependencySourceAssetIds.data(), sizeof(uint32_t) * numberOfDependencies);
+					uint32_t numberOfOutputAssets = 0;
+					memoryFile.read(&numberOfOutputAssets, sizeof(uint32_t));
+					node.outputAssets.resize(numberOfOutputAssets);
+					memoryFile.read(node.outputAssets.data(), sizeof(RendererRuntime::Asset) * numberOfOutputAssets);
+				}
+			}
+		}
+	}
+
+	bool AssetDependencyGraph::areInputFilesChanged(const InputFiles& inputFiles) const
+	{
+		const RendererRuntime::IFileManager& fileManager = mContext.getFileManager();
+		for (const InputFile& inputFile : inputFiles)
+		{
+			if (!fileManager.doesFileExist(inputFile.virtualFilename.c_str()) || fileManager.getFileSize(inputFile.virtualFilename.c_str()) != inputFile.fileSize || fileManager.getLastModificationTime(inputFile.virtualFilename.c_str()) != inputFile.fileTime)
+			{
+				// Changed
+				return true;
+			}
+		}
+
+		// Not changed
+		return false;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
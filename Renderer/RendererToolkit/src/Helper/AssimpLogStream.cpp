@@ -26,6 +26,28 @@
 #include <stdexcept>
 
 
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		static std::mutex g_AssimpDefaultLoggerMutex;
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -36,7 +58,8 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	AssimpLogStream::AssimpLogStream()
+	AssimpLogStream::AssimpLogStream() :
+		mMutexLock(::detail::g_AssimpDefaultLoggerMutex)
 	{
 		Assimp::DefaultLogger::create("", Assimp::Logger::NORMAL, aiDefaultLogStream_DEBUGGER);
 		Assimp::DefaultLogger::get()->attachStream(this, Assimp::DefaultLogger::Err);
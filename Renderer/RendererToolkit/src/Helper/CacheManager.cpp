@@ -30,6 +30,22 @@
 #include <RendererRuntime/Core/File/IFileManager.h>
 #include <RendererRuntime/Core/File/FileSystemHelper.h>
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'return': conversion from 'int' to 'std::char_traits<wchar_t>::int_type', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <chrono>
+	#include <thread>
+PRAGMA_WARNING_POP
+
+#include <algorithm>
+#include <cstring>	// For "memcpy()"
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -49,6 +65,21 @@ namespace
 			static const uint32_t FORMAT_TYPE	 = RendererRuntime::StringId("RendererToolkitCache");
 			static const uint32_t FORMAT_VERSION = 1;
 		}
+		namespace ContentCache
+		{
+			static const uint32_t FORMAT_TYPE	 = RendererRuntime::StringId("ContentCache");
+			static const uint32_t FORMAT_VERSION = 1;
+			#pragma pack(push)
+			#pragma pack(1)
+				struct ContentCacheHeader final
+				{
+					uint32_t formatType;
+					uint32_t formatVersion;
+					uint32_t numberOfDependencySourceAssetIds;
+					uint32_t numberOfBytes;
+				};
+			#pragma pack(pop)
+		}
 
 
 		//[-------------------------------------------------------]
@@ -79,6 +110,120 @@ namespace
 			return false;
 		}
 
+		uint64_t hashData(const void* data, size_t numberOfBytes, uint64_t hash)
+		{
+			return RendererRuntime::Math::calculateFNV1a64(static_cast<const uint8_t*>(data), static_cast<uint32_t>(numberOfBytes), hash);
+		}
+
+		bool readFile(const RendererRuntime::IFileManager& fileManager, const std::string& virtualFilename, std::vector<uint8_t>& data)
+		{
+			RendererRuntime::IFile* file = fileManager.openFile(RendererRuntime::IFileManager::FileMode::READ, virtualFilename.c_str());
+			if (nullptr != file)
+			{
+				data.resize(file->getNumberOfBytes());
+				if (!data.empty())
+				{
+					file->read(data.data(), data.size());
+				}
+				fileManager.closeFile(*file);
+
+				// Done
+				return true;
+			}
+
+			// Error!
+			return false;
+		}
+
+		bool restoreContentCacheFile(const RendererRuntime::IFileManager& fileManager, const std::string& virtualContentCacheFilename, const std::string& virtualDestinationFilename, std::vector<uint32_t>& dependencySourceAssetIds)
+		{
+			// Read the content cache file and validate it, the file might have been written by another renderer toolkit version
+			std::vector<uint8_t> data;
+			if (!readFile(fileManager, virtualContentCacheFilename, data) || data.size() < sizeof(ContentCache::ContentCacheHeader))
+			{
+				// Error!
+				return false;
+			}
+			const ContentCache::ContentCacheHeader& contentCacheHeader = *reinterpret_cast<const ContentCache::ContentCacheHeader*>(data.data());
+			const size_t numberOfDependencyBytes = sizeof(uint32_t) * contentCacheHeader.numberOfDependencySourceAssetIds;
+			if (contentCacheHeader.formatType != ContentCache::FORMAT_TYPE || contentCacheHeader.formatVersion != ContentCache::FORMAT_VERSION || data.size() != sizeof(ContentCache::ContentCacheHeader) + numberOfDependencyBytes + contentCacheHeader.numberOfBytes)
+			{
+				// Error!
+				return false;
+			}
+
+			// Write down the compiled file
+			RendererRuntime::IFile* file = fileManager.openFile(RendererRuntime::IFileManager::FileMode::WRITE, virtualDestinationFilename.c_str());
+			if (nullptr == file)
+			{
+				// Error!
+				return false;
+			}
+			const uint8_t* dependencyData = data.data() + sizeof(ContentCache::ContentCacheHeader);
+			file->write(dependencyData + numberOfDependencyBytes, contentCacheHeader.numberOfBytes);
+			fileManager.closeFile(*file);
+
+			// Done
+			const size_t numberOfDependencySourceAssetIds = dependencySourceAssetIds.size();
+			dependencySourceAssetIds.resize(numberOfDependencySourceAssetIds + contentCacheHeader.numberOfDependencySourceAssetIds);
+			if (numberOfDependencyBytes > 0)
+			{
+				memcpy(dependencySourceAssetIds.data() + numberOfDependencySourceAssetIds, dependencyData, numberOfDependencyBytes);
+			}
+			return true;
+		}
+
+		void storeContentCacheFile(const RendererToolkit::Context& context, const std::string& virtualContentCacheFilename, const std::string& virtualSourceFilename, std::vector<uint32_t> dependencySourceAssetIds)
+		{
+			const RendererRuntime::IFileManager& fileManager = context.getFileManager();
+			std::vector<uint8_t> data;
+			if (!readFile(fileManager, virtualSourceFilename, data) || !fileManager.createDirectories(std_filesystem::path(virtualContentCacheFilename).parent_path().generic_string().c_str()))
+			{
+				RENDERER_LOG(context, WARNING, "The renderer toolkit failed to store \"%s\" inside the content cache", virtualSourceFilename.c_str())
+				return;
+			}
+			std::sort(dependencySourceAssetIds.begin(), dependencySourceAssetIds.end());
+			dependencySourceAssetIds.erase(std::unique(dependencySourceAssetIds.begin(), dependencySourceAssetIds.end()), dependencySourceAssetIds.end());
+
+			// Write into a temporary file first and rename it afterwards, this way other compiler threads, processes or machines sharing the
+			// content cache directory never see partially written files
+			const std::string virtualTemporaryFilename = virtualContentCacheFilename + '.' + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + '_' + std::to_string(std::chrono::high_resolution_clock::now().time_since_epoch().count()) + ".tmp";
+			RendererRuntime::IFile* file = fileManager.openFile(RendererRuntime::IFileManager::FileMode::WRITE, virtualTemporaryFilename.c_str());
+			if (nullptr == file)
+			{
+				RENDERER_LOG(context, WARNING, "The renderer toolkit failed to store \"%s\" inside the content cache", virtualSourceFilename.c_str())
+				return;
+			}
+			{
+				ContentCache::ContentCacheHeader contentCacheHeader;
+				contentCacheHeader.formatType						= ContentCache::FORMAT_TYPE;
+				contentCacheHeader.formatVersion					= ContentCache::FORMAT_VERSION;
+				contentCacheHeader.numberOfDependencySourceAssetIds = static_cast<uint32_t>(dependencySourceAssetIds.size());
+				contentCacheHeader.numberOfBytes					= static_cast<uint32_t>(data.size());
+				file->write(&contentCacheHeader, sizeof(ContentCache::ContentCacheHeader));
+			}
+			file->write(dependencySourceAssetIds.data(), sizeof(uint32_t) * dependencySourceAssetIds.size());
+			file->write(data.data(), data.size());
+			fileManager.closeFile(*file);
+			const std::string absoluteTemporaryFilename = fileManager.mapVirtualToAbsoluteFilename(RendererRuntime::IFileManager::FileMode::WRITE, virtualTemporaryFilename.c_str());
+			try
+			{
+				std_filesystem::rename(absoluteTemporaryFilename, fileManager.mapVirtualToAbsoluteFilename(RendererRuntime::IFileManager::FileMode::WRITE, virtualContentCacheFilename.c_str()));
+			}
+			catch (const std::exception& e)
+			{
+				RENDERER_LOG(context, WARNING, "The renderer toolkit failed to store \"%s\" inside the content cache: %s", virtualSourceFilename.c_str(), e.what())
+				try
+				{
+					std_filesystem::remove(absoluteTemporaryFilename);
+				}
+				catch (const std::exception&)
+				{
+					// Nothing here, the temporary file is just left behind
+				}
+			}
+		}
+
 		void saveRendererToolkitCacheFile(const RendererToolkit::Context& context, const std::string& projectName, const RendererRuntime::MemoryFile& memoryFile)
 		{
 			std::string virtualDirectoryName;
@@ -112,7 +257,9 @@ namespace RendererToolkit
 	CacheManager::CacheManager(const Context& context, const std::string& projectName) :
 		mContext(context),
 		mProjectName(projectName),
-		mDiskCacheDirty(false)
+		mDiskCacheDirty(false),
+		mNumberOfContentCacheHits(0),
+		mNumberOfContentCacheMisses(0)
 	{
 		loadCache();
 	}
@@ -137,6 +284,18 @@ namespace RendererToolkit
 			return false;
 		}
 
+		{ // Remember the source files of the asset, they're the input files of the asset dependency graph node
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			std::vector<std::string>& assetVirtualSourceFilenames = mVirtualSourceFilenames[RendererRuntime::StringId(virtualAssetFilename.c_str())];
+			for (const std::string& virtualSourceFilename : virtualSourceFilenames)
+			{
+				if (std::find(assetVirtualSourceFilenames.cbegin(), assetVirtualSourceFilenames.cend(), virtualSourceFilename) == assetVirtualSourceFilenames.cend())
+				{
+					assetVirtualSourceFilenames.push_back(virtualSourceFilename);
+				}
+			}
+		}
+
 		// First check if all source files exists
 		const RendererRuntime::IFileManager& fileManager = mContext.getFileManager();
 		for (const std::string& virtualSourceFilename : virtualSourceFilenames)
@@ -170,22 +329,123 @@ namespace RendererToolkit
 		{
 			// Mark the asset file as changed when asset needs to be compiled and asset file itself didn't changed
 			// -> This is needed to get asset dependencies properly checked
+			std::lock_guard<std::mutex> mutexLock(mMutex);
 			mCheckedFilesStatus[RendererRuntime::StringId(virtualAssetFilename.c_str())].changed = true;
 		}
 
 		// File needs to be compiled either destination doesn't exists, the source data has changed or the asset file has changed
-		return (sourceFilesChanged || assetFileChanged || !destinationExists);
+		if (sourceFilesChanged || assetFileChanged || !destinationExists)
+		{
+			// Calculate the content address of the compiled file
+			// -> Neither the renderer target name nor the output directory is part of the content address, only the renderer target configuration relevant for the asset compilers
+			// -> The virtual asset filename is part of the content address since asset references relative to the asset are resolved to asset IDs
+			uint64_t configurationHash = 0;
+			{
+				std::lock_guard<std::mutex> mutexLock(mMutex);
+				ConfigurationHashes::const_iterator iterator = mConfigurationHashes.find(RendererRuntime::StringId(rendererTarget.c_str()));
+				if (mConfigurationHashes.cend() != iterator)
+				{
+					configurationHash = iterator->second;
+				}
+			}
+			const std::string destinationExtension = std_filesystem::path(virtualDestinationFilename).extension().generic_string();
+			uint64_t contentHash = ::detail::hashData(&::detail::ContentCache::FORMAT_VERSION, sizeof(uint32_t), RendererRuntime::Math::FNV1a_INITIAL_HASH_64);
+			contentHash = ::detail::hashData(&compilerVersion, sizeof(uint32_t), contentHash);
+			contentHash = ::detail::hashData(&configurationHash, sizeof(uint64_t), contentHash);
+			contentHash = ::detail::hashData(destinationExtension.data(), destinationExtension.length(), contentHash);
+			contentHash = ::detail::hashData(virtualAssetFilename.data(), virtualAssetFilename.length(), contentHash);
+			contentHash = ::detail::hashData(&cacheEntries.assetCacheEntry.fileHash, sizeof(uint64_t), contentHash);
+			for (size_t i = 0; i < virtualSourceFilenames.size(); ++i)
+			{
+				contentHash = ::detail::hashData(virtualSourceFilenames[i].data(), virtualSourceFilenames[i].length(), contentHash);
+				contentHash = ::detail::hashData(&cacheEntries.sourceCacheEntries[i].fileHash, sizeof(uint64_t), contentHash);
+			}
+			cacheEntries.contentHash = (0 != contentHash) ? contentHash : 1;
+			cacheEntries.virtualDestinationFilename = virtualDestinationFilename;
+
+			// Needs to be compiled
+			return true;
+		}
+
+		// Doesn't need to be compiled
+		return false;
 	}
 
 	void CacheManager::storeOrUpdateCacheEntries(const CacheEntries& cacheEntries)
 	{
-		for (const CacheEntry& sourceCacheEntry : cacheEntries.sourceCacheEntries)
+		std::string virtualContentCacheFilename;
+		{
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			for (const CacheEntry& sourceCacheEntry : cacheEntries.sourceCacheEntries)
+			{
+				storeOrUpdateCacheEntry(sourceCacheEntry);
+			}
+
+			// There must always be an asset metadata file
+			storeOrUpdateCacheEntry(cacheEntries.assetCacheEntry);
+
+			// The compiled file needs to be stored inside the content cache in case there was a content cache miss
+			if (nullptr != cacheEntries.dependencySourceAssetIds)
+			{
+				virtualContentCacheFilename = getVirtualContentCacheFilename(cacheEntries.contentHash);
+			}
+		}
+
+		// Store the compiled file inside the content cache, the mutex isn't locked while accessing files
+		if (!virtualContentCacheFilename.empty())
+		{
+			::detail::storeContentCacheFile(mContext, virtualContentCacheFilename, cacheEntries.virtualDestinationFilename, *cacheEntries.dependencySourceAssetIds);
+		}
+	}
+
+	void CacheManager::setContentCacheDirectory(const std::string& virtualContentCacheDirectory)
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		mVirtualContentCacheDirectory = virtualContentCacheDirectory;
+	}
+
+	void CacheManager::setRendererTargetConfigurationHash(const std::string& rendererTarget, uint64_t configurationHash)
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		mConfigurationHashes[RendererRuntime::StringId(rendererTarget.c_str())] = configurationHash;
+	}
+
+	bool CacheManager::tryRestoreFromContentCache(CacheEntries& cacheEntries, std::vector<uint32_t>& dependencySourceAssetIds)
+	{
+		std::string virtualContentCacheFilename;
+		{
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			virtualContentCacheFilename = getVirtualContentCacheFilename(cacheEntries.contentHash);
+		}
+		if (virtualContentCacheFilename.empty())
 		{
-			storeOrUpdateCacheEntry(sourceCacheEntry);
+			// The content cache is disabled
+			return false;
 		}
 
-		// There must always be an asset metadata file
-		storeOrUpdateCacheEntry(cacheEntries.assetCacheEntry);
+		// Restore the compiled file, the mutex isn't locked while accessing files
+		const RendererRuntime::IFileManager& fileManager = mContext.getFileManager();
+		if (fileManager.doesFileExist(virtualContentCacheFilename.c_str()) && ::detail::restoreContentCacheFile(fileManager, virtualContentCacheFilename, cacheEntries.virtualDestinationFilename, dependencySourceAssetIds))
+		{
+			// Content cache hit: The compiled file is up-to-date now
+			storeOrUpdateCacheEntries(cacheEntries);
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			++mNumberOfContentCacheHits;
+			return true;
+		}
+
+		// Content cache miss: Store the compiled file and the dependencies recorded during the compilation as soon as the cache entries are stored
+		cacheEntries.dependencySourceAssetIds = &dependencySourceAssetIds;
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		++mNumberOfContentCacheMisses;
+		return false;
+	}
+
+	void CacheManager::getContentCacheStatistics(uint32_t& numberOfHits, uint32_t& numberOfMisses)
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		numberOfHits = mNumberOfContentCacheHits;
+		numberOfMisses = mNumberOfContentCacheMisses;
 	}
 
 	bool CacheManager::checkIfFileIsModified(const std::string& rendererTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualSourceFilenames, const std::string& virtualDestinationFilename, uint32_t compilerVersion)
@@ -217,6 +477,7 @@ namespace RendererToolkit
 				{
 					// Asset file itself has not changed but the source file so mark the asset file as changed too
 					// Dependencies are defined via the asset file and with this change the asset which depends on this asset knows if the referenced asset has changed
+					std::lock_guard<std::mutex> mutexLock(mMutex);
 					mCheckedFilesStatus[RendererRuntime::StringId(virtualAssetFilename.c_str())].changed = true;
 				}
 			}
@@ -232,6 +493,7 @@ namespace RendererToolkit
 
 	bool CacheManager::dependencyFilesChanged(const std::vector<std::string>& virtualDependencyFilenames)
 	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
 		for (const std::string& virtualDependencyFilename : virtualDependencyFilenames)
 		{
 			CheckedFilesStatus::const_iterator iterator = mCheckedFilesStatus.find(RendererRuntime::StringId(virtualDependencyFilename.c_str()));
@@ -246,13 +508,51 @@ namespace RendererToolkit
 		return false;
 	}
 
+	void CacheManager::invalidateFile(const std::string& rendererTarget, const std::string& virtualFilename)
+	{
+		const RendererRuntime::StringId fileId(virtualFilename.c_str());
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		CheckedFilesStatus::iterator iterator = mCheckedFilesStatus.find(fileId);
+		if (mCheckedFilesStatus.end() != iterator)
+		{
+			// The file was already checked during this compilation run, the checked cache entry is up-to-date
+			iterator->second.changed = true;
+		}
+		else
+		{
+			// Forget the stored cache entry, the next check will hash the file and consider it as changed
+			const StoredCacheEntries::const_iterator storedIterator = mStoredCacheEntries.find(CacheEntry::generateKey(rendererTarget, fileId));
+			if (mStoredCacheEntries.cend() != storedIterator)
+			{
+				mStoredCacheEntries.erase(storedIterator);
+				mDiskCacheDirty = true;
+			}
+		}
+	}
+
+	void CacheManager::getVirtualSourceFilenames(const std::string& virtualAssetFilename, std::vector<std::string>& virtualSourceFilenames)
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		VirtualSourceFilenames::const_iterator iterator = mVirtualSourceFilenames.find(RendererRuntime::StringId(virtualAssetFilename.c_str()));
+		if (mVirtualSourceFilenames.cend() != iterator)
+		{
+			virtualSourceFilenames.insert(virtualSourceFilenames.end(), iterator->second.cbegin(), iterator->second.cend());
+		}
+	}
+
 	void CacheManager::clearInternalCache()
 	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
 		mCheckedFilesStatus.clear();
+		mVirtualSourceFilenames.clear();
+		mNumberOfContentCacheHits = 0;
+		mNumberOfContentCacheMisses = 0;
 	}
 
 	void CacheManager::saveCache()
 	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+
 		// Do only save the renderer toolkit cache if writing local data is allowed
 		if (mDiskCacheDirty && nullptr != mContext.getFileManager().getLocalDataMountPoint())
 		{
@@ -280,6 +580,7 @@ namespace RendererToolkit
 		mDiskCacheDirty = false;
 		mStoredCacheEntries.clear();
 		mCheckedFilesStatus.clear();
+		mVirtualSourceFilenames.clear();
 
 		// Load file
 		RendererRuntime::MemoryFile memoryFile;
@@ -328,26 +629,56 @@ namespace RendererToolkit
 
 		// Get cache entry data if an entry exists
 		RendererRuntime::StringId fileId(virtualFilename);
-		const bool hasFileEntry = fillEntryForFile(rendererTarget, fileId, cacheEntry);
-		if (hasFileEntry)
+		bool hasFileEntry = false;
 		{
-			// A file might be referenced by different assets so first check if the file was already checked by a previous call to this method
-			// If so return the result (the file shouldn't change between two checks while a compilation is running)
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			hasFileEntry = fillEntryForFile(rendererTarget, fileId, cacheEntry);
+			if (hasFileEntry)
 			{
-				CheckedFilesStatus::const_iterator iterator = mCheckedFilesStatus.find(fileId);
-				if (mCheckedFilesStatus.end() != iterator)
+				// A file might be referenced by different assets so first check if the file was already checked by a previous call to this method
+				// If so return the result (the file shouldn't change between two checks while a compilation is running)
+				{
+					CheckedFilesStatus::const_iterator iterator = mCheckedFilesStatus.find(fileId);
+					if (mCheckedFilesStatus.end() != iterator)
+					{
+						// Copy cache entry data from stored one
+						cacheEntry = iterator->second.cacheEntry;
+
+						// The file was already checked before simply return the result
+						return iterator->second.changed;
+					}
+				}
+
+				// First and faster step: Check file size and file time as well as the compiler version (needed so that we also detect compiler version changes here too)
+				if (cacheEntry.fileSize == fileSize && cacheEntry.fileTime == fileTime && cacheEntry.compilerVersion == compilerVersion)
 				{
-					// Copy cache entry data from stored one
-					cacheEntry = iterator->second.cacheEntry;
+					// The file has not changed -> store the result
+					CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
+					checkedFile.changed = false;
+					checkedFile.cacheEntry = cacheEntry;
 
-					// The file was already checked before simply return the result
-					return iterator->second.changed;
+					// Source file didn't changed
+					return false;
 				}
 			}
+		}
 
-			// First and faster step: Check file size and file time as well as the compiler version (needed so that we also detect compiler version changes here too)
-			if (cacheEntry.fileSize == fileSize && cacheEntry.fileTime == fileTime && cacheEntry.compilerVersion == compilerVersion)
+		// Current file differs in file size and/or file time or is yet unknown, calculate the 64-bit FNV-1a hash
+		// -> The mutex isn't locked while hashing so that multiple project compiler worker threads can hash files concurrently
+		// -> In case two worker threads check the same file at the same time, both come to the same result
+		const uint64_t fileHash = RendererRuntime::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualFilename);
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		if (hasFileEntry)
+		{
+			// Second step: Check the compiler version and the 64-bit FNV-1a hash
+			if (cacheEntry.fileHash == fileHash && cacheEntry.compilerVersion == compilerVersion)
 			{
+				// Hash of the file and compiler version didn't changed but store the changed file size/time
+				cacheEntry.fileSize		   = fileSize;
+				cacheEntry.fileTime		   = fileTime;
+				cacheEntry.compilerVersion = compilerVersion;
+				storeOrUpdateCacheEntry(cacheEntry);
+
 				// The file has not changed -> store the result
 				CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
 				checkedFile.changed = false;
@@ -358,37 +689,15 @@ namespace RendererToolkit
 			}
 			else
 			{
-				// Current file differs in file size and/or file time do the second step:
-				// Check the compiler version and the 64-bit FNV-1a hash
-				const uint64_t fileHash = RendererRuntime::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualFilename);
-				if (cacheEntry.fileHash == fileHash && cacheEntry.compilerVersion == compilerVersion)
-				{
-					// Hash of the file and compiler version didn't changed but store the changed file size/time
-					cacheEntry.fileSize		   = fileSize;
-					cacheEntry.fileTime		   = fileTime;
-					cacheEntry.compilerVersion = compilerVersion;
-					storeOrUpdateCacheEntry(cacheEntry);
-
-					// The file has not changed -> store the result
-					CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
-					checkedFile.changed = false;
-					checkedFile.cacheEntry = cacheEntry;
-
-					// Source file didn't changed
-					return false;
-				}
-				else
-				{
-					cacheEntry.fileSize		   = fileSize;
-					cacheEntry.fileTime		   = fileTime;
-					cacheEntry.fileHash		   = fileHash;
-					cacheEntry.compilerVersion = compilerVersion;
+				cacheEntry.fileSize		   = fileSize;
+				cacheEntry.fileTime		   = fileTime;
+				cacheEntry.fileHash		   = fileHash;
+				cacheEntry.compilerVersion = compilerVersion;
 
-					// The file has changed -> store the result
-					CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
-					checkedFile.changed = true;
-					checkedFile.cacheEntry = cacheEntry;
-				}
+				// The file has changed -> store the result
+				CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
+				checkedFile.changed = true;
+				checkedFile.cacheEntry = cacheEntry;
 			}
 		}
 		else
@@ -398,7 +707,7 @@ namespace RendererToolkit
 			cacheEntry.fileId			= fileId;
 			cacheEntry.fileSize			= fileSize;
 			cacheEntry.fileTime			= fileTime;
-			cacheEntry.fileHash			= RendererRuntime::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualFilename);
+			cacheEntry.fileHash			= fileHash;
 			cacheEntry.compilerVersion	= compilerVersion;
 
 			// The file had no cache entry yet -> store it as "has changed"
@@ -428,6 +737,25 @@ namespace RendererToolkit
 		mDiskCacheDirty = true;
 	}
 
+	std::string CacheManager::getVirtualContentCacheFilename(uint64_t contentHash) const
+	{
+		if (mVirtualContentCacheDirectory.empty() || 0 == contentHash)
+		{
+			// The content cache is disabled or the content address is unknown
+			return std::string();
+		}
+
+		// Use the first two hexadecimal digits as subdirectory to not end up with a single directory having hundreds of thousands of files
+		static const char HEXADECIMAL_DIGITS[] = "0123456789abcdef";
+		std::string hexadecimalContentHash(16, '0');
+		for (int i = 15; i >= 0; --i)
+		{
+			hexadecimalContentHash[static_cast<size_t>(i)] = HEXADECIMAL_DIGITS[contentHash & 0xf];
+			contentHash >>= 4;
+		}
+		return mVirtualContentCacheDirectory + '/' + hexadecimalContentHash.substr(0, 2) + '/' + hexadecimalContentHash + ".content";
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
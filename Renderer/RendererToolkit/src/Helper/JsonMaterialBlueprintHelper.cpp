@@ -669,19 +669,20 @@ namespace RendererToolkit
 						const rapidjson::Value& rapidJsonValue = rapidJsonMemberIteratorResource->value;
 						Renderer::DescriptorRange descriptorRange;
 
-						{ // Mandatory range type
+						{ // Mandatory range type and resource type
 							const rapidjson::Value& rapidJsonValueResourceType = rapidJsonValue["ResourceType"];
 							const char* resourceTypeAsString = rapidJsonValueResourceType.GetString();
 
 							// Define helper macros
-							#define IF_VALUE(name, rangeTypeValue)			 if (strcmp(resourceTypeAsString, name) == 0) descriptorRange.rangeType = Renderer::DescriptorRangeType::rangeTypeValue;
-							#define ELSE_IF_VALUE(name, rangeTypeValue) else if (strcmp(resourceTypeAsString, name) == 0) descriptorRange.rangeType = Renderer::DescriptorRangeType::rangeTypeValue;
+							// -> The exact texture type isn't known at this point, "Renderer::ResourceType::TEXTURE_2D" is used for all textures since renderer backends only need to tell images and texel buffers apart
+							#define IF_VALUE(name, rangeTypeValue, resourceTypeValue)			if (strcmp(resourceTypeAsString, name) == 0) { descriptorRange.rangeType = Renderer::DescriptorRangeType::rangeTypeValue; descriptorRange.resourceType = Renderer::ResourceType::resourceTypeValue; }
+							#define ELSE_IF_VALUE(name, rangeTypeValue, resourceTypeValue) else if (strcmp(resourceTypeAsString, name) == 0) { descriptorRange.rangeType = Renderer::DescriptorRangeType::rangeTypeValue; descriptorRange.resourceType = Renderer::ResourceType::resourceTypeValue; }
 
 							// Evaluate value
-							IF_VALUE("UNIFORM_BUFFER", UBV)
-							ELSE_IF_VALUE("TEXTURE_BUFFER", UAV)	// TODO(co) Usage of "UAV" is just a temporary hack", also search for other "UAV"-places
-							ELSE_IF_VALUE("SAMPLER_STATE", SAMPLER)
-							ELSE_IF_VALUE("TEXTURE", SRV)
+							IF_VALUE("UNIFORM_BUFFER", UBV, UNIFORM_BUFFER)
+							ELSE_IF_VALUE("TEXTURE_BUFFER", UAV, TEXTURE_BUFFER)	// TODO(co) Usage of "UAV" is just a temporary hack", also search for other "UAV"-places
+							ELSE_IF_VALUE("SAMPLER_STATE", SAMPLER, SAMPLER_STATE)
+							ELSE_IF_VALUE("TEXTURE", SRV, TEXTURE_2D)
 							else
 							{
 								throw std::runtime_error("Invalid resource type \"" + std::string(resourceTypeAsString) + "\", must be \"UniformBuffer\", \"TextureBuffer\", \"SamplerState\" or \"Texture\"");
@@ -0,0 +1,536 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/Helper/MeshOptimizer.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <vector>
+	#include <algorithm>
+PRAGMA_WARNING_POP
+
+#include <cmath>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t CACHE_SIZE = RendererToolkit::MeshOptimizer::VERTEX_CACHE_SIZE;
+		static const uint32_t INVALID_INDEX = ~0u;	///< Invalid triangle or vertex index
+
+		// Vertex score tuning values from Tom Forsyth, "Linear-Speed Vertex Cache Optimisation" ( https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html )
+		static const float CACHE_DECAY_POWER   = 1.5f;
+		static const float LAST_TRIANGLE_SCORE = 0.75f;
+		static const float VALENCE_BOOST_SCALE = 2.0f;
+		static const float VALENCE_BOOST_POWER = 0.5f;
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    FIFO post-transform vertex cache simulation
+		*
+		*  @remarks
+		*    A vertex is inside the cache if less than "CACHE_SIZE" vertices have been transformed since it has been transformed itself. This way the
+		*    cache can be flushed in constant time by advancing the timestamp.
+		*/
+		class FifoVertexCache final
+		{
+		public:
+			explicit FifoVertexCache(uint32_t numberOfVertices) :
+				mTimestamps(numberOfVertices, 0),
+				mTimestamp(CACHE_SIZE + 1)
+			{
+				// Nothing here
+			}
+
+			inline void flush()
+			{
+				mTimestamp += CACHE_SIZE + 1;
+			}
+
+			inline uint32_t processTriangle(const uint32_t* triangleIndices)
+			{
+				uint32_t numberOfCacheMisses = 0;
+				for (uint32_t i = 0; i < 3; ++i)
+				{
+					const uint32_t vertexIndex = triangleIndices[i];
+					if (mTimestamp - mTimestamps[vertexIndex] > CACHE_SIZE)
+					{
+						mTimestamps[vertexIndex] = mTimestamp;
+						++mTimestamp;
+						++numberOfCacheMisses;
+					}
+				}
+				return numberOfCacheMisses;
+			}
+
+		private:
+			std::vector<uint32_t> mTimestamps;
+			uint32_t			  mTimestamp;
+		};
+
+		struct Cluster final
+		{
+			uint32_t startTriangle;
+			uint32_t numberOfTriangles;
+			float	 sortKey;
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		float getVertexScore(int32_t cachePosition, uint32_t numberOfRemainingTriangles)
+		{
+			// Vertices without remaining triangles are of no interest
+			if (0 == numberOfRemainingTriangles)
+			{
+				return -1.0f;
+			}
+
+			// The vertices of the last triangle get a fixed score, so the order in which the vertices of a triangle are added doesn't matter
+			float score = 0.0f;
+			if (cachePosition >= 0)
+			{
+				if (cachePosition < 3)
+				{
+					score = LAST_TRIANGLE_SCORE;
+				}
+				else
+				{
+					score = std::pow(1.0f - static_cast<float>(cachePosition - 3) / static_cast<float>(CACHE_SIZE - 3), CACHE_DECAY_POWER);
+				}
+			}
+
+			// Boost vertices with only a few remaining triangles, this way lone triangles aren't left behind
+			score += VALENCE_BOOST_SCALE * std::pow(static_cast<float>(numberOfRemainingTriangles), -VALENCE_BOOST_POWER);
+
+			// Done
+			return score;
+		}
+
+		inline const glm::vec3& getPosition(const uint8_t* vertices, uint32_t numberOfBytesPerVertex, uint32_t vertexIndex)
+		{
+			return *reinterpret_cast<const glm::vec3*>(vertices + vertexIndex * numberOfBytesPerVertex);
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	void MeshOptimizer::analyzeVertexCache(const uint32_t* indices, uint32_t numberOfIndices, uint32_t numberOfVertices, VertexCacheStatistics& vertexCacheStatistics)
+	{
+		::detail::FifoVertexCache fifoVertexCache(numberOfVertices);
+		std::vector<bool> referencedVertices(numberOfVertices, false);
+		const uint32_t numberOfTriangles = numberOfIndices / 3;
+		for (uint32_t triangle = 0; triangle < numberOfTriangles; ++triangle)
+		{
+			const uint32_t* triangleIndices = indices + triangle * 3;
+			vertexCacheStatistics.numberOfTransformedVertices += fifoVertexCache.processTriangle(triangleIndices);
+			for (uint32_t i = 0; i < 3; ++i)
+			{
+				if (!referencedVertices[triangleIndices[i]])
+				{
+					referencedVertices[triangleIndices[i]] = true;
+					++vertexCacheStatistics.numberOfVertices;
+				}
+			}
+		}
+		vertexCacheStatistics.numberOfTriangles += numberOfTriangles;
+	}
+
+	void MeshOptimizer::optimizeVertexCache(uint32_t* indices, uint32_t numberOfIndices, uint32_t numberOfVertices)
+	{
+		const uint32_t numberOfTriangles = numberOfIndices / 3;
+		if (numberOfTriangles < 2)
+		{
+			// Nothing to reorder
+			return;
+		}
+
+		// Build the vertex to triangle adjacency, the adjacent triangles of a vertex are stored consecutively
+		std::vector<uint32_t> numberOfRemainingTriangles(numberOfVertices, 0);
+		for (uint32_t i = 0; i < numberOfIndices; ++i)
+		{
+			++numberOfRemainingTriangles[indices[i]];
+		}
+		std::vector<uint32_t> adjacentTriangleOffsets(numberOfVertices);
+		{
+			uint32_t offset = 0;
+			for (uint32_t vertex = 0; vertex < numberOfVertices; ++vertex)
+			{
+				adjacentTriangleOffsets[vertex] = offset;
+				offset += numberOfRemainingTriangles[vertex];
+			}
+		}
+		std::vector<uint32_t> adjacentTriangles(numberOfIndices);
+		{
+			std::vector<uint32_t> numberOfFilledTriangles(numberOfVertices, 0);
+			for (uint32_t i = 0; i < numberOfIndices; ++i)
+			{
+				const uint32_t vertex = indices[i];
+				adjacentTriangles[adjacentTriangleOffsets[vertex] + numberOfFilledTriangles[vertex]] = i / 3;
+				++numberOfFilledTriangles[vertex];
+			}
+		}
+
+		// Initial vertex and triangle scores
+		std::vector<int32_t> cachePositions(numberOfVertices, -1);
+		std::vector<float> vertexScores(numberOfVertices);
+		for (uint32_t vertex = 0; vertex < numberOfVertices; ++vertex)
+		{
+			vertexScores[vertex] = ::detail::getVertexScore(-1, numberOfRemainingTriangles[vertex]);
+		}
+		std::vector<bool> triangleAdded(numberOfTriangles, false);
+		uint32_t bestTriangle = 0;
+		{
+			float bestTriangleScore = -1.0f;
+			for (uint32_t triangle = 0; triangle < numberOfTriangles; ++triangle)
+			{
+				const uint32_t* triangleIndices = indices + triangle * 3;
+				const float triangleScore = vertexScores[triangleIndices[0]] + vertexScores[triangleIndices[1]] + vertexScores[triangleIndices[2]];
+				if (triangleScore > bestTriangleScore)
+				{
+					bestTriangle = triangle;
+					bestTriangleScore = triangleScore;
+				}
+			}
+		}
+
+		// Greedily add the triangle with the highest score, only the triangles using vertices inside the cache are considered
+		std::vector<uint32_t> optimizedIndices;
+		optimizedIndices.reserve(numberOfIndices);
+		uint32_t cache[::detail::CACHE_SIZE + 3];
+		uint32_t numberOfCacheEntries = 0;
+		uint32_t nextUnaddedTriangle = 0;
+		for (uint32_t numberOfAddedTriangles = 0; numberOfAddedTriangles < numberOfTriangles; ++numberOfAddedTriangles)
+		{
+			// In case the cache doesn't provide a candidate, continue with the next triangle which hasn't been added, yet
+			if (::detail::INVALID_INDEX == bestTriangle)
+			{
+				while (triangleAdded[nextUnaddedTriangle])
+				{
+					++nextUnaddedTriangle;
+				}
+				bestTriangle = nextUnaddedTriangle;
+			}
+
+			// Add the triangle and remove it from the adjacency of its vertices
+			const uint32_t* triangleIndices = indices + bestTriangle * 3;
+			triangleAdded[bestTriangle] = true;
+			optimizedIndices.insert(optimizedIndices.end(), triangleIndices, triangleIndices + 3);
+			for (uint32_t i = 0; i < 3; ++i)
+			{
+				const uint32_t vertex = triangleIndices[i];
+				uint32_t* vertexAdjacentTriangles = adjacentTriangles.data() + adjacentTriangleOffsets[vertex];
+				uint32_t& numberOfVertexAdjacentTriangles = numberOfRemainingTriangles[vertex];
+				for (uint32_t j = 0; j < numberOfVertexAdjacentTriangles; ++j)
+				{
+					if (vertexAdjacentTriangles[j] == bestTriangle)
+					{
+						vertexAdjacentTriangles[j] = vertexAdjacentTriangles[numberOfVertexAdjacentTriangles - 1];
+						--numberOfVertexAdjacentTriangles;
+						break;
+					}
+				}
+			}
+
+			{ // Update the cache: The vertices of the added triangle are moved to the front, vertices pushed beyond the cache size are evicted
+				uint32_t newCache[::detail::CACHE_SIZE + 3];
+				uint32_t numberOfNewCacheEntries = 0;
+				for (uint32_t i = 0; i < 3; ++i)
+				{
+					if (std::find(newCache, newCache + numberOfNewCacheEntries, triangleIndices[i]) == newCache + numberOfNewCacheEntries)
+					{
+						newCache[numberOfNewCacheEntries] = triangleIndices[i];
+						++numberOfNewCacheEntries;
+					}
+				}
+				for (uint32_t i = 0; i < numberOfCacheEntries; ++i)
+				{
+					const uint32_t vertex = cache[i];
+					if (vertex != triangleIndices[0] && vertex != triangleIndices[1] && vertex != triangleIndices[2])
+					{
+						newCache[numberOfNewCacheEntries] = vertex;
+						++numberOfNewCacheEntries;
+					}
+				}
+
+				// Update the vertex scores of all touched vertices
+				for (uint32_t i = 0; i < numberOfNewCacheEntries; ++i)
+				{
+					const uint32_t vertex = newCache[i];
+					cachePositions[vertex] = (i < ::detail::CACHE_SIZE) ? static_cast<int32_t>(i) : -1;
+					vertexScores[vertex] = ::detail::getVertexScore(cachePositions[vertex], numberOfRemainingTriangles[vertex]);
+				}
+
+				// Find the next best triangle, only the remaining triangles of the vertices inside the cache are candidates
+				numberOfCacheEntries = std::min(numberOfNewCacheEntries, ::detail::CACHE_SIZE);
+				bestTriangle = ::detail::INVALID_INDEX;
+				float bestTriangleScore = -1.0f;
+				for (uint32_t i = 0; i < numberOfCacheEntries; ++i)
+				{
+					const uint32_t vertex = newCache[i];
+					const uint32_t* vertexAdjacentTriangles = adjacentTriangles.data() + adjacentTriangleOffsets[vertex];
+					for (uint32_t j = 0; j < numberOfRemainingTriangles[vertex]; ++j)
+					{
+						const uint32_t triangle = vertexAdjacentTriangles[j];
+						const uint32_t* adjacentTriangleIndices = indices + triangle * 3;
+						const float triangleScore = vertexScores[adjacentTriangleIndices[0]] + vertexScores[adjacentTriangleIndices[1]] + vertexScores[adjacentTriangleIndices[2]];
+						if (triangleScore > bestTriangleScore)
+						{
+							bestTriangle = triangle;
+							bestTriangleScore = triangleScore;
+						}
+					}
+				}
+
+				// Keep the new cache
+				memcpy(cache, newCache, sizeof(uint32_t) * numberOfCacheEntries);
+			}
+		}
+
+		// Done
+		memcpy(indices, optimizedIndices.data(), sizeof(uint32_t) * numberOfIndices);
+	}
+
+	void MeshOptimizer::optimizeOverdraw(uint32_t* indices, uint32_t numberOfIndices, const uint8_t* vertices, uint32_t numberOfVertices, uint32_t numberOfBytesPerVertex, float threshold)
+	{
+		const uint32_t numberOfTriangles = numberOfIndices / 3;
+		if (numberOfTriangles < 2)
+		{
+			// Nothing to reorder
+			return;
+		}
+		::detail::FifoVertexCache fifoVertexCache(numberOfVertices);
+
+		// Hard cluster boundaries: A triangle missing the cache with all three vertices usually starts a new disjoint triangle patch, reordering those patches doesn't hurt the vertex cache
+		std::vector<uint32_t> hardClusterStarts;
+		for (uint32_t triangle = 0; triangle < numberOfTriangles; ++triangle)
+		{
+			if (fifoVertexCache.processTriangle(indices + triangle * 3) == 3 || 0 == triangle)
+			{
+				hardClusterStarts.push_back(triangle);
+			}
+		}
+
+		// Soft cluster boundaries: Split the hard clusters further as soon as a cluster reaches the average cache miss ratio of its hard cluster multiplied by the threshold
+		std::vector<uint32_t> clusterStarts;
+		for (size_t hardCluster = 0; hardCluster < hardClusterStarts.size(); ++hardCluster)
+		{
+			const uint32_t startTriangle = hardClusterStarts[hardCluster];
+			const uint32_t endTriangle = (hardCluster + 1 < hardClusterStarts.size()) ? hardClusterStarts[hardCluster + 1] : numberOfTriangles;
+
+			// Average cache miss ratio of the hard cluster when rendered on its own
+			uint32_t numberOfClusterCacheMisses = 0;
+			fifoVertexCache.flush();
+			for (uint32_t triangle = startTriangle; triangle < endTriangle; ++triangle)
+			{
+				numberOfClusterCacheMisses += fifoVertexCache.processTriangle(indices + triangle * 3);
+			}
+			const float clusterThreshold = threshold * static_cast<float>(numberOfClusterCacheMisses) / static_cast<float>(endTriangle - startTriangle);
+
+			// Split
+			clusterStarts.push_back(startTriangle);
+			fifoVertexCache.flush();
+			uint32_t numberOfRunningCacheMisses = 0;
+			uint32_t numberOfRunningTriangles = 0;
+			for (uint32_t triangle = startTriangle; triangle < endTriangle; ++triangle)
+			{
+				numberOfRunningCacheMisses += fifoVertexCache.processTriangle(indices + triangle * 3);
+				++numberOfRunningTriangles;
+				if (static_cast<float>(numberOfRunningCacheMisses) <= clusterThreshold * static_cast<float>(numberOfRunningTriangles))
+				{
+					clusterStarts.push_back(triangle + 1);
+					fifoVertexCache.flush();
+					numberOfRunningCacheMisses = 0;
+					numberOfRunningTriangles = 0;
+				}
+			}
+
+			// The last split might be the end of the hard cluster, and the last soft cluster is usually a bad one which is merged into the previous soft cluster
+			if (clusterStarts.back() == endTriangle)
+			{
+				clusterStarts.pop_back();
+			}
+			else if (clusterStarts.back() != startTriangle && static_cast<float>(numberOfRunningCacheMisses) > clusterThreshold * static_cast<float>(numberOfRunningTriangles))
+			{
+				clusterStarts.pop_back();
+			}
+		}
+		if (clusterStarts.size() < 2)
+		{
+			// Nothing to reorder
+			return;
+		}
+
+		// Gather the area weighted cluster centroids and normals as well as the mesh centroid
+		std::vector<::detail::Cluster> clusters(clusterStarts.size());
+		std::vector<glm::vec3> clusterCentroids(clusterStarts.size());
+		std::vector<glm::vec3> clusterNormals(clusterStarts.size());
+		glm::vec3 meshCentroid(0.0f);
+		float meshArea = 0.0f;
+		for (size_t clusterIndex = 0; clusterIndex < clusterStarts.size(); ++clusterIndex)
+		{
+			::detail::Cluster& cluster = clusters[clusterIndex];
+			cluster.startTriangle = clusterStarts[clusterIndex];
+			cluster.numberOfTriangles = ((clusterIndex + 1 < clusterStarts.size()) ? clusterStarts[clusterIndex + 1] : numberOfTriangles) - cluster.startTriangle;
+			glm::vec3 centroid(0.0f);
+			glm::vec3 normal(0.0f);
+			float area = 0.0f;
+			for (uint32_t triangle = cluster.startTriangle; triangle < cluster.startTriangle + cluster.numberOfTriangles; ++triangle)
+			{
+				const uint32_t* triangleIndices = indices + triangle * 3;
+				const glm::vec3& position0 = ::detail::getPosition(vertices, numberOfBytesPerVertex, triangleIndices[0]);
+				const glm::vec3& position1 = ::detail::getPosition(vertices, numberOfBytesPerVertex, triangleIndices[1]);
+				const glm::vec3& position2 = ::detail::getPosition(vertices, numberOfBytesPerVertex, triangleIndices[2]);
+				const glm::vec3 triangleNormal = glm::cross(position1 - position0, position2 - position0);
+				const float triangleArea = glm::length(triangleNormal);
+				centroid += (position0 + position1 + position2) * (triangleArea / 3.0f);
+				normal += triangleNormal;
+				area += triangleArea;
+			}
+			meshCentroid += centroid;
+			meshArea += area;
+			clusterCentroids[clusterIndex] = (area > 0.0f) ? centroid / area : centroid;
+			clusterNormals[clusterIndex] = normal;
+		}
+		if (meshArea > 0.0f)
+		{
+			meshCentroid /= meshArea;
+		}
+
+		// Sort key: Clusters facing away from the mesh centroid are likely to occlude other clusters and are drawn first
+		// -> The winding order depends on the import settings, for closed meshes the sign of the enclosed volume tells whether or not the normals point outwards
+		float signedVolume = 0.0f;
+		for (size_t clusterIndex = 0; clusterIndex < clusters.size(); ++clusterIndex)
+		{
+			const glm::vec3& normal = clusterNormals[clusterIndex];
+			const float normalLength = glm::length(normal);
+			const glm::vec3 centroidDirection = clusterCentroids[clusterIndex] - meshCentroid;
+			signedVolume += glm::dot(centroidDirection, normal);
+			clusters[clusterIndex].sortKey = (normalLength > 0.0f) ? glm::dot(centroidDirection, normal / normalLength) : 0.0f;
+		}
+		if (signedVolume < 0.0f)
+		{
+			for (::detail::Cluster& cluster : clusters)
+			{
+				cluster.sortKey = -cluster.sortKey;
+			}
+		}
+		std::stable_sort(clusters.begin(), clusters.end(), [](const ::detail::Cluster& left, const ::detail::Cluster& right) { return (left.sortKey > right.sortKey); });
+
+		// Write down the reordered clusters
+		std::vector<uint32_t> optimizedIndices;
+		optimizedIndices.reserve(numberOfIndices);
+		for (const ::detail::Cluster& cluster : clusters)
+		{
+			const uint32_t* clusterIndices = indices + cluster.startTriangle * 3;
+			optimizedIndices.insert(optimizedIndices.end(), clusterIndices, clusterIndices + cluster.numberOfTriangles * 3);
+		}
+		memcpy(indices, optimizedIndices.data(), sizeof(uint32_t) * numberOfIndices);
+	}
+
+	void MeshOptimizer::optimizeVertexFetch(uint8_t* vertices, uint32_t numberOfVertices, uint32_t numberOfBytesPerVertex, uint32_t* indices, uint32_t numberOfIndices)
+	{
+		// Assign the new vertex indices in the order the vertices are used by the triangles
+		std::vector<uint32_t> vertexRemap(numberOfVertices, ::detail::INVALID_INDEX);
+		uint32_t numberOfRemappedVertices = 0;
+		for (uint32_t i = 0; i < numberOfIndices; ++i)
+		{
+			uint32_t& newVertexIndex = vertexRemap[indices[i]];
+			if (::detail::INVALID_INDEX == newVertexIndex)
+			{
+				newVertexIndex = numberOfRemappedVertices;
+				++numberOfRemappedVertices;
+			}
+			indices[i] = newVertexIndex;
+		}
+
+		// Unused vertices are moved to the end
+		for (uint32_t vertex = 0; vertex < numberOfVertices; ++vertex)
+		{
+			if (::detail::INVALID_INDEX == vertexRemap[vertex])
+			{
+				vertexRemap[vertex] = numberOfRemappedVertices;
+				++numberOfRemappedVertices;
+			}
+		}
+
+		// Reorder the vertices
+		std::vector<uint8_t> optimizedVertices(static_cast<size_t>(numberOfVertices) * numberOfBytesPerVertex);
+		for (uint32_t vertex = 0; vertex < numberOfVertices; ++vertex)
+		{
+			memcpy(optimizedVertices.data() + static_cast<size_t>(vertexRemap[vertex]) * numberOfBytesPerVertex, vertices + static_cast<size_t>(vertex) * numberOfBytesPerVertex, numberOfBytesPerVertex);
+		}
+		memcpy(vertices, optimizedVertices.data(), optimizedVertices.size());
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
@@ -0,0 +1,516 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/Helper/MeshSimplifier.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <vector>
+	#include <algorithm>
+	#include <numeric>
+	#include <unordered_map>
+	#include <unordered_set>
+PRAGMA_WARNING_POP
+
+#include <cmath>
+#include <limits>
+#include <cassert>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t TEXTURE_COORDINATE_OFFSET = sizeof(float) * 3;	///< Byte offset of the texture coordinate inside a vertex, directly behind the position
+		static const double	  BORDER_PLANE_WEIGHT		= 10.0;					///< Weight of the planes perpendicular to open border edges, the higher the value the better the border shape is preserved
+		static const float	  MINIMUM_NORMAL_COSINE		= 0.1f;					///< Collapses rotating the normal of a remaining triangle by more than approximately 84 degrees are rejected
+
+		enum class VertexKind : uint8_t
+		{
+			MANIFOLD,	///< Inner vertex, can be collapsed onto any neighbour vertex
+			BORDER,		///< Vertex on an open border, can only be collapsed along the border
+			LOCKED		///< Vertex on an attribute seam or on non-manifold geometry, is never collapsed
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Symmetric 4x4 error quadric, sum of weighted squared distances to planes
+		*/
+		struct Quadric final
+		{
+			double a00, a11, a22, a01, a02, a12;	// Upper 3x3 matrix
+			double b0, b1, b2;						// Vector
+			double c;								// Scalar
+			double weight;							// Sum of the plane weights, used to get a weighted mean squared distance
+
+			void addPlane(const glm::dvec3& normal, double distance, double planeWeight)
+			{
+				a00 += planeWeight * normal.x * normal.x;
+				a11 += planeWeight * normal.y * normal.y;
+				a22 += planeWeight * normal.z * normal.z;
+				a01 += planeWeight * normal.x * normal.y;
+				a02 += planeWeight * normal.x * normal.z;
+				a12 += planeWeight * normal.y * normal.z;
+				b0  += planeWeight * normal.x * distance;
+				b1  += planeWeight * normal.y * distance;
+				b2  += planeWeight * normal.z * distance;
+				c   += planeWeight * distance * distance;
+				weight += planeWeight;
+			}
+
+			void add(const Quadric& quadric)
+			{
+				a00 += quadric.a00;
+				a11 += quadric.a11;
+				a22 += quadric.a22;
+				a01 += quadric.a01;
+				a02 += quadric.a02;
+				a12 += quadric.a12;
+				b0  += quadric.b0;
+				b1  += quadric.b1;
+				b2  += quadric.b2;
+				c   += quadric.c;
+				weight += quadric.weight;
+			}
+
+			double getError(const glm::vec3& position) const
+			{
+				const double x = position.x;
+				const double y = position.y;
+				const double z = position.z;
+				const double error = a00 * x * x + a11 * y * y + a22 * z * z + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) + 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+				return (weight > 0.0) ? std::abs(error) / weight : 0.0;
+			}
+		};
+
+		struct Collapse final
+		{
+			uint32_t sourceVertex;
+			uint32_t targetVertex;
+			double	 error;
+
+			inline bool operator < (const Collapse& collapse) const
+			{
+				return (error < collapse.error);
+			}
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		inline uint64_t getEdgeKey(uint32_t vertexA, uint32_t vertexB)
+		{
+			return (static_cast<uint64_t>(vertexA) << 32) | vertexB;
+		}
+
+		inline glm::vec3 getTriangleNormal(const glm::vec3& position0, const glm::vec3& position1, const glm::vec3& position2)
+		{
+			return glm::cross(position1 - position0, position2 - position0);
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	uint32_t MeshSimplifier::simplify(const uint32_t* indices, uint32_t numberOfIndices, const uint8_t* vertices, uint32_t numberOfVertices, uint32_t numberOfBytesPerVertex, uint32_t targetNumberOfIndices, float targetError, float textureCoordinateWeight, uint32_t* destinationIndices, float* resultError)
+	{
+		// Sanity checks
+		assert(0 == numberOfIndices % 3);
+		assert(numberOfBytesPerVertex >= ::detail::TEXTURE_COORDINATE_OFFSET + sizeof(float) * 2);
+
+		// Gather the positions and texture coordinates, the positions are scaled so that the largest bounding box edge has the length one
+		// -> This way the collapse error is relative to the mesh extent
+		std::vector<glm::vec3> positions(numberOfVertices);
+		std::vector<glm::vec2> textureCoordinates(numberOfVertices);
+		glm::vec3 minimumPosition(std::numeric_limits<float>::max());
+		glm::vec3 maximumPosition(std::numeric_limits<float>::lowest());
+		for (uint32_t i = 0; i < numberOfVertices; ++i)
+		{
+			const uint8_t* vertex = vertices + i * numberOfBytesPerVertex;
+			positions[i] = *reinterpret_cast<const glm::vec3*>(vertex);
+			textureCoordinates[i] = *reinterpret_cast<const glm::vec2*>(vertex + ::detail::TEXTURE_COORDINATE_OFFSET);
+			minimumPosition = glm::min(minimumPosition, positions[i]);
+			maximumPosition = glm::max(maximumPosition, positions[i]);
+		}
+		if (numberOfVertices > 0)
+		{
+			const glm::vec3 extent = maximumPosition - minimumPosition;
+			const float maximumExtent = std::max(extent.x, std::max(extent.y, extent.z));
+			const float scale = (maximumExtent > 0.0f) ? 1.0f / maximumExtent : 1.0f;
+			for (glm::vec3& position : positions)
+			{
+				position = (position - minimumPosition) * scale;
+			}
+		}
+
+		// Weld the vertices by position: Vertices with identical positions but different attributes reference the same position vertex
+		std::vector<uint32_t> positionVertices(numberOfVertices);
+		std::vector<uint32_t> numberOfWedges(numberOfVertices, 0);
+		{
+			std::vector<uint32_t> sortedVertices(numberOfVertices);
+			std::iota(sortedVertices.begin(), sortedVertices.end(), 0u);
+			std::sort(sortedVertices.begin(), sortedVertices.end(), [&positions](uint32_t vertexA, uint32_t vertexB)
+			{
+				const glm::vec3& positionA = positions[vertexA];
+				const glm::vec3& positionB = positions[vertexB];
+				return (positionA.x != positionB.x) ? (positionA.x < positionB.x) : ((positionA.y != positionB.y) ? (positionA.y < positionB.y) : (positionA.z < positionB.z));
+			});
+			for (uint32_t i = 0; i < numberOfVertices; ++i)
+			{
+				const uint32_t vertex = sortedVertices[i];
+				const uint32_t positionVertex = (i > 0 && positions[sortedVertices[i - 1]] == positions[vertex]) ? positionVertices[sortedVertices[i - 1]] : vertex;
+				positionVertices[vertex] = positionVertex;
+				++numberOfWedges[positionVertex];
+			}
+		}
+
+		// Copy the triangles, degenerated triangles are dropped
+		std::vector<uint32_t> currentIndices;
+		currentIndices.reserve(numberOfIndices);
+		for (uint32_t i = 0; i < numberOfIndices; i += 3)
+		{
+			const uint32_t positionVertex0 = positionVertices[indices[i]];
+			const uint32_t positionVertex1 = positionVertices[indices[i + 1]];
+			const uint32_t positionVertex2 = positionVertices[indices[i + 2]];
+			if (positionVertex0 != positionVertex1 && positionVertex0 != positionVertex2 && positionVertex1 != positionVertex2)
+			{
+				currentIndices.insert(currentIndices.end(), indices + i, indices + i + 3);
+			}
+		}
+
+		// Classify the vertices by using the directed position edges, an edge without opposite edge is an open border edge
+		std::vector<::detail::VertexKind> vertexKinds(numberOfVertices, ::detail::VertexKind::MANIFOLD);
+		{
+			std::unordered_map<uint64_t, uint32_t> positionEdges;
+			const size_t numberOfCurrentIndices = currentIndices.size();
+			for (size_t i = 0; i < numberOfCurrentIndices; i += 3)
+			{
+				for (uint32_t edge = 0; edge < 3; ++edge)
+				{
+					++positionEdges[::detail::getEdgeKey(positionVertices[currentIndices[i + edge]], positionVertices[currentIndices[i + (edge + 1) % 3]])];
+				}
+			}
+			std::vector<uint32_t> numberOfBorderEdges(numberOfVertices, 0);
+			for (const std::pair<const uint64_t, uint32_t>& positionEdge : positionEdges)
+			{
+				const uint32_t positionVertexA = static_cast<uint32_t>(positionEdge.first >> 32);
+				const uint32_t positionVertexB = static_cast<uint32_t>(positionEdge.first & 0xFFFFFFFF);
+				if (positionEdge.second > 1)
+				{
+					// Non-manifold edge
+					vertexKinds[positionVertexA] = vertexKinds[positionVertexB] = ::detail::VertexKind::LOCKED;
+				}
+				else if (positionEdges.find(::detail::getEdgeKey(positionVertexB, positionVertexA)) == positionEdges.cend())
+				{
+					++numberOfBorderEdges[positionVertexA];
+					++numberOfBorderEdges[positionVertexB];
+				}
+			}
+			for (uint32_t i = 0; i < numberOfVertices; ++i)
+			{
+				// Vertices on attribute seams as well as border vertices connecting multiple borders are locked
+				if (positionVertices[i] == i && ::detail::VertexKind::LOCKED != vertexKinds[i])
+				{
+					if (numberOfWedges[i] > 1 || numberOfBorderEdges[i] > 2)
+					{
+						vertexKinds[i] = ::detail::VertexKind::LOCKED;
+					}
+					else if (numberOfBorderEdges[i] > 0)
+					{
+						vertexKinds[i] = ::detail::VertexKind::BORDER;
+					}
+				}
+			}
+		}
+
+		// Setup the quadrics using the triangle planes weighted by the triangle area and the planes perpendicular to open border edges weighted by the squared edge length
+		std::vector<::detail::Quadric> quadrics(numberOfVertices, ::detail::Quadric());
+		{
+			std::unordered_set<uint64_t> positionEdges;
+			const size_t numberOfCurrentIndices = currentIndices.size();
+			for (size_t i = 0; i < numberOfCurrentIndices; i += 3)
+			{
+				for (uint32_t edge = 0; edge < 3; ++edge)
+				{
+					positionEdges.insert(::detail::getEdgeKey(positionVertices[currentIndices[i + edge]], positionVertices[currentIndices[i + (edge + 1) % 3]]));
+				}
+			}
+			for (size_t i = 0; i < numberOfCurrentIndices; i += 3)
+			{
+				const uint32_t triangleVertices[3] = { positionVertices[currentIndices[i]], positionVertices[currentIndices[i + 1]], positionVertices[currentIndices[i + 2]] };
+				const glm::dvec3 position0(positions[triangleVertices[0]]);
+				const glm::dvec3 normal = glm::cross(glm::dvec3(positions[triangleVertices[1]]) - position0, glm::dvec3(positions[triangleVertices[2]]) - position0);
+				const double normalLength = glm::length(normal);
+				if (normalLength <= 0.0)
+				{
+					continue;
+				}
+				const glm::dvec3 unitNormal = normal / normalLength;
+				const double area = normalLength * 0.5;
+				for (uint32_t triangleVertex : triangleVertices)
+				{
+					quadrics[triangleVertex].addPlane(unitNormal, -glm::dot(unitNormal, position0), area);
+				}
+
+				// Border edges
+				for (uint32_t edge = 0; edge < 3; ++edge)
+				{
+					const uint32_t positionVertexA = triangleVertices[edge];
+					const uint32_t positionVertexB = triangleVertices[(edge + 1) % 3];
+					if (positionEdges.find(::detail::getEdgeKey(positionVertexB, positionVertexA)) == positionEdges.cend())
+					{
+						const glm::dvec3 positionA(positions[positionVertexA]);
+						const glm::dvec3 edgeDirection = glm::dvec3(positions[positionVertexB]) - positionA;
+						const glm::dvec3 borderNormal = glm::cross(edgeDirection, unitNormal);
+						const double borderNormalLength = glm::length(borderNormal);
+						if (borderNormalLength > 0.0)
+						{
+							const glm::dvec3 unitBorderNormal = borderNormal / borderNormalLength;
+							const double planeWeight = glm::dot(edgeDirection, edgeDirection) * ::detail::BORDER_PLANE_WEIGHT;
+							quadrics[positionVertexA].addPlane(unitBorderNormal, -glm::dot(unitBorderNormal, positionA), planeWeight);
+							quadrics[positionVertexB].addPlane(unitBorderNormal, -glm::dot(unitBorderNormal, positionA), planeWeight);
+						}
+					}
+				}
+			}
+		}
+
+		// Collapse edges in multiple passes until the target is reached or there's no collapse within the error limit left
+		// -> Each pass gathers and sorts all collapse candidates and performs the cheapest collapses which don't influence each other
+		const double errorLimit = static_cast<double>(targetError) * static_cast<double>(targetError);
+		double maximumError = 0.0;
+		std::vector<::detail::Collapse> collapses;
+		std::vector<uint32_t> collapseTargets(numberOfVertices);
+		std::vector<bool> lockedVertices(numberOfVertices);
+		std::vector<uint32_t> vertexTriangleOffsets(numberOfVertices + 1);
+		std::vector<uint32_t> vertexTriangles;
+		std::unordered_set<uint64_t> positionEdges;
+		while (currentIndices.size() > targetNumberOfIndices)
+		{
+			const uint32_t numberOfTriangles = static_cast<uint32_t>(currentIndices.size() / 3);
+
+			{ // Build the vertex to triangle adjacency
+				std::fill(vertexTriangleOffsets.begin(), vertexTriangleOffsets.end(), 0u);
+				for (uint32_t index : currentIndices)
+				{
+					++vertexTriangleOffsets[index + 1];
+				}
+				std::partial_sum(vertexTriangleOffsets.begin(), vertexTriangleOffsets.end(), vertexTriangleOffsets.begin());
+				vertexTriangles.resize(currentIndices.size());
+				std::vector<uint32_t> vertexTriangleCounts(vertexTriangleOffsets.begin(), vertexTriangleOffsets.end() - 1);
+				for (uint32_t triangle = 0; triangle < numberOfTriangles; ++triangle)
+				{
+					for (uint32_t i = 0; i < 3; ++i)
+					{
+						vertexTriangles[vertexTriangleCounts[currentIndices[triangle * 3 + i]]++] = triangle;
+					}
+				}
+			}
+
+			// Gather the directed position edges of the current triangles
+			positionEdges.clear();
+			for (size_t i = 0; i < currentIndices.size(); i += 3)
+			{
+				for (uint32_t edge = 0; edge < 3; ++edge)
+				{
+					positionEdges.insert(::detail::getEdgeKey(positionVertices[currentIndices[i + edge]], positionVertices[currentIndices[i + (edge + 1) % 3]]));
+				}
+			}
+
+			// Gather the collapse candidates
+			// -> An inner edge is part of two triangles with opposite directions, so each direction is gathered exactly once
+			// -> An open border edge is part of a single triangle, so both directions are gathered at once
+			collapses.clear();
+			for (size_t i = 0; i < currentIndices.size(); i += 3)
+			{
+				for (uint32_t edge = 0; edge < 3; ++edge)
+				{
+					const uint32_t vertexA = currentIndices[i + edge];
+					const uint32_t vertexB = currentIndices[i + (edge + 1) % 3];
+					const bool openBorderEdge = (positionEdges.find(::detail::getEdgeKey(positionVertices[vertexB], positionVertices[vertexA])) == positionEdges.cend());
+					for (uint32_t direction = 0; direction < (openBorderEdge ? 2u : 1u); ++direction)
+					{
+						const uint32_t sourceVertex = (0 == direction) ? vertexA : vertexB;
+						const uint32_t targetVertex = (0 == direction) ? vertexB : vertexA;
+						const ::detail::VertexKind sourceVertexKind = vertexKinds[positionVertices[sourceVertex]];
+						if (::detail::VertexKind::MANIFOLD == sourceVertexKind || (::detail::VertexKind::BORDER == sourceVertexKind && openBorderEdge && ::detail::VertexKind::MANIFOLD != vertexKinds[positionVertices[targetVertex]]))
+						{
+							const glm::vec2 textureCoordinateDifference = textureCoordinates[sourceVertex] - textureCoordinates[targetVertex];
+							const double error = quadrics[positionVertices[sourceVertex]].getError(positions[targetVertex]) + static_cast<double>(textureCoordinateWeight * glm::dot(textureCoordinateDifference, textureCoordinateDifference));
+							if (error <= errorLimit)
+							{
+								collapses.push_back({sourceVertex, targetVertex, error});
+							}
+						}
+					}
+				}
+			}
+			if (collapses.empty())
+			{
+				// No collapse within the error limit left
+				break;
+			}
+			std::sort(collapses.begin(), collapses.end());
+
+			// Perform the cheapest collapses, the one-ring of a collapsed vertex is locked for the rest of the pass so the flip tests stay valid
+			std::iota(collapseTargets.begin(), collapseTargets.end(), 0u);
+			std::fill(lockedVertices.begin(), lockedVertices.end(), false);
+			const uint32_t numberOfTrianglesToRemove = numberOfTriangles - targetNumberOfIndices / 3;
+			uint32_t numberOfRemovedTriangles = 0;
+			uint32_t numberOfCollapses = 0;
+			for (const ::detail::Collapse& collapse : collapses)
+			{
+				if (numberOfRemovedTriangles >= numberOfTrianglesToRemove)
+				{
+					break;
+				}
+				const uint32_t sourceVertex = collapse.sourceVertex;
+				const uint32_t targetVertex = collapse.targetVertex;
+				if (lockedVertices[sourceVertex] || lockedVertices[targetVertex])
+				{
+					continue;
+				}
+
+				// Reject the collapse if it would flip one of the remaining triangles
+				const uint32_t targetPositionVertex = positionVertices[targetVertex];
+				uint32_t numberOfCollapsedTriangles = 0;
+				bool flipped = false;
+				for (uint32_t i = vertexTriangleOffsets[sourceVertex]; i < vertexTriangleOffsets[sourceVertex + 1] && !flipped; ++i)
+				{
+					const uint32_t* triangleIndices = &currentIndices[vertexTriangles[i] * 3];
+					if (positionVertices[triangleIndices[0]] == targetPositionVertex || positionVertices[triangleIndices[1]] == targetPositionVertex || positionVertices[triangleIndices[2]] == targetPositionVertex)
+					{
+						// Triangle degenerates and is removed
+						++numberOfCollapsedTriangles;
+					}
+					else
+					{
+						glm::vec3 newPositions[3];
+						for (uint32_t j = 0; j < 3; ++j)
+						{
+							newPositions[j] = positions[(triangleIndices[j] == sourceVertex) ? targetVertex : triangleIndices[j]];
+						}
+						const glm::vec3 oldNormal = ::detail::getTriangleNormal(positions[triangleIndices[0]], positions[triangleIndices[1]], positions[triangleIndices[2]]);
+						const glm::vec3 newNormal = ::detail::getTriangleNormal(newPositions[0], newPositions[1], newPositions[2]);
+						flipped = (glm::dot(oldNormal, newNormal) < ::detail::MINIMUM_NORMAL_COSINE * glm::length(oldNormal) * glm::length(newNormal));
+					}
+				}
+				if (flipped)
+				{
+					continue;
+				}
+
+				// Collapse and lock the one-ring
+				collapseTargets[sourceVertex] = targetVertex;
+				quadrics[targetPositionVertex].add(quadrics[positionVertices[sourceVertex]]);
+				for (uint32_t i = vertexTriangleOffsets[sourceVertex]; i < vertexTriangleOffsets[sourceVertex + 1]; ++i)
+				{
+					const uint32_t* triangleIndices = &currentIndices[vertexTriangles[i] * 3];
+					lockedVertices[triangleIndices[0]] = lockedVertices[triangleIndices[1]] = lockedVertices[triangleIndices[2]] = true;
+				}
+				lockedVertices[targetVertex] = true;
+				numberOfRemovedTriangles += numberOfCollapsedTriangles;
+				maximumError = std::max(maximumError, collapse.error);
+				++numberOfCollapses;
+			}
+			if (0 == numberOfCollapses)
+			{
+				// All collapses within the error limit would flip triangles
+				break;
+			}
+
+			// Apply the collapses and drop the degenerated triangles
+			size_t numberOfWrittenIndices = 0;
+			for (size_t i = 0; i < currentIndices.size(); i += 3)
+			{
+				const uint32_t index0 = collapseTargets[currentIndices[i]];
+				const uint32_t index1 = collapseTargets[currentIndices[i + 1]];
+				const uint32_t index2 = collapseTargets[currentIndices[i + 2]];
+				if (positionVertices[index0] != positionVertices[index1] && positionVertices[index0] != positionVertices[index2] && positionVertices[index1] != positionVertices[index2])
+				{
+					currentIndices[numberOfWrittenIndices]	   = index0;
+					currentIndices[numberOfWrittenIndices + 1] = index1;
+					currentIndices[numberOfWrittenIndices + 2] = index2;
+					numberOfWrittenIndices += 3;
+				}
+			}
+			currentIndices.resize(numberOfWrittenIndices);
+		}
+
+		// Done
+		if (nullptr != resultError)
+		{
+			*resultError = static_cast<float>(std::sqrt(maximumError));
+		}
+		std::copy(currentIndices.begin(), currentIndices.end(), destinationIndices);
+		return static_cast<uint32_t>(currentIndices.size());
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
@@ -0,0 +1,315 @@
+/*********************************************************\
+ * Copyright (c) 2012-2018 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/Helper/ShaderBytecodeCompiler.h"
+#include "RendererToolkit/Context.h"
+
+#include <Renderer/Public/Renderer.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4061)	// warning C4061: enumerator '<x>' in switch of enum '<y>' is not explicitly handled by a case label
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from '<x>' to '<y>', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_List_node<_Ty,std::_Default_allocator_traits<_Alloc>::void_pointer>': default constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: '<x>': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <SPIRV/GlslangToSpv.h>
+	#include <glslang/MachineIndependent/localintermediate.h>
+PRAGMA_WARNING_POP
+
+#include <smol-v/smolv.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4548)	// warning C4548: expression before comma has no effect; expected expression with side-effect
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	#include <mutex>
+PRAGMA_WARNING_POP
+
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		std::once_flag GlslangInitializedOnceFlag;
+
+		// Settings from "glslang/StandAlone/ResourceLimits.cpp"
+		const TBuiltInResource DefaultTBuiltInResource = {
+			32,		///< MaxLights
+			6,		///< MaxClipPlanes
+			32,		///< MaxTextureUnits
+			32,		///< MaxTextureCoords
+			64,		///< MaxVertexAttribs
+			4096,	///< MaxVertexUniformComponents
+			64,		///< MaxVaryingFloats
+			32,		///< MaxVertexTextureImageUnits
+			80,		///< MaxCombinedTextureImageUnits
+			32,		///< MaxTextureImageUnits
+			4096,	///< MaxFragmentUniformComponents
+			32,		///< MaxDrawBuffers
+			128,	///< MaxVertexUniformVectors
+			8,		///< MaxVaryingVectors
+			16,		///< MaxFragmentUniformVectors
+			16,		///< MaxVertexOutputVectors
+			15,		///< MaxFragmentInputVectors
+			-8,		///< MinProgramTexelOffset
+			7,		///< MaxProgramTexelOffset
+			8,		///< MaxClipDistances
+			65535,	///< MaxComputeWorkGroupCountX
+			65535,	///< MaxComputeWorkGroupCountY
+			65535,	///< MaxComputeWorkGroupCountZ
+			1024,	///< MaxComputeWorkGroupSizeX
+			1024,	///< MaxComputeWorkGroupSizeY
+			64,		///< MaxComputeWorkGroupSizeZ
+			1024,	///< MaxComputeUniformComponents
+			16,		///< MaxComputeTextureImageUnits
+			8,		///< MaxComputeImageUniforms
+			8,		///< MaxComputeAtomicCounters
+			1,		///< MaxComputeAtomicCounterBuffers
+			60,		///< MaxVaryingComponents
+			64,		///< MaxVertexOutputComponents
+			64,		///< MaxGeometryInputComponents
+			128,	///< MaxGeometryOutputComponents
+			128,	///< MaxFragmentInputComponents
+			8,		///< MaxImageUnits
+			8,		///< MaxCombinedImageUnitsAndFragmentOutputs
+			8,		///< MaxCombinedShaderOutputResources
+			0,		///< MaxImageSamples
+			0,		///< MaxVertexImageUniforms
+			0,		///< MaxTessControlImageUniforms
+			0,		///< MaxTessEvaluationImageUniforms
+			0,		///< MaxGeometryImageUniforms
+			8,		///< MaxFragmentImageUniforms
+			8,		///< MaxCombinedImageUniforms
+			16,		///< MaxGeometryTextureImageUnits
+			256,	///< MaxGeometryOutputVertices
+			1024,	///< MaxGeometryTotalOutputComponents
+			1024,	///< MaxGeometryUniformComponents
+			64,		///< MaxGeometryVaryingComponents
+			128,	///< MaxTessControlInputComponents
+			128,	///< MaxTessControlOutputComponents
+			16,		///< MaxTessControlTextureImageUnits
+			1024,	///< MaxTessControlUniformComponents
+			4096,	///< MaxTessControlTotalOutputComponents
+			128,	///< MaxTessEvaluationInputComponents
+			128,	///< MaxTessEvaluationOutputComponents
+			16,		///< MaxTessEvaluationTextureImageUnits
+			1024,	///< MaxTessEvaluationUniformComponents
+			120,	///< MaxTessPatchComponents
+			32,		///< MaxPatchVertices
+			64,		///< MaxTessGenLevel
+			16,		///< MaxViewports
+			0,		///< MaxVertexAtomicCounters
+			0,		///< MaxTessControlAtomicCounters
+			0,		///< MaxTessEvaluationAtomicCounters
+			0,		///< MaxGeometryAtomicCounters
+			8,		///< MaxFragmentAtomicCounters
+			8,		///< MaxCombinedAtomicCounters
+			1,		///< MaxAtomicCounterBindings
+			0,		///< MaxVertexAtomicCounterBuffers
+			0,		///< MaxTessControlAtomicCounterBuffers
+			0,		///< MaxTessEvaluationAtomicCounterBuffers
+			0,		///< MaxGeometryAtomicCounterBuffers
+			1,		///< MaxFragmentAtomicCounterBuffers
+			1,		///< MaxCombinedAtomicCounterBuffers
+			16384,	///< MaxAtomicCounterBufferSize
+			4,		///< MaxTransformFeedbackBuffers
+			64,		///< MaxTransformFeedbackInterleavedComponents
+			8,		///< MaxCullDistances
+			8,		///< MaxCombinedClipAndCullDistances
+			4,		///< MaxSamples
+			{		///< limits
+				1,	///< nonInductiveForLoops
+				1,	///< whileLoops
+				1,	///< doWhileLoops
+				1,	///< generalUniformIndexing
+				1,	///< generalAttributeMatrixVectorIndexing
+				1,	///< generalVaryingIndexing
+				1,	///< generalSamplerIndexing
+				1,	///< generalVariableIndexing
+				1,	///< generalConstantMatrixVectorIndexing
+			}
+		};
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	bool ShaderBytecodeCompiler::isRendererBackendSupported(const char* rendererBackendName)
+	{
+		return (0 == strcmp(rendererBackendName, "OpenGL") || 0 == strcmp(rendererBackendName, "Vulkan"));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	ShaderBytecodeCompiler::ShaderBytecodeCompiler(const Context& context, const char* rendererBackendName) :
+		mContext(context),
+		mVulkan(0 == strcmp(rendererBackendName, "Vulkan"))
+	{
+		assert(isRendererBackendSupported(rendererBackendName));
+
+		// Initialize glslang once per process, afterwards glslang can be used by multiple threads at one and the same time
+		std::call_once(::detail::GlslangInitializedOnceFlag, []() { glslang::InitializeProcess(); });
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererRuntime::IShaderBytecodeCompiler methods ]
+	//[-------------------------------------------------------]
+	const char* ShaderBytecodeCompiler::getRendererName() const
+	{
+		return mVulkan ? "Vulkan" : "OpenGL";
+	}
+
+	const char* ShaderBytecodeCompiler::getShaderLanguageName() const
+	{
+		return "GLSL";
+	}
+
+	bool ShaderBytecodeCompiler::isZeroToOneClipZ() const
+	{
+		return true;
+	}
+
+	bool ShaderBytecodeCompiler::isUpperLeftOrigin() const
+	{
+		return true;
+	}
+
+	bool ShaderBytecodeCompiler::compileShaderSourceCode(RendererRuntime::ShaderType shaderType, const char* sourceCode, Renderer::ShaderBytecode& shaderBytecode)
+	{
+		// GLSL to intermediate
+		// -> Must match "OpenGLRenderer::ShaderLanguageSeparate::shaderSourceCodeToShaderBytecode()" respectively "VulkanRenderer::ShaderLanguageGlsl::createVkShaderModuleFromSourceCode()"
+		// -> OpenGL 4.1 (the best OpenGL version Mac OS X 10.11 supports, so lowest version we have to support), Vulkan uses OpenGL 4.5
+		const int glslVersion = mVulkan ? 450 : 410;
+		EShLanguage shLanguage = EShLangCount;
+		switch (shaderType)
+		{
+			case RendererRuntime::ShaderType::Vertex:
+				shLanguage = EShLangVertex;
+				break;
+
+			case RendererRuntime::ShaderType::TessellationControl:
+				shLanguage = EShLangTessControl;
+				break;
+
+			case RendererRuntime::ShaderType::TessellationEvaluation:
+				shLanguage = EShLangTessEvaluation;
+				break;
+
+			case RendererRuntime::ShaderType::Geometry:
+				shLanguage = EShLangGeometry;
+				break;
+
+			case RendererRuntime::ShaderType::Fragment:
+				shLanguage = EShLangFragment;
+				break;
+		}
+		glslang::TShader shader(shLanguage);
+		shader.setEnvInput(glslang::EShSourceGlsl, shLanguage, mVulkan ? glslang::EShClientVulkan : glslang::EShClientOpenGL, glslVersion);
+		shader.setEntryPoint("main");
+		shader.setStrings(&sourceCode, 1);	// "glslang::TShader::setStrings()" only stores the given pointer, it must remain valid until the shader has been parsed
+		const EShMessages shMessages = mVulkan ? static_cast<EShMessages>(EShMsgDefault | EShMsgSpvRules | EShMsgVulkanRules) : static_cast<EShMessages>(EShMsgDefault);
+		if (shader.parse(&::detail::DefaultTBuiltInResource, glslVersion, false, shMessages))
+		{
+			glslang::TProgram program;
+			program.addShader(&shader);
+			if (program.link(shMessages))
+			{
+				// Intermediate to SPIR-V
+				const glslang::TIntermediate* intermediate = program.getIntermediate(shLanguage);
+				if (nullptr != intermediate)
+				{
+					std::vector<unsigned int> spirv;
+					glslang::GlslangToSpv(*intermediate, spirv);
+
+					// Encode to SMOL-V: like Vulkan/Khronos SPIR-V, but smaller
+					// -> https://github.com/aras-p/smol-v
+					// -> http://aras-p.info/blog/2016/09/01/SPIR-V-Compression/
+					// -> Don't apply "spv::spirvbin_t::remap()" or the SMOL-V result will be bigger
+					smolv::ByteArray byteArray;
+					smolv::Encode(spirv.data(), sizeof(unsigned int) * spirv.size(), byteArray, smolv::kEncodeFlagStripDebugInfo);
+
+					// Done
+					shaderBytecode.setBytecodeCopy(static_cast<uint32_t>(byteArray.size()), reinterpret_cast<uint8_t*>(byteArray.data()));
+					return true;
+				}
+			}
+			else
+			{
+				// Failed to link the program
+				if (mContext.getLog().print(Renderer::ILog::Type::CRITICAL, sourceCode, __FILE__, static_cast<uint32_t>(__LINE__), "Failed to link the GLSL program: %s", program.getInfoLog()))
+				{
+					DEBUG_BREAK;
+				}
+			}
+		}
+		else
+		{
+			// Failed to parse the shader source code
+			if (mContext.getLog().print(Renderer::ILog::Type::CRITICAL, sourceCode, __FILE__, static_cast<uint32_t>(__LINE__), "Failed to parse the GLSL shader source code: %s", shader.getInfoLog()))
+			{
+				DEBUG_BREAK;
+			}
+		}
+
+		// Error!
+		return false;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
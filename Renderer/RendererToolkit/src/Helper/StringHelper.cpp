@@ -333,25 +333,30 @@ namespace RendererToolkit
 		if (isSourceAssetIdAsString(sourceAssetIdAsString))
 		{
 			// Source asset ID naming scheme "<name>.asset": Handle relative source asset references
+			RendererRuntime::AssetId sourceAssetId;
 			if (sourceAssetIdAsString.length() >= 2 && sourceAssetIdAsString.substr(0, 2) == "./")
 			{
 				// "./" = This directory
-				return RendererRuntime::StringId((input.virtualAssetInputDirectory + '/' + sourceAssetIdAsString.substr(2)).c_str());
+				sourceAssetId = RendererRuntime::StringId((input.virtualAssetInputDirectory + '/' + sourceAssetIdAsString.substr(2)).c_str());
 			}
 			else if (sourceAssetIdAsString.length() >= 3 && sourceAssetIdAsString.substr(0, 3) == "../")
 			{
 				// "../" = Parent directory
 				const std_filesystem::path resolvedAssetId = std_filesystem::path(input.virtualAssetInputDirectory + '/' + sourceAssetIdAsString);
 				const std_filesystem::path currentResolvedAssetId = RendererRuntime::FileSystemHelper::lexicallyNormal(resolvedAssetId);
-				return RendererRuntime::StringId(currentResolvedAssetId.generic_string().c_str());
+				sourceAssetId = RendererRuntime::StringId(currentResolvedAssetId.generic_string().c_str());
 			}
 			else
 			{
 				// If there's a "$ProjectName", resolve it by the project name
 				std::string resolvedSourceAssetIdAsString = sourceAssetIdAsString;
 				replaceFirstString(resolvedSourceAssetIdAsString, "$ProjectName", input.projectName);
-				return RendererRuntime::StringId(resolvedSourceAssetIdAsString.c_str());
+				sourceAssetId = RendererRuntime::StringId(resolvedSourceAssetIdAsString.c_str());
 			}
+
+			// The compiled asset depends on the referenced source asset
+			input.addDependencySourceAssetId(sourceAssetId);
+			return sourceAssetId;
 		}
 		else
 		{
@@ -411,7 +416,9 @@ namespace RendererToolkit
 		else
 		{
 			// Compiled or runtime generated asset ID naming scheme "<project name>/<asset type>/<asset category>/<asset name>"
-			return getAssetIdByString(assetIdAsString);
+			const RendererRuntime::AssetId assetId = getAssetIdByString(assetIdAsString);
+			input.addDependencyCompiledAssetId(assetId);
+			return assetId;
 		}
 	}
 
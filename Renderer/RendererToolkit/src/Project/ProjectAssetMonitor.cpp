@@ -18,6 +18,7 @@
 \*********************************************************/
 
 
+
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
@@ -26,10 +27,14 @@
 #include "RendererToolkit/Context.h"
 
 #include <RendererRuntime/IRendererRuntime.h>
+#include <RendererRuntime/Core/File/FileSystemHelper.h>
+#include <RendererRuntime/Core/Time/Stopwatch.h>
 #include <RendererRuntime/Core/Platform/PlatformManager.h>
 
 #include <FileWatcher/FileWatcher.h>
 
+#include <algorithm>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -40,6 +45,18 @@ namespace RendererToolkit
 
 	namespace detail
 	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const unsigned int WAIT_TIMEOUT_IN_MILLISECONDS	   = 250;	///< Maximum time the file watcher blocks while waiting for file actions, limits the shutdown latency
+		static const unsigned int DEBOUNCE_TIMEOUT_IN_MILLISECONDS = 100;	///< Time without new file actions before the changed files are compiled, editors tend to write a file in several steps
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
 		class FileWatchListener : public FW::FileWatchListener
 		{
 
@@ -63,56 +80,29 @@ namespace RendererToolkit
 
 			FileWatchListener& operator=(const FileWatchListener&) = delete;
 
-			void processFileActions()
+			inline size_t getNumberOfChangedFiles() const
 			{
-				if (!mFileActions.empty())
+				return mChangedVirtualFilenames.size();
+			}
+
+			void processChangedFiles()
+			{
+				if (!mChangedVirtualFilenames.empty())
 				{
-					// TODO(co) The current simple solution is not sufficient for large scale projects having ten thousands of assets: Add more efficient asset search which can handle asset dependencies as well
-					/*
-					const size_t numberOfFileActions = mFileActions.size();
-					for (size_t fileActionIndex = 0; fileActionIndex < numberOfFileActions; ++fileActionIndex)
+					// Compile only the assets affected by the changed files, the compiled assets are reloaded by "RendererToolkit::ProjectImpl::processCompilerQueue()" as soon as they're available
+					// TODO(co) At the moment, we only support modifying already existing asset data, we should add support for changes inside the runtime asset package as well
+					ProjectImpl& projectImpl = mProjectAssetMonitor.mProjectImpl;
+					try
 					{
-						const FileAction& fileAction = mFileActions[fileActionIndex];
-						*/
+						projectImpl.compileChangedAssets(mProjectAssetMonitor.mRendererTarget.c_str(), mChangedVirtualFilenames);
+						RENDERER_LOG(projectImpl.getContext(), INFORMATION, "Processed %u changed files in %.3f milliseconds after the first file action", mChangedVirtualFilenames.size(), static_cast<double>(mStopwatch.getMilliseconds()))
+					}
+					catch (const std::exception& e)
 					{
-						// Get the corresponding asset
-						const RendererRuntime::AssetPackage::SortedAssetVector& sortedAssetVector = mProjectAssetMonitor.mProjectImpl.getAssetPackage().getSortedAssetVector();
-						const size_t numberOfAssets = sortedAssetVector.size();
-						for (size_t i = 0; i < numberOfAssets; ++i)
-						{
-							const RendererRuntime::Asset& asset = sortedAssetVector[i];
-							try
-							{
-								if (mProjectAssetMonitor.mProjectImpl.checkAssetIsChanged(asset, mProjectAssetMonitor.mRendererTarget.c_str()))
-								{
-									// TODO(co) Performance: Add asset compiler queue so we can compile more then one asset at a time in background
-									// TODO(co) At the moment, we only support modifying already existing asset data, we should add support for changes inside the runtime asset package as well
-									RendererRuntime::AssetPackage outputAssetPackage;
-									mProjectAssetMonitor.mProjectImpl.compileAssetIncludingDependencies(asset, mProjectAssetMonitor.mRendererTarget.c_str(), outputAssetPackage);
-
-									// Inform the asset manager about the modified assets (just pass them individually, there's no real benefit in trying to apply "were's one, there are many" in this situation)
-									const RendererRuntime::AssetPackage::SortedAssetVector& sortedOutputAssetVector = outputAssetPackage.getSortedAssetVector();
-									const size_t numberOfOutputAssets = sortedOutputAssetVector.size();
-									for (size_t outputAssetIndex = 0; outputAssetIndex < numberOfOutputAssets; ++outputAssetIndex)
-									{
-										mProjectAssetMonitor.mRendererRuntime.reloadResourceByAssetId(sortedOutputAssetVector[outputAssetIndex].assetId);
-									}
-
-									// A compilation run has been finished do cleanup
-									mProjectAssetMonitor.mProjectImpl.onCompilationRunFinished();
-									break;
-								}
-							}
-							catch (const std::exception& e)
-							{
-								RENDERER_LOG(mProjectAssetMonitor.mProjectImpl.getContext(), CRITICAL, e.what())
-							}
-
-							// A compilation run has been finished do cleanup
-							mProjectAssetMonitor.mProjectImpl.onCompilationRunFinished();
-						}
+						// "RendererToolkit::ProjectImpl::compileChangedAssets()" already finished the failed compilation run
+						RENDERER_LOG(projectImpl.getContext(), CRITICAL, e.what())
 					}
-					mFileActions.clear();
+					mChangedVirtualFilenames.clear();
 				}
 			}
 
@@ -121,53 +111,47 @@ namespace RendererToolkit
 		//[ Public virtual FW::FileWatchListener methods          ]
 		//[-------------------------------------------------------]
 		public:
-			void handleFileAction(FW::WatchID, const FW::String&, const FW::String& filename, FW::Action action) override
+			void handleFileAction(FW::WatchID, const FW::String& dir, const FW::String& filename, FW::Action action) override
 			{
-				if (FW::Action::Modified == action)
+				if (FW::Action::Modified == action || FW::Action::Add == action)
 				{
-					// Sadly, we can and will get multiple modified events for one and the same modification, so we need to handle it in here
-					const size_t numberOfFileActions = mFileActions.size();
-					for (size_t fileActionIndex = 0; fileActionIndex < numberOfFileActions; ++fileActionIndex)
+					// Map the absolute filename to a virtual filename, the project directory is mounted using the project name
+					// -> Some editors save a file by writing a temporary file and renaming it, so added files are interesting as well
+					const std::string& absoluteProjectDirectory = mProjectAssetMonitor.mProjectImpl.getAbsoluteProjectDirectory();
+					const std::string absoluteFilename = RendererRuntime::FileSystemHelper::lexicallyNormal(std_filesystem::path(dir) / filename).generic_string();
+					if (absoluteFilename.length() <= absoluteProjectDirectory.length() || absoluteFilename.compare(0, absoluteProjectDirectory.length(), absoluteProjectDirectory) != 0 || '/' != absoluteFilename[absoluteProjectDirectory.length()])
 					{
-						const FileAction& fileAction = mFileActions[fileActionIndex];
-						if (fileAction.action == action && fileAction.filename == filename)
+						// Not inside the project directory
+						return;
+					}
+					const std::string virtualFilename = mProjectAssetMonitor.mProjectImpl.getProjectName() + absoluteFilename.substr(absoluteProjectDirectory.length());
+
+					// Sadly, we can and will get multiple file actions for one and the same modification, so we need to handle it in here
+					if (std::find(mChangedVirtualFilenames.cbegin(), mChangedVirtualFilenames.cend(), virtualFilename) == mChangedVirtualFilenames.cend())
+					{
+						if (mChangedVirtualFilenames.empty())
 						{
-							// No duplicates, please
-							return;
+							// Measure the latency from the first file action up to the point the changed assets have been compiled and reloaded
+							mStopwatch.start();
 						}
+						mChangedVirtualFilenames.push_back(virtualFilename);
 					}
-					mFileActions.push_back(FileAction(filename, action));
 				}
 			}
 
 
-		//[-------------------------------------------------------]
-		//[ Private definitions                                   ]
-		//[-------------------------------------------------------]
-		private:
-			struct FileAction final
-			{
-				FW::String filename;
-				FW::Action action;
-				FileAction(const FW::String& _filename, FW::Action _action) :
-					filename(_filename),
-					action(_action)
-				{
-					// Nothing here
-				}
-			};
-			typedef std::vector<FileAction> FileActions;
-
-
 		//[-------------------------------------------------------]
 		//[ Private data                                          ]
 		//[-------------------------------------------------------]
 		private:
-			ProjectAssetMonitor& mProjectAssetMonitor;
-			FileActions			 mFileActions;
+			ProjectAssetMonitor&		  mProjectAssetMonitor;
+			ProjectImpl::VirtualFilenames mChangedVirtualFilenames;	///< Virtual UTF-8 filenames of the changed files, without duplicates
+			RendererRuntime::Stopwatch	  mStopwatch;				///< Started as soon as the first file action has been received
 
 
 		};
+
+
 	}
 
 
@@ -200,18 +184,56 @@ namespace RendererToolkit
 		// Create the file watcher object
 		FW::FileWatcher fileWatcher;
 		detail::FileWatchListener fileWatchListener(*this);
-		const FW::WatchID watchID = fileWatcher.addWatch(mProjectImpl.getAbsoluteProjectDirectory(), &fileWatchListener, true);
+		const std::string& absoluteProjectDirectory = mProjectImpl.getAbsoluteProjectDirectory();
+		fileWatcher.addWatch(absoluteProjectDirectory, &fileWatchListener, true);
+		#ifdef LINUX
+			// The Linux implementation of the file watcher is using inotify which isn't recursive, so watch each directory individually
+			// TODO(co) Directories which are created while the project asset monitor is running aren't watched
+			for (const std_filesystem::directory_entry& directoryEntry : std_filesystem::recursive_directory_iterator(absoluteProjectDirectory))
+			{
+				if (std_filesystem::is_directory(directoryEntry.status()))
+				{
+					fileWatcher.addWatch(directoryEntry.path().generic_string(), &fileWatchListener, false);
+				}
+			}
+		#endif
 
 		// On startup we need to check for changes which were done while the project asset monitor wasn't running
-		mProjectImpl.compileAllAssets(mRendererTarget.c_str());
+		try
+		{
+			mProjectImpl.compileAllAssets(mRendererTarget.c_str());
+		}
+		catch (const std::exception& e)
+		{
+			// "RendererToolkit::ProjectImpl::compileAllAssets()" already finished the failed compilation run
+			RENDERER_LOG(mProjectImpl.getContext(), CRITICAL, e.what())
+		}
 
-		// Update the file watcher object as long as the project asset monitor is up-and-running
+		// Wait for file actions as long as the project asset monitor is up-and-running, there's no polling of the asset files
 		while (!mShutdownThread)
 		{
-			fileWatcher.update();
-			fileWatchListener.processFileActions();
+			fileWatcher.update(detail::WAIT_TIMEOUT_IN_MILLISECONDS);
+			if (fileWatchListener.getNumberOfChangedFiles() > 0)
+			{
+				// Debounce: Wait until there were no new file actions for a short time
+				RendererRuntime::Stopwatch stopwatch(true);
+				size_t numberOfChangedFiles = fileWatchListener.getNumberOfChangedFiles();
+				while (!mShutdownThread && stopwatch.getMilliseconds() < static_cast<float>(detail::DEBOUNCE_TIMEOUT_IN_MILLISECONDS))
+				{
+					fileWatcher.update(detail::DEBOUNCE_TIMEOUT_IN_MILLISECONDS);
+					if (fileWatchListener.getNumberOfChangedFiles() != numberOfChangedFiles)
+					{
+						numberOfChangedFiles = fileWatchListener.getNumberOfChangedFiles();
+						stopwatch.start();
+					}
+				}
 
-			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+				// Compile the assets affected by the changed files
+				if (!mShutdownThread)
+				{
+					fileWatchListener.processChangedFiles();
+				}
+			}
 		}
 	}
 
@@ -26,6 +26,8 @@
 #include "RendererToolkit/Helper/JsonHelper.h"
 #include "RendererToolkit/Helper/StringHelper.h"
 #include "RendererToolkit/Helper/CacheManager.h"
+#include "RendererToolkit/Helper/AssetDependencyGraph.h"
+#include "RendererToolkit/Helper/ShaderBytecodeCompiler.h"
 #include "RendererToolkit/AssetImporter/SketchfabAssetImporter.h"
 #include "RendererToolkit/AssetCompiler/MeshAssetCompiler.h"
 #include "RendererToolkit/AssetCompiler/SceneAssetCompiler.h"
@@ -44,11 +46,17 @@
 
 #include <RendererRuntime/IRendererRuntime.h>
 #include <RendererRuntime/Backend/RendererRuntimeImpl.h>
+#include <RendererRuntime/Core/Math/Math.h>
 #include <RendererRuntime/Core/File/MemoryFile.h>
 #include <RendererRuntime/Core/File/IFileManager.h>
 #include <RendererRuntime/Core/File/FileSystemHelper.h>
+#include <RendererRuntime/Core/Time/Stopwatch.h>
 #include <RendererRuntime/Core/Platform/PlatformManager.h>
 #include <RendererRuntime/Asset/Loader/AssetPackageFileFormat.h>
+#include <RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResource.h>
+#include <RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h>
+#include <RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateCompiler.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h>
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -65,6 +73,7 @@ PRAGMA_WARNING_PUSH
 PRAGMA_WARNING_POP
 
 #include <cassert>
+#include <memory>
 #include <algorithm>
 #include <unordered_set>
 
@@ -86,6 +95,29 @@ namespace
 			return (left.assetId < right.assetId);
 		}
 
+		uint8_t getCompilationStageByAssetCompilerTypeId(RendererToolkit::AssetCompilerTypeId assetCompilerTypeId)
+		{
+			// Textures, meshes, skeletons, shaders and vertex attributes don't depend on other assets
+			// -> Unknown asset types are put into the last stage, compiling them will fail with a proper error message
+			if (RendererToolkit::TextureAssetCompiler::TYPE_ID == assetCompilerTypeId || RendererToolkit::MeshAssetCompiler::TYPE_ID == assetCompilerTypeId ||
+				RendererToolkit::SkeletonAssetCompiler::TYPE_ID == assetCompilerTypeId || RendererToolkit::SkeletonAnimationAssetCompiler::TYPE_ID == assetCompilerTypeId ||
+				RendererToolkit::ShaderPieceAssetCompiler::TYPE_ID == assetCompilerTypeId || RendererToolkit::ShaderBlueprintAssetCompiler::TYPE_ID == assetCompilerTypeId ||
+				RendererToolkit::VertexAttributesAssetCompiler::TYPE_ID == assetCompilerTypeId)
+			{
+				return 0;
+			}
+			else if (RendererToolkit::MaterialBlueprintAssetCompiler::TYPE_ID == assetCompilerTypeId)
+			{
+				return 1;
+			}
+			else if (RendererToolkit::MaterialAssetCompiler::TYPE_ID == assetCompilerTypeId)
+			{
+				// Materials can derive from other materials, "RendererToolkit::ProjectImpl::compileAssets()" splits this stage into base material waves
+				return 2;
+			}
+			return 3;
+		}
+
 		void optionalQualityStrategy(const rapidjson::Value& rapidJsonValue, const char* propertyName, RendererToolkit::QualityStrategy& value)
 		{
 			if (rapidJsonValue.HasMember(propertyName))
@@ -113,6 +145,65 @@ namespace
 			}
 		}
 
+		uint64_t hashRapidJsonValue(const rapidjson::Value& rapidJsonValue, uint64_t hash)
+		{
+			const rapidjson::Type type = rapidJsonValue.GetType();
+			hash = RendererRuntime::Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&type), sizeof(rapidjson::Type), hash);
+			switch (type)
+			{
+				case rapidjson::kObjectType:
+					for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIterator = rapidJsonValue.MemberBegin(); rapidJsonMemberIterator != rapidJsonValue.MemberEnd(); ++rapidJsonMemberIterator)
+					{
+						hash = hashRapidJsonValue(rapidJsonMemberIterator->name, hash);
+						hash = hashRapidJsonValue(rapidJsonMemberIterator->value, hash);
+					}
+					break;
+
+				case rapidjson::kArrayType:
+					for (rapidjson::SizeType i = 0; i < rapidJsonValue.Size(); ++i)
+					{
+						hash = hashRapidJsonValue(rapidJsonValue[i], hash);
+					}
+					break;
+
+				case rapidjson::kStringType:
+					hash = RendererRuntime::Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(rapidJsonValue.GetString()), rapidJsonValue.GetStringLength(), hash);
+					break;
+
+				case rapidjson::kNumberType:
+				{
+					const double value = rapidJsonValue.GetDouble();
+					hash = RendererRuntime::Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&value), sizeof(double), hash);
+					break;
+				}
+
+				case rapidjson::kNullType:
+				case rapidjson::kFalseType:
+				case rapidjson::kTrueType:
+					// Nothing to do in here, the type is the value
+					break;
+			}
+			return hash;
+		}
+
+		uint64_t getRendererTargetConfigurationHash(const rapidjson::Value& rapidJsonValueTargets, const char* rendererTarget, RendererToolkit::QualityStrategy qualityStrategy)
+		{
+			// Only hash the configuration the asset compilers are reading, currently only the texture asset compiler is reading it
+			// -> The renderer target name itself isn't part of the hash, this way renderer targets sharing the same configuration share the content cache entries
+			uint64_t hash = RendererRuntime::Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&qualityStrategy), sizeof(RendererToolkit::QualityStrategy));
+			const rapidjson::Value& rapidJsonValueTextureTargets = rapidJsonValueTargets["TextureTargets"];
+			const rapidjson::Value& rapidJsonValueTextureTarget = rapidJsonValueTargets["RendererTargets"][rendererTarget]["TextureTarget"];
+			if (rapidJsonValueTextureTargets.HasMember(rapidJsonValueTextureTarget))
+			{
+				hash = hashRapidJsonValue(rapidJsonValueTextureTargets[rapidJsonValueTextureTarget], hash);
+			}
+			if (rapidJsonValueTargets.HasMember("TextureChannelPackings"))
+			{
+				hash = hashRapidJsonValue(rapidJsonValueTargets["TextureChannelPackings"], hash);
+			}
+			return hash;
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -137,10 +228,15 @@ namespace RendererToolkit
 		mQualityStrategy(QualityStrategy::PRODUCTION),
 		mRapidJsonDocument(nullptr),
 		mProjectAssetMonitor(nullptr),
-		mShutdownThread(false),
-		mCacheManager(nullptr)
+		mCacheManager(nullptr),
+		mNumberOfCompilerThreads(0),
+		mShutdownCompilerThread(false),
+		mCompilerRendererTarget(nullptr),
+		mCompilerAssetDependencyGraph(nullptr),
+		mNumberOfCompilingAssets(0)
 	{
-		mThread = std::thread(&ProjectImpl::threadWorker, this);
+		// Create the compiler threads, by default one per hardware thread
+		setNumberOfCompilerThreads(std::thread::hardware_concurrency());
 
 		// Setup asset compilers map
 		// TODO(co) Currently this is fixed build in, later on me might want to have this dynamic so we can plugin additional asset compilers
@@ -166,9 +262,8 @@ namespace RendererToolkit
 
 	ProjectImpl::~ProjectImpl()
 	{
-		// Shutdown worker thread
-		mShutdownThread = true;
-		mThread.join();
+		// Compiler threads shutdown
+		destroyCompilerThreads();
 
 		// Clear
 		clear();
@@ -186,61 +281,10 @@ namespace RendererToolkit
 		return mAssetPackage.tryGetVirtualFilenameByAssetId(assetId);
 	}
 
-	bool ProjectImpl::checkAssetIsChanged(const RendererRuntime::Asset& asset, const char* rendererTarget)
+	void ProjectImpl::compileAsset(const RendererRuntime::Asset& asset, const char* rendererTarget, RendererRuntime::AssetPackage& outputAssetPackage, SourceAssetIds& dependencySourceAssetIds)
 	{
-		const std::string& virtualAssetFilename = asset.virtualFilename;
-
-		// The renderer toolkit is now considered to be busy
-		mRendererToolkitImpl.setState(IRendererToolkit::State::BUSY);
-
-		// Parse JSON
-		rapidjson::Document rapidJsonDocument;
-		JsonHelper::loadDocumentByFilename(mContext.getFileManager(), virtualAssetFilename, "Asset", "1", rapidJsonDocument);
-
-		// Mandatory main sections of the asset
-		const rapidjson::Value& rapidJsonValueAsset = rapidJsonDocument["Asset"];
-		const rapidjson::Value& rapidJsonValueAssetMetadata = rapidJsonValueAsset["AssetMetadata"];
-
-		// Dispatch asset compiler
-		// TODO(co) Add multi-threading support: Add compiler queue which is processed in the background, ensure compiler instances are reused
-
-		// Get the asset input directory and asset output directory
-		const std::string virtualAssetPackageInputDirectory = mProjectName + '/' + mAssetPackageDirectoryName;
-		const std::string virtualAssetInputDirectory = std_filesystem::path(virtualAssetFilename).parent_path().generic_string();
-		const std::string assetType = rapidJsonValueAssetMetadata["AssetType"].GetString();
-		const std::string assetCategory = rapidJsonValueAssetMetadata["AssetCategory"].GetString();
-		const std::string virtualAssetOutputDirectory = getRenderTargetDataRootDirectory(rendererTarget) + '/' + mProjectName + '/' + mAssetPackageDirectoryName + '/' + assetType + '/' + assetCategory;
-
-		// Asset compiler input
-		IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, virtualAssetPackageInputDirectory, virtualAssetFilename, virtualAssetInputDirectory, virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds);
-
-		// Asset compiler configuration
-		AssetCompilers::const_iterator iterator = mAssetCompilers.find(AssetCompilerTypeId(assetType.c_str()));
-		if (mAssetCompilers.end() != iterator)
-		{
-			RENDERER_ASSERT(getContext(), nullptr != mRapidJsonDocument, "Invalid renderer toolkit Rapid JSON document")
-			const IAssetCompiler::Configuration configuration(rapidJsonDocument, (*mRapidJsonDocument)["Targets"], rendererTarget, mQualityStrategy);
-			try
-			{
-				return iterator->second->checkIfChanged(input, configuration);
-			}
-			catch (const std::exception&)
-			{
-				// In case of an "RendererToolkit::IAssetCompiler::checkIfChanged()"-exception, consider the asset as changed
-				return true;
-			}
-		}
-
-		// Not changed
-		return false;
-	}
-
-	void ProjectImpl::compileAsset(const RendererRuntime::Asset& asset, const char* rendererTarget, RendererRuntime::AssetPackage& outputAssetPackage)
-	{
-		// The renderer toolkit is now considered to be busy
-		mRendererToolkitImpl.setState(IRendererToolkit::State::BUSY);
-
 		// Open the input stream
+		// -> Called by the compiler threads, the renderer toolkit state and the renderer toolkit cache are handled by the thread coordinating the compilation run
 		const std::string& virtualAssetFilename = asset.virtualFilename;
 
 		// Parse JSON
@@ -253,7 +297,7 @@ namespace RendererToolkit
 		const rapidjson::Value& rapidJsonValueAssetMetadata = rapidJsonValueAsset["AssetMetadata"];
 
 		// Dispatch asset compiler
-		// TODO(co) Add multi-threading support: Add compiler queue which is processed in the background, ensure compiler instances are reused
+		// -> Called by the compiler threads, the asset compiler instances are stateless and shared by all compiler threads
 
 		// Get the asset input directory and asset output directory
 		const std::string virtualAssetPackageInputDirectory = mProjectName + '/' + mAssetPackageDirectoryName;
@@ -266,7 +310,7 @@ namespace RendererToolkit
 		fileManager.createDirectories(virtualAssetOutputDirectory.c_str());
 
 		// Asset compiler input
-		IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, virtualAssetPackageInputDirectory, virtualAssetFilename, virtualAssetInputDirectory, virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds);
+		IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, virtualAssetPackageInputDirectory, virtualAssetFilename, virtualAssetInputDirectory, virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds, dependencySourceAssetIds);
 
 		// Asset compiler configuration
 		RENDERER_ASSERT(getContext(), nullptr != mRapidJsonDocument, "Invalid renderer toolkit Rapid JSON document")
@@ -294,27 +338,11 @@ namespace RendererToolkit
 		{
 			throw std::runtime_error("Failed to compile asset with filename \"" + std::string(asset.virtualFilename) + "\": " + std::string(e.what()));
 		}
-
-		// Save renderer toolkit cache
-		mCacheManager->saveCache();
 	}
 
-	void ProjectImpl::compileAssetIncludingDependencies(const RendererRuntime::Asset& asset, const char* rendererTarget, RendererRuntime::AssetPackage& outputAssetPackage) noexcept
+	void ProjectImpl::compileChangedAssets(const char* rendererTarget, const VirtualFilenames& changedVirtualFilenames)
 	{
-		// Compile the given asset
-		compileAsset(asset, rendererTarget, outputAssetPackage);
-
-		// Compile other assets depending on the given asset, if necessary
-		const RendererRuntime::AssetPackage::SortedAssetVector& sortedAssetVector = mAssetPackage.getSortedAssetVector();
-		const size_t numberOfAssets = sortedAssetVector.size();
-		for (size_t i = 0; i < numberOfAssets; ++i)
-		{
-			const RendererRuntime::Asset& dependedAsset = sortedAssetVector[i];
-			if (checkAssetIsChanged(dependedAsset, rendererTarget) && &dependedAsset != &asset)
-			{
-				compileAsset(dependedAsset, rendererTarget, outputAssetPackage);
-			}
-		}
+		compileAssets(rendererTarget, &changedVirtualFilenames);
 	}
 
 	void ProjectImpl::onCompilationRunFinished()
@@ -351,7 +379,8 @@ namespace RendererToolkit
 
 		// Parse JSON
 		rapidjson::Document rapidJsonDocument;
-		JsonHelper::loadDocumentByFilename(fileManager, mProjectName + '/' + mProjectName + ".project", "Project", "1", rapidJsonDocument);
+		mVirtualProjectFilenames.push_back(mProjectName + '/' + mProjectName + ".project");
+		JsonHelper::loadDocumentByFilename(fileManager, mVirtualProjectFilenames.back(), "Project", "1", rapidJsonDocument);
 
 		// Read project metadata
 		const rapidjson::Value& rapidJsonValueProject = rapidJsonDocument["Project"];
@@ -393,6 +422,7 @@ namespace RendererToolkit
 
 		// Setup project folder for cache manager, it will store there its data
 		mCacheManager = new CacheManager(mContext, mProjectName);
+		setupContentCache();
 
 		// The renderer toolkit is now considered to be idle
 		mRendererToolkitImpl.setState(IRendererToolkit::State::IDLE);
@@ -426,89 +456,135 @@ namespace RendererToolkit
 
 	void ProjectImpl::compileAllAssets(const char* rendererTarget)
 	{
-		RendererRuntime::AssetPackage outputAssetPackage;
+		compileAssets(rendererTarget, nullptr);
+	}
 
-		// Discover changed assets
-		const RendererRuntime::AssetPackage::SortedAssetVector& sortedAssetVector = mAssetPackage.getSortedAssetVector();
-		const size_t numberOfAssets = sortedAssetVector.size();
-		std::vector<RendererRuntime::AssetId> changedAssetIds;
-		changedAssetIds.reserve(numberOfAssets);
-		RENDERER_LOG(mContext, INFORMATION, "Checking %u assets for changes", numberOfAssets)
-		for (size_t i = 0; i < numberOfAssets; ++i)
+	void ProjectImpl::startupAssetMonitor(RendererRuntime::IRendererRuntime& rendererRuntime, const char* rendererTarget)
+	{
+		if (nullptr == mProjectAssetMonitor)
 		{
-			const RendererRuntime::Asset& asset = sortedAssetVector[i];
-			if (checkAssetIsChanged(asset, rendererTarget))
+			mProjectAssetMonitor = new ProjectAssetMonitor(*this, rendererRuntime, rendererTarget);
+		}
+	}
+
+	void ProjectImpl::shutdownAssetMonitor()
+	{
+		if (nullptr != mProjectAssetMonitor)
+		{
+			delete mProjectAssetMonitor;
+			mProjectAssetMonitor = nullptr;
+		}
+	}
+
+	uint32_t ProjectImpl::getNumberOfCompilerThreads() const
+	{
+		return mNumberOfCompilerThreads;
+	}
+
+	void ProjectImpl::setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads)
+	{
+		// At least one compiler thread is needed to process the compiler queue
+		numberOfCompilerThreads = std::max(1u, numberOfCompilerThreads);
+		if (mNumberOfCompilerThreads != numberOfCompilerThreads)
+		{
+			// Compiler threads shutdown
+			destroyCompilerThreads();
+
+			// Create the compiler threads processing the compiler queue
+			mNumberOfCompilerThreads = numberOfCompilerThreads;
+			mCompilerThreads.reserve(mNumberOfCompilerThreads);
+			mShutdownCompilerThread = false;
+			for (uint32_t i = 0; i < mNumberOfCompilerThreads; ++i)
 			{
-				changedAssetIds.push_back(asset.assetId);
+				mCompilerThreads.push_back(std::thread(&ProjectImpl::compilerThreadWorker, this));
 			}
 		}
-		RENDERER_LOG(mContext, INFORMATION, "Found %u changed assets", changedAssetIds.size())
+	}
 
-		// Compile all changed assets
-		if (!changedAssetIds.empty())
+	void ProjectImpl::setContentCacheDirectory(RendererRuntime::AbsoluteDirectoryName absoluteDirectoryName)
+	{
+		mAbsoluteContentCacheDirectory = absoluteDirectoryName;
+		if (nullptr != mCacheManager)
 		{
-			for (size_t i = 0; i < numberOfAssets; ++i)
-			{
-				// TODO(co) Only compile assets if a change has been detected
-				RENDERER_LOG(mContext, INFORMATION, "Compiling asset %u of %u", i + 1, numberOfAssets)
-				const RendererRuntime::Asset& asset = sortedAssetVector[i];
-				compileAsset(asset, rendererTarget, outputAssetPackage);
+			setupContentCache();
+		}
+	}
 
-				// Call "RendererRuntime::IRendererRuntime::reloadResourceByAssetId()" directly after an asset has been compiled to see changes as early as possible
-				if (nullptr != mProjectAssetMonitor)
-				{
-					RendererRuntime::AssetId sourceAssetId = asset.assetId;
-					if (std::find(changedAssetIds.cbegin(), changedAssetIds.cend(), sourceAssetId) != changedAssetIds.cend())
-					{
-						SourceAssetIdToCompiledAssetId::const_iterator iterator = mSourceAssetIdToCompiledAssetId.find(sourceAssetId);
-						if (iterator == mSourceAssetIdToCompiledAssetId.cend())
-						{
-							throw std::runtime_error(std::string("Source asset ID ") + std::to_string(sourceAssetId) + " is unknown");
-						}
-						mProjectAssetMonitor->mRendererRuntime.reloadResourceByAssetId(iterator->second);
-					}
-				}
+	void ProjectImpl::compilePipelineStateObjectCache(RendererRuntime::IRendererRuntime& rendererRuntime, const char* rendererTarget, bool allShaderCombinations)
+	{
+		// Without renderer backend shader bytecode support (e.g. when using the null renderer) the shader bytecode is compiled offline for the renderer backend of the renderer target
+		std::unique_ptr<ShaderBytecodeCompiler> shaderBytecodeCompiler;
+		if (!rendererRuntime.getRenderer().getCapabilities().shaderBytecode)
+		{
+			RENDERER_ASSERT(getContext(), nullptr != mRapidJsonDocument, "Invalid renderer toolkit Rapid JSON document")
+			const char* rendererBackendName = (*mRapidJsonDocument)["Targets"]["RendererTargets"][rendererTarget]["RendererBackend"].GetString();
+			if (!ShaderBytecodeCompiler::isRendererBackendSupported(rendererBackendName))
+			{
+				throw std::runtime_error("Failed to compile the pipeline state object cache of renderer target \"" + std::string(rendererTarget) + "\": The renderer backend \"" + rendererBackendName + "\" doesn't support shader bytecode and offline shader bytecode compilation is only supported for OpenGL and Vulkan");
 			}
+			shaderBytecodeCompiler = std::unique_ptr<ShaderBytecodeCompiler>(new ShaderBytecodeCompiler(mContext, rendererBackendName));
+		}
+		RendererRuntime::ShaderBlueprintResourceManager& shaderBlueprintResourceManager = rendererRuntime.getShaderBlueprintResourceManager();
+		shaderBlueprintResourceManager.setShaderBytecodeCompiler(shaderBytecodeCompiler.get());
 
-			{ // Write runtime asset package
-				RendererRuntime::AssetPackage::SortedAssetVector& sortedOutputAssetVector = outputAssetPackage.getWritableSortedAssetVector();
-				RendererRuntime::MemoryFile memoryFile(0, 4096);
-
-				// Ensure the asset package is sorted
-				std::sort(sortedOutputAssetVector.begin(), sortedOutputAssetVector.end(), ::detail::orderByAssetId);
+		// The renderer toolkit is now considered to be busy
+		mRendererToolkitImpl.setState(IRendererToolkit::State::BUSY);
 
-				{ // Write down the asset package header
-					RendererRuntime::v1AssetPackage::AssetPackageHeader assetPackageHeader;
-					assetPackageHeader.numberOfAssets = static_cast<uint32_t>(sortedOutputAssetVector.size());
-					memoryFile.write(&assetPackageHeader, sizeof(RendererRuntime::v1AssetPackage::AssetPackageHeader));
+		// Let the pipeline state compiler build and compile the shaders asynchronous using all CPU cores
+		// -> The previous settings are restored after we're done
+		RendererRuntime::PipelineStateCompiler& pipelineStateCompiler = rendererRuntime.getPipelineStateCompiler();
+		const bool asynchronousCompilationEnabled = pipelineStateCompiler.isAsynchronousCompilationEnabled();
+		const uint32_t numberOfBuilderThreads = pipelineStateCompiler.getNumberOfBuilderThreads();
+		const uint32_t numberOfCompilerThreads = pipelineStateCompiler.getNumberOfCompilerThreads();
+		const uint32_t numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+		pipelineStateCompiler.setNumberOfBuilderThreads(numberOfThreads);
+		pipelineStateCompiler.setNumberOfCompilerThreads(numberOfThreads);
+		pipelineStateCompiler.setAsynchronousCompilationEnabled(true);
+		pipelineStateCompiler.resetStatistics();
+
+		// Recorded pipeline state signatures: The locally saved pipeline state object cache contains the pipeline state signatures used at runtime
+		RENDERER_LOG(mContext, INFORMATION, "Compiling the recorded pipeline state signatures")
+		rendererRuntime.loadPipelineStateObjectCache();
+
+		// Exhaustive enumeration of all shader combinations
+		if (allShaderCombinations)
+		{
+			RendererRuntime::MaterialBlueprintResourceManager& materialBlueprintResourceManager = rendererRuntime.getMaterialBlueprintResourceManager();
+			const uint32_t numberOfMaterialBlueprints = static_cast<uint32_t>(mCompiledMaterialBlueprintAssetIds.size());
+			for (uint32_t i = 0; i < numberOfMaterialBlueprints; ++i)
+			{
+				// Loading the material blueprint resource is blocking and also creates the mandatory pipeline state caches which act as fallback for the other ones
+				RENDERER_LOG(mContext, INFORMATION, "Compiling all shader combinations of material blueprint %u of %u", i + 1, numberOfMaterialBlueprints)
+				RendererRuntime::MaterialBlueprintResourceId materialBlueprintResourceId = RendererRuntime::getUninitialized<RendererRuntime::MaterialBlueprintResourceId>();
+				materialBlueprintResourceManager.loadMaterialBlueprintResourceByAssetId(mCompiledMaterialBlueprintAssetIds[i], materialBlueprintResourceId);
+				if (RendererRuntime::isInitialized(materialBlueprintResourceId))
+				{
+					materialBlueprintResourceManager.getById(materialBlueprintResourceId).createPipelineStateCaches(false);
 				}
-
-				// Write down the asset package content in one single burst
-				memoryFile.write(sortedOutputAssetVector.data(), sizeof(RendererRuntime::Asset) * sortedOutputAssetVector.size());
-
-				// Write LZ4 compressed output
-				memoryFile.writeLz4CompressedDataByVirtualFilename(RendererRuntime::StringId("AssetPackage"), RendererRuntime::v1AssetPackage::FORMAT_VERSION, mContext.getFileManager(), (getRenderTargetDataRootDirectory(rendererTarget) + '/' + mProjectName + '/' + mAssetPackageDirectoryName + '/' + mAssetPackageDirectoryName + ".assets").c_str());
 			}
 		}
 
-		// Compilation run finished clear internal caches/states
-		onCompilationRunFinished();
-	}
-
-	void ProjectImpl::startupAssetMonitor(RendererRuntime::IRendererRuntime& rendererRuntime, const char* rendererTarget)
-	{
-		if (nullptr == mProjectAssetMonitor)
+		// Write the pipeline state object cache next to the output asset package, this waits for the pipeline state compiler
+		const std::string virtualAssetPackageFilename = getRenderTargetDataRootDirectory(rendererTarget) + '/' + mProjectName + '/' + mAssetPackageDirectoryName + '/' + mAssetPackageDirectoryName + ".assets";
+		const bool saved = rendererRuntime.saveShippedPipelineStateObjectCache(mContext.getFileManager(), virtualAssetPackageFilename.c_str());
 		{
-			mProjectAssetMonitor = new ProjectAssetMonitor(*this, rendererRuntime, rendererTarget);
+			const RendererRuntime::PipelineStateCompiler::Statistics statistics = pipelineStateCompiler.getStatistics();
+			RENDERER_LOG(mContext, INFORMATION, "Pipeline state object cache: Built %u shaders (%u reused) in %.1f ms, compiled %u shaders and %u pipeline states in %.1f ms using %u threads",
+				statistics.numberOfBuiltShaders, statistics.numberOfReusedShaderSourceCodes, static_cast<double>(statistics.builderTimeInMicroseconds) / 1000.0,
+				statistics.numberOfCompiledShaders, statistics.numberOfCompiledPipelineStates, static_cast<double>(statistics.compilerTimeInMicroseconds) / 1000.0, numberOfThreads)
 		}
-	}
 
-	void ProjectImpl::shutdownAssetMonitor()
-	{
-		if (nullptr != mProjectAssetMonitor)
+		// Restore the previous pipeline state compiler settings
+		pipelineStateCompiler.setAsynchronousCompilationEnabled(asynchronousCompilationEnabled);
+		pipelineStateCompiler.setNumberOfBuilderThreads(numberOfBuilderThreads);
+		pipelineStateCompiler.setNumberOfCompilerThreads(numberOfCompilerThreads);
+		shaderBlueprintResourceManager.setShaderBytecodeCompiler(nullptr);
+
+		// The renderer toolkit is now considered to be idle
+		mRendererToolkitImpl.setState(IRendererToolkit::State::IDLE);
+		if (!saved)
 		{
-			delete mProjectAssetMonitor;
-			mProjectAssetMonitor = nullptr;
+			throw std::runtime_error("Failed to save the pipeline state object cache of asset package \"" + virtualAssetPackageFilename + '"');
 		}
 	}
 
@@ -534,9 +610,15 @@ namespace RendererToolkit
 		mAbsoluteProjectDirectory.clear();
 		mAssetPackage.clear();
 		mAssetPackageDirectoryName.clear();
+		mVirtualProjectFilenames.clear();
 		mSourceAssetIdToCompiledAssetId.clear();
 		mCompiledAssetIdToSourceAssetId.clear();
 		mSourceAssetIdToVirtualFilename.clear();
+		mCompiledMaterialBlueprintAssetIds.clear();
+		for (CompilerQueue& compilationStage : mCompilationStages)
+		{
+			compilationStage.clear();
+		}
 		if (nullptr != mRapidJsonDocument)
 		{
 			delete mRapidJsonDocument;
@@ -589,7 +671,8 @@ namespace RendererToolkit
 		{
 			mRapidJsonDocument = new rapidjson::Document();
 		}
-		JsonHelper::loadDocumentByFilename(mContext.getFileManager(), mProjectName + '/' + relativeFilename, "Targets", "1", *mRapidJsonDocument);
+		mVirtualProjectFilenames.push_back(mProjectName + '/' + relativeFilename);
+		JsonHelper::loadDocumentByFilename(mContext.getFileManager(), mVirtualProjectFilenames.back(), "Targets", "1", *mRapidJsonDocument);
 	}
 
 	std::string ProjectImpl::getRenderTargetDataRootDirectory(const char* rendererTarget) const
@@ -633,16 +716,435 @@ namespace RendererToolkit
 			mSourceAssetIdToCompiledAssetId.emplace(asset.assetId, compiledAssetId);
 			mCompiledAssetIdToSourceAssetId.emplace(compiledAssetId, asset.assetId);
 			mSourceAssetIdToVirtualFilename.emplace(asset.assetId, virtualFilename);
+			if (assetType == "MaterialBlueprint")
+			{
+				mCompiledMaterialBlueprintAssetIds.push_back(compiledAssetId);
+			}
+
+			// Sort the asset into its compilation stage, the sorted asset vector of the asset package isn't changed after loading
+			mCompilationStages[::detail::getCompilationStageByAssetCompilerTypeId(AssetCompilerTypeId(assetType.c_str()))].push_back(&asset);
 		}
 	}
 
-	void ProjectImpl::threadWorker()
+	void ProjectImpl::destroyCompilerThreads()
 	{
-		RendererRuntime::PlatformManager::setCurrentThreadName("Project worker", "Renderer toolkit: Project worker");
+		{
+			std::lock_guard<std::mutex> compilerMutexLock(mCompilerMutex);
+			mShutdownCompilerThread = true;
+		}
+		mCompilerConditionVariable.notify_all();
+		for (std::thread& thread : mCompilerThreads)
+		{
+			thread.join();
+		}
+		mCompilerThreads.clear();
+		mNumberOfCompilerThreads = 0;
+	}
+
+	void ProjectImpl::setupContentCache()
+	{
+		RendererRuntime::IFileManager& fileManager = mContext.getFileManager();
+		if (mAbsoluteContentCacheDirectory.empty())
+		{
+			// Local default, the content cache is disabled if there's no local data
+			const char* localDataMountPoint = fileManager.getLocalDataMountPoint();
+			mCacheManager->setContentCacheDirectory((nullptr != localDataMountPoint) ? std::string(localDataMountPoint) + "/RendererToolkit/ContentCache" : std::string());
+		}
+		else
+		{
+			// Shared content cache, e.g. a network directory
+			static constexpr const char* MOUNT_POINT = "RendererToolkitContentCache";
+			if (fileManager.mountDirectory(mAbsoluteContentCacheDirectory.c_str(), MOUNT_POINT))
+			{
+				mCacheManager->setContentCacheDirectory(MOUNT_POINT);
+			}
+			else
+			{
+				RENDERER_LOG(mContext, WARNING, "Failed to mount the content cache directory \"%s\", the content cache is disabled", mAbsoluteContentCacheDirectory.c_str())
+				mCacheManager->setContentCacheDirectory(std::string());
+			}
+		}
+	}
+
+	void ProjectImpl::compileAssets(const char* rendererTarget, const VirtualFilenames* changedVirtualFilenames)
+	{
+		// The renderer toolkit is now considered to be busy
+		// -> The state is only changed by this coordinating thread, never by the compiler threads
+		mRendererToolkitImpl.setState(IRendererToolkit::State::BUSY);
+		try
+		{
+			const RendererRuntime::Stopwatch stopwatch(true);
+			const RendererRuntime::IFileManager& fileManager = mContext.getFileManager();
+			const RendererRuntime::AssetPackage::SortedAssetVector& sortedAssetVector = mAssetPackage.getSortedAssetVector();
+			const size_t numberOfAssets = sortedAssetVector.size();
+			SourceAssetIds sourceAssetIds;
+			sourceAssetIds.reserve(numberOfAssets);
+			for (const RendererRuntime::Asset& asset : sortedAssetVector)
+			{
+				sourceAssetIds.push_back(asset.assetId);
+			}
+
+			// Changing the project or targets file enforces compiling all assets, the changed files can't be mapped to assets in this case
+			if (nullptr != changedVirtualFilenames)
+			{
+				for (const std::string& changedVirtualFilename : *changedVirtualFilenames)
+				{
+					if (std::find(mVirtualProjectFilenames.cbegin(), mVirtualProjectFilenames.cend(), changedVirtualFilename) != mVirtualProjectFilenames.cend())
+					{
+						changedVirtualFilenames = nullptr;
+						break;
+					}
+				}
+			}
+
+			// Discover the assets to compile by using the asset dependency graph of the previous compilation run
+			AssetDependencyGraph assetDependencyGraph(mContext, mProjectName, rendererTarget);
+			const bool assetsRemoved = assetDependencyGraph.removeUnknownNodes(sourceAssetIds);
+			SourceAssetIds changedAssetIds;
+			SourceAssetIds unknownAssetIds;
+			SourceAssetIds dependentAssetIds;
+			if (nullptr == changedVirtualFilenames)
+			{
+				// -> Only file sizes and file times are compared, no asset file is parsed and no source file is hashed
+				assetDependencyGraph.updateProjectFiles(mVirtualProjectFilenames);
+				assetDependencyGraph.getAssetsToCompile(sourceAssetIds, changedAssetIds, unknownAssetIds, dependentAssetIds);
+			}
+			else
+			{
+				// -> The changed files are already known, no file is accessed at all
+				// -> Changed asset files are mapped directly, changed source files are mapped by using the input files known by the asset dependency graph
+				std::unordered_set<uint32_t> changedAssetIdSet;
+				for (const std::string& changedVirtualFilename : *changedVirtualFilenames)
+				{
+					const uint32_t sourceAssetId = RendererRuntime::StringId(changedVirtualFilename.c_str());
+					if (mSourceAssetIdToVirtualFilename.find(sourceAssetId) != mSourceAssetIdToVirtualFilename.cend() && changedAssetIdSet.insert(sourceAssetId).second)
+					{
+						changedAssetIds.push_back(sourceAssetId);
+					}
+				}
+				SourceAssetIds sourceAssetIdsByInputFiles;
+				assetDependencyGraph.getAssetsByInputFiles(*changedVirtualFilenames, sourceAssetIdsByInputFiles);
+				for (uint32_t sourceAssetId : sourceAssetIdsByInputFiles)
+				{
+					if (changedAssetIdSet.insert(sourceAssetId).second)
+					{
+						changedAssetIds.push_back(sourceAssetId);
+					}
+				}
+
+				// Assets without a node, e.g. because their last compilation failed, are still unknown
+				for (uint32_t sourceAssetId : sourceAssetIds)
+				{
+					if (nullptr == assetDependencyGraph.tryGetNode(sourceAssetId))
+					{
+						unknownAssetIds.push_back(sourceAssetId);
+					}
+				}
+
+				// Gather the transitive closure of the changed and unknown assets
+				SourceAssetIds changedOrUnknownAssetIds(changedAssetIds);
+				changedOrUnknownAssetIds.insert(changedOrUnknownAssetIds.end(), unknownAssetIds.cbegin(), unknownAssetIds.cend());
+				assetDependencyGraph.getDependentAssets(changedOrUnknownAssetIds, dependentAssetIds);
+			}
+			RENDERER_LOG(mContext, INFORMATION, "Found %u changed, %u unknown and %u depending assets", changedAssetIds.size(), unknownAssetIds.size(), dependentAssetIds.size())
+
+			// Compile the transitive closure of changed assets
+			const size_t numberOfAssetsToCompile = changedAssetIds.size() + unknownAssetIds.size() + dependentAssetIds.size();
+			if (numberOfAssetsToCompile > 0)
+			{
+				// The cache manager would skip unknown assets and assets whose own files are unchanged, enforce their compilation
+				// -> Unknown assets need to be compiled to record their dependencies, depending assets need to pick up the changes of the assets they depend on
+				std::unordered_set<uint32_t> assetIdsToCompile(changedAssetIds.cbegin(), changedAssetIds.cend());
+				for (const SourceAssetIds* enforcedAssetIds : { &unknownAssetIds, &dependentAssetIds })
+				{
+					for (uint32_t sourceAssetId : *enforcedAssetIds)
+					{
+						SourceAssetIdToVirtualFilename::const_iterator iterator = mSourceAssetIdToVirtualFilename.find(sourceAssetId);
+						RENDERER_ASSERT(getContext(), mSourceAssetIdToVirtualFilename.cend() != iterator, "Unknown renderer toolkit source asset ID")
+						mCacheManager->invalidateFile(rendererTarget, iterator->second);
+						assetIdsToCompile.insert(sourceAssetId);
+					}
+				}
+
+				// Content cache entries can be shared by renderer targets with the same configuration
+				mCacheManager->setRendererTargetConfigurationHash(rendererTarget, ::detail::getRendererTargetConfigurationHash((*mRapidJsonDocument)["Targets"], rendererTarget, mQualityStrategy));
+
+				// The compilation stages are processed one after another, this way an asset is compiled after the assets it depends on
+				RENDERER_LOG(mContext, INFORMATION, "Compiling %u of %u assets using %u compiler threads", numberOfAssetsToCompile, numberOfAssets, mNumberOfCompilerThreads)
+				CompilerQueue compilerQueue;
+				for (uint8_t compilationStage = 0; compilationStage < NUMBER_OF_COMPILATION_STAGES; ++compilationStage)
+				{
+					compilerQueue.clear();
+					for (const RendererRuntime::Asset* asset : mCompilationStages[compilationStage])
+					{
+						if (assetIdsToCompile.find(asset->assetId) != assetIdsToCompile.cend())
+						{
+							compilerQueue.push_back(asset);
+						}
+					}
+					if (MATERIAL_STAGE == compilationStage)
+					{
+						// Materials can derive from base materials, a base material must be compiled before the materials deriving from it
+						// -> "RendererToolkit::CacheManager::dependencyFilesChanged()" only knows about a changed base material after it has been checked
+						// -> The materials are compiled in waves, the materials of a wave have the same number of base materials and don't depend on each other
+						std::unordered_map<uint32_t, uint32_t> baseMaterialDepths;
+						std::vector<CompilerQueue> materialWaves;
+						for (const RendererRuntime::Asset* asset : compilerQueue)
+						{
+							const uint32_t baseMaterialDepth = getBaseMaterialDepth(asset->assetId, baseMaterialDepths);
+							if (materialWaves.size() <= baseMaterialDepth)
+							{
+								materialWaves.resize(baseMaterialDepth + 1);
+							}
+							materialWaves[baseMaterialDepth].push_back(asset);
+						}
+						for (const CompilerQueue& materialWave : materialWaves)
+						{
+							processCompilerQueue(materialWave, rendererTarget, assetDependencyGraph);
+						}
+					}
+					else
+					{
+						processCompilerQueue(compilerQueue, rendererTarget, assetDependencyGraph);
+					}
+				}
+			}
+
+			// Write runtime asset package, if necessary
+			const std::string virtualAssetPackageFilename = getRenderTargetDataRootDirectory(rendererTarget) + '/' + mProjectName + '/' + mAssetPackageDirectoryName + '/' + mAssetPackageDirectoryName + ".assets";
+			if (numberOfAssetsToCompile > 0 || assetsRemoved || !fileManager.doesFileExist(virtualAssetPackageFilename.c_str()))
+			{
+				// Gather the output assets of all assets, the asset dependency graph knows the output assets of unchanged assets
+				RendererRuntime::AssetPackage::SortedAssetVector sortedOutputAssetVector;
+				sortedOutputAssetVector.reserve(numberOfAssets);
+				for (uint32_t sourceAssetId : sourceAssetIds)
+				{
+					const AssetDependencyGraph::Node* node = assetDependencyGraph.tryGetNode(sourceAssetId);
+					RENDERER_ASSERT(getContext(), nullptr != node, "Invalid renderer toolkit asset dependency graph node")
+					sortedOutputAssetVector.insert(sortedOutputAssetVector.end(), node->outputAssets.cbegin(), node->outputAssets.cend());
+				}
+				RendererRuntime::MemoryFile memoryFile(0, 4096);
+
+				// Ensure the asset package is sorted
+				std::sort(sortedOutputAssetVector.begin(), sortedOutputAssetVector.end(), ::detail::orderByAssetId);
+
+				{ // Write down the asset package header
+					RendererRuntime::v1AssetPackage::AssetPackageHeader assetPackageHeader;
+					assetPackageHeader.numberOfAssets = static_cast<uint32_t>(sortedOutputAssetVector.size());
+					memoryFile.write(&assetPackageHeader, sizeof(RendererRuntime::v1AssetPackage::AssetPackageHeader));
+				}
+
+				// Write down the asset package content in one single burst
+				memoryFile.write(sortedOutputAssetVector.data(), sizeof(RendererRuntime::Asset) * sortedOutputAssetVector.size());
+
+				// Write LZ4 compressed output
+				memoryFile.writeLz4CompressedDataByVirtualFilename(RendererRuntime::StringId("AssetPackage"), RendererRuntime::v1AssetPackage::FORMAT_VERSION, fileManager, virtualAssetPackageFilename.c_str());
+			}
+
+			// Save the asset dependency graph for the next compilation run
+			assetDependencyGraph.save();
+
+			{ // Content cache statistics, must be gathered before the internal caches are cleared
+				uint32_t numberOfContentCacheHits = 0;
+				uint32_t numberOfContentCacheMisses = 0;
+				mCacheManager->getContentCacheStatistics(numberOfContentCacheHits, numberOfContentCacheMisses);
+				const uint32_t numberOfContentCacheLookups = numberOfContentCacheHits + numberOfContentCacheMisses;
+				if (numberOfContentCacheLookups > 0)
+				{
+					RENDERER_LOG(mContext, INFORMATION, "Content cache: %u hits, %u misses, %.1f%% hit rate", numberOfContentCacheHits, numberOfContentCacheMisses, static_cast<double>(numberOfContentCacheHits) * 100.0 / static_cast<double>(numberOfContentCacheLookups))
+				}
+			}
+
+			// Compilation run finished clear internal caches/states
+			onCompilationRunFinished();
+			RENDERER_LOG(mContext, INFORMATION, "Compilation run of %u assets finished in %.3f seconds using %u compiler threads, %u assets have been compiled", numberOfAssets, static_cast<double>(stopwatch.getSeconds()), mNumberOfCompilerThreads, numberOfAssetsToCompile)
+		}
+		catch (const std::exception&)
+		{
+			// The compilation run failed, still save the renderer toolkit cache so the successfully compiled assets don't need to be compiled again
+			onCompilationRunFinished();
+			throw;
+		}
+	}
+
+	void ProjectImpl::processCompilerQueue(const CompilerQueue& compilerQueue, const char* rendererTarget, AssetDependencyGraph& assetDependencyGraph)
+	{
+		if (compilerQueue.empty())
+		{
+			// Nothing to do
+			return;
+		}
+
+		// Hand the assets over to the compiler threads
+		// -> The compiler threads process the compiler queue from back to front, so reverse it to process the assets in the given order
+		std::unique_lock<std::mutex> compilerMutexLock(mCompilerMutex);
+		RENDERER_ASSERT(getContext(), mCompilerQueue.empty() && 0 == mNumberOfCompilingAssets, "There's already a compilation run in progress")
+		mCompilerRendererTarget = rendererTarget;
+		mCompilerAssetDependencyGraph = &assetDependencyGraph;
+		mCompilerQueue.assign(compilerQueue.crbegin(), compilerQueue.crend());
+		compilerMutexLock.unlock();
+		mCompilerConditionVariable.notify_all();
+
+		// Wait until all assets have been compiled, consume the results as soon as they're available
+		std::string errorMessage;
+		compilerMutexLock.lock();
+		bool finished = false;
+		while (!finished)
+		{
+			mCompilerFinishedConditionVariable.wait(compilerMutexLock, [this]() { return (!mCompilerProcessedAssetIds.empty() || (mCompilerQueue.empty() && 0 == mNumberOfCompilingAssets)); });
+			finished = (mCompilerQueue.empty() && 0 == mNumberOfCompilingAssets);
+			SourceAssetIds processedAssetIds;
+			std::swap(processedAssetIds, mCompilerProcessedAssetIds);
+			if (finished)
+			{
+				// Reset the compiler queue state, the asset dependency graph must not be touched by the compiler threads after we're done
+				std::swap(errorMessage, mCompilerErrorMessage);
+				mCompilerRendererTarget = nullptr;
+				mCompilerAssetDependencyGraph = nullptr;
+			}
+			compilerMutexLock.unlock();
+
+			// Call "RendererRuntime::IRendererRuntime::reloadResourceByAssetId()" directly after an asset has been compiled to see changes as early as possible
+			if (nullptr != mProjectAssetMonitor)
+			{
+				for (RendererRuntime::AssetId sourceAssetId : processedAssetIds)
+				{
+					SourceAssetIdToCompiledAssetId::const_iterator iterator = mSourceAssetIdToCompiledAssetId.find(sourceAssetId);
+					RENDERER_ASSERT(getContext(), mSourceAssetIdToCompiledAssetId.cend() != iterator, "Unknown renderer toolkit source asset ID")
+					mProjectAssetMonitor->mRendererRuntime.reloadResourceByAssetId(iterator->second);
+				}
+			}
+
+			if (!finished)
+			{
+				compilerMutexLock.lock();
+			}
+		}
+
+		// Error handling
+		if (!errorMessage.empty())
+		{
+			throw std::runtime_error(errorMessage);
+		}
+	}
+
+	uint32_t ProjectImpl::getBaseMaterialDepth(uint32_t sourceAssetId, std::unordered_map<uint32_t, uint32_t>& baseMaterialDepths) const
+	{
+		// Already known?
+		static constexpr uint32_t VISITING = ~0u;
+		std::unordered_map<uint32_t, uint32_t>::const_iterator iterator = baseMaterialDepths.find(sourceAssetId);
+		if (baseMaterialDepths.cend() != iterator)
+		{
+			if (VISITING == iterator->second)
+			{
+				throw std::runtime_error("The base material of material asset \"" + mSourceAssetIdToVirtualFilename.at(sourceAssetId) + "\" derives from the material itself");
+			}
+			return iterator->second;
+		}
+		baseMaterialDepths.emplace(sourceAssetId, VISITING);
+
+		// Parse the asset JSON and the material JSON, only the optional base material is of interest
+		// -> Errors are ignored in here, compiling the material asset will fail with a proper error message
+		const std::string& virtualAssetFilename = mSourceAssetIdToVirtualFilename.at(sourceAssetId);
+		uint32_t baseMaterialSourceAssetId = RendererRuntime::getUninitialized<uint32_t>();
+		try
+		{
+			const RendererRuntime::IFileManager& fileManager = mContext.getFileManager();
+			rapidjson::Document rapidJsonDocumentAsset;
+			JsonHelper::loadDocumentByFilename(fileManager, virtualAssetFilename, "Asset", "1", rapidJsonDocumentAsset);
+			const std::string virtualAssetInputDirectory = std_filesystem::path(virtualAssetFilename).parent_path().generic_string();
+			rapidjson::Document rapidJsonDocumentMaterial;
+			JsonHelper::loadDocumentByFilename(fileManager, virtualAssetInputDirectory + '/' + rapidJsonDocumentAsset["Asset"]["MaterialAssetCompiler"]["InputFile"].GetString(), "MaterialAsset", "1", rapidJsonDocumentMaterial);
+			const rapidjson::Value& rapidJsonValueMaterialAsset = rapidJsonDocumentMaterial["MaterialAsset"];
+			if (rapidJsonValueMaterialAsset.HasMember("BaseMaterial"))
+			{
+				SourceAssetIds dependencySourceAssetIds;
+				const IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, mProjectName + '/' + mAssetPackageDirectoryName, virtualAssetFilename, virtualAssetInputDirectory, std::string(), mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds, dependencySourceAssetIds);
+				baseMaterialSourceAssetId = StringHelper::getSourceAssetIdByString(rapidJsonValueMaterialAsset["BaseMaterial"].GetString(), input);
+			}
+		}
+		catch (const std::exception&)
+		{
+			// Nothing here, see above
+		}
+
+		// The base material must be a material asset of this project
+		uint32_t baseMaterialDepth = 0;
+		if (RendererRuntime::isInitialized(baseMaterialSourceAssetId) && mSourceAssetIdToVirtualFilename.find(baseMaterialSourceAssetId) != mSourceAssetIdToVirtualFilename.cend())
+		{
+			baseMaterialDepth = getBaseMaterialDepth(baseMaterialSourceAssetId, baseMaterialDepths) + 1;
+		}
 
-		while (!mShutdownThread)
+		// Done
+		baseMaterialDepths[sourceAssetId] = baseMaterialDepth;
+		return baseMaterialDepth;
+	}
+
+	void ProjectImpl::compilerThreadWorker()
+	{
+		RendererRuntime::PlatformManager::setCurrentThreadName("Project compiler", "Renderer toolkit: Project compiler");
+		std::unique_lock<std::mutex> compilerMutexLock(mCompilerMutex);
+		while (!mShutdownCompilerThread)
 		{
-			// TODO(co) Implement me
+			// Continue as long as there's an asset left inside the compiler queue, if it's empty go to sleep
+			mCompilerConditionVariable.wait(compilerMutexLock, [this]() { return (!mCompilerQueue.empty() || mShutdownCompilerThread); });
+			while (!mCompilerQueue.empty() && !mShutdownCompilerThread)
+			{
+				// Get the asset to compile
+				const RendererRuntime::Asset& asset = *mCompilerQueue.back();
+				mCompilerQueue.pop_back();
+				++mNumberOfCompilingAssets;
+				const char* rendererTarget = mCompilerRendererTarget;
+				AssetDependencyGraph& assetDependencyGraph = *mCompilerAssetDependencyGraph;
+
+				// Asset compilers skipping the compilation because nothing has been changed might not resolve the assets they depend on,
+				// in this case the previously known dependencies are kept
+				SourceAssetIds previousDependencySourceAssetIds;
+				{
+					const AssetDependencyGraph::Node* node = assetDependencyGraph.tryGetNode(asset.assetId);
+					if (nullptr != node)
+					{
+						previousDependencySourceAssetIds = node->dependencySourceAssetIds;
+					}
+				}
+				compilerMutexLock.unlock();
+
+				// Do the work
+				// -> Compile into a compiler thread local output asset package to not have to lock the mutex inside the asset compilers
+				// -> Gather the input files of the asset while the mutex isn't locked
+				std::string errorMessage;
+				RendererRuntime::AssetPackage outputAssetPackage;
+				SourceAssetIds dependencySourceAssetIds;
+				AssetDependencyGraph::InputFiles inputFiles;
+				try
+				{
+					RENDERER_LOG(mContext, INFORMATION, "Compiling asset \"%s\"", asset.virtualFilename)
+					compileAsset(asset, rendererTarget, outputAssetPackage, dependencySourceAssetIds);
+					VirtualFilenames virtualInputFilenames(1, asset.virtualFilename);
+					mCacheManager->getVirtualSourceFilenames(asset.virtualFilename, virtualInputFilenames);
+					assetDependencyGraph.fillInputFiles(virtualInputFilenames, inputFiles);
+				}
+				catch (const std::exception& e)
+				{
+					errorMessage = e.what();
+				}
+
+				// Hand the result over to the thread waiting for the compiler queue to be processed
+				compilerMutexLock.lock();
+				if (errorMessage.empty())
+				{
+					mCompilerProcessedAssetIds.push_back(asset.assetId);
+					assetDependencyGraph.setNode(asset.assetId, inputFiles, dependencySourceAssetIds.empty() ? previousDependencySourceAssetIds : dependencySourceAssetIds, outputAssetPackage.getSortedAssetVector());
+				}
+				else if (mCompilerErrorMessage.empty())
+				{
+					// Remember the first error and cancel the remaining compiler queue, the compilation run failed
+					mCompilerErrorMessage = errorMessage;
+					mCompilerQueue.clear();
+				}
+				--mNumberOfCompilingAssets;
+				mCompilerFinishedConditionVariable.notify_one();
+			}
 		}
 	}
 